@@ -0,0 +1,372 @@
+/*
+*	ps2intrin-bench: throughput of the kernels built with the host backend, the same code
+*	'ps2intrin-bake' runs. The numbers measure the host backend, not the EE, and are meant for
+*	comparing changes to a kernel on one machine. Inputs are built once and are the same on every
+*	run.
+*
+*	Usage: ps2intrin-bench [-t <milliseconds>] [<name>...]
+*		-t <milliseconds>	Time spent in each benchmark (default: 200)
+*		<name>				Only run the benchmarks whose name contains one of these
+*/
+
+#include <ps2kernels/adpcm.h>
+#include <ps2kernels/base64.h>
+#include <ps2kernels/chacha20.h>
+#include <ps2kernels/checksum.h>
+#include <ps2kernels/inflate.h>
+#include <ps2kernels/lz4.h>
+#include <ps2kernels/particles.h>
+#include <ps2kernels/sha.h>
+#include <ps2kernels/skinning.h>
+#include <ps2kernels/snapshot.h>
+#include <ps2kernels/texture.h>
+#include <ps2kernels/utf8.h>
+
+#ifdef PS2INTRIN_BENCH_ZLIB
+#include <zlib.h>
+#endif
+
+#include <chrono>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <functional>
+#include <memory>
+#include <string>
+#include <utility>
+#include <vector>
+
+namespace
+{
+	/// Bytes, samples or items every benchmark works on per call
+	const size_t buffer_size = 1 << 20;
+	const size_t vertex_count = 16384;
+	const size_t particle_count = 16384;
+
+	void usage()
+	{
+		std::fprintf(stderr, "usage: ps2intrin-bench [-t <milliseconds>] [<name>...]\n");
+	}
+
+	struct alignas(16) quadword
+	{
+		uint8_t bytes[16];
+	};
+
+	/// @brief 16-byte aligned buffer
+	class buffer
+	{
+	public:
+		explicit buffer(size_t size) : storage((size + 15) / 16) {}
+
+		uint8_t* data() { return storage[0].bytes; }
+		template<typename T> T* as() { return reinterpret_cast<T*>(data()); }
+
+	private:
+		std::vector<quadword> storage;
+	};
+
+	typedef std::shared_ptr<buffer> shared_buffer;
+
+	/// @brief Words from a small vocabulary, compressible like typical text assets
+	shared_buffer make_words(size_t size)
+	{
+		const char* words[] = { "alpha ", "beta ", "gamma ", "delta ", "epsilon ", "zeta ", "eta ", "theta " };
+		auto result = std::make_shared<buffer>(size);
+		uint32_t x = 1;
+		for (size_t i = 0; i < size;)
+		{
+			x = x * 1103515245u + 12345u;
+			for (const char* c = words[(x >> 16) % 8]; *c != '\0' && i < size; ++c)
+			{
+				result->data()[i++] = static_cast<uint8_t>(*c);
+			}
+		}
+		return result;
+	}
+
+	struct benchmark
+	{
+		std::string name;
+		/// Unit of what 'run' returns, per second
+		const char* unit;
+		/// Runs the kernel once, returns the amount of work done in 'unit'
+		std::function<double()> run;
+	};
+
+	void add_bake(std::vector<benchmark>& all, shared_buffer words, shared_buffer output)
+	{
+		all.push_back({ "bake/swizzle8", "MB/s", [=] {
+			texture_swizzle8(output->data(), words->data(), 1024, buffer_size / 1024);
+			return buffer_size / 1e6;
+		} });
+		all.push_back({ "bake/5551", "MB/s", [=] {
+			texture_rgba32_to_5551(output->as<uint16_t>(), words->as<uint32_t>(), buffer_size / 4);
+			return buffer_size / 1e6;
+		} });
+		all.push_back({ "bake/adpcm", "MB/s", [=] {
+			adpcm_state_t state;
+			adpcm_state_construct(&state);
+			size_t blocks = buffer_size / 2 / ADPCM_BLOCK_SAMPLES;
+			adpcm_encode(&state, output->data(), words->as<int16_t>(), blocks);
+			return blocks * ADPCM_BLOCK_SAMPLES * 2 / 1e6;
+		} });
+		all.push_back({ "adpcm/decode", "MB/s", [=] {
+			adpcm_state_t state;
+			adpcm_state_construct(&state);
+			size_t blocks = buffer_size / ADPCM_BLOCK_BYTES / 4;
+			adpcm_decode(&state, output->as<int16_t>(), words->data(), blocks);
+			return blocks * ADPCM_BLOCK_BYTES / 1e6;
+		} });
+	}
+
+	void add_text(std::vector<benchmark>& all, shared_buffer words, shared_buffer output)
+	{
+		auto text = std::make_shared<std::vector<char>>(BASE64_ENCODED_SIZE(buffer_size));
+		base64_encode(words->data(), buffer_size, text->data());
+
+		all.push_back({ "base64/encode", "MB/s", [=] {
+			base64_encode(words->data(), buffer_size, output->as<char>());
+			return buffer_size / 1e6;
+		} });
+		all.push_back({ "base64/decode", "MB/s", [=] {
+			size_t invalid;
+			base64_decode(text->data(), text->size(), output->data(), &invalid);
+			return text->size() / 1e6;
+		} });
+		all.push_back({ "hex/encode", "MB/s", [=] {
+			hex_encode(words->data(), buffer_size, output->as<char>());
+			return buffer_size / 1e6;
+		} });
+		all.push_back({ "utf8/validate", "MB/s", [=] {
+			utf8_validate(words->as<const char>(), buffer_size);
+			return buffer_size / 1e6;
+		} });
+		all.push_back({ "utf8/to_utf16", "MB/s", [=] {
+			size_t invalid;
+			utf8_to_utf16(words->as<const char>(), buffer_size, output->as<uint16_t>(), &invalid);
+			return buffer_size / 1e6;
+		} });
+		all.push_back({ "checksum", "MB/s", [=] {
+			inet_checksum(words->data(), buffer_size);
+			return buffer_size / 1e6;
+		} });
+	}
+
+	void add_crypto(std::vector<benchmark>& all, shared_buffer words, shared_buffer output)
+	{
+		all.push_back({ "chacha20", "MB/s", [=] {
+			alignas(16) chacha20_t context;
+			const uint8_t key[CHACHA20_KEY_SIZE] = {};
+			const uint8_t nonce[CHACHA20_NONCE_SIZE] = {};
+			chacha20_init(&context, key, nonce, 1);
+			chacha20_xor(&context, output->data(), words->data(), buffer_size);
+			return buffer_size / 1e6;
+		} });
+
+		// 64 messages of 16 KiB, queued together
+		auto jobs = std::make_shared<std::vector<sha_job_t>>();
+		for (size_t i = 0; i < 64; ++i)
+		{
+			jobs->push_back({ words->data() + i * (buffer_size / 64), buffer_size / 64, output->data() + 32 * i });
+		}
+		all.push_back({ "sha256/multi", "MB/s", [=] {
+			sha256_multi(jobs->data(), jobs->size());
+			return buffer_size / 1e6;
+		} });
+		all.push_back({ "sha256/single", "MB/s", [=] {
+			sha256(words->data(), buffer_size, output->data());
+			return buffer_size / 1e6;
+		} });
+		all.push_back({ "sha1/multi", "MB/s", [=] {
+			sha1_multi(jobs->data(), jobs->size());
+			return buffer_size / 1e6;
+		} });
+	}
+
+	void add_compression(std::vector<benchmark>& all, shared_buffer words, shared_buffer output)
+	{
+		auto workspace = std::make_shared<lz4_workspace_t>();
+		auto block = std::make_shared<std::vector<uint8_t>>(LZ4_COMPRESSED_SIZE(buffer_size));
+		block->resize(lz4_compress(words->data(), buffer_size, block->data(), block->size(), LZ4_EFFORT_DEFAULT,
+								   workspace.get()));
+
+		const std::pair<const char*, unsigned> efforts[] = {
+			{ "lz4/compress/fast", LZ4_EFFORT_FAST },
+			{ "lz4/compress/default", LZ4_EFFORT_DEFAULT },
+			{ "lz4/compress/max", LZ4_EFFORT_MAX },
+		};
+		for (const auto& effort : efforts)
+		{
+			unsigned level = effort.second;
+			all.push_back({ effort.first, "MB/s", [=] {
+				lz4_compress(words->data(), buffer_size, output->data(), LZ4_COMPRESSED_SIZE(buffer_size), level,
+							 workspace.get());
+				return buffer_size / 1e6;
+			} });
+		}
+		all.push_back({ "lz4/decompress", "MB/s", [=] {
+			lz4_decompress(block->data(), block->size(), output->data(), buffer_size);
+			return buffer_size / 1e6;
+		} });
+
+		// Every 16th quadword changed
+		auto changed = std::make_shared<buffer>(buffer_size);
+		std::memcpy(changed->data(), words->data(), buffer_size);
+		for (size_t i = 0; i < buffer_size; i += 256)
+		{
+			changed->data()[i] ^= 1;
+		}
+		all.push_back({ "snapshot/encode", "MB/s", [=] {
+			snapshot_delta_encode(changed->data(), words->data(), buffer_size / 16, output->data());
+			return buffer_size / 1e6;
+		} });
+
+#ifdef PS2INTRIN_BENCH_ZLIB
+		auto stream = std::make_shared<std::vector<uint8_t>>(compressBound(buffer_size));
+		uLongf length = static_cast<uLongf>(stream->size());
+		compress2(stream->data(), &length, words->data(), buffer_size, 6);
+		stream->resize(length);
+		all.push_back({ "inflate", "MB/s", [=] {
+			alignas(16) inflate_t context;
+			size_t consumed;
+			inflate_init(&context, output->data(), buffer_size, true);
+			inflate_run(&context, stream->data(), stream->size(), &consumed);
+			return context.position / 1e6;
+		} });
+#endif
+	}
+
+	void add_geometry(std::vector<benchmark>& all)
+	{
+		struct skinning_data
+		{
+			buffer streams{ 6 * vertex_count * sizeof(int16_t) };
+			buffer results{ 6 * vertex_count * sizeof(int16_t) };
+			buffer weights{ 4 * vertex_count * sizeof(int16_t) };
+			std::vector<uint8_t> bones = std::vector<uint8_t>(4 * vertex_count);
+			alignas(16) skin_matrix_t palette[64];
+		};
+		auto skinning = std::make_shared<skinning_data>();
+		std::memset(skinning->palette, 0, sizeof(skinning->palette));
+		for (size_t b = 0; b < 64; ++b)
+		{
+			for (int r = 0; r < 3; ++r)
+			{
+				skinning->palette[b].rows[r][r] = 1 << SKIN_MATRIX_SHIFT;
+				skinning->palette[b].rows[r][3] = static_cast<int16_t>(b);
+			}
+		}
+		for (size_t i = 0; i < 4 * vertex_count; ++i)
+		{
+			skinning->bones[i] = static_cast<uint8_t>(i * 7 % 64);
+			skinning->weights.as<int16_t>()[i] = 8191;
+		}
+		for (unsigned influences : { 1u, 4u })
+		{
+			all.push_back({ "skinning/" + std::to_string(influences), "Mvertices/s", [=] {
+				int16_t* in = skinning->streams.as<int16_t>();
+				int16_t* out = skinning->results.as<int16_t>();
+				skin_input_t input = {
+					in, in + vertex_count, in + 2 * vertex_count,
+					in + 3 * vertex_count, in + 4 * vertex_count, in + 5 * vertex_count,
+					skinning->bones.data(), skinning->weights.as<int16_t>(), influences,
+				};
+				skin_output_t output = {
+					out, out + vertex_count, out + 2 * vertex_count,
+					out + 3 * vertex_count, out + 4 * vertex_count, out + 5 * vertex_count,
+				};
+				skin_vertices(skinning->palette, &input, &output, vertex_count);
+				return vertex_count / 1e6;
+			} });
+		}
+
+		// Lives long enough that no particle dies while measuring.
+		auto particles = std::make_shared<buffer>(7 * particle_count * sizeof(int32_t));
+		for (size_t i = 0; i < particle_count; ++i)
+		{
+			particles->as<int32_t>()[6 * particle_count + i] = INT32_MAX;
+		}
+		all.push_back({ "particles", "Mparticles/s", [=] {
+			int32_t* s = particles->as<int32_t>();
+			particle_streams_t streams = {
+				s, s + particle_count, s + 2 * particle_count, s + 3 * particle_count,
+				s + 4 * particle_count, s + 5 * particle_count, s + 6 * particle_count, particle_count,
+			};
+			const int32_t gravity[3] = { 0, -(10 << 16), 0 };
+			particle_update(&streams, gravity, 1 << 8);
+			return particle_count / 1e6;
+		} });
+	}
+
+	std::vector<benchmark> benchmarks()
+	{
+		shared_buffer words = make_words(buffer_size);
+		auto output = std::make_shared<buffer>(2 * buffer_size + 4096);
+
+		std::vector<benchmark> all;
+		add_bake(all, words, output);
+		add_text(all, words, output);
+		add_crypto(all, words, output);
+		add_compression(all, words, output);
+		add_geometry(all);
+		return all;
+	}
+
+	/// @return Work done per second
+	double measure(const benchmark& b, std::chrono::milliseconds duration)
+	{
+		typedef std::chrono::steady_clock clock;
+		b.run();
+
+		double work = 0;
+		clock::time_point start = clock::now();
+		clock::duration elapsed;
+		do
+		{
+			work += b.run();
+			elapsed = clock::now() - start;
+		} while (elapsed < duration);
+		return work / std::chrono::duration<double>(elapsed).count();
+	}
+}
+
+int main(int argc, char** argv)
+{
+	std::chrono::milliseconds duration(200);
+	std::vector<std::string> filters;
+
+	for (int i = 1; i < argc; ++i)
+	{
+		std::string arg = argv[i];
+		if (arg == "-t" && i + 1 < argc)
+		{
+			duration = std::chrono::milliseconds(std::strtoul(argv[++i], nullptr, 10));
+		}
+		else if (arg[0] != '-')
+		{
+			filters.push_back(arg);
+		}
+		else
+		{
+			usage();
+			return 2;
+		}
+	}
+
+	for (const benchmark& b : benchmarks())
+	{
+		bool selected = filters.empty();
+		for (const std::string& filter : filters)
+		{
+			selected |= b.name.find(filter) != std::string::npos;
+		}
+		if (selected)
+		{
+			std::printf("%-24s %10.1f %s\n", b.name.c_str(), measure(b, duration), b.unit);
+			std::fflush(stdout);
+		}
+	}
+	return 0;
+}
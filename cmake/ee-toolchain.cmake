@@ -0,0 +1,31 @@
+# Toolchain file for building for the EE Core with the ps2dev toolchain.
+#
+#	cmake -S . -B build-ee -DCMAKE_TOOLCHAIN_FILE=cmake/ee-toolchain.cmake
+#
+# The toolchain is looked up in '$PS2DEV/ee' unless 'PS2INTRIN_EE_PREFIX' is set.
+
+set(CMAKE_SYSTEM_NAME Generic)
+set(CMAKE_SYSTEM_PROCESSOR mips)
+
+if(NOT PS2INTRIN_EE_PREFIX)
+	if(NOT DEFINED ENV{PS2DEV})
+		message(FATAL_ERROR "Set the PS2DEV environment variable or PS2INTRIN_EE_PREFIX to locate the EE toolchain.")
+	endif()
+	set(PS2INTRIN_EE_PREFIX "$ENV{PS2DEV}/ee")
+endif()
+set(PS2INTRIN_EE_PREFIX "${PS2INTRIN_EE_PREFIX}" CACHE PATH "Installation prefix of the EE toolchain")
+list(APPEND CMAKE_TRY_COMPILE_PLATFORM_VARIABLES PS2INTRIN_EE_PREFIX)
+
+set(CMAKE_C_COMPILER "${PS2INTRIN_EE_PREFIX}/bin/mips64r5900el-ps2-elf-gcc")
+set(CMAKE_CXX_COMPILER "${PS2INTRIN_EE_PREFIX}/bin/mips64r5900el-ps2-elf-g++")
+
+set(CMAKE_C_FLAGS_INIT "-D_EE -G0")
+set(CMAKE_CXX_FLAGS_INIT "-D_EE -G0")
+
+set(CMAKE_FIND_ROOT_PATH "${PS2INTRIN_EE_PREFIX}")
+set(CMAKE_FIND_ROOT_PATH_MODE_PROGRAM NEVER)
+set(CMAKE_FIND_ROOT_PATH_MODE_LIBRARY ONLY)
+set(CMAKE_FIND_ROOT_PATH_MODE_INCLUDE ONLY)
+
+# No crt0/linker script is known here, test the compiler without linking.
+set(CMAKE_TRY_COMPILE_TARGET_TYPE STATIC_LIBRARY)
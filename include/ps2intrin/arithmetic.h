@@ -0,0 +1,2588 @@
+#pragma once
+
+/*
+*	Multimedia arithmetic: absolute value, min/max, (saturating) add/subtract, multiply,
+*	multiply-add, divide and leading bit count.
+*/
+
+#include "common.h"
+
+#include "detail/begin.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+	/// @brief PABSH : Parallel ABSolute Halfword
+	/// 
+	/// Calculate the absolute value of 8 16-bit signed values.
+	/// 
+	/// If any of the values is '0x8000' then the result will be truncated to '0x7FFF', or one
+	/// less than the accurate absolute value.
+	/// @param v Values to calculate the absolute value of
+	/// @return Absolute values of argument with truncation
+	FORCEINLINE CONST m128i16 mm_abs_epi16(m128i16 v)
+	{
+		m128i16 result = {};
+
+#ifdef PS2INTRIN_UNSAFE
+		asm(
+			"pabsh	%[Result],%[Value]"
+			: [Result] "=r" (result.v)
+			: [Value] "r" (v.v)
+		);
+#elif defined(PS2INTRIN_HOST)
+		int16_t values[8];
+		int16_t lanes[8];
+
+		memcpy(values, &v, sizeof(values));
+		for (int i = 0; i < 8; ++i)
+		{
+			lanes[i] = values[i] == INT16_MIN ? INT16_MAX : (int16_t)(values[i] < 0 ? -values[i] : values[i]);
+		}
+		memcpy(&result, lanes, sizeof(lanes));
+#else
+		asm(
+			"pcpyld	%[ValueLo],%[ValueHi],%[ValueLo]\n\t"
+			"pabsh	%[ResultLo],%[ValueLo]\n\t"
+			"pcpyud	%[ResultHi],%[ResultLo],%[ResultLo]"
+			: [ResultLo] "=r" (result.lo),
+			  [ResultHi] "=&r" (result.hi)
+			: [ValueLo] "r" (v.lo),
+			  [ValueHi] "r" (v.hi)
+		);
+#endif
+
+		return result;
+	}
+
+	/// @brief PABSW : Parallel ABSolute Word
+	/// 
+	/// Calculate the absolute value of 4 32-bit signed values.
+	/// 
+	/// If any of the values is '0x80000000' then the result will be truncated to '0x7FFFFFFF', or
+	/// one less than the accurate absolute value.
+	/// @param v Values to calculate the absolute value of
+	/// @return Absolute values of argument with truncation
+	FORCEINLINE CONST m128i32 mm_abs_epi32(m128i32 v)
+	{
+		m128i32 result = {};
+
+#ifdef PS2INTRIN_UNSAFE
+		asm(
+			"pabsw	%[Result],%[Value]"
+			: [Result] "=r" (result.v)
+			: [Value] "r" (v.v)
+		);
+#elif defined(PS2INTRIN_HOST)
+		int32_t values[4];
+		int32_t lanes[4];
+
+		memcpy(values, &v, sizeof(values));
+		for (int i = 0; i < 4; ++i)
+		{
+			lanes[i] = values[i] == INT32_MIN ? INT32_MAX : values[i] < 0 ? -values[i] : values[i];
+		}
+		memcpy(&result, lanes, sizeof(lanes));
+#else
+		asm(
+			"pcpyld	%[ValueLo],%[ValueHi],%[ValueLo]\n\t"
+			"pabsw	%[ResultLo],%[ValueLo]\n\t"
+			"pcpyud	%[ResultHi],%[ResultLo],%[ResultLo]"
+			: [ResultLo] "=r" (result.lo),
+			  [ResultHi] "=r" (result.hi)
+			: [ValueLo] "r" (v.lo),
+			  [ValueHi] "r" (v.hi)
+		);
+#endif
+
+		return result;
+	}
+
+	/// @brief PMAXH : Parallel MAXimum Halfword
+	/// 
+	/// Calculate the maximum value of 8 16-bit signed value pairs.
+	/// 
+	/// Unsigned maximum can be achieved by first adding '0x8000' to both operands and then
+	/// subtracting it again after.
+	/// @param l First operand
+	/// @param r Second operand
+	/// @return Maximum value of each value pair
+	FORCEINLINE CONST m128i16 mm_max_epi16(m128i16 l, m128i16 r)
+	{
+		m128i16 result = {};
+
+#ifdef PS2INTRIN_UNSAFE
+		asm(
+			"pmaxh	%[Result],%[Left],%[Right]"
+			: [Result] "=r" (result.v)
+			: [Left] "%r" (l.v),
+			  [Right] "r" (r.v)
+		);
+#elif defined(PS2INTRIN_HOST)
+		int16_t left[8];
+		int16_t right[8];
+		int16_t lanes[8];
+
+		memcpy(left, &l, sizeof(left));
+		memcpy(right, &r, sizeof(right));
+		for (int i = 0; i < 8; ++i)
+		{
+			lanes[i] = left[i] > right[i] ? left[i] : right[i];
+		}
+		memcpy(&result, lanes, sizeof(lanes));
+#else
+		asm(
+			"pcpyld	%[LeftLo],%[LeftHi],%[LeftLo]\n\t"
+			"pcpyld	%[RightLo],%[RightHi],%[RightLo]\n\t"
+			"pmaxh	%[ResultLo],%[LeftLo],%[RightLo]\n\t"
+			"pcpyud	%[ResultHi],%[ResultLo],%[ResultLo]"
+			: [ResultLo] "=r" (result.lo),
+			  [ResultHi] "=&r" (result.hi)
+			: [LeftLo] "r" (l.lo),
+			  [LeftHi] "r" (l.hi),
+			  [RightLo] "r" (r.lo),
+			  [RightHi] "r" (r.hi)
+		);
+#endif
+
+		return result;
+	}
+
+	/// @brief PMAXW : Parallel MAXimum Word
+	/// 
+	/// Calculate the maximum value of 4 32-bit signed value pairs.
+	/// 
+	/// Unsigned maximum can be achieved by first adding '0x80000000' to both operands and then
+	/// subtracting it again after.
+	/// @param l First operand
+	/// @param r Second operand
+	/// @return Maximum value of each value pair
+	FORCEINLINE CONST m128i32 mm_max_epi32(m128i32 l, m128i32 r)
+	{
+		m128i32 result = {};
+
+#ifdef PS2INTRIN_UNSAFE
+		asm(
+			"pmaxw	%[Result],%[Left],%[Right]"
+			: [Result] "=r" (result.v)
+			: [Left] "%r" (l.v),
+			  [Right] "r" (r.v)
+		);
+#elif defined(PS2INTRIN_HOST)
+		int32_t left[4];
+		int32_t right[4];
+		int32_t lanes[4];
+
+		memcpy(left, &l, sizeof(left));
+		memcpy(right, &r, sizeof(right));
+		for (int i = 0; i < 4; ++i)
+		{
+			lanes[i] = left[i] > right[i] ? left[i] : right[i];
+		}
+		memcpy(&result, lanes, sizeof(lanes));
+#else
+		asm(
+			"pcpyld	%[LeftLo],%[LeftHi],%[LeftLo]\n\t"
+			"pcpyld	%[RightLo],%[RightHi],%[RightLo]\n\t"
+			"pmaxw	%[ResultLo],%[LeftLo],%[RightLo]\n\t"
+			"pcpyud	%[ResultHi],%[ResultLo],%[ResultLo]"
+			: [ResultLo] "=r" (result.lo),
+			  [ResultHi] "=&r" (result.hi)
+			: [LeftLo] "r" (l.lo),
+			  [LeftHi] "r" (l.hi),
+			  [RightLo] "r" (r.lo),
+			  [RightHi] "r" (r.hi)
+		);
+#endif
+
+		return result;
+	}
+
+	/// @brief PMINH : Parallel MINimum Halfword
+	/// 
+	/// Calculate the minimum value of 8 16-bit signed value pairs.
+	/// 
+	/// Unsigned minimum can be achieved by first adding '0x8000' to both operands and then
+	/// subtracting it again after.
+	/// @param l First operand
+	/// @param r Second operand
+	/// @return Minimum value of each value pair
+	FORCEINLINE CONST m128i16 mm_min_epi16(m128i16 l, m128i16 r)
+	{
+		m128i16 result = {};
+
+#ifdef PS2INTRIN_UNSAFE
+		asm(
+			"pminh	%[Result],%[Left],%[Right]"
+			: [Result] "=r" (result.v)
+			: [Left] "%r" (l.v),
+			  [Right] "r" (r.v)
+		);
+#elif defined(PS2INTRIN_HOST)
+		int16_t left[8];
+		int16_t right[8];
+		int16_t lanes[8];
+
+		memcpy(left, &l, sizeof(left));
+		memcpy(right, &r, sizeof(right));
+		for (int i = 0; i < 8; ++i)
+		{
+			lanes[i] = left[i] < right[i] ? left[i] : right[i];
+		}
+		memcpy(&result, lanes, sizeof(lanes));
+#else
+		asm(
+			"pcpyld	%[LeftLo],%[LeftHi],%[LeftLo]\n\t"
+			"pcpyld	%[RightLo],%[RightHi],%[RightLo]\n\t"
+			"pminh	%[ResultLo],%[LeftLo],%[RightLo]\n\t"
+			"pcpyud	%[ResultHi],%[ResultLo],%[ResultLo]"
+			: [ResultLo] "=r" (result.lo),
+			  [ResultHi] "=&r" (result.hi)
+			: [LeftLo] "r" (l.lo),
+			  [LeftHi] "r" (l.hi),
+			  [RightLo] "r" (r.lo),
+			  [RightHi] "r" (r.hi)
+		);
+#endif
+
+		return result;
+	}
+
+	/// @brief PMINW : Parallel MINimum Word
+	/// 
+	/// Calculate the minimum value of 4 32-bit signed value pairs.
+	/// 
+	/// Unsigned minimum can be achieved by first adding '0x80000000' to both operands and then
+	/// subtracting it again after.
+	/// @param l First operand
+	/// @param r Second operand
+	/// @return Minimum value of each value pair
+	FORCEINLINE CONST m128i32 mm_min_epi32(m128i32 l, m128i32 r)
+	{
+		m128i32 result = {};
+
+#ifdef PS2INTRIN_UNSAFE
+		asm(
+			"pminw	%[Result],%[Left],%[Right]"
+			: [Result] "=r" (result.v)
+			: [Left] "%r" (l.v),
+			  [Right] "r" (r.v)
+		);
+#elif defined(PS2INTRIN_HOST)
+		int32_t left[4];
+		int32_t right[4];
+		int32_t lanes[4];
+
+		memcpy(left, &l, sizeof(left));
+		memcpy(right, &r, sizeof(right));
+		for (int i = 0; i < 4; ++i)
+		{
+			lanes[i] = left[i] < right[i] ? left[i] : right[i];
+		}
+		memcpy(&result, lanes, sizeof(lanes));
+#else
+		asm(
+			"pcpyld	%[LeftLo],%[LeftHi],%[LeftLo]\n\t"
+			"pcpyld	%[RightLo],%[RightHi],%[RightLo]\n\t"
+			"pminw	%[ResultLo],%[LeftLo],%[RightLo]\n\t"
+			"pcpyud	%[ResultHi],%[ResultLo],%[ResultLo]"
+			: [ResultLo] "=r" (result.lo),
+			  [ResultHi] "=&r" (result.hi)
+			: [LeftLo] "r" (l.lo),
+			  [LeftHi] "r" (l.hi),
+			  [RightLo] "r" (r.lo),
+			  [RightHi] "r" (r.hi)
+		);
+#endif
+
+		return result;
+	}
+
+
+	/// @brief PADDB : Parallel ADD Byte
+	/// 
+	/// Add 16 8-bit value pairs.
+	/// @param l First operand
+	/// @param r Second operand
+	/// @return Result of addition of both operands
+	FORCEINLINE CONST m128i8 mm_add_epi8(m128i8 l, m128i8 r)
+	{
+		m128i8 result = {};
+
+#ifdef PS2INTRIN_UNSAFE
+		asm(
+			"paddb	%[Result],%[Left],%[Right]"
+			: [Result] "=r" (result.v)
+			: [Left] "%r" (l.v),
+			  [Right] "r" (r.v)
+		);
+#elif defined(PS2INTRIN_HOST)
+		uint8_t left[16];
+		uint8_t right[16];
+		uint8_t lanes[16];
+
+		memcpy(left, &l, sizeof(left));
+		memcpy(right, &r, sizeof(right));
+		for (int i = 0; i < 16; ++i)
+		{
+			lanes[i] = (uint8_t)(left[i] + right[i]);
+		}
+		memcpy(&result, lanes, sizeof(lanes));
+#else
+		asm(
+			"pcpyld	%[LeftLo],%[LeftHi],%[LeftLo]\n\t"
+			"pcpyld	%[RightLo],%[RightHi],%[RightLo]\n\t"
+			"paddb	%[ResultLo],%[LeftLo],%[RightLo]\n\t"
+			"pcpyud	%[ResultHi],%[ResultLo],%[ResultLo]"
+			: [ResultLo] "=r" (result.lo),
+			  [ResultHi] "=&r" (result.hi)
+			: [LeftLo] "r" (l.lo),
+			  [LeftHi] "r" (l.hi),
+			  [RightLo] "r" (r.lo),
+			  [RightHi] "r" (r.hi)
+		);
+#endif
+
+		return result;
+	}
+
+	/// @brief PADDB : Parallel ADD Byte
+	/// 
+	/// Add 16 8-bit value pairs.
+	/// @param l First operand
+	/// @param r Second operand
+	/// @return Result of addition of both operands
+	FORCEINLINE CONST m128u8 mm_add_epu8(m128u8 l, m128u8 r)
+	{
+		return mm_castepu8_epi8(mm_add_epi8(mm_castepi8_epu8(l), mm_castepi8_epu8(r)));
+	}
+	
+	/// @brief PADDH : Parallel ADD Halfword
+	/// 
+	/// Add 8 16-bit value pairs.
+	/// @param l First operand
+	/// @param r Second operand
+	/// @return Result of addition of both operands
+	FORCEINLINE CONST m128i16 mm_add_epi16(m128i16 l, m128i16 r)
+	{
+		m128i16 result = {};
+
+#ifdef PS2INTRIN_UNSAFE
+		asm(
+			"paddh	%[Result],%[Left],%[Right]"
+			: [Result] "=r" (result.v)
+			: [Left] "%r" (l.v),
+			  [Right] "r" (r.v)
+		);
+#elif defined(PS2INTRIN_HOST)
+		uint16_t left[8];
+		uint16_t right[8];
+		uint16_t lanes[8];
+
+		memcpy(left, &l, sizeof(left));
+		memcpy(right, &r, sizeof(right));
+		for (int i = 0; i < 8; ++i)
+		{
+			lanes[i] = (uint16_t)(left[i] + right[i]);
+		}
+		memcpy(&result, lanes, sizeof(lanes));
+#else
+		asm(
+			"pcpyld	%[LeftLo],%[LeftHi],%[LeftLo]\n\t"
+			"pcpyld	%[RightLo],%[RightHi],%[RightLo]\n\t"
+			"paddh	%[ResultLo],%[LeftLo],%[RightLo]\n\t"
+			"pcpyud	%[ResultHi],%[ResultLo],%[ResultLo]"
+			: [ResultLo] "=r" (result.lo),
+			  [ResultHi] "=&r" (result.hi)
+			: [LeftLo] "r" (l.lo),
+			  [LeftHi] "r" (l.hi),
+			  [RightLo] "r" (r.lo),
+			  [RightHi] "r" (r.hi)
+		);
+#endif
+
+		return result;
+	}
+
+	/// @brief PADDH : Parallel ADD Halfword
+	/// 
+	/// Add 8 16-bit value pairs.
+	/// @param l First operand
+	/// @param r Second operand
+	/// @return Result of addition of both operands
+	FORCEINLINE CONST m128u16 mm_add_epu16(m128u16 l, m128u16 r)
+	{
+		return mm_castepu16_epi16(mm_add_epi16(mm_castepi16_epu16(l), mm_castepi16_epu16(r)));
+	}
+
+	/// @brief PADDW : Parallel ADD Word
+	/// 
+	/// Add 4 32-bit value pairs.
+	/// @param l First operand
+	/// @param r Second operand
+	/// @return Result of addition of both operands
+	FORCEINLINE CONST m128i32 mm_add_epi32(m128i32 l, m128i32 r)
+	{
+		m128i32 result = {};
+
+#ifdef PS2INTRIN_UNSAFE
+		asm(
+			"paddw	%[Result],%[Left],%[Right]"
+			: [Result] "=r" (result.v)
+			: [Left] "%r" (l.v),
+			  [Right] "r" (r.v)
+		);
+#elif defined(PS2INTRIN_HOST)
+		uint32_t left[4];
+		uint32_t right[4];
+		uint32_t lanes[4];
+
+		memcpy(left, &l, sizeof(left));
+		memcpy(right, &r, sizeof(right));
+		for (int i = 0; i < 4; ++i)
+		{
+			lanes[i] = (uint32_t)(left[i] + right[i]);
+		}
+		memcpy(&result, lanes, sizeof(lanes));
+#else
+		asm(
+			"pcpyld	%[LeftLo],%[LeftHi],%[LeftLo]\n\t"
+			"pcpyld	%[RightLo],%[RightHi],%[RightLo]\n\t"
+			"paddw	%[ResultLo],%[LeftLo],%[RightLo]\n\t"
+			"pcpyud	%[ResultHi],%[ResultLo],%[ResultLo]"
+			: [ResultLo] "=r" (result.lo),
+			  [ResultHi] "=&r" (result.hi)
+			: [LeftLo] "r" (l.lo),
+			  [LeftHi] "r" (l.hi),
+			  [RightLo] "r" (r.lo),
+			  [RightHi] "r" (r.hi)
+		);
+#endif
+
+		return result;
+	}
+
+	/// @brief PADDW : Parallel ADD Word
+	/// 
+	/// Add 4 32-bit value pairs.
+	/// @param l First operand
+	/// @param r Second operand
+	/// @return Result of addition of both operands
+	FORCEINLINE CONST m128u32 mm_add_epu32(m128u32 l, m128u32 r)
+	{
+		return mm_castepu32_epi32(mm_add_epi32(mm_castepi32_epu32(l), mm_castepi32_epu32(r)));
+	}
+
+	/// @brief PADDSB : Parallel ADD Signed saturation Byte
+	/// 
+	/// Add 16 8-bit value pairs. Saturate the result to the extreme values of int8_t instead of
+	/// wraparound.
+	/// @param l First operand
+	/// @param r Second operand
+	/// @return Result of signed saturated addition of both operands
+	FORCEINLINE CONST m128i8 mm_adds_epi8(m128i8 l, m128i8 r)
+	{
+		m128i8 result = {};
+
+#ifdef PS2INTRIN_UNSAFE
+		asm(
+			"paddsb	%[Result],%[Left],%[Right]"
+			: [Result] "=r" (result.v)
+			: [Left] "%r" (l.v),
+			  [Right] "r" (r.v)
+		);
+#elif defined(PS2INTRIN_HOST)
+		int8_t left[16];
+		int8_t right[16];
+		int8_t lanes[16];
+
+		memcpy(left, &l, sizeof(left));
+		memcpy(right, &r, sizeof(right));
+		for (int i = 0; i < 16; ++i)
+		{
+			lanes[i] = (int8_t)(left[i] + right[i] > INT8_MAX ? INT8_MAX : left[i] + right[i] < INT8_MIN ? INT8_MIN : left[i] + right[i]);
+		}
+		memcpy(&result, lanes, sizeof(lanes));
+#else
+		asm(
+			"pcpyld	%[LeftLo],%[LeftHi],%[LeftLo]\n\t"
+			"pcpyld	%[RightLo],%[RightHi],%[RightLo]\n\t"
+			"paddsb	%[ResultLo],%[LeftLo],%[RightLo]\n\t"
+			"pcpyud	%[ResultHi],%[ResultLo],%[ResultLo]"
+			: [ResultLo] "=r" (result.lo),
+			  [ResultHi] "=&r" (result.hi)
+			: [LeftLo] "r" (l.lo),
+			  [LeftHi] "r" (l.hi),
+			  [RightLo] "r" (r.lo),
+			  [RightHi] "r" (r.hi)
+		);
+#endif
+
+		return result;
+	}
+
+	/// @brief PADDUB : Parallel ADD Unsigned saturation Byte
+	/// 
+	/// Add 16 8-bit value pairs. Saturate the result to the extreme values of uint8_t instead of
+	/// wraparound.
+	/// @param l First operand
+	/// @param r Second operand
+	/// @return Result of unsigned saturated addition of both operands
+	FORCEINLINE CONST m128u8 mm_adds_epu8(m128u8 l, m128u8 r)
+	{
+		m128u8 result = {};
+
+#ifdef PS2INTRIN_UNSAFE
+		asm(
+			"paddub	%[Result],%[Left],%[Right]"
+			: [Result] "=r" (result.v)
+			: [Left] "%r" (l.v),
+			  [Right] "r" (r.v)
+		);
+#elif defined(PS2INTRIN_HOST)
+		uint8_t left[16];
+		uint8_t right[16];
+		uint8_t lanes[16];
+
+		memcpy(left, &l, sizeof(left));
+		memcpy(right, &r, sizeof(right));
+		for (int i = 0; i < 16; ++i)
+		{
+			lanes[i] = (uint8_t)(left[i] + right[i] > UINT8_MAX ? UINT8_MAX : left[i] + right[i]);
+		}
+		memcpy(&result, lanes, sizeof(lanes));
+#else
+		asm(
+			"pcpyld	%[LeftLo],%[LeftHi],%[LeftLo]\n\t"
+			"pcpyld	%[RightLo],%[RightHi],%[RightLo]\n\t"
+			"paddub	%[ResultLo],%[LeftLo],%[RightLo]\n\t"
+			"pcpyud	%[ResultHi],%[ResultLo],%[ResultLo]"
+			: [ResultLo] "=r" (result.lo),
+			  [ResultHi] "=&r" (result.hi)
+			: [LeftLo] "r" (l.lo),
+			  [LeftHi] "r" (l.hi),
+			  [RightLo] "r" (r.lo),
+			  [RightHi] "r" (r.hi)
+		);
+#endif
+
+		return result;
+	}
+
+	/// @brief PADDSH : Parallel ADD Signed saturation Halfword
+	/// 
+	/// Add 8 16-bit value pairs. Saturate the result to the extreme values of int16_t instead of
+	/// wraparound.
+	/// @param l First operand
+	/// @param r Second operand
+	/// @return Result of signed saturated addition of both operands
+	FORCEINLINE CONST m128i16 mm_adds_epi16(m128i16 l, m128i16 r)
+	{
+		m128i16 result = {};
+
+#ifdef PS2INTRIN_UNSAFE
+		asm(
+			"paddsh	%[Result],%[Left],%[Right]"
+			: [Result] "=r" (result.v)
+			: [Left] "%r" (l.v),
+			  [Right] "r" (r.v)
+		);
+#elif defined(PS2INTRIN_HOST)
+		int16_t left[8];
+		int16_t right[8];
+		int16_t lanes[8];
+
+		memcpy(left, &l, sizeof(left));
+		memcpy(right, &r, sizeof(right));
+		for (int i = 0; i < 8; ++i)
+		{
+			lanes[i] = (int16_t)(left[i] + right[i] > INT16_MAX ? INT16_MAX : left[i] + right[i] < INT16_MIN ? INT16_MIN : left[i] + right[i]);
+		}
+		memcpy(&result, lanes, sizeof(lanes));
+#else
+		asm(
+			"pcpyld	%[LeftLo],%[LeftHi],%[LeftLo]\n\t"
+			"pcpyld	%[RightLo],%[RightHi],%[RightLo]\n\t"
+			"paddsh	%[ResultLo],%[LeftLo],%[RightLo]\n\t"
+			"pcpyud	%[ResultHi],%[ResultLo],%[ResultLo]"
+			: [ResultLo] "=r" (result.lo),
+			  [ResultHi] "=&r" (result.hi)
+			: [LeftLo] "r" (l.lo),
+			  [LeftHi] "r" (l.hi),
+			  [RightLo] "r" (r.lo),
+			  [RightHi] "r" (r.hi)
+		);
+#endif
+
+		return result;
+	}
+
+	/// @brief PADDUH : Parallel ADD Unsigned saturation Halfword
+	/// 
+	/// Add 8 16-bit value pairs. Saturate the result to the extreme values of uint16_t instead of
+	/// wraparound.
+	/// @param l First operand
+	/// @param r Second operand
+	/// @return Result of unsigned saturated addition of both operands
+	FORCEINLINE CONST m128u16 mm_adds_epu16(m128u16 l, m128u16 r)
+	{
+		m128u16 result = {};
+
+#ifdef PS2INTRIN_UNSAFE
+		asm(
+			"padduh	%[Result],%[Left],%[Right]"
+			: [Result] "=r" (result.v)
+			: [Left] "%r" (l.v),
+			  [Right] "r" (r.v)
+		);
+#elif defined(PS2INTRIN_HOST)
+		uint16_t left[8];
+		uint16_t right[8];
+		uint16_t lanes[8];
+
+		memcpy(left, &l, sizeof(left));
+		memcpy(right, &r, sizeof(right));
+		for (int i = 0; i < 8; ++i)
+		{
+			lanes[i] = (uint16_t)(left[i] + right[i] > UINT16_MAX ? UINT16_MAX : left[i] + right[i]);
+		}
+		memcpy(&result, lanes, sizeof(lanes));
+#else
+		asm(
+			"pcpyld	%[LeftLo],%[LeftHi],%[LeftLo]\n\t"
+			"pcpyld	%[RightLo],%[RightHi],%[RightLo]\n\t"
+			"padduh	%[ResultLo],%[LeftLo],%[RightLo]\n\t"
+			"pcpyud	%[ResultHi],%[ResultLo],%[ResultLo]"
+			: [ResultLo] "=r" (result.lo),
+			  [ResultHi] "=&r" (result.hi)
+			: [LeftLo] "r" (l.lo),
+			  [LeftHi] "r" (l.hi),
+			  [RightLo] "r" (r.lo),
+			  [RightHi] "r" (r.hi)
+		);
+#endif
+
+		return result;
+	}
+
+	/// @brief PADDSW : Parallel ADD Signed saturation Word
+	/// 
+	/// Add 4 32-bit value pairs. Saturate the result to the extreme values of int32_t instead of
+	/// wraparound.
+	/// @param l First operand
+	/// @param r Second operand
+	/// @return Result of signed saturated addition of both operands
+	FORCEINLINE CONST m128i32 mm_adds_epi32(m128i32 l, m128i32 r)
+	{
+		m128i32 result = {};
+
+#ifdef PS2INTRIN_UNSAFE
+		asm(
+			"paddsw	%[Result],%[Left],%[Right]"
+			: [Result] "=r" (result.v)
+			: [Left] "%r" (l.v),
+			  [Right] "r" (r.v)
+		);
+#elif defined(PS2INTRIN_HOST)
+		int32_t left[4];
+		int32_t right[4];
+		int32_t lanes[4];
+
+		memcpy(left, &l, sizeof(left));
+		memcpy(right, &r, sizeof(right));
+		for (int i = 0; i < 4; ++i)
+		{
+			lanes[i] = (int32_t)((int64_t)left[i] + right[i] > INT32_MAX ? INT32_MAX : (int64_t)left[i] + right[i] < INT32_MIN ? INT32_MIN : (int64_t)left[i] + right[i]);
+		}
+		memcpy(&result, lanes, sizeof(lanes));
+#else
+		asm(
+			"pcpyld	%[LeftLo],%[LeftHi],%[LeftLo]\n\t"
+			"pcpyld	%[RightLo],%[RightHi],%[RightLo]\n\t"
+			"paddsw	%[ResultLo],%[LeftLo],%[RightLo]\n\t"
+			"pcpyud	%[ResultHi],%[ResultLo],%[ResultLo]"
+			: [ResultLo] "=r" (result.lo),
+			  [ResultHi] "=&r" (result.hi)
+			: [LeftLo] "r" (l.lo),
+			  [LeftHi] "r" (l.hi),
+			  [RightLo] "r" (r.lo),
+			  [RightHi] "r" (r.hi)
+		);
+#endif
+
+		return result;
+	}
+
+	/// @brief PADDUW : Parallel ADD Unsigned saturation Word
+	/// 
+	/// Add 4 32-bit value pairs. Saturate the result to the extreme values of uint32_t instead of
+	/// wraparound.
+	/// @param l First operand
+	/// @param r Second operand
+	/// @return Result of unsigned saturated addition of both operands
+	FORCEINLINE CONST m128u32 mm_adds_epu32(m128u32 l, m128u32 r)
+	{
+		m128u32 result = {};
+
+#ifdef PS2INTRIN_UNSAFE
+		asm(
+			"padduw	%[Result],%[Left],%[Right]"
+			: [Result] "=r" (result.v)
+			: [Left] "%r" (l.v),
+			  [Right] "r" (r.v)
+		);
+#elif defined(PS2INTRIN_HOST)
+		uint32_t left[4];
+		uint32_t right[4];
+		uint32_t lanes[4];
+
+		memcpy(left, &l, sizeof(left));
+		memcpy(right, &r, sizeof(right));
+		for (int i = 0; i < 4; ++i)
+		{
+			lanes[i] = (uint64_t)left[i] + right[i] > UINT32_MAX ? UINT32_MAX : left[i] + right[i];
+		}
+		memcpy(&result, lanes, sizeof(lanes));
+#else
+		asm(
+			"pcpyld	%[LeftLo],%[LeftHi],%[LeftLo]\n\t"
+			"pcpyld	%[RightLo],%[RightHi],%[RightLo]\n\t"
+			"padduw	%[ResultLo],%[LeftLo],%[RightLo]\n\t"
+			"pcpyud	%[ResultHi],%[ResultLo],%[ResultLo]"
+			: [ResultLo] "=r" (result.lo),
+			  [ResultHi] "=&r" (result.hi)
+			: [LeftLo] "r" (l.lo),
+			  [LeftHi] "r" (l.hi),
+			  [RightLo] "r" (r.lo),
+			  [RightHi] "r" (r.hi)
+		);
+#endif
+
+		return result;
+	}
+
+	/// @brief PADSBH : Parallel ADd/SuBtract Halfword
+	/// 
+	/// Split each group of 8 16-bit signed values into a high and a low group of 4. Valculate
+	/// 'l + r' for the high group and 'l - r' for the low group. This uses regular non-saturating
+	/// arithmethic.
+	/// @param l First operand
+	/// @param r Second operand
+	/// @return Result of addition/subtraction of operands
+	FORCEINLINE CONST m128i16 mm_addsub_epi16(m128i16 l, m128i16 r)
+	{
+		m128i16 result = {};
+
+#ifdef PS2INTRIN_UNSAFE
+		asm(
+			"padsbh	%[Result],%[Left],%[Right]"
+			: [Result] "=r" (result.v)
+			: [Left] "r" (l.v),
+			  [Right] "r" (r.v)
+		);
+#elif defined(PS2INTRIN_HOST)
+		uint16_t left[8];
+		uint16_t right[8];
+		uint16_t lanes[8];
+
+		memcpy(left, &l, sizeof(left));
+		memcpy(right, &r, sizeof(right));
+		for (int i = 0; i < 8; ++i)
+		{
+			lanes[i] = (uint16_t)(i < 4 ? left[i] - right[i] : left[i] + right[i]);
+		}
+		memcpy(&result, lanes, sizeof(lanes));
+#else
+		asm(
+			"pcpyld	%[LeftLo],%[LeftHi],%[LeftLo]\n\t"
+			"pcpyld	%[RightLo],%[RightHi],%[RightLo]\n\t"
+			"padsbh	%[ResultLo],%[LeftLo],%[RightLo]\n\t"
+			"pcpyud	%[ResultHi],%[ResultLo],%[ResultLo]"
+			: [ResultLo] "=r" (result.lo),
+			  [ResultHi] "=&r" (result.hi)
+			: [LeftLo] "r" (l.lo),
+			  [LeftHi] "r" (l.hi),
+			  [RightLo] "r" (r.lo),
+			  [RightHi] "r" (r.hi)
+		);
+#endif
+
+		return result;
+	}
+
+
+	/// @brief PSUBB : Parallel SUBtract Byte
+	/// 
+	/// Subtract 16 8-bit value pairs.
+	/// @param l First operand
+	/// @param r Second operand
+	/// @return Result of subtraction of both operands
+	FORCEINLINE CONST m128i8 mm_sub_epi8(m128i8 l, m128i8 r)
+	{
+		m128i8 result = {};
+
+#ifdef PS2INTRIN_UNSAFE
+		asm(
+			"psubb	%[Result],%[Left],%[Right]"
+			: [Result] "=r" (result.v)
+			: [Left] "r" (l.v),
+			  [Right] "r" (r.v)
+		);
+#elif defined(PS2INTRIN_HOST)
+		uint8_t left[16];
+		uint8_t right[16];
+		uint8_t lanes[16];
+
+		memcpy(left, &l, sizeof(left));
+		memcpy(right, &r, sizeof(right));
+		for (int i = 0; i < 16; ++i)
+		{
+			lanes[i] = (uint8_t)(left[i] - right[i]);
+		}
+		memcpy(&result, lanes, sizeof(lanes));
+#else
+		asm(
+			"pcpyld	%[LeftLo],%[LeftHi],%[LeftLo]\n\t"
+			"pcpyld	%[RightLo],%[RightHi],%[RightLo]\n\t"
+			"psubb	%[ResultLo],%[LeftLo],%[RightLo]\n\t"
+			"pcpyud	%[ResultHi],%[ResultLo],%[ResultLo]"
+			: [ResultLo] "=r" (result.lo),
+			  [ResultHi] "=&r" (result.hi)
+			: [LeftLo] "r" (l.lo),
+			  [LeftHi] "r" (l.hi),
+			  [RightLo] "r" (r.lo),
+			  [RightHi] "r" (r.hi)
+		);
+#endif
+
+		return result;
+	}
+
+	/// @brief PSUBB : Parallel SUBtract Byte
+	/// 
+	/// Subtract 16 8-bit value pairs.
+	/// @param l First operand
+	/// @param r Second operand
+	/// @return Result of subtraction of both operands
+	FORCEINLINE CONST m128u8 mm_sub_epu8(m128u8 l, m128u8 r)
+	{
+		return mm_castepu8_epi8(mm_sub_epi8(mm_castepi8_epu8(l), mm_castepi8_epu8(r)));
+	}
+
+	/// @brief PSUBH : Parallel SUBtract Halfword
+	/// 
+	/// Subtract 8 16-bit value pairs.
+	/// @param l First operand
+	/// @param r Second operand
+	/// @return Result of subtraction of both operands
+	FORCEINLINE CONST m128i16 mm_sub_epi16(m128i16 l, m128i16 r)
+	{
+		m128i16 result = {};
+
+#ifdef PS2INTRIN_UNSAFE
+		asm(
+			"psubh	%[Result],%[Left],%[Right]"
+			: [Result] "=r" (result.v)
+			: [Left] "r" (l.v),
+			  [Right] "r" (r.v)
+		);
+#elif defined(PS2INTRIN_HOST)
+		uint16_t left[8];
+		uint16_t right[8];
+		uint16_t lanes[8];
+
+		memcpy(left, &l, sizeof(left));
+		memcpy(right, &r, sizeof(right));
+		for (int i = 0; i < 8; ++i)
+		{
+			lanes[i] = (uint16_t)(left[i] - right[i]);
+		}
+		memcpy(&result, lanes, sizeof(lanes));
+#else
+		asm(
+			"pcpyld	%[LeftLo],%[LeftHi],%[LeftLo]\n\t"
+			"pcpyld	%[RightLo],%[RightHi],%[RightLo]\n\t"
+			"psubh	%[ResultLo],%[LeftLo],%[RightLo]\n\t"
+			"pcpyud	%[ResultHi],%[ResultLo],%[ResultLo]"
+			: [ResultLo] "=r" (result.lo),
+			  [ResultHi] "=&r" (result.hi)
+			: [LeftLo] "r" (l.lo),
+			  [LeftHi] "r" (l.hi),
+			  [RightLo] "r" (r.lo),
+			  [RightHi] "r" (r.hi)
+		);
+#endif
+
+		return result;
+	}
+
+	/// @brief PSUBH : Parallel SUBtract Halfword
+	/// 
+	/// Subtract 8 16-bit value pairs.
+	/// @param l First operand
+	/// @param r Second operand
+	/// @return Result of subtraction of both operands
+	FORCEINLINE CONST m128u16 mm_sub_epu16(m128u16 l, m128u16 r)
+	{
+		return mm_castepu16_epi16(mm_sub_epi16(mm_castepi16_epu16(l), mm_castepi16_epu16(r)));
+	}
+
+	/// @brief PSUBW : Parallel SUBtract Word
+	/// 
+	/// Subtract 4 32-bit value pairs.
+	/// @param l First operand
+	/// @param r Second operand
+	/// @return Result of subtraction of both operands
+	FORCEINLINE CONST m128i32 mm_sub_epi32(m128i32 l, m128i32 r)
+	{
+		m128i32 result = {};
+
+#ifdef PS2INTRIN_UNSAFE
+		asm(
+			"psubw	%[Result],%[Left],%[Right]"
+			: [Result] "=r" (result.v)
+			: [Left] "r" (l.v),
+			  [Right] "r" (r.v)
+		);
+#elif defined(PS2INTRIN_HOST)
+		uint32_t left[4];
+		uint32_t right[4];
+		uint32_t lanes[4];
+
+		memcpy(left, &l, sizeof(left));
+		memcpy(right, &r, sizeof(right));
+		for (int i = 0; i < 4; ++i)
+		{
+			lanes[i] = (uint32_t)(left[i] - right[i]);
+		}
+		memcpy(&result, lanes, sizeof(lanes));
+#else
+		asm(
+			"pcpyld	%[LeftLo],%[LeftHi],%[LeftLo]\n\t"
+			"pcpyld	%[RightLo],%[RightHi],%[RightLo]\n\t"
+			"psubw	%[ResultLo],%[LeftLo],%[RightLo]\n\t"
+			"pcpyud	%[ResultHi],%[ResultLo],%[ResultLo]"
+			: [ResultLo] "=r" (result.lo),
+			  [ResultHi] "=&r" (result.hi)
+			: [LeftLo] "r" (l.lo),
+			  [LeftHi] "r" (l.hi),
+			  [RightLo] "r" (r.lo),
+			  [RightHi] "r" (r.hi)
+		);
+#endif
+
+		return result;
+	}
+
+	/// @brief PSUBW : Parallel SUBtract Word
+	/// 
+	/// Subtract 4 32-bit value pairs.
+	/// @param l First operand
+	/// @param r Second operand
+	/// @return Result of subtraction of both operands
+	FORCEINLINE CONST m128u32 mm_sub_epu32(m128u32 l, m128u32 r)
+	{
+		return mm_castepu32_epi32(mm_sub_epi32(mm_castepi32_epu32(l), mm_castepi32_epu32(r)));
+	}
+
+	/// @brief PSUBSB : Parallel SUBtract Signed saturation Byte
+	/// 
+	/// Subtract 16 8-bit value pairs. Saturate the result to the extreme values of int8_t instead
+	/// of wraparound.
+	/// @param l First operand
+	/// @param r Second operand
+	/// @return Result of signed saturated subtraction of both operands
+	FORCEINLINE CONST m128i8 mm_subs_epi8(m128i8 l, m128i8 r)
+	{
+		m128i8 result = {};
+
+#ifdef PS2INTRIN_UNSAFE
+		asm(
+			"psubsb	%[Result],%[Left],%[Right]"
+			: [Result] "=r" (result.v)
+			: [Left] "r" (l.v),
+			  [Right] "r" (r.v)
+		);
+#elif defined(PS2INTRIN_HOST)
+		int8_t left[16];
+		int8_t right[16];
+		int8_t lanes[16];
+
+		memcpy(left, &l, sizeof(left));
+		memcpy(right, &r, sizeof(right));
+		for (int i = 0; i < 16; ++i)
+		{
+			lanes[i] = (int8_t)(left[i] - right[i] > INT8_MAX ? INT8_MAX : left[i] - right[i] < INT8_MIN ? INT8_MIN : left[i] - right[i]);
+		}
+		memcpy(&result, lanes, sizeof(lanes));
+#else
+		asm(
+			"pcpyld	%[LeftLo],%[LeftHi],%[LeftLo]\n\t"
+			"pcpyld	%[RightLo],%[RightHi],%[RightLo]\n\t"
+			"psubsb	%[ResultLo],%[LeftLo],%[RightLo]\n\t"
+			"pcpyud	%[ResultHi],%[ResultLo],%[ResultLo]"
+			: [ResultLo] "=r" (result.lo),
+			  [ResultHi] "=&r" (result.hi)
+			: [LeftLo] "r" (l.lo),
+			  [LeftHi] "r" (l.hi),
+			  [RightLo] "r" (r.lo),
+			  [RightHi] "r" (r.hi)
+		);
+#endif
+
+		return result;
+	}
+
+	/// @brief PSUBUB : Parallel SUBtract Unsigned saturation Byte
+	/// 
+	/// Subtract 16 8-bit value pairs. Saturate the result to the extreme values of uint8_t
+	/// instead of wraparound.
+	/// @param l First operand
+	/// @param r Second operand
+	/// @return Result of unsigned saturated subtraction of both operands
+	FORCEINLINE CONST m128u8 mm_subs_epu8(m128u8 l, m128u8 r)
+	{
+		m128u8 result = {};
+
+#ifdef PS2INTRIN_UNSAFE
+		asm(
+			"psubub	%[Result],%[Left],%[Right]"
+			: [Result] "=r" (result.v)
+			: [Left] "r" (l.v),
+			  [Right] "r" (r.v)
+		);
+#elif defined(PS2INTRIN_HOST)
+		uint8_t left[16];
+		uint8_t right[16];
+		uint8_t lanes[16];
+
+		memcpy(left, &l, sizeof(left));
+		memcpy(right, &r, sizeof(right));
+		for (int i = 0; i < 16; ++i)
+		{
+			lanes[i] = (uint8_t)(left[i] < right[i] ? 0 : left[i] - right[i]);
+		}
+		memcpy(&result, lanes, sizeof(lanes));
+#else
+		asm(
+			"pcpyld	%[LeftLo],%[LeftHi],%[LeftLo]\n\t"
+			"pcpyld	%[RightLo],%[RightHi],%[RightLo]\n\t"
+			"psubub	%[ResultLo],%[LeftLo],%[RightLo]\n\t"
+			"pcpyud	%[ResultHi],%[ResultLo],%[ResultLo]"
+			: [ResultLo] "=r" (result.lo),
+			  [ResultHi] "=&r" (result.hi)
+			: [LeftLo] "r" (l.lo),
+			  [LeftHi] "r" (l.hi),
+			  [RightLo] "r" (r.lo),
+			  [RightHi] "r" (r.hi)
+		);
+#endif
+
+		return result;
+	}
+
+	/// @brief PSUBSH : Parallel SUBtract Signed saturation Halfword
+	/// 
+	/// Subtract 8 16-bit value pairs. Saturate the result to the extreme values of int16_t
+	/// instead of wraparound.
+	/// @param l First operand
+	/// @param r Second operand
+	/// @return Result of signed saturated subtraction of both operands
+	FORCEINLINE CONST m128i16 mm_subs_epi16(m128i16 l, m128i16 r)
+	{
+		m128i16 result = {};
+
+#ifdef PS2INTRIN_UNSAFE
+		asm(
+			"psubsh	%[Result],%[Left],%[Right]"
+			: [Result] "=r" (result.v)
+			: [Left] "r" (l.v),
+			  [Right] "r" (r.v)
+		);
+#elif defined(PS2INTRIN_HOST)
+		int16_t left[8];
+		int16_t right[8];
+		int16_t lanes[8];
+
+		memcpy(left, &l, sizeof(left));
+		memcpy(right, &r, sizeof(right));
+		for (int i = 0; i < 8; ++i)
+		{
+			lanes[i] = (int16_t)(left[i] - right[i] > INT16_MAX ? INT16_MAX : left[i] - right[i] < INT16_MIN ? INT16_MIN : left[i] - right[i]);
+		}
+		memcpy(&result, lanes, sizeof(lanes));
+#else
+		asm(
+			"pcpyld	%[LeftLo],%[LeftHi],%[LeftLo]\n\t"
+			"pcpyld	%[RightLo],%[RightHi],%[RightLo]\n\t"
+			"psubsh	%[ResultLo],%[LeftLo],%[RightLo]\n\t"
+			"pcpyud	%[ResultHi],%[ResultLo],%[ResultLo]"
+			: [ResultLo] "=r" (result.lo),
+			  [ResultHi] "=&r" (result.hi)
+			: [LeftLo] "r" (l.lo),
+			  [LeftHi] "r" (l.hi),
+			  [RightLo] "r" (r.lo),
+			  [RightHi] "r" (r.hi)
+		);
+#endif
+
+		return result;
+	}
+
+	/// @brief PSUBUH : Parallel SUBtract Unsigned saturation Halfword
+	/// 
+	/// Subtract 8 16-bit value pairs. Saturate the result to the extreme values of uint16_t
+	/// instead of wraparound.
+	/// @param l First operand
+	/// @param r Second operand
+	/// @return Result of unsigned saturated addition of both operands
+	FORCEINLINE CONST m128u16 mm_subs_epu16(m128u16 l, m128u16 r)
+	{
+		m128u16 result = {};
+
+#ifdef PS2INTRIN_UNSAFE
+		asm(
+			"psubuh	%[Result],%[Left],%[Right]"
+			: [Result] "=r" (result.v)
+			: [Left] "r" (l.v),
+			  [Right] "r" (r.v)
+		);
+#elif defined(PS2INTRIN_HOST)
+		uint16_t left[8];
+		uint16_t right[8];
+		uint16_t lanes[8];
+
+		memcpy(left, &l, sizeof(left));
+		memcpy(right, &r, sizeof(right));
+		for (int i = 0; i < 8; ++i)
+		{
+			lanes[i] = (uint16_t)(left[i] < right[i] ? 0 : left[i] - right[i]);
+		}
+		memcpy(&result, lanes, sizeof(lanes));
+#else
+		asm(
+			"pcpyld	%[LeftLo],%[LeftHi],%[LeftLo]\n\t"
+			"pcpyld	%[RightLo],%[RightHi],%[RightLo]\n\t"
+			"psubuh	%[ResultLo],%[LeftLo],%[RightLo]\n\t"
+			"pcpyud	%[ResultHi],%[ResultLo],%[ResultLo]"
+			: [ResultLo] "=r" (result.lo),
+			  [ResultHi] "=&r" (result.hi)
+			: [LeftLo] "r" (l.lo),
+			  [LeftHi] "r" (l.hi),
+			  [RightLo] "r" (r.lo),
+			  [RightHi] "r" (r.hi)
+		);
+#endif
+
+		return result;
+	}
+
+	/// @brief PSUBSW : Parallel SUBtract Signed saturation Word
+	/// 
+	/// Subtract 4 32-bit value pairs. Saturate the result to the extreme values of int32_t
+	/// instead of wraparound.
+	/// @param l First operand
+	/// @param r Second operand
+	/// @return Result of signed saturated subtraction of both operands
+	FORCEINLINE CONST m128i32 mm_subs_epi32(m128i32 l, m128i32 r)
+	{
+		m128i32 result = {};
+
+#ifdef PS2INTRIN_UNSAFE
+		asm(
+			"psubsw	%[Result],%[Left],%[Right]"
+			: [Result] "=r" (result.v)
+			: [Left] "r" (l.v),
+			  [Right] "r" (r.v)
+		);
+#elif defined(PS2INTRIN_HOST)
+		int32_t left[4];
+		int32_t right[4];
+		int32_t lanes[4];
+
+		memcpy(left, &l, sizeof(left));
+		memcpy(right, &r, sizeof(right));
+		for (int i = 0; i < 4; ++i)
+		{
+			lanes[i] = (int32_t)((int64_t)left[i] - right[i] > INT32_MAX ? INT32_MAX : (int64_t)left[i] - right[i] < INT32_MIN ? INT32_MIN : (int64_t)left[i] - right[i]);
+		}
+		memcpy(&result, lanes, sizeof(lanes));
+#else
+		asm(
+			"pcpyld	%[LeftLo],%[LeftHi],%[LeftLo]\n\t"
+			"pcpyld	%[RightLo],%[RightHi],%[RightLo]\n\t"
+			"psubsw	%[ResultLo],%[LeftLo],%[RightLo]\n\t"
+			"pcpyud	%[ResultHi],%[ResultLo],%[ResultLo]"
+			: [ResultLo] "=r" (result.lo),
+			  [ResultHi] "=&r" (result.hi)
+			: [LeftLo] "r" (l.lo),
+			  [LeftHi] "r" (l.hi),
+			  [RightLo] "r" (r.lo),
+			  [RightHi] "r" (r.hi)
+		);
+#endif
+
+		return result;
+	}
+
+	/// @brief PSUBUW : Parallel SUBtract Unsigned saturation Word
+	/// 
+	/// Subtract 4 32-bit value pairs. Saturate the result to the extreme values of uint32_t
+	/// instead of wraparound.
+	/// @param l First operand
+	/// @param r Second operand
+	/// @return Result of unsigned saturated subtraction of both operands
+	FORCEINLINE CONST m128u32 mm_subs_epu32(m128u32 l, m128u32 r)
+	{
+		m128u32 result = {};
+
+#ifdef PS2INTRIN_UNSAFE
+		asm(
+			"psubuw	%[Result],%[Left],%[Right]"
+			: [Result] "=r" (result.v)
+			: [Left] "r" (l.v),
+			  [Right] "r" (r.v)
+		);
+#elif defined(PS2INTRIN_HOST)
+		uint32_t left[4];
+		uint32_t right[4];
+		uint32_t lanes[4];
+
+		memcpy(left, &l, sizeof(left));
+		memcpy(right, &r, sizeof(right));
+		for (int i = 0; i < 4; ++i)
+		{
+			lanes[i] = left[i] < right[i] ? 0 : left[i] - right[i];
+		}
+		memcpy(&result, lanes, sizeof(lanes));
+#else
+		asm(
+			"pcpyld	%[LeftLo],%[LeftHi],%[LeftLo]\n\t"
+			"pcpyld	%[RightLo],%[RightHi],%[RightLo]\n\t"
+			"psubuw	%[ResultLo],%[LeftLo],%[RightLo]\n\t"
+			"pcpyud	%[ResultHi],%[ResultLo],%[ResultLo]"
+			: [ResultLo] "=r" (result.lo),
+			  [ResultHi] "=&r" (result.hi)
+			: [LeftLo] "r" (l.lo),
+			  [LeftHi] "r" (l.hi),
+			  [RightLo] "r" (r.lo),
+			  [RightHi] "r" (r.hi)
+		);
+#endif
+
+		return result;
+	}
+
+
+	/// @brief PMULTH : Parallel MULTiply Halfword
+	/// 
+	/// Multiply 8 pairs of 16-bit signed values.
+	/// 
+	/// Let each pair have a signed 32-bit product named p0..p7. Store p0, p2, p4 and p6 into the
+	/// return value. Store p0, p1, p4 and p5 into LO and p2, p3, p6 and p7 into HI.
+	/// 
+	/// Bitwise result:
+	///		Return value:	[ 31,   0] = p0
+	///						[ 63,  32] = p2
+	///						[ 95,  64] = p4
+	///						[127,  96] = p6
+	///		LO:				[ 31,   0] = p0
+	///						[ 63,  32] = p1
+	///						[ 95,  64] = p4
+	///						[127,  96] = p5
+	///		HI:				[ 31,   0] = p2
+	///						[ 63,  32] = p3
+	///						[ 95,  64] = p6
+	///						[127,  96] = p7
+	/// 
+	/// Multiplication happens asynchronously. Reading from the return value, the LO or the HI
+	/// register will stall the EE Core until the result is ready.
+	/// 
+	/// You can extract only the products not in the return value using 'mm_loadlohi_upper_epi32'.
+	/// 
+	/// This function writes to global state (LO/HI).
+	/// @param state Additional state used in safe mode. May not be NULL.
+	/// @param l First operand
+	/// @param r Second operand
+	/// @return Multiplication result of value pairs in even positions
+	FORCEINLINE m128i32 mm_mul_epi16(lohi_state_t* state, m128i16 l, m128i16 r)
+	{
+		m128i32 result = {};
+
+#ifdef PS2INTRIN_UNSAFE
+		(void)state;
+
+		// volatile because writes to LO/HI
+		asm volatile(
+			"pmulth	%[Result],%[Left],%[Right]"
+			: [Result] "=r" (result.v)
+			: [Left] "%r" (l.v),
+			  [Right] "r" (r.v)
+			: "lo", "hi"
+		);
+#elif defined(PS2INTRIN_HOST)
+		int16_t left[8];
+		int16_t right[8];
+		int32_t products[8];
+		int32_t lo[4];
+		int32_t hi[4];
+		int32_t lanes[4];
+
+		memcpy(left, &l, sizeof(left));
+		memcpy(right, &r, sizeof(right));
+		for (int i = 0; i < 8; ++i)
+		{
+			products[i] = (int32_t)left[i] * right[i];
+		}
+		for (int i = 0; i < 2; ++i)
+		{
+			lo[2 * i + 0] = products[4 * i + 0];
+			lo[2 * i + 1] = products[4 * i + 1];
+			hi[2 * i + 0] = products[4 * i + 2];
+			hi[2 * i + 1] = products[4 * i + 3];
+			lanes[2 * i + 0] = products[4 * i + 0];
+			lanes[2 * i + 1] = products[4 * i + 2];
+		}
+		memcpy(state->lo, lo, sizeof(lo));
+		memcpy(state->hi, hi, sizeof(hi));
+		memcpy(&result, lanes, sizeof(lanes));
+#else
+		uint64_t tmplo = 0;
+		uint64_t tmphi = 0;
+
+		asm(
+			"pmflo	%[TmpLo]\n\t"
+			"pmfhi	%[TmpHi]\n\t"
+			"pcpyld	%[LeftLo],%[LeftHi],%[LeftLo]\n\t"
+			"pcpyld	%[RightLo],%[RightHi],%[RightLo]\n\t"
+			"pmulth	%[ResultLo],%[LeftLo],%[RightLo]\n\t"
+			"pcpyud	%[ResultHi],%[ResultLo],%[ResultLo]\n\t"
+			"pmflo	%[StateLo0]\n\t"
+			"pmfhi	%[StateHi0]\n\t"
+			"pcpyud	%[StateLo1],%[StateLo0],%[StateLo0]\n\t"
+			"pcpyud	%[StateHi1],%[StateHi0],%[StateHi0]\n\t"
+			"pmtlo	%[TmpLo]\n\t"
+			"pmthi	%[TmpHi]"
+			: [TmpLo] "=&r" (tmplo),
+			  [TmpHi] "=&r" (tmphi),
+			  [ResultLo] "=r" (result.lo),
+			  [ResultHi] "=&r" (result.hi),
+			  [StateLo0] "=r" (state->lo[0]),
+			  [StateLo1] "=r" (state->lo[1]),
+			  [StateHi0] "=r" (state->hi[0]),
+			  [StateHi1] "=r" (state->hi[1])
+			: [LeftLo] "r" (l.lo),
+			  [LeftHi] "r" (l.hi),
+			  [RightLo] "r" (r.lo),
+			  [RightHi] "r" (r.hi)
+		);
+#endif
+
+		return result;
+	}
+
+	/// @brief PMULTW : Parallel MULTiply Word
+	/// 
+	/// Multiply 2 pairs of signed 32-bit values. The input operands are treated as sign-extended
+	/// 32-bit values. The 64-bit products are written to the return value. The low 32 bits of
+	/// the products are written to even positions of the LO register and sign-extended. The high
+	/// 32 bits are written to even positions of the HI register and sign extended.
+	/// 
+	/// Multiplication happens asynchronously. Reading from the return value, the LO or the HI
+	/// register will stall the EE Core until the result is ready.
+	/// 
+	/// This function writes to global state (LO/HI).
+	/// @param state Additional state used in safe mode. May not be NULL.
+	/// @param l First operand
+	/// @param r Second operand
+	/// @return Multiplication result containing full 64-bit signed values
+	FORCEINLINE m128i64 mm_mul_epi64(lohi_state_t* state, m128i64 l, m128i64 r)
+	{
+		m128i64 result = {};
+
+#ifdef PS2INTRIN_UNSAFE
+		(void)state;
+
+		// volatile because writes to LO/HI
+		asm volatile(
+			"pmultw	%[Result],%[Left],%[Right]"
+			: [Result] "=r" (result.v)
+			: [Left] "%r" (l.v),
+			  [Right] "r" (r.v)
+			: "lo", "hi"
+		);
+#elif defined(PS2INTRIN_HOST)
+		uint64_t left[2];
+		uint64_t right[2];
+		uint64_t lanes[2];
+
+		memcpy(left, &l, sizeof(left));
+		memcpy(right, &r, sizeof(right));
+		for (int i = 0; i < 2; ++i)
+		{
+			uint64_t accumulator = (uint64_t)((int64_t)(int32_t)left[i] * (int32_t)right[i]);
+
+			state->lo[i] = (uint64_t)(int64_t)(int32_t)accumulator;
+			state->hi[i] = (uint64_t)(int64_t)(int32_t)(accumulator >> 32);
+			lanes[i] = accumulator;
+		}
+		memcpy(&result, lanes, sizeof(lanes));
+#else
+		uint64_t tmplo = 0;
+		uint64_t tmphi = 0;
+
+		asm(
+			"pmflo	%[TmpLo]\n\t"
+			"pmfhi	%[TmpHi]\n\t"
+			"pcpyld	%[LeftLo],%[LeftHi],%[LeftLo]\n\t"
+			"pcpyld	%[RightLo],%[RightHi],%[RightLo]\n\t"
+			"pmultw	%[ResultLo],%[LeftLo],%[RightLo]\n\t"
+			"pcpyud	%[ResultHi],%[ResultLo],%[ResultLo]\n\t"
+			"pmflo	%[StateLo0]\n\t"
+			"pmfhi	%[StateHi0]\n\t"
+			"pcpyud	%[StateLo1],%[StateLo0],%[StateLo0]\n\t"
+			"pcpyud	%[StateHi1],%[StateHi0],%[StateHi0]\n\t"
+			"pmtlo	%[TmpLo]\n\t"
+			"pmthi	%[TmpHi]"
+			: [TmpLo] "=&r" (tmplo),
+			  [TmpHi] "=&r" (tmphi),
+			  [ResultLo] "=r" (result.lo),
+			  [ResultHi] "=&r" (result.hi),
+			  [StateLo0] "=r" (state->lo[0]),
+			  [StateLo1] "=r" (state->lo[1]),
+			  [StateHi0] "=r" (state->hi[0]),
+			  [StateHi1] "=r" (state->hi[1])
+			: [LeftLo] "r" (l.lo),
+			  [LeftHi] "r" (l.hi),
+			  [RightLo] "r" (r.lo),
+			  [RightHi] "r" (r.hi)
+		);
+#endif
+
+		return result;
+	}
+
+	/// @brief PMULTUW : Parallel MULTiply Unsigned Word
+	/// 
+	/// Multiply 2 pairs of unsigned 32-bit values. The input operands are treated as sign-
+	/// extended 32-bit values. The 64-bit products are written to the return value. The low 32
+	/// bits of the products are written to even positions of the LO register and sign-extended.
+	/// The high 32 bits are written to even positions of the HI register and sign extended.
+	/// 
+	/// Multiplication happens asynchronously. Reading from the return value, the LO or the HI
+	/// register will stall the EE Core until the result is ready.
+	/// 
+	/// This function writes to global state (LO/HI).
+	/// @param state Additional state used in safe mode. May not be NULL.
+	/// @param l First operand
+	/// @param r Second operand
+	/// @return Multiplication result containing full 64-bit unsigned values
+	FORCEINLINE m128u64 mm_mul_epu64(lohi_state_t* state, m128u64 l, m128u64 r)
+	{
+		m128u64 result = {};
+
+#ifdef PS2INTRIN_UNSAFE
+		(void)state;
+
+		// volatile because writes to LO/HI
+		asm volatile(
+			"pmultuw	%[Result],%[Left],%[Right]"
+			: [Result] "=r" (result.v)
+			: [Left] "%r" (l.v),
+			  [Right] "r" (r.v)
+			: "lo", "hi"
+		);
+#elif defined(PS2INTRIN_HOST)
+		uint64_t left[2];
+		uint64_t right[2];
+		uint64_t lanes[2];
+
+		memcpy(left, &l, sizeof(left));
+		memcpy(right, &r, sizeof(right));
+		for (int i = 0; i < 2; ++i)
+		{
+			uint64_t accumulator = (uint64_t)(uint32_t)left[i] * (uint32_t)right[i];
+
+			state->lo[i] = (uint64_t)(int64_t)(int32_t)accumulator;
+			state->hi[i] = (uint64_t)(int64_t)(int32_t)(accumulator >> 32);
+			lanes[i] = accumulator;
+		}
+		memcpy(&result, lanes, sizeof(lanes));
+#else
+		uint64_t tmplo = 0;
+		uint64_t tmphi = 0;
+
+		asm(
+			"pmflo	%[TmpLo]\n\t"
+			"pmfhi	%[TmpHi]\n\t"
+			"pcpyld	%[LeftLo],%[LeftHi],%[LeftLo]\n\t"
+			"pcpyld	%[RightLo],%[RightHi],%[RightLo]\n\t"
+			"pmultuw	%[ResultLo],%[LeftLo],%[RightLo]\n\t"
+			"pcpyud	%[ResultHi],%[ResultLo],%[ResultLo]\n\t"
+			"pmflo	%[StateLo0]\n\t"
+			"pmfhi	%[StateHi0]\n\t"
+			"pcpyud	%[StateLo1],%[StateLo0],%[StateLo0]\n\t"
+			"pcpyud	%[StateHi1],%[StateHi0],%[StateHi0]\n\t"
+			"pmtlo	%[TmpLo]\n\t"
+			"pmthi	%[TmpHi]"
+			: [TmpLo] "=&r" (tmplo),
+			  [TmpHi] "=&r" (tmphi),
+			  [ResultLo] "=r" (result.lo),
+			  [ResultHi] "=&r" (result.hi),
+			  [StateLo0] "=r" (state->lo[0]),
+			  [StateLo1] "=r" (state->lo[1]),
+			  [StateHi0] "=r" (state->hi[0]),
+			  [StateHi1] "=r" (state->hi[1])
+			: [LeftLo] "r" (l.lo),
+			  [LeftHi] "r" (l.hi),
+			  [RightLo] "r" (r.lo),
+			  [RightHi] "r" (r.hi)
+		);
+#endif
+
+		return result;
+	}
+
+	/// @brief PMADDH : Parallel Multiply-ADD Halfword
+	/// 
+	/// Multiply 8 pairs of 16-bit signed values and accumulate.
+	/// 
+	/// Let each pair have a signed 32-bit product named p0..p7. Assign each product a 32-bit
+	/// accumulator a0..a7 according to the output locations in LO/HI of 'mm_mul_epi16'. Add
+	/// the product to the accumulator and store a0, a2, a4 and a6 into the return value. Store
+	/// a0, a1, a4 and a5 into LO and a2, a3, a6 and a7 into HI.
+	/// 
+	/// Bitwise accumulation:
+	///		LO:				[ 31,   0] = a0
+	///						[ 63,  32] = a1
+	///						[ 95,  64] = a4
+	///						[127,  96] = a5
+	///		HI:				[ 31,   0] = a2
+	///						[ 63,  32] = a3
+	///						[ 95,  64] = a6
+	///						[127,  96] = a7
+	///		Return value:	[ 31,   0] = LO[ 31,   0]
+	///						[ 63,  32] = HI[ 31,   0]
+	///						[ 95,  64] = LO[ 95,  64]
+	///						[127,  96] = HI[ 95,  64]
+	/// 
+	/// Multiplication happens asynchronously. Reading from the return value, the LO or the HI
+	/// register will stall the EE Core until the result is ready.
+	/// 
+	/// You can extract only the accumulators not in the return value using
+	/// 'mm_loadlohi_upper_epi32'.
+	/// 
+	/// This function writes to global state (LO/HI).
+	/// @param state Additional state used in safe mode. May not be NULL.
+	/// @param l First operand
+	/// @param r Second operand
+	/// @return Multipy-accumulate result of value pairs in even positions
+	FORCEINLINE m128i32 mm_fma_epi16(lohi_state_t* state, m128i16 l, m128i16 r)
+	{
+		m128i32 result = {};
+
+#ifdef PS2INTRIN_UNSAFE
+		(void)state;
+
+		// volatile because writes to LO/HI
+		asm volatile(
+			"pmaddh	%[Result],%[Left],%[Right]"
+			: [Result] "=r" (result.v)
+			: [Left] "%r" (l.v),
+			  [Right] "r" (r.v)
+			: "lo", "hi"
+		);
+#elif defined(PS2INTRIN_HOST)
+		int16_t left[8];
+		int16_t right[8];
+		uint32_t lo[4];
+		uint32_t hi[4];
+		uint32_t lanes[4];
+
+		memcpy(left, &l, sizeof(left));
+		memcpy(right, &r, sizeof(right));
+		memcpy(lo, state->lo, sizeof(lo));
+		memcpy(hi, state->hi, sizeof(hi));
+		for (int i = 0; i < 2; ++i)
+		{
+			lo[2 * i + 0] += (uint32_t)((int32_t)left[4 * i + 0] * right[4 * i + 0]);
+			lo[2 * i + 1] += (uint32_t)((int32_t)left[4 * i + 1] * right[4 * i + 1]);
+			hi[2 * i + 0] += (uint32_t)((int32_t)left[4 * i + 2] * right[4 * i + 2]);
+			hi[2 * i + 1] += (uint32_t)((int32_t)left[4 * i + 3] * right[4 * i + 3]);
+			lanes[2 * i + 0] = lo[2 * i + 0];
+			lanes[2 * i + 1] = hi[2 * i + 0];
+		}
+		memcpy(state->lo, lo, sizeof(lo));
+		memcpy(state->hi, hi, sizeof(hi));
+		memcpy(&result, lanes, sizeof(lanes));
+#else
+		uint64_t tmplo = 0;
+		uint64_t tmphi = 0;
+
+		asm(
+			"pmflo	%[TmpLo]\n\t"
+			"pmfhi	%[TmpHi]\n\t"
+			"pcpyld	%[StateLo0],%[StateLo1],%[StateLo0]\n\t"
+			"pcpyld	%[StateHi0],%[StateHi1],%[StateHi0]\n\t"
+			"pmtlo	%[StateLo0]\n\t"
+			"pmthi	%[StateHi0]\n\t"
+			"pcpyld	%[LeftLo],%[LeftHi],%[LeftLo]\n\t"
+			"pcpyld	%[RightLo],%[RightHi],%[RightLo]\n\t"
+			"pmaddh	%[ResultLo],%[LeftLo],%[RightLo]\n\t"
+			"pcpyud	%[ResultHi],%[ResultLo],%[ResultLo]\n\t"
+			"pmflo	%[StateLo0]\n\t"
+			"pmfhi	%[StateHi0]\n\t"
+			"pcpyud	%[StateLo1],%[StateLo0],%[StateLo0]\n\t"
+			"pcpyud	%[StateHi1],%[StateHi0],%[StateHi0]\n\t"
+			"pmtlo	%[TmpLo]\n\t"
+			"pmthi	%[TmpHi]"
+			: [TmpLo] "=&r" (tmplo),
+			  [TmpHi] "=&r" (tmphi),
+			  [ResultLo] "=r" (result.lo),
+			  [ResultHi] "=r" (result.hi),
+			  [StateLo0] "+r" (state->lo[0]),
+			  [StateLo1] "+r" (state->lo[1]),
+			  [StateHi0] "+r" (state->hi[0]),
+			  [StateHi1] "+r" (state->hi[1])
+			: [LeftLo] "r" (l.lo),
+			  [LeftHi] "r" (l.hi),
+			  [RightLo] "r" (r.lo),
+			  [RightHi] "r" (r.hi)
+		);
+#endif
+
+		return result;
+	}
+
+	/// @brief PMADDW : Parallel Multiply-ADD Word
+	/// 
+	/// Multiply 2 pairs of signed 32-bit values and accumulate. The input operands are treated
+	/// as sign-extended 32-bit values. Assign each product a 64-bit accumulator a0..a1 in LO/HI
+	/// according to the output locations of 'mm_mul_epi64'. The products are added to the
+	/// accumulator and written to the return value. The low 32 bits of the accumulators are
+	/// written to even positions of the LO register and sign-extended. The high 32 bits are
+	/// written to even positions of the HI register and sign extended.
+	/// 
+	/// Multiplication happens asynchronously. Reading from the return value, the LO or the HI
+	/// register will stall the EE Core until the result is ready.
+	/// 
+	/// This function writes to global state (LO/HI).
+	/// @param state Additional state used in safe mode. May not be NULL.
+	/// @param l First operand
+	/// @param r Second operand
+	/// @return Multiply-accumulate result containing full 64-bit signed values
+	FORCEINLINE m128i64 mm_fma_epi64(lohi_state_t* state, m128i64 l, m128i64 r)
+	{
+		m128i64 result = {};
+
+#ifdef PS2INTRIN_UNSAFE
+		(void)state;
+
+		// volatile because writes to LO/HI
+		asm volatile(
+			"pmaddw	%[Result],%[Left],%[Right]"
+			: [Result] "=r" (result.v)
+			: [Left] "%r" (l.v),
+			  [Right] "r" (r.v)
+			: "lo", "hi"
+		);
+#elif defined(PS2INTRIN_HOST)
+		uint64_t left[2];
+		uint64_t right[2];
+		uint64_t lanes[2];
+
+		memcpy(left, &l, sizeof(left));
+		memcpy(right, &r, sizeof(right));
+		for (int i = 0; i < 2; ++i)
+		{
+			uint64_t accumulator = ((state->hi[i] << 32) | (state->lo[i] & 0xFFFFFFFF)) + (uint64_t)((int64_t)(int32_t)left[i] * (int32_t)right[i]);
+
+			state->lo[i] = (uint64_t)(int64_t)(int32_t)accumulator;
+			state->hi[i] = (uint64_t)(int64_t)(int32_t)(accumulator >> 32);
+			lanes[i] = accumulator;
+		}
+		memcpy(&result, lanes, sizeof(lanes));
+#else
+		uint64_t tmplo = 0;
+		uint64_t tmphi = 0;
+
+		asm(
+			"pmflo	%[TmpLo]\n\t"
+			"pmfhi	%[TmpHi]\n\t"
+			"pcpyld	%[StateLo0],%[StateLo1],%[StateLo0]\n\t"
+			"pcpyld	%[StateHi0],%[StateHi1],%[StateHi0]\n\t"
+			"pmtlo	%[StateLo0]\n\t"
+			"pmthi	%[StateHi0]\n\t"
+			"pcpyld	%[LeftLo],%[LeftHi],%[LeftLo]\n\t"
+			"pcpyld	%[RightLo],%[RightHi],%[RightLo]\n\t"
+			"pmaddw	%[ResultLo],%[LeftLo],%[RightLo]\n\t"
+			"pcpyud	%[ResultHi],%[ResultLo],%[ResultLo]\n\t"
+			"pmflo	%[StateLo0]\n\t"
+			"pmfhi	%[StateHi0]\n\t"
+			"pcpyud	%[StateLo1],%[StateLo0],%[StateLo0]\n\t"
+			"pcpyud	%[StateHi1],%[StateHi0],%[StateHi0]\n\t"
+			"pmtlo	%[TmpLo]\n\t"
+			"pmthi	%[TmpHi]"
+			: [TmpLo] "=&r" (tmplo),
+			  [TmpHi] "=&r" (tmphi),
+			  [ResultLo] "=r" (result.lo),
+			  [ResultHi] "=r" (result.hi),
+			  [StateLo0] "+r" (state->lo[0]),
+			  [StateLo1] "+r" (state->lo[1]),
+			  [StateHi0] "+r" (state->hi[0]),
+			  [StateHi1] "+r" (state->hi[1])
+			: [LeftLo] "r" (l.lo),
+			  [LeftHi] "r" (l.hi),
+			  [RightLo] "r" (r.lo),
+			  [RightHi] "r" (r.hi)
+		);
+#endif
+
+		return result;
+	}
+
+	/// @brief PMADDUW : Parallel Multiply-ADD Unsigned Word
+	/// 
+	/// Multiply 2 pairs of unsigned 32-bit values and accumulate. The input operands are treated
+	/// as sign-extended 32-bit values. Assign each product a 64-bit accumulator a0..a1 in LO/HI
+	/// according to the output locations of 'mm_mul_epu64'. The products are added to the
+	/// accumulator and written to the return value. The low 32 bits of the accumulators are
+	/// written to even positions of the LO register and sign-extended. The high 32 bits are
+	/// written to even positions of the HI register and sign extended.
+	/// 
+	/// Multiplication happens asynchronously. Reading from the return value, the LO or the HI
+	/// register will stall the EE Core until the result is ready.
+	/// 
+	/// This function writes to global state (LO/HI).
+	/// @param state Additional state used in safe mode. May not be NULL.
+	/// @param l First operand
+	/// @param r Second operand
+	/// @return Multiply-accumulate result containing full 64-bit unsigned values
+	FORCEINLINE m128u64 mm_fma_epu64(lohi_state_t* state, m128u64 l, m128u64 r)
+	{
+		m128u64 result = {};
+
+#ifdef PS2INTRIN_UNSAFE
+		(void)state;
+
+		// volatile because writes to LO/HI
+		asm volatile(
+			"pmadduw	%[Result],%[Left],%[Right]"
+			: [Result] "=r" (result.v)
+			: [Left] "%r" (l.v),
+			  [Right] "r" (r.v)
+			: "lo", "hi"
+		);
+#elif defined(PS2INTRIN_HOST)
+		uint64_t left[2];
+		uint64_t right[2];
+		uint64_t lanes[2];
+
+		memcpy(left, &l, sizeof(left));
+		memcpy(right, &r, sizeof(right));
+		for (int i = 0; i < 2; ++i)
+		{
+			uint64_t accumulator = ((state->hi[i] << 32) | (state->lo[i] & 0xFFFFFFFF)) + (uint64_t)(uint32_t)left[i] * (uint32_t)right[i];
+
+			state->lo[i] = (uint64_t)(int64_t)(int32_t)accumulator;
+			state->hi[i] = (uint64_t)(int64_t)(int32_t)(accumulator >> 32);
+			lanes[i] = accumulator;
+		}
+		memcpy(&result, lanes, sizeof(lanes));
+#else
+		uint64_t tmplo = 0;
+		uint64_t tmphi = 0;
+
+		asm(
+			"pmflo	%[TmpLo]\n\t"
+			"pmfhi	%[TmpHi]\n\t"
+			"pcpyld	%[StateLo0],%[StateLo1],%[StateLo0]\n\t"
+			"pcpyld	%[StateHi0],%[StateHi1],%[StateHi0]\n\t"
+			"pmtlo	%[StateLo0]\n\t"
+			"pmthi	%[StateHi0]\n\t"
+			"pcpyld	%[LeftLo],%[LeftHi],%[LeftLo]\n\t"
+			"pcpyld	%[RightLo],%[RightHi],%[RightLo]\n\t"
+			"pmadduw	%[ResultLo],%[LeftLo],%[RightLo]\n\t"
+			"pcpyud	%[ResultHi],%[ResultLo],%[ResultLo]\n\t"
+			"pmflo	%[StateLo0]\n\t"
+			"pmfhi	%[StateHi0]\n\t"
+			"pcpyud	%[StateLo1],%[StateLo0],%[StateLo0]\n\t"
+			"pcpyud	%[StateHi1],%[StateHi0],%[StateHi0]\n\t"
+			"pmtlo	%[TmpLo]\n\t"
+			"pmthi	%[TmpHi]"
+			: [TmpLo] "=&r" (tmplo),
+			  [TmpHi] "=&r" (tmphi),
+			  [ResultLo] "=r" (result.lo),
+			  [ResultHi] "=r" (result.hi),
+			  [StateLo0] "+r" (state->lo[0]),
+			  [StateLo1] "+r" (state->lo[1]),
+			  [StateHi0] "+r" (state->hi[0]),
+			  [StateHi1] "+r" (state->hi[1])
+			: [LeftLo] "r" (l.lo),
+			  [LeftHi] "r" (l.hi),
+			  [RightLo] "r" (r.lo),
+			  [RightHi] "r" (r.hi)
+		);
+#endif
+
+		return result;
+	}
+
+	/// @brief PMSUBH : Parallel Multiply-SUBtract Halfword
+	/// 
+	/// Works exactly as 'mm_fma_epi16' but subtracts the product from the accumulators instead.
+	/// 
+	/// Multiplication happens asynchronously. Reading from the return value, the LO or the HI
+	/// register will stall the EE Core until the result is ready.
+	/// 
+	/// You can extract only the accumulators not in the return value using
+	/// 'mm_loadlohi_upper_epi32'.
+	/// 
+	/// This function writes to global state (LO/HI).
+	/// @param state Additional state used in safe mode. May not be NULL.
+	/// @param l First operand
+	/// @param r Second operand
+	/// @return Multipy-accumulate result of value pairs in even positions
+	FORCEINLINE m128i32 mm_fms_epi16(lohi_state_t* state, m128i16 l, m128i16 r)
+	{
+		m128i32 result = {};
+
+#ifdef PS2INTRIN_UNSAFE
+		(void)state;
+
+		// volatile because writes to LO/HI
+		asm volatile(
+			"pmsubh	%[Result],%[Left],%[Right]"
+			: [Result] "=r" (result.v)
+			: [Left] "%r" (l.v),
+			  [Right] "r" (r.v)
+			: "lo", "hi"
+		);
+#elif defined(PS2INTRIN_HOST)
+		int16_t left[8];
+		int16_t right[8];
+		uint32_t lo[4];
+		uint32_t hi[4];
+		uint32_t lanes[4];
+
+		memcpy(left, &l, sizeof(left));
+		memcpy(right, &r, sizeof(right));
+		memcpy(lo, state->lo, sizeof(lo));
+		memcpy(hi, state->hi, sizeof(hi));
+		for (int i = 0; i < 2; ++i)
+		{
+			lo[2 * i + 0] -= (uint32_t)((int32_t)left[4 * i + 0] * right[4 * i + 0]);
+			lo[2 * i + 1] -= (uint32_t)((int32_t)left[4 * i + 1] * right[4 * i + 1]);
+			hi[2 * i + 0] -= (uint32_t)((int32_t)left[4 * i + 2] * right[4 * i + 2]);
+			hi[2 * i + 1] -= (uint32_t)((int32_t)left[4 * i + 3] * right[4 * i + 3]);
+			lanes[2 * i + 0] = lo[2 * i + 0];
+			lanes[2 * i + 1] = hi[2 * i + 0];
+		}
+		memcpy(state->lo, lo, sizeof(lo));
+		memcpy(state->hi, hi, sizeof(hi));
+		memcpy(&result, lanes, sizeof(lanes));
+#else
+		uint64_t tmplo = 0;
+		uint64_t tmphi = 0;
+
+		asm(
+			"pmflo	%[TmpLo]\n\t"
+			"pmfhi	%[TmpHi]\n\t"
+			"pcpyld	%[StateLo0],%[StateLo1],%[StateLo0]\n\t"
+			"pcpyld	%[StateHi0],%[StateHi1],%[StateHi0]\n\t"
+			"pmtlo	%[StateLo0]\n\t"
+			"pmthi	%[StateHi0]\n\t"
+			"pcpyld	%[LeftLo],%[LeftHi],%[LeftLo]\n\t"
+			"pcpyld	%[RightLo],%[RightHi],%[RightLo]\n\t"
+			"pmsubh	%[ResultLo],%[LeftLo],%[RightLo]\n\t"
+			"pcpyud	%[ResultHi],%[ResultLo],%[ResultLo]\n\t"
+			"pmflo	%[StateLo0]\n\t"
+			"pmfhi	%[StateHi0]\n\t"
+			"pcpyud	%[StateLo1],%[StateLo0],%[StateLo0]\n\t"
+			"pcpyud	%[StateHi1],%[StateHi0],%[StateHi0]\n\t"
+			"pmtlo	%[TmpLo]\n\t"
+			"pmthi	%[TmpHi]"
+			: [TmpLo] "=&r" (tmplo),
+			  [TmpHi] "=&r" (tmphi),
+			  [ResultLo] "=r" (result.lo),
+			  [ResultHi] "=r" (result.hi),
+			  [StateLo0] "+r" (state->lo[0]),
+			  [StateLo1] "+r" (state->lo[1]),
+			  [StateHi0] "+r" (state->hi[0]),
+			  [StateHi1] "+r" (state->hi[1])
+			: [LeftLo] "r" (l.lo),
+			  [LeftHi] "r" (l.hi),
+			  [RightLo] "r" (r.lo),
+			  [RightHi] "r" (r.hi)
+		);
+#endif
+
+		return result;
+	}
+
+	/// @brief PMSUBW : Parallel Multiply-SUBtract Word
+	/// 
+	/// Works exactly as 'mm_fma_epi64' but subtracts the product from the accumulators instead.
+	/// 
+	/// Multiplication happens asynchronously. Reading from the return value, the LO or the HI
+	/// register will stall the EE Core until the result is ready.
+	/// 
+	/// This function writes to global state (LO/HI).
+	/// @param state Additional state used in safe mode. May not be NULL.
+	/// @param l First operand
+	/// @param r Second operand
+	/// @return Multiply-accumulate result containing full 64-bit signed values
+	FORCEINLINE m128i64 mm_fms_epi64(lohi_state_t* state, m128i64 l, m128i64 r)
+	{
+		m128i64 result = {};
+
+#ifdef PS2INTRIN_UNSAFE
+		(void)state;
+
+		// volatile because writes to LO/HI
+		asm volatile(
+			"pmsubw	%[Result],%[Left],%[Right]"
+			: [Result] "=r" (result.v)
+			: [Left] "%r" (l.v),
+			  [Right] "r" (r.v)
+			: "lo", "hi"
+		);
+#elif defined(PS2INTRIN_HOST)
+		uint64_t left[2];
+		uint64_t right[2];
+		uint64_t lanes[2];
+
+		memcpy(left, &l, sizeof(left));
+		memcpy(right, &r, sizeof(right));
+		for (int i = 0; i < 2; ++i)
+		{
+			uint64_t accumulator = ((state->hi[i] << 32) | (state->lo[i] & 0xFFFFFFFF)) - (uint64_t)((int64_t)(int32_t)left[i] * (int32_t)right[i]);
+
+			state->lo[i] = (uint64_t)(int64_t)(int32_t)accumulator;
+			state->hi[i] = (uint64_t)(int64_t)(int32_t)(accumulator >> 32);
+			lanes[i] = accumulator;
+		}
+		memcpy(&result, lanes, sizeof(lanes));
+#else
+		uint64_t tmplo = 0;
+		uint64_t tmphi = 0;
+
+		asm(
+			"pmflo	%[TmpLo]\n\t"
+			"pmfhi	%[TmpHi]\n\t"
+			"pcpyld	%[StateLo0],%[StateLo1],%[StateLo0]\n\t"
+			"pcpyld	%[StateHi0],%[StateHi1],%[StateHi0]\n\t"
+			"pmtlo	%[StateLo0]\n\t"
+			"pmthi	%[StateHi0]\n\t"
+			"pcpyld	%[LeftLo],%[LeftHi],%[LeftLo]\n\t"
+			"pcpyld	%[RightLo],%[RightHi],%[RightLo]\n\t"
+			"pmsubw	%[ResultLo],%[LeftLo],%[RightLo]\n\t"
+			"pcpyud	%[ResultHi],%[ResultLo],%[ResultLo]\n\t"
+			"pmflo	%[StateLo0]\n\t"
+			"pmfhi	%[StateHi0]\n\t"
+			"pcpyud	%[StateLo1],%[StateLo0],%[StateLo0]\n\t"
+			"pcpyud	%[StateHi1],%[StateHi0],%[StateHi0]\n\t"
+			"pmtlo	%[TmpLo]\n\t"
+			"pmthi	%[TmpHi]"
+			: [TmpLo] "=&r" (tmplo),
+			  [TmpHi] "=&r" (tmphi),
+			  [ResultLo] "=r" (result.lo),
+			  [ResultHi] "=r" (result.hi),
+			  [StateLo0] "+r" (state->lo[0]),
+			  [StateLo1] "+r" (state->lo[1]),
+			  [StateHi0] "+r" (state->hi[0]),
+			  [StateHi1] "+r" (state->hi[1])
+			: [LeftLo] "r" (l.lo),
+			  [LeftHi] "r" (l.hi),
+			  [RightLo] "r" (r.lo),
+			  [RightHi] "r" (r.hi)
+		);
+#endif
+
+		return result;
+	}
+
+	/// @brief PHMADH : Parallel Horizontal Multiply-ADd Halfword
+	/// 
+	/// Split 8 signed 16-bit values into 4 groups of 2. Multiply corresponding values from both
+	/// operands into intermediate 32-bit values. Add the 2 intermediate values within a group.
+	/// The result of group 0 (input values at index 0 and 1) is written to the return value at
+	/// index 0 and the LO register at bits [0, 31]. The result of group 1 (input values at index
+	/// 2 and 3) is written to the return value at index 1 and the HI register at bits [0, 31].
+	/// The result of group 2 (4 and 5) is at index 2 and in LO[64, 95]. The result of group 3 (6
+	/// and 7) is at index 3 and in HI[64, 95].
+	/// 
+	/// Bitwise result:
+	///		tmp0	=	l[ 0,  15] * r[ 0,  15] + l[ 16,  31] * r[ 16,  31]
+	///		tmp1	=	l[32,  47] * r[32,  47] + l[ 48,  63] * r[ 48,  63]
+	///		tmp2	=	l[64,  79] * r[64,  79] + l[ 80,  95] * r[ 80,  95]
+	///		tmp3	=	l[96, 111] * r[96, 111] + l[112, 127] * r[112, 127]
+	///		Return value[ 0,  31]	=	tmp0
+	///		Return value[32,  63]	=	tmp1
+	///		Return value[64,  95]	=	tmp2
+	///		Return value[96, 127]	=	tmp3
+	///		LO[ 0,  31]	=	tmp0
+	///		LO[32,  63]	=	<undefined>
+	///		LO[64,  95]	=	tmp2
+	///		LO[96, 127]	=	<undefined>
+	///		HI[ 0,  31]	=	tmp1
+	///		HI[32,  63]	=	<undefined>
+	///		HI[64,  95]	=	tmp3
+	///		HI[96, 127]	=	<undefined>
+	/// 
+	/// Multiplication happens asynchronously. Reading from the return value, the LO or the HI
+	/// register will stall the EE Core until the result is ready.
+	/// 
+	/// This function writes to global state (LO/HI).
+	/// @param state Additional state used in safe mode. May not be NULL.
+	/// @param l First Operand
+	/// @param r Second Operand
+	/// @return Horizontal sums of multiplication products
+	FORCEINLINE m128i32 mm_hmuladd_epi16(lohi_state_t* state, m128i16 l, m128i16 r)
+	{
+		m128i32 result = {};
+
+#ifdef PS2INTRIN_UNSAFE
+		(void)state;
+
+		// volatile because writes to LO/HI
+		asm volatile(
+			"phmadh	%[Result],%[Left],%[Right]"
+			: [Result] "=r" (result.v)
+			: [Left] "%r" (l.v),
+			  [Right] "r" (r.v)
+			: "lo", "hi"
+		);
+#elif defined(PS2INTRIN_HOST)
+		// The words of LO/HI the hardware leaves undefined are left unchanged.
+		int16_t left[8];
+		int16_t right[8];
+		uint32_t products[8];
+		uint32_t lo[4];
+		uint32_t hi[4];
+		uint32_t lanes[4];
+
+		memcpy(left, &l, sizeof(left));
+		memcpy(right, &r, sizeof(right));
+		memcpy(lo, state->lo, sizeof(lo));
+		memcpy(hi, state->hi, sizeof(hi));
+		for (int i = 0; i < 8; ++i)
+		{
+			products[i] = (uint32_t)((int32_t)left[i] * right[i]);
+		}
+		for (int i = 0; i < 4; ++i)
+		{
+			lanes[i] = products[2 * i + 0] + products[2 * i + 1];
+		}
+		lo[0] = lanes[0];
+		hi[0] = lanes[1];
+		lo[2] = lanes[2];
+		hi[2] = lanes[3];
+		memcpy(state->lo, lo, sizeof(lo));
+		memcpy(state->hi, hi, sizeof(hi));
+		memcpy(&result, lanes, sizeof(lanes));
+#else
+		uint64_t tmplo = 0;
+		uint64_t tmphi = 0;
+
+		asm(
+			"pmflo	%[TmpLo]\n\t"
+			"pmfhi	%[TmpHi]\n\t"
+			"pcpyld	%[StateLo0],%[StateLo1],%[StateLo0]\n\t"
+			"pcpyld	%[StateHi0],%[StateHi1],%[StateHi0]\n\t"
+			"pmtlo	%[StateLo0]\n\t"
+			"pmthi	%[StateHi0]\n\t"
+			"pcpyld	%[LeftLo],%[LeftHi],%[LeftLo]\n\t"
+			"pcpyld	%[RightLo],%[RightHi],%[RightLo]\n\t"
+			"phmadh	%[ResultLo],%[LeftLo],%[RightLo]\n\t"
+			"pcpyud	%[ResultHi],%[ResultLo],%[ResultLo]\n\t"
+			"pmflo	%[StateLo0]\n\t"
+			"pmfhi	%[StateHi0]\n\t"
+			"pcpyud	%[StateLo1],%[StateLo0],%[StateLo0]\n\t"
+			"pcpyud	%[StateHi1],%[StateHi0],%[StateHi0]\n\t"
+			"pmtlo	%[TmpLo]\n\t"
+			"pmthi	%[TmpHi]"
+			: [TmpLo] "=&r" (tmplo),
+			  [TmpHi] "=&r" (tmphi),
+			  [ResultLo] "=r" (result.lo),
+			  [ResultHi] "=r" (result.hi),
+			  [StateLo0] "+r" (state->lo[0]),
+			  [StateLo1] "+r" (state->lo[1]),
+			  [StateHi0] "+r" (state->hi[0]),
+			  [StateHi1] "+r" (state->hi[1])
+			: [LeftLo] "r" (l.lo),
+			  [LeftHi] "r" (l.hi),
+			  [RightLo] "r" (r.lo),
+			  [RightHi] "r" (r.hi)
+		);
+#endif
+
+		return result;
+	}
+
+	/// @brief PHMSBH : Parallel Horizontal Multiply-SuBtract Halfword
+	/// 
+	/// Split 8 signed 16-bit values into 4 groups of 2. Multiply corresponding values from both
+	/// operands into intermediate 32-bit values. Subtract the intermediate value of the lower
+	/// index from the one of the higher index within a group. The result of group 0 (input
+	/// values at index 0 and 1) is written to the return value at index 0 and the LO register at
+	/// bits [0, 31]. The result of group 1 (input values at index 2 and 3) is written to the
+	/// return value at index 1 and the HI register at bits [0, 31]. The result of group 2 (4 and
+	/// 5) is at index 2 and in LO[64, 95]. The result of group 3 (6 and 7) is at index 3 and in
+	/// HI[64, 95].
+	/// 
+	/// Bitwise result:
+	///		tmp0	=	l[ 16,  31] * r[ 16,  31] - l[ 0,  15] * r[ 0,  15]
+	///		tmp1	=	l[ 48,  63] * r[ 48,  63] - l[32,  47] * r[32,  47]
+	///		tmp2	=	l[ 80,  95] * r[ 80,  95] - l[64,  79] * r[64,  79]
+	///		tmp3	=	l[112, 127] * r[112, 127] - l[96, 111] * r[96, 111]
+	///		Return value[ 0,  31]	=	tmp0
+	///		Return value[32,  63]	=	tmp1
+	///		Return value[64,  95]	=	tmp2
+	///		Return value[96, 127]	=	tmp3
+	///		LO[ 0,  31]	=	tmp0
+	///		LO[32,  63]	=	<undefined>
+	///		LO[64,  95]	=	tmp2
+	///		LO[96, 127]	=	<undefined>
+	///		HI[ 0,  31]	=	tmp1
+	///		HI[32,  63]	=	<undefined>
+	///		HI[64,  95]	=	tmp3
+	///		HI[96, 127]	=	<undefined>
+	/// 
+	/// Multiplication happens asynchronously. Reading from the return value, the LO or the HI
+	/// register will stall the EE Core until the result is ready.
+	/// 
+	/// This function writes to global state (LO/HI).
+	/// @param state Additional state used in safe mode. May not be NULL.
+	/// @param l First Operand
+	/// @param r Second Operand
+	/// @return Horizontal differences of multiplication products
+	FORCEINLINE m128i32 mm_hmulsub_epi16(lohi_state_t* state, m128i16 l, m128i16 r)
+	{
+		m128i32 result = {};
+
+#ifdef PS2INTRIN_UNSAFE
+		(void)state;
+
+		// volatile because writes to LO/HI
+		asm volatile(
+			"phmsbh	%[Result],%[Left],%[Right]"
+			: [Result] "=r" (result.v)
+			: [Left] "%r" (l.v),
+			  [Right] "r" (r.v)
+			: "lo", "hi"
+		);
+#elif defined(PS2INTRIN_HOST)
+		int16_t left[8];
+		int16_t right[8];
+		uint32_t products[8];
+		uint32_t lo[4];
+		uint32_t hi[4];
+		uint32_t lanes[4];
+
+		memcpy(left, &l, sizeof(left));
+		memcpy(right, &r, sizeof(right));
+		memcpy(lo, state->lo, sizeof(lo));
+		memcpy(hi, state->hi, sizeof(hi));
+		for (int i = 0; i < 8; ++i)
+		{
+			products[i] = (uint32_t)((int32_t)left[i] * right[i]);
+		}
+		for (int i = 0; i < 4; ++i)
+		{
+			lanes[i] = products[2 * i + 1] - products[2 * i + 0];
+		}
+		lo[0] = lanes[0];
+		hi[0] = lanes[1];
+		lo[2] = lanes[2];
+		hi[2] = lanes[3];
+		memcpy(state->lo, lo, sizeof(lo));
+		memcpy(state->hi, hi, sizeof(hi));
+		memcpy(&result, lanes, sizeof(lanes));
+#else
+		uint64_t tmplo = 0;
+		uint64_t tmphi = 0;
+
+		asm(
+			"pmflo	%[TmpLo]\n\t"
+			"pmfhi	%[TmpHi]\n\t"
+			"pcpyld	%[StateLo0],%[StateLo1],%[StateLo0]\n\t"
+			"pcpyld	%[StateHi0],%[StateHi1],%[StateHi0]\n\t"
+			"pmtlo	%[StateLo0]\n\t"
+			"pmthi	%[StateHi0]\n\t"
+			"pcpyld	%[LeftLo],%[LeftHi],%[LeftLo]\n\t"
+			"pcpyld	%[RightLo],%[RightHi],%[RightLo]\n\t"
+			"phmsbh	%[ResultLo],%[LeftLo],%[RightLo]\n\t"
+			"pcpyud	%[ResultHi],%[ResultLo],%[ResultLo]\n\t"
+			"pmflo	%[StateLo0]\n\t"
+			"pmfhi	%[StateHi0]\n\t"
+			"pcpyud	%[StateLo1],%[StateLo0],%[StateLo0]\n\t"
+			"pcpyud	%[StateHi1],%[StateHi0],%[StateHi0]\n\t"
+			"pmtlo	%[TmpLo]\n\t"
+			"pmthi	%[TmpHi]"
+			: [TmpLo] "=&r" (tmplo),
+			  [TmpHi] "=&r" (tmphi),
+			  [ResultLo] "=r" (result.lo),
+			  [ResultHi] "=r" (result.hi),
+			  [StateLo0] "+r" (state->lo[0]),
+			  [StateLo1] "+r" (state->lo[1]),
+			  [StateHi0] "+r" (state->hi[0]),
+			  [StateHi1] "+r" (state->hi[1])
+			: [LeftLo] "r" (l.lo),
+			  [LeftHi] "r" (l.hi),
+			  [RightLo] "r" (r.lo),
+			  [RightHi] "r" (r.hi)
+		);
+#endif
+
+		return result;
+	}
+
+
+	/// @brief PDIVW : Parallel DIVide Word
+	/// 
+	/// Treat each operand as containing 2 32-bit sign-extended values. Divide each pair and store
+	/// the quotients in the LO register and the remainder in the HI register as sign-extended 32-
+	/// bit values. See 'divrem0_i32_start' for further information regarding result signedness
+	/// and overflow/div-by-0 behavior.
+	/// 
+	/// As integer division is done asynchronously on the EE Core you should issue the division
+	/// instruction before checking for erroneous inputs like div-by-0 to improve throughput.
+	/// Reading from the result registers (LO/HI) will cause a stall if the result is not ready at
+	/// that point in time.
+	/// 
+	/// This function writes to global state (LO/HI).
+	/// @param state Additional state used in safe mode. May not be NULL.
+	/// @param dividend Values to divide
+	/// @param divisor Values to divide by
+	FORCEINLINE void mm_divrem_epi64(lohi_state_t* state, m128i64 dividend, m128i64 divisor)
+	{
+#ifdef PS2INTRIN_UNSAFE
+		(void)state;
+
+		// volatile because writes to LO/HI
+		asm volatile(
+			"pdivw	%[Dividend],%[Divisor]"
+			:
+			: [Dividend] "r" (dividend.v),
+			  [Divisor] "r" (divisor.v)
+			: "lo", "hi"
+		);
+#elif defined(PS2INTRIN_HOST)
+		// Division by 0 and overflow give the same results as 'divrem0_i32_start'.
+		uint64_t dividends[2];
+		uint64_t divisors[2];
+
+		memcpy(dividends, &dividend, sizeof(dividends));
+		memcpy(divisors, &divisor, sizeof(divisors));
+		for (int i = 0; i < 2; ++i)
+		{
+			int32_t l = (int32_t)dividends[i];
+			int32_t r = (int32_t)divisors[i];
+			int32_t quotient = 0;
+			int32_t remainder = 0;
+
+			if (r == 0)
+			{
+				quotient = l < 0 ? 1 : -1;
+				remainder = l;
+			}
+			else if (l == INT32_MIN && r == -1)
+			{
+				quotient = INT32_MIN;
+				remainder = 0;
+			}
+			else
+			{
+				quotient = l / r;
+				remainder = l % r;
+			}
+			state->lo[i] = (uint64_t)(int64_t)quotient;
+			state->hi[i] = (uint64_t)(int64_t)remainder;
+		}
+#else
+		uint64_t tmplo = 0;
+		uint64_t tmphi = 0;
+		
+		asm(
+			"pmflo	%[TmpLo]\n\t"
+			"pmfhi	%[TmpHi]\n\t"
+			"pcpyld	%[DividendLo],%[DividendHi],%[DividendLo]\n\t"
+			"pcpyld	%[DivisorLo],%[DivisorHi],%[DivisorLo]\n\t"
+			"pdivw	%[DividendLo],%[DivisorLo]\n\t"
+			"pmflo	%[StateLo0]\n\t"
+			"pmfhi	%[StateHi0]\n\t"
+			"pcpyud	%[StateLo1],%[StateLo0],%[StateLo0]\n\t"
+			"pcpyud	%[StateHi1],%[StateHi0],%[StateHi0]\n\t"
+			"pmtlo	%[TmpLo]\n\t"
+			"pmthi	%[TmpHi]"
+			: [TmpLo] "=&r" (tmplo),
+			  [TmpHi] "=&r" (tmphi),
+			  [StateLo0] "=r" (state->lo[0]),
+			  [StateLo1] "=r" (state->lo[1]),
+			  [StateHi0] "=r" (state->hi[0]),
+			  [StateHi1] "=r" (state->hi[1])
+			: [DividendLo] "r" (dividend.lo),
+			  [DividendHi] "r" (dividend.hi),
+			  [DivisorLo] "r" (divisor.lo),
+			  [DivisorHi] "r" (divisor.hi)
+		);
+#endif
+	}
+
+	/// @brief PDIVUW : Parallel DIVide Unsigned Word
+	/// 
+	/// Treat each operand as containing 2 32-bit sign-extended values. Divide each pair and store
+	/// the quotients in the LO register and the remainder in the HI register as sign-extended 32-
+	/// bit values. See 'divrem0_u32_start' for further information regarding overflow/div-by-0
+	/// behavior.
+	/// 
+	/// As integer division is done asynchronously on the EE Core you should issue the division
+	/// instruction before checking for erroneous inputs like div-by-0 to improve throughput.
+	/// Reading from the result registers (LO/HI) will cause a stall if the result is not ready at
+	/// that point in time.
+	/// 
+	/// This function writes to global state (LO/HI).
+	/// @param state Additional state used in safe mode. May not be NULL.
+	/// @param dividend Values to divide
+	/// @param divisor Values to divide by
+	FORCEINLINE void mm_divrem_epu64(lohi_state_t* state, m128u64 dividend, m128u64 divisor)
+	{
+#ifdef PS2INTRIN_UNSAFE
+		(void)state;
+
+		// volatile because writes to LO/HI
+		asm volatile(
+			"pdivuw	%[Dividend],%[Divisor]"
+			:
+			: [Dividend] "r" (dividend.v),
+			  [Divisor] "r" (divisor.v)
+			: "lo", "hi"
+		);
+#elif defined(PS2INTRIN_HOST)
+		// Division by 0 gives the same results as 'divrem0_u32_start'.
+		uint64_t dividends[2];
+		uint64_t divisors[2];
+
+		memcpy(dividends, &dividend, sizeof(dividends));
+		memcpy(divisors, &divisor, sizeof(divisors));
+		for (int i = 0; i < 2; ++i)
+		{
+			uint32_t l = (uint32_t)dividends[i];
+			uint32_t r = (uint32_t)divisors[i];
+			uint32_t quotient = r ? l / r : 0xFFFFFFFF;
+			uint32_t remainder = r ? l % r : l;
+
+			state->lo[i] = (uint64_t)(int64_t)(int32_t)quotient;
+			state->hi[i] = (uint64_t)(int64_t)(int32_t)remainder;
+		}
+#else
+		uint64_t tmplo = 0;
+		uint64_t tmphi = 0;
+
+		asm(
+			"pmflo	%[TmpLo]\n\t"
+			"pmfhi	%[TmpHi]\n\t"
+			"pcpyld	%[DividendLo],%[DividendHi],%[DividendLo]\n\t"
+			"pcpyld	%[DivisorLo],%[DivisorHi],%[DivisorLo]\n\t"
+			"pdivuw	%[DividendLo],%[DivisorLo]\n\t"
+			"pmflo	%[StateLo0]\n\t"
+			"pmfhi	%[StateHi0]\n\t"
+			"pcpyud	%[StateLo1],%[StateLo0],%[StateLo0]\n\t"
+			"pcpyud	%[StateHi1],%[StateHi0],%[StateHi0]\n\t"
+			"pmtlo	%[TmpLo]\n\t"
+			"pmthi	%[TmpHi]"
+			: [TmpLo] "=&r" (tmplo),
+			  [TmpHi] "=&r" (tmphi),
+			  [StateLo0] "=r" (state->lo[0]),
+			  [StateLo1] "=r" (state->lo[1]),
+			  [StateHi0] "=r" (state->hi[0]),
+			  [StateHi1] "=r" (state->hi[1])
+			: [DividendLo] "r" (dividend.lo),
+			  [DividendHi] "r" (dividend.hi),
+			  [DivisorLo] "r" (divisor.lo),
+			  [DivisorHi] "r" (divisor.hi)
+		);
+#endif
+	}
+
+	/// @brief PDIVBW : Parallel DIVide Broadcast Word
+	/// 
+	/// Divide 4 32-bit signed values by a single signed 16-bit value. Store the four quotients
+	/// to the LO register and the remainders to the HI register.
+	/// 
+	/// As integer division is done asynchronously on the EE Core you should issue the division
+	/// instruction before checking for erroneous inputs like div-by-0 to improve throughput.
+	/// Reading from the result registers (LO/HI) will cause a stall if the result is not ready at
+	/// that point in time.
+	/// 
+	/// This function writes to global state (LO/HI).
+	/// @param state Additional state used in safe mode. May not be NULL.
+	/// @param dividend Values to divide
+	/// @param divisor Value to divide by
+	FORCEINLINE void mm_divremb_epi32(lohi_state_t* state, m128i32 dividend, int16_t divisor)
+	{
+#ifdef PS2INTRIN_UNSAFE
+		(void)state;
+
+		// volatile because writes to LO/HI
+		asm volatile(
+			"pdivbw	%[Dividend],%[Divisor]"
+			:
+			: [Dividend] "r" (dividend.v),
+			  [Divisor] "r" (divisor)
+			: "lo", "hi"
+		);
+#elif defined(PS2INTRIN_HOST)
+		// Division by 0 and overflow give the same results as 'divrem0_i32_start'.
+		int32_t dividends[4];
+		int32_t quotients[4];
+		int32_t remainders[4];
+
+		memcpy(dividends, &dividend, sizeof(dividends));
+		for (int i = 0; i < 4; ++i)
+		{
+			if (divisor == 0)
+			{
+				quotients[i] = dividends[i] < 0 ? 1 : -1;
+				remainders[i] = dividends[i];
+			}
+			else if (dividends[i] == INT32_MIN && divisor == -1)
+			{
+				quotients[i] = INT32_MIN;
+				remainders[i] = 0;
+			}
+			else
+			{
+				quotients[i] = dividends[i] / divisor;
+				remainders[i] = dividends[i] % divisor;
+			}
+		}
+		memcpy(state->lo, quotients, sizeof(quotients));
+		memcpy(state->hi, remainders, sizeof(remainders));
+#else
+		uint64_t tmplo = 0;
+		uint64_t tmphi = 0;
+
+		asm(
+			"pmflo	%[TmpLo]\n\t"
+			"pmfhi	%[TmpHi]\n\t"
+			"pcpyld	%[DividendLo],%[DividendHi],%[DividendLo]\n\t"
+			"pdivbw	%[DividendLo],%[Divisor]\n\t"
+			"pmflo	%[StateLo0]\n\t"
+			"pmfhi	%[StateHi0]\n\t"
+			"pcpyud	%[StateLo1],%[StateLo0],%[StateLo0]\n\t"
+			"pcpyud	%[StateHi1],%[StateHi0],%[StateHi0]\n\t"
+			"pmtlo	%[TmpLo]\n\t"
+			"pmthi	%[TmpHi]"
+			: [TmpLo] "=&r" (tmplo),
+			  [TmpHi] "=&r" (tmphi),
+			  [StateLo0] "=r" (state->lo[0]),
+			  [StateLo1] "=r" (state->lo[1]),
+			  [StateHi0] "=r" (state->hi[0]),
+			  [StateHi1] "=r" (state->hi[1])
+			: [DividendLo] "r" (dividend.lo),
+			  [DividendHi] "r" (dividend.hi),
+			  [Divisor] "r" (divisor)
+		);
+#endif
+	}
+
+
+	/// @brief PLZCW : Parallel Leading Zero or one Count Word
+	/// 
+	/// Uses only the low 64 bits / 2 values from the 4 value argument. For each value, count the
+	/// number of leading bits that have the same value minus 1. This means numbers starting with
+	/// '0b1110...' and '0b0001...' will both return '2' as there are 3 bits of the same value
+	/// beginning at the highest bit and we discard the count of the sign bit.
+	/// 
+	/// The upper 2 values are passed through from 'v' unchanged.
+	/// @param v Numbers to count leading bits of
+	/// @return Amount of same leading bits minus 1
+	FORCEINLINE CONST m128u32 mm_clb_epi32(m128i32 v)
+	{
+		m128u32 result = {};
+
+#ifdef PS2INTRIN_UNSAFE
+		asm(
+			"plzcw	%[Result],%[Value]"
+			: [Result] "=r" (result.v)
+			: [Value] "0" (v.v)				/* 'plzcw' leaves the upper 64 bits alone	*/
+		);
+#elif defined(PS2INTRIN_HOST)
+		uint32_t values[2];
+
+		memcpy(values, &v.lo, sizeof(values));
+		for (int i = 0; i < 2; ++i)
+		{
+			// Invert negative values, so only the leading zeros have to be counted.
+			uint32_t bits = values[i] ^ (uint32_t)((int32_t)values[i] >> 31);
+			values[i] = bits ? (uint32_t)__builtin_clz(bits) - 1 : 31;
+		}
+		memcpy(&result.lo, values, sizeof(values));
+		result.hi = v.hi;
+#else
+		asm(
+			"plzcw	%[ResultLo],%[ValueLo]"
+			: [ResultLo] "=r" (result.lo)
+			: [ValueLo] "r" (v.lo)
+		);
+		result.hi = v.hi;
+#endif
+
+		return result;
+	}
+
+	/// @brief PLZCW : Parallel Leading Zero or one Count Word
+	/// 
+	/// Uses only the low 64 bits / 2 values from the 4 value argument. For each value, count the
+	/// number of leading bits that have the same value minus 1. This means numbers starting with
+	/// '0b1110...' and '0b0001...' will both return '2' as there are 3 bits of the same value
+	/// beginning at the highest bit and we discard the count of the sign bit.
+	/// 
+	/// The upper 2 values are passed through from 'v' unchanged.
+	/// @param v Numbers to count leading bits of
+	/// @return Amount of same leading bits minus 1
+	FORCEINLINE CONST m128u32 mm_clb_epu32(m128u32 v)
+	{
+		return mm_clb_epi32(mm_castepi32_epu32(v));
+	}
+
+	/// @brief PLZCW : Parallel Leading Zero or one Count Word
+	/// 
+	/// Split the 64 bit argument into 2 32-bit values. For each value, count the number of
+	/// leading bits that have the same value minus 1. This means numbers starting with
+	/// '0b1110...' and '0b0001...' will both return '2' as there are 3 bits of the same value
+	/// beginning at the highest bit and we discard the count of the sign bit.
+	/// @param v Concatenated numbers to count leading bits of
+	/// @return Concatenated amount of same leading bits minus 1; low 32 bits are the value for
+	/// the low 32 bits of the input argument and the high 32 bits correspond to the high 32 bits
+	/// of the input
+	FORCEINLINE CONST uint64_t mm_clb_u64(uint64_t v)
+	{
+		uint64_t result = 0;
+
+#ifdef PS2INTRIN_HOST
+		for (int i = 0; i < 64; i += 32)
+		{
+			// Invert negative values, so only the leading zeros have to be counted.
+			uint32_t bits = (uint32_t)(v >> i) ^ (uint32_t)((int32_t)(v >> i) >> 31);
+			result |= (uint64_t)(bits ? (uint32_t)__builtin_clz(bits) - 1 : 31) << i;
+		}
+#else
+		asm(
+			"plzcw	%[Result],%[Value]"
+			: [Result] "=r" (result)
+			: [Value] "r" (v)
+		);
+#endif
+
+		return result;
+	}
+
+#ifdef __cplusplus
+}
+#endif
+
+#include "detail/end.h"
@@ -0,0 +1,351 @@
+#pragma once
+
+/*
+*	Types and general purpose functions shared by all ps2intrin headers: 128-bit integers, the
+*	safe mode LO/HI and SA state, result structs, the packed 'm128*' types and the no-op
+*	conversions between them, BREAK and PREF.
+*/
+
+#if defined(PS2INTRIN_HOST)
+#if defined(PS2INTRIN_UNSAFE)
+#error "PS2INTRIN_HOST uses the safe mode layout and cannot be combined with PS2INTRIN_UNSAFE."
+#endif
+#if defined(__BYTE_ORDER__) && __BYTE_ORDER__ != __ORDER_LITTLE_ENDIAN__
+#error "PS2INTRIN_HOST requires a little-endian host, like the EE."
+#endif
+#elif !defined(_EE)
+#error "This header only deals with EE-Core intrinsics and should not be used for the IOP or other architectures. Define 'PS2INTRIN_HOST' to use the portable C implementations."
+#endif
+
+#include <stdint.h>
+#include <string.h>
+
+#if defined(PS2INTRIN_UNSAFE) && !defined(PS2INTRIN_SILENCE_UNSAFE)
+#pragma message "Using unsafe ps2intrin mode. Check correctness of generated code."
+#endif
+
+#include "detail/begin.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+	// Types
+
+	/// @brief Signed 128-bit integer
+	///
+	/// Actually uses the low 64 bits of 2 registers. Functions using this type will always
+	/// combine both parts into a single 128-bit value regardless of whether PS2INTRIN_UNSAFE
+	/// is defined.
+	typedef int ALIGNAS16 int128_t MODE_TI;
+
+	/// @brief Unsigned 128-bit integer
+	///
+	/// Actually uses the low 64 bits of 2 registers. Functions using this type will always
+	/// combine both parts into a single 128-bit value regardless of whether PS2INTRIN_UNSAFE
+	/// is defined.
+	typedef unsigned ALIGNAS16 uint128_t MODE_TI;
+
+	/// @brief Type containing state of LO/HI registers. Used in safe mode to maintain expected
+	/// values regardless of other instructions executed around desired intrinsics.
+	/// Completely ignored if PS2INTRIN_UNSAFE is defined.
+	typedef struct
+	{
+#ifndef PS2INTRIN_UNSAFE
+		uint64_t lo[2];
+		uint64_t hi[2];
+#endif
+	} lohi_state_t;
+
+	/// @brief Type containing state of SA register. Used in safe mode to maintain expected
+	/// value regardless of other instructions executed around desired intrinsics.
+	/// Completely ignored if PS2INTRIN_UNSAFE is defined.
+	typedef struct
+	{
+		uint64_t sa;
+	} sa_state_t;
+
+	/// @brief Result type of signed 32-bit multiplication
+	typedef struct
+	{
+		int32_t lo;
+		int32_t hi;
+	} mul_i32_result_t;
+
+	/// @brief Result type of unsigned 32-bit multiplication
+	typedef struct
+	{
+		uint32_t lo;
+		uint32_t hi;
+	} mul_u32_result_t;
+
+	/// @brief Result type of signed 32-bit division with remainder
+	typedef struct
+	{
+		int32_t quotient;
+		int32_t remainder;
+	} divrem_i32_result_t;
+
+	/// @brief Result type of unsigned 32-bit division with remainder
+	typedef struct
+	{
+		uint32_t quotient;
+		uint32_t remainder;
+	} divrem_u32_result_t;
+
+	/// @brief A 128-bit value containing 16 signed 8-bit values.
+	/// Loads and stores of this type must be aligned 16 to bytes. Otherwise a different memory
+	/// address is fetched/written.
+	DECLAREVECTOR(int8_t, m128i8);
+
+	/// @brief A 128-bit value containing 16 unsigned 8-bit values.
+	/// Loads and stores of this type must be aligned 16 to bytes. Otherwise a different memory
+	/// address is fetched/written.
+	DECLAREVECTOR(uint8_t, m128u8);
+
+	/// @brief A 128-bit value containing 8 signed 16-bit values.
+	/// Loads and stores of this type must be aligned 16 to bytes. Otherwise a different memory
+	/// address is fetched/written.
+	DECLAREVECTOR(int16_t, m128i16);
+
+	/// @brief A 128-bit value containing 8 unsigned 16-bit values.
+	/// Loads and stores of this type must be aligned 16 to bytes. Otherwise a different memory
+	/// address is fetched/written.
+	DECLAREVECTOR(uint16_t, m128u16);
+
+	/// @brief A 128-bit value containing 4 signed 32-bit values.
+	/// Loads and stores of this type must be aligned 16 to bytes. Otherwise a different memory
+	/// address is fetched/written.
+	DECLAREVECTOR(int32_t, m128i32);
+
+	/// @brief A 128-bit value containing 4 unsigned 32-bit values.
+	/// Loads and stores of this type must be aligned 16 to bytes. Otherwise a different memory
+	/// address is fetched/written.
+	DECLAREVECTOR(uint32_t, m128u32);
+
+	/// @brief A 128-bit value containing 2 signed 64-bit values.
+	/// Loads and stores of this type must be aligned 16 to bytes. Otherwise a different memory
+	/// address is fetched/written.
+	/// 
+	/// Note: Some functions operate on these values. However, often the EE Core hardware
+	/// actually operates on 32-bit values with the upper 32 bits being sign-extension. This is
+	/// also noted on the specific functions this applies to.
+	DECLAREVECTOR(int64_t, m128i64);
+
+	/// @brief A 128-bit value containing 2 unsigned 64-bit values.
+	/// Loads and stores of this type must be aligned 16 to bytes. Otherwise a different memory
+	/// address is fetched/written.
+	/// 
+	/// Note: Some functions operate on these values. However, often the EE Core hardware
+	/// actually operates on 32-bit values with the upper 32 bits being sign-extension. This is
+	/// also noted on the specific functions this applies to.
+	DECLAREVECTOR(uint64_t, m128u64);
+
+	/// @brief A 128-bit value containing 1 signed 128-bit value.
+	/// Loads and stores of this type must be aligned 16 to bytes. Otherwise a different memory
+	/// address is fetched/written.
+	/// 
+	/// Note that 'int128_t' can be assigned using a 'qword_t' from <tamtypes.h>. Use this if you
+	/// already have a 'qword_t' you want to use, plus a cast.
+	DECLAREVECTOR(int128_t, m128i128);
+
+	/// @brief A 128-bit value containing 1 unsigned 128-bit value.
+	/// Loads and stores of this type must be aligned 16 to bytes. Otherwise a different memory
+	/// address is fetched/written.
+	/// 
+	/// Note that 'uint128_t' can be assigned using a 'qword_t' from <tamtypes.h>. Use this if
+	/// you already have a 'qword_t' you want to use, plus a cast.
+	DECLAREVECTOR(uint128_t, m128u128);
+
+
+	// General Purpose
+
+	/// @brief BREAK : BREAKpoint
+	/// 
+	/// Issue a breakpoint exception.
+	/// 
+	/// Has a 20-bit field for custom code, but can't be used here without compiler magic.
+	/// (It would need to be encoded in the instruction itself, not an argument).
+	FORCEINLINE void breakpoint()
+	{
+#ifdef PS2INTRIN_HOST
+		__builtin_trap();
+#else
+		// implicitly volatile
+		asm("break");
+#endif
+	}
+
+	/// @brief PREF : PREFetch
+	/// 
+	/// Prefetch data from memory to the cache.
+	/// 
+	/// Can set specific hint value. Only 0 is supported as this value, other values are
+	/// reserved. Possible values: [0, 32). Prefer using the function 'prefetch' instead.
+	/// 
+	/// Does nothing on uncached memory locations.
+	/// 
+	/// Not allowed on memory locations not present in the TLB. Not recently used pages may not
+	/// be present in the TLB, reducing effectiveness. Prefetch may not happen when the memory
+	/// bus is used.
+	/// @param address The address to prefetch. Must be a variable convertible to 'const void*'.
+	/// @param hint The hint value to use. Must be an integer literal.
+#ifdef PS2INTRIN_HOST
+#define PREF(address, hint) __builtin_prefetch((address))
+#else
+#define PREF(address, hint)																			\
+	asm(												/* implicitly volatile	*/					\
+		"pref	%c[Hint],%a[Address]"																\
+		:												/* output operands	*/						\
+		: [Hint] "n" (hint), [Address] "ZD" (address)	/* input operands	Per GCC documentation,	\
+														ZD refers to an address suitable for the	\
+														'prefetch' instruction	*/					\
+	)
+#endif
+
+	/// @brief PREF : PREFetch
+	/// 
+	/// Prefetch data from memory to the cache.
+	/// 
+	/// Uses hint value 0.
+	/// 
+	/// Does nothing on uncached memory locations.
+	/// 
+	/// Not allowed on memory locations not present in the TLB. Not recently used pages may not
+	/// be present in the TLB, reducing effectiveness. Prefetch may not happen when the memory
+	/// bus is used.
+	/// @param address The address to prefetch
+	FORCEINLINE void prefetch(const void* address)
+	{
+		PREF(address, 0);
+	}
+
+
+	// CAST
+#ifdef PS2INTRIN_UNSAFE
+	/// Conversion functions
+	///
+	/// All of these functions are no-ops and follow the naming convention 'mm_cast<To>_<From>'
+	#define CAST(NameTo, NameFrom)																	\
+	FORCEINLINE CONST m128 ## NameTo mm_castep ## NameTo ## _ep ## NameFrom (m128 ## NameFrom v) {	\
+		m128 ## NameTo result = { v.v };																\
+		return result;																				\
+	}
+#else
+	/// Conversion functions
+	///
+	/// All of these functions are no-ops and follow the naming convention 'mm_cast<To>_<From>'
+	#define CAST(NameTo, NameFrom)																	\
+	FORCEINLINE CONST m128 ## NameTo mm_castep ## NameTo ## _ep ## NameFrom (m128 ## NameFrom v) {	\
+		m128 ## NameTo result = { v.lo, v.hi };														\
+		return result;																				\
+	}
+#endif
+
+	CAST(u8, i8);
+	CAST(i16, i8);
+	CAST(u16, i8);
+	CAST(i32, i8);
+	CAST(u32, i8);
+	CAST(i64, i8);
+	CAST(u64, i8);
+	CAST(i128, i8);
+	CAST(u128, i8);
+
+	CAST(i8, u8);
+	CAST(i16, u8);
+	CAST(u16, u8);
+	CAST(i32, u8);
+	CAST(u32, u8);
+	CAST(i64, u8);
+	CAST(u64, u8);
+	CAST(i128, u8);
+	CAST(u128, u8);
+
+	CAST(i8, i16);
+	CAST(u8, i16);
+	CAST(u16, i16);
+	CAST(i32, i16);
+	CAST(u32, i16);
+	CAST(i64, i16);
+	CAST(u64, i16);
+	CAST(i128, i16);
+	CAST(u128, i16);
+
+	CAST(i8, u16);
+	CAST(u8, u16);
+	CAST(i16, u16);
+	CAST(i32, u16);
+	CAST(u32, u16);
+	CAST(i64, u16);
+	CAST(u64, u16);
+	CAST(i128, u16);
+	CAST(u128, u16);
+
+	CAST(i8, i32);
+	CAST(u8, i32);
+	CAST(i16, i32);
+	CAST(u16, i32);
+	CAST(u32, i32);
+	CAST(i64, i32);
+	CAST(u64, i32);
+	CAST(i128, i32);
+	CAST(u128, i32);
+
+	CAST(i8, u32);
+	CAST(u8, u32);
+	CAST(i16, u32);
+	CAST(u16, u32);
+	CAST(i32, u32);
+	CAST(i64, u32);
+	CAST(u64, u32);
+	CAST(i128, u32);
+	CAST(u128, u32);
+
+	CAST(i8, i64);
+	CAST(u8, i64);
+	CAST(i16, i64);
+	CAST(u16, i64);
+	CAST(i32, i64);
+	CAST(u32, i64);
+	CAST(u64, i64);
+	CAST(i128, i64);
+	CAST(u128, i64);
+
+	CAST(i8, u64);
+	CAST(u8, u64);
+	CAST(i16, u64);
+	CAST(u16, u64);
+	CAST(i32, u64);
+	CAST(u32, u64);
+	CAST(i64, u64);
+	CAST(i128, u64);
+	CAST(u128, u64);
+
+	CAST(i8, i128);
+	CAST(u8, i128);
+	CAST(i16, i128);
+	CAST(u16, i128);
+	CAST(i32, i128);
+	CAST(u32, i128);
+	CAST(i64, i128);
+	CAST(u64, i128);
+	CAST(u128, i128);
+
+	CAST(i8, u128);
+	CAST(u8, u128);
+	CAST(i16, u128);
+	CAST(u16, u128);
+	CAST(i32, u128);
+	CAST(u32, u128);
+	CAST(i64, u128);
+	CAST(u64, u128);
+	CAST(i128, u128);
+
+#undef CAST
+
+#ifdef __cplusplus
+}
+#endif
+
+#include "detail/end.h"
@@ -0,0 +1,573 @@
+#pragma once
+
+/*
+*	Multimedia compares: PCEQ and PCGT in all widths, plus the derived orderings.
+*/
+
+#include "common.h"
+#include "logic.h"
+
+#include "detail/begin.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+	/// @brief PCEQB : Parallel Compare for EQual Byte
+	/// 
+	/// Compare 16 8-bit value pairs for equality. On equality, return 0xFF for that value pair,
+	/// otherwise 0x00.
+	/// @param l First operand
+	/// @param r Second operand
+	/// @return Equality result mask
+	FORCEINLINE CONST m128i8 mm_cmpeq_epi8(m128i8 l, m128i8 r)
+	{
+		m128i8 result = {};
+
+#ifdef PS2INTRIN_UNSAFE
+		asm(
+			"pceqb	%[Result],%[Left],%[Right]"
+			: [Result] "=r" (result.v)
+			: [Left] "%r" (l.v),
+			  [Right] "r" (r.v)
+		);
+#elif defined(PS2INTRIN_HOST)
+		int8_t left[16];
+		int8_t right[16];
+		int8_t lanes[16];
+
+		memcpy(left, &l, sizeof(left));
+		memcpy(right, &r, sizeof(right));
+		for (int i = 0; i < 16; ++i)
+		{
+			lanes[i] = (int8_t)(left[i] == right[i] ? -1 : 0);
+		}
+		memcpy(&result, lanes, sizeof(lanes));
+#else
+		asm(
+			"pcpyld	%[LLo],%[LHi],%[LLo]\n\t"
+			"pcpyld	%[RLo],%[RHi],%[RLo]\n\t"
+			"pceqb	%[ResultLo],%[LLo],%[RLo]\n\t"
+			"pcpyud	%[ResultHi],%[ResultLo],%[ResultLo]"
+			: [ResultLo] "=r" (result.lo),
+			  [ResultHi] "=&r" (result.hi)
+			: [LLo] "r" (l.lo),
+			  [LHi] "r" (l.hi),
+			  [RLo] "r" (r.lo),
+			  [RHi] "r" (r.hi)
+		);
+#endif
+
+		return result;
+	}
+
+	/// @brief PCEQB : Parallel Compare for EQual Byte
+	/// PNOR : Parallel NOR
+	/// 
+	/// Convenience function. Invert result of 'cmpeq'.
+	/// @param l First operand
+	/// @param r Second operand
+	/// @return Inverted equality result mask
+	FORCEINLINE CONST m128i8 mm_cmpneq_epi8(m128i8 l, m128i8 r)
+	{
+		return mm_not_epi8(mm_cmpeq_epi8(l, r));
+	}
+
+	/// @brief PCGTB : Parallel Compare for Greater Than Byte
+	/// 
+	/// Compare 16 signed 8-bit value pairs for a greater than relationship. Returns 0xFF for
+	/// pairs where the value in 'l' is true greater than the value in 'r', and 0x00 otherwise.
+	/// 
+	/// Unsigned comparisons can be achieved by first adding '0x80' to every element in each
+	/// operand.
+	/// @param l Left operand
+	/// @param r Right operand
+	/// @return Comparison result mask
+	FORCEINLINE CONST m128i8 mm_cmpgt_epi8(m128i8 l, m128i8 r)
+	{
+		m128i8 result = {};
+
+#ifdef PS2INTRIN_UNSAFE
+		asm(
+			"pcgtb	%[Result],%[Left],%[Right]"
+			: [Result] "=r" (result.v)
+			: [Left] "%r" (l.v),
+			  [Right] "r" (r.v)
+		);
+#elif defined(PS2INTRIN_HOST)
+		int8_t left[16];
+		int8_t right[16];
+		int8_t lanes[16];
+
+		memcpy(left, &l, sizeof(left));
+		memcpy(right, &r, sizeof(right));
+		for (int i = 0; i < 16; ++i)
+		{
+			lanes[i] = (int8_t)(left[i] > right[i] ? -1 : 0);
+		}
+		memcpy(&result, lanes, sizeof(lanes));
+#else
+		asm(
+			"pcpyld	%[LLo],%[LHi],%[LLo]\n\t"
+			"pcpyld	%[RLo],%[RHi],%[RLo]\n\t"
+			"pcgtb	%[ResultLo],%[LLo],%[RLo]\n\t"
+			"pcpyud	%[ResultHi],%[ResultLo],%[ResultLo]"
+			: [ResultLo] "=r" (result.lo),
+			  [ResultHi] "=&r" (result.hi)
+			: [LLo] "r" (l.lo),
+			  [LHi] "r" (l.hi),
+			  [RLo] "r" (r.lo),
+			  [RHi] "r" (r.hi)
+		);
+#endif
+
+		return result;
+	}
+
+	/// @brief PCGTB : Parallel Compare for Greater Than Byte
+	/// 
+	/// Compare 16 signed 8-bit value pairs for a less than relationship. Returns 0xFF for
+	/// pairs where the value in 'l' is true less than the value in 'r', and 0x00 otherwise.
+	/// 
+	/// Unsigned comparisons can be achieved by first adding '0x80' to every element in each
+	/// operand.
+	/// @param l Left operand
+	/// @param r Right operand
+	/// @return Comparison result mask
+	FORCEINLINE CONST m128i8 mm_cmplt_epi8(m128i8 l, m128i8 r)
+	{
+		return mm_cmpgt_epi8(r, l);
+	}
+
+	/// @brief PCGTB : Parallel Compare for Greater Than Byte
+	/// PNOR : Parallel NOR
+	/// 
+	/// Compare 16 signed 8-bit value pairs for a less than or equal relationship. Returns 0xFF
+	/// for pairs where the value in 'l' is less than or equal the value in 'r', and 0x00
+	/// otherwise.
+	/// 
+	/// Unsigned comparisons can be achieved by first adding '0x80' to every element in each
+	/// operand.
+	/// @param l Left operand
+	/// @param r Right operand
+	/// @return Comparison result mask
+	FORCEINLINE CONST m128i8 mm_cmple_epi8(m128i8 l, m128i8 r)
+	{
+		return mm_not_epi8(mm_cmpgt_epi8(l, r));
+	}
+
+	/// @brief PCGTB : Parallel Compare for Greater Than Byte
+	/// PNOR : Parallel NOR
+	/// 
+	/// Compare 16 signed 8-bit value pairs for a greater than or equal relationship. Returns 0xFF
+	/// for pairs where the value in 'l' is greater than or equal the value in 'r', and 0x00
+	/// otherwise.
+	/// 
+	/// Unsigned comparisons can be achieved by first adding '0x80' to every element in each
+	/// operand.
+	/// @param l Left operand
+	/// @param r Right operand
+	/// @return Comparison result mask
+	FORCEINLINE CONST m128i8 mm_cmpge_epi8(m128i8 l, m128i8 r)
+	{
+		return mm_not_epi8(mm_cmpgt_epi8(r, l));
+	}
+
+	/// @brief PCEQB : Parallel Compare for EQual Byte
+	/// 
+	/// Compare 16 8-bit value pairs for equality. On equality, return 0xFF for that value pair,
+	/// otherwise 0x00.
+	/// @param l First operand
+	/// @param r Second operand
+	/// @return Equality result mask
+	FORCEINLINE CONST m128u8 mm_cmpeq_epu8(m128u8 l, m128u8 r)
+	{
+		return mm_castepu8_epi8(mm_cmpeq_epi8(mm_castepi8_epu8(l), mm_castepi8_epu8(r)));
+	}
+
+	/// @brief PCEQB : Parallel Compare for EQual Byte
+	/// PNOR : Parallel NOR
+	/// 
+	/// Convenience function. Invert result of 'cmpeq'.
+	/// @param l First operand
+	/// @param r Second operand
+	/// @return Inverted equality result mask
+	FORCEINLINE CONST m128u8 mm_cmpneq_epu8(m128u8 l, m128u8 r)
+	{
+		return mm_not_epu8(mm_cmpeq_epu8(l, r));
+	}
+
+	/// @brief PCEQH : Parallel Compare for EQual Halfword
+	/// 
+	/// Compare 8 16-bit value pairs for equality. On equality, return 0xFFFF for that value pair,
+	/// otherwise 0x0000.
+	/// @param l First operand
+	/// @param r Second operand
+	/// @return Equality result mask
+	FORCEINLINE CONST m128i16 mm_cmpeq_epi16(m128i16 l, m128i16 r)
+	{
+		m128i16 result = {};
+
+#ifdef PS2INTRIN_UNSAFE
+		asm(
+			"pceqh	%[Result],%[Left],%[Right]"
+			: [Result] "=r" (result.v)
+			: [Left] "%r" (l.v),
+			  [Right] "r" (r.v)
+		);
+#elif defined(PS2INTRIN_HOST)
+		int16_t left[8];
+		int16_t right[8];
+		int16_t lanes[8];
+
+		memcpy(left, &l, sizeof(left));
+		memcpy(right, &r, sizeof(right));
+		for (int i = 0; i < 8; ++i)
+		{
+			lanes[i] = (int16_t)(left[i] == right[i] ? -1 : 0);
+		}
+		memcpy(&result, lanes, sizeof(lanes));
+#else
+		asm(
+			"pcpyld	%[LLo],%[LHi],%[LLo]\n\t"
+			"pcpyld	%[RLo],%[RHi],%[RLo]\n\t"
+			"pceqh	%[ResultLo],%[LLo],%[RLo]\n\t"
+			"pcpyud	%[ResultHi],%[ResultLo],%[ResultLo]"
+			: [ResultLo] "=r" (result.lo),
+			  [ResultHi] "=&r" (result.hi)
+			: [LLo] "r" (l.lo),
+			  [LHi] "r" (l.hi),
+			  [RLo] "r" (r.lo),
+			  [RHi] "r" (r.hi)
+		);
+#endif
+
+		return result;
+	}
+
+	/// @brief PCEQB : Parallel Compare for EQual Byte
+	/// PNOR : Parallel NOR
+	/// 
+	/// Convenience function. Invert result of 'cmpeq'.
+	/// @param l First operand
+	/// @param r Second operand
+	/// @return Inverted equality result mask
+	FORCEINLINE CONST m128i16 mm_cmpneq_epi16(m128i16 l, m128i16 r)
+	{
+		return mm_not_epi16(mm_cmpeq_epi16(l, r));
+	}
+
+	/// @brief PCGTH : Parallel Compare for Greater Than Halfword
+	/// 
+	/// Compare 8 signed 16-bit value pairs for a greater than relationship. Returns 0xFFFF for
+	/// pairs where the value in 'l' is true greater than the value in 'r', and 0x0000 otherwise.
+	/// 
+	/// Unsigned comparisons can be achieved by first adding '0x8000' to every element in each
+	/// operand.
+	/// @param l Left operand
+	/// @param r Right operand
+	/// @return Comparison result mask
+	FORCEINLINE CONST m128i16 mm_cmpgt_epi16(m128i16 l, m128i16 r)
+	{
+		m128i16 result = {};
+
+#ifdef PS2INTRIN_UNSAFE
+		asm(
+			"pcgth	%[Result],%[Left],%[Right]"
+			: [Result] "=r" (result.v)
+			: [Left] "%r" (l.v),
+			  [Right] "r" (r.v)
+		);
+#elif defined(PS2INTRIN_HOST)
+		int16_t left[8];
+		int16_t right[8];
+		int16_t lanes[8];
+
+		memcpy(left, &l, sizeof(left));
+		memcpy(right, &r, sizeof(right));
+		for (int i = 0; i < 8; ++i)
+		{
+			lanes[i] = (int16_t)(left[i] > right[i] ? -1 : 0);
+		}
+		memcpy(&result, lanes, sizeof(lanes));
+#else
+		asm(
+			"pcpyld	%[LLo],%[LHi],%[LLo]\n\t"
+			"pcpyld	%[RLo],%[RHi],%[RLo]\n\t"
+			"pcgth	%[ResultLo],%[LLo],%[RLo]\n\t"
+			"pcpyud	%[ResultHi],%[ResultLo],%[ResultLo]"
+			: [ResultLo] "=r" (result.lo),
+			  [ResultHi] "=&r" (result.hi)
+			: [LLo] "r" (l.lo),
+			  [LHi] "r" (l.hi),
+			  [RLo] "r" (r.lo),
+			  [RHi] "r" (r.hi)
+		);
+#endif
+
+		return result;
+	}
+
+	/// @brief PCGTH : Parallel Compare for Greater Than Halfword
+	/// 
+	/// Compare 8 signed 16-bit value pairs for a less than relationship. Returns 0xFFFF for
+	/// pairs where the value in 'l' is true less than the value in 'r', and 0x0000 otherwise.
+	/// 
+	/// Unsigned comparisons can be achieved by first adding '0x8000' to every element in each
+	/// operand.
+	/// @param l Left operand
+	/// @param r Right operand
+	/// @return Comparison result mask
+	FORCEINLINE CONST m128i16 mm_cmplt_epi16(m128i16 l, m128i16 r)
+	{
+		return mm_cmpgt_epi16(r, l);
+	}
+
+	/// @brief PCGTH : Parallel Compare for Greater Than Halfword
+	/// PNOR : Parallel NOR
+	/// 
+	/// Compare 8 signed 16-bit value pairs for a less than or equal relationship. Returns 0xFFFF
+	/// for pairs where the value in 'l' is less than or equal the value in 'r', and 0x0000
+	/// otherwise.
+	/// 
+	/// Unsigned comparisons can be achieved by first adding '0x8000' to every element in each
+	/// operand.
+	/// @param l Left operand
+	/// @param r Right operand
+	/// @return Comparison result mask
+	FORCEINLINE CONST m128i16 mm_cmple_epi16(m128i16 l, m128i16 r)
+	{
+		return mm_not_epi16(mm_cmpgt_epi16(l, r));
+	}
+
+	/// @brief PCGTH : Parallel Compare for Greater Than Halfword
+	/// PNOR : Parallel NOR
+	/// 
+	/// Compare 8 signed 16-bit value pairs for a greater than or equal relationship. Returns 0xFFFF
+	/// for pairs where the value in 'l' is greater than or equal the value in 'r', and 0x0000
+	/// otherwise.
+	/// 
+	/// Unsigned comparisons can be achieved by first adding '0x8000' to every element in each
+	/// operand.
+	/// @param l Left operand
+	/// @param r Right operand
+	/// @return Comparison result mask
+	FORCEINLINE CONST m128i16 mm_cmpge_epi16(m128i16 l, m128i16 r)
+	{
+		return mm_not_epi16(mm_cmpgt_epi16(r, l));
+	}
+
+	/// @brief PCEQH : Parallel Compare for EQual Halfword
+	/// 
+	/// Compare 8 16-bit value pairs for equality. On equality, return 0xFFFF for that value pair,
+	/// otherwise 0x0000.
+	/// @param l First operand
+	/// @param r Second operand
+	/// @return Equality result mask
+	FORCEINLINE CONST m128u16 mm_cmpeq_epu16(m128u16 l, m128u16 r)
+	{
+		return mm_castepu16_epi16(mm_cmpeq_epi16(mm_castepi16_epu16(l), mm_castepi16_epu16(r)));
+	}
+
+	/// @brief PCEQB : Parallel Compare for EQual Byte
+	/// PNOR : Parallel NOR
+	/// 
+	/// Convenience function. Invert result of 'cmpeq'.
+	/// @param l First operand
+	/// @param r Second operand
+	/// @return Inverted equality result mask
+	FORCEINLINE CONST m128u16 mm_cmpneq_epu16(m128u16 l, m128u16 r)
+	{
+		return mm_not_epu16(mm_cmpeq_epu16(l, r));
+	}
+
+	/// @brief PCEQW : Parallel Compare for EQual Word
+	/// 
+	/// Compare 4 32-bit value pairs for equality. On equality, return 0xFFFFFFFF for that value
+	/// pair, otherwise 0x00000000.
+	/// @param l First operand
+	/// @param r Second operand
+	/// @return Equality result mask
+	FORCEINLINE CONST m128i32 mm_cmpeq_epi32(m128i32 l, m128i32 r)
+	{
+		m128i32 result = {};
+
+#ifdef PS2INTRIN_UNSAFE
+		asm(
+			"pceqw	%[Result],%[Left],%[Right]"
+			: [Result] "=r" (result.v)
+			: [Left] "%r" (l.v),
+			  [Right] "r" (r.v)
+		);
+#elif defined(PS2INTRIN_HOST)
+		int32_t left[4];
+		int32_t right[4];
+		int32_t lanes[4];
+
+		memcpy(left, &l, sizeof(left));
+		memcpy(right, &r, sizeof(right));
+		for (int i = 0; i < 4; ++i)
+		{
+			lanes[i] = (int32_t)(left[i] == right[i] ? -1 : 0);
+		}
+		memcpy(&result, lanes, sizeof(lanes));
+#else
+		asm(
+			"pcpyld	%[LLo],%[LHi],%[LLo]\n\t"
+			"pcpyld	%[RLo],%[RHi],%[RLo]\n\t"
+			"pceqw	%[ResultLo],%[LLo],%[RLo]\n\t"
+			"pcpyud	%[ResultHi],%[ResultLo],%[ResultLo]"
+			: [ResultLo] "=r" (result.lo),
+			  [ResultHi] "=&r" (result.hi)
+			: [LLo] "r" (l.lo),
+			  [LHi] "r" (l.hi),
+			  [RLo] "r" (r.lo),
+			  [RHi] "r" (r.hi)
+		);
+#endif
+
+		return result;
+	}
+
+	/// @brief PCEQB : Parallel Compare for EQual Byte
+	/// PNOR : Parallel NOR
+	/// 
+	/// Convenience function. Invert result of 'cmpeq'.
+	/// @param l First operand
+	/// @param r Second operand
+	/// @return Inverted equality result mask
+	FORCEINLINE CONST m128i32 mm_cmpneq_epi32(m128i32 l, m128i32 r)
+	{
+		return mm_not_epi32(mm_cmpeq_epi32(l, r));
+	}
+
+	/// @brief PCGTW : Parallel Compare for Greater Than Word
+	/// 
+	/// Compare 4 signed 32-bit value pairs for a greater than relationship. Returns 0xFFFFFFFF
+	/// for pairs where the value in 'l' is true greater than the value in 'r', and 0x00000000
+	/// otherwise.
+	/// 
+	/// Unsigned comparisons can be achieved by first adding '0x80000000' to every element in each
+	/// operand.
+	/// @param l Left operand
+	/// @param r Right operand
+	/// @return Comparison result mask
+	FORCEINLINE CONST m128i32 mm_cmpgt_epi32(m128i32 l, m128i32 r)
+	{
+		m128i32 result = {};
+
+#ifdef PS2INTRIN_UNSAFE
+		asm(
+			"pcgtw	%[Result],%[Left],%[Right]"
+			: [Result] "=r" (result.v)
+			: [Left] "%r" (l.v),
+			  [Right] "r" (r.v)
+		);
+#elif defined(PS2INTRIN_HOST)
+		int32_t left[4];
+		int32_t right[4];
+		int32_t lanes[4];
+
+		memcpy(left, &l, sizeof(left));
+		memcpy(right, &r, sizeof(right));
+		for (int i = 0; i < 4; ++i)
+		{
+			lanes[i] = (int32_t)(left[i] > right[i] ? -1 : 0);
+		}
+		memcpy(&result, lanes, sizeof(lanes));
+#else
+		asm(
+			"pcpyld	%[LLo],%[LHi],%[LLo]\n\t"
+			"pcpyld	%[RLo],%[RHi],%[RLo]\n\t"
+			"pcgtw	%[ResultLo],%[LLo],%[RLo]\n\t"
+			"pcpyud	%[ResultHi],%[ResultLo],%[ResultLo]"
+			: [ResultLo] "=r" (result.lo),
+			  [ResultHi] "=&r" (result.hi)
+			: [LLo] "r" (l.lo),
+			  [LHi] "r" (l.hi),
+			  [RLo] "r" (r.lo),
+			  [RHi] "r" (r.hi)
+		);
+#endif
+
+		return result;
+	}
+
+	/// @brief PCGTW : Parallel Compare for Greater Than Word
+	/// 
+	/// Compare 4 signed 32-bit value pairs for a less than relationship. Returns 0xFFFFFFFF for
+	/// pairs where the value in 'l' is true less than the value in 'r', and 0x00000000 otherwise.
+	/// 
+	/// Unsigned comparisons can be achieved by first adding '0x80000000' to every element in each
+	/// operand.
+	/// @param l Left operand
+	/// @param r Right operand
+	/// @return Comparison result mask
+	FORCEINLINE CONST m128i32 mm_cmplt_epi32(m128i32 l, m128i32 r)
+	{
+		return mm_cmpgt_epi32(r, l);
+	}
+
+	/// @brief PCGTW : Parallel Compare for Greater Than Word
+	/// PNOR : Parallel NOR
+	/// 
+	/// Compare 4 signed 32-bit value pairs for a less than or equal relationship. Returns
+	/// 0xFFFFFFFF for pairs where the value in 'l' is less than or equal the value in 'r', and
+	/// 0x00000000 otherwise.
+	/// 
+	/// Unsigned comparisons can be achieved by first adding '0x80000000' to every element in each
+	/// operand.
+	/// @param l Left operand
+	/// @param r Right operand
+	/// @return Comparison result mask
+	FORCEINLINE CONST m128i32 mm_cmple_epi32(m128i32 l, m128i32 r)
+	{
+		return mm_not_epi32(mm_cmpgt_epi32(l, r));
+	}
+
+	/// @brief PCGTW : Parallel Compare for Greater Than Word
+	/// PNOR : Parallel NOR
+	/// 
+	/// Compare 4 signed 32-bit value pairs for a greater than or equal relationship. Returns
+	/// 0xFFFFFFFF for pairs where the value in 'l' is greater than or equal the value in 'r', and
+	/// 0x00000000 otherwise.
+	/// 
+	/// Unsigned comparisons can be achieved by first adding '0x80000000' to every element in each
+	/// operand.
+	/// @param l Left operand
+	/// @param r Right operand
+	/// @return Comparison result mask
+	FORCEINLINE CONST m128i32 mm_cmpge_epi32(m128i32 l, m128i32 r)
+	{
+		return mm_not_epi32(mm_cmpgt_epi32(r, l));
+	}
+
+	/// @brief PCEQW : Parallel Compare for EQual Word
+	/// 
+	/// Compare 4 32-bit value pairs for equality. On equality, return 0xFFFFFFFF for that value
+	/// pair, otherwise 0x00000000.
+	/// @param l First operand
+	/// @param r Second operand
+	/// @return Equality result mask
+	FORCEINLINE CONST m128u32 mm_cmpeq_epu32(m128u32 l, m128u32 r)
+	{
+		return mm_castepu32_epi32(mm_cmpeq_epi32(mm_castepi32_epu32(l), mm_castepi32_epu32(r)));
+	}
+
+	/// @brief PCEQB : Parallel Compare for EQual Byte
+	/// PNOR : Parallel NOR
+	/// 
+	/// Convenience function. Invert result of 'cmpeq'.
+	/// @param l First operand
+	/// @param r Second operand
+	/// @return Inverted equality result mask
+	FORCEINLINE CONST m128u32 mm_cmpneq_epu32(m128u32 l, m128u32 r)
+	{
+		return mm_not_epu32(mm_cmpeq_epu32(l, r));
+	}
+
+#ifdef __cplusplus
+}
+#endif
+
+#include "detail/end.h"
@@ -0,0 +1,274 @@
+#pragma once
+
+/*
+* 
+* Template wrappers around the function macros.
+* 
+* It would be great to have a C++ wrapper around the Multimedia and VU0 instructions. That exists
+* in the form of 'std::simd' for C++26. The experimental version is already in GCC and works even
+* when compiling for PS2 but doesn't use the intrinsics. It would be great if someone could change
+* that instead of reimplementing 'std::simd' here.
+* 
+*/
+
+#include "common.h"
+#include "sa.h"
+#include "shift.h"
+
+#ifdef __cplusplus
+
+#include "detail/begin.h"
+
+// The module interface unit includes this header in its purview to export the templates.
+#ifdef PS2INTRIN_MODULE
+export
+#else
+namespace
+#endif
+{
+	/// @brief PREF : PREFetch
+	/// 
+	/// Prefetch data from memory to the cache.
+	/// 
+	/// Can set specific hint value. Only 0 is supported as this value, other values are
+	/// reserved. Possible values: [0, 32). Prefer using the function 'prefetch' instead.
+	/// 
+	/// Does nothing on uncached memory locations.
+	/// 
+	/// Not allowed on memory locations not present in the TLB. Not recently used pages may not
+	/// be present in the TLB, reducing effectiveness. Prefetch may not happen when the memory
+	/// bus is used.
+	/// @tparam Hint The hint value to use
+	/// @param ptr The address to prefetch
+	template <unsigned Hint>
+	FORCEINLINE void prefetch(void* ptr) noexcept
+	{
+		PREF(ptr, (Hint));
+	}
+
+	/// @brief MTSAB : Move byte count To Shift Amount register (Byte)
+	/// 
+	/// Set a byte shift count in the shift amount register.
+	/// 
+	/// The values of 'byte_amount' and 'FixedByteAmount' are XOR'ed together. The resulting value
+	/// is the amount of bytes 'byte_shift_logical_right' will shift by.
+	/// 
+	/// Allowable values for 'byte_amount' and 'FixedByteAmount' are [0,15]. Only the lower 4 bits
+	/// are used, others are ignored.
+	/// 
+	/// Use this if you require both the variable and constant values usable by the 'mtsab'
+	/// instruction. Otherwise, prefer the no argument overload if you only have a constant value
+	/// and non-template 'set_sa_8' if you only have a variable shift amount.
+	/// 
+	/// This function writes to global state (SA).
+	/// @tparam FixedByteAmount The compile time constant byte-amount to set up the shift amount
+	/// register for
+	/// @param state Additional state used in safe mode. May not be NULL.
+	/// @param byte_amount The variable byte-amount to set up the shift amount register for
+	template <unsigned FixedByteAmount>
+	FORCEINLINE void set_sa_8(sa_state_t* state, unsigned byte_amount) noexcept
+	{
+		MTSAB_BOTH(state, byte_amount, (FixedByteAmount));
+	}
+
+	/// @brief MTSAB : Move byte count To Shift Amount register (Byte)
+	/// 
+	/// Set a byte shift count in the shift amount register.
+	/// 
+	/// The 'FixedByteAmount' value is the amount of bytes 'byte_shift_logical_right' will shift by.
+	/// 
+	/// Allowable values for 'FixedByteAmount' are [0,15]. Only the lower 4 bits are used, others
+	/// are ignored.
+	/// 
+	/// Use this function if your shift amount is known at compile time. Using this function does not
+	/// use a general purpose register. Otherwise, prefer the overload with argument or non-template
+	/// overload.
+	/// 
+	/// This function writes to global state (SA).
+	/// @tparam FixedByteAmount The compile time constant byte-amount to set up the shift amount
+	/// register for
+	/// @param state Additional state used in safe mode. May not be NULL.
+	template <unsigned FixedByteAmount>
+	FORCEINLINE void set_sa_8(sa_state_t* state) noexcept
+	{
+		MTSAB_IMMEDIATE(state, (FixedByteAmount));
+	}
+
+	/// @brief MTSAH : Move halfword count To Shift Amount register (Halfword)
+	/// 
+	/// Set a halfword shift count in the shift amount register.
+	/// 
+	/// The values of 'halfword_amount' and 'FixedHalfwordAmount' are XOR'ed together. The
+	/// resulting value is the amount of halfwords 'byte_shift_logical_right' will shift by.
+	/// 
+	/// Allowable values for 'halfword_amount' and 'FixedHalfwordAmount' are [0,7]. Only the
+	/// lower 3 bits are used, others are ignored.
+	/// 
+	/// Use this function if you require both the variable and constant values usable by the
+	/// 'mtsah' instruction. Otherwise, prefer the no-argument overload if you only have a
+	/// constant value and the non-template overload if you only have a variable shift amount.
+	/// 
+	/// This function writes to global state (SA).
+	/// @tparam FixedHalfwordAmount The compile time constant halfword-amount to set up the shift
+	/// amount register for
+	/// @param state Additional state used in safe mode. May not be NULL.
+	/// @param halfword_amount The variable halfword-amount to set up the shift amount register
+	/// for
+	template <unsigned FixedHalfwordAmount>
+	FORCEINLINE void set_sa_16(sa_state_t* state, unsigned halfword_amount) noexcept
+	{
+		MTSAH_BOTH(state, halfword_amount, (FixedHalfwordAmount));
+	}
+
+	/// @brief MTSAH : Move halfword count To Shift Amount register (Halfword)
+	/// 
+	/// Set a halfword shift count in the shift amount register.
+	/// 
+	/// The 'FixedHalfwordAmount' value is the amount of halfwords 'byte_shift_logical_right'
+	/// will shift by.
+	/// 
+	/// Allowable values for 'immediate' are [0,7]. Only the lower 3 bits are used, others are
+	/// ignored.
+	/// 
+	/// Use this function if your shift amount is known at compile time. Using this function does
+	/// not use a general purpose register. Otherwise, prefer the overload with an argument or
+	/// the non-template overload.
+	/// 
+	/// This function writes to global state (SA).
+	/// @tparam FixedHalfwordAmount The compile time constant halfword-amount to set up the shift
+	/// amount register for
+	/// @param state Additional state used in safe mode. May not be NULL.
+	template <unsigned FixedHalfwordAmount>
+	FORCEINLINE void set_sa_16(sa_state_t* state) noexcept
+	{
+		MTSAH_IMMEDIATE(state, (FixedHalfwordAmount));
+	}
+
+	/// @brief PSLLH : Parallel Shift Left Logical Halfword
+	/// 
+	/// Logically left shift 16-bit values. Shifts in '0's into the lower bits.
+	/// @tparam ShiftAmount Amount of bits to shift the source value left. Must be in range [0, 15]
+	/// @param v Value to shift
+	/// @return Shifted values
+	template <unsigned ShiftAmount>
+	FORCEINLINE CONST m128i16 mm_sll_epi16(m128i16 v) noexcept
+	{
+		m128i16 result = {};
+
+		PSLLH(result, v, (ShiftAmount));
+
+		return result;
+	}
+
+	/// @brief PSLLH : Parallel Shift Left Logical Halfword
+	/// 
+	/// Logically left shift 16-bit values. Shifts in '0's into the lower bits.
+	/// @tparam ShiftAmount Amount of bits to shift the source value left. Must be in range [0, 15]
+	/// @param v Values to shift
+	/// @return Shifted values
+	template <unsigned ShiftAmount>
+	FORCEINLINE CONST m128u16 mm_sll_epu16(m128u16 v) noexcept
+	{
+		return mm_castepu16_epi16(mm_sll_epi16<ShiftAmount>(mm_castepi16_epu16(v)));
+	}
+
+	/// @brief PSLLW : Parallel Shift Left Logical Word
+	/// 
+	/// Logically left shift 32-bit values. Shifts in '0's into the lower bits.
+	/// @tparam ShiftAmount Amount of bits to shift the source value left. Must be in range [0, 31]
+	/// @param v Values to shift
+	/// @return Shifted values
+	template <unsigned ShiftAmount>
+	FORCEINLINE CONST m128i32 mm_sll_epi32(m128i32 v) noexcept
+	{
+		m128i32 result = {};
+
+		PSLLW(result, v, (ShiftAmount));
+
+		return result;
+	}
+
+	/// @brief PSLLW : Parallel Shift Left Logical Word
+	/// 
+	/// Logically left shift 32-bit values. Shifts in '0's into the lower bits.
+	/// @tparam ShiftAmount Amount of bits to shift the source value left. Must be in range [0, 31]
+	/// @param v Values to shift
+	/// @return Shifted values
+	template <unsigned ShiftAmount>
+	FORCEINLINE CONST m128u32 mm_sll_epu32(m128u32 v) noexcept
+	{
+		return mm_castepu32_epi32(mm_sll_epi32<ShiftAmount>(mm_castepi32_epu32(v)));
+	}
+
+	/// @brief PSRAH : Parallel Shift Right Arithmetic Halfword
+	/// 
+	/// Arithmetically right shift 16-bit values. Shifts in sign bits into the upper bits.
+	/// @tparam ShiftAmount Amount of bits to shift the source value right. Must be in range
+	/// [0, 15]
+	/// @param v Values to shift
+	/// @return Shifted values
+	template <unsigned ShiftAmount>
+	FORCEINLINE CONST m128i16 mm_sra_epi16(m128i16 v) noexcept
+	{
+		m128i16 result = {};
+
+		PSRAH(result, v, (ShiftAmount));
+
+		return result;
+	}
+
+	/// @brief PSRAW : Parallel Shift Right Arithmetic Word
+	/// 
+	/// Arithmetically right shift 32-bit values. Shifts in sign bits into the upper bits.
+	/// @tparam ShiftAmount Amount of bits to shift the source value right. Must be in range
+	/// [0, 31]
+	/// @param v Values to shift
+	/// @return Shifted values
+	template <unsigned ShiftAmount>
+	FORCEINLINE CONST m128i32 mm_sra_epi32(m128i32 v) noexcept
+	{
+		m128i32 result = {};
+
+		PSRAW(result, v, (ShiftAmount));
+
+		return result;
+	}
+
+	/// @brief PSRLH : Parallel Shift Right Logical Halfword
+	/// 
+	/// Logically right shift 16-bit values. Shifts in '0's into the upper bits.
+	/// @tparam ShiftAmount Amount of bits to shift the source value right. Must be in range
+	/// [0, 15]
+	/// @param v Values to shift
+	/// @return Shifted values
+	template <unsigned ShiftAmount>
+	FORCEINLINE CONST m128u16 mm_srl_epu16(m128i16 v) noexcept
+	{
+		m128u16 result = {};
+
+		PSRLH(result, v, (ShiftAmount));
+
+		return result;
+	}
+
+	/// @brief PSRLW : Parallel Shift Right Logical Word
+	/// 
+	/// Logically right shift 32-bit values. Shifts in '0's into the upper bits.
+	/// @tparam ShiftAmount Amount of bits to shift the source value right. Must be in range
+	/// [0, 31]
+	/// @param v Values to shift
+	/// @return Shifted values
+	template <unsigned ShiftAmount>
+	FORCEINLINE CONST m128u32 mm_srl_epu32(m128u32 v) noexcept
+	{
+		m128u32 result = {};
+
+		PSRLW(result, v, (ShiftAmount));
+
+		return result;
+	}
+}
+
+#include "detail/end.h"
+
+#endif
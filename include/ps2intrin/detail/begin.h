@@ -0,0 +1,66 @@
+/*
+*	Helper macros for the ps2intrin headers. Every header includes this file after its own
+*	dependencies and 'end.h' at its end, so the macros never leak into user code. Deliberately not
+*	include guarded.
+*/
+
+// This is mostly here to make working with IntelliSense easier.
+#if defined(_MSC_VER)
+#define FORCEINLINE __forceinline inline
+#define CONST __declspec(noalias)
+#define UNSEQUENCED __declspec(noalias)
+#define PURE __declspec(noalias)
+#define REPRODUCIBLE __declspec(noalias)
+#define ALIGNAS16 __declspec(align(16))
+#define DECLAREVECTOR_SAFE(base, name) typedef __declspec(align(16)) struct { uint64_t lo; uint64_t hi; } name
+#define DECLAREVECTOR_UNSAFE(base, name) typedef __declspec(align(16)) struct { uint64_t v; } name
+#define MODE_TI
+#elif defined(__GNUC__)
+// Always inline this function into the caller. Must be both
+// '(always_inline)' and 'inline' to guarantee inlining, as per gcc warning.
+#define FORCEINLINE __attribute__ ((always_inline)) inline
+// This function only reads arguments and returns a value.
+#define CONST __attribute__ ((const))
+// This function only reads arguments, returns a value and reads or writes memory through pointers
+// in function arguments.
+#if __has_attribute(unsequenced)
+#define UNSEQUENCED __attribute__ ((unsequenced))
+#else
+#define UNSEQUENCED
+#endif
+// This function only reads arguments, global state and returns a value.
+#define PURE __attribute__ ((pure))
+// This function only reads arguments, global state, returns a value and reads or writes memory
+// through pointers in function arguments.
+#if __has_attribute(reproducible)
+#define REPRODUCIBLE __attribute__ ((reproducible))
+#else
+#define REPRODUCIBLE
+#endif
+// This type must be aligned to a 16-byte boundary
+#define ALIGNAS16 __attribute__ ((aligned(16)))
+// In unsafe mode any 16-byte vector actually uses a struct with a single uint64_t in it. This
+// ensures 16 byte size and alignment, but means an additional (zero) register has to be used.
+#define DECLAREVECTOR_UNSAFE(base, name) typedef struct { uint64_t v; } __attribute__ ((aligned(16))) name
+// In safe mode any 16-byte vector uses a struct of 2 uint64_t to be able to name both the upper and
+// lower 8 bytes.
+#define DECLAREVECTOR_SAFE(base, name) typedef struct { uint64_t lo; uint64_t hi; } __attribute__ ((aligned(16))) name
+// Integer size of 128 bits specifier
+#define MODE_TI __attribute__((mode(TI)))
+#else
+#warning "Could not determine 'always_inline' analog for current compiler"
+#define FORCEINLINE
+#define CONST
+#define UNSEQUENCED
+#define PURE
+#define REPRODUCIBLE
+#define ALIGNAS16
+#define DECLAREVECTOR(base, name) typedef struct { uint64_t lo; uint64_t hi; } name
+#define MODE_TI
+#endif
+
+#ifdef PS2INTRIN_UNSAFE
+#define DECLAREVECTOR DECLAREVECTOR_UNSAFE
+#else
+#define DECLAREVECTOR DECLAREVECTOR_SAFE
+#endif
@@ -0,0 +1,14 @@
+/*
+*	Undefines the helper macros defined by 'begin.h'.
+*/
+
+#undef FORCEINLINE
+#undef CONST
+#undef UNSEQUENCED
+#undef PURE
+#undef REPRODUCIBLE
+#undef ALIGNAS16
+#undef DECLAREVECTOR_UNSAFE
+#undef DECLAREVECTOR_SAFE
+#undef DECLAREVECTOR
+#undef MODE_TI
@@ -0,0 +1,285 @@
+#pragma once
+
+/*
+*	Round-robin executor for interleaving independent kernels at long-latency operations.
+*
+*	The EE Core has a single divider and a single multiplier per pipeline. Code waiting for the
+*	result of e.g. 'divrem1_i32_start' or 'mm_divrem_epi64' stalls unless independent work can
+*	be placed in between, which otherwise means merging the loops of two kernels by hand.
+*	Written as C++20 coroutines, kernels suspend with 'co_await yield_point' right after
+*	starting such an operation and the executor resumes the next kernel in the meantime.
+*
+*	Coroutine frames come from a caller-provided 'frame_arena'; nothing is allocated on the heap.
+*	Requires coroutine support ('__cpp_impl_coroutine'), otherwise this header is empty.
+*/
+
+#include <stddef.h>
+#include <stdint.h>
+
+#if defined(__cplusplus) && defined(__cpp_impl_coroutine)
+
+#include <coroutine>
+
+#include "detail/begin.h"
+
+#ifdef PS2INTRIN_MODULE
+export
+#else
+namespace
+#endif
+{
+	/// @brief Fixed memory region coroutine frames are allocated from
+	///
+	/// Allocation bumps a pointer. The memory is reused once every frame allocated from it has
+	/// been freed. Frames are 16-byte aligned so they can hold the 'm128*' types.
+	class frame_arena
+	{
+	public:
+		/// @param memory Memory to allocate frames from, must stay valid while frames exist
+		/// @param size Size of 'memory' in bytes
+		frame_arena(void* memory, size_t size) noexcept
+			: begin(align((uintptr_t)memory)), end((uintptr_t)memory + size), top(begin)
+		{
+		}
+
+		frame_arena(const frame_arena&) = delete;
+		frame_arena& operator=(const frame_arena&) = delete;
+
+		/// @brief Allocate 'size' bytes
+		/// @return The allocation or nullptr if the arena is exhausted
+		void* allocate(size_t size) noexcept
+		{
+			uintptr_t next = align(top + size);
+			if (next > end || next < top)
+			{
+				return nullptr;
+			}
+
+			void* result = (void*)top;
+			top = next;
+			++live;
+			return result;
+		}
+
+		/// @brief Free an allocation. The memory is reused when the last allocation is freed.
+		void deallocate(void*) noexcept
+		{
+			if (--live == 0)
+			{
+				top = begin;
+			}
+		}
+
+		/// @brief Bytes currently allocated
+		size_t used() const noexcept { return top - begin; }
+
+	private:
+		static uintptr_t align(uintptr_t address) noexcept { return (address + 15) & ~(uintptr_t)15; }
+
+		uintptr_t begin;
+		uintptr_t end;
+		uintptr_t top;
+		size_t live = 0;
+	};
+
+	/// @brief Suspension point after starting a long-latency operation
+	///
+	/// 'co_await yield_point;' lets the executor run the other kernels before the result of the
+	/// operation is read.
+	struct yield_point_t
+	{
+		constexpr bool await_ready() const noexcept { return false; }
+		constexpr void await_suspend(std::coroutine_handle<>) const noexcept {}
+		constexpr void await_resume() const noexcept {}
+	};
+
+	inline constexpr yield_point_t yield_point{};
+
+	/// @brief Kernel coroutine run by 'round_robin_executor'
+	///
+	/// A function returning 'kernel_task' must take a 'frame_arena&' as its first parameter,
+	/// which its frame is allocated from. If the arena is exhausted the returned task is empty
+	/// and 'round_robin_executor::spawn' rejects it. The kernel does not start running before it
+	/// is spawned.
+	///
+	///		kernel_task normalize(frame_arena&, int32_t* values, int32_t divisor, size_t count)
+	///		{
+	///			lohi_state_t state;
+	///			lohi_state_construct(&state);
+	///			for (size_t i = 0; i < count; ++i)
+	///			{
+	///				divrem1_i32_start(&state, values[i], divisor);
+	///				co_await yield_point;
+	///				values[i] = divrem1_i32_finish(&state).quotient;
+	///			}
+	///			lohi_state_destruct(&state);
+	///		}
+	///
+	/// Kernels are only switched at 'co_await', so a kernel sees the LO/HI/SA registers the way
+	/// it left them as long as the other kernels do not touch the same registers. In safe mode
+	/// every kernel keeps its own state anyway. In unsafe mode, kernels that are interleaved
+	/// must use different registers across their suspension points, e.g. one the operations
+	/// of pipeline 0 and the other those of pipeline 1.
+	class kernel_task
+	{
+	public:
+		struct promise_type
+		{
+			template <typename... Args>
+			static void* operator new(size_t size, frame_arena& arena, Args&...) noexcept
+			{
+				// The arena is stored in front of the frame for 'operator delete'.
+				uint8_t* memory = (uint8_t*)arena.allocate(size + 16);
+				if (!memory)
+				{
+					return nullptr;
+				}
+				*(frame_arena**)memory = &arena;
+				return memory + 16;
+			}
+
+			static void operator delete(void* frame, size_t) noexcept
+			{
+				uint8_t* memory = (uint8_t*)frame - 16;
+				(*(frame_arena**)memory)->deallocate(memory);
+			}
+
+			static kernel_task get_return_object_on_allocation_failure() noexcept { return kernel_task(); }
+
+			kernel_task get_return_object() noexcept
+			{
+				return kernel_task(std::coroutine_handle<promise_type>::from_promise(*this));
+			}
+
+			std::suspend_always initial_suspend() const noexcept { return {}; }
+			std::suspend_always final_suspend() const noexcept { return {}; }
+			void return_void() const noexcept {}
+			void unhandled_exception() const noexcept { __builtin_trap(); }
+		};
+
+		kernel_task() noexcept = default;
+
+		kernel_task(kernel_task&& other) noexcept : handle(other.handle)
+		{
+			other.handle = nullptr;
+		}
+
+		kernel_task& operator=(kernel_task&& other) noexcept
+		{
+			if (this != &other)
+			{
+				if (handle)
+				{
+					handle.destroy();
+				}
+				handle = other.handle;
+				other.handle = nullptr;
+			}
+			return *this;
+		}
+
+		~kernel_task()
+		{
+			if (handle)
+			{
+				handle.destroy();
+			}
+		}
+
+		/// @brief false if the frame could not be allocated
+		explicit operator bool() const noexcept { return (bool)handle; }
+
+		/// @brief Release ownership of the coroutine
+		std::coroutine_handle<promise_type> release() noexcept
+		{
+			std::coroutine_handle<promise_type> result = handle;
+			handle = nullptr;
+			return result;
+		}
+
+	private:
+		explicit kernel_task(std::coroutine_handle<promise_type> handle) noexcept : handle(handle) {}
+
+		std::coroutine_handle<promise_type> handle;
+	};
+
+	/// @brief Runs up to 'Capacity' kernels, switching between them at every suspension point
+	///
+	/// The kernels are resumed in the order they were spawned. Finished kernels are removed and
+	/// destroyed, which returns their frames to the arena.
+	/// @tparam Capacity Maximum number of kernels spawned at a time
+	template <size_t Capacity>
+	class round_robin_executor
+	{
+	public:
+		round_robin_executor() noexcept = default;
+		round_robin_executor(const round_robin_executor&) = delete;
+		round_robin_executor& operator=(const round_robin_executor&) = delete;
+
+		~round_robin_executor()
+		{
+			for (size_t i = 0; i < count; ++i)
+			{
+				kernels[i].destroy();
+			}
+		}
+
+		/// @brief Add a kernel
+		/// @return false if 'task' is empty or 'Capacity' kernels are already running. 'task' is
+		/// left untouched in that case.
+		bool spawn(kernel_task& task) noexcept
+		{
+			if (!task || count == Capacity)
+			{
+				return false;
+			}
+			kernels[count++] = task.release();
+			return true;
+		}
+
+		bool spawn(kernel_task&& task) noexcept
+		{
+			return spawn(task);
+		}
+
+		/// @brief Resume every kernel once, in order
+		/// @return true if kernels remain
+		bool step() noexcept
+		{
+			size_t kept = 0;
+			for (size_t i = 0; i < count; ++i)
+			{
+				kernels[i].resume();
+				if (kernels[i].done())
+				{
+					kernels[i].destroy();
+				}
+				else
+				{
+					kernels[kept++] = kernels[i];
+				}
+			}
+			count = kept;
+			return count != 0;
+		}
+
+		/// @brief Run until every kernel has finished
+		void run() noexcept
+		{
+			while (step())
+			{
+			}
+		}
+
+		/// @brief Number of kernels not finished yet
+		size_t size() const noexcept { return count; }
+
+	private:
+		std::coroutine_handle<kernel_task::promise_type> kernels[Capacity];
+		size_t count = 0;
+	};
+}
+
+#include "detail/end.h"
+
+#endif
@@ -0,0 +1,454 @@
+#pragma once
+
+/*
+*	128-bit integer arithmetic on register pairs: add/subtract with carry, shifts, comparisons,
+*	64x64 to 128-bit multiplication on both multipliers and 128/64-bit division.
+*
+*	'int128_t'/'uint128_t' values are reassembled with shifts and ORs whenever they cross a
+*	function, and their multiplication and division fall back to generic libgcc code. The
+*	'pair_*128_t' types keep the two 64-bit halves in separate registers instead, and
+*	'mm_load_pair_u128'/'mm_store_pair_u128' move them to and from memory with LQ/SQ directly.
+*/
+
+#include "common.h"
+#include "muldiv.h"
+#include "arithmetic.h"
+
+#include "detail/begin.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+	/// @brief Unsigned 128-bit integer as two 64-bit halves
+	typedef struct
+	{
+		uint64_t lo;
+		uint64_t hi;
+	} pair_u128_t;
+
+	/// @brief Signed 128-bit integer as two 64-bit halves, the high half carrying the sign
+	typedef struct
+	{
+		uint64_t lo;
+		int64_t hi;
+	} pair_i128_t;
+
+	/// @brief Result type of unsigned 128/64-bit division with remainder
+	typedef struct
+	{
+		pair_u128_t quotient;
+		uint64_t remainder;
+	} divrem_u128_result_t;
+
+	// Conversions
+
+	/// @brief Build a 'pair_u128_t' from its halves.
+	/// @param hi High 64 bits
+	/// @param lo Low 64 bits
+	/// @return Combined value
+	FORCEINLINE CONST pair_u128_t pair_set_u128(uint64_t hi, uint64_t lo)
+	{
+		pair_u128_t result = { lo, hi };
+
+		return result;
+	}
+
+	/// @brief Split a 'uint128_t' into its halves.
+	/// @param v Value to split
+	/// @return Value as a pair
+	FORCEINLINE CONST pair_u128_t pair_from_u128(uint128_t v)
+	{
+		return pair_set_u128((uint64_t)(v >> 64), (uint64_t)v);
+	}
+
+	/// @brief Combine the halves of a pair into a 'uint128_t'.
+	/// @param v Value to combine
+	/// @return Value as a 'uint128_t'
+	FORCEINLINE CONST uint128_t pair_to_u128(pair_u128_t v)
+	{
+		uint128_t result = v.hi;
+		result <<= 64;
+		result |= v.lo;
+
+		return result;
+	}
+
+	/// @brief No-op conversion of a signed pair to an unsigned pair.
+	/// @param v Value to convert
+	/// @return Same bits as an unsigned pair
+	FORCEINLINE CONST pair_u128_t pair_castu128_i128(pair_i128_t v)
+	{
+		pair_u128_t result = { v.lo, (uint64_t)v.hi };
+
+		return result;
+	}
+
+	/// @brief No-op conversion of an unsigned pair to a signed pair.
+	/// @param v Value to convert
+	/// @return Same bits as a signed pair
+	FORCEINLINE CONST pair_i128_t pair_casti128_u128(pair_u128_t v)
+	{
+		pair_i128_t result = { v.lo, (int64_t)v.hi };
+
+		return result;
+	}
+
+	// Loads and stores
+
+	/// @brief LQ : Load Quadword
+	/// 
+	/// Load 1 unsigned 128-bit integer from memory into a pair of registers.
+	/// 
+	/// The memory location must aligned on a 16-byte boundary. Otherwise the next 16-byte boundary
+	/// below the given memory location is used instead, loading unintended values.
+	/// 
+	/// This function reads global state (*'p')
+	/// @param p Memory location to load integer data from.
+	/// @return Value as a pair.
+	FORCEINLINE UNSEQUENCED pair_u128_t mm_load_pair_u128(const uint128_t* p)
+	{
+		pair_u128_t result = { 0, 0 };
+
+#ifdef PS2INTRIN_HOST
+		memcpy(&result, (const void*)((uintptr_t)p & ~(uintptr_t)15), sizeof(result));
+#else
+		asm(
+			"lq	%[ResultLo],%[Address]\n\t"
+			"pcpyud	%[ResultHi],%[ResultLo],%[ResultLo]"
+			: [ResultLo] "=r" (result.lo),					/*	output operands	*/
+			  [ResultHi] "=r" (result.hi)
+			: [Address] "o" (*(const char (*)[16]) p)		/*	input operands	Tell GCC that this is
+																	reading 16 bytes from *address	*/
+		);
+#endif
+
+		return result;
+	}
+
+	/// @brief SQ : Store Quadword
+	/// 
+	/// Store 1 unsigned 128-bit integer from a pair of registers to memory.
+	/// 
+	/// The memory location must aligned on a 16-byte boundary. Otherwise the next 16-byte boundary
+	/// below the given memory location is used instead, storing to an unintended address.
+	/// 
+	/// This function writes to global state (*'address')
+	/// @param p Address to store to.
+	/// @param value Value to store.
+	FORCEINLINE UNSEQUENCED void mm_store_pair_u128(uint128_t* p, pair_u128_t value)
+	{
+#ifdef PS2INTRIN_HOST
+		memcpy((void*)((uintptr_t)p & ~(uintptr_t)15), &value, sizeof(value));
+#else
+		asm(
+			"pcpyld	%[ValueLo],%[ValueHi],%[ValueLo]\n\t"
+			"sq	%[ValueLo],%[Address]"
+			: [Address] "=o" (*(char (*)[16]) p)			/*	output operands	Tell GCC that this is
+																writing 16 bytes to *address	*/
+			: [ValueLo] "r" (value.lo),						/*	input operands	*/
+			  [ValueHi] "r" (value.hi)
+		);
+#endif
+	}
+
+	// Addition and subtraction
+
+	/// @brief Add 128-bit integers with carry.
+	/// @param a First summand
+	/// @param b Second summand
+	/// @param carry Carry in, 0 or 1. Receives the carry out.
+	/// @return 'a + b + carry' modulo 2^128
+	FORCEINLINE pair_u128_t addc_u128(pair_u128_t a, pair_u128_t b, uint64_t* carry)
+	{
+		pair_u128_t result = { 0, 0 };
+		uint64_t lo = a.lo + *carry;
+		uint64_t carry_lo = lo < *carry;
+
+		result.lo = lo + b.lo;
+		carry_lo += result.lo < b.lo;
+
+		uint64_t hi = a.hi + carry_lo;
+		uint64_t carry_hi = hi < carry_lo;
+
+		result.hi = hi + b.hi;
+		*carry = carry_hi + (result.hi < b.hi);
+
+		return result;
+	}
+
+	/// @brief Add 128-bit integers, wrapping around.
+	/// @param a First summand
+	/// @param b Second summand
+	/// @return 'a + b' modulo 2^128
+	FORCEINLINE CONST pair_u128_t add_u128(pair_u128_t a, pair_u128_t b)
+	{
+		pair_u128_t result = { a.lo + b.lo, a.hi + b.hi };
+
+		result.hi += result.lo < b.lo;
+
+		return result;
+	}
+
+	/// @brief Subtract 128-bit integers with borrow.
+	/// @param a Minuend
+	/// @param b Subtrahend
+	/// @param borrow Borrow in, 0 or 1. Receives the borrow out.
+	/// @return 'a - b - borrow' modulo 2^128
+	FORCEINLINE pair_u128_t subb_u128(pair_u128_t a, pair_u128_t b, uint64_t* borrow)
+	{
+		pair_u128_t result = { 0, 0 };
+		uint64_t borrow_lo = (a.lo < b.lo) | ((a.lo - b.lo) < *borrow);
+
+		result.lo = a.lo - b.lo - *borrow;
+
+		uint64_t borrow_hi = (a.hi < b.hi) | ((a.hi - b.hi) < borrow_lo);
+
+		result.hi = a.hi - b.hi - borrow_lo;
+		*borrow = borrow_hi;
+
+		return result;
+	}
+
+	/// @brief Subtract 128-bit integers, wrapping around.
+	/// @param a Minuend
+	/// @param b Subtrahend
+	/// @return 'a - b' modulo 2^128
+	FORCEINLINE CONST pair_u128_t sub_u128(pair_u128_t a, pair_u128_t b)
+	{
+		pair_u128_t result = { a.lo - b.lo, a.hi - b.hi };
+
+		result.hi -= a.lo < b.lo;
+
+		return result;
+	}
+
+	// Shifts
+
+	/// @brief Shift a 128-bit integer left, shifting in zeros.
+	/// @param v Value to shift
+	/// @param amount Amount of bits, [0, 127]
+	/// @return Shifted value
+	FORCEINLINE CONST pair_u128_t sll_u128(pair_u128_t v, unsigned amount)
+	{
+		pair_u128_t result = { 0, 0 };
+
+		if (amount >= 64)
+		{
+			result.hi = v.lo << (amount - 64);
+		}
+		else if (amount > 0)
+		{
+			result.lo = v.lo << amount;
+			result.hi = (v.hi << amount) | (v.lo >> (64 - amount));
+		}
+		else
+		{
+			result = v;
+		}
+
+		return result;
+	}
+
+	/// @brief Shift a 128-bit integer right, shifting in zeros.
+	/// @param v Value to shift
+	/// @param amount Amount of bits, [0, 127]
+	/// @return Shifted value
+	FORCEINLINE CONST pair_u128_t srl_u128(pair_u128_t v, unsigned amount)
+	{
+		pair_u128_t result = { 0, 0 };
+
+		if (amount >= 64)
+		{
+			result.lo = v.hi >> (amount - 64);
+		}
+		else if (amount > 0)
+		{
+			result.lo = (v.lo >> amount) | (v.hi << (64 - amount));
+			result.hi = v.hi >> amount;
+		}
+		else
+		{
+			result = v;
+		}
+
+		return result;
+	}
+
+	/// @brief Shift a signed 128-bit integer right, shifting in copies of the sign bit.
+	/// @param v Value to shift
+	/// @param amount Amount of bits, [0, 127]
+	/// @return Shifted value
+	FORCEINLINE CONST pair_i128_t sra_i128(pair_i128_t v, unsigned amount)
+	{
+		pair_i128_t result = { 0, v.hi >> 63 };
+
+		if (amount >= 64)
+		{
+			result.lo = (uint64_t)(v.hi >> (amount - 64));
+		}
+		else if (amount > 0)
+		{
+			result.lo = (v.lo >> amount) | ((uint64_t)v.hi << (64 - amount));
+			result.hi = v.hi >> amount;
+		}
+		else
+		{
+			result = v;
+		}
+
+		return result;
+	}
+
+	// Comparisons
+
+	/// @brief Compare 128-bit integers for equality.
+	/// @return Whether 'a' and 'b' are equal
+	FORCEINLINE CONST int cmpeq_u128(pair_u128_t a, pair_u128_t b)
+	{
+		return ((a.lo ^ b.lo) | (a.hi ^ b.hi)) == 0;
+	}
+
+	/// @brief Compare unsigned 128-bit integers.
+	/// @return Whether 'a' is less than 'b'
+	FORCEINLINE CONST int cmplt_u128(pair_u128_t a, pair_u128_t b)
+	{
+		return a.hi < b.hi || (a.hi == b.hi && a.lo < b.lo);
+	}
+
+	/// @brief Compare signed 128-bit integers.
+	/// @return Whether 'a' is less than 'b'
+	FORCEINLINE CONST int cmplt_i128(pair_i128_t a, pair_i128_t b)
+	{
+		return a.hi < b.hi || (a.hi == b.hi && a.lo < b.lo);
+	}
+
+	// Multiplication
+
+	/// @brief MULTU/MULTU1 : MULTiply Unsigned word on both pipelines
+	/// 
+	/// Multiply 64-bit unsigned integers into a 128-bit product from four 32-bit partial products,
+	/// two on each pipeline.
+	/// 
+	/// This function writes to global state (LO0/HI0/LO1/HI1).
+	/// @param state Additional state used in safe mode. May not be NULL.
+	/// @param a First multiplicand
+	/// @param b Second multiplicand
+	/// @return Full product
+	FORCEINLINE pair_u128_t mul_u64(lohi_state_t* state, uint64_t a, uint64_t b)
+	{
+		uint32_t a0 = (uint32_t)a;
+		uint32_t a1 = (uint32_t)(a >> 32);
+		uint32_t b0 = (uint32_t)b;
+		uint32_t b1 = (uint32_t)(b >> 32);
+
+		// Both pipelines work while the other one's result is read.
+		uint32_t lo00 = mullo0_u32_start(state, a0, b0);
+		uint32_t lo01 = mullo1_u32_start(state, a0, b1);
+		mul_u32_result_t p00 = mul0_u32_finish_lo(state, lo00);
+		mul_u32_result_t p01 = mul1_u32_finish_lo(state, lo01);
+		uint32_t lo11 = mullo0_u32_start(state, a1, b1);
+		uint32_t lo10 = mullo1_u32_start(state, a1, b0);
+		mul_u32_result_t p11 = mul0_u32_finish_lo(state, lo11);
+		mul_u32_result_t p10 = mul1_u32_finish_lo(state, lo10);
+
+		// The middle column is below 3 * 2^32, so it fits with its carries.
+		uint64_t middle = (uint64_t)p00.hi + p01.lo + p10.lo;
+		pair_u128_t result = { 0, 0 };
+
+		result.lo = ((uint64_t)(uint32_t)middle << 32) | p00.lo;
+		result.hi = (((uint64_t)p11.hi << 32) | p11.lo) + p01.hi + p10.hi + (middle >> 32);
+
+		return result;
+	}
+
+	/// @brief MULTU/MULTU1 : MULTiply Unsigned word on both pipelines
+	/// 
+	/// Multiply 64-bit signed integers into a 128-bit product. See 'mul_u64'.
+	/// 
+	/// This function writes to global state (LO0/HI0/LO1/HI1).
+	/// @param state Additional state used in safe mode. May not be NULL.
+	/// @param a First multiplicand
+	/// @param b Second multiplicand
+	/// @return Full product
+	FORCEINLINE pair_i128_t mul_i64(lohi_state_t* state, int64_t a, int64_t b)
+	{
+		pair_u128_t product = mul_u64(state, (uint64_t)a, (uint64_t)b);
+
+		// The unsigned product counts a negative factor as 'factor + 2^64'.
+		product.hi -= (a < 0 ? (uint64_t)b : 0) + (b < 0 ? (uint64_t)a : 0);
+
+		return pair_casti128_u128(product);
+	}
+
+	// Division
+
+	/// @brief PLZCW : Parallel Leading Zero or one Count Word
+	/// 
+	/// Count the leading zero bits of a 64-bit integer.
+	/// @param v Value to count the leading zeros of
+	/// @return Number of leading zero bits, 64 for 0
+	FORCEINLINE CONST unsigned clz_u64(uint64_t v)
+	{
+		uint64_t counts = mm_clb_u64(v);
+		uint32_t hi = (uint32_t)(v >> 32);
+		uint32_t lo = (uint32_t)v;
+
+		if (hi != 0)
+		{
+			return (int32_t)hi < 0 ? 0 : (uint32_t)(counts >> 32) + 1;
+		}
+		return (int32_t)lo < 0 ? 32 : 32 + (uint32_t)counts + 1;
+	}
+
+	/// @brief Divide a 128-bit integer by a 64-bit integer.
+	/// 
+	/// Restoring binary division over the significant bits of the dividend that do not fit below
+	/// the divisor, at most 128 steps. If the high half is below the divisor, the quotient fits
+	/// in 64 bits and at most 64 steps are taken.
+	/// @param dividend Number to divide
+	/// @param divisor Number to divide by, not 0
+	/// @return Struct containing quotient and remainder of division
+	FORCEINLINE CONST divrem_u128_result_t divrem_u128(pair_u128_t dividend, uint64_t divisor)
+	{
+		divrem_u128_result_t result = { { 0, 0 }, 0 };
+		uint64_t remainder = 0;
+		unsigned count = 0;
+
+		if (dividend.hi < divisor)
+		{
+			remainder = dividend.hi;
+			count = 64;
+		}
+		else
+		{
+			count = 128 - clz_u64(dividend.hi);
+		}
+
+		// The remainder is below the divisor, so with one more bit it is below 2 * divisor.
+		for (unsigned i = count; i-- > 64;)
+		{
+			uint64_t top = remainder >> 63;
+			remainder = (remainder << 1) | ((dividend.hi >> (i - 64)) & 1);
+			uint64_t subtract = top | (remainder >= divisor);
+			remainder -= divisor & -subtract;
+			result.quotient.hi |= subtract << (i - 64);
+		}
+		for (unsigned i = count < 64 ? count : 64; i-- > 0;)
+		{
+			uint64_t top = remainder >> 63;
+			remainder = (remainder << 1) | ((dividend.lo >> i) & 1);
+			uint64_t subtract = top | (remainder >= divisor);
+			remainder -= divisor & -subtract;
+			result.quotient.lo |= subtract << i;
+		}
+		result.remainder = remainder;
+
+		return result;
+	}
+
+#ifdef __cplusplus
+}
+#endif
+
+#include "detail/end.h"
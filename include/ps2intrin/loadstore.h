@@ -0,0 +1,1325 @@
+#pragma once
+
+/*
+*	Multimedia loads and stores (LQ/SQ), constants, element-wise construction and broadcasts.
+*/
+
+#include "common.h"
+
+#include "detail/begin.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+	/// @brief Create a 128-bit packed integer of all 0.
+	/// @return 128-bit packed integer containing 16 8-bit signed integers
+	FORCEINLINE CONST m128i8 mm_setzero_epi8()
+	{
+#ifdef PS2INTRIN_UNSAFE
+		m128i8 result = { 0 };
+
+		asm(
+			"por	%[Result],$0,$0"
+			: [Result] "=r" (result.v)
+		);
+
+		return result;
+#else
+		m128i8 result = { 0, 0 };
+		return result;
+#endif
+	}
+
+	/// @brief Create a 128-bit packed integer of all 0.
+	/// @return 128-bit packed integer containing 16 8-bit unsigned integers
+	FORCEINLINE CONST m128u8 mm_setzero_epu8()
+	{
+#ifdef PS2INTRIN_UNSAFE
+		m128u8 result = { 0 };
+
+		asm(
+			"por	%[Result],$0,$0"
+			: [Result] "=r" (result.v)
+		);
+
+		return result;
+#else
+		m128u8 result = { 0, 0 };
+		return result;
+#endif
+	}
+
+	/// @brief Create a 128-bit packed integer of all 0.
+	/// @return 128-bit packed integer containing 8 16-bit signed integers
+	FORCEINLINE CONST m128i16 mm_setzero_epi16()
+	{
+#ifdef PS2INTRIN_UNSAFE
+		m128i16 result = { 0 };
+
+		asm(
+			"por	%[Result],$0,$0"
+			: [Result] "=r" (result.v)
+		);
+
+		return result;
+#else
+		m128i16 result = { 0, 0 };
+		return result;
+#endif
+	}
+
+	/// @brief Create a 128-bit packed integer of all 0.
+	/// @return 128-bit packed integer containing 8 16-bit unsigned integers
+	FORCEINLINE CONST m128u16 mm_setzero_epu16()
+	{
+#ifdef PS2INTRIN_UNSAFE
+		m128u16 result = { 0 };
+
+		asm(
+			"por	%[Result],$0,$0"
+			: [Result] "=r" (result.v)
+		);
+
+		return result;
+#else
+		m128u16 result = { 0, 0 };
+		return result;
+#endif
+	}
+
+	/// @brief Create a 128-bit packed integer of all 0.
+	/// @return 128-bit packed integer containing 4 32-bit signed integers
+	FORCEINLINE CONST m128i32 mm_setzero_epi32()
+	{
+#ifdef PS2INTRIN_UNSAFE
+		m128i32 result = { 0 };
+
+		asm(
+			"por	%[Result],$0,$0"
+			: [Result] "=r" (result.v)
+		);
+
+		return result;
+#else
+		m128i32 result = { 0, 0 };
+		return result;
+#endif
+	}
+
+	/// @brief Create a 128-bit packed integer of all 0.
+	/// @return 128-bit packed integer containing 4 32-bit unsigned integers
+	FORCEINLINE CONST m128u32 mm_setzero_epu32()
+	{
+#ifdef PS2INTRIN_UNSAFE
+		m128u32 result = { 0 };
+
+		asm(
+			"por	%[Result],$0,$0"
+			: [Result] "=r" (result.v)
+		);
+
+		return result;
+#else
+		m128u32 result = { 0, 0 };
+		return result;
+#endif
+	}
+
+	/// @brief Create a 128-bit packed integer of all 0.
+	/// @return 128-bit packed integer containing 2 64-bit signed integers
+	FORCEINLINE CONST m128i64 mm_setzero_epi64()
+	{
+#ifdef PS2INTRIN_UNSAFE
+		m128i64 result = { 0 };
+
+		asm(
+			"por	%[Result],$0,$0"
+			: [Result] "=r" (result.v)
+		);
+
+		return result;
+#else
+		m128i64 result = { 0, 0 };
+		return result;
+#endif
+	}
+
+	/// @brief Create a 128-bit packed integer of all 0.
+	/// @return 128-bit packed integer containing 2 64-bit unsigned integers
+	FORCEINLINE CONST m128u64 mm_setzero_epu64()
+	{
+#ifdef PS2INTRIN_UNSAFE
+		m128u64 result = { 0 };
+
+		asm(
+			"por	%[Result],$0,$0"
+			: [Result] "=r" (result.v)
+		);
+
+		return result;
+#else
+		m128u64 result = { 0, 0 };
+		return result;
+#endif
+	}
+
+	/// @brief Create a 128-bit packed integer of all 0.
+	/// @return 128-bit packed integer containing 1 128-bit signed integers
+	FORCEINLINE CONST m128i128 mm_setzero_epi128()
+	{
+#ifdef PS2INTRIN_UNSAFE
+		m128i128 result = { 0 };
+
+		asm(
+			"por	%[Result],$0,$0"
+			: [Result] "=r" (result.v)
+		);
+
+		return result;
+#else
+		m128i128 result = { 0, 0 };
+		return result;
+#endif
+	}
+
+	/// @brief Create a 128-bit packed integer of all 0.
+	/// @return 128-bit packed integer containing 1 128-bit unsigned integers
+	FORCEINLINE CONST m128u128 mm_setzero_epu128()
+	{
+#ifdef PS2INTRIN_UNSAFE
+		m128u128 result = { 0 };
+
+		asm(
+			"por	%[Result],$0,$0"
+			: [Result] "=r" (result.v)
+		);
+
+		return result;
+#else
+		m128u128 result = { 0, 0 };
+		return result;
+#endif
+	}
+
+	// LQ
+#ifdef PS2INTRIN_UNSAFE
+	#define LQ(result, address)																		\
+	asm(																							\
+		"lq	%[Result],%[Address]"																	\
+		: [Result] "=r" ((result).v)					/*	output operands	*/						\
+		: [Address] "o" (*(const char (*)[16]) address)	/*	input operands	Tell GCC that this is	\
+																reading 16 bytes from *address	*/	\
+	)
+#elif defined(PS2INTRIN_HOST)
+	// Like LQ, ignore the lower 4 bits of the address.
+	#define LQ(result, address)																		\
+	memcpy(&(result), (const void*)((uintptr_t)(address) & ~(uintptr_t)15), 16)
+#else
+	#define LQ(result, address)																		\
+	asm(																							\
+		"lq	%[ResultLo],%[Address]\n\t"																\
+		"pcpyud	%[ResultHi],%[ResultLo],%[ResultLo]"												\
+		: [ResultLo] "=r" ((result).lo),				/*	output operands	*/						\
+		  [ResultHi] "=r" ((result).hi)																\
+		: [Address] "o" (*(const char (*)[16]) address)	/*	input operands	Tell GCC that this is	\
+																reading 16 bytes from *address	*/	\
+	)
+#endif
+
+	/// @brief LQ : Load Quadword
+	/// 
+	/// Load 16 packed signed 8-bit integers from memory.
+	/// 
+	/// The memory location must aligned on a 16-byte boundary. Otherwise the next 16-byte boundary
+	/// below the given memory location is used instead, loading unintended values.
+	/// 
+	/// This function reads global state (*'p')
+	/// @param p Memory location to load integer data from.
+	/// @return Packed integer data loaded from given memory location.
+	FORCEINLINE UNSEQUENCED m128i8 mm_load_epi8(const m128i8* p)
+	{
+		m128i8 result = {};
+
+		LQ(result, p);
+
+		return result;
+	}
+
+	/// @brief LQ : Load Quadword
+	/// 
+	/// Load 16 packed unsigned 8-bit integers from memory.
+	/// 
+	/// The memory location must aligned on a 16-byte boundary. Otherwise the next 16-byte boundary
+	/// below the given memory location is used instead, loading unintended values.
+	/// 
+	/// This function reads global state (*'p')
+	/// @param p Memory location to load integer data from.
+	/// @return Packed integer data loaded from given memory location.
+	FORCEINLINE UNSEQUENCED m128u8 mm_load_epu8(const m128u8* p)
+	{
+		m128u8 result = {};
+
+		LQ(result, p);
+
+		return result;
+	}
+
+	/// @brief LQ : Load Quadword
+	/// 
+	/// Load 8 packed signed 16-bit integers from memory.
+	/// 
+	/// The memory location must aligned on a 16-byte boundary. Otherwise the next 16-byte boundary
+	/// below the given memory location is used instead, loading unintended values.
+	/// 
+	/// This function reads global state (*'p')
+	/// @param p Memory location to load integer data from.
+	/// @return Packed integer data loaded from given memory location.
+	FORCEINLINE UNSEQUENCED m128i16 mm_load_epi16(const m128i16* p)
+	{
+		m128i16 result = {};
+
+		LQ(result, p);
+
+		return result;
+	}
+
+	/// @brief LQ : Load Quadword
+	/// 
+	/// Load 8 packed unsigned 16-bit integers from memory.
+	/// 
+	/// The memory location must aligned on a 16-byte boundary. Otherwise the next 16-byte boundary
+	/// below the given memory location is used instead, loading unintended values.
+	/// 
+	/// This function reads global state (*'p')
+	/// @param p Memory location to load integer data from.
+	/// @return Packed integer data loaded from given memory location.
+	FORCEINLINE UNSEQUENCED m128u16 mm_load_epu16(const m128u16* p)
+	{
+		m128u16 result = {};
+
+		LQ(result, p);
+
+		return result;
+	}
+
+	/// @brief LQ : Load Quadword
+	/// 
+	/// Load 4 packed signed 32-bit integers from memory.
+	/// 
+	/// The memory location must aligned on a 16-byte boundary. Otherwise the next 16-byte boundary
+	/// below the given memory location is used instead, loading unintended values.
+	/// 
+	/// This function reads global state (*'p')
+	/// @param p Memory location to load integer data from.
+	/// @return Packed integer data loaded from given memory location.
+	FORCEINLINE UNSEQUENCED m128i32 mm_load_epi32(const m128i32* p)
+	{
+		m128i32 result = {};
+
+		LQ(result, p);
+
+		return result;
+	}
+
+	/// @brief LQ : Load Quadword
+	/// 
+	/// Load 4 packed unsigned 32-bit integers from memory.
+	/// 
+	/// The memory location must aligned on a 16-byte boundary. Otherwise the next 16-byte boundary
+	/// below the given memory location is used instead, loading unintended values.
+	/// 
+	/// This function reads global state (*'p')
+	/// @param p Memory location to load integer data from.
+	/// @return Packed integer data loaded from given memory location.
+	FORCEINLINE UNSEQUENCED m128u32 mm_load_epu32(const m128u32* p)
+	{
+		m128u32 result = {};
+
+		LQ(result, p);
+
+		return result;
+	}
+
+	/// @brief LQ : Load Quadword
+	/// 
+	/// Load 2 packed signed 64-bit integers from memory.
+	/// 
+	/// The memory location must aligned on a 16-byte boundary. Otherwise the next 16-byte boundary
+	/// below the given memory location is used instead, loading unintended values.
+	/// 
+	/// This function reads global state (*'p')
+	/// @param p Memory location to load integer data from.
+	/// @return Packed integer data loaded from given memory location.
+	FORCEINLINE UNSEQUENCED m128i64 mm_load_epi64(const m128i64* p)
+	{
+		m128i64 result = {};
+
+		LQ(result, p);
+
+		return result;
+	}
+
+	/// @brief LQ : Load Quadword
+	/// 
+	/// Load 2 packed unsigned 64-bit integers from memory.
+	/// 
+	/// The memory location must aligned on a 16-byte boundary. Otherwise the next 16-byte boundary
+	/// below the given memory location is used instead, loading unintended values.
+	/// 
+	/// This function reads global state (*'p')
+	/// @param p Memory location to load integer data from.
+	/// @return Packed integer data loaded from given memory location.
+	FORCEINLINE UNSEQUENCED m128u64 mm_load_epu64(const m128u64* p)
+	{
+		m128u64 result = {};
+
+		LQ(result, p);
+
+		return result;
+	}
+
+	/// @brief LQ : Load Quadword
+	/// 
+	/// Load 1 signed 128-bit integer from memory.
+	/// 
+	/// The memory location must aligned on a 16-byte boundary. Otherwise the next 16-byte boundary
+	/// below the given memory location is used instead, loading unintended values.
+	/// 
+	/// This function reads global state (*'p')
+	/// @param p Memory location to load integer data from.
+	/// @return Packed integer data loaded from given memory location.
+	FORCEINLINE UNSEQUENCED m128i128 mm_load_epi128(const m128i128* p)
+	{
+		m128i128 result = {};
+
+		LQ(result, p);
+
+		return result;
+	}
+
+	/// @brief LQ : Load Quadword
+	/// 
+	/// Load 1 unsigned 128-bit integer from memory.
+	/// 
+	/// The memory location must aligned on a 16-byte boundary. Otherwise the next 16-byte boundary
+	/// below the given memory location is used instead, loading unintended values.
+	/// 
+	/// This function reads global state (*'p')
+	/// @param p Memory location to load integer data from.
+	/// @return Packed integer data loaded from given memory location.
+	FORCEINLINE UNSEQUENCED m128u128 mm_load_epu128(const m128u128* p)
+	{
+		m128u128 result = {};
+
+		LQ(result, p);
+
+		return result;
+	}
+
+#undef LQ
+
+	/// @brief LQ : Load Quadword
+	/// 
+	/// Load 1 int128_t from memory.
+	/// 
+	/// The memory location must aligned on a 16-byte boundary. Otherwise the next 16-byte boundary
+	/// below the given memory location is used instead, loading unintended values.
+	/// 
+	/// This function reads global state (*'p')
+	/// @param p Memory location to load integer data from.
+	/// @return Packed integer data loaded from given memory location.
+	FORCEINLINE UNSEQUENCED int128_t mm_load_i128(const int128_t* p)
+	{
+		uint64_t lo = 0;
+		uint64_t hi = 0;
+
+#ifdef PS2INTRIN_HOST
+		uint64_t both[2];
+
+		memcpy(both, (const void*)((uintptr_t)p & ~(uintptr_t)15), sizeof(both));
+		lo = both[0];
+		hi = both[1];
+#else
+		asm(
+			"lq	%[ResultLo],%[Address]\n\t"
+			"pcpyud	%[ResultHi],%[ResultLo],%[ResultLo]"
+			: [ResultLo] "=r" (lo),							/*	output operands	*/
+			  [ResultHi] "=r" (hi)
+			: [Address] "o" (*(const char (*)[16]) p)		/*	input operands	Tell GCC that this is
+																	reading 16 bytes from *address	*/
+		);
+#endif
+
+		uint128_t result = hi;
+		result <<= 64;
+		result |= lo;
+
+		return (int128_t)result;
+	}
+
+	/// @brief LQ : Load Quadword
+	/// 
+	/// Load 1 uint128_t from memory.
+	/// 
+	/// The memory location must aligned on a 16-byte boundary. Otherwise the next 16-byte boundary
+	/// below the given memory location is used instead, loading unintended values.
+	/// 
+	/// This function reads global state (*'p')
+	/// @param p Memory location to load integer data from.
+	/// @return Packed integer data loaded from given memory location.
+	FORCEINLINE UNSEQUENCED uint128_t mm_load_u128(const uint128_t* p)
+	{
+		uint64_t lo = 0;
+		uint64_t hi = 0;
+
+#ifdef PS2INTRIN_HOST
+		uint64_t both[2];
+
+		memcpy(both, (const void*)((uintptr_t)p & ~(uintptr_t)15), sizeof(both));
+		lo = both[0];
+		hi = both[1];
+#else
+		asm(
+			"lq	%[ResultLo],%[Address]\n\t"
+			"pcpyud	%[ResultHi],%[ResultLo],%[ResultLo]"
+			: [ResultLo] "=r" (lo),							/*	output operands	*/
+			  [ResultHi] "=r" (hi)
+			: [Address] "o" (*(const char (*)[16]) p)		/*	input operands	Tell GCC that this is
+																	reading 16 bytes from *address	*/
+		);
+#endif
+
+		uint128_t result = hi;
+		result <<= 64;
+		result |= lo;
+
+		return result;
+	}
+
+
+// SQ
+#ifdef PS2INTRIN_UNSAFE
+	#define SQ(address, value)																		\
+	asm(																							\
+		"sq	%[Value],%[Address]"																	\
+		: [Address] "=o" (*(char (*)[16]) address)		/*	output operands	Tell GCC that this is	\
+															writing 16 bytes to *address	*/		\
+		: [Value] "r" ((value).v)						/*	input operands	*/						\
+	)
+#elif defined(PS2INTRIN_HOST)
+	#define SQ(address, value)																		\
+	memcpy((void*)((uintptr_t)(address) & ~(uintptr_t)15), &(value), 16)
+#else
+	#define SQ(address, value)																		\
+	asm(																							\
+		"pcpyld	%[ValueLo],%[ValueHi],%[ValueLo]\n\t"												\
+		"sq	%[ValueLo],%[Address]"																	\
+		: [Address] "=o" (*(char (*)[16]) address)		/*	output operands	Tell GCC that this is	\
+															writing 16 bytes to *address	*/		\
+		: [ValueLo] "r" ((value).lo),					/*	input operands	*/						\
+		  [ValueHi] "r" ((value).hi)																\
+	)
+#endif
+
+	/// @brief SQ : Store Quadword
+	/// 
+	/// Store 16 packed signed 8-bit integers to memory.
+	/// 
+	/// The memory location must aligned on a 16-byte boundary. Otherwise the next 16-byte boundary
+	/// below the given memory location is used instead, storing to an unintended address.
+	/// 
+	/// This function writes to global state (*'address')
+	/// @param p Address to store to.
+	/// @return Packed integer data to store to the memory location.
+	FORCEINLINE UNSEQUENCED void mm_store_epi8(m128i8* p, m128i8 value)
+	{
+		SQ(p, value);
+	}
+
+	/// @brief SQ : Store Quadword
+	/// 
+	/// Store 16 packed unsigned 8-bit integers to memory.
+	/// 
+	/// The memory location must aligned on a 16-byte boundary. Otherwise the next 16-byte boundary
+	/// below the given memory location is used instead, storing to an unintended address.
+	/// 
+	/// This function writes to global state (*'address')
+	/// @param p Address to store to.
+	/// @return Packed integer data to store to the memory location.
+	FORCEINLINE UNSEQUENCED void mm_store_epu8(m128u8* p, m128u8 value)
+	{
+		SQ(p, value);
+	}
+
+	/// @brief SQ : Store Quadword
+	/// 
+	/// Store 8 packed signed 16-bit integers to memory.
+	/// 
+	/// The memory location must aligned on a 16-byte boundary. Otherwise the next 16-byte boundary
+	/// below the given memory location is used instead, storing to an unintended address.
+	/// 
+	/// This function writes to global state (*'address')
+	/// @param p Address to store to.
+	/// @return Packed integer data to store to the memory location.
+	FORCEINLINE UNSEQUENCED void mm_store_epi16(m128i16* p, m128i16 value)
+	{
+		SQ(p, value);
+	}
+
+	/// @brief SQ : Store Quadword
+	/// 
+	/// Store 8 packed unsigned 16-bit integers to memory.
+	/// 
+	/// The memory location must aligned on a 16-byte boundary. Otherwise the next 16-byte boundary
+	/// below the given memory location is used instead, storing to an unintended address.
+	/// 
+	/// This function writes to global state (*'address')
+	/// @param p Address to store to.
+	/// @return Packed integer data to store to the memory location.
+	FORCEINLINE UNSEQUENCED void mm_store_epu16(m128u16* p, m128u16 value)
+	{
+		SQ(p, value);
+	}
+
+	/// @brief SQ : Store Quadword
+	/// 
+	/// Store 4 packed signed 32-bit integers to memory.
+	/// 
+	/// The memory location must aligned on a 16-byte boundary. Otherwise the next 16-byte boundary
+	/// below the given memory location is used instead, storing to an unintended address.
+	/// 
+	/// This function writes to global state (*'address')
+	/// @param p Address to store to.
+	/// @return Packed integer data to store to the memory location.
+	FORCEINLINE UNSEQUENCED void mm_store_epi32(m128i32* p, m128i32 value)
+	{
+		SQ(p, value);
+	}
+
+	/// @brief SQ : Store Quadword
+	/// 
+	/// Store 4 packed unsigned 32-bit integers to memory.
+	/// 
+	/// The memory location must aligned on a 16-byte boundary. Otherwise the next 16-byte boundary
+	/// below the given memory location is used instead, storing to an unintended address.
+	/// 
+	/// This function writes to global state (*'address')
+	/// @param p Address to store to.
+	/// @return Packed integer data to store to the memory location.
+	FORCEINLINE UNSEQUENCED void mm_store_epu32(m128u32* p, m128u32 value)
+	{
+		SQ(p, value);
+	}
+
+	/// @brief SQ : Store Quadword
+	/// 
+	/// Store 2 packed signed 64-bit integers to memory.
+	/// 
+	/// The memory location must aligned on a 16-byte boundary. Otherwise the next 16-byte boundary
+	/// below the given memory location is used instead, storing to an unintended address.
+	/// 
+	/// This function writes to global state (*'address')
+	/// @param p Address to store to.
+	/// @return Packed integer data to store to the memory location.
+	FORCEINLINE UNSEQUENCED void mm_store_epi64(m128i64* p, m128i64 value)
+	{
+		SQ(p, value);
+	}
+
+	/// @brief SQ : Store Quadword
+	/// 
+	/// Store 2 packed unsigned 64-bit integers to memory.
+	/// 
+	/// The memory location must aligned on a 16-byte boundary. Otherwise the next 16-byte boundary
+	/// below the given memory location is used instead, storing to an unintended address.
+	/// 
+	/// This function writes to global state (*'address')
+	/// @param p Address to store to.
+	/// @return Packed integer data to store to the memory location.
+	FORCEINLINE UNSEQUENCED void mm_store_epu64(m128u64* p, m128u64 value)
+	{
+		SQ(p, value);
+	}
+
+	/// @brief SQ : Store Quadword
+	/// 
+	/// Store 1 packed signed 128-bit integers to memory.
+	/// 
+	/// The memory location must aligned on a 16-byte boundary. Otherwise the next 16-byte boundary
+	/// below the given memory location is used instead, storing to an unintended address.
+	/// 
+	/// This function writes to global state (*'address')
+	/// @param p Address to store to.
+	/// @return Packed integer data to store to the memory location.
+	FORCEINLINE UNSEQUENCED void mm_store_epi128(m128i128* p, m128i128 value)
+	{
+		SQ(p, value);
+	}
+
+	/// @brief SQ : Store Quadword
+	/// 
+	/// Store 1 packed unsigned 128-bit integers to memory.
+	/// 
+	/// The memory location must aligned on a 16-byte boundary. Otherwise the next 16-byte boundary
+	/// below the given memory location is used instead, storing to an unintended address.
+	/// 
+	/// This function writes to global state (*'address')
+	/// @param p Address to store to.
+	/// @return Packed integer data to store to the memory location.
+	FORCEINLINE UNSEQUENCED void mm_store_epu128(m128u128* p, m128u128 value)
+	{
+		SQ(p, value);
+	}
+
+#undef SQ
+
+	/// @brief SQ : Store Quadword
+	/// 
+	/// Store 1 int128_t to memory.
+	/// 
+	/// The memory location must aligned on a 16-byte boundary. Otherwise the next 16-byte boundary
+	/// below the given memory location is used instead, storing to an unintended address.
+	/// 
+	/// This function writes to global state (*'address')
+	/// @param p Address to store to.
+	/// @return Packed integer data to store to the memory location.
+	FORCEINLINE UNSEQUENCED void mm_store_i128(int128_t* p, int128_t value)
+	{
+#ifdef PS2INTRIN_HOST
+		uint64_t both[2] = { (uint64_t)value, (uint64_t)(value >> 64) };
+
+		memcpy((void*)((uintptr_t)p & ~(uintptr_t)15), both, sizeof(both));
+#else
+		asm(
+			"pcpyld	%[ValueLo],%[ValueHi],%[ValueLo]\n\t"
+			"sq	%[ValueLo],%[Address]"
+			: [Address] "=o" (*(char (*)[16]) p)			/*	output operands	Tell GCC that this is
+																writing 16 bytes to *address	*/
+			: [ValueLo] "r" ((uint64_t)value),					/*	input operands	*/
+			  [ValueHi] "r" ((uint64_t)(value >> 64))
+		);
+#endif
+	}
+
+	/// @brief SQ : Store Quadword
+	/// 
+	/// Store 1 uint128_t to memory.
+	/// 
+	/// The memory location must aligned on a 16-byte boundary. Otherwise the next 16-byte boundary
+	/// below the given memory location is used instead, storing to an unintended address.
+	/// 
+	/// This function writes to global state (*'address')
+	/// @param p Address to store to.
+	/// @return Packed integer data to store to the memory location.
+	FORCEINLINE UNSEQUENCED void mm_store_u128(uint128_t* p, uint128_t value)
+	{
+#ifdef PS2INTRIN_HOST
+		uint64_t both[2] = { (uint64_t)value, (uint64_t)(value >> 64) };
+
+		memcpy((void*)((uintptr_t)p & ~(uintptr_t)15), both, sizeof(both));
+#else
+		asm(
+			"pcpyld	%[ValueLo],%[ValueHi],%[ValueLo]\n\t"
+			"sq	%[ValueLo],%[Address]"
+			: [Address] "=o" (*(char (*)[16]) p)			/*	output operands	Tell GCC that this is
+																writing 16 bytes to *address	*/
+			: [ValueLo] "r" ((uint64_t)value),					/*	input operands	*/
+			  [ValueHi] "r" ((uint64_t)(value >> 64))
+		);
+#endif
+	}
+
+
+	/// @brief Set a 128-bit packed integer type with given values.
+	/// 
+	/// This is a convenience function and corresponds to a multitude of instructions.
+	/// 
+	/// Ordering of the arguments is where they would be as if loaded from memory in order of their
+	/// name. So the code:
+	/// 
+	///		int8_t arr[16] = { r0, r1, r2, ... , r15 };
+	///		result = mm_load_epi8(arr);
+	/// 
+	/// would result in the same initialized packed integer type. (Omitting alignment/casting).
+	/// @param r15 Signed 8-bit value to put in the highest position of the result
+	/// @param r14 
+	/// @param r13 
+	/// @param r12 
+	/// @param r11 
+	/// @param r10 
+	/// @param r9 
+	/// @param r8 
+	/// @param r7 
+	/// @param r6 
+	/// @param r5 
+	/// @param r4 
+	/// @param r3 
+	/// @param r2 
+	/// @param r1 
+	/// @param r0 Signed 8-bit value to put in the lowest position of the result
+	/// @return Packed integer type initialized to the given values
+	FORCEINLINE CONST m128i8 mm_set_epi8(int8_t r15, int8_t r14, int8_t r13, int8_t r12, int8_t r11, int8_t r10, int8_t r9, int8_t r8,
+										 int8_t r7, int8_t r6, int8_t r5, int8_t r4, int8_t r3, int8_t r2, int8_t r1, int8_t r0)
+	{
+		m128i8 result = {};
+
+		uint64_t lo = r7  & 0xFF;
+		uint64_t hi = r15 & 0xFF;
+		lo <<= 8;
+		lo |= r6  & 0xFF;
+		hi <<= 8;
+		hi |= r14 & 0xFF;
+		lo <<= 8;
+		lo |= r5  & 0xFF;
+		hi <<= 8;
+		hi |= r13 & 0xFF;
+		lo <<= 8;
+		lo |= r4  & 0xFF;
+		hi <<= 8;
+		hi |= r12 & 0xFF;
+		lo <<= 8;
+		lo |= r3  & 0xFF;
+		hi <<= 8;
+		hi |= r11 & 0xFF;
+		lo <<= 8;
+		lo |= r2  & 0xFF;
+		hi <<= 8;
+		hi |= r10 & 0xFF;
+		lo <<= 8;
+		lo |= r1  & 0xFF;
+		hi <<= 8;
+		hi |= r9  & 0xFF;
+		lo <<= 8;
+		lo |= r0  & 0xFF;
+		hi <<= 8;
+		hi |= r8  & 0xFF;
+
+#ifdef PS2INTRIN_UNSAFE
+		asm(
+			"pcpyld	%[Result],%[Upper],%[Lower]"
+			: [Result] "=r" (result.v)
+			: [Upper] "r" (hi), [Lower] "r" (lo)
+		);
+#else
+		result.lo = lo;
+		result.hi = hi;
+#endif
+
+		return result;
+	}
+
+	/// @brief Set a 128-bit packed integer type with given values.
+	/// 
+	/// This is a convenience function and corresponds to a multitude of instructions.
+	/// 
+	/// Ordering of the arguments is where they would be as if loaded from memory in order of their
+	/// name. So the code:
+	/// 
+	///		uint8_t arr[16] = { r0, r1, r2, ... , r15 };
+	///		result = mm_load_epu8(arr);
+	/// 
+	/// would result in the same initialized packed integer type. (Omitting alignment/casting).
+	/// @param r15 Unsigned 8-bit value to put in the highest position of the result
+	/// @param r14 
+	/// @param r13 
+	/// @param r12 
+	/// @param r11 
+	/// @param r10 
+	/// @param r9 
+	/// @param r8 
+	/// @param r7 
+	/// @param r6 
+	/// @param r5 
+	/// @param r4 
+	/// @param r3 
+	/// @param r2 
+	/// @param r1 
+	/// @param r0 Unsigned 8-bit value to put in the lowest position of the result
+	/// @return Packed integer type initialized to the given values
+	FORCEINLINE CONST m128u8 mm_set_epu8(uint8_t r15, uint8_t r14, uint8_t r13, uint8_t r12, uint8_t r11, uint8_t r10, uint8_t r9, uint8_t r8,
+										 uint8_t r7, uint8_t r6, uint8_t r5, uint8_t r4, uint8_t r3, uint8_t r2, uint8_t r1, uint8_t r0)
+	{
+		m128u8 result = {};
+
+		uint64_t lo = r7  & 0xFF;
+		uint64_t hi = r15 & 0xFF;
+		lo <<= 8;
+		lo |= r6  & 0xFF;
+		hi <<= 8;
+		hi |= r14 & 0xFF;
+		lo <<= 8;
+		lo |= r5  & 0xFF;
+		hi <<= 8;
+		hi |= r13 & 0xFF;
+		lo <<= 8;
+		lo |= r4  & 0xFF;
+		hi <<= 8;
+		hi |= r12 & 0xFF;
+		lo <<= 8;
+		lo |= r3  & 0xFF;
+		hi <<= 8;
+		hi |= r11 & 0xFF;
+		lo <<= 8;
+		lo |= r2  & 0xFF;
+		hi <<= 8;
+		hi |= r10 & 0xFF;
+		lo <<= 8;
+		lo |= r1  & 0xFF;
+		hi <<= 8;
+		hi |= r9  & 0xFF;
+		lo <<= 8;
+		lo |= r0  & 0xFF;
+		hi <<= 8;
+		hi |= r8  & 0xFF;
+
+#ifdef PS2INTRIN_UNSAFE
+		asm(
+			"pcpyld	%[Result],%[Upper],%[Lower]"
+			: [Result] "=r" (result.v)
+			: [Upper] "r" (hi), [Lower] "r" (lo)
+		);
+#else
+		result.lo = lo;
+		result.hi = hi;
+#endif
+
+		return result;
+	}
+
+	/// @brief Set a 128-bit packed integer type with given values.
+	/// 
+	/// This is a convenience function and corresponds to a multitude of instructions.
+	/// 
+	/// Ordering of the arguments is where they would be as if loaded from memory in order of their
+	/// name. So the code:
+	/// 
+	///		int16_t arr[8] = { r0, r1, r2, ... , r7 };
+	///		result = mm_load_epi16(arr);
+	/// 
+	/// would result in the same initialized packed integer type. (Omitting alignment/casting).
+	/// @param r7 Signed 16-bit value to put in the highest position of the result
+	/// @param r6 
+	/// @param r5 
+	/// @param r4 
+	/// @param r3 
+	/// @param r2 
+	/// @param r1 
+	/// @param r0 Signed 16-bit value to put in the lowest position of the result
+	/// @return Packed integer type initialized to the given values
+	FORCEINLINE CONST m128i16 mm_set_epi16(int16_t r7, int16_t r6, int16_t r5, int16_t r4, int16_t r3, int16_t r2, int16_t r1, int16_t r0)
+	{
+		m128i16 result = {};
+
+		uint64_t lo = r3 & 0xFFFF;
+		uint64_t hi = r7 & 0xFFFF;
+		lo <<= 16;
+		lo |= r2 & 0xFFFF;
+		hi <<= 16;
+		hi |= r6 & 0xFFFF;
+		lo <<= 16;
+		lo |= r1 & 0xFFFF;
+		hi <<= 16;
+		hi |= r5 & 0xFFFF;
+		lo <<= 16;
+		lo |= r0 & 0xFFFF;
+		hi <<= 16;
+		hi |= r4 & 0xFFFF;
+
+#ifdef PS2INTRIN_UNSAFE
+		asm(
+			"pcpyld	%[Result],%[Upper],%[Lower]"
+			: [Result] "=r" (result.v)
+			: [Upper] "r" (hi), [Lower] "r" (lo)
+		);
+#else
+		result.lo = lo;
+		result.hi = hi;
+#endif
+
+		return result;
+	}
+
+	/// @brief Set a 128-bit packed integer type with given values.
+	/// 
+	/// This is a convenience function and corresponds to a multitude of instructions.
+	/// 
+	/// Ordering of the arguments is where they would be as if loaded from memory in order of their
+	/// name. So the code:
+	/// 
+	///		uint16_t arr[8] = { r0, r1, r2, ... , r7 };
+	///		result = mm_load_epu16(arr);
+	/// 
+	/// would result in the same initialized packed integer type. (Omitting alignment/casting).
+	/// @param r7 Unsigned 16-bit value to put in the highest position of the result
+	/// @param r6 
+	/// @param r5 
+	/// @param r4 
+	/// @param r3 
+	/// @param r2 
+	/// @param r1 
+	/// @param r0 Unsigned 16-bit value to put in the lowest position of the result
+	/// @return Packed integer type initialized to the given values
+	FORCEINLINE CONST m128u16 mm_set_epu16(uint16_t r7, uint16_t r6, uint16_t r5, uint16_t r4, uint16_t r3, uint16_t r2, uint16_t r1, uint16_t r0)
+	{
+		m128u16 result = {};
+
+		uint64_t lo = r3 & 0xFFFF;
+		uint64_t hi = r7 & 0xFFFF;
+		lo <<= 16;
+		lo |= r2 & 0xFFFF;
+		hi <<= 16;
+		hi |= r6 & 0xFFFF;
+		lo <<= 16;
+		lo |= r1 & 0xFFFF;
+		hi <<= 16;
+		hi |= r5 & 0xFFFF;
+		lo <<= 16;
+		lo |= r0 & 0xFFFF;
+		hi <<= 16;
+		hi |= r4 & 0xFFFF;
+
+#ifdef PS2INTRIN_UNSAFE
+		asm(
+			"pcpyld	%[Result],%[Upper],%[Lower]"
+			: [Result] "=r" (result.v)
+			: [Upper] "r" (hi), [Lower] "r" (lo)
+		);
+#else
+		result.lo = lo;
+		result.hi = hi;
+#endif
+
+		return result;
+	}
+
+	/// @brief Set a 128-bit packed integer type with given values.
+	/// 
+	/// This is a convenience function and corresponds to a multitude of instructions.
+	/// 
+	/// Ordering of the arguments is where they would be as if loaded from memory in order of their
+	/// name. So the code:
+	/// 
+	///		int32_t arr[16] = { r0, r1, r2, r3 };
+	///		result = mm_load_epi32(arr);
+	/// 
+	/// would result in the same initialized packed integer type. (Omitting alignment/casting).
+	/// @param r3 Signed 32-bit value to put in the highest position of the result
+	/// @param r2 
+	/// @param r1 
+	/// @param r0 Signed 32-bit value to put in the lowest position of the result
+	/// @return Packed integer type initialized to the given values
+	FORCEINLINE CONST m128i32 mm_set_epi32(int32_t r3, int32_t r2, int32_t r1, int32_t r0)
+	{
+		m128i32 result = {};
+
+		uint64_t lo = r1 & 0xFFFFFFFF;
+		uint64_t hi = r3 & 0xFFFFFFFF;
+		lo <<= 32;
+		lo |= r0 & 0xFFFFFFFF;
+		hi <<= 32;
+		hi |= r2 & 0xFFFFFFFF;
+
+#ifdef PS2INTRIN_UNSAFE
+		asm(
+			"pcpyld	%[Result],%[Upper],%[Lower]"
+			: [Result] "=r" (result.v)
+			: [Upper] "r" (hi), [Lower] "r" (lo)
+		);
+#else
+		result.lo = lo;
+		result.hi = hi;
+#endif
+
+		return result;
+	}
+
+	/// @brief Set a 128-bit packed integer type with given values.
+	/// 
+	/// This is a convenience function and corresponds to a multitude of instructions.
+	/// 
+	/// Ordering of the arguments is where they would be as if loaded from memory in order of their
+	/// name. So the code:
+	/// 
+	///		uint32_t arr[4] = { r0, r1, r2, r3 };
+	///		result = mm_load_epu32(arr);
+	/// 
+	/// would result in the same initialized packed integer type. (Omitting alignment/casting).
+	/// @param r3 Unsigned 32-bit value to put in the highest position of the result
+	/// @param r2 
+	/// @param r1 
+	/// @param r0 Unsigned 32-bit value to put in the lowest position of the result
+	/// @return Packed integer type initialized to the given values
+	FORCEINLINE CONST m128u32 mm_set_epu32(uint32_t r3, uint32_t r2, uint32_t r1, uint32_t r0)
+	{
+		m128u32 result = {};
+
+		uint64_t lo = r1 & 0xFFFFFFFF;
+		uint64_t hi = r3 & 0xFFFFFFFF;
+		lo <<= 32;
+		lo |= r0 & 0xFFFFFFFF;
+		hi <<= 32;
+		hi |= r2 & 0xFFFFFFFF;
+
+#ifdef PS2INTRIN_UNSAFE
+		asm(
+			"pcpyld	%[Result],%[Upper],%[Lower]"
+			: [Result] "=r" (result.v)
+			: [Upper] "r" (hi), [Lower] "r" (lo)
+		);
+#else
+		result.lo = lo;
+		result.hi = hi;
+#endif
+
+		return result;
+	}
+
+	/// @brief Set a 128-bit packed integer type with given values.
+	/// 
+	/// This is a convenience function and corresponds to a multitude of instructions.
+	/// 
+	/// Ordering of the arguments is where they would be as if loaded from memory in order of their
+	/// name. So the code:
+	/// 
+	///		int64_t arr[2] = { r0, r1 };
+	///		result = mm_load_epi64(arr);
+	/// 
+	/// would result in the same initialized packed integer type. (Omitting alignment/casting).
+	/// @param r1 Signed 64-bit value to put in the highest position of the result
+	/// @param r0 Signed 64-bit value to put in the lowest position of the result
+	/// @return Packed integer type initialized to the given values
+	FORCEINLINE CONST m128i64 mm_set_epi64(int64_t r1, int64_t r0)
+	{
+		m128i64 result = {};
+
+#ifdef PS2INTRIN_UNSAFE
+		asm(
+			"pcpyld	%[Result],%[Upper],%[Lower]"
+			: [Result] "=r" (result.v)
+			: [Upper] "r" (r1), [Lower] "r" (r0)
+		);
+#else
+		result.lo = r0;
+		result.hi = r1;
+#endif
+
+		return result;
+	}
+
+	/// @brief Set a 128-bit packed integer type with given values.
+	/// 
+	/// This is a convenience function and corresponds to a multitude of instructions.
+	/// 
+	/// Ordering of the arguments is where they would be as if loaded from memory in order of their
+	/// name. So the code:
+	/// 
+	///		uint64_t arr[2] = { r0, r1 };
+	///		result = mm_load_epu64(arr);
+	/// 
+	/// would result in the same initialized packed integer type. (Omitting alignment/casting).
+	/// @param r1 Unsigned 64-bit value to put in the highest position of the result
+	/// @param r0 Unsigned 64-bit value to put in the lowest position of the result
+	/// @return Packed integer type initialized to the given values
+	FORCEINLINE CONST m128u64 mm_set_epu64(uint64_t r1, uint64_t r0)
+	{
+		m128u64 result = {};
+
+#ifdef PS2INTRIN_UNSAFE
+		asm(
+			"pcpyld	%[Result],%[Upper],%[Lower]"
+			: [Result] "=r" (result.v)
+			: [Upper] "r" (r1), [Lower] "r" (r0)
+		);
+#else
+		result.lo = r0;
+		result.hi = r1;
+#endif
+
+		return result;
+	}
+
+	/// @brief Set a 128-bit packed integer type with given values.
+	/// 
+	/// This is a convenience function. Note that qword_t is convertible to int128_t.
+	/// @param r0 Signed 128-bit value to put in the result
+	/// @return Packed integer type initialized to the given values
+	FORCEINLINE CONST m128i128 mm_set_epi128(int128_t r0)
+	{
+		m128i128 result = {};
+
+#ifdef PS2INTRIN_UNSAFE
+		asm(
+			"pcpyld	%[Result],%[Upper],%[Lower]"
+			: [Result] "=r" (result.v)
+			: [Upper] "r" ((uint64_t)(r0 >> 64)), [Lower] "r" ((uint64_t)(r0))
+		);
+#else
+		result.lo = r0;
+		result.hi = r0 >> 64;
+#endif
+
+		return result;
+	}
+
+	/// @brief Set a 128-bit packed integer type with given values.
+	/// 
+	/// This is a convenience function. Note that qword_t is convertible to uint128_t.
+	/// @param r0 Unsigned 128-bit value to put in the result
+	/// @return Packed integer type initialized to the given values
+	FORCEINLINE CONST m128u128 mm_set_epu128(uint128_t r0)
+	{
+		m128u128 result = {};
+
+#ifdef PS2INTRIN_UNSAFE
+		asm(
+			"pcpyld	%[Result],%[Upper],%[Lower]"
+			: [Result] "=r" (result.v)
+			: [Upper] "r" ((uint64_t)(r0 >> 64)), [Lower] "r" ((uint64_t)(r0))
+		);
+#else
+		result.lo = r0;
+		result.hi = r0 >> 64;
+#endif
+
+		return result;
+	}
+
+
+	/// @brief Broadcast Byte
+	/// 
+	/// Broadcast an 8-bit value to all 16 positions in a 128-bit value.
+	/// @param v 8-bit value to broadcast
+	/// @return 128-value with broadcasted values
+	FORCEINLINE PURE m128i8 mm_broadcast_epi8(int8_t v)
+	{
+#ifdef PS2INTRIN_UNSAFE
+		m128i8 result = {};
+
+		asm(
+			"pextlb	%[Result],%[Value],%[Value]\n\t"	/* double byte to fill lower halfword		*/
+			"pcpyld	%[Result],%[Result],%[Result]\n\t"	/* put lower halfword in both doublewords	*/
+			"pcpyh	%[Result],%[Result]"				/* broadcast lower halfword in both			*/
+			: [Result] "=r" (result.v)
+			: [Value] "r" (v)
+		);
+
+		return result;
+#else
+		return mm_set_epi8(v, v, v, v, v, v, v, v, v, v, v, v, v, v, v, v);
+#endif
+	}
+
+	/// @brief Broadcast Byte
+	/// 
+	/// Broadcast an 8-bit value to all 16 positions in a 128-bit value.
+	/// @param v 8-bit value to broadcast
+	/// @return 128-value with broadcasted values
+	FORCEINLINE PURE m128u8 mm_broadcast_epu8(uint8_t v)
+	{
+		return mm_castepu8_epi8(mm_broadcast_epi8((int8_t)v));
+	}
+
+	/// @brief Broadcast Halfword
+	/// 
+	/// Broadcast a 16-bit value to all 8 positions in a 128-bit value.
+	/// @param v 16-bit value to broadcast
+	/// @return 128-value with broadcasted values
+	FORCEINLINE PURE m128i16 mm_broadcast_epi16(int16_t v)
+	{
+#ifdef PS2INTRIN_UNSAFE
+		m128i16 result = {};
+
+		asm(
+			"pcpyld	%[Result],%[Value],%[Value]\n\t"	/* put lower halfword in both doublewords	*/
+			"pcpyh	%[Result],%[Result]"				/* broadcast lower halfword in both			*/
+			: [Result] "=r" (result.v)
+			: [Value] "r" (v)
+		);
+
+		return result;
+#else
+		return mm_set_epi16(v, v, v, v, v, v, v, v);
+#endif
+	}
+
+	/// @brief Broadcast Halfword
+	/// 
+	/// Broadcast a 16-bit value to all 8 positions in a 128-bit value.
+	/// @param v 16-bit value to broadcast
+	/// @return 128-value with broadcasted values
+	FORCEINLINE PURE m128u16 mm_broadcast_epu16(uint16_t v)
+	{
+		return mm_castepu16_epi16(mm_broadcast_epi16((int16_t)v));
+	}
+
+	/// @brief Broadcast Word
+	/// 
+	/// Broadcast a 32-bit value to all 4 positions in a 128-bit value.
+	/// @param v 32-bit value to broadcast
+	/// @return 128-value with broadcasted values
+	FORCEINLINE PURE m128i32 mm_broadcast_epi32(int32_t v)
+	{
+#ifdef PS2INTRIN_UNSAFE
+		m128i32 result = {};
+
+		asm(
+			"pextlw	%[Result],%[Value],%[Value]\n\t"
+			"pcpyld	%[Result],%[Result],%[Result]"
+			: [Result] "=r" (result.v)
+			: [Value] "r" (v)
+		);
+
+		return result;
+#else
+		return mm_set_epi32(v, v, v, v);
+#endif
+	}
+
+	/// @brief Broadcast Word
+	/// 
+	/// Broadcast a 32-bit value to all 4 positions in a 128-bit value.
+	/// @param v 32-bit value to broadcast
+	/// @return 128-value with broadcasted values
+	FORCEINLINE PURE m128u32 mm_broadcast_epu32(uint32_t v)
+	{
+		return mm_castepu32_epi32(mm_broadcast_epi32((int32_t)v));
+	}
+
+	/// @brief Broadcast Doubleword
+	/// 
+	/// Broadcast a 64-bit value to all 2 positions in a 128-bit value.
+	/// @param v 64-bit value to broadcast
+	/// @return 128-value with broadcasted values
+	FORCEINLINE PURE m128i64 mm_broadcast_epi64(int64_t v)
+	{
+#ifdef PS2INTRIN_UNSAFE
+		m128i64 result = {};
+
+		asm(
+			"pcpyld	%[Result],%[Value],%[Value]"
+			: [Result] "=r" (result.v)
+			: [Value] "r" (v)
+		);
+
+		return result;
+#else
+		return mm_set_epi64(v, v);
+#endif
+	}
+
+	/// @brief Broadcast Doubleword
+	/// 
+	/// Broadcast a 64-bit value to all 2 positions in a 128-bit value.
+	/// @param v 64-bit value to broadcast
+	/// @return 128-value with broadcasted values
+	FORCEINLINE PURE m128u64 mm_broadcast_epu64(uint64_t v)
+	{
+		return mm_castepu64_epi64(mm_broadcast_epi64((int64_t)v));
+	}
+
+#ifdef __cplusplus
+}
+#endif
+
+#include "detail/end.h"
@@ -0,0 +1,615 @@
+#pragma once
+
+/*
+*	Multimedia bitwise logic: PAND, POR, PXOR and PNOR.
+*/
+
+#include "common.h"
+
+#include "detail/begin.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+	/// @brief PAND : Parallel AND
+	/// 
+	/// Compute bitwise-AND of 128-bit values.
+	/// @param l First operand
+	/// @param r Second operand
+	/// @return Bitwise-AND of both operands
+	FORCEINLINE CONST m128i8 mm_and_epi8(m128i8 l, m128i8 r)
+	{
+		m128i8 result = {};
+
+#ifdef PS2INTRIN_UNSAFE
+		asm("pand	%[Result],%[Left],%[Right]"
+			: [Result] "=r" (result.v)
+			: [Left] "%r" (l.v),
+			  [Right] "r" (r.v)
+		);
+#else
+		result.lo = l.lo & r.lo;
+		result.hi = l.hi & r.hi;
+#endif
+
+		return result;
+	}
+
+	/// @brief PAND : Parallel AND
+	/// 
+	/// Compute bitwise-AND of 128-bit values.
+	/// @param l First operand
+	/// @param r Second operand
+	/// @return Bitwise-AND of both operands
+	FORCEINLINE CONST m128u8 mm_and_epu8(m128u8 l, m128u8 r)
+	{
+		return mm_castepu8_epi8(mm_and_epi8(mm_castepi8_epu8(l), mm_castepi8_epu8(r)));
+	}
+
+	/// @brief PAND : Parallel AND
+	/// 
+	/// Compute bitwise-AND of 128-bit values.
+	/// @param l First operand
+	/// @param r Second operand
+	/// @return Bitwise-AND of both operands
+	FORCEINLINE CONST m128i16 mm_and_epi16(m128i16 l, m128i16 r)
+	{
+		return mm_castepi16_epi8(mm_and_epi8(mm_castepi8_epi16(l), mm_castepi8_epi16(r)));
+	}
+
+	/// @brief PAND : Parallel AND
+	/// 
+	/// Compute bitwise-AND of 128-bit values.
+	/// @param l First operand
+	/// @param r Second operand
+	/// @return Bitwise-AND of both operands
+	FORCEINLINE CONST m128u16 mm_and_epu16(m128u16 l, m128u16 r)
+	{
+		return mm_castepu16_epi8(mm_and_epi8(mm_castepi8_epu16(l), mm_castepi8_epu16(r)));
+	}
+
+	/// @brief PAND : Parallel AND
+	/// 
+	/// Compute bitwise-AND of 128-bit values.
+	/// @param l First operand
+	/// @param r Second operand
+	/// @return Bitwise-AND of both operands
+	FORCEINLINE CONST m128i32 mm_and_epi32(m128i32 l, m128i32 r)
+	{
+		return mm_castepi32_epi8(mm_and_epi8(mm_castepi8_epi32(l), mm_castepi8_epi32(r)));
+	}
+
+	/// @brief PAND : Parallel AND
+	/// 
+	/// Compute bitwise-AND of 128-bit values.
+	/// @param l First operand
+	/// @param r Second operand
+	/// @return Bitwise-AND of both operands
+	FORCEINLINE CONST m128u32 mm_and_epu32(m128u32 l, m128u32 r)
+	{
+		return mm_castepu32_epi8(mm_and_epi8(mm_castepi8_epu32(l), mm_castepi8_epu32(r)));
+	}
+
+	/// @brief PAND : Parallel AND
+	/// 
+	/// Compute bitwise-AND of 128-bit values.
+	/// @param l First operand
+	/// @param r Second operand
+	/// @return Bitwise-AND of both operands
+	FORCEINLINE CONST m128i64 mm_and_epi64(m128i64 l, m128i64 r)
+	{
+		return mm_castepi64_epi8(mm_and_epi8(mm_castepi8_epi64(l), mm_castepi8_epi64(r)));
+	}
+
+	/// @brief PAND : Parallel AND
+	/// 
+	/// Compute bitwise-AND of 128-bit values.
+	/// @param l First operand
+	/// @param r Second operand
+	/// @return Bitwise-AND of both operands
+	FORCEINLINE CONST m128u64 mm_and_epu64(m128u64 l, m128u64 r)
+	{
+		return mm_castepu64_epi8(mm_and_epi8(mm_castepi8_epu64(l), mm_castepi8_epu64(r)));
+	}
+
+	/// @brief PAND : Parallel AND
+	/// 
+	/// Compute bitwise-AND of 128-bit values.
+	/// @param l First operand
+	/// @param r Second operand
+	/// @return Bitwise-AND of both operands
+	FORCEINLINE CONST m128i128 mm_and_epi128(m128i128 l, m128i128 r)
+	{
+		return mm_castepi128_epi8(mm_and_epi8(mm_castepi8_epi128(l), mm_castepi8_epi128(r)));
+	}
+
+	/// @brief PAND : Parallel AND
+	/// 
+	/// Compute bitwise-AND of 128-bit values.
+	/// @param l First operand
+	/// @param r Second operand
+	/// @return Bitwise-AND of both operands
+	FORCEINLINE CONST m128u128 mm_and_epu128(m128u128 l, m128u128 r)
+	{
+		return mm_castepu128_epi8(mm_and_epi8(mm_castepi8_epu128(l), mm_castepi8_epu128(r)));
+	}
+
+
+	/// @brief POR : Parallel OR
+	/// 
+	/// Compute bitwise-OR of 128-bit values.
+	/// @param l First operand
+	/// @param r Second operand
+	/// @return Bitwise-OR of both operands
+	FORCEINLINE CONST m128i8 mm_or_epi8(m128i8 l, m128i8 r)
+	{
+		m128i8 result = {};
+
+#ifdef PS2INTRIN_UNSAFE
+		asm("por	%[Result],%[Left],%[Right]"
+			: [Result] "=r" (result.v)
+			: [Left] "%r" (l.v),
+			  [Right] "r" (r.v)
+		);
+#else
+		result.lo = l.lo | r.lo;
+		result.hi = l.hi | r.hi;
+#endif
+		
+		return result;
+	}
+
+	/// @brief POR : Parallel OR
+	/// 
+	/// Compute bitwise-OR of 128-bit values.
+	/// @param l First operand
+	/// @param r Second operand
+	/// @return Bitwise-OR of both operands
+	FORCEINLINE CONST m128u8 mm_or_epu8(m128u8 l, m128u8 r)
+	{
+		return mm_castepu8_epi8(mm_or_epi8(mm_castepi8_epu8(l), mm_castepi8_epu8(r)));
+	}
+
+	/// @brief POR : Parallel OR
+	/// 
+	/// Compute bitwise-OR of 128-bit values.
+	/// @param l First operand
+	/// @param r Second operand
+	/// @return Bitwise-OR of both operands
+	FORCEINLINE CONST m128i16 mm_or_epi16(m128i16 l, m128i16 r)
+	{
+		return mm_castepi16_epi8(mm_or_epi8(mm_castepi8_epi16(l), mm_castepi8_epi16(r)));
+	}
+
+	/// @brief POR : Parallel OR
+	/// 
+	/// Compute bitwise-OR of 128-bit values.
+	/// @param l First operand
+	/// @param r Second operand
+	/// @return Bitwise-OR of both operands
+	FORCEINLINE CONST m128u16 mm_or_epu16(m128u16 l, m128u16 r)
+	{
+		return mm_castepu16_epi8(mm_or_epi8(mm_castepi8_epu16(l), mm_castepi8_epu16(r)));
+	}
+
+	/// @brief POR : Parallel OR
+	/// 
+	/// Compute bitwise-OR of 128-bit values.
+	/// @param l First operand
+	/// @param r Second operand
+	/// @return Bitwise-OR of both operands
+	FORCEINLINE CONST m128i32 mm_or_epi32(m128i32 l, m128i32 r)
+	{
+		return mm_castepi32_epi8(mm_or_epi8(mm_castepi8_epi32(l), mm_castepi8_epi32(r)));
+	}
+
+	/// @brief POR : Parallel OR
+	/// 
+	/// Compute bitwise-OR of 128-bit values.
+	/// @param l First operand
+	/// @param r Second operand
+	/// @return Bitwise-OR of both operands
+	FORCEINLINE CONST m128u32 mm_or_epu32(m128u32 l, m128u32 r)
+	{
+		return mm_castepu32_epi8(mm_or_epi8(mm_castepi8_epu32(l), mm_castepi8_epu32(r)));
+	}
+
+	/// @brief POR : Parallel OR
+	/// 
+	/// Compute bitwise-OR of 128-bit values.
+	/// @param l First operand
+	/// @param r Second operand
+	/// @return Bitwise-OR of both operands
+	FORCEINLINE CONST m128i64 mm_or_epi64(m128i64 l, m128i64 r)
+	{
+		return mm_castepi64_epi8(mm_or_epi8(mm_castepi8_epi64(l), mm_castepi8_epi64(r)));
+	}
+
+	/// @brief POR : Parallel OR
+	/// 
+	/// Compute bitwise-OR of 128-bit values.
+	/// @param l First operand
+	/// @param r Second operand
+	/// @return Bitwise-OR of both operands
+	FORCEINLINE CONST m128u64 mm_or_epu64(m128u64 l, m128u64 r)
+	{
+		return mm_castepu64_epi8(mm_or_epi8(mm_castepi8_epu64(l), mm_castepi8_epu64(r)));
+	}
+
+	/// @brief POR : Parallel OR
+	/// 
+	/// Compute bitwise-OR of 128-bit values.
+	/// @param l First operand
+	/// @param r Second operand
+	/// @return Bitwise-OR of both operands
+	FORCEINLINE CONST m128i128 mm_or_epi128(m128i128 l, m128i128 r)
+	{
+		return mm_castepi128_epi8(mm_or_epi8(mm_castepi8_epi128(l), mm_castepi8_epi128(r)));
+	}
+
+	/// @brief POR : Parallel OR
+	/// 
+	/// Compute bitwise-OR of 128-bit values.
+	/// @param l First operand
+	/// @param r Second operand
+	/// @return Bitwise-OR of both operands
+	FORCEINLINE CONST m128u128 mm_or_epu128(m128u128 l, m128u128 r)
+	{
+		return mm_castepu128_epi8(mm_or_epi8(mm_castepi8_epu128(l), mm_castepi8_epu128(r)));
+	}
+
+
+	/// @brief PXOR : Parallel XOR
+	/// 
+	/// Compute bitwise-XOR of 128-bit values.
+	/// @param l First operand
+	/// @param r Second operand
+	/// @return Bitwise-XOR of both operands
+	FORCEINLINE CONST m128i8 mm_xor_epi8(m128i8 l, m128i8 r)
+	{
+		m128i8 result = {};
+
+#ifdef PS2INTRIN_UNSAFE
+		asm("pxor	%[Result],%[Left],%[Right]"
+			: [Result] "=r" (result.v)
+			: [Left] "%r" (l.v),
+			  [Right] "r" (r.v)
+		);
+#else
+		result.lo = l.lo ^ r.lo;
+		result.hi = l.hi ^ r.hi;
+#endif
+
+		return result;
+	}
+
+	/// @brief PXOR : Parallel XOR
+	/// 
+	/// Compute bitwise-XOR of 128-bit values.
+	/// @param l First operand
+	/// @param r Second operand
+	/// @return Bitwise-XOR of both operands
+	FORCEINLINE CONST m128u8 mm_xor_epu8(m128u8 l, m128u8 r)
+	{
+		return mm_castepu8_epi8(mm_xor_epi8(mm_castepi8_epu8(l), mm_castepi8_epu8(r)));
+	}
+
+	/// @brief PXOR : Parallel XOR
+	/// 
+	/// Compute bitwise-XOR of 128-bit values.
+	/// @param l First operand
+	/// @param r Second operand
+	/// @return Bitwise-XOR of both operands
+	FORCEINLINE CONST m128i16 mm_xor_epi16(m128i16 l, m128i16 r)
+	{
+		return mm_castepi16_epi8(mm_xor_epi8(mm_castepi8_epi16(l), mm_castepi8_epi16(r)));
+	}
+
+	/// @brief PXOR : Parallel XOR
+	/// 
+	/// Compute bitwise-XOR of 128-bit values.
+	/// @param l First operand
+	/// @param r Second operand
+	/// @return Bitwise-XOR of both operands
+	FORCEINLINE CONST m128u16 mm_xor_epu16(m128u16 l, m128u16 r)
+	{
+		return mm_castepu16_epi8(mm_xor_epi8(mm_castepi8_epu16(l), mm_castepi8_epu16(r)));
+	}
+
+	/// @brief PXOR : Parallel XOR
+	/// 
+	/// Compute bitwise-XOR of 128-bit values.
+	/// @param l First operand
+	/// @param r Second operand
+	/// @return Bitwise-XOR of both operands
+	FORCEINLINE CONST m128i32 mm_xor_epi32(m128i32 l, m128i32 r)
+	{
+		return mm_castepi32_epi8(mm_xor_epi8(mm_castepi8_epi32(l), mm_castepi8_epi32(r)));
+	}
+
+	/// @brief PXOR : Parallel XOR
+	/// 
+	/// Compute bitwise-XOR of 128-bit values.
+	/// @param l First operand
+	/// @param r Second operand
+	/// @return Bitwise-XOR of both operands
+	FORCEINLINE CONST m128u32 mm_xor_epu32(m128u32 l, m128u32 r)
+	{
+		return mm_castepu32_epi8(mm_xor_epi8(mm_castepi8_epu32(l), mm_castepi8_epu32(r)));
+	}
+
+	/// @brief PXOR : Parallel XOR
+	/// 
+	/// Compute bitwise-XOR of 128-bit values.
+	/// @param l First operand
+	/// @param r Second operand
+	/// @return Bitwise-XOR of both operands
+	FORCEINLINE CONST m128i64 mm_xor_epi64(m128i64 l, m128i64 r)
+	{
+		return mm_castepi64_epi8(mm_xor_epi8(mm_castepi8_epi64(l), mm_castepi8_epi64(r)));
+	}
+
+	/// @brief PXOR : Parallel XOR
+	/// 
+	/// Compute bitwise-XOR of 128-bit values.
+	/// @param l First operand
+	/// @param r Second operand
+	/// @return Bitwise-XOR of both operands
+	FORCEINLINE CONST m128u64 mm_xor_epu64(m128u64 l, m128u64 r)
+	{
+		return mm_castepu64_epi8(mm_xor_epi8(mm_castepi8_epu64(l), mm_castepi8_epu64(r)));
+	}
+
+	/// @brief PXOR : Parallel XOR
+	/// 
+	/// Compute bitwise-XOR of 128-bit values.
+	/// @param l First operand
+	/// @param r Second operand
+	/// @return Bitwise-XOR of both operands
+	FORCEINLINE CONST m128i128 mm_xor_epi128(m128i128 l, m128i128 r)
+	{
+		return mm_castepi128_epi8(mm_xor_epi8(mm_castepi8_epi128(l), mm_castepi8_epi128(r)));
+	}
+
+	/// @brief PXOR : Parallel XOR
+	/// 
+	/// Compute bitwise-XOR of 128-bit values.
+	/// @param l First operand
+	/// @param r Second operand
+	/// @return Bitwise-XOR of both operands
+	FORCEINLINE CONST m128u128 mm_xor_epu128(m128u128 l, m128u128 r)
+	{
+		return mm_castepu128_epi8(mm_xor_epi8(mm_castepi8_epu128(l), mm_castepi8_epu128(r)));
+	}
+
+
+	/// @brief PNOR : Parallel NOR
+	/// 
+	/// Compute bitwise-NOR of 128-bit values.
+	/// @param l First operand
+	/// @param r Second operand
+	/// @return Bitwise-NOR of both operands
+	FORCEINLINE CONST m128i8 mm_nor_epi8(m128i8 l, m128i8 r)
+	{
+		m128i8 result = {};
+
+#ifdef PS2INTRIN_UNSAFE
+		asm("pnor	%[Result],%[Left],%[Right]"
+			: [Result] "=r" (result.v)
+			: [Left] "%r" (l.v),
+			  [Right] "r" (r.v)
+		);
+#else
+		result.lo = ~(l.lo | r.lo);
+		result.hi = ~(l.hi | r.hi);
+#endif
+
+		return result;
+	}
+
+	/// @brief PNOR : Parallel NOR
+	/// 
+	/// Compute bitwise-NOR of 128-bit values.
+	/// @param l First operand
+	/// @param r Second operand
+	/// @return Bitwise-NOR of both operands
+	FORCEINLINE CONST m128u8 mm_nor_epu8(m128u8 l, m128u8 r)
+	{
+		return mm_castepu8_epi8(mm_nor_epi8(mm_castepi8_epu8(l), mm_castepi8_epu8(r)));
+	}
+
+	/// @brief PNOR : Parallel NOR
+	/// 
+	/// Compute bitwise-NOR of 128-bit values.
+	/// @param l First operand
+	/// @param r Second operand
+	/// @return Bitwise-NOR of both operands
+	FORCEINLINE CONST m128i16 mm_nor_epi16(m128i16 l, m128i16 r)
+	{
+		return mm_castepi16_epi8(mm_nor_epi8(mm_castepi8_epi16(l), mm_castepi8_epi16(r)));
+	}
+
+	/// @brief PNOR : Parallel NOR
+	/// 
+	/// Compute bitwise-NOR of 128-bit values.
+	/// @param l First operand
+	/// @param r Second operand
+	/// @return Bitwise-NOR of both operands
+	FORCEINLINE CONST m128u16 mm_nor_epu16(m128u16 l, m128u16 r)
+	{
+		return mm_castepu16_epi8(mm_nor_epi8(mm_castepi8_epu16(l), mm_castepi8_epu16(r)));
+	}
+
+	/// @brief PNOR : Parallel NOR
+	/// 
+	/// Compute bitwise-NOR of 128-bit values.
+	/// @param l First operand
+	/// @param r Second operand
+	/// @return Bitwise-NOR of both operands
+	FORCEINLINE CONST m128i32 mm_nor_epi32(m128i32 l, m128i32 r)
+	{
+		return mm_castepi32_epi8(mm_nor_epi8(mm_castepi8_epi32(l), mm_castepi8_epi32(r)));
+	}
+
+	/// @brief PNOR : Parallel NOR
+	/// 
+	/// Compute bitwise-NOR of 128-bit values.
+	/// @param l First operand
+	/// @param r Second operand
+	/// @return Bitwise-NOR of both operands
+	FORCEINLINE CONST m128u32 mm_nor_epu32(m128u32 l, m128u32 r)
+	{
+		return mm_castepu32_epi8(mm_nor_epi8(mm_castepi8_epu32(l), mm_castepi8_epu32(r)));
+	}
+
+	/// @brief PNOR : Parallel NOR
+	/// 
+	/// Compute bitwise-NOR of 128-bit values.
+	/// @param l First operand
+	/// @param r Second operand
+	/// @return Bitwise-NOR of both operands
+	FORCEINLINE CONST m128i64 mm_nor_epi64(m128i64 l, m128i64 r)
+	{
+		return mm_castepi64_epi8(mm_nor_epi8(mm_castepi8_epi64(l), mm_castepi8_epi64(r)));
+	}
+
+	/// @brief PNOR : Parallel NOR
+	/// 
+	/// Compute bitwise-NOR of 128-bit values.
+	/// @param l First operand
+	/// @param r Second operand
+	/// @return Bitwise-NOR of both operands
+	FORCEINLINE CONST m128u64 mm_nor_epu64(m128u64 l, m128u64 r)
+	{
+		return mm_castepu64_epi8(mm_nor_epi8(mm_castepi8_epu64(l), mm_castepi8_epu64(r)));
+	}
+
+	/// @brief PNOR : Parallel NOR
+	/// 
+	/// Compute bitwise-NOR of 128-bit values.
+	/// @param l First operand
+	/// @param r Second operand
+	/// @return Bitwise-NOR of both operands
+	FORCEINLINE CONST m128i128 mm_nor_epi128(m128i128 l, m128i128 r)
+	{
+		return mm_castepi128_epi8(mm_nor_epi8(mm_castepi8_epi128(l), mm_castepi8_epi128(r)));
+	}
+
+	/// @brief PNOR : Parallel NOR
+	/// 
+	/// Compute bitwise-NOR of 128-bit values.
+	/// @param l First operand
+	/// @param r Second operand
+	/// @return Bitwise-NOR of both operands
+	FORCEINLINE CONST m128u128 mm_nor_epu128(m128u128 l, m128u128 r)
+	{
+		return mm_castepu128_epi8(mm_nor_epi8(mm_castepi8_epu128(l), mm_castepi8_epu128(r)));
+	}
+
+
+	/// @brief PNOR : Parallel NOR
+	/// 
+	/// Compute bitwise-NOT of 128-bit values.
+	/// @param v Operand
+	/// @return Bitwise-NOT of operand
+	FORCEINLINE CONST m128i8 mm_not_epi8(m128i8 v)
+	{
+		return mm_nor_epi8(v, v);
+	}
+
+	/// @brief PNOR : Parallel NOR
+	/// 
+	/// Compute bitwise-NOT of 128-bit values.
+	/// @param v Operand
+	/// @return Bitwise-NOT of operand
+	FORCEINLINE CONST m128u8 mm_not_epu8(m128u8 v)
+	{
+		return mm_nor_epu8(v, v);
+	}
+
+	/// @brief PNOR : Parallel NOR
+	/// 
+	/// Compute bitwise-NOT of 128-bit values.
+	/// @param v Operand
+	/// @return Bitwise-NOT of operand
+	FORCEINLINE CONST m128i16 mm_not_epi16(m128i16 v)
+	{
+		return mm_nor_epi16(v, v);
+	}
+
+	/// @brief PNOR : Parallel NOR
+	/// 
+	/// Compute bitwise-NOT of 128-bit values.
+	/// @param v Operand
+	/// @return Bitwise-NOT of operand
+	FORCEINLINE CONST m128u16 mm_not_epu16(m128u16 v)
+	{
+		return mm_nor_epu16(v, v);
+	}
+
+	/// @brief PNOR : Parallel NOR
+	/// 
+	/// Compute bitwise-NOT of 128-bit values.
+	/// @param v Operand
+	/// @return Bitwise-NOT of operand
+	FORCEINLINE CONST m128i32 mm_not_epi32(m128i32 v)
+	{
+		return mm_nor_epi32(v, v);
+	}
+
+	/// @brief PNOR : Parallel NOR
+	/// 
+	/// Compute bitwise-NOT of 128-bit values.
+	/// @param v Operand
+	/// @return Bitwise-NOT of operand
+	FORCEINLINE CONST m128u32 mm_not_epu32(m128u32 v)
+	{
+		return mm_nor_epu32(v, v);
+	}
+
+	/// @brief PNOR : Parallel NOR
+	/// 
+	/// Compute bitwise-NOT of 128-bit values.
+	/// @param v Operand
+	/// @return Bitwise-NOT of operand
+	FORCEINLINE CONST m128i64 mm_not_epi64(m128i64 v)
+	{
+		return mm_nor_epi64(v, v);
+	}
+
+	/// @brief PNOR : Parallel NOR
+	/// 
+	/// Compute bitwise-NOT of 128-bit values.
+	/// @param v Operand
+	/// @return Bitwise-NOT of operand
+	FORCEINLINE CONST m128u64 mm_not_epu64(m128u64 v)
+	{
+		return mm_nor_epu64(v, v);
+	}
+
+	/// @brief PNOR : Parallel NOR
+	/// 
+	/// Compute bitwise-NOT of 128-bit values.
+	/// @param v Operand
+	/// @return Bitwise-NOT of operand
+	FORCEINLINE CONST m128i128 mm_not_epi128(m128i128 v)
+	{
+		return mm_nor_epi128(v, v);
+	}
+
+	/// @brief PNOR : Parallel NOR
+	/// 
+	/// Compute bitwise-NOT of 128-bit values.
+	/// @param v Operand
+	/// @return Bitwise-NOT of operand
+	FORCEINLINE CONST m128u128 mm_not_epu128(m128u128 v)
+	{
+		return mm_nor_epu128(v, v);
+	}
+
+#ifdef __cplusplus
+}
+#endif
+
+#include "detail/end.h"
@@ -0,0 +1,1453 @@
+#pragma once
+
+/*
+*	LO/HI register access: scalar MFLO/MTLO/MFHI/MTHI on both pipelines and the
+*	multimedia PMFLO/PMTLO/PMFHI/PMTHI/PMFHL/PMTHL transfers.
+*/
+
+#include "common.h"
+
+#include "detail/begin.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+	// LO/HI registers
+
+	/// @brief Construct a 'lohi_state_t' with the current values of the LO/HI registers.
+	/// 
+	/// Optional, provided as a way of accessing those registers without first setting values.
+	/// Obtained values are unspecified. They depend on preceding code and can change depending
+	/// on compiler optimization.
+	/// 
+	/// This function reads global state (LO/HI).
+	/// @param state Additional state used in safe mode. May not be NULL.
+	FORCEINLINE REPRODUCIBLE void lohi_state_construct(lohi_state_t* state)
+	{
+#ifdef PS2INTRIN_UNSAFE
+		(void)state;
+#elif defined(PS2INTRIN_HOST)
+		// There are no LO/HI registers to read on the host, start with 0.
+		state->lo[0] = 0;
+		state->lo[1] = 0;
+		state->hi[0] = 0;
+		state->hi[1] = 0;
+#else
+		asm volatile(	/* must be volatile so gcc cannot assume the values are always the same	*/
+			"pmflo	%[Lo0]\n\t"
+			"pmfhi	%[Hi0]\n\t"
+			"pcpyud	%[Lo1],%[Lo0],%[Lo0]\n\t"
+			"pcpyud	%[Hi1],%[Hi0],%[Hi0]"
+			: [Lo0] "=r" (state->lo[0]),									/* output operands	*/
+			  [Lo1] "=r" (state->lo[1]),
+			  [Hi0] "=r" (state->hi[0]),
+			  [Hi1] "=r" (state->hi[1])
+		);
+#endif
+	}
+
+	/// @brief Destroy a 'lohi_state_t' by writing back the contained values to the LO/HI
+	/// registers.
+	/// 
+	/// Optional, provided as a way of accessing those registers while affecting global state.
+	/// Effect of written vales is unspecified and depends on following code. Can change depending
+	/// on compiler optimizations.
+	/// 
+	/// This function writes global state (LO/HI).
+	/// @param state Additional state used in safe mode. May not be NULL.
+	FORCEINLINE void lohi_state_destruct(lohi_state_t* state)
+	{
+#ifdef PS2INTRIN_UNSAFE
+		(void)state;
+#elif defined(PS2INTRIN_HOST)
+		(void)state;
+#else
+		asm volatile(			/* must be volatile so gcc cannot discard an unused store	*/
+			"pcpyld	%[Lo0],%[Lo1],%[Lo0]\n\t"
+			"pcpyld	%[Hi0],%[Hi1],%[Hi0]\n\t"
+			"pmtlo	%[Lo0]\n\t"
+			"pmthi	%[Hi0]"
+			:															/* output operands	*/
+			: [Lo0] "r" (state->lo[0]),									/* input opoerands	*/
+			  [Lo1] "r" (state->lo[1]),
+			  [Hi0] "r" (state->hi[0]),
+			  [Hi1] "r" (state->hi[1])
+			: "lo", "hi"														/* clobbers	*/
+		);
+#endif
+	}
+
+	/// @brief MTLO : Move To LO register
+	/// 
+	/// Set LO0 to 0.
+	/// 
+	/// This function writes to global state (LO0).
+	/// @param state Additional state used in safe mode. May not be NULL.
+	FORCEINLINE void setzero_lo0(lohi_state_t* state)
+	{
+#ifdef PS2INTRIN_UNSAFE
+		(void)state;
+
+		// implicitly volatile
+		asm(
+			"mtlo	$0"
+			:										/* output operands	*/
+			:										/* input operands	*/
+			: "lo"									/* clobbers lo register	*/
+		);
+#else
+		state->lo[0] = 0;
+#endif
+	}
+
+	/// @brief MTHI : Move To HI register
+	/// 
+	/// Set HI0 to 0.
+	/// 
+	/// This function writes to global state (HI0).
+	/// @param state Additional state used in safe mode. May not be NULL.
+	FORCEINLINE void setzero_hi0(lohi_state_t* state)
+	{
+#ifdef PS2INTRIN_UNSAFE
+		(void)state;
+
+		// implicitly volatile
+		asm(
+			"mthi	$0"
+			:										/* output operands	*/
+			:										/* input operands	*/
+			: "hi"									/* clobbers hi register	*/
+		);
+#else
+		state->hi[0] = 0;
+#endif
+	}
+
+	/// @brief MTLO1 : Move To LO1 register
+	/// 
+	/// Set LO1 to 0.
+	/// 
+	/// This function writes to global state (LO1).
+	/// @param state Additional state used in safe mode. May not be NULL.
+	FORCEINLINE void setzero_lo1(lohi_state_t* state)
+	{
+#ifdef PS2INTRIN_UNSAFE
+		(void)state;
+
+		// implicitly volatile
+		asm(
+			"mtlo1	$0"
+			:										/* output operands	*/
+			:										/* input operands	*/
+			: "lo"									/* clobbers lo register	*/
+		);
+#else
+		state->lo[1] = 0;
+#endif
+	}
+
+	/// @brief MTHI1 : Move To HI1 register
+	/// 
+	/// Set HI1 to 0.
+	/// 
+	/// This function writes to global state (HI1).
+	/// @param state Additional state used in safe mode. May not be NULL.
+	FORCEINLINE void setzero_hi1(lohi_state_t* state)
+	{
+#ifdef PS2INTRIN_UNSAFE
+		(void)state;
+
+		// implicitly volatile
+		asm(
+			"mthi1	$0"
+			:										/* output operands	*/
+			:										/* input operands	*/
+			: "hi"									/* clobbers hi register	*/
+		);
+#else
+		state->hi[1] = 0;
+#endif
+	}
+
+	/// @brief MTLO : Move To LO register
+	/// MTHI : Move To HI register
+	/// 
+	/// Set LO0 and HI0 to 0.
+	/// 
+	/// This function writes to global state (LO0/HI0).
+	/// @param state Additional state used in safe mode. May not be NULL.
+	FORCEINLINE void setzero_lohi0(lohi_state_t* state)
+	{
+		setzero_lo0(state);
+		setzero_hi0(state);
+	}
+
+	/// @brief MTLO1 : Move To LO1 register
+	/// MTHI1 : Move To HI1 register
+	/// 
+	/// Set LO1 and HI1 to 0.
+	/// 
+	/// This function writes to global state (LO1/HI1).
+	/// @param state Additional state used in safe mode. May not be NULL.
+	FORCEINLINE void setzero_lohi1(lohi_state_t* state)
+	{
+		setzero_lo1(state);
+		setzero_hi1(state);
+	}
+
+
+	/// @brief MFLO : Move From LO register
+	/// 
+	/// Get the value of the LO0 register, treated as a sign-extended 32-bit value.
+	/// 
+	/// This produces a stall if the value is being written to by another instruction and it has
+	/// not finished yet. See functions implementing 'MULT', 'MADD' and 'DIV'.
+	/// 
+	/// This function reads global state (LO0)
+	/// @param state Additional state used in safe mode. May not be NULL.
+	/// @return The value stored in LO0 (LO bits 0..63)
+	FORCEINLINE PURE int32_t load_lo0_32(lohi_state_t* state)
+	{
+#ifdef PS2INTRIN_UNSAFE
+		(void)state;
+
+		int32_t result = 0;
+
+		// I'd like to tell gcc that this asm reads from the LO register but using a variable bound
+		// to the "l" constraint sets LO first and then inserts this asm after. As it stands, this
+		// needs to be declared volatile to ensure gcc doesn't think the result is always the same.
+		asm volatile(
+			"mflo	%[Result]"
+			: [Result] "=r" (result)		// output operands
+		);
+
+		return result;
+#else
+		return (int32_t)((int64_t)state->lo[0]);	// not equivalent, this will fix the high 32 bits
+#endif
+	}
+
+	/// @brief MFLO : Move From LO register
+	/// 
+	/// Get the value of the LO0 register, treated as a 64-bit value.
+	/// 
+	/// This produces a stall if the value is being written to by another instruction and it has
+	/// not finished yet. See functions implementing 'MULT', 'MADD' and 'DIV'.
+	/// 
+	/// This function reads global state (LO0)
+	/// @param state Additional state used in safe mode. May not be NULL.
+	/// @return The value stored in LO0 (LO bits 0..63)
+	FORCEINLINE PURE int64_t load_lo0_64(lohi_state_t* state)
+	{
+#ifdef PS2INTRIN_UNSAFE
+		(void)state;
+
+		int64_t result = 0;
+
+		// I'd like to tell gcc that this asm reads from the LO register but using a variable bound
+		// to the "l" constraint sets LO first and then inserts this asm after. As it stands, this
+		// needs to be declared volatile to ensure gcc doesn't think the result is always the same.
+		asm volatile(
+			"mflo	%[Result]"
+			: [Result] "=r" (result)		// output operands
+		);
+
+		return result;
+#else
+		return (int64_t)state->lo[0];
+#endif
+	}
+
+	/// @brief MFHI : Move From HI register
+	/// 
+	/// Get the value of the HI0 register, treated as a sign-extended 32-bit value.
+	/// 
+	/// This produces a stall if the value is being written to by another instruction and it has
+	/// not finished yet. See functions implementing 'MULT', 'MADD' and 'DIV'.
+	/// 
+	/// This function reads global state (HI0)
+	/// @param state Additional state used in safe mode. May not be NULL.
+	/// @return The value stored in HI0 (HI bits 0..63)
+	FORCEINLINE PURE int32_t load_hi0_32(lohi_state_t* state)
+	{
+#ifdef PS2INTRIN_UNSAFE
+		(void)state;
+
+		int32_t result = 0;
+
+		// I'd like to tell gcc that this asm reads from the HI register but using a variable bound
+		// to the "h" constraint sets HI first and then inserts this asm after. As it stands, this
+		// needs to be declared volatile to ensure gcc doesn't think the result is always the same.
+		asm volatile(
+			"mfhi	%[Result]"
+			: [Result] "=r" (result)		// output operands
+		);
+
+		return result;
+#else
+		return (int32_t)((int64_t)state->hi[0]);	// not equivalent, this will fix the high 32 bits
+#endif
+	}
+
+	/// @brief MFHI : Move From HI register
+	/// 
+	/// Get the value of the HI0 register, treated as a 64-bit value.
+	/// 
+	/// This produces a stall if the value is being written to by another instruction and it has
+	/// not finished yet. See functions implementing 'MULT', 'MADD' and 'DIV'.
+	/// 
+	/// This function reads global state (HI0)
+	/// @param state Additional state used in safe mode. May not be NULL.
+	/// @return The value stored in HI0 (HI bits 0..63)
+	FORCEINLINE PURE int64_t load_hi0_64(lohi_state_t* state)
+	{
+#ifdef PS2INTRIN_UNSAFE
+		(void)state;
+
+		int64_t result = 0;
+
+		// I'd like to tell gcc that this asm reads from the HI register but using a variable bound
+		// to the "h" constraint sets HI first and then inserts this asm after. As it stands, this
+		// needs to be declared volatile to ensure gcc doesn't think the result is always the same.
+		asm volatile(
+			"mfhi	%[Result]"
+			: [Result] "=r" (result)		// output operands
+		);
+
+		return result;
+#else
+		return (int64_t)state->hi[0];
+#endif
+	}
+
+	/// @brief MFLO1 : Move From LO1 register
+	/// 
+	/// Get the value of the LO1 register, treated as a sign-extended 32-bit value.
+	/// 
+	/// This produces a stall if the value is being written to by another instruction and it has
+	/// not finished yet. See functions implementing 'MULT', 'MADD' and 'DIV'.
+	/// 
+	/// This function reads global state (LO1)
+	/// @param state Additional state used in safe mode. May not be NULL.
+	/// @return The value stored in LO1 (LO bits 64..127)
+	FORCEINLINE PURE int32_t load_lo1_32(lohi_state_t* state)
+	{
+#ifdef PS2INTRIN_UNSAFE
+		(void)state;
+
+		int32_t result = 0;
+
+		// I'd like to tell gcc that this asm reads from the LO register but using a variable bound
+		// to the "l" constraint sets LO first and then inserts this asm after. As it stands, this
+		// needs to be declared volatile to ensure gcc doesn't think the result is always the same.
+		asm volatile(
+			"mflo1	%[Result]"
+			: [Result] "=r" (result)		// output operands
+		);
+
+		return result;
+#else
+		return (int32_t)((int64_t)state->lo[1]);	// not equivalent, this will fix the high 32 bits
+#endif
+	}
+
+	/// @brief MFLO1 : Move From LO1 register
+	/// 
+	/// Get the value of the LO1 register, treated as a 64-bit value.
+	/// 
+	/// This produces a stall if the value is being written to by another instruction and it has
+	/// not finished yet. See functions implementing 'MULT', 'MADD' and 'DIV'.
+	/// 
+	/// This function reads global state (LO1)
+	/// @param state Additional state used in safe mode. May not be NULL.
+	/// @return The value stored in LO1 (LO bits 64..127)
+	FORCEINLINE PURE int64_t load_lo1_64(lohi_state_t* state)
+	{
+#ifdef PS2INTRIN_UNSAFE
+		(void)state;
+
+		int64_t result = 0;
+
+		// I'd like to tell gcc that this asm reads from the LO register but using a variable bound
+		// to the "l" constraint sets LO first and then inserts this asm after. As it stands, this
+		// needs to be declared volatile to ensure gcc doesn't think the result is always the same.
+		asm volatile(
+			"mflo1	%[Result]"
+			: [Result] "=r" (result)		// output operands
+		);
+
+		return result;
+#else
+		return (int64_t)state->lo[1];
+#endif
+	}
+
+	/// @brief MFHI1 : Move From HI1 register
+	/// 
+	/// Get the value of the HI1 register, treated as a sign-extended 32-bit value.
+	/// 
+	/// This produces a stall if the value is being written to by another instruction and it has
+	/// not finished yet. See functions implementing 'MULT', 'MADD' and 'DIV'.
+	/// 
+	/// This function reads global state (HI1)
+	/// @param state Additional state used in safe mode. May not be NULL.
+	/// @return The value stored in HI1 (HI bits 64..127)
+	FORCEINLINE PURE int32_t load_hi1_32(lohi_state_t* state)
+	{
+#ifdef PS2INTRIN_UNSAFE
+		(void)state;
+
+		int32_t result = 0;
+
+		// I'd like to tell gcc that this asm reads from the HI register but using a variable bound
+		// to the "h" constraint sets HI first and then inserts this asm after. As it stands, this
+		// needs to be declared volatile to ensure gcc doesn't think the result is always the same.
+		asm volatile(
+			"mfhi1	%[Result]"
+			: [Result] "=r" (result)		// output operands
+		);
+
+		return result;
+#else
+		return (int32_t)((int64_t)state->hi[1]);	// not equivalent, this will fix the high 32 bits
+#endif
+	}
+
+	/// @brief MFHI1 : Move From HI1 register
+	/// 
+	/// Get the value of the HI1 register, treated as a 64-bit value.
+	/// 
+	/// This produces a stall if the value is being written to by another instruction and it has
+	/// not finished yet. See functions implementing 'MULT', 'MADD' and 'DIV'.
+	/// 
+	/// This function reads global state (HI1)
+	/// @param state Additional state used in safe mode. May not be NULL.
+	/// @return The value stored in HI1 (HI bits 64..127)
+	FORCEINLINE PURE int64_t load_hi1_64(lohi_state_t* state)
+	{
+#ifdef PS2INTRIN_UNSAFE
+		(void)state;
+
+		int64_t result = 0;
+
+		// I'd like to tell gcc that this asm reads from the HI register but using a variable bound
+		// to the "h" constraint sets HI first and then inserts this asm after. As it stands, this
+		// needs to be declared volatile to ensure gcc doesn't think the result is always the same.
+		asm volatile(
+			"mfhi1	%[Result]"
+			: [Result] "=r" (result)		// output operands
+		);
+
+		return result;
+#else
+		return (int64_t)state->hi[1];
+#endif
+	}
+
+	/// @brief MFLO : Move From LO register
+	/// MFHI : Move From HI register
+	/// 
+	/// Concatenate the values of LO0 and HI0, each interpreted as a 32-bit integer, into a single
+	/// 64-bit value.
+	/// 
+	/// This produces a stall if the value is being written to by another instruction and it has
+	/// not finished yet. See functions implementing 'MULT', 'MADD' and 'DIV'.
+	/// 
+	/// This function reads global state (LO0/HI0)
+	/// @param state Additional state used in safe mode. May not be NULL.
+	/// @return Concatenated LO and HI register values
+	FORCEINLINE PURE int64_t load_lohi0_32(lohi_state_t* state)
+	{
+		int64_t result = load_hi0_32(state);
+		result <<= 32;
+		result |= load_lo0_32(state);
+		return result;
+	}
+
+	/// @brief MFLO1 : Move From LO1 register
+	/// MFHI1 : Move From HI1 register
+	/// 
+	/// Concatenate the values of LO1 and HI1, each interpreted as a 32-bit integer, into a single
+	/// 64-bit value.
+	/// 
+	/// This produces a stall if the value is being written to by another instruction and it has
+	/// not finished yet. See functions implementing 'MULT', 'MADD' and 'DIV'.
+	/// 
+	/// This function reads global state (LO1/HI1)
+	/// @param state Additional state used in safe mode. May not be NULL.
+	/// @return Concatenated LO and HI register values
+	FORCEINLINE PURE int64_t load_lohi1_32(lohi_state_t* state)
+	{
+		int64_t result = load_hi1_32(state);
+		result <<= 32;
+		result |= load_lo1_32(state);
+		return result;
+	}
+
+
+	/// @brief MTLO : Move To LO register
+	/// 
+	/// Store a value to the LO0 register.
+	/// 
+	/// This function writes to global state (LO0).
+	/// @param state Additional state used in safe mode. May not be NULL.
+	/// @param value Value to store in LO0 (LO bits 0..63)
+	FORCEINLINE void store_lo0(lohi_state_t* state, int64_t value)
+	{
+#ifdef PS2INTRIN_UNSAFE
+		(void)state;
+
+		// I'd like to tell gcc that this asm writes to the LO register but using a variable bound
+		// to the "l" constraint will not be used, discarding the asm statement. As it stands, this
+		// needs to be declared volatile to ensure gcc doesn't think the store is unobserved.
+		asm volatile(					// would be implicitly volatile
+			"mtlo	%[Value]"
+			:							// output operands
+			: [Value] "r" (value)		// input operands
+			: "lo"						// clobbers
+		);
+#else
+		state->lo[0] = value;
+#endif
+	}
+
+	/// @brief MTHI : Move To HI register
+	/// 
+	/// Store a value to the HI0 register.
+	/// 
+	/// This function writes to global state (HI0).
+	/// @param state Additional state used in safe mode. May not be NULL.
+	/// @param value Value to store in HI0 (HI bits 0..63)
+	FORCEINLINE void store_hi0(lohi_state_t* state, int64_t value)
+	{
+#ifdef PS2INTRIN_UNSAFE
+		(void)state;
+
+		// I'd like to tell gcc that this asm writes to the HI register but using a variable bound
+		// to the "h" constraint will not be used, discarding the asm statement. As it stands, this
+		// needs to be declared volatile to ensure gcc doesn't think the store is unobserved.
+		asm volatile(					// would be implicitly volatile
+			"mthi	%[Value]"
+			:							// output operands
+			: [Value] "r" (value)		// input operands
+			: "hi"						// clobbers
+		);
+#else
+		state->hi[0] = value;
+#endif
+	}
+
+	/// @brief MTLO1 : Move To LO1 register
+	/// 
+	/// Store a value to the LO1 register.
+	/// 
+	/// This function writes to global state (LO1).
+	/// @param state Additional state used in safe mode. May not be NULL.
+	/// @param value Value to store in LO1 (LO bits 64..127)
+	FORCEINLINE void store_lo1(lohi_state_t* state, int64_t value)
+	{
+#ifdef PS2INTRIN_UNSAFE
+		(void)state;
+
+		// I'd like to tell gcc that this asm writes to the LO register but using a variable bound
+		// to the "l" constraint will not be used, discarding the asm statement. As it stands, this
+		// needs to be declared volatile to ensure gcc doesn't think the store is unobserved.
+		asm volatile(					// would be implicitly volatile
+			"mtlo1	%[Value]"
+			:							// output operands
+			: [Value] "r" (value)		// input operands
+			: "lo"						// clobbers
+		);
+#else
+		state->lo[1] = value;
+#endif
+	}
+
+	/// @brief MTHI1 : Move To HI1 register
+	/// 
+	/// Store a value to the HI1 register.
+	/// 
+	/// This function writes to global state (HI1).
+	/// @param state Additional state used in safe mode. May not be NULL.
+	/// @param value Value to store in HI1 (HI bits 64..127)
+	FORCEINLINE void store_hi1(lohi_state_t* state, int64_t value)
+	{
+#ifdef PS2INTRIN_UNSAFE
+		(void)state;
+
+		// I'd like to tell gcc that this asm writes to the HI register but using a variable bound
+		// to the "h" constraint will not be used, discarding the asm statement. As it stands, this
+		// needs to be declared volatile to ensure gcc doesn't think the store is unobserved.
+		asm volatile(					// would be implicitly volatile
+			"mthi1	%[Value]"
+			:							// output operands
+			: [Value] "r" (value)		// input operands
+			: "hi"						// clobbers
+		);
+#else
+		state->hi[1] = value;
+#endif
+	}
+
+
+	/// @brief PMFLO : Parallel Move From LO register
+	/// 
+	/// Read the entire LO register and interpret its contents as signed 16-bit integers.
+	/// 
+	/// This function reads global state (LO).
+	/// @param state Additional state used in safe mode. May not be NULL.
+	/// @return The current LO register
+	FORCEINLINE PURE m128i16 mm_loadlo_epi16(lohi_state_t* state)
+	{
+#ifdef PS2INTRIN_UNSAFE
+		(void)state;
+		m128i16 result = {};
+
+		///	volatile for same reason as 'load_lo*'
+		asm volatile(
+			"pmflo	%[Result]"
+			: [Result] "=r" (result.v)
+		);
+
+		return result;
+#else
+		m128i16 result = { state->lo[0], state->lo[1] };
+		return result;
+#endif
+	}
+
+	/// @brief PMFLO : Parallel Move From LO register
+	/// 
+	/// Read the entire LO register and interpret its contents as unsigned 16-bit integers.
+	/// 
+	/// This function reads global state (LO).
+	/// @param state Additional state used in safe mode. May not be NULL.
+	/// @return The current LO register
+	FORCEINLINE PURE m128u16 mm_loadlo_epu16(lohi_state_t* state)
+	{
+		return mm_castepu16_epi16(mm_loadlo_epi16(state));
+	}
+
+	/// @brief PMFLO : Parallel Move From LO register
+	/// 
+	/// Read the entire LO register and interpret its contents as unsigned 16-bit integers.
+	/// 
+	/// This function reads global state (LO).
+	/// @param state Additional state used in safe mode. May not be NULL.
+	/// @return The current LO register
+	FORCEINLINE PURE m128i32 mm_loadlo_epi32(lohi_state_t* state)
+	{
+		return mm_castepi32_epi16(mm_loadlo_epi16(state));
+	}
+
+	/// @brief PMFLO : Parallel Move From LO register
+	/// 
+	/// Read the entire LO register and interpret its contents as unsigned 16-bit integers.
+	/// 
+	/// This function reads global state (LO).
+	/// @param state Additional state used in safe mode. May not be NULL.
+	/// @return The current LO register
+	FORCEINLINE PURE m128u32 mm_loadlo_epu32(lohi_state_t* state)
+	{
+		return mm_castepu32_epi16(mm_loadlo_epi16(state));
+	}
+
+	/// @brief PMFHI : Parallel Move From HI register
+	/// 
+	/// Read the entire HI register and interpret its contents as unsigned 16-bit integers.
+	/// 
+	/// This function reads global state (HI).
+	/// @param state Additional state used in safe mode. May not be NULL.
+	/// @return The current HI register
+	FORCEINLINE PURE m128i16 mm_loadhi_epi16(lohi_state_t* state)
+	{
+#ifdef PS2INTRIN_UNSAFE
+		(void)state;
+		m128i16 result = {};
+
+		///	volatile for same reason as 'load_hi*'
+		asm volatile(
+			"pmfhi	%[Result]"
+			: [Result] "=r" (result.v)
+		);
+
+		return result;
+#else
+		m128i16 result = { state->hi[0], state->hi[1] };
+		return result;
+#endif
+	}
+
+	/// @brief PMFHI : Parallel Move From HI register
+	/// 
+	/// Read the entire HI register and interpret its contents as unsigned 16-bit integers.
+	/// 
+	/// This function reads global state (HI).
+	/// @param state Additional state used in safe mode. May not be NULL.
+	/// @return The current HI register
+	FORCEINLINE PURE m128u16 mm_loadhi_epu16(lohi_state_t* state)
+	{
+		return mm_castepu16_epi16(mm_loadhi_epi16(state));
+	}
+
+	/// @brief PMFHI : Parallel Move From HI register
+	/// 
+	/// Read the entire HI register and interpret its contents as unsigned 16-bit integers.
+	/// 
+	/// This function reads global state (HI).
+	/// @param state Additional state used in safe mode. May not be NULL.
+	/// @return The current HI register
+	FORCEINLINE PURE m128i32 mm_loadhi_epi32(lohi_state_t* state)
+	{
+		return mm_castepi32_epi16(mm_loadhi_epi16(state));
+	}
+
+	/// @brief PMFHI : Parallel Move From HI register
+	/// 
+	/// Read the entire HI register and interpret its contents as unsigned 16-bit integers.
+	/// 
+	/// This function reads global state (HI).
+	/// @param state Additional state used in safe mode. May not be NULL.
+	/// @return The current HI register
+	FORCEINLINE PURE m128u32 mm_loadhi_epu32(lohi_state_t* state)
+	{
+		return mm_castepu32_epi16(mm_loadhi_epi16(state));
+	}
+
+	/// @brief PMFHL.LH : Parallel Move From Hi/Lo register; Lower Halfwords
+	/// 
+	/// Copy contents of both LO and HI registers. Assume LO and HI contain 8 16-bit values
+	/// each, of which only the even positions are used. Store the 4 values from LO to positions
+	/// 0, 1, 4 and 5 of the result. The 4 values from the HI register are put in positions 2, 3,
+	/// 6 and 7. Finally, interpret the result as packed signed 16-bit integers.
+	/// 
+	/// Bitwise reordering:
+	///		Result[ 15,   0]	=	LO[ 15,   0]
+	///		Result[ 31,  16]	=	LO[ 47,  32]
+	///		Result[ 47,  32]	=	HI[ 15,   0]
+	///		Result[ 63,  48]	=	HI[ 47,  32]
+	///		Result[ 79,  64]	=	LO[ 79,  64]
+	///		Result[ 95,  80]	=	LO[111,  96]
+	///		Result[111,  96]	=	HI[ 79,  64]
+	///		Result[127, 112]	=	HI[111,  96]
+	/// 
+	/// This function reads global state (LO/HI).
+	/// @param state Additional state used in safe mode. May not be NULL.
+	/// @return Rearranged values from the LO and HI registers
+	FORCEINLINE PURE m128i16 mm_loadlohi_lower_epi16(lohi_state_t* state)
+	{
+		m128i16 result = {};
+
+#ifdef PS2INTRIN_UNSAFE
+		(void)state;
+
+		///	volatile for same reason as 'load_lo*'
+		asm volatile(
+			"pmfhl.lh	%[Result]"
+			: [Result] "=r" (result.v)
+		);
+#elif defined(PS2INTRIN_HOST)
+		uint16_t lo[8];
+		uint16_t hi[8];
+		uint16_t lanes[8];
+
+		memcpy(lo, state->lo, sizeof(lo));
+		memcpy(hi, state->hi, sizeof(hi));
+		for (int i = 0; i < 8; i += 4)
+		{
+			lanes[i + 0] = lo[i + 0];
+			lanes[i + 1] = lo[i + 2];
+			lanes[i + 2] = hi[i + 0];
+			lanes[i + 3] = hi[i + 2];
+		}
+		memcpy(&result, lanes, sizeof(lanes));
+#else
+		uint64_t tmplo = 0;
+		uint64_t tmphi = 0;
+
+		asm(
+			"pmflo	%[TmpLo]\n\t"
+			"pmfhi	%[TmpHi]\n\t"
+			"pcpyld	%[StateLo0],%[StateLo1],%[StateLo0]\n\t"
+			"pcpyld	%[StateHi0],%[StateHi1],%[StateHi0]\n\t"
+			"pmtlo	%[StateLo0]\n\t"
+			"pmthi	%[StateHi0]\n\t"
+			"pmfhl.lh	%[ResultLo]\n\t"
+			"pcpyud	%[ResultHi],%[ResultLo],%[ResultLo]\n\t"
+			"pmtlo	%[TmpLo]\n\t"
+			"pmthi	%[TmpHi]"
+			: [TmpLo] "=&r" (tmplo),
+			  [TmpHi] "=&r" (tmphi),
+			  [ResultLo] "=r" (result.lo),
+			  [ResultHi] "=r" (result.hi)
+			: [StateLo0] "r" (state->lo[0]),
+			  [StateLo1] "r" (state->lo[1]),
+			  [StateHi0] "r" (state->hi[0]),
+			  [StateHi1] "r" (state->hi[1])
+		);
+#endif
+
+		return result;
+	}
+
+	/// @brief PMFHL.LH : Parallel Move From Hi/Lo register; Lower Halfwords
+	/// 
+	/// Copy contents of both LO and HI registers. Assume LO and HI contain 8 16-bit values
+	/// each, of which only the even positions are used. Store the 4 values from LO to positions
+	/// 0, 1, 4 and 5 of the result. The 4 values from the HI register are put in positions 2, 3,
+	/// 6 and 7. Finally, interpret the result as packed signed 16-bit integers.
+	/// 
+	/// Bitwise reordering:
+	///		Result[ 15,   0]	=	LO[ 15,   0]
+	///		Result[ 31,  16]	=	LO[ 47,  32]
+	///		Result[ 47,  32]	=	HI[ 15,   0]
+	///		Result[ 63,  48]	=	HI[ 47,  32]
+	///		Result[ 79,  64]	=	LO[ 79,  64]
+	///		Result[ 95,  80]	=	LO[111,  96]
+	///		Result[111,  96]	=	HI[ 79,  64]
+	///		Result[127, 112]	=	HI[111,  96]
+	/// 
+	/// This function reads global state (LO/HI).
+	/// @param state Additional state used in safe mode. May not be NULL.
+	/// @return Rearranged values from the LO and HI registers
+	FORCEINLINE PURE m128u16 mm_loadlohi_lower_epu16(lohi_state_t* state)
+	{
+		return mm_castepu16_epi16(mm_loadlohi_lower_epi16(state));
+	}
+
+	/// @brief PMFHL.SH : Parallel Move From Hi/Lo register; Saturate lower Halfwords
+	/// 
+	/// Copy contents of both LO and HI registers. Assume LO and HI contain 4 32-bit values
+	/// each, which get saturated to 16-bit signed values. Store the 4 values from LO to
+	/// positions 0, 1, 4 and 5 of the result. The 4 values from the HI register are put in
+	/// positions 2, 3, 6 and 7. Finally, interpret the result as packed signed 16-bit integers.
+	/// 
+	/// Bitwise reordering:
+	///		Result[ 15,   0]	=	SaturateS16(LO[ 31,   0])
+	///		Result[ 31,  16]	=	SaturateS16(LO[ 63,  32])
+	///		Result[ 47,  32]	=	SaturateS16(HI[ 31,   0])
+	///		Result[ 63,  48]	=	SaturateS16(HI[ 63,  32])
+	///		Result[ 79,  64]	=	SaturateS16(LO[ 95,  64])
+	///		Result[ 95,  80]	=	SaturateS16(LO[127,  96])
+	///		Result[111,  96]	=	SaturateS16(HI[ 95,  64])
+	///		Result[127, 112]	=	SaturateS16(HI[127,  96])
+	/// 
+	/// This function reads global state (LO/HI).
+	/// @param state Additional state used in safe mode. May not be NULL.
+	/// @return Rearranged values from the LO and HI registers
+	FORCEINLINE PURE m128i16 mm_loadslohi_lower_epi16(lohi_state_t* state)
+	{
+		m128i16 result = {};
+
+#ifdef PS2INTRIN_UNSAFE
+		(void)state;
+
+		///	volatile for same reason as 'load_lo*'
+		asm volatile(
+			"pmfhl.sh	%[Result]"
+			: [Result] "=r" (result.v)
+		);
+#elif defined(PS2INTRIN_HOST)
+		int32_t lo[4];
+		int32_t hi[4];
+		int16_t lanes[8];
+
+		memcpy(lo, state->lo, sizeof(lo));
+		memcpy(hi, state->hi, sizeof(hi));
+		for (int i = 0; i < 4; i += 2)
+		{
+			for (int j = 0; j < 2; ++j)
+			{
+				int32_t l = lo[i + j];
+				int32_t h = hi[i + j];
+				lanes[2 * i + j] = (int16_t)(l > INT16_MAX ? INT16_MAX : l < INT16_MIN ? INT16_MIN : l);
+				lanes[2 * i + j + 2] = (int16_t)(h > INT16_MAX ? INT16_MAX : h < INT16_MIN ? INT16_MIN : h);
+			}
+		}
+		memcpy(&result, lanes, sizeof(lanes));
+#else
+		uint64_t tmplo = 0;
+		uint64_t tmphi = 0;
+
+		asm(
+			"pmflo	%[TmpLo]\n\t"
+			"pmfhi	%[TmpHi]\n\t"
+			"pcpyld	%[StateLo0],%[StateLo1],%[StateLo0]\n\t"
+			"pcpyld	%[StateHi0],%[StateHi1],%[StateHi0]\n\t"
+			"pmtlo	%[StateLo0]\n\t"
+			"pmthi	%[StateHi0]\n\t"
+			"pmfhl.sh	%[ResultLo]\n\t"
+			"pcpyud	%[ResultHi],%[ResultLo],%[ResultLo]\n\t"
+			"pmtlo	%[TmpLo]\n\t"
+			"pmthi	%[TmpHi]"
+			: [TmpLo] "=&r" (tmplo),
+			  [TmpHi] "=&r" (tmphi),
+			  [ResultLo] "=r" (result.lo),
+			  [ResultHi] "=r" (result.hi)
+			: [StateLo0] "r" (state->lo[0]),
+			  [StateLo1] "r" (state->lo[1]),
+			  [StateHi0] "r" (state->hi[0]),
+			  [StateHi1] "r" (state->hi[1])
+		);
+#endif
+
+		return result;
+	}
+
+	/// @brief PMFHL.LW : Parallel Move From Hi/Lo register; Lower Words
+	/// 
+	/// Copy contents of both LO and HI registers. Assume LO and HI contain 4 32-bit values
+	/// each, of which only the even positions are used. Store the 2 values from LO to positions
+	/// 0 and 2 of the result. The 2 values from the HI register are put in positions 1 and 3.
+	/// Finally, interpret the result as packed signed 32-bit integers.
+	/// 
+	/// Bitwise reordering:
+	///		Result[ 31,   0]	=	LO[ 31,   0]
+	///		Result[ 63,  32]	=	HI[ 31,   0]
+	///		Result[ 95,  64]	=	LO[ 95,  64]
+	///		Result[127,  96]	=	HI[ 95,  64]
+	/// 
+	/// This function reads global state (LO/HI).
+	/// @param state Additional state used in safe mode. May not be NULL.
+	/// @return Rearranged values from the LO and HI registers
+	FORCEINLINE PURE m128i32 mm_loadlohi_lower_epi32(lohi_state_t* state)
+	{
+		m128i32 result = {};
+
+#ifdef PS2INTRIN_UNSAFE
+		(void)state;
+
+		///	volatile for same reason as 'load_lo*'
+		asm volatile(
+			"pmfhl.lw	%[Result]"
+			: [Result] "=r" (result.v)
+		);
+#elif defined(PS2INTRIN_HOST)
+		uint32_t lo[4];
+		uint32_t hi[4];
+		uint32_t lanes[4];
+
+		memcpy(lo, state->lo, sizeof(lo));
+		memcpy(hi, state->hi, sizeof(hi));
+		lanes[0] = lo[0];
+		lanes[1] = hi[0];
+		lanes[2] = lo[2];
+		lanes[3] = hi[2];
+		memcpy(&result, lanes, sizeof(lanes));
+#else
+		uint64_t tmplo = 0;
+		uint64_t tmphi = 0;
+
+		asm(
+			"pmflo	%[TmpLo]\n\t"
+			"pmfhi	%[TmpHi]\n\t"
+			"pcpyld	%[StateLo0],%[StateLo1],%[StateLo0]\n\t"
+			"pcpyld	%[StateHi0],%[StateHi1],%[StateHi0]\n\t"
+			"pmtlo	%[StateLo0]\n\t"
+			"pmthi	%[StateHi0]\n\t"
+			"pmfhl.lw	%[ResultLo]\n\t"
+			"pcpyud	%[ResultHi],%[ResultLo],%[ResultLo]\n\t"
+			"pmtlo	%[TmpLo]\n\t"
+			"pmthi	%[TmpHi]"
+			: [TmpLo] "=&r" (tmplo),
+			  [TmpHi] "=&r" (tmphi),
+			  [ResultLo] "=r" (result.lo),
+			  [ResultHi] "=r" (result.hi)
+			: [StateLo0] "r" (state->lo[0]),
+			  [StateLo1] "r" (state->lo[1]),
+			  [StateHi0] "r" (state->hi[0]),
+			  [StateHi1] "r" (state->hi[1])
+		);
+#endif
+
+		return result;
+	}
+
+	/// @brief PMFHL.LW : Parallel Move From Hi/Lo register; Lower Words
+	/// 
+	/// Copy contents of both LO and HI registers. Assume LO and HI contain 4 32-bit values
+	/// each, of which only the even positions are used. Store the 2 values from LO to positions
+	/// 0 and 2 of the result. The 2 values from the HI register are put in positions 1 and 3.
+	/// Finally, interpret the result as packed unsigned 32-bit integers.
+	/// 
+	/// Bitwise reordering:
+	///		Result[ 31,   0]	=	LO[ 31,   0]
+	///		Result[ 63,  32]	=	HI[ 31,   0]
+	///		Result[ 95,  64]	=	LO[ 95,  64]
+	///		Result[127,  96]	=	HI[ 95,  64]
+	/// 
+	/// This function reads global state (LO/HI).
+	/// @param state Additional state used in safe mode. May not be NULL.
+	/// @return Rearranged values from the LO and HI registers
+	FORCEINLINE PURE m128u32 mm_loadlohi_lower_epu32(lohi_state_t* state)
+	{
+		return mm_castepu32_epi32(mm_loadlohi_lower_epi32(state));
+	}
+
+	/// @brief PMFHL.SLW : Parallel Move From Hi/Lo register; Saturate lower Words
+	/// 
+	/// Copy contents of both LO and HI registers. Assume LO and HI contain 4 32-bit values
+	/// each, of which only the even positions are used. Concatenate the 32-bit value in HI with
+	/// the corresponding element in LO to 2 temporary 64-bit values. Saturate these values to
+	/// signed 32-bit values, then store them with sign extension as 64-bit signed numbers in the
+	/// result.
+	/// 
+	/// Bitwise reordering: (where '|' means concatenation)
+	///		Result[ 63,   0]	=	SaturateS32(HI[31,  0] | LO[31,  0])
+	///		Result[127,  64]	=	SaturateS32(HI[95, 64] | LO[95, 64])
+	/// 
+	/// This function reads global state (LO/HI).
+	/// @param state Additional state used in safe mode. May not be NULL.
+	/// @return Rearranged values from the LO and HI registers
+	FORCEINLINE PURE m128i64 mm_loadslohi_lower_epi64(lohi_state_t* state)
+	{
+		m128i64 result = {};
+
+#ifdef PS2INTRIN_UNSAFE
+		(void)state;
+
+		///	volatile for same reason as 'load_lo*'
+		asm volatile(
+			"pmfhl.slw	%[Result]"
+			: [Result] "=r" (result.v)
+		);
+#elif defined(PS2INTRIN_HOST)
+		uint64_t lanes[2];
+
+		for (int i = 0; i < 2; ++i)
+		{
+			int64_t both = (int64_t)((state->hi[i] << 32) | (state->lo[i] & 0xFFFFFFFF));
+			lanes[i] = (uint64_t)(both > INT32_MAX ? INT32_MAX : both < INT32_MIN ? INT32_MIN : both);
+		}
+		memcpy(&result, lanes, sizeof(lanes));
+#else
+		uint64_t tmplo = 0;
+		uint64_t tmphi = 0;
+
+		asm(
+			"pmflo	%[TmpLo]\n\t"
+			"pmfhi	%[TmpHi]\n\t"
+			"pcpyld	%[StateLo0],%[StateLo1],%[StateLo0]\n\t"
+			"pcpyld	%[StateHi0],%[StateHi1],%[StateHi0]\n\t"
+			"pmtlo	%[StateLo0]\n\t"
+			"pmthi	%[StateHi0]\n\t"
+			"pmfhl.slw	%[ResultLo]\n\t"
+			"pcpyud	%[ResultHi],%[ResultLo],%[ResultLo]\n\t"
+			"pmtlo	%[TmpLo]\n\t"
+			"pmthi	%[TmpHi]"
+			: [TmpLo] "=&r" (tmplo),
+			  [TmpHi] "=&r" (tmphi),
+			  [ResultLo] "=r" (result.lo),
+			  [ResultHi] "=r" (result.hi)
+			: [StateLo0] "r" (state->lo[0]),
+			  [StateLo1] "r" (state->lo[1]),
+			  [StateHi0] "r" (state->hi[0]),
+			  [StateHi1] "r" (state->hi[1])
+		);
+#endif
+
+		return result;
+	}
+
+	/// @brief PMFHL.UW : Parallel Move From Hi/Lo register; Upper Words
+	/// 
+	/// Copy contents of both LO and HI registers. Assume LO and HI contain 4 32-bit values
+	/// each, of which only the odd positions are used. Store the 2 values from LO to positions
+	/// 0 and 2 of the result. The 2 values from the HI register are put in positions 1 and 3.
+	/// Finally, interpret the result as packed signed 32-bit integers.
+	/// 
+	/// Bitwise reordering:
+	///		Result[ 31,   0]	=	LO[ 63,  32]
+	///		Result[ 63,  32]	=	HI[ 63,  32]
+	///		Result[ 95,  64]	=	LO[127,  96]
+	///		Result[127,  96]	=	HI[127,  96]
+	/// 
+	/// This function reads global state (LO/HI).
+	/// @param state Additional state used in safe mode. May not be NULL.
+	/// @return Rearranged values from the LO and HI registers
+	FORCEINLINE PURE m128i32 mm_loadlohi_upper_epi32(lohi_state_t* state)
+	{
+		m128i32 result = {};
+
+#ifdef PS2INTRIN_UNSAFE
+		(void)state;
+
+		///	volatile for same reason as 'load_lo*'
+		asm volatile(
+			"pmfhl.uw	%[Result]"
+			: [Result] "=r" (result.v)
+		);
+#elif defined(PS2INTRIN_HOST)
+		uint32_t lo[4];
+		uint32_t hi[4];
+		uint32_t lanes[4];
+
+		memcpy(lo, state->lo, sizeof(lo));
+		memcpy(hi, state->hi, sizeof(hi));
+		lanes[0] = lo[1];
+		lanes[1] = hi[1];
+		lanes[2] = lo[3];
+		lanes[3] = hi[3];
+		memcpy(&result, lanes, sizeof(lanes));
+#else
+		uint64_t tmplo = 0;
+		uint64_t tmphi = 0;
+
+		asm(
+			"pmflo	%[TmpLo]\n\t"
+			"pmfhi	%[TmpHi]\n\t"
+			"pcpyld	%[StateLo0],%[StateLo1],%[StateLo0]\n\t"
+			"pcpyld	%[StateHi0],%[StateHi1],%[StateHi0]\n\t"
+			"pmtlo	%[StateLo0]\n\t"
+			"pmthi	%[StateHi0]\n\t"
+			"pmfhl.uw	%[ResultLo]\n\t"
+			"pcpyud	%[ResultHi],%[ResultLo],%[ResultLo]\n\t"
+			"pmtlo	%[TmpLo]\n\t"
+			"pmthi	%[TmpHi]"
+			: [TmpLo] "=&r" (tmplo),
+			  [TmpHi] "=&r" (tmphi),
+			  [ResultLo] "=r" (result.lo),
+			  [ResultHi] "=r" (result.hi)
+			: [StateLo0] "r" (state->lo[0]),
+			  [StateLo1] "r" (state->lo[1]),
+			  [StateHi0] "r" (state->hi[0]),
+			  [StateHi1] "r" (state->hi[1])
+		);
+#endif
+
+		return result;
+	}
+
+	/// @brief PMFHL.UW : Parallel Move From Hi/Lo register; Upper Words
+	/// 
+	/// Copy contents of both LO and HI registers. Assume LO and HI contain 4 32-bit values
+	/// each, of which only the odd positions are used. Store the 2 values from LO to positions
+	/// 0 and 2 of the result. The 2 values from the HI register are put in positions 1 and 3.
+	/// Finally, interpret the result as packed unsigned 32-bit integers.
+	/// 
+	/// Bitwise reordering:
+	///		Result[ 31,   0]	=	LO[ 63,  32]
+	///		Result[ 63,  32]	=	HI[ 63,  32]
+	///		Result[ 95,  64]	=	LO[127,  96]
+	///		Result[127,  96]	=	HI[127,  96]
+	/// 
+	/// This function reads global state (LO/HI).
+	/// @param state Additional state used in safe mode. May not be NULL.
+	/// @return Rearranged values from the LO and HI registers
+	FORCEINLINE PURE m128u32 mm_loadlohi_upper_epu32(lohi_state_t* state)
+	{
+		return mm_castepu32_epi32(mm_loadlohi_upper_epi32(state));
+	}
+
+	/// @brief PMTLO : Parallel Move To LO register
+	/// 
+	/// Store 8 signed 16-bit values to the LO register.
+	/// 
+	/// This function writes to global state (LO).
+	/// @param state Additional state used in safe mode. May not be NULL.
+	/// @param v Value to store to LO
+	FORCEINLINE void mm_storelo_epi16(lohi_state_t* state, m128i16 v)
+	{
+#ifdef PS2INTRIN_UNSAFE
+		// volatile for same reason as store_lo*
+		asm volatile(
+			"pmtlo	%[Value]"
+			:
+			: [Value] "r" (v.v)
+			: "lo"
+		);
+#else
+		state->lo[0] = v.lo;
+		state->lo[1] = v.hi;
+#endif
+	}
+
+	/// @brief PMTLO : Parallel Move To LO register
+	/// 
+	/// Store 8 unsigned 16-bit values to the LO register.
+	/// 
+	/// This function writes to global state (LO).
+	/// @param state Additional state used in safe mode. May not be NULL.
+	/// @param v Value to store to LO
+	FORCEINLINE void mm_storelo_epu16(lohi_state_t* state, m128u16 v)
+	{
+		mm_storelo_epi16(state, mm_castepi16_epu16(v));
+	}
+
+	/// @brief PMTLO : Parallel Move To LO register
+	/// 
+	/// Store 4 signed 32-bit values to the LO register.
+	/// 
+	/// This function writes to global state (LO).
+	/// @param state Additional state used in safe mode. May not be NULL.
+	/// @param v Value to store to LO
+	FORCEINLINE void mm_storelo_epi32(lohi_state_t* state, m128i32 v)
+	{
+		mm_storelo_epi16(state, mm_castepi16_epi32(v));
+	}
+
+	/// @brief PMTLO : Parallel Move To LO register
+	/// 
+	/// Store 4 unsigned 32-bit values to the LO register.
+	/// 
+	/// This function writes to global state (LO).
+	/// @param state Additional state used in safe mode. May not be NULL.
+	/// @param v Value to store to LO
+	FORCEINLINE void mm_storelo_epu32(lohi_state_t* state, m128u32 v)
+	{
+		mm_storelo_epi16(state, mm_castepi16_epu32(v));
+	}
+
+	/// @brief PMTLO : Parallel Move To LO register
+	/// 
+	/// Store 2 signed 64-bit values to the LO register.
+	/// 
+	/// This function writes to global state (LO).
+	/// @param state Additional state used in safe mode. May not be NULL.
+	/// @param v Value to store to LO
+	FORCEINLINE void mm_storelo_epi64(lohi_state_t* state, m128i64 v)
+	{
+		mm_storelo_epi16(state, mm_castepi16_epi64(v));
+	}
+
+	/// @brief PMTLO : Parallel Move To LO register
+	/// 
+	/// Store 2 unsigned 64-bit values to the LO register.
+	/// 
+	/// This function writes to global state (LO).
+	/// @param state Additional state used in safe mode. May not be NULL.
+	/// @param v Value to store to LO
+	FORCEINLINE void mm_storelo_epu64(lohi_state_t* state, m128u64 v)
+	{
+		mm_storelo_epi16(state, mm_castepi16_epu64(v));
+	}
+
+	/// @brief PMTLO : Parallel Move To LO register
+	/// 
+	/// Store 1 signed 128-bit value to the LO register.
+	/// 
+	/// This function writes to global state (LO).
+	/// @param state Additional state used in safe mode. May not be NULL.
+	/// @param v Value to store to LO
+	FORCEINLINE void mm_storelo_epi128(lohi_state_t* state, m128i128 v)
+	{
+		mm_storelo_epi16(state, mm_castepi16_epi128(v));
+	}
+
+	/// @brief PMTLO : Parallel Move To LO register
+	/// 
+	/// Store 1 unsigned 128-bit value to the LO register.
+	/// 
+	/// This function writes to global state (LO).
+	/// @param state Additional state used in safe mode. May not be NULL.
+	/// @param v Value to store to LO
+	FORCEINLINE void mm_storelo_epu128(lohi_state_t* state, m128u128 v)
+	{
+		mm_storelo_epi16(state, mm_castepi16_epu128(v));
+	}
+
+	/// @brief PMTHI : Parallel Move To HI register
+	/// 
+	/// Store 8 signed 16-bit values to the HI register.
+	/// 
+	/// This function writes to global state (HI).
+	/// @param state Additional state used in safe mode. May not be NULL.
+	/// @param v Value to store to HI
+	FORCEINLINE void mm_storehi_epi16(lohi_state_t* state, m128i16 v)
+	{
+#ifdef PS2INTRIN_UNSAFE
+		// volatile for same reason as store_hi*
+		asm volatile(
+			"pmthi	%[Value]"
+			:
+			: [Value] "r" (v.v)
+			: "hi"
+		);
+#else
+		state->hi[0] = v.lo;
+		state->hi[1] = v.hi;
+#endif
+	}
+
+	/// @brief PMTHI : Parallel Move To HI register
+	/// 
+	/// Store 8 unsigned 16-bit values to the HI register.
+	/// 
+	/// This function writes to global state (HI).
+	/// @param state Additional state used in safe mode. May not be NULL.
+	/// @param v Value to store to HI
+	FORCEINLINE void mm_storehi_epu16(lohi_state_t* state, m128u16 v)
+	{
+		mm_storehi_epi16(state, mm_castepi16_epu16(v));
+	}
+
+	/// @brief PMTHI : Parallel Move To HI register
+	/// 
+	/// Store 4 signed 32-bit values to the HI register.
+	/// 
+	/// This function writes to global state (HI).
+	/// @param state Additional state used in safe mode. May not be NULL.
+	/// @param v Value to store to HI
+	FORCEINLINE void mm_storehi_epi32(lohi_state_t* state, m128i32 v)
+	{
+		mm_storehi_epi16(state, mm_castepi16_epi32(v));
+	}
+
+	/// @brief PMTHI : Parallel Move To HI register
+	/// 
+	/// Store 4 unsigned 32-bit values to the HI register.
+	/// 
+	/// This function writes to global state (HI).
+	/// @param state Additional state used in safe mode. May not be NULL.
+	/// @param v Value to store to HI
+	FORCEINLINE void mm_storehi_epu32(lohi_state_t* state, m128u32 v)
+	{
+		mm_storehi_epi16(state, mm_castepi16_epu32(v));
+	}
+
+	/// @brief PMTHI : Parallel Move To HI register
+	/// 
+	/// Store 2 signed 64-bit values to the HI register.
+	/// 
+	/// This function writes to global state (HI).
+	/// @param state Additional state used in safe mode. May not be NULL.
+	/// @param v Value to store to HI
+	FORCEINLINE void mm_storehi_epi64(lohi_state_t* state, m128i64 v)
+	{
+		mm_storehi_epi16(state, mm_castepi16_epi64(v));
+	}
+
+	/// @brief PMTHI : Parallel Move To HI register
+	/// 
+	/// Store 2 unsigned 64-bit values to the HI register.
+	/// 
+	/// This function writes to global state (HI).
+	/// @param state Additional state used in safe mode. May not be NULL.
+	/// @param v Value to store to HI
+	FORCEINLINE void mm_storehi_epu64(lohi_state_t* state, m128u64 v)
+	{
+		mm_storehi_epi16(state, mm_castepi16_epu64(v));
+	}
+
+	/// @brief PMTHI : Parallel Move To HI register
+	/// 
+	/// Store 1 signed 128-bit value to the HI register.
+	/// 
+	/// This function writes to global state (HI).
+	/// @param state Additional state used in safe mode. May not be NULL.
+	/// @param v Value to store to HI
+	FORCEINLINE void mm_storehi_epi128(lohi_state_t* state, m128i128 v)
+	{
+		mm_storehi_epi16(state, mm_castepi16_epi128(v));
+	}
+
+	/// @brief PMTHI : Parallel Move To HI register
+	/// 
+	/// Store 1 unsigned 128-bit value to the HI register.
+	/// 
+	/// This function writes to global state (HI).
+	/// @param state Additional state used in safe mode. May not be NULL.
+	/// @param v Value to store to HI
+	FORCEINLINE void mm_storehi_epu128(lohi_state_t* state, m128u128 v)
+	{
+		mm_storehi_epi16(state, mm_castepi16_epu128(v));
+	}
+
+	/// @brief PMTHL.LW : Parallel Move To Hi/Lo register; Lower Words
+	/// 
+	/// Move 4 32-bit values to both LO and HI registers. Values in even position are moved to
+	/// even positions in the LO register and odd positions are moved to even positions in the HI
+	/// register. Odd positions in both LO and HI are not changed.
+	/// 
+	/// Bitwise reordering:
+	///		LO[ 31,   0]	=	Value[ 31,   0]
+	///		HI[ 31,   0]	=	Value[ 63,  32]
+	///		LO[ 95,  64]	=	Value[ 95,  64]
+	///		HI[ 95,  64]	=	Value[127,  96]
+	/// 
+	/// This function writes to global state (LO/HI).
+	/// @param state Additional state used in safe mode. May not be NULL.
+	/// @param v Packed values to store to LO and HI registers
+	FORCEINLINE void mm_storelohi_epi32(lohi_state_t* state, m128i32 v)
+	{
+#ifdef PS2INTRIN_UNSAFE
+		(void)state;
+
+		// volatile for same reason as store_lo*
+		asm volatile(
+			"pmthl.lw	%[Value]"
+			:
+			: [Value] "r" (v.v)
+			: "lo", "hi"
+		);
+#elif defined(PS2INTRIN_HOST)
+		uint32_t lo[4];
+		uint32_t hi[4];
+		uint32_t lanes[4];
+
+		memcpy(lo, state->lo, sizeof(lo));
+		memcpy(hi, state->hi, sizeof(hi));
+		memcpy(lanes, &v, sizeof(lanes));
+		lo[0] = lanes[0];
+		hi[0] = lanes[1];
+		lo[2] = lanes[2];
+		hi[2] = lanes[3];
+		memcpy(state->lo, lo, sizeof(lo));
+		memcpy(state->hi, hi, sizeof(hi));
+#else
+		uint64_t tmplo = 0;
+		uint64_t tmphi = 0;
+
+		asm(
+			"pmflo	%[TmpLo]\n\t"
+			"pmfhi	%[TmpHi]\n\t"
+			"pcpyld	%[StateLo0],%[StateLo1],%[StateLo0]\n\t"
+			"pcpyld	%[StateHi0],%[StateHi1],%[StateHi0]\n\t"
+			"pmtlo	%[StateLo0]\n\t"
+			"pmthi	%[StateHi0]\n\t"
+			"pcpyld	%[ValueLo],%[ValueHi],%[ValueLo]\n\t"
+			"pmthl.lw	%[ValueLo]\n\t"
+			"pmflo	%[StateLo0]\n\t"
+			"pmfhi	%[StateHi0]\n\t"
+			"pcpyud	%[StateLo1],%[StateLo0],%[StateLo0]\n\t"
+			"pcpyud	%[StateHi1],%[StateHi0],%[StateHi0]\n\t"
+			"pmtlo	%[TmpLo]\n\t"
+			"pmthi	%[TmpHi]"
+			: [TmpLo] "=&r" (tmplo),
+			  [TmpHi] "=&r" (tmphi),
+			  [StateLo0] "+r" (state->lo[0]),
+			  [StateLo1] "+r" (state->lo[1]),
+			  [StateHi0] "+r" (state->hi[0]),
+			  [StateHi1] "+r" (state->hi[1])
+			: [ValueLo] "r" (v.lo),
+			  [ValueHi] "r" (v.hi)
+		);
+#endif
+	}
+
+	/// @brief PMTHL.LW : Parallel Move To Hi/Lo register; Lower Words
+	/// 
+	/// Move 4 32-bit values to both LO and HI registers. Values in even position are moved to
+	/// even positions in the LO register and odd positions are moved to even positions in the HI
+	/// register. Odd positions in both LO and HI are not changed.
+	/// 
+	/// Bitwise reordering:
+	///		LO[ 31,   0]	=	Value[ 31,   0]
+	///		HI[ 31,   0]	=	Value[ 63,  32]
+	///		LO[ 95,  64]	=	Value[ 95,  64]
+	///		HI[ 95,  64]	=	Value[127,  96]
+	/// 
+	/// This function writes to global state (LO/HI).
+	/// @param state Additional state used in safe mode. May not be NULL.
+	/// @param v Packed values to store to LO and HI registers
+	FORCEINLINE void mm_storelohi_epu32(lohi_state_t* state, m128u32 v)
+	{
+		mm_storelohi_epi32(state, mm_castepi32_epu32(v));
+	}
+
+#ifdef __cplusplus
+}
+#endif
+
+#include "detail/end.h"
@@ -0,0 +1,1890 @@
+#pragma once
+
+/*
+*	Scalar multiply, multiply-add and divide on pipelines 0 and 1 (MULT/MADD/DIV and their
+*	unsigned and pipeline 1 variants).
+*/
+
+#include "common.h"
+#include "lohi.h"
+
+#include "detail/begin.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+	// Asynchronous and Pipeline 1 instructions
+
+	/// @brief MULT : MULTiply word
+	/// 
+	/// Multiply 32-bit signed integers.
+	/// 
+	/// This uses the 3-operand version of the instruction, returning the low 32 bits of the 64 bit
+	/// result in a register. Both the LO and HI register are still written to. Use this version if
+	/// you need the low 32 bits of the 64-bit multiplication result.
+	/// 
+	/// Integer multiplication happens asynchonously. Reading the result before it is finished will
+	/// stall the EE Core. This applies to the LO and HI registers as well as the return value of
+	/// this function.
+	/// 
+	/// This function writes to global state (LO0/HI0).
+	/// @param state Additional state used in safe mode. May not be NULL.
+	/// @param a First Multiplicand
+	/// @param b Second Multiplicand
+	/// @return Low 32 bits of the 64 bit multiplication result
+	FORCEINLINE int32_t mullo0_i32_start(lohi_state_t* state, int32_t a, int32_t b)
+	{
+#ifdef PS2INTRIN_UNSAFE
+		(void)state;
+		int32_t lo = 0;
+
+		asm volatile(
+			"mult	%[Lo],%[A],%[B]"
+			: [Lo] "=r" (lo)
+			: [A] "%r" (a),
+			  [B] "r" (b)
+			: "lo", "hi"
+		);
+
+		return lo;
+#elif defined(PS2INTRIN_HOST)
+		int64_t product = (int64_t)a * b;
+
+		state->lo[0] = (uint64_t)(int64_t)(int32_t)product;
+		state->hi[0] = (uint64_t)(int64_t)(int32_t)(product >> 32);
+
+		return (int32_t)product;
+#else
+		int32_t lo = 0;
+		int64_t tmplo = 0;
+		int64_t tmphi = 0;
+
+		asm(
+			"mflo	%[TmpLo]\n\t"
+			"mfhi	%[TmpHi]\n\t"
+			"mult	%[Lo],%[A],%[B]\n\t"
+			"mflo	%[StateLo]\n\t"
+			"mfhi	%[StateHi]\n\t"
+			"mtlo	%[TmpLo]\n\t"
+			"mthi	%[TmpHi]"
+			: [Lo] "=r" (lo),
+			  [TmpLo] "=&r" (tmplo),
+			  [TmpHi] "=&r" (tmphi),
+			  [StateLo] "=r" (state->lo[0]),
+			  [StateHi] "=r" (state->hi[0])
+			: [A] "%r" (a),
+			  [B] "r" (b)
+		);
+
+		return lo;
+#endif
+	}
+
+	/// @brief MULT : MULTiply word
+	/// 
+	/// Multiply 32-bit signed integers.
+	/// 
+	/// This uses the 2-operand version of the instruction, writing only to the LO0 and HI0
+	/// register. Use this version if you are only interested in the high 32 bits of the 64-bit
+	/// multiplication result.
+	/// 
+	/// Integer multiplication happens asynchonously. Reading the result before it is finished will
+	/// stall the EE Core.
+	/// 
+	/// This function writes to global state (LO0/HI0).
+	/// @param state Additional state used in safe mode. May not be NULL.
+	/// @param a First Multiplicand
+	/// @param b Second Multiplicand
+	FORCEINLINE void mulhi0_i32_start(lohi_state_t* state, int32_t a, int32_t b)
+	{
+#ifdef PS2INTRIN_UNSAFE
+		(void)state;
+
+		asm volatile(
+			"mult	%[A],%[B]"
+			: 
+			: [A] "%r" (a),
+			  [B] "r" (b)
+			: "lo", "hi"
+		);
+#elif defined(PS2INTRIN_HOST)
+		int64_t product = (int64_t)a * b;
+
+		state->lo[0] = (uint64_t)(int64_t)(int32_t)product;
+		state->hi[0] = (uint64_t)(int64_t)(int32_t)(product >> 32);
+#else
+		int64_t tmplo = 0;
+		int64_t tmphi = 0;
+
+		asm(
+			"mflo	%[TmpLo]\n\t"
+			"mfhi	%[TmpHi]\n\t"
+			"mult	%[A],%[B]\n\t"
+			"mflo	%[StateLo]\n\t"
+			"mfhi	%[StateHi]\n\t"
+			"mtlo	%[TmpLo]\n\t"
+			"mthi	%[TmpHi]"
+			: [TmpLo] "=&r" (tmplo),
+			  [TmpHi] "=&r" (tmphi),
+			  [StateLo] "=r" (state->lo[0]),
+			  [StateHi] "=r" (state->hi[0])
+			: [A] "%r" (a),
+			  [B] "r" (b)
+		);
+#endif
+	}
+
+	/// @brief MULT : MULTiply word
+	/// 
+	/// Finish an asynchronous multiplication by reading both low and high 32 bits of the 64-bit
+	/// result. Use this function if you started a multiplication using 'mulhi0_i32_start' but do
+	/// want the low 32 bit result after all.
+	/// 
+	/// This function reads global state (LO0/HI0).
+	/// @param state Additional state used in safe mode. May not be NULL.
+	/// @return Struct containing low and high 32 bits of 64-bit multiplication result
+	FORCEINLINE PURE mul_i32_result_t mul0_i32_finish(lohi_state_t* state)
+	{
+		mul_i32_result_t result = { 0, 0 };
+
+		result.lo = load_lo0_32(state);
+		result.hi = load_hi0_32(state);
+
+		return result;
+	}
+
+	/// @brief MULT : MULTiply word
+	/// 
+	/// Finish an asynchronous multiplication by reading the high 32 bits of the 64-bit result,
+	/// reusing the low 32 bits from 'mullo0_i32_start'. Prefer this function if you need both
+	/// parts as a struct.
+	/// 
+	/// This function reads global state (HI0).
+	/// @param state Additional state used in safe mode. May not be NULL.
+	/// @param lo Low 32 bits of multiplication result obtained from 'mullo0_i32_start'
+	/// @return Struct containing low and high 32 bits of 64-bit multiplication result
+	FORCEINLINE PURE mul_i32_result_t mul0_i32_finish_lo(lohi_state_t* state, int32_t lo)
+	{
+		mul_i32_result_t result = { 0, 0 };
+
+		result.lo = lo;
+		result.hi = load_hi0_32(state);
+
+		return result;
+	}
+
+	/// @brief MULT : MULTiply word
+	/// 
+	/// Finish an asynchronous multiplication by reading the high 32 bits of the 64-bit result.
+	/// Prefer this function if you need both parts of the result separately or just the high part.
+	/// 
+	/// This function reads global state (HI0).
+	/// @param state Additional state used in safe mode. May not be NULL.
+	/// @return High 32 bits of 64-bit multiplication result
+	FORCEINLINE PURE int32_t mulhi0_i32_finish(lohi_state_t* state)
+	{
+		return load_hi0_32(state);
+	}
+
+	/// @brief MULT : MULTiply word
+	/// 
+	/// Multiply 32-bit signed integers.
+	/// 
+	/// Helper function to both start and finish a multiplication. This function is known to not
+	/// be optimal in regards to throughput. Refer to the documentation of 'mullo0_i32_start'.
+	/// 
+	/// This function writes to global state (LO0/HI0).
+	/// @param state Additional state used in safe mode. May not be NULL.
+	/// @param a First Multiplicand
+	/// @param b Second Multiplicand
+	/// @return Struct containing low and high 32 bits of 64-bit multiplication result
+	FORCEINLINE mul_i32_result_t mul0_i32(lohi_state_t* state, int32_t a, int32_t b)
+	{
+		return mul0_i32_finish_lo(state, mullo0_i32_start(state, a, b));
+	}
+
+	/// @brief MULTU : MULTiply Unsigned word
+	/// 
+	/// Multiply 32-bit unsigned integers.
+	/// 
+	/// This uses the 3-operand version of the instruction, returning the low 32 bits of the 64 bit
+	/// result in a register. Both the LO and HI register are still written to. Use this version if
+	/// you need the low 32 bits of the 64-bit multiplication result.
+	/// 
+	/// Integer multiplication happens asynchonously. Reading the result before it is finished will
+	/// stall the EE Core. This applies to the LO and HI registers as well as the return value of
+	/// this function.
+	/// 
+	/// This function writes to global state (LO0/HI0).
+	/// @param state Additional state used in safe mode. May not be NULL.
+	/// @param a First Multiplicand
+	/// @param b Second Multiplicand
+	/// @return Low 32 bits of the 64 bit multiplication result
+	FORCEINLINE uint32_t mullo0_u32_start(lohi_state_t* state, uint32_t a, uint32_t b)
+	{
+#ifdef PS2INTRIN_UNSAFE
+		(void)state;
+		int32_t lo = 0;
+
+		asm volatile(
+			"multu	%[Lo],%[A],%[B]"
+			: [Lo] "=r" (lo)
+			: [A] "%r" (a), [B] "r" (b)
+			: "lo", "hi"
+		);
+
+		return lo;
+#elif defined(PS2INTRIN_HOST)
+		uint64_t product = (uint64_t)a * b;
+
+		state->lo[0] = (uint64_t)(int64_t)(int32_t)product;
+		state->hi[0] = (uint64_t)(int64_t)(int32_t)(product >> 32);
+
+		return (uint32_t)product;
+#else
+		int32_t lo = 0;
+		int64_t tmplo = 0;
+		int64_t tmphi = 0;
+
+		asm(
+			"mflo	%[TmpLo]\n\t"
+			"mfhi	%[TmpHi]\n\t"
+			"multu	%[Lo],%[A],%[B]\n\t"
+			"mflo	%[StateLo]\n\t"
+			"mfhi	%[StateHi]\n\t"
+			"mtlo	%[TmpLo]\n\t"
+			"mthi	%[TmpHi]"
+			: [Lo] "=r" (lo),
+			  [TmpLo] "=&r" (tmplo),
+			  [TmpHi] "=&r" (tmphi),
+			  [StateLo] "=r" (state->lo[0]),
+			  [StateHi] "=r" (state->hi[0])
+			: [A] "%r" (a),
+			  [B] "r" (b)
+		);
+
+		return lo;
+#endif
+	}
+
+	/// @brief MULTU : MULTiply Unsigned word
+	/// 
+	/// Multiply 32-bit unsigned integers.
+	/// 
+	/// This uses the 2-operand version of the instruction, writing only to the LO0 and HI0
+	/// register. Use this version if you are only interested in the high 32 bits of the 64-bit
+	/// multiplication result.
+	/// 
+	/// Integer multiplication happens asynchonously. Reading the result before it is finished will
+	/// stall the EE Core.
+	/// 
+	/// This function writes to global state (LO0/HI0).
+	/// @param state Additional state used in safe mode. May not be NULL.
+	/// @param a First Multiplicand
+	/// @param b Second Multiplicand
+	FORCEINLINE void mulhi0_u32_start(lohi_state_t* state, uint32_t a, uint32_t b)
+	{
+#ifdef PS2INTRIN_UNSAFE
+		(void)state;
+
+		asm volatile(
+			"multu	%[A],%[B]"
+			:
+			: [A] "%r" (a),
+			  [B] "r" (b)
+			: "lo", "hi"
+		);
+#elif defined(PS2INTRIN_HOST)
+		uint64_t product = (uint64_t)a * b;
+
+		state->lo[0] = (uint64_t)(int64_t)(int32_t)product;
+		state->hi[0] = (uint64_t)(int64_t)(int32_t)(product >> 32);
+#else
+		int64_t tmplo = 0;
+		int64_t tmphi = 0;
+
+		asm(
+			"mflo	%[TmpLo]\n\t"
+			"mfhi	%[TmpHi]\n\t"
+			"multu	%[A],%[B]\n\t"
+			"mflo	%[StateLo]\n\t"
+			"mfhi	%[StateHi]\n\t"
+			"mtlo	%[TmpLo]\n\t"
+			"mthi	%[TmpHi]"
+			: [TmpLo] "=&r" (tmplo),
+			  [TmpHi] "=&r" (tmphi),
+			  [StateLo] "=r" (state->lo[0]),
+			  [StateHi] "=r" (state->hi[0])
+			: [A] "%r" (a),
+			  [B] "r" (b)
+		);
+#endif
+	}
+
+	/// @brief MULTU : MULTiply Unsigned word
+	/// 
+	/// Finish an asynchronous multiplication by reading both low and high 32 bits of the 64-bit
+	/// result. Use this function if you started a multiplication using 'mulhi0_u32_start' but do
+	/// want the low 32 bit result after all.
+	/// 
+	/// This function reads global state (LO0/HI0).
+	/// @param state Additional state used in safe mode. May not be NULL.
+	/// @return Struct containing low and high 32 bits of 64-bit multiplication result
+	FORCEINLINE PURE mul_u32_result_t mul0_u32_finish(lohi_state_t* state)
+	{
+		mul_u32_result_t result = { 0, 0 };
+
+		result.lo = load_lo0_32(state);
+		result.hi = load_hi0_32(state);
+
+		return result;
+	}
+
+	/// @brief MULTU : MULTiply Unsigned word
+	/// 
+	/// Finish an asynchronous multiplication by reading the high 32 bits of the 64-bit result,
+	/// reusing the low 32 bits from 'mullo0_u32_start'. Prefer this function if you need both
+	/// parts as a struct.
+	/// 
+	/// This function reads global state (HI0).
+	/// @param state Additional state used in safe mode. May not be NULL.
+	/// @param lo Low 32 bits of multiplication result obtained from 'mullo0_u32_start'
+	/// @return Struct containing low and high 32 bits of 64-bit multiplication result
+	FORCEINLINE PURE mul_u32_result_t mul0_u32_finish_lo(lohi_state_t* state, uint32_t lo)
+	{
+		mul_u32_result_t result = { 0, 0 };
+
+		result.lo = lo;
+		result.hi = load_hi0_32(state);
+
+		return result;
+	}
+
+	/// @brief MULTU : MULTiply Unsigned word
+	/// 
+	/// Finish an asynchronous multiplication by reading the high 32 bits of the 64-bit result.
+	/// Prefer this function if you need both parts of the result separately or just the high part.
+	/// 
+	/// This function reads global state (HI0).
+	/// @param state Additional state used in safe mode. May not be NULL.
+	/// @return High 32 bits of 64-bit multiplication result
+	FORCEINLINE PURE uint32_t mulhi0_u32_finish(lohi_state_t* state)
+	{
+		return load_hi0_32(state);
+	}
+
+	/// @brief MULTU : MULTiply Unsigned word
+	/// 
+	/// Multiply 32-bit unsigned integers.
+	/// 
+	/// Helper function to both start and finish a multiplication. This function is known to not
+	/// be optimal in regards to throughput. Refer to the documentation of 'mullo0_u32_start'.
+	/// 
+	/// This function writes to global state (LO0/HI0).
+	/// @param state Additional state used in safe mode. May not be NULL.
+	/// @param a First Multiplicand
+	/// @param b Second Multiplicand
+	/// @return Struct containing low and high 32 bits of 64-bit multiplication result
+	FORCEINLINE mul_u32_result_t mul0_u32(lohi_state_t* state, uint32_t a, uint32_t b)
+	{
+		return mul0_u32_finish_lo(state, mullo0_u32_start(state, a, b));
+	}
+
+	/// @brief MULT1 : MULTiply word pipeline 1
+	/// 
+	/// Multiply 32-bit signed integers.
+	/// 
+	/// This uses the 3-operand version of the instruction, returning the low 32 bits of the 64 bit
+	/// result in a register. Both the LO and HI register are still written to. Use this version if
+	/// you need the low 32 bits of the 64-bit multiplication result.
+	/// 
+	/// Integer multiplication happens asynchonously. Reading the result before it is finished will
+	/// stall the EE Core. This applies to the LO and HI registers as well as the return value of
+	/// this function.
+	/// 
+	/// This function writes to global state (LO1/HI1).
+	/// @param state Additional state used in safe mode. May not be NULL.
+	/// @param a First Multiplicand
+	/// @param b Second Multiplicand
+	/// @return Low 32 bits of the 64 bit multiplication result
+	FORCEINLINE int32_t mullo1_i32_start(lohi_state_t* state, int32_t a, int32_t b)
+	{
+#ifdef PS2INTRIN_UNSAFE
+		(void)state;
+		int32_t lo = 0;
+
+		asm volatile(
+			"mult1	%[Lo],%[A],%[B]"
+			: [Lo] "=r" (lo)
+			: [A] "%r" (a),
+			  [B] "r" (b)
+			: "lo", "hi"
+		);
+
+		return lo;
+#elif defined(PS2INTRIN_HOST)
+		int64_t product = (int64_t)a * b;
+
+		state->lo[1] = (uint64_t)(int64_t)(int32_t)product;
+		state->hi[1] = (uint64_t)(int64_t)(int32_t)(product >> 32);
+
+		return (int32_t)product;
+#else
+		int32_t lo = 0;
+		int64_t tmplo = 0;
+		int64_t tmphi = 0;
+
+		asm(
+			"mflo1	%[TmpLo]\n\t"
+			"mfhi1	%[TmpHi]\n\t"
+			"mult1	%[Lo],%[A],%[B]\n\t"
+			"mflo1	%[StateLo]\n\t"
+			"mfhi1	%[StateHi]\n\t"
+			"mtlo1	%[TmpLo]\n\t"
+			"mthi1	%[TmpHi]"
+			: [Lo] "=r" (lo),
+			  [TmpLo] "=&r" (tmplo),
+			  [TmpHi] "=&r" (tmphi),
+			  [StateLo] "=r" (state->lo[1]),
+			  [StateHi] "=r" (state->hi[1])
+			: [A] "%r" (a),
+			  [B] "r" (b)
+		);
+
+		return lo;
+#endif
+	}
+
+	/// @brief MULT1 : MULTiply word pipeline 1
+	/// 
+	/// Multiply 32-bit signed integers.
+	/// 
+	/// This uses the 2-operand version of the instruction, writing only to the LO0 and HI0
+	/// register. Use this version if you are only interested in the high 32 bits of the 64-bit
+	/// multiplication result.
+	/// 
+	/// Integer multiplication happens asynchonously. Reading the result before it is finished will
+	/// stall the EE Core.
+	/// 
+	/// This function writes to global state (LO1/HI1).
+	/// @param state Additional state used in safe mode. May not be NULL.
+	/// @param a First Multiplicand
+	/// @param b Second Multiplicand
+	FORCEINLINE void mulhi1_i32_start(lohi_state_t* state, int32_t a, int32_t b)
+	{
+#ifdef PS2INTRIN_UNSAFE
+		(void)state;
+
+		asm volatile(
+			"mult1	%[A],%[B]"
+			:
+			: [A] "%r" (a),
+			  [B] "r" (b)
+			: "lo", "hi"
+		);
+#elif defined(PS2INTRIN_HOST)
+		int64_t product = (int64_t)a * b;
+
+		state->lo[1] = (uint64_t)(int64_t)(int32_t)product;
+		state->hi[1] = (uint64_t)(int64_t)(int32_t)(product >> 32);
+#else
+		int64_t tmplo = 0;
+		int64_t tmphi = 0;
+
+		asm(
+			"mflo1	%[TmpLo]\n\t"
+			"mfhi1	%[TmpHi]\n\t"
+			"mult1	%[A],%[B]\n\t"
+			"mflo1	%[StateLo]\n\t"
+			"mfhi1	%[StateHi]\n\t"
+			"mtlo1	%[TmpLo]\n\t"
+			"mthi1	%[TmpHi]"
+			: [TmpLo] "=&r" (tmplo),
+			  [TmpHi] "=&r" (tmphi),
+			  [StateLo] "=r" (state->lo[1]),
+			  [StateHi] "=r" (state->hi[1])
+			: [A] "%r" (a),
+			  [B] "r" (b)
+		);
+#endif
+	}
+
+	/// @brief MULT : MULTiply word word pipeline 1
+	/// 
+	/// Finish an asynchronous multiplication by reading both low and high 32 bits of the 64-bit
+	/// result. Use this function if you started a multiplication using 'mulhi0_i32_start' but do
+	/// want the low 32 bit result after all.
+	/// 
+	/// This function reads global state (LO1/HI1).
+	/// @param state Additional state used in safe mode. May not be NULL.
+	/// @return Struct containing low and high 32 bits of 64-bit multiplication result
+	FORCEINLINE PURE mul_i32_result_t mul1_i32_finish(lohi_state_t* state)
+	{
+		mul_i32_result_t result = { 0, 0 };
+
+		result.lo = load_lo1_32(state);
+		result.hi = load_hi1_32(state);
+
+		return result;
+	}
+
+	/// @brief MULT1 : MULTiply word pipeline 1
+	/// 
+	/// Finish an asynchronous multiplication by reading the high 32 bits of the 64-bit result,
+	/// reusing the low 32 bits from 'mullo1_i32_start'. Prefer this function if you need both
+	/// parts as a struct.
+	/// 
+	/// This function reads global state (HI1).
+	/// @param state Additional state used in safe mode. May not be NULL.
+	/// @param lo Low 32 bits of multiplication result obtained from 'mullo1_i32_start'
+	/// @return Struct containing low and high 32 bits of 64-bit multiplication result
+	FORCEINLINE PURE mul_i32_result_t mul1_i32_finish_lo(lohi_state_t* state, int32_t lo)
+	{
+		mul_i32_result_t result = { 0, 0 };
+
+		result.lo = lo;
+		result.hi = load_hi1_32(state);
+
+		return result;
+	}
+
+	/// @brief MULT1 : MULTiply word pipeline 1
+	/// 
+	/// Finish an asynchronous multiplication by reading the high 32 bits of the 64-bit result.
+	/// Prefer this function if you need both parts of the result separately or just the high part.
+	/// 
+	/// This function reads global state (HI1).
+	/// @param state Additional state used in safe mode. May not be NULL.
+	/// @return High 32 bits of 64-bit multiplication result
+	FORCEINLINE PURE int32_t mulhi1_i32_finish(lohi_state_t* state)
+	{
+		return load_hi1_32(state);
+	}
+
+	/// @brief MULT1 : MULTiply word pipeline 1
+	/// 
+	/// Multiply 32-bit signed integers.
+	/// 
+	/// Helper function to both start and finish a multiplication. This function is known to not
+	/// be optimal in regards to throughput. Refer to the documentation of 'mullo1_i32_start'.
+	/// 
+	/// This function writes to global state (LO1/HI1).
+	/// @param state Additional state used in safe mode. May not be NULL.
+	/// @param a First Multiplicand
+	/// @param b Second Multiplicand
+	/// @return Struct containing low and high 32 bits of 64-bit multiplication result
+	FORCEINLINE mul_i32_result_t mul1_i32(lohi_state_t* state, int32_t a, int32_t b)
+	{
+		return mul1_i32_finish_lo(state, mullo1_i32_start(state, a, b));
+	}
+
+	/// @brief MULTU1 : MULTiply Unsigned word pipeline 1
+	/// 
+	/// Multiply 32-bit unsigned integers.
+	/// 
+	/// This uses the 3-operand version of the instruction, returning the low 32 bits of the 64 bit
+	/// result in a register. Both the LO and HI register are still written to. Use this version if
+	/// you need the low 32 bits of the 64-bit multiplication result.
+	/// 
+	/// Integer multiplication happens asynchonously. Reading the result before it is finished will
+	/// stall the EE Core. This applies to the LO and HI registers as well as the return value of
+	/// this function.
+	/// 
+	/// This function writes to global state (LO1/HI1).
+	/// @param state Additional state used in safe mode. May not be NULL.
+	/// @param a First Multiplicand
+	/// @param b Second Multiplicand
+	/// @return Low 32 bits of the 64 bit multiplication result
+	FORCEINLINE uint32_t mullo1_u32_start(lohi_state_t* state, uint32_t a, uint32_t b)
+	{
+#ifdef PS2INTRIN_UNSAFE
+		(void)state;
+		int32_t lo = 0;
+
+		asm volatile(
+			"multu1	%[Lo],%[A],%[B]"
+			: [Lo] "=r" (lo)
+			: [A] "%r" (a),
+			  [B] "r" (b)
+			: "lo", "hi"
+		);
+
+		return lo;
+#elif defined(PS2INTRIN_HOST)
+		uint64_t product = (uint64_t)a * b;
+
+		state->lo[1] = (uint64_t)(int64_t)(int32_t)product;
+		state->hi[1] = (uint64_t)(int64_t)(int32_t)(product >> 32);
+
+		return (uint32_t)product;
+#else
+		int32_t lo = 0;
+		int64_t tmplo = 0;
+		int64_t tmphi = 0;
+
+		asm(
+			"mflo1	%[TmpLo]\n\t"
+			"mfhi1	%[TmpHi]\n\t"
+			"multu1	%[Lo],%[A],%[B]\n\t"
+			"mflo1	%[StateLo]\n\t"
+			"mfhi1	%[StateHi]\n\t"
+			"mtlo1	%[TmpLo]\n\t"
+			"mthi1	%[TmpHi]"
+			: [Lo] "=r" (lo),
+			  [TmpLo] "=&r" (tmplo),
+			  [TmpHi] "=&r" (tmphi),
+			  [StateLo] "=r" (state->lo[1]),
+			  [StateHi] "=r" (state->hi[1])
+			: [A] "%r" (a),
+			  [B] "r" (b)
+		);
+
+		return lo;
+#endif
+	}
+
+	/// @brief MULTU1 : MULTiply Unsigned word pipeline 1
+	/// 
+	/// Multiply 32-bit unsigned integers.
+	/// 
+	/// This uses the 2-operand version of the instruction, writing only to the LO0 and HI0
+	/// register. Use this version if you are only interested in the high 32 bits of the 64-bit
+	/// multiplication result.
+	/// 
+	/// Integer multiplication happens asynchonously. Reading the result before it is finished will
+	/// stall the EE Core.
+	/// 
+	/// This function writes to global state (LO1/HI1).
+	/// @param state Additional state used in safe mode. May not be NULL.
+	/// @param a First Multiplicand
+	/// @param b Second Multiplicand
+	FORCEINLINE void mulhi1_u32_start(lohi_state_t* state, uint32_t a, uint32_t b)
+	{
+#ifdef PS2INTRIN_UNSAFE
+		(void)state;
+
+		asm volatile(
+			"multu1	%[A],%[B]"
+			:
+			: [A] "%r" (a),
+			  [B] "r" (b)
+			: "lo", "hi"
+		);
+#elif defined(PS2INTRIN_HOST)
+		uint64_t product = (uint64_t)a * b;
+
+		state->lo[1] = (uint64_t)(int64_t)(int32_t)product;
+		state->hi[1] = (uint64_t)(int64_t)(int32_t)(product >> 32);
+#else
+		int64_t tmplo = 0;
+		int64_t tmphi = 0;
+
+		asm(
+			"mflo1	%[TmpLo]\n\t"
+			"mfhi1	%[TmpHi]\n\t"
+			"multu1	%[A],%[B]\n\t"
+			"mflo1	%[StateLo]\n\t"
+			"mfhi1	%[StateHi]\n\t"
+			"mtlo1	%[TmpLo]\n\t"
+			"mthi1	%[TmpHi]"
+			: [TmpLo] "=&r" (tmplo),
+			  [TmpHi] "=&r" (tmphi),
+			  [StateLo] "=r" (state->lo[1]),
+			  [StateHi] "=r" (state->hi[1])
+			: [A] "%r" (a),
+			  [B] "r" (b)
+		);
+#endif
+	}
+
+	/// @brief MULTU1 : MULTiply Unsigned word pipeline 1
+	/// 
+	/// Finish an asynchronous multiplication by reading both low and high 32 bits of the 64-bit
+	/// result. Use this function if you started a multiplication using 'mulhi1_u32_start' but do
+	/// want the low 32 bit result after all.
+	/// 
+	/// This function reads global state (LO1/HI1).
+	/// @param state Additional state used in safe mode. May not be NULL.
+	/// @return Struct containing low and high 32 bits of 64-bit multiplication result
+	FORCEINLINE PURE mul_u32_result_t mul1_u32_finish(lohi_state_t* state)
+	{
+		mul_u32_result_t result = { 0, 0 };
+
+		result.lo = load_lo1_32(state);
+		result.hi = load_hi1_32(state);
+
+		return result;
+	}
+
+	/// @brief MULTU1 : MULTiply Unsigned word pipeline 1
+	/// 
+	/// Finish an asynchronous multiplication by reading the high 32 bits of the 64-bit result,
+	/// reusing the low 32 bits from 'mullo1_u32_start'. Prefer this function if you need both
+	/// parts as a struct.
+	/// 
+	/// This function reads global state (HI1).
+	/// @param state Additional state used in safe mode. May not be NULL.
+	/// @param lo Low 32 bits of multiplication result obtained from 'mullo1_u32_start'
+	/// @return Struct containing low and high 32 bits of 64-bit multiplication result
+	FORCEINLINE PURE mul_u32_result_t mul1_u32_finish_lo(lohi_state_t* state, uint32_t lo)
+	{
+		mul_u32_result_t result = { 0, 0 };
+
+		result.lo = lo;
+		result.hi = load_hi1_32(state);
+
+		return result;
+	}
+
+	/// @brief MULTU1 : MULTiply Unsigned word pipeline 1
+	/// 
+	/// Finish an asynchronous multiplication by reading the high 32 bits of the 64-bit result.
+	/// Prefer this function if you need both parts of the result separately or just the high part.
+	/// 
+	/// This function reads global state (HI1).
+	/// @param state Additional state used in safe mode. May not be NULL.
+	/// @return High 32 bits of 64-bit multiplication result
+	FORCEINLINE PURE uint32_t mulhi1_u32_finish(lohi_state_t* state)
+	{
+		return load_hi1_32(state);
+	}
+
+	/// @brief MULTU1 : MULTiply Unsigned word pipeline 1
+	/// 
+	/// Multiply 32-bit unsigned integers.
+	/// 
+	/// Helper function to both start and finish a multiplication. This function is known to not
+	/// be optimal in regards to throughput. Refer to the documentation of 'mullo1_u32_start'.
+	/// 
+	/// This function writes to global state (LO1/HI1).
+	/// @param state Additional state used in safe mode. May not be NULL.
+	/// @param a First Multiplicand
+	/// @param b Second Multiplicand
+	/// @return Struct containing low and high 32 bits of 64-bit multiplication result
+	FORCEINLINE mul_u32_result_t mul1_u32(lohi_state_t* state, uint32_t a, uint32_t b)
+	{
+		return mul1_u32_finish_lo(state, mullo1_u32_start(state, a, b));
+	}
+
+
+	/// @brief MADD : Multiply-ADD word
+	/// 
+	/// Multiply signed 32-bit values and accumulate into the LO/HI registers.
+	/// 
+	/// This uses the 3 operand form of the instruction. Use this if you only need the low 32 bits
+	/// of the 64-bit accumulator. If you do not need that value use 'fma0_i32' instead.
+	/// 
+	/// Integer fused-multiply-add is processed asynchronously. Attempting to read from LO0, HI0 or
+	/// the return value will cause a stall if this instruction is not finished.
+	/// 
+	/// This function writes to global state (LO0/HI0).
+	/// @param state Additional state used in safe mode. May not be NULL.
+	/// @param a First multiplicand
+	/// @param b Second multiplicand
+	/// @return Low 32 bits (LO0) of the accumulator after the fused-multiply-add operation
+	FORCEINLINE int32_t fma0_i32_lo(lohi_state_t* state, int32_t a, int32_t b)
+	{
+#ifdef PS2INTRIN_UNSAFE
+		(void)state;
+		int32_t lo = 0;
+
+		asm volatile(
+			"madd	%[Lo],%[A],%[B]"
+			: [Lo] "=r" (lo)
+			: [A] "%r" (a),
+			  [B] "r" (b)
+			: "lo", "hi"
+		);
+
+		return lo;
+#elif defined(PS2INTRIN_HOST)
+		uint64_t product = (uint64_t)((int64_t)a * b);
+		uint64_t accumulator = ((state->hi[0] << 32) | (state->lo[0] & 0xFFFFFFFF)) + product;
+
+		state->lo[0] = (uint64_t)(int64_t)(int32_t)accumulator;
+		state->hi[0] = (uint64_t)(int64_t)(int32_t)(accumulator >> 32);
+
+		return (int32_t)accumulator;
+#else
+		int32_t lo = 0;
+		int64_t tmplo = 0;
+		int64_t tmphi = 0;
+
+		asm(
+			"mflo	%[TmpLo]\n\t"
+			"mfhi	%[TmpHi]\n\t"
+			"mtlo	%[StateLo]\n\t"
+			"mthi	%[StateHi]\n\t"
+			"madd	%[Lo],%[A],%[B]\n\t"
+			"mflo	%[StateLo]\n\t"
+			"mfhi	%[StateHi]\n\t"
+			"mtlo	%[TmpLo]\n\t"
+			"mthi	%[TmpHi]"
+			: [Lo] "=r" (lo),
+			  [TmpLo] "=&r" (tmplo),
+			  [TmpHi] "=&r" (tmphi),
+			  [StateLo] "+r" (state->lo[0]),
+			  [StateHi] "+r" (state->hi[0])
+			: [A] "%r" (a),
+			  [B] "r" (b)
+		);
+
+		return lo;
+#endif
+	}
+
+	/// @brief MADD : Multiply-ADD word
+	/// 
+	/// Multiply signed 32-bit values and accumulate into the LO/HI registers.
+	/// 
+	/// This uses the 2 operand form of the instruction. Use this version if you are doing many
+	/// fused-multiply-add with the same accumulator in a loop.
+	/// 
+	/// Integer fused-multiply-add is processed asynchronously. Attempting to read from LO0 or HI0
+	/// will cause a stall if this instruction is not finished.
+	/// 
+	/// This function writes to global state (LO0/HI0).
+	/// @param state Additional state used in safe mode. May not be NULL.
+	/// @param a First multiplicand
+	/// @param b Second multiplicand
+	FORCEINLINE void fma0_i32(lohi_state_t* state, int32_t a, int32_t b)
+	{
+#ifdef PS2INTRIN_UNSAFE
+		(void)state;
+
+		asm volatile(
+			"madd	%[A],%[B]"
+			:
+			: [A] "%r" (a),
+			  [B] "r" (b)
+			: "lo", "hi"
+		);
+#elif defined(PS2INTRIN_HOST)
+		uint64_t product = (uint64_t)((int64_t)a * b);
+		uint64_t accumulator = ((state->hi[0] << 32) | (state->lo[0] & 0xFFFFFFFF)) + product;
+
+		state->lo[0] = (uint64_t)(int64_t)(int32_t)accumulator;
+		state->hi[0] = (uint64_t)(int64_t)(int32_t)(accumulator >> 32);
+#else
+		int64_t tmplo = 0;
+		int64_t tmphi = 0;
+
+		asm(
+			"mflo	%[TmpLo]\n\t"
+			"mfhi	%[TmpHi]\n\t"
+			"mtlo	%[StateLo]\n\t"
+			"mthi	%[StateHi]\n\t"
+			"madd	%[A],%[B]\n\t"
+			"mflo	%[StateLo]\n\t"
+			"mfhi	%[StateHi]\n\t"
+			"mtlo	%[TmpLo]\n\t"
+			"mthi	%[TmpHi]"
+			: [TmpLo] "=&r" (tmplo),
+			  [TmpHi] "=&r" (tmphi),
+			  [StateLo] "+r" (state->lo[0]),
+			  [StateHi] "+r" (state->hi[0])
+			: [A] "%r" (a),
+			  [B] "r" (b)
+		);
+#endif
+	}
+
+	/// @brief MADD : Multiply-ADD word
+	/// 
+	/// Multiply signed 32-bit values and accumulate into the LO/HI registers.
+	/// 
+	/// This uses the 3 operand form of the instruction. The upper part of the accumulator is
+	/// loaded and combined with the low part into a 64-bit result and returned.
+	/// 
+	/// This function is known to be suboptimal in regards to throughput. See documentation of
+	/// 'fma0_i32' for details.
+	/// 
+	/// This function writes to global state (LO0/HI0).
+	/// @param state Additional state used in safe mode. May not be NULL.
+	/// @param a First multiplicand
+	/// @param b Second multiplicand
+	/// @return Struct containing bot the low and high 32 bits of the accumulator after the
+	/// fused-multiply-add operation.
+	FORCEINLINE mul_i32_result_t fma0_i32_finish(lohi_state_t* state, int32_t a, int32_t b)
+	{
+		mul_i32_result_t result = { 0, 0 };
+
+		result.lo = fma0_i32_lo(state, a, b);
+		result.hi = load_hi0_32(state);
+
+		return result;
+	}
+
+	/// @brief MADDU : Multiply-ADD Unsigned word
+	/// 
+	/// Multiply unsigned 32-bit values and accumulate into the LO/HI registers.
+	/// 
+	/// This uses the 3 operand form of the instruction. Use this if you only need the low 32 bits
+	/// of the 64-bit accumulator. If you do not need that value use 'fma0_u32' instead.
+	/// 
+	/// Integer fused-multiply-add is processed asynchronously. Attempting to read from LO0, HI0 or
+	/// the return value will cause a stall if this instruction is not finished.
+	/// 
+	/// This function writes to global state (LO0/HI0).
+	/// @param state Additional state used in safe mode. May not be NULL.
+	/// @param a First multiplicand
+	/// @param b Second multiplicand
+	/// @return Low 32 bits (LO0) of the accumulator after the fused-multiply-add operation
+	FORCEINLINE uint32_t fma0_u32_lo(lohi_state_t* state, uint32_t a, uint32_t b)
+	{
+#ifdef PS2INTRIN_UNSAFE
+		(void)state;
+		int32_t lo = 0;
+
+		asm volatile(
+			"maddu	%[Lo],%[A],%[B]"
+			: [Lo] "=r" (lo)
+			: [A] "%r" (a),
+			  [B] "r" (b)
+			: "lo", "hi"
+		);
+
+		return lo;
+#elif defined(PS2INTRIN_HOST)
+		uint64_t product = (uint64_t)((uint64_t)a * b);
+		uint64_t accumulator = ((state->hi[0] << 32) | (state->lo[0] & 0xFFFFFFFF)) + product;
+
+		state->lo[0] = (uint64_t)(int64_t)(int32_t)accumulator;
+		state->hi[0] = (uint64_t)(int64_t)(int32_t)(accumulator >> 32);
+
+		return (uint32_t)accumulator;
+#else
+		int32_t lo = 0;
+		int64_t tmplo = 0;
+		int64_t tmphi = 0;
+
+		asm(
+			"mflo	%[TmpLo]\n\t"
+			"mfhi	%[TmpHi]\n\t"
+			"mtlo	%[StateLo]\n\t"
+			"mthi	%[StateHi]\n\t"
+			"maddu	%[Lo],%[A],%[B]\n\t"
+			"mflo	%[StateLo]\n\t"
+			"mfhi	%[StateHi]\n\t"
+			"mtlo	%[TmpLo]\n\t"
+			"mthi	%[TmpHi]"
+			: [Lo] "=r" (lo),
+			  [TmpLo] "=&r" (tmplo),
+			  [TmpHi] "=&r" (tmphi),
+			  [StateLo] "+r" (state->lo[0]),
+			  [StateHi] "+r" (state->hi[0])
+			: [A] "%r" (a),
+			  [B] "r" (b)
+		);
+
+		return lo;
+#endif
+	}
+
+	/// @brief MADDU : Multiply-ADD Unsigned word
+	/// 
+	/// Multiply unsigned 32-bit values and accumulate into the LO/HI registers.
+	/// 
+	/// This uses the 2 operand form of the instruction. Use this version if you are doing many
+	/// fused-multiply-add with the same accumulator in a loop.
+	/// 
+	/// Integer fused-multiply-add is processed asynchronously. Attempting to read from LO0 or HI0
+	/// will cause a stall if this instruction is not finished.
+	/// 
+	/// This function writes to global state (LO0/HI0).
+	/// @param state Additional state used in safe mode. May not be NULL.
+	/// @param a First multiplicand
+	/// @param b Second multiplicand
+	FORCEINLINE void fma0_u32(lohi_state_t* state, uint32_t a, uint32_t b)
+	{
+#ifdef PS2INTRIN_UNSAFE
+		(void)state;
+
+		asm volatile(
+			"maddu	%[A],%[B]"
+			:
+			: [A] "%r" (a),
+			  [B] "r" (b)
+			: "lo", "hi"
+		);
+#elif defined(PS2INTRIN_HOST)
+		uint64_t product = (uint64_t)((uint64_t)a * b);
+		uint64_t accumulator = ((state->hi[0] << 32) | (state->lo[0] & 0xFFFFFFFF)) + product;
+
+		state->lo[0] = (uint64_t)(int64_t)(int32_t)accumulator;
+		state->hi[0] = (uint64_t)(int64_t)(int32_t)(accumulator >> 32);
+#else
+		int64_t tmplo = 0;
+		int64_t tmphi = 0;
+
+		asm(
+			"mflo	%[TmpLo]\n\t"
+			"mfhi	%[TmpHi]\n\t"
+			"mtlo	%[StateLo]\n\t"
+			"mthi	%[StateHi]\n\t"
+			"maddu	%[A],%[B]\n\t"
+			"mflo	%[StateLo]\n\t"
+			"mfhi	%[StateHi]\n\t"
+			"mtlo	%[TmpLo]\n\t"
+			"mthi	%[TmpHi]"
+			: [TmpLo] "=&r" (tmplo),
+			  [TmpHi] "=&r" (tmphi),
+			  [StateLo] "+r" (state->lo[0]),
+			  [StateHi] "+r" (state->hi[0])
+			: [A] "%r" (a),
+			  [B] "r" (b)
+		);
+#endif
+	}
+
+	/// @brief MADDU : Multiply-ADD Unsigned word
+	/// 
+	/// Multiply unsigned 32-bit values and accumulate into the LO/HI registers.
+	/// 
+	/// This uses the 3 operand form of the instruction. The upper part of the accumulator is
+	/// loaded and combined with the low part into a 64-bit result and returned.
+	/// 
+	/// This function is known to be suboptimal in regards to throughput. See documentation of
+	/// 'fma0_u32' for details.
+	/// 
+	/// This function writes to global state (LO0/HI0).
+	/// @param state Additional state used in safe mode. May not be NULL.
+	/// @param a First multiplicand
+	/// @param b Second multiplicand
+	/// @return Struct containing bot the low and high 32 bits of the accumulator after the
+	/// fused-multiply-add operation.
+	FORCEINLINE mul_u32_result_t fma0_u32_finish(lohi_state_t* state, uint32_t a, uint32_t b)
+	{
+		mul_u32_result_t result = { 0, 0 };
+
+		result.lo = fma0_u32_lo(state, a, b);
+		result.hi = load_hi0_32(state);
+
+		return result;
+	}
+
+	/// @brief MADD1 : Multiply-ADD word pipeline 1
+	/// 
+	/// Multiply signed 32-bit values and accumulate into the LO/HI registers.
+	/// 
+	/// This uses the 3 operand form of the instruction. Use this if you only need the low 32 bits
+	/// of the 64-bit accumulator. If you do not need that value use 'fma1_i32' instead.
+	/// 
+	/// Integer fused-multiply-add is processed asynchronously. Attempting to read from LO1, HI1 or
+	/// the return value will cause a stall if this instruction is not finished.
+	/// 
+	/// This function writes to global state (LO1/HI1).
+	/// @param state Additional state used in safe mode. May not be NULL.
+	/// @param a First multiplicand
+	/// @param b Second multiplicand
+	/// @return Low 32 bits (LO1) of the accumulator after the fused-multiply-add operation
+	FORCEINLINE int32_t fma1_i32_lo(lohi_state_t* state, int32_t a, int32_t b)
+	{
+#ifdef PS2INTRIN_UNSAFE
+		(void)state;
+		int32_t lo = 0;
+
+		asm volatile(
+			"madd1	%[Lo],%[A],%[B]"
+			: [Lo] "=r" (lo)
+			: [A] "%r" (a),
+			  [B] "r" (b)
+			: "lo", "hi"
+		);
+
+		return lo;
+#elif defined(PS2INTRIN_HOST)
+		uint64_t product = (uint64_t)((int64_t)a * b);
+		uint64_t accumulator = ((state->hi[1] << 32) | (state->lo[1] & 0xFFFFFFFF)) + product;
+
+		state->lo[1] = (uint64_t)(int64_t)(int32_t)accumulator;
+		state->hi[1] = (uint64_t)(int64_t)(int32_t)(accumulator >> 32);
+
+		return (int32_t)accumulator;
+#else
+		int32_t lo = 0;
+		int64_t tmplo = 0;
+		int64_t tmphi = 0;
+
+		asm(
+			"mflo1	%[TmpLo]\n\t"
+			"mfhi1	%[TmpHi]\n\t"
+			"mtlo1	%[StateLo]\n\t"
+			"mthi1	%[StateHi]\n\t"
+			"madd1	%[Lo],%[A],%[B]\n\t"
+			"mflo1	%[StateLo]\n\t"
+			"mfhi1	%[StateHi]\n\t"
+			"mtlo1	%[TmpLo]\n\t"
+			"mthi1	%[TmpHi]"
+			: [Lo] "=r" (lo),
+			  [TmpLo] "=&r" (tmplo),
+			  [TmpHi] "=&r" (tmphi),
+			  [StateLo] "+r" (state->lo[1]),
+			  [StateHi] "+r" (state->hi[1])
+			: [A] "%r" (a),
+			  [B] "r" (b)
+		);
+
+		return lo;
+#endif
+	}
+
+	/// @brief MADD1 : Multiply-ADD word pipeline 1
+	/// 
+	/// Multiply signed 32-bit values and accumulate into the LO/HI registers.
+	/// 
+	/// This uses the 2 operand form of the instruction. Use this version if you are doing many
+	/// fused-multiply-add with the same accumulator in a loop.
+	/// 
+	/// Integer fused-multiply-add is processed asynchronously. Attempting to read from LO1 or HI1
+	/// will cause a stall if this instruction is not finished.
+	/// 
+	/// This function writes to global state (LO1/HI1).
+	/// @param state Additional state used in safe mode. May not be NULL.
+	/// @param a First multiplicand
+	/// @param b Second multiplicand
+	FORCEINLINE void fma1_i32(lohi_state_t* state, int32_t a, int32_t b)
+	{
+#ifdef PS2INTRIN_UNSAFE
+		(void)state;
+
+		asm volatile(
+			"madd1	%[A],%[B]"
+			:
+			: [A] "%r" (a),
+			  [B] "r" (b)
+			: "lo", "hi"
+		);
+#elif defined(PS2INTRIN_HOST)
+		uint64_t product = (uint64_t)((int64_t)a * b);
+		uint64_t accumulator = ((state->hi[1] << 32) | (state->lo[1] & 0xFFFFFFFF)) + product;
+
+		state->lo[1] = (uint64_t)(int64_t)(int32_t)accumulator;
+		state->hi[1] = (uint64_t)(int64_t)(int32_t)(accumulator >> 32);
+#else
+		int64_t tmplo = 0;
+		int64_t tmphi = 0;
+
+		asm(
+			"mflo1	%[TmpLo]\n\t"
+			"mfhi1	%[TmpHi]\n\t"
+			"mtlo1	%[StateLo]\n\t"
+			"mthi1	%[StateHi]\n\t"
+			"madd1	%[A],%[B]\n\t"
+			"mflo1	%[StateLo]\n\t"
+			"mfhi1	%[StateHi]\n\t"
+			"mtlo1	%[TmpLo]\n\t"
+			"mthi1	%[TmpHi]"
+			: [TmpLo] "=&r" (tmplo),
+			  [TmpHi] "=&r" (tmphi),
+			  [StateLo] "+r" (state->lo[1]),
+			  [StateHi] "+r" (state->hi[1])
+			: [A] "%r" (a),
+			  [B] "r" (b)
+		);
+#endif
+	}
+
+	/// @brief MADD1 : Multiply-ADD word pipeline 1
+	/// 
+	/// Multiply signed 32-bit values and accumulate into the LO/HI registers.
+	/// 
+	/// This uses the 3 operand form of the instruction. The upper part of the accumulator is
+	/// loaded and combined with the low part into a 64-bit result and returned.
+	/// 
+	/// This function is known to be suboptimal in regards to throughput. See documentation of
+	/// 'fma1_i32' for details.
+	/// 
+	/// This function writes to global state (LO1/HI1).
+	/// @param state Additional state used in safe mode. May not be NULL.
+	/// @param a First multiplicand
+	/// @param b Second multiplicand
+	/// @return Struct containing bot the low and high 32 bits of the accumulator after the
+	/// fused-multiply-add operation.
+	FORCEINLINE mul_i32_result_t fma1_i32_finish(lohi_state_t* state, int32_t a, int32_t b)
+	{
+		mul_i32_result_t result = { 0, 0 };
+
+		result.lo = fma1_i32_lo(state, a, b);
+		result.hi = load_hi1_32(state);
+
+		return result;
+	}
+
+	/// @brief MADDU1 : Multiply-ADD Unsigned word pipeline 1
+	/// 
+	/// Multiply unsigned 32-bit values and accumulate into the LO/HI registers.
+	/// 
+	/// This uses the 3 operand form of the instruction. Use this if you only need the low 32 bits
+	/// of the 64-bit accumulator. If you do not need that value use 'fma1_u32' instead.
+	/// 
+	/// Integer fused-multiply-add is processed asynchronously. Attempting to read from LO1, HI1 or
+	/// the return value will cause a stall if this instruction is not finished.
+	/// 
+	/// This function writes to global state (LO1/HI1).
+	/// @param state Additional state used in safe mode. May not be NULL.
+	/// @param a First multiplicand
+	/// @param b Second multiplicand
+	/// @return Low 32 bits (LO1) of the accumulator after the fused-multiply-add operation
+	FORCEINLINE uint32_t fma1_u32_lo(lohi_state_t* state, uint32_t a, uint32_t b)
+	{
+#ifdef PS2INTRIN_UNSAFE
+		(void)state;
+		int32_t lo = 0;
+
+		asm volatile(
+			"maddu1	%[Lo],%[A],%[B]"
+			: [Lo] "=r" (lo)
+			: [A] "%r" (a),
+			  [B] "r" (b)
+			: "lo", "hi"
+		);
+
+		return lo;
+#elif defined(PS2INTRIN_HOST)
+		uint64_t product = (uint64_t)((uint64_t)a * b);
+		uint64_t accumulator = ((state->hi[1] << 32) | (state->lo[1] & 0xFFFFFFFF)) + product;
+
+		state->lo[1] = (uint64_t)(int64_t)(int32_t)accumulator;
+		state->hi[1] = (uint64_t)(int64_t)(int32_t)(accumulator >> 32);
+
+		return (uint32_t)accumulator;
+#else
+		int32_t lo = 0;
+		int64_t tmplo = 0;
+		int64_t tmphi = 0;
+
+		asm(
+			"mflo1	%[TmpLo]\n\t"
+			"mfhi1	%[TmpHi]\n\t"
+			"mtlo1	%[StateLo]\n\t"
+			"mthi1	%[StateHi]\n\t"
+			"maddu1	%[Lo],%[A],%[B]\n\t"
+			"mflo1	%[StateLo]\n\t"
+			"mfhi1	%[StateHi]\n\t"
+			"mtlo1	%[TmpLo]\n\t"
+			"mthi1	%[TmpHi]"
+			: [Lo] "=r" (lo),
+			  [TmpLo] "=&r" (tmplo),
+			  [TmpHi] "=&r" (tmphi),
+			  [StateLo] "+r" (state->lo[1]),
+			  [StateHi] "+r" (state->hi[1])
+			: [A] "%r" (a),
+			  [B] "r" (b)
+		);
+
+		return lo;
+#endif
+	}
+
+	/// @brief MADDU1 : Multiply-ADD Unsigned word pipeline 1
+	/// 
+	/// Multiply unsigned 32-bit values and accumulate into the LO/HI registers.
+	/// 
+	/// This uses the 2 operand form of the instruction. Use this version if you are doing many
+	/// fused-multiply-add with the same accumulator in a loop.
+	/// 
+	/// Integer fused-multiply-add is processed asynchronously. Attempting to read from LO1 or HI1
+	/// will cause a stall if this instruction is not finished.
+	/// 
+	/// This function writes to global state (LO1/HI1).
+	/// @param state Additional state used in safe mode. May not be NULL.
+	/// @param a First multiplicand
+	/// @param b Second multiplicand
+	FORCEINLINE void fma1_u32(lohi_state_t* state, uint32_t a, uint32_t b)
+	{
+#ifdef PS2INTRIN_UNSAFE
+		(void)state;
+
+		asm volatile(
+			"maddu1	%[A],%[B]"
+			:
+			: [A] "%r" (a),
+			  [B] "r" (b)
+			: "lo", "hi"
+		);
+#elif defined(PS2INTRIN_HOST)
+		uint64_t product = (uint64_t)((uint64_t)a * b);
+		uint64_t accumulator = ((state->hi[1] << 32) | (state->lo[1] & 0xFFFFFFFF)) + product;
+
+		state->lo[1] = (uint64_t)(int64_t)(int32_t)accumulator;
+		state->hi[1] = (uint64_t)(int64_t)(int32_t)(accumulator >> 32);
+#else
+		int64_t tmplo = 0;
+		int64_t tmphi = 0;
+
+		asm(
+			"mflo1	%[TmpLo]\n\t"
+			"mfhi1	%[TmpHi]\n\t"
+			"mtlo1	%[StateLo]\n\t"
+			"mthi1	%[StateHi]\n\t"
+			"maddu1	%[A],%[B]\n\t"
+			"mflo1	%[StateLo]\n\t"
+			"mfhi1	%[StateHi]\n\t"
+			"mtlo1	%[TmpLo]\n\t"
+			"mthi1	%[TmpHi]"
+			: [TmpLo] "=&r" (tmplo),
+			  [TmpHi] "=&r" (tmphi),
+			  [StateLo] "+r" (state->lo[1]),
+			  [StateHi] "+r" (state->hi[1])
+			: [A] "%r" (a),
+			  [B] "r" (b)
+		);
+#endif
+	}
+
+	/// @brief MADDU1 : Multiply-ADD Unsigned word pipeline 1
+	/// 
+	/// Multiply unsigned 32-bit values and accumulate into the LO/HI registers.
+	/// 
+	/// This uses the 3 operand form of the instruction. The upper part of the accumulator is
+	/// loaded and combined with the low part into a 64-bit result and returned.
+	/// 
+	/// This function is known to be suboptimal in regards to throughput. See documentation of
+	/// 'fma1_u32' for details.
+	/// 
+	/// This function writes to global state (LO1/HI1).
+	/// @param state Additional state used in safe mode. May not be NULL.
+	/// @param a First multiplicand
+	/// @param b Second multiplicand
+	/// @return Struct containing bot the low and high 32 bits of the accumulator after the
+	/// fused-multiply-add operation.
+	FORCEINLINE mul_u32_result_t fma1_u32_finish(lohi_state_t* state, uint32_t a, uint32_t b)
+	{
+		mul_u32_result_t result = { 0, 0 };
+
+		result.lo = fma1_u32_lo(state, a, b);
+		result.hi = load_hi1_32(state);
+
+		return result;
+	}
+
+
+	/// @brief DIV : DIVide word
+	/// 
+	/// Start a division. The results will be stored in the LO0/HI0 registers.
+	/// 
+	/// Division by 0 results in undefined values.
+	/// No exception occurs.
+	/// 
+	/// Dividing INT_MIN by -1 results in INT_MIN as the quotient and 0 as the remainder.
+	/// No overflow exception will occur.
+	/// 
+	/// Result signedness table:
+	///		Dividend	|	Divisor	|	Quotient (LO0)	|	Remainder (HI0)
+	///		+			|	+		|	+				|	+
+	///		+			|	-		|	-				|	+
+	///		-			|	+		|	-				|	-
+	///		-			|	-		|	+				|	-
+	/// 
+	/// As integer division is done asynchronously on the EE Core you should issue the division
+	/// instruction before checking for erroneous inputs like div-by-0 to improve throughput.
+	/// Reading from the result registers (LO0/HI0) will cause a stall if the result is not
+	/// ready at that point in time.
+	/// The Undefined Behaviour definition of C/C++ does not allow a div-by-0 check to happen
+	/// in regular code. The code snippet:
+	/// 
+	///		int foo(int x, int y) {
+	///			int z = x / y;
+	///			if (y == 0) {
+	///				return 0;
+	///			}
+	///			return z;
+	///		}
+	/// 
+	/// would be reduced to 'return x / y;' in all cases. This is because div-by-0 is
+	/// Undefined Behaviour, so it can be assummed to not occur. This means y is never 0 at the
+	/// point of the division and therefor can never be 0 after, which is when it is checked.
+	/// Use this function to get around this limitation. Query the result of the operation using
+	/// 'divrem0_i32_finish'.
+	/// 
+	/// This function writes to global state (LO0/HI0).
+	/// @param state Additional state used in safe mode. May not be NULL.
+	/// @param dividend Number to divide
+	/// @param divisor Number to divide by
+	FORCEINLINE void divrem0_i32_start(lohi_state_t* state, int32_t dividend, int32_t divisor)
+	{
+#ifdef PS2INTRIN_UNSAFE
+		(void)state;
+		// this needs an extra destination $0 register due to a quirk in the compiler
+		asm volatile(
+			"div	$0,%[Dividend],%[Divisor]"
+			:																/* output operands	*/
+			: [Dividend] "r" (dividend),									/* input operands	*/
+			  [Divisor] "r" (divisor)
+			: "lo", "hi"
+		);
+#elif defined(PS2INTRIN_HOST)
+		// Division by 0 and overflow give the same results as on the EE.
+		int32_t quotient = 0;
+		int32_t remainder = 0;
+
+		if (divisor == 0)
+		{
+			quotient = dividend < 0 ? 1 : -1;
+			remainder = dividend;
+		}
+		else if (dividend == INT32_MIN && divisor == -1)
+		{
+			quotient = INT32_MIN;
+			remainder = 0;
+		}
+		else
+		{
+			quotient = dividend / divisor;
+			remainder = dividend % divisor;
+		}
+		state->lo[0] = (uint64_t)(int64_t)quotient;
+		state->hi[0] = (uint64_t)(int64_t)remainder;
+#else
+		uint64_t tmplo = 0;
+		uint64_t tmphi = 0;
+
+		asm(
+			"mflo	%[TmpLo]\n\t"
+			"mfhi	%[TmpHi]\n\t"
+			"div	$0,%[Dividend],%[Divisor]\n\t"
+			"mflo	%[ResLo]\n\t"
+			"mfhi	%[ResHi]\n\t"
+			"mtlo	%[TmpLo]\n\t"
+			"mthi	%[TmpHi]"
+			: [TmpLo] "=&r" (tmplo),
+			  [TmpHi] "=&r" (tmphi),
+			  [ResLo] "=r" (state->lo[0]),
+			  [ResHi] "=r" (state->hi[0])
+			: [Dividend] "r" (dividend),
+			  [Divisor] "r" (divisor)
+		);
+#endif
+	}
+
+	/// @brief DIV : DIVide word
+	/// 
+	/// Finish the division. Results will be read from LO0/HI0 registers.
+	/// 
+	/// See decumentation of 'divrem0_i32_start'.
+	/// 
+	/// This function reads global state (LO0/HI0).
+	/// @param state Additional state used in safe mode. May not be NULL.
+	/// @return struct containing quotient and remainder of preceding division.
+	FORCEINLINE PURE divrem_i32_result_t divrem0_i32_finish(lohi_state_t* state)
+	{
+		divrem_i32_result_t result = { 0, 0 };
+
+		result.quotient = load_lo0_32(state);
+		result.remainder = load_hi0_32(state);
+
+		return result;
+	}
+
+	/// @brief DIV : DIVide word
+	/// 
+	/// Convenience function doing both starting and finishing a division.
+	/// 
+	/// Division by 0 results in undefined results.
+	/// No exception occurs.
+	/// 
+	/// Dividing INT_MIN by -1 results in INT_MIN as the quotient and 0 as the remainder.
+	/// No overflow exception will occur.
+	/// 
+	/// Result signedness table:
+	///		Dividend	|	Divisor	|	Quotient (LO0)	|	Remainder (HI0)
+	///		+			|	+		|	+				|	+
+	///		+			|	-		|	-				|	+
+	///		-			|	+		|	-				|	-
+	///		-			|	-		|	+				|	-
+	/// 
+	/// This function is not optimal in regards to throughput. Refer to the documentation of
+	/// 'divrem0_i32_start'.
+	/// 
+	/// This function writes to global state (LO0/HI0).
+	/// @param state Additional state used in safe mode. May not be NULL.
+	/// @param dividend Number to divide
+	/// @param divisor Number to divide by
+	/// @return struct containing quotient and remainder of division.
+	FORCEINLINE divrem_i32_result_t divrem0_i32(lohi_state_t* state, int32_t dividend, int32_t divisor)
+	{
+		divrem0_i32_start(state, dividend, divisor);
+		return divrem0_i32_finish(state);
+	}
+
+	/// @brief DIVU : DIVide Unsigned word
+	/// 
+	/// Start a division. The results will be stored in the LO0/HI0 registers.
+	/// 
+	/// Division by 0 results in undefined values.
+	/// No exception occurs.
+	/// 
+	/// As integer division is done asynchronously on the EE Core you should issue the division
+	/// instruction before checking for erroneous inputs like div-by-0 to improve throughput.
+	/// Reading from the result registers (LO0/HI0) will cause a stall if the result is not
+	/// ready at that point in time.
+	/// The Undefined Behaviour definition of C/C++ does not allow a div-by-0 check to happen
+	/// in regular code. The code snippet:
+	/// 
+	///		unsigned foo(unsigned x, unsigned y) {
+	///			unsigned z = x / y;
+	///			if (y == 0) {
+	///				return 0;
+	///			}
+	///			return z;
+	///		}
+	/// 
+	/// would be reduced to 'return x / y;' in all cases. This is because div-by-0 is
+	/// Undefined Behaviour, so it can be assummed to not occur. This means y is never 0 at the
+	/// point of the division and therefor can never be 0 after, which is when it is checked.
+	/// Use this function to get around this limitation. Query the result of the operation using
+	/// 'divrem0_u32_finish'.
+	/// 
+	/// This function writes to global state (LO0/HI0).
+	/// @param state Additional state used in safe mode. May not be NULL.
+	/// @param dividend Number to divide
+	/// @param divisor Number to divide by
+	FORCEINLINE void divrem0_u32_start(lohi_state_t* state, uint32_t dividend, uint32_t divisor)
+	{
+#ifdef PS2INTRIN_UNSAFE
+		(void)state;
+		// this needs an extra destination $0 register due to a quirk in the compiler
+		asm volatile(
+			"divu	$0,%[Dividend],%[Divisor]"
+			:																/* output operands	*/
+			: [Dividend] "r" (dividend),									/* input operands	*/
+			  [Divisor] "r" (divisor)
+			: "lo", "hi"
+		);
+#elif defined(PS2INTRIN_HOST)
+		// Division by 0 gives the same results as on the EE.
+		uint32_t quotient = divisor ? dividend / divisor : 0xFFFFFFFF;
+		uint32_t remainder = divisor ? dividend % divisor : dividend;
+
+		state->lo[0] = (uint64_t)(int64_t)(int32_t)quotient;
+		state->hi[0] = (uint64_t)(int64_t)(int32_t)remainder;
+#else
+		uint64_t tmplo = 0;
+		uint64_t tmphi = 0;
+
+		asm(
+			"mflo	%[TmpLo]\n\t"
+			"mfhi	%[TmpHi]\n\t"
+			"divu	$0,%[Dividend],%[Divisor]\n\t"
+			"mflo	%[ResLo]\n\t"
+			"mfhi	%[ResHi]\n\t"
+			"mtlo	%[TmpLo]\n\t"
+			"mthi	%[TmpHi]"
+			: [TmpLo] "=&r" (tmplo),
+			  [TmpHi] "=&r" (tmphi),
+			  [ResLo] "=r" (state->lo[0]),
+			  [ResHi] "=r" (state->hi[0])
+			: [Dividend] "r" (dividend),
+			  [Divisor] "r" (divisor)
+		);
+#endif
+	}
+
+	/// @brief DIVU : DIVide Unsigned word
+	/// 
+	/// Finish the division. Results will be read from LO0/HI0 registers.
+	/// 
+	/// See decumentation of 'divrem0_u32_start'.
+	/// 
+	/// This function reads global state (LO0/HI0).
+	/// @param state Additional state used in safe mode. May not be NULL.
+	/// @return struct containing quotient and remainder of preceding division.
+	FORCEINLINE PURE divrem_u32_result_t divrem0_u32_finish(lohi_state_t* state)
+	{
+		divrem_u32_result_t result = { 0, 0 };
+
+		result.quotient = load_lo0_32(state);
+		result.remainder = load_hi0_32(state);
+
+		return result;
+	}
+
+	/// @brief DIVU : DIVide Unsigned word
+	/// 
+	/// Convenience function doing both starting and finishing a division.
+	/// 
+	/// Division by 0 results in undefined results.
+	/// No exception occurs.
+	/// 
+	/// This function is not optimal in regards to throughput. Refer to the documentation of
+	/// 'divrem0_u32_start'.
+	/// 
+	/// This function writes to global state (LO0/HI0).
+	/// @param state Additional state used in safe mode. May not be NULL.
+	/// @param dividend Number to divide
+	/// @param divisor Number to divide by
+	/// @return struct containing quotient and remainder of division.
+	FORCEINLINE divrem_u32_result_t divrem0_u32(lohi_state_t* state, uint32_t dividend, uint32_t divisor)
+	{
+		divrem0_u32_start(state, dividend, divisor);
+		return divrem0_u32_finish(state);
+	}
+
+	/// @brief DIV1 : Divide Word Pipeline 1
+	/// 
+	/// Start a division. The results will be stored in the LO1/HI1 registers.
+	/// 
+	/// Division by 0 results in undefined results.
+	/// No exception occurs.
+	/// 
+	/// Dividing INT_MIN by -1 results in INT_MIN as the quotient and 0 as the remainder.
+	/// No overflow exception will occur.
+	/// 
+	/// Result signedness table:
+	///		Dividend	|	Divisor	|	Quotient (LO1)	|	Remainder (HI1)
+	///		+			|	+		|	+				|	+
+	///		+			|	-		|	-				|	+
+	///		-			|	+		|	-				|	-
+	///		-			|	-		|	+				|	-
+	/// 
+	/// As integer division is done asynchronously on the EE Core you should issue the division
+	/// instruction before checking for erroneous inputs like div-by-0 to improve throughput.
+	/// Reading from the result registers (LO1/HI1) will cause a stall if the result is not
+	/// ready at that point in time.
+	/// The Undefined Behaviour definition of C/C++ does not allow a div-by-0 check to happen
+	/// in regular code. The code snippet:
+	/// 
+	///		int foo(int x, int y) {
+	///			int z = x / y;
+	///			if (y == 0) {
+	///				return 0;
+	///			}
+	///			return z;
+	///		}
+	/// 
+	/// would be reduced to 'return x / y;' in all cases. This is because div-by-0 is
+	/// Undefined Behaviour, so it can be assummed to not occur. This means y is never 0 at the
+	/// point of the division and therefor can never be 0 after, which is when it is checked.
+	/// Use this function to get around this limitation. Query the result of the operation using
+	/// 'divrem1_i32_finish'.
+	/// 
+	/// This function writes to global state (LO1/HI1).
+	/// @param state Additional state used in safe mode. May not be NULL.
+	/// @param dividend Number to divide
+	/// @param divisor Number to divide by
+	FORCEINLINE void divrem1_i32_start(lohi_state_t* state, int32_t dividend, int32_t divisor)
+	{
+#ifdef PS2INTRIN_UNSAFE
+		(void)state;
+		// this needs an extra destination $0 register due to a quirk in the compiler
+		asm volatile(
+			"div1	$0,%[Dividend],%[Divisor]"
+			:																/* output operands	*/
+			: [Dividend] "r" (dividend),									/* input operands	*/
+			  [Divisor] "r" (divisor)
+			: "lo", "hi"
+		);
+#elif defined(PS2INTRIN_HOST)
+		// Division by 0 and overflow give the same results as on the EE.
+		int32_t quotient = 0;
+		int32_t remainder = 0;
+
+		if (divisor == 0)
+		{
+			quotient = dividend < 0 ? 1 : -1;
+			remainder = dividend;
+		}
+		else if (dividend == INT32_MIN && divisor == -1)
+		{
+			quotient = INT32_MIN;
+			remainder = 0;
+		}
+		else
+		{
+			quotient = dividend / divisor;
+			remainder = dividend % divisor;
+		}
+		state->lo[1] = (uint64_t)(int64_t)quotient;
+		state->hi[1] = (uint64_t)(int64_t)remainder;
+#else
+		uint64_t tmplo = 0;
+		uint64_t tmphi = 0;
+
+		asm(
+			"mflo1	%[TmpLo]\n\t"
+			"mfhi1	%[TmpHi]\n\t"
+			"div1	$0,%[Dividend],%[Divisor]\n\t"
+			"mflo1	%[ResLo]\n\t"
+			"mfhi1	%[ResHi]\n\t"
+			"mtlo1	%[TmpLo]\n\t"
+			"mthi1	%[TmpHi]"
+			: [TmpLo] "=&r" (tmplo),
+			[TmpHi] "=&r" (tmphi),
+			[ResLo] "=r" (state->lo[1]),
+			[ResHi] "=r" (state->hi[1])
+			: [Dividend] "r" (dividend),
+			[Divisor] "r" (divisor)
+		);
+#endif
+	}
+
+	/// @brief DIV1 : Divide Word Pipeline 1
+	/// 
+	/// Finish the division. Results will be read from LO1/HI1 registers.
+	/// 
+	/// See decumentation of 'divrem1_i32_start'.
+	/// 
+	/// This function reads global state (LO1/HI1).
+	/// @param state Additional state used in safe mode. May not be NULL.
+	/// @return struct containing quotient and remainder of preceding division.
+	FORCEINLINE PURE divrem_i32_result_t divrem1_i32_finish(lohi_state_t* state)
+	{
+		divrem_i32_result_t result = { 0, 0 };
+
+		result.quotient = load_lo1_32(state);
+		result.remainder = load_hi1_32(state);
+
+		return result;
+	}
+
+	/// @brief DIV1 : Divide Word Pipeline 1
+	/// 
+	/// Convenience function doing both starting and finishing a pipeline 1 division.
+	/// 
+	/// Division by 0 results in undefined results.
+	/// No exception occurs.
+	/// 
+	/// Dividing INT_MIN by -1 results in INT_MIN as the quotient and 0 as the remainder.
+	/// No overflow exception will occur.
+	/// 
+	/// Result signedness table:
+	///		Dividend	|	Divisor	|	Quotient (LO1)	|	Remainder (HI1)
+	///		+			|	+		|	+				|	+
+	///		+			|	-		|	-				|	+
+	///		-			|	+		|	-				|	-
+	///		-			|	-		|	+				|	-
+	/// 
+	/// This function is not optimal in regards to throughput. Refer to the documentation of
+	/// 'divrem1_i32_start'.
+	/// 
+	/// This function writes to global state (LO1/HI1).
+	/// @param state Additional state used in safe mode. May not be NULL.
+	/// @param dividend Number to divide
+	/// @param divisor Number to divide by
+	/// @return struct containing quotient and remainder of division.
+	FORCEINLINE divrem_i32_result_t divrem1_i32(lohi_state_t* state, int32_t dividend, int32_t divisor)
+	{
+		divrem1_i32_start(state, dividend, divisor);
+		return divrem1_i32_finish(state);
+	}
+
+	/// @brief DIVU1 : DIVide Unsigned word pipeline 1
+	/// 
+	/// Start a division. The results will be stored in the LO1/HI1 registers.
+	/// 
+	/// Division by 0 results in undefined results.
+	/// No exception occurs.
+	/// 
+	/// As integer division is done asynchronously on the EE Core you should issue the division
+	/// instruction before checking for erroneous inputs like div-by-0 to improve throughput.
+	/// Reading from the result registers (LO1/HI1) will cause a stall if the result is not
+	/// ready at that point in time.
+	/// The Undefined Behaviour definition of C/C++ does not allow a div-by-0 check to happen
+	/// in regular code. The code snippet:
+	/// 
+	///		unsigned foo(unsigned x, unsigned y) {
+	///			unsigned z = x / y;
+	///			if (y == 0) {
+	///				return 0;
+	///			}
+	///			return z;
+	///		}
+	/// 
+	/// would be reduced to 'return x / y;' in all cases. This is because div-by-0 is
+	/// Undefined Behaviour, so it can be assummed to not occur. This means y is never 0 at the
+	/// point of the division and therefor can never be 0 after, which is when it is checked.
+	/// Use this function to get around this limitation. Query the result of the operation using
+	/// 'divrem1_i32_finish'.
+	/// 
+	/// This function writes to global state (LO1/HI1).
+	/// @param state Additional state used in safe mode. May not be NULL.
+	/// @param dividend Number to divide
+	/// @param divisor Number to divide by
+	FORCEINLINE void divrem1_u32_start(lohi_state_t* state, uint32_t dividend, uint32_t divisor)
+	{
+#ifdef PS2INTRIN_UNSAFE
+		(void)state;
+		// this needs an extra destination $0 register due to a quirk in the compiler
+		asm volatile(
+			"divu1	$0,%[Dividend],%[Divisor]"
+			:																/* output operands	*/
+			: [Dividend] "r" (dividend),									/* input operands	*/
+			  [Divisor] "r" (divisor)
+			: "lo", "hi"
+		);
+#elif defined(PS2INTRIN_HOST)
+		// Division by 0 gives the same results as on the EE.
+		uint32_t quotient = divisor ? dividend / divisor : 0xFFFFFFFF;
+		uint32_t remainder = divisor ? dividend % divisor : dividend;
+
+		state->lo[1] = (uint64_t)(int64_t)(int32_t)quotient;
+		state->hi[1] = (uint64_t)(int64_t)(int32_t)remainder;
+#else
+		uint64_t tmplo = 0;
+		uint64_t tmphi = 0;
+
+		asm(
+			"mflo1	%[TmpLo]\n\t"
+			"mfhi1	%[TmpHi]\n\t"
+			"divu1	$0,%[Dividend],%[Divisor]\n\t"
+			"mflo1	%[ResLo]\n\t"
+			"mfhi1	%[ResHi]\n\t"
+			"mtlo1	%[TmpLo]\n\t"
+			"mthi1	%[TmpHi]"
+			: [TmpLo] "=&r" (tmplo),
+			  [TmpHi] "=&r" (tmphi),
+			  [ResLo] "=r" (state->lo[1]),
+			  [ResHi] "=r" (state->hi[1])
+			: [Dividend] "r" (dividend),
+			  [Divisor] "r" (divisor)
+		);
+#endif
+	}
+
+	/// @brief DIVU1 : DIVide Unsigned word pipeline 1
+	/// 
+	/// Finish the division. Results will be read from LO1/HI1 registers.
+	/// 
+	/// See decumentation of 'divrem1_i32_start'.
+	/// 
+	/// This function reads global state (LO1/HI1).
+	/// @param state Additional state used in safe mode. May not be NULL.
+	/// @return struct containing quotient and remainder of preceding division.
+	FORCEINLINE PURE divrem_u32_result_t divrem1_u32_finish(lohi_state_t* state)
+	{
+		divrem_u32_result_t result = { 0, 0 };
+
+		result.quotient = load_lo1_32(state);
+		result.remainder = load_hi1_32(state);
+
+		return result;
+	}
+
+	/// @brief DIVU1 : DIVide Unsigned word pipeline 1
+	/// 
+	/// Convenience function doing both starting and finishing a pipeline 1 division.
+	/// 
+	/// Division by 0 results in undefined results.
+	/// No exception occurs.
+	/// 
+	/// This function is not optimal in regards to throughput. Refer to the documentation of
+	/// 'divrem1_u32_start'.
+	/// 
+	/// This function writes to global state (LO1/HI1).
+	/// @param state Additional state used in safe mode. May not be NULL.
+	/// @param dividend Number to divide
+	/// @param divisor Number to divide by
+	/// @return struct containing quotient and remainder of division.
+	FORCEINLINE divrem_u32_result_t divrem1_u32(lohi_state_t* state, uint32_t dividend, uint32_t divisor)
+	{
+		divrem1_u32_start(state, dividend, divisor);
+		return divrem1_u32_finish(state);
+	}
+
+#ifdef __cplusplus
+}
+#endif
+
+#include "detail/end.h"
@@ -0,0 +1,928 @@
+#pragma once
+
+/*
+*	Multimedia extension, interleaving and packing (PEXT/PINT/PPAC, PEXT5/PPAC5).
+*/
+
+#include "common.h"
+
+#include "detail/begin.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+	/// @brief PEXTLB : Parallel EXTend Lower from Byte
+	/// 
+	/// Use only the lower 8 bytes of both operands. Interleave them into the return value such
+	/// that their relative ordering stays intact and the values from 'even' land in the even
+	/// positions and the values from 'odd' land in the odd positions.
+	/// 
+	/// Bitwise result:
+	///		Return value[ 0,  7]	=	even[0,  7]
+	///		Return value[ 8, 15]	=	odd	[0,  7]
+	///		Return value[16, 23]	=	even[8, 15]
+	///		Return value[24, 31]	=	odd	[8, 15]
+	///		...
+	/// @param even Values to put in even positions in the return value
+	/// @param odd Values to put in odd positions in the return value
+	/// @return Interleaved values from both arguments
+	FORCEINLINE CONST m128i8 mm_extlo_epi8(m128i8 even, m128i8 odd)
+	{
+		m128i8 result = {};
+
+#ifdef PS2INTRIN_UNSAFE
+		asm(
+			"pextlb	%[Result],%[Odd],%[Even]"
+			: [Result] "=r" (result.v)
+			: [Even] "r" (even.v),
+			  [Odd] "r" (odd.v)
+		);
+#elif defined(PS2INTRIN_HOST)
+		uint8_t left[16];
+		uint8_t right[16];
+		uint8_t lanes[16];
+
+		memcpy(left, &even, sizeof(left));
+		memcpy(right, &odd, sizeof(right));
+		for (int i = 0; i < 16; ++i)
+		{
+			lanes[i] = (i & 1 ? right : left)[i / 2];
+		}
+		memcpy(&result, lanes, sizeof(lanes));
+#else
+		asm(
+			"pcpyld	%[OddLo],%[OddHi],%[OddLo]\n\t"
+			"pcpyld	%[EvenLo],%[EvenHi],%[EvenLo]\n\t"
+			"pextlb	%[ResultLo],%[OddLo],%[EvenLo]\n\t"
+			"pcpyud	%[ResultHi],%[ResultLo],%[ResultLo]"
+			: [ResultLo] "=r" (result.lo),
+			  [ResultHi] "=&r" (result.hi)
+			: [OddLo] "r" (odd.lo),
+			  [OddHi] "r" (odd.hi),
+			  [EvenLo] "r" (even.lo),
+			  [EvenHi] "r" (even.hi)
+		);
+#endif
+
+		return result;
+	}
+
+	/// @brief PEXTLB : Parallel EXTend Lower from Byte
+	/// 
+	/// Use only the lower 8 bytes of both operands. Interleave them into the return value such
+	/// that their relative ordering stays intact and the values from 'even' land in the even
+	/// positions and the values from 'odd' land in the odd positions.
+	/// 
+	/// Bitwise result:
+	///		Return value[ 0,  7]	=	even[0,  7]
+	///		Return value[ 8, 15]	=	odd	[0,  7]
+	///		Return value[16, 23]	=	even[8, 15]
+	///		Return value[24, 31]	=	odd	[8, 15]
+	///		...
+	/// @param even Values to put in even positions in the return value
+	/// @param odd Values to put in odd positions in the return value
+	/// @return Interleaved values from both arguments
+	FORCEINLINE CONST m128u8 mm_extlo_epu8(m128u8 even, m128u8 odd)
+	{
+		return mm_castepu8_epi8(mm_extlo_epi8(mm_castepi8_epu8(even), mm_castepi8_epu8(odd)));
+	}
+
+	/// @brief PEXTUB : Parallel EXTend Upper from Byte
+	/// 
+	/// Use only the upper 8 bytes of both operands. Interleave them into the return value such
+	/// that their relative ordering stays intact and the values from 'even' land in the even
+	/// positions and the values from 'odd' land in the odd positions.
+	/// 
+	/// Bitwise result:
+	///		Return value[ 0,  7]	=	even[64, 71]
+	///		Return value[ 8, 15]	=	odd	[64, 71]
+	///		Return value[16, 23]	=	even[72, 79]
+	///		Return value[24, 31]	=	odd	[72, 79]
+	///		...
+	/// @param even Values to put in even positions in the return value
+	/// @param odd Values to put in odd positions in the return value
+	/// @return Interleaved values from both arguments
+	FORCEINLINE CONST m128i8 mm_exthi_epi8(m128i8 even, m128i8 odd)
+	{
+		m128i8 result = {};
+
+#ifdef PS2INTRIN_UNSAFE
+		asm(
+			"pextub	%[Result],%[Odd],%[Even]"
+			: [Result] "=r" (result.v)
+			: [Even] "r" (even.v),
+			  [Odd] "r" (odd.v)
+		);
+#elif defined(PS2INTRIN_HOST)
+		uint8_t left[16];
+		uint8_t right[16];
+		uint8_t lanes[16];
+
+		memcpy(left, &even, sizeof(left));
+		memcpy(right, &odd, sizeof(right));
+		for (int i = 0; i < 16; ++i)
+		{
+			lanes[i] = (i & 1 ? right : left)[8 + i / 2];
+		}
+		memcpy(&result, lanes, sizeof(lanes));
+#else
+		asm(
+			"pcpyld	%[OddLo],%[OddHi],%[OddLo]\n\t"
+			"pcpyld	%[EvenLo],%[EvenHi],%[EvenLo]\n\t"
+			"pextub	%[ResultLo],%[OddLo],%[EvenLo]\n\t"
+			"pcpyud	%[ResultHi],%[ResultLo],%[ResultLo]"
+			: [ResultLo] "=r" (result.lo),
+			  [ResultHi] "=&r" (result.hi)
+			: [OddLo] "r" (odd.lo),
+			  [OddHi] "r" (odd.hi),
+			  [EvenLo] "r" (even.lo),
+			  [EvenHi] "r" (even.hi)
+		);
+#endif
+
+		return result;
+	}
+
+	/// @brief PEXTUB : Parallel EXTend Upper from Byte
+	/// 
+	/// Use only the upper 8 bytes of both operands. Interleave them into the return value such
+	/// that their relative ordering stays intact and the values from 'even' land in the even
+	/// positions and the values from 'odd' land in the odd positions.
+	/// 
+	/// Bitwise result:
+	///		Return value[ 0,  7]	=	even[64, 71]
+	///		Return value[ 8, 15]	=	odd	[64, 71]
+	///		Return value[16, 23]	=	even[72, 79]
+	///		Return value[24, 31]	=	odd	[72, 79]
+	///		...
+	/// @param even Values to put in even positions in the return value
+	/// @param odd Values to put in odd positions in the return value
+	/// @return Interleaved values from both arguments
+	FORCEINLINE CONST m128u8 mm_exthi_epu8(m128u8 even, m128u8 odd)
+	{
+		return mm_castepu8_epi8(mm_exthi_epi8(mm_castepi8_epu8(even), mm_castepi8_epu8(odd)));
+	}
+
+	/// @brief PEXTLH : Parallel EXTend Lower from Halfword
+	/// 
+	/// Use only the lower 4 halfwords of both operands. Interleave them into the return value
+	/// such that their relative ordering stays intact and the values from 'even' land in the even
+	/// positions and the values from 'odd' land in the odd positions.
+	/// 
+	/// Bitwise result:
+	///		Return value[ 0, 15]	=	even[ 0, 15]
+	///		Return value[16, 31]	=	odd	[ 0, 15]
+	///		Return value[32, 47]	=	even[16, 31]
+	///		Return value[48, 63]	=	odd	[16, 31]
+	///		...
+	/// @param even Values to put in even positions in the return value
+	/// @param odd Values to put in odd positions in the return value
+	/// @return Interleaved values from both arguments
+	FORCEINLINE CONST m128i16 mm_extlo_epi16(m128i16 even, m128i16 odd)
+	{
+		m128i16 result = {};
+
+#ifdef PS2INTRIN_UNSAFE
+		asm(
+			"pextlh	%[Result],%[Odd],%[Even]"
+			: [Result] "=r" (result.v)
+			: [Even] "r" (even.v),
+			  [Odd] "r" (odd.v)
+		);
+#elif defined(PS2INTRIN_HOST)
+		uint16_t left[8];
+		uint16_t right[8];
+		uint16_t lanes[8];
+
+		memcpy(left, &even, sizeof(left));
+		memcpy(right, &odd, sizeof(right));
+		for (int i = 0; i < 8; ++i)
+		{
+			lanes[i] = (i & 1 ? right : left)[i / 2];
+		}
+		memcpy(&result, lanes, sizeof(lanes));
+#else
+		asm(
+			"pcpyld	%[OddLo],%[OddHi],%[OddLo]\n\t"
+			"pcpyld	%[EvenLo],%[EvenHi],%[EvenLo]\n\t"
+			"pextlh	%[ResultLo],%[OddLo],%[EvenLo]\n\t"
+			"pcpyud	%[ResultHi],%[ResultLo],%[ResultLo]"
+			: [ResultLo] "=r" (result.lo),
+			  [ResultHi] "=&r" (result.hi)
+			: [OddLo] "r" (odd.lo),
+			  [OddHi] "r" (odd.hi),
+			  [EvenLo] "r" (even.lo),
+			  [EvenHi] "r" (even.hi)
+		);
+#endif
+
+		return result;
+	}
+
+	/// @brief PEXTLH : Parallel EXTend Lower from Halfword
+	/// 
+	/// Use only the lower 4 halfwords of both operands. Interleave them into the return value
+	/// such that their relative ordering stays intact and the values from 'even' land in the even
+	/// positions and the values from 'odd' land in the odd positions.
+	/// 
+	/// Bitwise result:
+	///		Return value[ 0, 15]	=	even[ 0, 15]
+	///		Return value[16, 31]	=	odd	[ 0, 15]
+	///		Return value[32, 47]	=	even[16, 31]
+	///		Return value[48, 63]	=	odd	[16, 31]
+	///		...
+	/// @param even Values to put in even positions in the return value
+	/// @param odd Values to put in odd positions in the return value
+	/// @return Interleaved values from both arguments
+	FORCEINLINE CONST m128u16 mm_extlo_epu16(m128u16 even, m128u16 odd)
+	{
+		return mm_castepu16_epi16(mm_extlo_epi16(mm_castepi16_epu16(even), mm_castepi16_epu16(odd)));
+	}
+
+	/// @brief PEXTUH : Parallel EXTend Upper from Halfword
+	/// 
+	/// Use only the upper 4 halfwords of both operands. Interleave them into the return value
+	/// such that their relative ordering stays intact and the values from 'even' land in the even
+	/// positions and the values from 'odd' land in the odd positions.
+	/// 
+	/// Bitwise result:
+	///		Return value[ 0, 15]	=	even[64, 79]
+	///		Return value[16, 31]	=	odd	[64, 79]
+	///		Return value[32, 47]	=	even[80, 95]
+	///		Return value[48, 63]	=	odd	[80, 95]
+	///		...
+	/// @param even Values to put in even positions in the return value
+	/// @param odd Values to put in odd positions in the return value
+	/// @return Interleaved values from both arguments
+	FORCEINLINE CONST m128i16 mm_exthi_epi16(m128i16 even, m128i16 odd)
+	{
+		m128i16 result = {};
+
+#ifdef PS2INTRIN_UNSAFE
+		asm(
+			"pextuh	%[Result],%[Odd],%[Even]"
+			: [Result] "=r" (result.v)
+			: [Even] "r" (even.v),
+			  [Odd] "r" (odd.v)
+		);
+#elif defined(PS2INTRIN_HOST)
+		uint16_t left[8];
+		uint16_t right[8];
+		uint16_t lanes[8];
+
+		memcpy(left, &even, sizeof(left));
+		memcpy(right, &odd, sizeof(right));
+		for (int i = 0; i < 8; ++i)
+		{
+			lanes[i] = (i & 1 ? right : left)[4 + i / 2];
+		}
+		memcpy(&result, lanes, sizeof(lanes));
+#else
+		asm(
+			"pcpyld	%[OddLo],%[OddHi],%[OddLo]\n\t"
+			"pcpyld	%[EvenLo],%[EvenHi],%[EvenLo]\n\t"
+			"pextuh	%[ResultLo],%[OddLo],%[EvenLo]\n\t"
+			"pcpyud	%[ResultHi],%[ResultLo],%[ResultLo]"
+			: [ResultLo] "=r" (result.lo),
+			  [ResultHi] "=&r" (result.hi)
+			: [OddLo] "r" (odd.lo),
+			  [OddHi] "r" (odd.hi),
+			  [EvenLo] "r" (even.lo),
+			  [EvenHi] "r" (even.hi)
+		);
+#endif
+
+		return result;
+	}
+
+	/// @brief PEXTUH : Parallel EXTend Upper from Halfword
+	/// 
+	/// Use only the upper 4 halfwords of both operands. Interleave them into the return value
+	/// such that their relative ordering stays intact and the values from 'even' land in the even
+	/// positions and the values from 'odd' land in the odd positions.
+	/// 
+	/// Bitwise result:
+	///		Return value[ 0, 15]	=	even[64, 79]
+	///		Return value[16, 31]	=	odd	[64, 79]
+	///		Return value[32, 47]	=	even[80, 95]
+	///		Return value[48, 63]	=	odd	[80, 95]
+	///		...
+	/// @param even Values to put in even positions in the return value
+	/// @param odd Values to put in odd positions in the return value
+	/// @return Interleaved values from both arguments
+	FORCEINLINE CONST m128u16 mm_exthi_epu16(m128u16 even, m128u16 odd)
+	{
+		return mm_castepu16_epi16(mm_exthi_epi16(mm_castepi16_epu16(even), mm_castepi16_epu16(odd)));
+	}
+
+	/// @brief PEXTLW : Parallel EXTend Lower from Word
+	/// 
+	/// Use only the lower 2 words of both operands. Interleave them into the return value such
+	/// that their relative ordering stays intact and the values from 'even' land in the even
+	/// positions and the values from 'odd' land in the odd positions.
+	/// 
+	/// Bitwise result:
+	///		Return value[ 0,  31]	=	even[ 0, 31]
+	///		Return value[32,  63]	=	odd	[ 0, 31]
+	///		Return value[64,  95]	=	even[32, 63]
+	///		Return value[96, 127]	=	odd	[32, 63]
+	/// @param even Values to put in even positions in the return value
+	/// @param odd Values to put in odd positions in the return value
+	/// @return Interleaved values from both arguments
+	FORCEINLINE CONST m128i32 mm_extlo_epi32(m128i32 even, m128i32 odd)
+	{
+		m128i32 result = {};
+
+#ifdef PS2INTRIN_UNSAFE
+		asm(
+			"pextlw	%[Result],%[Odd],%[Even]"
+			: [Result] "=r" (result.v)
+			: [Even] "r" (even.v),
+			  [Odd] "r" (odd.v)
+		);
+#elif defined(PS2INTRIN_HOST)
+		uint32_t left[4];
+		uint32_t right[4];
+		uint32_t lanes[4];
+
+		memcpy(left, &even, sizeof(left));
+		memcpy(right, &odd, sizeof(right));
+		for (int i = 0; i < 4; ++i)
+		{
+			lanes[i] = (i & 1 ? right : left)[i / 2];
+		}
+		memcpy(&result, lanes, sizeof(lanes));
+#else
+		asm(
+			"pcpyld	%[OddLo],%[OddHi],%[OddLo]\n\t"
+			"pcpyld	%[EvenLo],%[EvenHi],%[EvenLo]\n\t"
+			"pextlw	%[ResultLo],%[OddLo],%[EvenLo]\n\t"
+			"pcpyud	%[ResultHi],%[ResultLo],%[ResultLo]"
+			: [ResultLo] "=r" (result.lo),
+			  [ResultHi] "=&r" (result.hi)
+			: [OddLo] "r" (odd.lo),
+			  [OddHi] "r" (odd.hi),
+			  [EvenLo] "r" (even.lo),
+			  [EvenHi] "r" (even.hi)
+		);
+#endif
+
+		return result;
+	}
+
+	/// @brief PEXTLW : Parallel EXTend Lower from Word
+	/// 
+	/// Use only the lower 2 words of both operands. Interleave them into the return value such
+	/// that their relative ordering stays intact and the values from 'even' land in the even
+	/// positions and the values from 'odd' land in the odd positions.
+	/// 
+	/// Bitwise result:
+	///		Return value[ 0,  31]	=	even[ 0, 31]
+	///		Return value[32,  63]	=	odd	[ 0, 31]
+	///		Return value[64,  95]	=	even[32, 63]
+	///		Return value[96, 127]	=	odd	[32, 63]
+	/// @param even Values to put in even positions in the return value
+	/// @param odd Values to put in odd positions in the return value
+	/// @return Interleaved values from both arguments
+	FORCEINLINE CONST m128u32 mm_extlo_epu32(m128u32 even, m128u32 odd)
+	{
+		return mm_castepu32_epi32(mm_extlo_epi32(mm_castepi32_epu32(even), mm_castepi32_epu32(odd)));
+	}
+
+	/// @brief PEXTUW : Parallel EXTend Upper from Word
+	/// 
+	/// Use only the upper 2 words of both operands. Interleave them into the return value such
+	/// that their relative ordering stays intact and the values from 'even' land in the even
+	/// positions and the values from 'odd' land in the odd positions.
+	/// 
+	/// Bitwise result:
+	///		Return value[ 0,  31]	=	even[64,  95]
+	///		Return value[32,  63]	=	odd	[64,  95]
+	///		Return value[64,  95]	=	even[96, 127]
+	///		Return value[96, 127]	=	odd	[96, 127]
+	/// @param even Values to put in even positions in the return value
+	/// @param odd Values to put in odd positions in the return value
+	/// @return Interleaved values from both arguments
+	FORCEINLINE CONST m128i32 mm_exthi_epi32(m128i32 even, m128i32 odd)
+	{
+		m128i32 result = {};
+
+#ifdef PS2INTRIN_UNSAFE
+		asm(
+			"pextuw	%[Result],%[Odd],%[Even]"
+			: [Result] "=r" (result.v)
+			: [Even] "r" (even.v),
+			  [Odd] "r" (odd.v)
+		);
+#elif defined(PS2INTRIN_HOST)
+		uint32_t left[4];
+		uint32_t right[4];
+		uint32_t lanes[4];
+
+		memcpy(left, &even, sizeof(left));
+		memcpy(right, &odd, sizeof(right));
+		for (int i = 0; i < 4; ++i)
+		{
+			lanes[i] = (i & 1 ? right : left)[2 + i / 2];
+		}
+		memcpy(&result, lanes, sizeof(lanes));
+#else
+		asm(
+			"pcpyld	%[OddLo],%[OddHi],%[OddLo]\n\t"
+			"pcpyld	%[EvenLo],%[EvenHi],%[EvenLo]\n\t"
+			"pextuw	%[ResultLo],%[OddLo],%[EvenLo]\n\t"
+			"pcpyud	%[ResultHi],%[ResultLo],%[ResultLo]"
+			: [ResultLo] "=r" (result.lo),
+			  [ResultHi] "=&r" (result.hi)
+			: [OddLo] "r" (odd.lo),
+			  [OddHi] "r" (odd.hi),
+			  [EvenLo] "r" (even.lo),
+			  [EvenHi] "r" (even.hi)
+		);
+#endif
+
+		return result;
+	}
+
+	/// @brief PEXTUW : Parallel EXTend Upper from Word
+	/// 
+	/// Use only the upper 2 words of both operands. Interleave them into the return value such
+	/// that their relative ordering stays intact and the values from 'even' land in the even
+	/// positions and the values from 'odd' land in the odd positions.
+	/// 
+	/// Bitwise result:
+	///		Return value[ 0,  31]	=	even[64,  95]
+	///		Return value[32,  63]	=	odd	[64,  95]
+	///		Return value[64,  95]	=	even[96, 127]
+	///		Return value[96, 127]	=	odd	[96, 127]
+	/// @param even Values to put in even positions in the return value
+	/// @param odd Values to put in odd positions in the return value
+	/// @return Interleaved values from both arguments
+	FORCEINLINE CONST m128u32 mm_exthi_epu32(m128u32 even, m128u32 odd)
+	{
+		return mm_castepu32_epi32(mm_exthi_epi32(mm_castepi32_epu32(even), mm_castepi32_epu32(odd)));
+	}
+
+	/// @brief PINTEH : Parallel INTerleave Even Halfword
+	/// 
+	/// Select only the 4 values in even positions in the input arguments. Interleave the values
+	/// from 'even' in the even positions and those from 'odd' in the odd positions of the return
+	/// value.
+	/// 
+	/// Bitwise result:
+	///		Return value[ 0, 15]	=	even[ 0, 15]
+	///		Return value[16, 31]	=	odd	[ 0, 15]
+	///		Return value[32, 47]	=	even[32, 47]
+	///		Return value[48, 63]	=	odd	[32, 47]
+	///		...
+	/// @param even Values to put in the even positions
+	/// @param odd Values to put in the odd positions
+	/// @return Interleaved values
+	FORCEINLINE CONST m128i16 mm_interleaveeven_epi16(m128i16 even, m128i16 odd)
+	{
+		m128i16 result = {};
+
+#ifdef PS2INTRIN_UNSAFE
+		asm(
+			"pinteh	%[Result],%[Odd],%[Even]"
+			: [Result] "=r" (result.v)
+			: [Even] "r" (even.v),
+			  [Odd] "r" (odd.v)
+		);
+#elif defined(PS2INTRIN_HOST)
+		uint16_t left[8];
+		uint16_t right[8];
+		uint16_t lanes[8];
+
+		memcpy(left, &even, sizeof(left));
+		memcpy(right, &odd, sizeof(right));
+		for (int i = 0; i < 8; ++i)
+		{
+			lanes[i] = (i & 1 ? right : left)[i & 6];
+		}
+		memcpy(&result, lanes, sizeof(lanes));
+#else
+		asm(
+			"pcpyld	%[OddLo],%[OddHi],%[OddLo]\n\t"
+			"pcpyld	%[EvenLo],%[EvenHi],%[EvenLo]\n\t"
+			"pinteh	%[ResultLo],%[OddLo],%[EvenLo]\n\t"
+			"pcpyud	%[ResultHi],%[ResultLo],%[ResultLo]"
+			: [ResultLo] "=r" (result.lo),
+			  [ResultHi] "=&r" (result.hi)
+			: [OddLo] "r" (odd.lo),
+			  [OddHi] "r" (odd.hi),
+			  [EvenLo] "r" (even.lo),
+			  [EvenHi] "r" (even.hi)
+		);
+#endif
+
+		return result;
+	}
+
+	/// @brief PINTEH : Parallel INTerleave Even Halfword
+	/// 
+	/// Select only the 4 values in even positions in the input arguments. Interleave the values
+	/// from 'even' in the even positions and those from 'odd' in the odd positions of the return
+	/// value.
+	/// 
+	/// Bitwise result:
+	///		Return value[ 0, 15]	=	even[ 0, 15]
+	///		Return value[16, 31]	=	odd	[ 0, 15]
+	///		Return value[32, 47]	=	even[32, 47]
+	///		Return value[48, 63]	=	odd	[32, 47]
+	///		...
+	/// @param even Values to put in the even positions
+	/// @param odd Values to put in the odd positions
+	/// @return Interleaved values
+	FORCEINLINE CONST m128u16 mm_interleaveeven_epu16(m128u16 even, m128u16 odd)
+	{
+		return mm_castepu16_epi16(mm_interleaveeven_epi16(mm_castepi16_epu16(even), mm_castepi16_epu16(odd)));
+	}
+
+	/// @brief PINTH : Parallel INTerleave Halfword
+	/// 
+	/// Select only the low 4 values from 'even' and the high 4 values from 'odd'. Interleave the
+	/// values from 'even' in the even positions and those from 'odd' in the odd positions of the
+	/// return value.
+	/// 
+	/// Bitwise result:
+	///		Return value[ 0, 15]	=	even[ 0, 15]
+	///		Return value[16, 31]	=	odd	[64, 79]
+	///		Return value[32, 47]	=	even[16, 31]
+	///		Return value[48, 63]	=	odd	[80, 95]
+	///		...
+	/// @param even Values to put in the even positions
+	/// @param odd Values to put in the odd positions
+	/// @return Interleaved values
+	FORCEINLINE CONST m128i16 mm_interleavelohi_epi16(m128i16 even, m128i16 odd)
+	{
+		m128i16 result = {};
+
+#ifdef PS2INTRIN_UNSAFE
+		asm(
+			"pinth	%[Result],%[Odd],%[Even]"
+			: [Result] "=r" (result.v)
+			: [Even] "r" (even.v),
+			  [Odd] "r" (odd.v)
+		);
+#elif defined(PS2INTRIN_HOST)
+		uint16_t left[8];
+		uint16_t right[8];
+		uint16_t lanes[8];
+
+		memcpy(left, &even, sizeof(left));
+		memcpy(right, &odd, sizeof(right));
+		for (int i = 0; i < 8; ++i)
+		{
+			lanes[i] = i & 1 ? right[4 + i / 2] : left[i / 2];
+		}
+		memcpy(&result, lanes, sizeof(lanes));
+#else
+		asm(
+			"pcpyld	%[OddLo],%[OddHi],%[OddLo]\n\t"
+			"pcpyld	%[EvenLo],%[EvenHi],%[EvenLo]\n\t"
+			"pinth	%[ResultLo],%[OddLo],%[EvenLo]\n\t"
+			"pcpyud	%[ResultHi],%[ResultLo],%[ResultLo]"
+			: [ResultLo] "=r" (result.lo),
+			  [ResultHi] "=&r" (result.hi)
+			: [OddLo] "r" (odd.lo),
+			  [OddHi] "r" (odd.hi),
+			  [EvenLo] "r" (even.lo),
+			  [EvenHi] "r" (even.hi)
+		);
+#endif
+
+		return result;
+	}
+
+	/// @brief PINTH : Parallel INTerleave Halfword
+	/// 
+	/// Select only the low 4 values from 'even' and the high 4 values from 'odd'. Interleave the
+	/// values from 'even' in the even positions and those from 'odd' in the odd positions of the
+	/// return value.
+	/// 
+	/// Bitwise result:
+	///		Return value[ 0, 15]	=	even[ 0, 15]
+	///		Return value[16, 31]	=	odd	[64, 79]
+	///		Return value[32, 47]	=	even[16, 31]
+	///		Return value[48, 63]	=	odd	[80, 95]
+	///		...
+	/// @param even Values to put in the even positions
+	/// @param odd Values to put in the odd positions
+	/// @return Interleaved values
+	FORCEINLINE CONST m128u16 mm_interleavelohi_epu16(m128u16 even, m128u16 odd)
+	{
+		return mm_castepu16_epi16(mm_interleavelohi_epi16(mm_castepi16_epu16(even), mm_castepi16_epu16(odd)));
+	}
+
+	/// @brief PPACB : Parallel PACk to Byte
+	/// 
+	/// Select only the values in even positions of both arguments. Store the values from 'lo' to
+	/// the low 8 bytes of the return value and the values from 'hi' to the high 8 bytes.
+	/// 
+	/// Bitwise result:
+	///		Return value[ 0,  7]	=	lo[ 0,  7]
+	///		Return value[ 8, 15]	=	lo[16, 23]
+	///		...
+	///		Return value[64, 71]	=	hi[ 0,  7]
+	///		Return value[72, 79]	=	hi[16, 23]
+	/// @param lo Values to put in the low 8 bytes of the return value
+	/// @param hi Values to put in the high 8 bytes of the return value
+	/// @return Packed values of both arguments
+	FORCEINLINE CONST m128i8 mm_pack_epi8(m128i8 lo, m128i8 hi)
+	{
+		m128i8 result = {};
+
+#ifdef PS2INTRIN_UNSAFE
+		asm(
+			"ppacb	%[Result],%[Hi],%[Lo]"
+			: [Result] "=r" (result.v)
+			: [Lo] "r" (lo.v),
+			  [Hi] "r" (hi.v)
+		);
+#elif defined(PS2INTRIN_HOST)
+		uint8_t left[16];
+		uint8_t right[16];
+		uint8_t lanes[16];
+
+		memcpy(left, &lo, sizeof(left));
+		memcpy(right, &hi, sizeof(right));
+		for (int i = 0; i < 16; ++i)
+		{
+			lanes[i] = (i < 8 ? left : right)[2 * i % 16];
+		}
+		memcpy(&result, lanes, sizeof(lanes));
+#else
+		asm(
+			"pcpyld	%[LoLo],%[LoHi],%[LoLo]\n\t"
+			"pcpyld	%[HiLo],%[HiHi],%[HiLo]\n\t"
+			"ppacb	%[ResultLo],%[HiLo],%[LoLo]\n\t"
+			"pcpyud	%[ResultHi],%[ResultLo],%[ResultLo]"
+			: [ResultLo] "=r" (result.lo),
+			  [ResultHi] "=&r" (result.hi)
+			: [LoLo] "r" (lo.lo),
+			  [LoHi] "r" (lo.hi),
+			  [HiLo] "r" (hi.lo),
+			  [HiHi] "r" (hi.hi)
+		);
+#endif
+
+		return result;
+	}
+
+	/// @brief PPACB : Parallel PACk to Byte
+	/// 
+	/// Select only the values in even positions of both arguments. Store the values from 'lo' to
+	/// the low 8 bytes of the return value and the values from 'hi' to the high 8 bytes.
+	/// 
+	/// Bitwise result:
+	///		Return value[ 0,  7]	=	lo[ 0,  7]
+	///		Return value[ 8, 15]	=	lo[16, 23]
+	///		...
+	///		Return value[64, 71]	=	hi[ 0,  7]
+	///		Return value[72, 79]	=	hi[16, 23]
+	/// @param lo Values to put in the low 8 bytes of the return value
+	/// @param hi Values to put in the high 8 bytes of the return value
+	/// @return Packed values of both arguments
+	FORCEINLINE CONST m128u8 mm_pack_epu8(m128u8 lo, m128u8 hi)
+	{
+		return mm_castepu8_epi8(mm_pack_epi8(mm_castepi8_epu8(lo), mm_castepi8_epu8(hi)));
+	}
+
+	/// @brief PPACH : Parallel PACk to Halfword
+	/// 
+	/// Select only the values in even positions of both arguments. Store the values from 'lo' to
+	/// the low 4 halfwords of the return value and the values from 'hi' to the high 4 halfwords.
+	/// 
+	/// Bitwise result:
+	///		Return value[ 0, 15]	=	lo[ 0, 15]
+	///		Return value[16, 31]	=	lo[32, 47]
+	///		...
+	///		Return value[64, 79]	=	hi[ 0, 15]
+	///		Return value[80, 95]	=	hi[32, 47]
+	/// @param lo Values to put in the low 4 halfwords of the return value
+	/// @param hi Values to put in the high 4 halfwords of the return value
+	/// @return Packed values of both arguments
+	FORCEINLINE CONST m128i16 mm_pack_epi16(m128i16 lo, m128i16 hi)
+	{
+		m128i16 result = {};
+
+#ifdef PS2INTRIN_UNSAFE
+		asm(
+			"ppach	%[Result],%[Hi],%[Lo]"
+			: [Result] "=r" (result.v)
+			: [Lo] "r" (lo.v),
+			  [Hi] "r" (hi.v)
+		);
+#elif defined(PS2INTRIN_HOST)
+		uint16_t left[8];
+		uint16_t right[8];
+		uint16_t lanes[8];
+
+		memcpy(left, &lo, sizeof(left));
+		memcpy(right, &hi, sizeof(right));
+		for (int i = 0; i < 8; ++i)
+		{
+			lanes[i] = (i < 4 ? left : right)[2 * i % 8];
+		}
+		memcpy(&result, lanes, sizeof(lanes));
+#else
+		asm(
+			"pcpyld	%[LoLo],%[LoHi],%[LoLo]\n\t"
+			"pcpyld	%[HiLo],%[HiHi],%[HiLo]\n\t"
+			"ppach	%[ResultLo],%[HiLo],%[LoLo]\n\t"
+			"pcpyud	%[ResultHi],%[ResultLo],%[ResultLo]"
+			: [ResultLo] "=r" (result.lo),
+			  [ResultHi] "=&r" (result.hi)
+			: [LoLo] "r" (lo.lo),
+			  [LoHi] "r" (lo.hi),
+			  [HiLo] "r" (hi.lo),
+			  [HiHi] "r" (hi.hi)
+		);
+#endif
+
+		return result;
+	}
+
+	/// @brief PPACH : Parallel PACk to Halfword
+	/// 
+	/// Select only the values in even positions of both arguments. Store the values from 'lo' to
+	/// the low 4 halfwords of the return value and the values from 'hi' to the high 4 halfwords.
+	/// 
+	/// Bitwise result:
+	///		Return value[ 0, 15]	=	lo[ 0, 15]
+	///		Return value[16, 31]	=	lo[32, 47]
+	///		...
+	///		Return value[64, 79]	=	hi[ 0, 15]
+	///		Return value[80, 95]	=	hi[32, 47]
+	/// @param lo Values to put in the low 4 halfwords of the return value
+	/// @param hi Values to put in the high 4 halfwords of the return value
+	/// @return Packed values of both arguments
+	FORCEINLINE CONST m128u16 mm_pack_epu16(m128u16 lo, m128u16 hi)
+	{
+		return mm_castepu16_epi16(mm_pack_epi16(mm_castepi16_epu16(lo), mm_castepi16_epu16(hi)));
+	}
+
+	/// @brief PPACW : Parallel PACk to Word
+	/// 
+	/// Select only the values in even positions of both arguments. Store the values from 'lo' to
+	/// the low 2 words of the return value and the values from 'hi' to the high 2 words.
+	/// 
+	/// Bitwise result:
+	///		Return value[ 0,  31]	=	lo[ 0, 31]
+	///		Return value[32,  63]	=	lo[64, 95]
+	///		Return value[64,  95]	=	hi[ 0, 31]
+	///		Return value[96, 127]	=	hi[64, 95]
+	/// @param lo Values to put in the low 2 words of the return value
+	/// @param hi Values to put in the high 2 words of the return value
+	/// @return Packed values of both arguments
+	FORCEINLINE CONST m128i32 mm_pack_epi32(m128i32 lo, m128i32 hi)
+	{
+		m128i32 result = {};
+
+#ifdef PS2INTRIN_UNSAFE
+		asm(
+			"ppacw	%[Result],%[Hi],%[Lo]"
+			: [Result] "=r" (result.v)
+			: [Lo] "r" (lo.v),
+			  [Hi] "r" (hi.v)
+		);
+#elif defined(PS2INTRIN_HOST)
+		uint32_t left[4];
+		uint32_t right[4];
+		uint32_t lanes[4];
+
+		memcpy(left, &lo, sizeof(left));
+		memcpy(right, &hi, sizeof(right));
+		for (int i = 0; i < 4; ++i)
+		{
+			lanes[i] = (i < 2 ? left : right)[2 * i % 4];
+		}
+		memcpy(&result, lanes, sizeof(lanes));
+#else
+		asm(
+			"pcpyld	%[LoLo],%[LoHi],%[LoLo]\n\t"
+			"pcpyld	%[HiLo],%[HiHi],%[HiLo]\n\t"
+			"ppacw	%[ResultLo],%[HiLo],%[LoLo]\n\t"
+			"pcpyud	%[ResultHi],%[ResultLo],%[ResultLo]"
+			: [ResultLo] "=r" (result.lo),
+			  [ResultHi] "=&r" (result.hi)
+			: [LoLo] "r" (lo.lo),
+			  [LoHi] "r" (lo.hi),
+			  [HiLo] "r" (hi.lo),
+			  [HiHi] "r" (hi.hi)
+		);
+#endif
+
+		return result;
+	}
+
+	/// @brief PPACW : Parallel PACk to Word
+	/// 
+	/// Select only the values in even positions of both arguments. Store the values from 'lo' to
+	/// the low 2 words of the return value and the values from 'hi' to the high 2 words.
+	/// 
+	/// Bitwise result:
+	///		Return value[ 0,  31]	=	lo[ 0, 31]
+	///		Return value[32,  63]	=	lo[64, 95]
+	///		Return value[64,  95]	=	hi[ 0, 31]
+	///		Return value[96, 127]	=	hi[64, 95]
+	/// @param lo Values to put in the low 2 words of the return value
+	/// @param hi Values to put in the high 2 words of the return value
+	/// @return Packed values of both arguments
+	FORCEINLINE CONST m128u32 mm_pack_epu32(m128u32 lo, m128u32 hi)
+	{
+		return mm_castepu32_epi32(mm_pack_epi32(mm_castepi32_epu32(lo), mm_castepi32_epu32(hi)));
+	}
+
+	/// @brief PEXT5 : Parallel EXTend from 5 bits
+	/// 
+	/// Convert pixel coler data from the 16-bit 1-5-5-5 format to the 32-bit 8-8-8-8 format. Only
+	/// the 4 values in even positions in the input argument are converted. Low bits are filled
+	/// with '0', so the alpha channel becomes 1 bit from the input concatenated with 7 '0' bits.
+	/// @param v 1-5-5-5 values to convert
+	/// @return Values converted to 8-8-8-8
+	FORCEINLINE CONST m128u32 mm_ext5_epu16(m128u16 v)
+	{
+		m128u32 result = {};
+
+#ifdef PS2INTRIN_UNSAFE
+		asm(
+			"pext5	%[Result],%[Value]"
+			: [Result] "=r" (result.v)
+			: [Value] "r" (v.v)
+		);
+#elif defined(PS2INTRIN_HOST)
+		uint32_t values[4];
+		uint32_t lanes[4];
+
+		memcpy(values, &v, sizeof(values));
+		for (int i = 0; i < 4; ++i)
+		{
+			lanes[i] = (values[i] & 0x1F) << 3 | (values[i] >> 5 & 0x1F) << 11 | (values[i] >> 10 & 0x1F) << 19 | (values[i] >> 15 & 1) << 31;
+		}
+		memcpy(&result, lanes, sizeof(lanes));
+#else
+		asm(
+			"pcpyld	%[ValueLo],%[ValueHi],%[ValueLo]\n\t"
+			"pext5	%[ResultLo],%[ValueLo]\n\t"
+			"pcpyud	%[ResultHi],%[ResultLo],%[ResultLo]"
+			: [ResultLo] "=r" (result.lo),
+			  [ResultHi] "=&r" (result.hi)
+			: [ValueLo] "r" (v.lo),
+			  [ValueHi] "r" (v.hi)
+		);
+#endif
+
+		return result;
+	}
+
+	/// @brief PPAC5 : Parallel PACk to 5 bits
+	/// 
+	/// Convert 4 pixel color values in the 8-8-8-8 format to the 1-5-5-5 format and store it in
+	/// the even positions of the 8 element return value. The odd positions are filled with '0'.
+	/// Color values are truncated, so only the highest bit is used for alpha and only the 5
+	/// highest bits are used for the color channels, others are ignored.
+	/// @param v 8-8-8-8 values to convert
+	/// @return Values converted to 1-5-5-5
+	FORCEINLINE CONST m128u16 mm_pack5_epu32(m128u32 v)
+	{
+		m128u16 result = {};
+
+#ifdef PS2INTRIN_UNSAFE
+		asm(
+			"ppac5	%[Result],%[Value]"
+			: [Result] "=r" (result.v)
+			: [Value] "r" (v.v)
+		);
+#elif defined(PS2INTRIN_HOST)
+		uint32_t values[4];
+		uint32_t lanes[4];
+
+		memcpy(values, &v, sizeof(values));
+		for (int i = 0; i < 4; ++i)
+		{
+			lanes[i] = (values[i] >> 3 & 0x1F) | (values[i] >> 11 & 0x1F) << 5 | (values[i] >> 19 & 0x1F) << 10 | (values[i] >> 31) << 15;
+		}
+		memcpy(&result, lanes, sizeof(lanes));
+#else
+		asm(
+			"pcpyld	%[ValueLo],%[ValueHi],%[ValueLo]\n\t"
+			"ppac5	%[ResultLo],%[ValueLo]\n\t"
+			"pcpyud	%[ResultHi],%[ResultLo],%[ResultLo]"
+			: [ResultLo] "=r" (result.lo),
+			  [ResultHi] "=&r" (result.hi)
+			: [ValueLo] "r" (v.lo),
+			  [ValueHi] "r" (v.hi)
+		);
+#endif
+
+		return result;
+	}
+
+#ifdef __cplusplus
+}
+#endif
+
+#include "detail/end.h"
@@ -0,0 +1,146 @@
+#pragma once
+
+/*
+*	Software pipelining for load/compute/store loops.
+*
+*	GCC cannot see through the asm statements, so it neither hoists an LQ far enough ahead of its
+*	first use nor moves work between a PMADDH/PDIVW and the instruction reading its result. A
+*	straightforward loop therefore stalls on every load and every multi-cycle result.
+*	'pipelined_for' restructures the loop by hand: loads run 'Depth' iterations ahead of the
+*	computation and stores trail it by one iteration, with a prologue and an epilogue.
+*	The loop is unrolled 'Depth' times so every in-flight value lives in its own variable.
+*/
+
+#include <stddef.h>
+
+#ifdef __cplusplus
+
+#include <utility>
+
+#include "detail/begin.h"
+
+#ifdef PS2INTRIN_MODULE
+export
+#else
+namespace
+#endif
+{
+	namespace pipeline_detail
+	{
+		template <unsigned Depth, typename Load, typename Compute, typename Store>
+		class pipeline
+		{
+		public:
+			typedef decltype(std::declval<Load&>()(size_t())) loaded_t;
+			typedef decltype(std::declval<Compute&>()(std::declval<loaded_t>())) computed_t;
+
+			FORCEINLINE pipeline(size_t count, Load& load, Compute& compute, Store& store) noexcept
+				: count(count), load(load), compute(compute), store(store)
+			{
+			}
+
+			FORCEINLINE void run() noexcept
+			{
+				// Prologue: fill every slot, then compute iteration 0 and refill its slot.
+				fill(std::make_integer_sequence<unsigned, Depth>());
+				pending = compute(slots[0]);
+				if (Depth < count)
+				{
+					slots[0] = load(Depth);
+				}
+
+				// Iteration 'i' uses slot 'i % Depth', so every group starts at 'i % Depth == 1' to
+				// keep the slot indices constant.
+				size_t i = 1;
+				for (; i + 2 * Depth <= count; i += Depth)
+				{
+					group<false>(i, std::make_integer_sequence<unsigned, Depth>());
+				}
+				// Epilogue: the remaining iterations, with nothing left to load at the end.
+				for (; i < count; i += Depth)
+				{
+					group<true>(i, std::make_integer_sequence<unsigned, Depth>());
+				}
+
+				store(count - 1, pending);
+			}
+
+		private:
+			template <unsigned... K>
+			FORCEINLINE void fill(std::integer_sequence<unsigned, K...>) noexcept
+			{
+				((K < count ? (void)(slots[K] = load(K)) : (void)0), ...);
+			}
+
+			template <bool Checked, unsigned... K>
+			FORCEINLINE void group(size_t i, std::integer_sequence<unsigned, K...>) noexcept
+			{
+				(step<Checked, (K + 1) % Depth>(i + K), ...);
+			}
+
+			template <bool Checked, unsigned Slot>
+			FORCEINLINE void step(size_t i) noexcept
+			{
+				if (Checked && i >= count)
+				{
+					return;
+				}
+
+				computed_t result = compute(slots[Slot]);
+				if (!Checked || i + Depth < count)
+				{
+					slots[Slot] = load(i + Depth);
+				}
+				store(i - 1, pending);
+				pending = result;
+			}
+
+			size_t count;
+			Load& load;
+			Compute& compute;
+			Store& store;
+			loaded_t slots[Depth] = {};
+			computed_t pending = {};
+		};
+	}
+
+	/// @brief Software-pipelined loop
+	///
+	/// Does the same as
+	///
+	///		for (size_t i = 0; i < count; ++i)
+	///			store(i, compute(load(i)));
+	///
+	/// but issues the load of iteration 'i + Depth' right after the computation of iteration 'i'
+	/// and the store of iteration 'i' after the computation of iteration 'i + 1'. This hides the
+	/// load-use delay of LQ behind 'Depth - 1' computations and lets a computation ending in a
+	/// multi-cycle instruction (PMULTH, PMADDH, PDIVW, ...) finish while the next one starts.
+	///
+	/// The stages are called in iteration order with respect to each stage, so 'load' and
+	/// 'store' may advance pointers instead of using the index. 'load' may be called for at most
+	/// 'count' iterations and never beyond. A load must not depend on the stores of the previous
+	/// 'Depth + 1' iterations.
+	///
+	/// Each stage should be a lambda that inlines completely. The values passed between them
+	/// should be register-sized, like the 'm128*' types or small structs of them.
+	/// @tparam Depth Number of iterations loads run ahead. Deeper pipelines need more registers.
+	/// @param count Number of iterations
+	/// @param load 'loaded_t load(size_t i)'
+	/// @param compute 'computed_t compute(loaded_t v)'
+	/// @param store 'void store(size_t i, computed_t v)'
+	template <unsigned Depth = 2, typename Load, typename Compute, typename Store>
+	FORCEINLINE void pipelined_for(size_t count, Load load, Compute compute, Store store) noexcept
+	{
+		static_assert(Depth >= 1, "Depth must be at least 1");
+
+		if (count == 0)
+		{
+			return;
+		}
+		pipeline_detail::pipeline<Depth, Load, Compute, Store>(count, load, compute, store).run();
+	}
+}
+
+#include "detail/end.h"
+
+#endif
@@ -0,0 +1,562 @@
+#pragma once
+
+/*
+*	Shift amount register access (MFSA/MTSA/MTSAB/MTSAH) and the quadword funnel shift QFSRV.
+*/
+
+#include "common.h"
+
+#include "detail/begin.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+	// Funnel Shift
+
+	/// @brief Construct a 'sa_state_t' using the value currently stored in the SA register.
+	/// 
+	/// Optional, provided as means of accessing that register without first setting a value.
+	/// Obtained value is unspecified and depends on preceding code.
+	/// 
+	/// This function reads global state (SA).
+	/// @param state Additional state used in safe mode. May not be NULL.
+	FORCEINLINE REPRODUCIBLE void sa_state_construct(sa_state_t* state)
+	{
+#ifdef PS2INTRIN_UNSAFE
+		(void)state;
+#elif defined(PS2INTRIN_HOST)
+		// There is no SA register to read on the host, start with a shift amount of 0.
+		state->sa = 0;
+#else
+		asm volatile( /* must be volatile so gcc cannot assume the result is always the same	*/
+			"mfsa	%[Value]"
+			: [Value] "=r" (state->sa)										/* output operands	*/
+		);
+#endif
+	}
+
+	/// @brief Destroy a 'sa_state_t' by writing the value currently stored to the SA register.
+	/// 
+	/// Optional, provided as means of writing globally to that register. Effect of written
+	/// value is unspecified and depends on following code.
+	/// 
+	/// This function writes to global state (SA).
+	/// @param state Additional state used in safe mode. May not be NULL.
+	FORCEINLINE void sa_state_destruct(sa_state_t* state)
+	{
+#if defined(PS2INTRIN_UNSAFE) || defined(PS2INTRIN_HOST)
+		(void)state;
+#else
+		asm volatile(		/* must be volatile so gcc cannot assume the store is unobserved	*/
+			"mtsa	%[Value]"
+			:																/* output operands	*/
+			: [Value] "r" (state->sa)										/* input operands	*/
+			: /*"sa"*/																/* clobbers	*/
+		);
+#endif
+	}
+
+	/// @brief MFSA : Move From Shift Amount register
+	/// 
+	/// Get the value of the shift amount register.
+	/// 
+	/// The value is only used to preserve the register across context switches. It is meaningless
+	/// unless written back to the SA register using 'store_sa'. Do not assume the result has any
+	/// particular value. Set the shift amount register to a meaningful value by using 'set_sa_8'
+	/// or 'set_sa_16'.
+	/// 
+	/// This function reads global state (SA).
+	/// @param state Additional state used in safe mode. May not be NULL.
+	/// @return The value stored in SA (SA bits 0..63)
+	FORCEINLINE PURE uint64_t load_sa(sa_state_t* state)
+	{
+#ifdef PS2INTRIN_UNSAFE
+		(void)state;
+
+		uint64_t result = 0;
+
+		// I'd like to tell gcc that this asm reads from the SA register but I don't know of any
+		// constraint that fixes a variable to that register, much less how to use it here (see
+		// other load_lo/hi functions). As it stands, this needs to be declared volatile to ensure
+		// gcc doesn't think the result is always the same.
+		asm volatile(
+			"mfsa	%[Result]"
+			: [Result] "=r" (result)		// output operands
+		);
+
+		return result;
+#else
+		return state->sa;
+#endif
+	}
+
+	/// @brief MTSA : Move To Shift Amount register
+	/// 
+	/// Store a value to the shift amount register.
+	/// 
+	/// The value is only used to preserve the register across context switches. Don't use a value
+	/// unless read from the SA register using 'load_sa'. Do not assume the result has any
+	/// particular value. Set the shift amount register to a meaningful value by using 'set_sa_8'
+	/// or 'set_sa_16'.
+	/// 
+	/// Note that the 3 preceding instructions may not be any of the following:
+	/// MFSA, MTSAB, MTSAH, QFSRV
+	/// 
+	/// This function writes to global state (SA).
+	/// @param state Additional state used in safe mode. May not be NULL.
+	/// @param value Value to store in SA
+	FORCEINLINE void store_sa(sa_state_t* state, uint64_t value)
+	{
+#ifdef PS2INTRIN_UNSAFE
+		(void)state;
+
+		// I'd like to tell gcc that this asm writes to the SA register but I don't know of any
+		// constraint that fixes a variable to that register, much less how to use it here (see
+		// 'load_sa'). As it stands, this needs to be declared volatile to ensure gcc doesn't think
+		// the write is unobserved (and would be implicitly).
+		asm volatile(
+			"mtsa	%[Value]"
+			:							// output operands
+			: [Value] "r" (value)		// input operands
+			: /*"sa"*/					// clobbers
+		);
+#else
+		state->sa = value;
+#endif
+	}
+
+	// MTSAB_BOTH
+#ifdef PS2INTRIN_UNSAFE
+	/// @brief MTSAB : Move byte count To Shift Amount register (Byte)
+	/// 
+	/// Set a byte shift count in the shift amount register.
+	/// 
+	/// The values of 'variable' and 'immediate' are XOR'ed together. The resulting value is the
+	/// amount of bytes 'byte_shift_logical_right' will shift by.
+	/// 
+	/// Allowable values for 'variable' and 'immediate' are [0,15]. Only the lower 4 bits are used,
+	/// others are ignored.
+	/// 
+	/// Use this macro if you require both the variable and constant values usable by the 'mtsab'
+	/// instruction. Otherwise, prefer 'MTSAB_IMMEDIATE' if you only have a constant value and
+	/// 'set_sa_8' if you only have a variable shift amount.
+	/// 
+	/// Note that the 3 preceding instructions may not be any of the following:
+	/// MFSA, QFSRV
+	/// 
+	/// This macro writes to global state (SA).
+	/// @param state Additional state used in safe mode. Must be an expression of type
+	/// 'sa_state_t*'. May not be NULL.
+	/// @param variable The variable byte-amount to set up the shift amount register for. Should be
+	/// the name of a variable of type 'unsigned'.
+	/// @param immediate The compile time constant byte-amount to set up the shift amount register
+	/// for. Should be an integer literal.
+	#define MTSAB_BOTH(state, variable, immediate)													\
+	{																								\
+		(void)(state);																				\
+		asm volatile(									/*	volatile, same reason as 'store_sa'	*/	\
+			"mtsab	%[Variable],%c[Immediate]"														\
+			:															/*	output parameters	*/	\
+			: [Variable] "r" (variable), [Immediate] "n" (immediate)	/*	input parameters	*/	\
+			: /*"sa"*/													/*	clobbers	*/			\
+		);																							\
+	}
+#else
+	/// @brief MTSAB : Move byte count To Shift Amount register (Byte)
+	/// 
+	/// Set a byte shift count in the shift amount register.
+	/// 
+	/// The values of 'variable' and 'immediate' are XOR'ed together. The resulting value is the
+	/// amount of bytes 'byte_shift_logical_right' will shift by.
+	/// 
+	/// Allowable values for 'variable' and 'immediate' are [0,15]. Only the lower 4 bits are used,
+	/// others are ignored.
+	/// 
+	/// Use this macro if you require both the variable and constant values usable by the 'mtsab'
+	/// instruction. Otherwise, prefer 'MTSAB_IMMEDIATE' if you only have a constant value and
+	/// 'set_sa_8' if you only have a variable shift amount.
+	/// 
+	/// Note that the 3 preceding instructions may not be any of the following:
+	/// MFSA, QFSRV
+	/// 
+	/// This macro writes to global state (SA).
+	/// @param state Additional state used in safe mode. Must be an expression of type
+	/// 'sa_state_t*'. May not be NULL.
+	/// @param variable The variable byte-amount to set up the shift amount register for. Should be
+	/// the name of a variable of type 'unsigned'.
+	/// @param immediate The compile time constant byte-amount to set up the shift amount register
+	/// for. Should be an integer literal.
+#ifdef PS2INTRIN_HOST
+	// The SA register holds the shift amount in bits.
+#define MTSAB_BOTH(state, variable, immediate)	{ (state)->sa = (uint64_t)((((variable) ^ (immediate)) & 0xF) * 8); }
+#else
+	#define MTSAB_BOTH(state, variable, immediate)													\
+	{																								\
+		uint64_t result = 0;																		\
+		uint64_t tmp = 0;																			\
+		asm volatile(																				\
+			"mfsa	%[Tmp]\n\t"																		\
+			"nop\n\tnop\n\tnop\n\tmtsab	%[Variable],%c[Immediate]\n\t"	/*	timing nops	*/			\
+			"mfsa	%[Result]\n\t"																	\
+			"nop\n\tnop\n\tnop\n\tmtsa	%[Tmp]\n\t"						/*	timing nops	*/			\
+			: [Result] "=r" (result), [Tmp] "=&r" (tmp)					/*	output parameters	*/	\
+			: [Variable] "r" (variable), [Immediate] "n" (immediate)	/*	input parameters	*/	\
+		);																							\
+		(state)->sa = result;																		\
+	}
+#endif
+#endif
+
+	// MTSAB_IMMEDIATE
+#ifdef PS2INTRIN_UNSAFE
+	/// @brief MTSAB : Move byte count To Shift Amount register (Byte)
+	/// 
+	/// Set a byte shift count in the shift amount register.
+	/// 
+	/// The 'immediate' value is the amount of bytes 'byte_shift_logical_right' will shift by.
+	/// 
+	/// Allowable values for 'immediate' are [0,15]. Only the lower 4 bits are used, others are
+	/// ignored.
+	/// 
+	/// Use this macro if your shift amount is known at compile time. Using this macro does not use
+	/// a general purpose register. Otherwise, prefer 'MTSAB_BOTH' or 'set_sa_8'.
+	/// 
+	/// Note that the 3 preceding instructions may not be any of the following:
+	/// MFSA, QFSRV
+	/// 
+	/// This macro writes to global state (SA).
+	/// @param state Additional state used in safe mode. Must be an expression of type
+	/// 'sa_state_t*'. May not be NULL.
+	/// @param immediate The compile time constant byte-amount to set up the shift amount register
+	/// for. Should be an integer literal.
+	#define MTSAB_IMMEDIATE(state, immediate)														\
+	{																								\
+		(void)state;																				\
+		asm volatile(									/*	volatile, same reason as 'store_sa'	*/	\
+			"mtsab	$0,%c[Immediate]"																\
+			:															/*	output parameters	*/	\
+			: [Immediate] "n" (immediate)								/*	input parameters	*/	\
+			: /*"sa"*/													/*	clobbers	*/			\
+		);																							\
+	}
+#else
+	/// @brief MTSAB : Move byte count To Shift Amount register (Byte)
+	/// 
+	/// Set a byte shift count in the shift amount register.
+	/// 
+	/// The 'immediate' value is the amount of bytes 'byte_shift_logical_right' will shift by.
+	/// 
+	/// Allowable values for 'immediate' are [0,15]. Only the lower 4 bits are used, others are
+	/// ignored.
+	/// 
+	/// Use this macro if your shift amount is known at compile time. Using this macro does not use
+	/// a general purpose register. Otherwise, prefer 'MTSAB_BOTH' or 'set_sa_8'.
+	/// 
+	/// Note that the 3 preceding instructions may not be any of the following:
+	/// MFSA, QFSRV
+	/// 
+	/// This macro writes to global state (SA).
+	/// @param state Additional state used in safe mode. Must be an expression of type
+	/// 'sa_state_t*'. May not be NULL.
+	/// @param immediate The compile time constant byte-amount to set up the shift amount register
+	/// for. Should be an integer literal.
+#ifdef PS2INTRIN_HOST
+#define MTSAB_IMMEDIATE(state, immediate)	{ (state)->sa = (uint64_t)(((immediate) & 0xF) * 8); }
+#else
+#define MTSAB_IMMEDIATE(state, immediate)															\
+	{																								\
+		uint64_t result = 0;																		\
+		uint64_t tmp = 0;																			\
+		asm volatile(																				\
+			"mfsa	%[Tmp]\n\t"																		\
+			"nop\n\tnop\n\tnop\n\tmtsab	$0,%c[Immediate]\n\t"			/*	timing nops	*/			\
+			"mfsa	%[Result]\n\t"																	\
+			"nop\n\tnop\n\tnop\n\tmtsa	%[Tmp]\n\t"						/*	timing nops	*/			\
+			: [Result] "=r" (result), [Tmp] "=&r" (tmp)					/*	output parameters	*/	\
+			: [Immediate] "n" (immediate)								/*	input parameters	*/	\
+		);																							\
+		(state)->sa = result;																		\
+	}
+#endif
+#endif
+
+	/// @brief MTSAB : Move byte count To Shift Amount register (Byte)
+	/// 
+	/// Set a byte shift count in the shift amount register.
+	/// 
+	/// Allowable values for 'byte_amount' are [0,15]. Only the lower 4 bits are used, others are
+	/// ignored.
+	/// 
+	/// Use this function if your byte shift amount is calculated by the program. Otherwise, prefer
+	/// 'MTSAB_BOTH' or 'MTSAB_IMMEDIATE'.
+	/// 
+	/// Note that the 3 preceding instructions may not be any of the following:
+	/// MFSA, QFSRV
+	/// 
+	/// This function writes to global state (SA).
+	/// @param state Additional state used in safe mode. May not be NULL.
+	/// @param byte_amount The byte-amount to set up the shift amount register for.
+	FORCEINLINE void set_sa_8(sa_state_t* state, unsigned byte_amount)
+	{
+		MTSAB_BOTH(state, byte_amount, 0);
+	}
+
+	// MTSAH_BOTH
+#ifdef PS2INTRIN_UNSAFE
+	/// @brief MTSAH : Move halfword count To Shift Amount register (Halfword)
+	/// 
+	/// Set a halfword shift count in the shift amount register.
+	/// 
+	/// The values of 'variable' and 'immediate' are XOR'ed together. The resulting value is the
+	/// amount of halfwords 'byte_shift_logical_right' will shift by.
+	/// 
+	/// Allowable values for 'variable' and 'immediate' are [0,7]. Only the lower 3 bits are used,
+	/// others are ignored.
+	/// 
+	/// Use this macro if you require both the variable and constant values usable by the 'mtsah'
+	/// instruction. Otherwise, prefer 'MTSAH_IMMEDIATE' if you only have a constant value and
+	/// 'set_sa_16' if you only have a variable shift amount.
+	/// 
+	/// Note that the 3 preceding instructions may not be any of the following:
+	/// MFSA, QFSRV
+	/// 
+	/// This macro writes to global state (SA).
+	/// @param state Additional state used in safe mode. Must be an expression of type
+	/// 'sa_state_t*'. May not be NULL.
+	/// @param variable The variable halfword-amount to set up the shift amount register for. Should be
+	/// the name of a variable of type 'unsigned'.
+	/// @param immediate The compile time constant halfword-amount to set up the shift amount register
+	/// for. Should be an integer literal.
+	#define MTSAH_BOTH(state, variable, immediate)													\
+	{																								\
+		(void)state;																				\
+		asm volatile(									/*	volatile, same reason as 'store_sa'	*/	\
+			"mtsah	%[Variable],%c[Immediate]"														\
+			:															/*	output parameters	*/	\
+			: [Variable] "r" (variable), [Immediate] "n" (immediate)	/*	input parameters	*/	\
+			: /*"sa"*/													/*	clobbers	*/			\
+		);																							\
+	}
+#else
+	/// @brief MTSAH : Move halfword count To Shift Amount register (Halfword)
+	/// 
+	/// Set a halfword shift count in the shift amount register.
+	/// 
+	/// The values of 'variable' and 'immediate' are XOR'ed together. The resulting value is the
+	/// amount of halfwords 'byte_shift_logical_right' will shift by.
+	/// 
+	/// Allowable values for 'variable' and 'immediate' are [0,7]. Only the lower 3 bits are used,
+	/// others are ignored.
+	/// 
+	/// Use this macro if you require both the variable and constant values usable by the 'mtsah'
+	/// instruction. Otherwise, prefer 'MTSAH_IMMEDIATE' if you only have a constant value and
+	/// 'set_sa_16' if you only have a variable shift amount.
+	/// 
+	/// Note that the 3 preceding instructions may not be any of the following:
+	/// MFSA, QFSRV
+	/// 
+	/// This macro writes to global state (SA).
+	/// @param state Additional state used in safe mode. Must be an expression of type
+	/// 'sa_state_t*'. May not be NULL.
+	/// @param variable The variable halfword-amount to set up the shift amount register for. Should be
+	/// the name of a variable of type 'unsigned'.
+	/// @param immediate The compile time constant halfword-amount to set up the shift amount register
+	/// for. Should be an integer literal.
+#ifdef PS2INTRIN_HOST
+#define MTSAH_BOTH(state, variable, immediate)	{ (state)->sa = (uint64_t)((((variable) ^ (immediate)) & 0x7) * 16); }
+#else
+	#define MTSAH_BOTH(state, variable, immediate)													\
+	{																								\
+		uint64_t result = 0;																		\
+		uint64_t tmp = 0;																			\
+		asm volatile(																				\
+			"mfsa	%[Tmp]\n\t"																		\
+			"nop\n\tnop\n\tnop\n\tmtsah	%[Variable],%c[Immediate]\n\t"	/*	timing nops	*/			\
+			"mfsa	%[Result]\n\t"																	\
+			"nop\n\tnop\n\tnop\n\tmtsa	%[Tmp]\n\t"						/*	timing nops	*/			\
+			: [Result] "=r" (result), [Tmp] "=&r" (tmp)					/*	output parameters	*/	\
+			: [Variable] "r" (variable), [Immediate] "n" (immediate)	/*	input parameters	*/	\
+		);																							\
+		(state)->sa = result;																		\
+	}
+#endif
+#endif
+
+	// MTSAH_IMMEDIATE
+#ifdef PS2INTRIN_UNSAFE
+	/// @brief MTSAH : Move halfword count To Shift Amount register (Halfword)
+	/// 
+	/// Set a halfword shift count in the shift amount register.
+	/// 
+	/// The 'immediate' value is the amount of halfwords 'byte_shift_logical_right' will shift by.
+	/// 
+	/// Allowable values for 'immediate' are [0,7]. Only the lower 3 bits are used, others are
+	/// ignored.
+	/// 
+	/// Use this macro if your shift amount is known at compile time. Using this macro does not use
+	/// a general purpose register. Otherwise, prefer 'MTSAH_BOTH' or 'set_sa_16'.
+	/// 
+	/// Note that the 3 preceding instructions may not be any of the following:
+	/// MFSA, QFSRV
+	/// 
+	/// This macro writes to global state (SA).
+	/// @param state Additional state used in safe mode. Must be an expression of type
+	/// 'sa_state_t*'. May not be NULL.
+	/// @param immediate The compile time constant halfword-amount to set up the shift amount register
+	/// for. Should be an integer literal.
+	#define MTSAH_IMMEDIATE(state, immediate)														\
+	{																								\
+		(void)state;																				\
+		asm volatile(									/*	volatile, same reason as 'store_sa'	*/	\
+			"mtsah	$0,%c[Immediate]"																\
+			:															/*	output parameters	*/	\
+			: [Immediate] "n" (immediate)								/*	input parameters	*/	\
+			: /*"sa"*/													/*	clobbers	*/			\
+		);																							\
+	}
+#else
+	/// @brief MTSAH : Move halfword count To Shift Amount register (Halfword)
+	/// 
+	/// Set a halfword shift count in the shift amount register.
+	/// 
+	/// The 'immediate' value is the amount of halfwords 'byte_shift_logical_right' will shift by.
+	/// 
+	/// Allowable values for 'immediate' are [0,7]. Only the lower 3 bits are used, others are
+	/// ignored.
+	/// 
+	/// Use this macro if your shift amount is known at compile time. Using this macro does not use
+	/// a general purpose register. Otherwise, prefer 'MTSAH_BOTH' or 'set_sa_16'.
+	/// 
+	/// Note that the 3 preceding instructions may not be any of the following:
+	/// MFSA, QFSRV
+	/// 
+	/// This macro writes to global state (SA).
+	/// @param state Additional state used in safe mode. Must be an expression of type
+	/// 'sa_state_t*'. May not be NULL.
+	/// @param immediate The compile time constant halfword-amount to set up the shift amount register
+	/// for. Should be an integer literal.
+#ifdef PS2INTRIN_HOST
+#define MTSAH_IMMEDIATE(state, immediate)	{ (state)->sa = (uint64_t)(((immediate) & 0x7) * 16); }
+#else
+	#define MTSAH_IMMEDIATE(state, immediate)														\
+	{																								\
+		uint64_t result = 0;																		\
+		uint64_t tmp = 0;																			\
+		asm volatile(																				\
+			"mfsa	%[Tmp]\n\t"																		\
+			"nop\n\tnop\n\tnop\n\tmtsah	$0,%c[Immediate]\n\t"			/*	timing nops	*/			\
+			"mfsa	%[Result]\n\t"																	\
+			"nop\n\tnop\n\tnop\n\tmtsa	%[Tmp]\n\t"						/*	timing nops	*/			\
+			: [Result] "=r" (result), [Tmp] "=&r" (tmp)					/*	output parameters	*/	\
+			: [Immediate] "n" (immediate)								/*	input parameters	*/	\
+		);																							\
+		(state)->sa = result;																		\
+	}
+#endif
+#endif
+
+	/// @brief MTSAH : Move halfword count To Shift Amount register (Halfword)
+	/// 
+	/// Set a halfword shift count in the shift amount register.
+	/// 
+	/// Allowable values for 'halfword_amount' are [0,7]. Only the lower 3 bits are used, others are
+	/// ignored.
+	/// 
+	/// Use this function if your byte shift amount is calculated by the program. Otherwise, prefer
+	/// 'MTSAH_BOTH' or 'MTSAH_IMMEDIATE'.
+	/// 
+	/// This function writes to global state (SA).
+	/// @param state Additional state used in safe mode. May not be NULL.
+	/// @param halfword_amount The halfword-amount to set up the shift amount register for.
+	FORCEINLINE void set_sa_16(sa_state_t* state, unsigned halfword_amount)
+	{
+		MTSAH_BOTH(state, halfword_amount, 0);
+	}
+
+	/// @brief QFSRV : Quadword Funnel Shift Right Variable
+	/// 
+	/// Concatenate ('upper' | 'lower') into a 256-bit value. Then shift the result right by an
+	/// amount specified in the Shift Amount Register (SA). Since that register can only be set to
+	/// multiples of bytes or halfwords, only bytes can be shifted at a time.
+	/// 
+	/// Note: If you can decode the value of the SA register you might be able to set specific bit
+	/// amounts after all (using 'load_sa' and 'store_sa'). This is undocumented.
+	/// 
+	/// With specific values in the SA register a left shift and rotations can be achieved. For a
+	/// left shift 'x' bytes use 'mtsab' with '16-x' as the argument, then use qfsvr with your
+	/// data in the 'upper' position and '0' for 'lower'.
+	/// 
+	/// This function reads global state (SA).
+	/// @param state Additional state used in safe mode. May not be NULL.
+	/// @param upper The upper 128 bits of the temporary value getting shifted right.
+	/// @param lower The lower 128 bits of the temporary value getting shifted right.
+	/// @return The lower 128 bits of the temporary value after shifting.
+	FORCEINLINE PURE uint128_t byte_shift_logical_right(sa_state_t* state, uint128_t upper, uint128_t lower)
+	{
+		uint64_t upperlo = upper & 0xFFFFFFFFFFFFFFFF;
+		uint64_t upperhi = (upper >> 64) & 0xFFFFFFFFFFFFFFFF;
+		uint64_t lowerlo = lower & 0xFFFFFFFFFFFFFFFF;
+		uint64_t lowerhi = (lower >> 64) & 0xFFFFFFFFFFFFFFFF;
+		uint64_t resultboth = 0;
+		uint64_t resulthi = 0;
+
+#ifdef PS2INTRIN_UNSAFE
+		(void)state;
+		asm volatile(		/* must be volatile so gcc cannot move this across writes to SA	*/
+			"pcpyld	%[LowerLo],%[LowerHi],%[LowerLo]\n\t"
+			"pcpyld	%[ResultBoth],%[UpperHi],%[UpperLo]\n\t"
+			"qfsrv	%[ResultBoth],%[ResultBoth],%[LowerLo]\n\t"
+			"pcpyud	%[ResultHi],%[ResultBoth],%[ResultBoth]"
+			: [LowerLo] "+r" (lowerlo),
+			  [ResultBoth] "=r" (resultboth),
+			  [ResultHi] "=&r" (resulthi)					/* clobber leads to better codegen	*/
+			: [UpperHi] "r" (upperhi),
+			  [UpperLo] "r" (upperlo),
+			  [LowerHi] "r" (lowerhi)
+		);
+#elif defined(PS2INTRIN_HOST)
+		// Shift the 256-bit concatenation by the amount of bits in SA.
+		unsigned amount = (unsigned)(state->sa & 0x7F);
+		uint128_t shifted = amount ? lower >> amount | upper << (128 - amount) : lower;
+
+		resultboth = (uint64_t)shifted;
+		resulthi = (uint64_t)(shifted >> 64);
+		(void)upperlo;
+		(void)upperhi;
+		(void)lowerlo;
+		(void)lowerhi;
+#else
+		uint64_t tmp = 0;
+		asm(
+			"mfsa	%[Tmp]\n\t"
+			"pcpyld	%[LowerLo],%[LowerHi],%[LowerLo]\n\t"
+			"pcpyld	%[ResultBoth],%[UpperHi],%[UpperLo]\n\t"
+			"nop\n\tmtsa	%[State]\n\t"										/* timing nop	*/
+			"qfsrv	%[ResultBoth],%[ResultBoth],%[LowerLo]\n\t"
+			"pcpyud	%[ResultHi],%[ResultBoth],%[ResultBoth]\n\t"
+			"nop\n\tnop\n\tmtsa	%[Tmp]\n\t"										/* timing nops	*/
+			: [LowerLo] "+r" (lowerlo),
+			  [ResultBoth] "=&r" (resultboth),				/* clobber needed, written before 'State' is read	*/
+			  [ResultHi] "=&r" (resulthi),					/* clobber leads to better codegen	*/
+			  [Tmp] "=&r" (tmp)								/* clobber needed					*/
+			: [UpperHi] "r" (upperhi),
+			  [UpperLo] "r" (upperlo),
+			  [LowerHi] "r" (lowerhi),
+			  [State] "r" (state->sa)
+		);
+#endif
+
+		uint64_t resultlo = resultboth & 0xFFFFFFFFFFFFFFFF;
+
+		uint128_t result = resulthi;
+		result <<= 64;
+		result |= resultlo;
+		return result;
+	}
+
+#ifdef __cplusplus
+}
+#endif
+
+#include "detail/end.h"
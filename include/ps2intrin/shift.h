@@ -0,0 +1,438 @@
+#pragma once
+
+/*
+*	Multimedia shifts by immediate (PSLL/PSRA/PSRL) and by variable amount (PSLLVW/PSRAVW/
+*	PSRLVW).
+*/
+
+#include "common.h"
+
+#include "detail/begin.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+	// PSLLH
+#ifdef PS2INTRIN_UNSAFE
+	/// @brief PSLLH : Parallel Shift Left Logical Halfword
+	/// 
+	/// Logically left shift 16-bit values. Shifts in '0's into the lower bits.
+	/// @param result Variable identifier to store result to. Must be of type 'm128i16' or
+	/// 'm128u16'
+	/// @param value Variable identifier to use as source value. Must be of type 'm128i16' or
+	/// 'm128u16'
+	/// @param shift_amount Amount of bits to shift the source value left. Must be in range [0, 15]
+	#define PSLLH(result, value, shift_amount)														\
+		asm(																						\
+			"psllh	%[Result],%[Value],%c[ShiftAmount]"												\
+			: [Result] "=r" ((result).v)															\
+			: [Value] "r" ((value).v),																\
+			  [ShiftAmount] "n" (shift_amount)														\
+		)
+#else
+	/// @brief PSLLH : Parallel Shift Left Logical Halfword
+	/// 
+	/// Logically left shift 16-bit values. Shifts in '0's into the lower bits.
+	/// @param result Variable identifier to store result to. Must be of type 'm128i16' or
+	/// 'm128u16'
+	/// @param value Variable identifier to use as source value. Must be of type 'm128i16' or
+	/// 'm128u16'
+	/// @param shift_amount Amount of bits to shift the source value left. Must be in range [0, 15]
+#ifdef PS2INTRIN_HOST
+	#define PSLLH(result, value, shift_amount)														\
+		{																							\
+			uint16_t lanes[8];																		\
+			memcpy(lanes, &(value), sizeof(lanes));													\
+			for (int i = 0; i < 8; ++i)																\
+				lanes[i] = (uint16_t)(lanes[i] << ((shift_amount) & 15));							\
+			memcpy(&(result), lanes, sizeof(lanes));												\
+		}
+#else
+	#define PSLLH(result, value, shift_amount)														\
+		asm(																						\
+			"pcpyld	%[ResultLo],%[ValueHi],%[ValueLo]\n\t"											\
+			"psllh	%[ResultLo],%[ResultLo],%c[ShiftAmount]\n\t"									\
+			"pcpyud	%[ResultHi],%[ResultLo],%[ResultLo]"											\
+			: [ResultLo] "=r" ((result).lo),														\
+			  [ResultHi] "=&r" ((result).hi)														\
+			: [ValueLo] "r" ((value).lo),															\
+			  [ValueHi] "r" ((value).hi),															\
+			  [ShiftAmount] "n" (shift_amount)														\
+		)
+#endif
+#endif
+
+	// PSLLW
+#ifdef PS2INTRIN_UNSAFE
+	/// @brief PSLLW : Parallel Shift Left Logical Word
+	/// 
+	/// Logically left shift 32-bit values. Shifts in '0's into the lower bits.
+	/// @param result Variable identifier to store result to. Must be of type 'm128i32' or
+	/// 'm128u32'
+	/// @param value Variable identifier to use as source value. Must be of type 'm128i32' or
+	/// 'm128u32'
+	/// @param shift_amount Amount of bits to shift the source value left. Must be in range [0, 31]
+	#define PSLLW(result, value, shift_amount)														\
+		asm(																						\
+			"psllw	%[Result],%[Value],%c[ShiftAmount]"												\
+			: [Result] "=r" ((result).v)															\
+			: [Value] "r" ((value).v),																\
+			  [ShiftAmount] "n" (shift_amount)														\
+		)
+#else
+	/// @brief PSLLW : Parallel Shift Left Logical Word
+	/// 
+	/// Logically left shift 32-bit values. Shifts in '0's into the lower bits.
+	/// @param result Variable identifier to store result to. Must be of type 'm128i32' or
+	/// 'm128u32'
+	/// @param value Variable identifier to use as source value. Must be of type 'm128i32' or
+	/// 'm128u32'
+	/// @param shift_amount Amount of bits to shift the source value left. Must be in range [0, 31]
+#ifdef PS2INTRIN_HOST
+	#define PSLLW(result, value, shift_amount)														\
+		{																							\
+			uint32_t lanes[4];																		\
+			memcpy(lanes, &(value), sizeof(lanes));													\
+			for (int i = 0; i < 4; ++i)																\
+				lanes[i] = lanes[i] << ((shift_amount) & 31);										\
+			memcpy(&(result), lanes, sizeof(lanes));												\
+		}
+#else
+	#define PSLLW(result, value, shift_amount)														\
+		asm(																						\
+			"pcpyld	%[ResultLo],%[ValueHi],%[ValueLo]\n\t"											\
+			"psllw	%[ResultLo],%[ResultLo],%c[ShiftAmount]\n\t"									\
+			"pcpyud	%[ResultHi],%[ResultLo],%[ResultLo]"											\
+			: [ResultLo] "=r" ((result).lo),														\
+			  [ResultHi] "=&r" ((result).hi)														\
+			: [ValueLo] "r" ((value).lo),															\
+			  [ValueHi] "r" ((value).hi),															\
+			  [ShiftAmount] "n" (shift_amount)														\
+		)
+#endif
+#endif
+
+	/// @brief PSLLVW : Parallel Shift Left Logical Variable Word
+	/// 
+	/// Treat 128-bit packed integer data as 2 sign-extended 32-bit values. Shift each value left
+	/// while shifting in '0's by an amount equal to the corresponding value in 'shift_amount'.
+	/// Only the low 5 bits in each value of 'shift_amount' are used, others are ignored.
+	/// @param value Values to shift
+	/// @param shift_amount Amount to shift values by
+	/// @return Values shifted left by variable amount
+	FORCEINLINE CONST m128i64 mm_sllv_epi64(m128i64 value, m128u64 shift_amount)
+	{
+		m128i64 result = {};
+
+#ifdef PS2INTRIN_UNSAFE
+		asm(
+			"psllvw	%[Result],%[Value],%[Amount]"
+			: [Result] "=r" (result.v)
+			: [Value] "r" (value.v),
+			  [Amount] "r" (shift_amount.v)
+		);
+#elif defined(PS2INTRIN_HOST)
+		uint64_t lanes[2];
+
+		memcpy(lanes, &value, sizeof(lanes));
+		lanes[0] = (uint64_t)(int64_t)(int32_t)((uint32_t)lanes[0] << (shift_amount.lo & 31));
+		lanes[1] = (uint64_t)(int64_t)(int32_t)((uint32_t)lanes[1] << (shift_amount.hi & 31));
+		memcpy(&result, lanes, sizeof(lanes));
+#else
+		asm(
+			"pcpyld	%[ValueLo],%[ValueHi],%[ValueLo]\n\t"
+			"pcpyld	%[AmountLo],%[AmountHi],%[AmountLo]\n\t"
+			"psllvw	%[ResultLo],%[ValueLo],%[AmountLo]\n\t"
+			"pcpyud	%[ResultHi],%[ResultLo],%[ResultLo]"
+			: [ResultLo] "=r" (result.lo),
+			  [ResultHi] "=&r" (result.hi)
+			: [ValueLo] "r" (value.lo),
+			  [ValueHi] "r" (value.hi),
+			  [AmountLo] "r" (shift_amount.lo),
+			  [AmountHi] "r" (shift_amount.hi)
+		);
+#endif
+
+		return result;
+	}
+
+	// PSRAH
+#ifdef PS2INTRIN_UNSAFE
+	/// @brief PSRAH : Parallel Shift Right Arithmetic Halfword
+	/// 
+	/// Arithmetically right shift 16-bit values. Shifts in sign bits into the upper bits.
+	/// @param result Variable identifier to store result to. Must be of type 'm128i16'
+	/// @param value Variable identifier to use as source value. Must be of type 'm128i16'
+	/// @param shift_amount Amount of bits to shift the source value right. Must be in range [0, 15]
+	#define PSRAH(result, value, shift_amount)														\
+		asm(																						\
+			"psrah	%[Result],%[Value],%c[ShiftAmount]"												\
+			: [Result] "=r" ((result).v)															\
+			: [Value] "r" ((value).v),																\
+			  [ShiftAmount] "n" (shift_amount)														\
+		)
+#else
+	/// @brief PSRAH : Parallel Shift Right Arithmetic Halfword
+	/// 
+	/// Arithmetically right shift 16-bit values. Shifts in sign bits into the upper bits.
+	/// @param result Variable identifier to store result to. Must be of type 'm128i16'
+	/// @param value Variable identifier to use as source value. Must be of type 'm128i16'
+	/// @param shift_amount Amount of bits to shift the source value right. Must be in range [0, 15]
+#ifdef PS2INTRIN_HOST
+	#define PSRAH(result, value, shift_amount)														\
+		{																							\
+			int16_t lanes[8];																		\
+			memcpy(lanes, &(value), sizeof(lanes));													\
+			for (int i = 0; i < 8; ++i)																\
+				lanes[i] = (int16_t)(lanes[i] >> ((shift_amount) & 15));							\
+			memcpy(&(result), lanes, sizeof(lanes));												\
+		}
+#else
+	#define PSRAH(result, value, shift_amount)														\
+		asm(																						\
+			"pcpyld	%[ResultLo],%[ValueHi],%[ValueLo]\n\t"											\
+			"psrah	%[ResultLo],%[ResultLo],%c[ShiftAmount]\n\t"									\
+			"pcpyud	%[ResultHi],%[ResultLo],%[ResultLo]"											\
+			: [ResultLo] "=r" ((result).lo),														\
+			  [ResultHi] "=&r" ((result).hi)														\
+			: [ValueLo] "r" ((value).lo),															\
+			  [ValueHi] "r" ((value).hi),															\
+			  [ShiftAmount] "n" (shift_amount)														\
+		)
+#endif
+#endif
+
+	// PSRAW
+#ifdef PS2INTRIN_UNSAFE
+	/// @brief PSRAW : Parallel Shift Right Arithmetic Word
+	/// 
+	/// Arithmetically right shift 32-bit values. Shifts in sign bits into the upper bits.
+	/// @param result Variable identifier to store result to. Must be of type 'm128i32'
+	/// @param value Variable identifier to use as source value. Must be of type 'm128i32'
+	/// @param shift_amount Amount of bits to shift the source value left. Must be in range [0, 31]
+	#define PSRAW(result, value, shift_amount)														\
+		asm(																						\
+			"psraw	%[Result],%[Value],%c[ShiftAmount]"												\
+			: [Result] "=r" ((result).v)															\
+			: [Value] "r" ((value).v),																\
+			  [ShiftAmount] "n" (shift_amount)														\
+		)
+#else
+	/// @brief PSRAW : Parallel Shift Right Arithmetic Word
+	/// 
+	/// Arithmetically right shift 32-bit values. Shifts in sign bits into the upper bits.
+	/// @param result Variable identifier to store result to. Must be of type 'm128i32'
+	/// @param value Variable identifier to use as source value. Must be of type 'm128i32'
+	/// @param shift_amount Amount of bits to shift the source value left. Must be in range [0, 31]
+#ifdef PS2INTRIN_HOST
+	#define PSRAW(result, value, shift_amount)														\
+		{																							\
+			int32_t lanes[4];																		\
+			memcpy(lanes, &(value), sizeof(lanes));													\
+			for (int i = 0; i < 4; ++i)																\
+				lanes[i] = lanes[i] >> ((shift_amount) & 31);										\
+			memcpy(&(result), lanes, sizeof(lanes));												\
+		}
+#else
+	#define PSRAW(result, value, shift_amount)														\
+		asm(																						\
+			"pcpyld	%[ResultLo],%[ValueHi],%[ValueLo]\n\t"											\
+			"psraw	%[ResultLo],%[ResultLo],%c[ShiftAmount]\n\t"									\
+			"pcpyud	%[ResultHi],%[ResultLo],%[ResultLo]"											\
+			: [ResultLo] "=r" ((result).lo),														\
+			  [ResultHi] "=&r" ((result).hi)														\
+			: [ValueLo] "r" ((value).lo),															\
+			  [ValueHi] "r" ((value).hi),															\
+			  [ShiftAmount] "n" (shift_amount)														\
+		)
+#endif
+#endif
+
+	/// @brief PSRAVW : Parallel Shift Right Arithmetic Variable Word
+	/// 
+	/// Treat 128-bit packed integer data as 2 sign-extended 32-bit values. Shift each value
+	/// right while shifting in sign bits by an amount equal to the corresponding value in
+	/// 'shift_amount'. Only the low 5 bits in each value of 'shift_amount' are used, others
+	/// are ignored.
+	/// @param value Values to shift
+	/// @param shift_amount Amount to shift values by
+	/// @return Values shifted right by variable amount
+	FORCEINLINE CONST m128i64 mm_srav_epi64(m128i64 value, m128u64 shift_amount)
+	{
+		m128i64 result = {};
+
+#ifdef PS2INTRIN_UNSAFE
+		asm(
+			"psravw	%[Result],%[Value],%[Amount]"
+			: [Result] "=r" (result.v)
+			: [Value] "r" (value.v),
+			  [Amount] "r" (shift_amount.v)
+		);
+#elif defined(PS2INTRIN_HOST)
+		uint64_t lanes[2];
+
+		memcpy(lanes, &value, sizeof(lanes));
+		lanes[0] = (uint64_t)(int64_t)((int32_t)lanes[0] >> (shift_amount.lo & 31));
+		lanes[1] = (uint64_t)(int64_t)((int32_t)lanes[1] >> (shift_amount.hi & 31));
+		memcpy(&result, lanes, sizeof(lanes));
+#else
+		asm(
+			"pcpyld	%[ValueLo],%[ValueHi],%[ValueLo]\n\t"
+			"pcpyld	%[AmountLo],%[AmountHi],%[AmountLo]\n\t"
+			"psravw	%[ResultLo],%[ValueLo],%[AmountLo]\n\t"
+			"pcpyud	%[ResultHi],%[ResultLo],%[ResultLo]"
+			: [ResultLo] "=r" (result.lo),
+			  [ResultHi] "=&r" (result.hi)
+			: [ValueLo] "r" (value.lo),
+			  [ValueHi] "r" (value.hi),
+			  [AmountLo] "r" (shift_amount.lo),
+			  [AmountHi] "r" (shift_amount.hi)
+		);
+#endif
+
+		return result;
+	}
+
+	// PSRLH
+#ifdef PS2INTRIN_UNSAFE
+	/// @brief PSRLH : Parallel Shift Right Logical Halfword
+	/// 
+	/// Logically right shift 16-bit values. Shifts in '0's into the upper bits.
+	/// @param result Variable identifier to store result to. Must be of type 'm128u16'
+	/// @param value Variable identifier to use as source value. Must be of type 'm128u16'
+	/// @param shift_amount Amount of bits to shift the source value right. Must be in range [0, 15]
+	#define PSRLH(result, value, shift_amount)														\
+		asm(																						\
+			"psrlh	%[Result],%[Value],%c[ShiftAmount]"												\
+			: [Result] "=r" ((result).v)															\
+			: [Value] "r" ((value).v),																\
+			  [ShiftAmount] "n" (shift_amount)														\
+		)
+#else
+	/// @brief PSRLH : Parallel Shift Right Logical Halfword
+	/// 
+	/// Logically right shift 16-bit values. Shifts in '0's into the upper bits.
+	/// @param result Variable identifier to store result to. Must be of type 'm128u16'
+	/// @param value Variable identifier to use as source value. Must be of type 'm128u16'
+	/// @param shift_amount Amount of bits to shift the source value right. Must be in range [0, 15]
+#ifdef PS2INTRIN_HOST
+	#define PSRLH(result, value, shift_amount)														\
+		{																							\
+			uint16_t lanes[8];																		\
+			memcpy(lanes, &(value), sizeof(lanes));													\
+			for (int i = 0; i < 8; ++i)																\
+				lanes[i] = (uint16_t)(lanes[i] >> ((shift_amount) & 15));							\
+			memcpy(&(result), lanes, sizeof(lanes));												\
+		}
+#else
+	#define PSRLH(result, value, shift_amount)														\
+		asm(																						\
+			"pcpyld	%[ResultLo],%[ValueHi],%[ValueLo]\n\t"											\
+			"psrlh	%[ResultLo],%[ResultLo],%c[ShiftAmount]\n\t"									\
+			"pcpyud	%[ResultHi],%[ResultLo],%[ResultLo]"											\
+			: [ResultLo] "=r" ((result).lo),														\
+			  [ResultHi] "=&r" ((result).hi)														\
+			: [ValueLo] "r" ((value).lo),															\
+			  [ValueHi] "r" ((value).hi),															\
+			  [ShiftAmount] "n" (shift_amount)														\
+		)
+#endif
+#endif
+
+	// PSRLW
+#ifdef PS2INTRIN_UNSAFE
+	/// @brief PSRLW : Parallel Shift Right Logical Word
+	/// 
+	/// Logically right shift 32-bit values. Shifts in '0's into the upper bits.
+	/// @param result Variable identifier to store result to. Must be of type 'm128u32'
+	/// @param value Variable identifier to use as source value. Must be of type 'm128u32'
+	/// @param shift_amount Amount of bits to shift the source value left. Must be in range [0, 31]
+	#define PSRLW(result, value, shift_amount)														\
+		asm(																						\
+			"psrlw	%[Result],%[Value],%c[ShiftAmount]"												\
+			: [Result] "=r" ((result).v)															\
+			: [Value] "r" ((value).v),																\
+			  [ShiftAmount] "n" (shift_amount)														\
+		)
+#else
+	/// @brief PSRLW : Parallel Shift Right Logical Word
+	/// 
+	/// Logically right shift 32-bit values. Shifts in '0's into the upper bits.
+	/// @param result Variable identifier to store result to. Must be of type 'm128u32'
+	/// @param value Variable identifier to use as source value. Must be of type 'm128u32'
+	/// @param shift_amount Amount of bits to shift the source value left. Must be in range [0, 31]
+#ifdef PS2INTRIN_HOST
+	#define PSRLW(result, value, shift_amount)														\
+		{																							\
+			uint32_t lanes[4];																		\
+			memcpy(lanes, &(value), sizeof(lanes));													\
+			for (int i = 0; i < 4; ++i)																\
+				lanes[i] = lanes[i] >> ((shift_amount) & 31);										\
+			memcpy(&(result), lanes, sizeof(lanes));												\
+		}
+#else
+	#define PSRLW(result, value, shift_amount)														\
+		asm(																						\
+			"pcpyld	%[ResultLo],%[ValueHi],%[ValueLo]\n\t"											\
+			"psrlw	%[ResultLo],%[ResultLo],%c[ShiftAmount]\n\t"									\
+			"pcpyud	%[ResultHi],%[ResultLo],%[ResultLo]"											\
+			: [ResultLo] "=r" ((result).lo),														\
+			  [ResultHi] "=&r" ((result).hi)														\
+			: [ValueLo] "r" ((value).lo),															\
+			  [ValueHi] "r" ((value).hi),															\
+			  [ShiftAmount] "n" (shift_amount)														\
+		)
+#endif
+#endif
+
+	/// @brief PSRAVW : Parallel Shift Right Logical Variable Word
+	/// 
+	/// Treat 128-bit packed integer data as 2 sign-extended 32-bit values. Shift each value
+	/// right while shifting in '0's by an amount equal to the corresponding value in
+	/// 'shift_amount'. Only the low 5 bits in each value of 'shift_amount' are used, others
+	/// are ignored.
+	/// @param value Values to shift
+	/// @param shift_amount Amount to shift values by
+	/// @return Values shifted right by variable amount
+	FORCEINLINE CONST m128u64 mm_srlv_epu64(m128u64 value, m128u64 shift_amount)
+	{
+		m128u64 result = {};
+
+#ifdef PS2INTRIN_UNSAFE
+		asm(
+			"psrlvw	%[Result],%[Value],%[Amount]"
+			: [Result] "=r" (result.v)
+			: [Value] "r" (value.v),
+			  [Amount] "r" (shift_amount.v)
+		);
+#elif defined(PS2INTRIN_HOST)
+		uint64_t lanes[2];
+
+		memcpy(lanes, &value, sizeof(lanes));
+		lanes[0] = (uint64_t)(int64_t)(int32_t)((uint32_t)lanes[0] >> (shift_amount.lo & 31));
+		lanes[1] = (uint64_t)(int64_t)(int32_t)((uint32_t)lanes[1] >> (shift_amount.hi & 31));
+		memcpy(&result, lanes, sizeof(lanes));
+#else
+		asm(
+			"pcpyld	%[ValueLo],%[ValueHi],%[ValueLo]\n\t"
+			"pcpyld	%[AmountLo],%[AmountHi],%[AmountLo]\n\t"
+			"psrlvw	%[ResultLo],%[ValueLo],%[AmountLo]\n\t"
+			"pcpyud	%[ResultHi],%[ResultLo],%[ResultLo]"
+			: [ResultLo] "=r" (result.lo),
+			  [ResultHi] "=&r" (result.hi)
+			: [ValueLo] "r" (value.lo),
+			  [ValueHi] "r" (value.hi),
+			  [AmountLo] "r" (shift_amount.lo),
+			  [AmountHi] "r" (shift_amount.hi)
+		);
+#endif
+
+		return result;
+	}
+
+#ifdef __cplusplus
+}
+#endif
+
+#include "detail/end.h"
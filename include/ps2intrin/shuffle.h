@@ -0,0 +1,460 @@
+#pragma once
+
+/*
+*	Multimedia shuffles: halfword broadcast, doubleword unpacking, exchanges, reversal and
+*	rotation.
+*/
+
+#include "common.h"
+
+#include "detail/begin.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+	/// @brief PCPYH : Parallel CoPY Halfword
+	/// 
+	/// Out of the 8 16-bit values in the input value select those at position 0 and 4. Broadcast
+	/// the value at position 0 to positions 0, 1, 2 and 3; and the value at position 4 to
+	/// positions 4, 5, 6, and 7 of the return value.
+	/// @param v Value to broadcast from
+	/// @return Broadcasted values
+	FORCEINLINE CONST m128i16 mm_broadcast2_epi16(m128i16 v)
+	{
+		m128i16 result = {};
+
+#ifdef PS2INTRIN_UNSAFE
+		asm(
+			"pcpyh	%[Result],%[Value]"
+			: [Result] "=r" (result.v)
+			: [Value] "r" (v.v)
+		);
+#elif defined(PS2INTRIN_HOST)
+		uint16_t values[8];
+		uint16_t lanes[8];
+
+		memcpy(values, &v, sizeof(values));
+		for (int i = 0; i < 8; ++i)
+		{
+			lanes[i] = values[i & 4];
+		}
+		memcpy(&result, lanes, sizeof(lanes));
+#else
+		asm(
+			"pcpyld	%[ValueLo],%[ValueHi],%[ValueLo]\n\t"
+			"pcpyh	%[ResultLo],%[ValueLo]\n\t"
+			"pcpyud	%[ResultHi],%[ResultLo],%[ResultLo]"
+			: [ResultLo] "=r" (result.lo),
+			  [ResultHi] "=&r" (result.hi)
+			: [ValueLo] "r" (v.lo),
+			  [ValueHi] "r" (v.hi)
+		);
+#endif
+
+		return result;
+	}
+
+	/// @brief PCPYH : Parallel CoPY Halfword
+	/// 
+	/// Out of the 8 16-bit values in the input value select those at position 0 and 4. Broadcast
+	/// the value at position 0 to positions 0, 1, 2 and 3; and the value at position 4 to
+	/// positions 4, 5, 6, and 7 of the return value.
+	/// @param v Value to broadcast from
+	/// @return Broadcasted values
+	FORCEINLINE CONST m128u16 mm_broadcast2_epu16(m128u16 v)
+	{
+		return mm_castepu16_epi16(mm_broadcast2_epi16(mm_castepi16_epu16(v)));
+	}
+
+	/// @brief PCPYLD : Parallel CoPY Lower Doubleword
+	/// 
+	/// Select the lower 64 bits of each input value and combine them into a 128-bit value.
+	/// @param lower Value to put in the low 64 bits of the return value
+	/// @param upper Value to put in the high 64 bits of the return value
+	/// @return Combined values
+	FORCEINLINE CONST m128i64 mm_unpacklo_epi64(m128i64 lower, m128i64 upper)
+	{
+		m128i64 result = {};
+
+#ifdef PS2INTRIN_UNSAFE
+		asm(
+			"pcpyld	%[Result],%[Upper],%[Lower]"
+			: [Result] "=r" (result.v)
+			: [Upper] "r" (upper.v),
+			  [Lower] "r" (lower.v)
+		);
+#else
+		result.lo = lower.lo;
+		result.hi = upper.lo;
+#endif
+
+		return result;
+	}
+
+	/// @brief PCPYLD : Parallel CoPY Lower Doubleword
+	/// 
+	/// Select the lower 64 bits of each input value and combine them into a 128-bit value.
+	/// @param lower Value to put in the low 64 bits of the return value
+	/// @param upper Value to put in the high 64 bits of the return value
+	/// @return Combined values
+	FORCEINLINE CONST m128u64 mm_unpacklo_epu64(m128u64 lower, m128u64 upper)
+	{
+		return mm_castepu64_epi64(mm_unpacklo_epi64(mm_castepi64_epu64(lower), mm_castepi64_epu64(upper)));
+	}
+
+	/// @brief PCPYUD : Parallel CoPY Upper Doubleword
+	/// 
+	/// Select the high 64 bits of each input value and combine them into a 128-bit value.
+	/// @param lower Value to put in the low 64 bits of the return value
+	/// @param upper Value to put in the high 64 bits of the return value
+	/// @return Combined values
+	FORCEINLINE CONST m128i64 mm_unpackhi_epi64(m128i64 lower, m128i64 upper)
+	{
+		m128i64 result = {};
+
+#ifdef PS2INTRIN_UNSAFE
+		asm(
+			"pcpyud	%[Result],%[Lower],%[Upper]"
+			: [Result] "=r" (result.v)
+			: [Upper] "r" (upper.v),
+			  [Lower] "r" (lower.v)
+		);
+#else
+		result.lo = lower.hi;
+		result.hi = upper.hi;
+#endif
+
+		return result;
+	}
+
+	/// @brief PCPYUD : Parallel CoPY Upper Doubleword
+	/// 
+	/// Select the high 64 bits of each input value and combine them into a 128-bit value.
+	/// @param lower Value to put in the low 64 bits of the return value
+	/// @param upper Value to put in the high 64 bits of the return value
+	/// @return Combined values
+	FORCEINLINE CONST m128u64 mm_unpackhi_epu64(m128u64 lower, m128u64 upper)
+	{
+		return mm_castepu64_epi64(mm_unpackhi_epi64(mm_castepi64_epu64(lower), mm_castepi64_epu64(upper)));
+	}
+
+	/// @brief PEXCH : Parallel EXchange Center Halfword
+	/// 
+	/// Split the 8 16-bit values into 2 groups of 4. The low group spans values at porition 0,
+	/// 1, 2 and 3. The upper group spans 4, 5, 6 and 7. Exchange values in the center of each
+	/// group. 1 will swap with 2 and 5 will swap with 6.
+	/// @param v Values to exchange values in
+	/// @return Values after exchanging center values
+	FORCEINLINE CONST m128i16 mm_xchgcenter_epi16(m128i16 v)
+	{
+		m128i16 result = {};
+
+#ifdef PS2INTRIN_UNSAFE
+		asm(
+			"pexch	%[Result],%[Value]"
+			: [Result] "=r" (result.v)
+			: [Value] "r" (v.v)
+		);
+#elif defined(PS2INTRIN_HOST)
+		uint16_t values[8];
+		uint16_t lanes[8];
+
+		memcpy(values, &v, sizeof(values));
+		for (int i = 0; i < 8; ++i)
+		{
+			lanes[i] = values[(i & 4) | (i & 1) << 1 | (i & 2) >> 1];
+		}
+		memcpy(&result, lanes, sizeof(lanes));
+#else
+		asm(
+			"pcpyld	%[ValueLo],%[ValueHi],%[ValueLo]\n\t"
+			"pexch	%[ResultLo],%[ValueLo]\n\t"
+			"pcpyud	%[ResultHi],%[ResultLo],%[ResultLo]"
+			: [ResultLo] "=r" (result.lo),
+			  [ResultHi] "=&r" (result.hi)
+			: [ValueLo] "r" (v.lo),
+			  [ValueHi] "r" (v.hi)
+		);
+#endif
+
+		return result;
+	}
+
+	/// @brief PEXCH : Parallel EXchange Center Halfword
+	/// 
+	/// Split the 8 16-bit values into 2 groups of 4. The low group spans values at porition 0,
+	/// 1, 2 and 3. The upper group spans 4, 5, 6 and 7. Exchange values in the center of each
+	/// group. 1 will swap with 2 and 5 will swap with 6.
+	/// @param v Values to exchange values in
+	/// @return Values after exchanging center values
+	FORCEINLINE CONST m128u16 mm_xchgcenter_epu16(m128u16 v)
+	{
+		return mm_castepu16_epi16(mm_xchgcenter_epi16(mm_castepi16_epu16(v)));
+	}
+
+	/// @brief PEXCW : Parallel EXchange Center Word
+	/// 
+	/// Take 4 32-bit values. Swap the central 2 values.
+	/// @param v Value to exchange elements in
+	/// @return Value after exchanging elements
+	FORCEINLINE CONST m128i32 mm_xchgcenter_epi32(m128i32 v)
+	{
+		m128i32 result = {};
+
+#ifdef PS2INTRIN_UNSAFE
+		asm(
+			"pexcw	%[Result],%[Value]"
+			: [Result] "=r" (result.v)
+			: [Value] "r" (v.v)
+		);
+#elif defined(PS2INTRIN_HOST)
+		uint32_t values[4];
+		uint32_t lanes[4];
+
+		memcpy(values, &v, sizeof(values));
+		for (int i = 0; i < 4; ++i)
+		{
+			lanes[i] = values[(i & 1) << 1 | (i & 2) >> 1];
+		}
+		memcpy(&result, lanes, sizeof(lanes));
+#else
+		asm(
+			"pcpyld	%[ValueLo],%[ValueHi],%[ValueLo]\n\t"
+			"pexcw	%[ResultLo],%[ValueLo]\n\t"
+			"pcpyud	%[ResultHi],%[ResultLo],%[ResultLo]"
+			: [ResultLo] "=r" (result.lo),
+			  [ResultHi] "=&r" (result.hi)
+			: [ValueLo] "r" (v.lo),
+			  [ValueHi] "r" (v.hi)
+		);
+#endif
+
+		return result;
+	}
+
+	/// @brief PEXCW : Parallel EXchange Center Word
+	/// 
+	/// Take 4 32-bit values. Swap the central 2 values.
+	/// @param v Value to exchange elements in
+	/// @return Value after exchanging elements
+	FORCEINLINE CONST m128u32 mm_xchgcenter_epu32(m128u32 v)
+	{
+		return mm_castepu32_epi32(mm_xchgcenter_epi32(mm_castepi32_epu32(v)));
+	}
+
+	/// @brief PEXEH : Parallel EXchange Even Halfword
+	/// 
+	/// Split the 8 16-bit values into 2 groups of 4. The low group spans values at porition 0,
+	/// 1, 2 and 3. The upper group spans 4, 5, 6 and 7. Exchange values in even positions of each
+	/// group. 0 will swap with 2 and 4 will swap with 6.
+	/// @param v Values to exchange values in
+	/// @return Values after exchanging center values
+	FORCEINLINE CONST m128i16 mm_xchgeven_epi16(m128i16 v)
+	{
+		m128i16 result = {};
+
+#ifdef PS2INTRIN_UNSAFE
+		asm(
+			"pexeh	%[Result],%[Value]"
+			: [Result] "=r" (result.v)
+			: [Value] "r" (v.v)
+		);
+#elif defined(PS2INTRIN_HOST)
+		uint16_t values[8];
+		uint16_t lanes[8];
+
+		memcpy(values, &v, sizeof(values));
+		for (int i = 0; i < 8; ++i)
+		{
+			lanes[i] = values[i & 1 ? i : i ^ 2];
+		}
+		memcpy(&result, lanes, sizeof(lanes));
+#else
+		asm(
+			"pcpyld	%[ValueLo],%[ValueHi],%[ValueLo]\n\t"
+			"pexeh	%[ResultLo],%[ValueLo]\n\t"
+			"pcpyud	%[ResultHi],%[ResultLo],%[ResultLo]"
+			: [ResultLo] "=r" (result.lo),
+			  [ResultHi] "=&r" (result.hi)
+			: [ValueLo] "r" (v.lo),
+			  [ValueHi] "r" (v.hi)
+		);
+#endif
+
+		return result;
+	}
+
+	/// @brief PEXEH : Parallel EXchange Even Halfword
+	/// 
+	/// Split the 8 16-bit values into 2 groups of 4. The low group spans values at porition 0,
+	/// 1, 2 and 3. The upper group spans 4, 5, 6 and 7. Exchange values in even positions of each
+	/// group. 0 will swap with 2 and 4 will swap with 6.
+	/// @param v Values to exchange values in
+	/// @return Values after exchanging center values
+	FORCEINLINE CONST m128u16 mm_xchgeven_epu16(m128u16 v)
+	{
+		return mm_castepu16_epi16(mm_xchgeven_epi16(mm_castepi16_epu16(v)));
+	}
+
+	/// @brief PEXEW : Parallel EXchange Even Word
+	/// 
+	/// Take 4 32-bit values. Swap the values in even positions, 0 and 2.
+	/// @param v Value to exchange elements in
+	/// @return Value after exchanging elements
+	FORCEINLINE CONST m128i32 mm_xchgeven_epi32(m128i32 v)
+	{
+		m128i32 result = {};
+
+#ifdef PS2INTRIN_UNSAFE
+		asm(
+			"pexew	%[Result],%[Value]"
+			: [Result] "=r" (result.v)
+			: [Value] "r" (v.v)
+		);
+#elif defined(PS2INTRIN_HOST)
+		uint32_t values[4];
+		uint32_t lanes[4];
+
+		memcpy(values, &v, sizeof(values));
+		for (int i = 0; i < 4; ++i)
+		{
+			lanes[i] = values[i & 1 ? i : i ^ 2];
+		}
+		memcpy(&result, lanes, sizeof(lanes));
+#else
+		asm(
+			"pcpyld	%[ValueLo],%[ValueHi],%[ValueLo]\n\t"
+			"pexew	%[ResultLo],%[ValueLo]\n\t"
+			"pcpyud	%[ResultHi],%[ResultLo],%[ResultLo]"
+			: [ResultLo] "=r" (result.lo),
+			  [ResultHi] "=&r" (result.hi)
+			: [ValueLo] "r" (v.lo),
+			  [ValueHi] "r" (v.hi)
+		);
+#endif
+
+		return result;
+	}
+
+	/// @brief PEXEW : Parallel EXchange Even Word
+	/// 
+	/// Take 4 32-bit values. Swap the values in even positions, 0 and 2.
+	/// @param v Value to exchange elements in
+	/// @return Value after exchanging elements
+	FORCEINLINE CONST m128u32 mm_xchgeven_epu32(m128u32 v)
+	{
+		return mm_castepu32_epi32(mm_xchgeven_epi32(mm_castepi32_epu32(v)));
+	}
+
+	/// @brief PREVH : Parallel REVerse Halfword
+	/// 
+	/// Split the 8 16-bit values into 2 groups of 4. The low group spans values at porition 0,
+	/// 1, 2 and 3. The upper group spans 4, 5, 6 and 7. Reverse the order within each group. The
+	/// total order of the return value is: 3, 2, 1, 0, 7, 6, 5, 4.
+	/// @param v Value to reverse elements in
+	/// @return Value after reversing elements
+	FORCEINLINE CONST m128i16 mm_reverse_epi16(m128i16 v)
+	{
+		m128i16 result = {};
+
+#ifdef PS2INTRIN_UNSAFE
+		asm(
+			"prevh	%[Result],%[Value]"
+			: [Result] "=r" (result.v)
+			: [Value] "r" (v.v)
+		);
+#elif defined(PS2INTRIN_HOST)
+		uint16_t values[8];
+		uint16_t lanes[8];
+
+		memcpy(values, &v, sizeof(values));
+		for (int i = 0; i < 8; ++i)
+		{
+			lanes[i] = values[i ^ 3];
+		}
+		memcpy(&result, lanes, sizeof(lanes));
+#else
+		asm(
+			"pcpyld	%[ValueLo],%[ValueHi],%[ValueLo]\n\t"
+			"prevh	%[ResultLo],%[ValueLo]\n\t"
+			"pcpyud	%[ResultHi],%[ResultLo],%[ResultLo]"
+			: [ResultLo] "=r" (result.lo),
+			  [ResultHi] "=&r" (result.hi)
+			: [ValueLo] "r" (v.lo),
+			  [ValueHi] "r" (v.hi)
+		);
+#endif
+
+		return result;
+	}
+
+	/// @brief PREVH : Parallel REVerse Halfword
+	/// 
+	/// Split the 8 16-bit values into 2 groups of 4. The low group spans values at porition 0,
+	/// 1, 2 and 3. The upper group spans 4, 5, 6 and 7. Reverse the order within each group. The
+	/// total order of the return value is: 3, 2, 1, 0, 7, 6, 5, 4.
+	/// @param v Value to reverse elements in
+	/// @return Value after reversing elements
+	FORCEINLINE CONST m128u16 mm_reverse_epu16(m128u16 v)
+	{
+		return mm_castepu16_epi16(mm_reverse_epi16(mm_castepi16_epu16(v)));
+	}
+
+	/// @brief PROT3W: Parallel ROTate 3 Words left
+	/// 
+	/// Select the lower 3 32-bit values from 4. Rotate those 3 words 1 position towards a lower
+	/// position. Values at position 0, 1 and 2 go to location 2, 0 and 1.
+	/// @param v Value to rotate words in
+	/// @return Value after rotating words
+	FORCEINLINE CONST m128i32 mm_rot3_epi32(m128i32 v)
+	{
+		m128i32 result = {};
+
+#ifdef PS2INTRIN_UNSAFE
+		asm(
+			"prot3w	%[Result],%[Value]"
+			: [Result] "=r" (result.v)
+			: [Value] "r" (v.v)
+		);
+#elif defined(PS2INTRIN_HOST)
+		uint32_t values[4];
+		uint32_t lanes[4];
+
+		memcpy(values, &v, sizeof(values));
+		for (int i = 0; i < 4; ++i)
+		{
+			lanes[i] = values[i == 3 ? 3 : (i + 1) % 3];
+		}
+		memcpy(&result, lanes, sizeof(lanes));
+#else
+		asm(
+			"pcpyld	%[ValueLo],%[ValueHi],%[ValueLo]\n\t"
+			"prot3w	%[ResultLo],%[ValueLo]\n\t"
+			"pcpyud	%[ResultHi],%[ResultLo],%[ResultLo]"
+			: [ResultLo] "=r" (result.lo),
+			  [ResultHi] "=&r" (result.hi)
+			: [ValueLo] "r" (v.lo),
+			  [ValueHi] "r" (v.hi)
+		);
+#endif
+
+		return result;
+	}
+
+	/// @brief PROT3W: Parallel ROTate 3 Words left
+	/// 
+	/// Select the lower 3 32-bit values from 4. Rotate those 3 words 1 position towards a lower
+	/// position. Values at position 0, 1 and 2 go to location 2, 0 and 1.
+	/// @param v Value to rotate words in
+	/// @return Value after rotating words
+	FORCEINLINE CONST m128u32 mm_rot3_epu32(m128u32 v)
+	{
+		return mm_castepu32_epi32(mm_rot3_epi32(mm_castepi32_epu32(v)));
+	}
+
+#ifdef __cplusplus
+}
+#endif
+
+#include "detail/end.h"
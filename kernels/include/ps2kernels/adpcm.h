@@ -0,0 +1,64 @@
+#pragma once
+
+/*
+*	SPU2 ADPCM encoding and decoding.
+*
+*	A block of 16 bytes holds 28 samples: a header byte with the shift (bits 0-3) and the
+*	prediction filter (bits 4-6), a flags byte and 14 bytes of 4-bit residuals, lower nibble
+*	first. Encoding depends on the samples decoded from the previous block, so a stream is
+*	encoded in order. Independent streams can be encoded in parallel.
+*/
+
+#include <stddef.h>
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+	/// Samples per ADPCM block
+	#define ADPCM_BLOCK_SAMPLES 28
+	/// Bytes per ADPCM block
+	#define ADPCM_BLOCK_BYTES 16
+
+	/// Block flag: Jump to the loop start address after this block
+	#define ADPCM_FLAG_LOOP_END 1
+	/// Block flag: Keep playing after a loop end, otherwise the voice is released
+	#define ADPCM_FLAG_LOOP_REPEAT 2
+	/// Block flag: Store the address of this block as loop start address
+	#define ADPCM_FLAG_LOOP_START 4
+
+	/// @brief State carried from one block to the next
+	typedef struct
+	{
+		/// Last two input samples, most recent first. Used to choose the filter.
+		int16_t input[2];
+		/// Last two decoded samples, most recent first. Used to predict the next sample.
+		int16_t decoded[2];
+	} adpcm_state_t;
+
+	/// @brief Prepare state for the start of a stream
+	/// @param state State to initialize
+	void adpcm_state_construct(adpcm_state_t* state);
+
+	/// @brief Encode 16-bit PCM samples
+	///
+	/// Every block chooses the filter predicting the input best and the smallest shift the
+	/// residuals fit in, then quantizes the residuals against the decoded samples, so rounding
+	/// errors do not accumulate. The flags byte of every block is 0.
+	/// @param state Stream state, updated
+	/// @param dst Output, 'block_count * ADPCM_BLOCK_BYTES' bytes
+	/// @param src Input, 'block_count * ADPCM_BLOCK_SAMPLES' mono samples
+	/// @param block_count Number of blocks to encode
+	void adpcm_encode(adpcm_state_t* state, uint8_t* dst, const int16_t* src, size_t block_count);
+
+	/// @brief Decode ADPCM blocks like the SPU2
+	/// @param state Stream state, updated. Only 'decoded' is used.
+	/// @param dst Output, 'block_count * ADPCM_BLOCK_SAMPLES' samples
+	/// @param src Input, 'block_count * ADPCM_BLOCK_BYTES' bytes
+	/// @param block_count Number of blocks to decode
+	void adpcm_decode(adpcm_state_t* state, int16_t* dst, const uint8_t* src, size_t block_count);
+
+#ifdef __cplusplus
+}
+#endif
@@ -0,0 +1,48 @@
+#pragma once
+
+/*
+*	Base64 (RFC 4648, '+' and '/') and hexadecimal encoding and decoding, 16 characters per
+*	quadword. Characters are classified with byte range compares and translated by adding a
+*	per-range offset. Decoders report the position of the first invalid character.
+*/
+
+#include <stddef.h>
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+	/// @brief Number of characters 'base64_encode' writes for 'length' bytes
+	#define BASE64_ENCODED_SIZE(length) (((length) + 2) / 3 * 4)
+
+	/// @brief Largest number of bytes 'base64_decode' writes for 'length' characters
+	#define BASE64_DECODED_SIZE(length) (((length) + 3) / 4 * 3)
+
+	/// @brief Encode bytes to base64 with '=' padding
+	/// @param output Receives 'BASE64_ENCODED_SIZE(length)' characters, not terminated
+	/// @return Number of characters written
+	size_t base64_encode(const uint8_t* input, size_t length, char* output);
+
+	/// @brief Decode base64, the '=' padding being optional
+	/// @param output Receives the bytes, 'BASE64_DECODED_SIZE(length)' at most
+	/// @param invalid Receives the position of the first invalid character, 'length' if there
+	/// is none. Misplaced '=' and a final group of 1 character are invalid.
+	/// @return Number of bytes written, those before the group of the invalid character
+	size_t base64_decode(const char* input, size_t length, uint8_t* output, size_t* invalid);
+
+	/// @brief Encode bytes to lowercase hexadecimal
+	/// @param output Receives '2 * length' characters, not terminated
+	/// @return Number of characters written
+	size_t hex_encode(const uint8_t* input, size_t length, char* output);
+
+	/// @brief Decode hexadecimal, either case
+	/// @param output Receives 'length / 2' bytes at most
+	/// @param invalid Receives the position of the first invalid character, 'length' if there
+	/// is none. An odd final character is invalid.
+	/// @return Number of bytes written, those before the invalid character
+	size_t hex_decode(const char* input, size_t length, uint8_t* output, size_t* invalid);
+
+#ifdef __cplusplus
+}
+#endif
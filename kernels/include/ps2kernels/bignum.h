@@ -0,0 +1,78 @@
+#pragma once
+
+/*
+*	Multi-precision unsigned integers and Montgomery modular exponentiation, e.g. for RSA
+*	signature verification.
+*
+*	Numbers are arrays of 32-bit words, least significant first. Products run on both integer
+*	multipliers: MULTU/MADDU on pipeline 0 and MULTU1/MADDU1 on pipeline 1 handle independent
+*	carry chains, each carry staying in its LO/HI pair.
+*/
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+	/// Largest number of words of a Montgomery modulus, 2048 bits
+	#define BIGNUM_MAX_WORDS 64
+
+	/// @brief Montgomery context of an odd modulus 'n' of 'words' words, with 'R = 2^(32 * words)'
+	typedef struct
+	{
+		uint32_t modulus[BIGNUM_MAX_WORDS];
+		/// 'R^2 mod n'
+		uint32_t r_squared[BIGNUM_MAX_WORDS];
+		/// '-n^-1 mod 2^32'
+		uint32_t inverse;
+		size_t words;
+	} bignum_montgomery_t;
+
+	/// @brief 'result = a + b'
+	/// @return Carry out, 0 or 1
+	uint32_t bignum_add(uint32_t* result, const uint32_t* a, const uint32_t* b, size_t words);
+
+	/// @brief 'result = a - b'
+	/// @return Borrow out, 0 or 1
+	uint32_t bignum_sub(uint32_t* result, const uint32_t* a, const uint32_t* b, size_t words);
+
+	/// @brief Compare 'a' and 'b'
+	/// @return -1, 0 or 1 if 'a' is less than, equal to or greater than 'b'
+	int bignum_compare(const uint32_t* a, const uint32_t* b, size_t words);
+
+	/// @brief Schoolbook product 'result = a * b'
+	/// @param result Receives '2 * words' words, must not overlap 'a' or 'b'
+	void bignum_mul(uint32_t* result, const uint32_t* a, const uint32_t* b, size_t words);
+
+	/// @brief Read a big-endian byte string, as found in signatures and keys
+	/// @param result Receives 'words' words, zero-extended or truncated to the low bytes
+	void bignum_from_bytes(uint32_t* result, size_t words, const uint8_t* bytes, size_t length);
+
+	/// @brief Write the low 'length' bytes of 'a' as a big-endian byte string
+	void bignum_to_bytes(uint8_t* bytes, size_t length, const uint32_t* a, size_t words);
+
+	/// @brief Set up a Montgomery context
+	/// @param modulus Odd modulus with its top word not 0
+	/// @param words Number of words, at most 'BIGNUM_MAX_WORDS'
+	/// @return Whether the modulus is usable
+	bool bignum_montgomery_init(bignum_montgomery_t* context, const uint32_t* modulus, size_t words);
+
+	/// @brief Montgomery product 'result = a * b / R mod n'
+	/// @param a, b Values below the modulus
+	/// @param result Receives 'context->words' words, may alias 'a' or 'b'
+	void bignum_montgomery_mul(const bignum_montgomery_t* context, uint32_t* result, const uint32_t* a,
+							   const uint32_t* b);
+
+	/// @brief Modular exponentiation 'result = base^exponent mod n'
+	/// @param base Value below the modulus
+	/// @param exponent Exponent of 'exponent_words' words, e.g. 65537 for RSA verification
+	/// @param result Receives 'context->words' words, may alias 'base'
+	void bignum_mod_exp(const bignum_montgomery_t* context, uint32_t* result, const uint32_t* base,
+						const uint32_t* exponent, size_t exponent_words);
+
+#ifdef __cplusplus
+}
+#endif
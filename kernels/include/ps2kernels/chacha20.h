@@ -0,0 +1,51 @@
+#pragma once
+
+/*
+*	ChaCha20 stream cipher (RFC 8439), 4 blocks at a time with one state word of each block per
+*	32-bit lane. The host backend produces the same keystream, so data encrypted on the EE can be
+*	decrypted by tools and servers built with 'PS2INTRIN_KERNEL_MODE=host'.
+*/
+
+#include <stddef.h>
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+	#define CHACHA20_KEY_SIZE 32
+	#define CHACHA20_NONCE_SIZE 12
+	#define CHACHA20_BLOCK_SIZE 64
+
+	/// @brief Cipher state, 16-byte aligned
+	typedef struct
+	{
+		/// Keystream of the last 4 blocks
+		uint32_t keystream[CHACHA20_BLOCK_SIZE];
+		/// Constants, key, block counter and nonce
+		uint32_t input[16];
+		/// Bytes of 'keystream' already used
+		size_t used;
+	} chacha20_t;
+
+	/// @brief Start a stream
+	/// @param context State to set up, aligned on a 16-byte boundary
+	/// @param key 256-bit key
+	/// @param nonce 96-bit nonce, never reused with the same key
+	/// @param counter Block to start at, 1 for the payload of RFC 8439 AEAD
+	void chacha20_init(chacha20_t* context, const uint8_t key[CHACHA20_KEY_SIZE],
+					   const uint8_t nonce[CHACHA20_NONCE_SIZE], uint32_t counter);
+
+	/// @brief Encrypt or decrypt the next bytes of the stream
+	///
+	/// Calls can split the stream anywhere. Runs of 256 bytes are processed without going
+	/// through 'keystream' if 'input' and 'output' are aligned on a 16-byte boundary.
+	/// @param context Stream state
+	/// @param output Receives 'input' XOR keystream, may be 'input'
+	/// @param input Bytes to process
+	/// @param length Number of bytes
+	void chacha20_xor(chacha20_t* context, uint8_t* output, const uint8_t* input, size_t length);
+
+#ifdef __cplusplus
+}
+#endif
@@ -0,0 +1,48 @@
+#pragma once
+
+/*
+*	Internet checksum (RFC 1071), the ones' complement sum of big-endian 16-bit words used by
+*	IPv4, UDP and TCP. Words are summed into 32-bit lanes, 8 per quadword, and the carries are
+*	folded back once at the end.
+*/
+
+#include <stddef.h>
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+	/// @brief Add data to a partial checksum
+	///
+	/// A message can be summed in parts, starting from a sum of 0. Every part but the last must
+	/// have an even length.
+	/// @param sum Partial checksum of the parts before
+	/// @return Partial checksum including 'data', at most 0xFFFF
+	uint32_t inet_checksum_add(uint32_t sum, const uint8_t* data, size_t length);
+
+	/// @brief Partial checksum of the IPv4 pseudo header of UDP and TCP
+	/// @param source Source address, first octet in the most significant byte
+	/// @param destination Destination address, first octet in the most significant byte
+	/// @param protocol 17 for UDP, 6 for TCP
+	/// @param length Length of the UDP or TCP header and data
+	uint32_t inet_checksum_pseudo_header(uint32_t source, uint32_t destination, uint8_t protocol, uint16_t length);
+
+	/// @brief Checksum to store from a partial checksum
+	/// @return Checksum, to be stored big-endian
+	uint16_t inet_checksum_finish(uint32_t sum);
+
+	/// @brief Checksum of a whole message
+	/// @return Checksum, to be stored big-endian
+	uint16_t inet_checksum(const uint8_t* data, size_t length);
+
+	/// @brief Update a checksum after a 16-bit word of the message changed (RFC 1624)
+	/// @param checksum Stored checksum
+	/// @param old_word Previous value of the word
+	/// @param new_word New value of the word
+	/// @return Checksum of the updated message
+	uint16_t inet_checksum_update(uint16_t checksum, uint16_t old_word, uint16_t new_word);
+
+#ifdef __cplusplus
+}
+#endif
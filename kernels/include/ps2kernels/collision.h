@@ -0,0 +1,108 @@
+#pragma once
+
+/*
+*	Broadphase collision tests: one AABB or sphere against a batch stored as SoA streams, and a
+*	sweep-and-prune pass finding all overlapping pairs of a set of AABBs.
+*
+*	The batch tests compare one box against 4 boxes with 32-bit coordinates or 8 boxes with
+*	16-bit coordinates per iteration, without branches, and return the hits as a bit set.
+*/
+
+#include <stddef.h>
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+	/// Axis-aligned box, bounds included
+	typedef struct
+	{
+		int32_t min[3];
+		int32_t max[3];
+	} aabb32_t;
+
+	typedef struct
+	{
+		int16_t min[3];
+		int16_t max[3];
+	} aabb16_t;
+
+	typedef struct
+	{
+		int16_t x;
+		int16_t y;
+		int16_t z;
+		int16_t radius;
+	} sphere16_t;
+
+	/// @brief Boxes as one stream per bound and axis
+	///
+	/// Every array must be aligned on a 16-byte boundary and have room for the number of boxes
+	/// rounded up to a multiple of 4 (32-bit) or 8 (16-bit). The padding is read but ignored.
+	typedef struct
+	{
+		const int32_t* min[3];
+		const int32_t* max[3];
+	} aabb32_streams_t;
+
+	typedef struct
+	{
+		const int16_t* min[3];
+		const int16_t* max[3];
+	} aabb16_streams_t;
+
+	/// @brief Spheres as one stream per coordinate, same requirements as 'aabb16_streams_t'
+	typedef struct
+	{
+		const int16_t* x;
+		const int16_t* y;
+		const int16_t* z;
+		const int16_t* radius;
+	} sphere16_streams_t;
+
+	/// Pair of overlapping boxes, as indices into the streams
+	typedef struct
+	{
+		uint32_t a;
+		uint32_t b;
+	} collision_pair_t;
+
+	/// @brief Test one box against a batch of boxes
+	/// @param box Box to test
+	/// @param boxes Batch
+	/// @param count Number of boxes in the batch
+	/// @param hits Receives bit 'i % 32' of word 'i / 32' set if 'box' overlaps box 'i',
+	/// '(count + 31) / 32' words
+	/// @return Number of boxes overlapping 'box'
+	size_t aabb32_overlap(const aabb32_t* box, const aabb32_streams_t* boxes, size_t count, uint32_t* hits);
+
+	/// @brief Test one box against a batch of boxes, see 'aabb32_overlap'
+	size_t aabb16_overlap(const aabb16_t* box, const aabb16_streams_t* boxes, size_t count, uint32_t* hits);
+
+	/// @brief Test one sphere against a batch of spheres, see 'aabb32_overlap'
+	///
+	/// Spheres touching each other overlap. The differences of the coordinates and the sums of
+	/// the radii must fit in 16 bits, e.g. coordinates and radii in [-16384, 16383]. Squared
+	/// distances are exact in this whole range.
+	size_t sphere16_overlap(const sphere16_t* sphere, const sphere16_streams_t* spheres, size_t count, uint32_t* hits);
+
+	/// @brief Size of the work memory 'aabb32_sweep_and_prune' needs, in bytes
+	size_t aabb32_sweep_and_prune_work_size(size_t count);
+
+	/// @brief Find all pairs of overlapping boxes
+	///
+	/// Sorts the boxes by their minimum x coordinate, then tests every box against the following
+	/// boxes starting before its maximum x, 4 at a time.
+	/// @param boxes Boxes
+	/// @param count Number of boxes
+	/// @param work 'aabb32_sweep_and_prune_work_size(count)' bytes, aligned on a 16-byte boundary
+	/// @param pairs Receives up to 'max_pairs' pairs, with 'a' sorted before 'b' along x
+	/// @param max_pairs Capacity of 'pairs'
+	/// @return Number of overlapping pairs, which may be larger than 'max_pairs'
+	size_t aabb32_sweep_and_prune(const aabb32_streams_t* boxes, size_t count, void* work, collision_pair_t* pairs,
+								  size_t max_pairs);
+
+#ifdef __cplusplus
+}
+#endif
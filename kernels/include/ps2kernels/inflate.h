@@ -0,0 +1,103 @@
+#pragma once
+
+/*
+*	Streaming inflate (RFC 1951), raw deflate or wrapped in zlib (RFC 1950). Output goes to a
+*	window provided by the caller that doubles as the history matches copy from. Matches are
+*	copied a quadword at a time, realigned with QFSRV.
+*/
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+	/// Distance a match can reach back
+	#define INFLATE_HISTORY 32768
+
+	/// Number of code bits looked up at once, longer codes are searched
+	#define INFLATE_FAST_BITS 10
+
+	/// Result of 'inflate_run'
+	typedef enum
+	{
+		/// The end of the stream was reached
+		INFLATE_DONE,
+		/// All input was used, call again with more
+		INFLATE_NEED_INPUT,
+		/// The window is full, take the output and call 'inflate_slide'
+		INFLATE_WINDOW_FULL,
+		/// The stream is malformed
+		INFLATE_ERROR,
+	} inflate_status_t;
+
+	/// @brief Canonical Huffman code
+	typedef struct
+	{
+		/// Symbol and length ('symbol << 4 | length') of the codes up to 'INFLATE_FAST_BITS'
+		/// bits indexed by the next bits of the stream, 0 for longer codes
+		uint16_t fast[1 << INFLATE_FAST_BITS];
+		/// End of the codes of each length, left-aligned to 16 bits
+		uint32_t limit[16];
+		/// Index in 'symbols' of the first code of each length minus that code
+		int32_t offset[16];
+		/// Shortest length of the codes starting with 'n + 1' ones, left-aligned
+		uint8_t start_length[16];
+		/// Symbols by code
+		uint16_t symbols[288];
+	} inflate_code_t;
+
+	typedef struct
+	{
+		inflate_code_t literals;
+		inflate_code_t distances;
+		/// Output, 16-byte aligned
+		uint8_t* window;
+		/// Size of 'window', a multiple of 16
+		size_t window_size;
+		/// Bytes of 'window' written
+		size_t position;
+		/// Bits of the next input byte already used
+		unsigned bit_offset;
+		/// What to read next
+		unsigned state;
+		/// Whether the current block is the last one
+		bool last_block;
+		/// Whether the stream is wrapped in zlib
+		bool zlib;
+		/// Bytes left in the current stored block
+		size_t stored_left;
+		/// Rest of a match that did not fit in the window
+		size_t match_left;
+		size_t match_distance;
+		/// Adler-32 of the output before 'checked'
+		uint32_t adler;
+		size_t checked;
+	} inflate_t;
+
+	/// @brief Prepare to inflate a stream
+	/// @param window Output, 16-byte aligned. It holds the whole output if it is big enough,
+	/// otherwise more than 'INFLATE_HISTORY' bytes.
+	/// @param window_size Size of 'window', a multiple of 16
+	/// @param zlib Whether the stream has a zlib header and Adler-32 trailer
+	void inflate_init(inflate_t* context, uint8_t* window, size_t window_size, bool zlib);
+
+	/// @brief Inflate as much of the input as the window can take
+	///
+	/// New output is written at 'window + position', 'position' before the call.
+	/// @param input Input following the bytes consumed so far
+	/// @param consumed Receives the number of bytes of 'input' used. The next call starts at
+	/// 'input + consumed'.
+	/// @return Why it stopped
+	inflate_status_t inflate_run(inflate_t* context, const uint8_t* input, size_t length, size_t* consumed);
+
+	/// @brief Make room after 'INFLATE_WINDOW_FULL'
+	///
+	/// Moves the last 'INFLATE_HISTORY' bytes of output to the start of the window.
+	void inflate_slide(inflate_t* context);
+
+#ifdef __cplusplus
+}
+#endif
@@ -0,0 +1,65 @@
+#pragma once
+
+/*
+*	Fixed-point vertex lighting: diffuse N.L of directional and point lights, accumulated onto
+*	prelit or ambient colors, 4 vertices at a time.
+*
+*	Point lights use one direction for the whole batch, e.g. from the center of the object to the
+*	light, and are attenuated per vertex by '1 - d^2 / radius^2'. Colors are accumulated with 4
+*	fraction bits and saturated to RGBA8 at the end.
+*/
+
+#include <stddef.h>
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+	/// Largest number of lights per call
+	#define LIGHT_MAX_COUNT 8
+
+	/// Largest radius of a point light
+	#define LIGHT_MAX_RADIUS 16383
+
+	typedef struct
+	{
+		/// Unit vector towards the light, Q1.14
+		int16_t direction[3];
+		/// Position of a point light, in the units of the vertex positions
+		int16_t position[3];
+		/// Radius of a point light, [1, 'LIGHT_MAX_RADIUS'], 0 for a directional light
+		int16_t radius;
+		/// Color at full intensity, 8 bits per channel
+		uint8_t color[3];
+	} light_t;
+
+	/// @brief Vertex streams
+	///
+	/// Vectors are stored as 'x y z 0'. Every array must be aligned on a 16-byte boundary.
+	typedef struct
+	{
+		/// Unit normals, Q1.14
+		const int16_t* normals;
+		/// Positions, only read if there are point lights
+		const int16_t* positions;
+		/// Prelit RGBA8 colors, 'NULL' to start from the ambient color
+		const uint32_t* colors;
+	} lighting_input_t;
+
+	/// @brief Light vertices
+	///
+	/// Each light adds 'color * max(N.L, 0) * attenuation' to the prelit or ambient color of a
+	/// vertex, alpha is kept.
+	/// @param input Vertices
+	/// @param lights Lights
+	/// @param light_count Number of lights, at most 'LIGHT_MAX_COUNT'
+	/// @param ambient RGBA8 color used if 'input->colors' is 'NULL'
+	/// @param output Receives the RGBA8 colors, aligned on a 16-byte boundary
+	/// @param count Number of vertices
+	void light_vertices(const lighting_input_t* input, const light_t* lights, size_t light_count, uint32_t ambient,
+						uint32_t* output, size_t count);
+
+#ifdef __cplusplus
+}
+#endif
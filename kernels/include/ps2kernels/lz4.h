@@ -0,0 +1,58 @@
+#pragma once
+
+/*
+*	LZ4 block compression with a hash chain match finder. Matches are extended 16 bytes at a time
+*	with byte compares, the first mismatch is found with PLZCW. The effort sets how many earlier
+*	positions are tried per match, trading time for ratio. The output is a standard LZ4 block.
+*/
+
+#include <stddef.h>
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+	/// Bits of the hash of 4 bytes
+	#define LZ4_HASH_BITS 12
+
+	/// Efforts: one candidate per position and faster skipping of incompressible data, a
+	/// balance, the deepest search
+	#define LZ4_EFFORT_FAST 1
+	#define LZ4_EFFORT_DEFAULT 16
+	#define LZ4_EFFORT_MAX 256
+
+	/// @brief Largest compressed size of 'length' bytes
+	#define LZ4_COMPRESSED_SIZE(length) ((length) + (length) / 255 + 16)
+
+	/// Returned by 'lz4_decompress' for malformed input or too small output
+	#define LZ4_ERROR SIZE_MAX
+
+	/// @brief Memory of the match finder
+	typedef struct
+	{
+		/// Last position plus one of each hash, 0 if none
+		uint32_t head[1 << LZ4_HASH_BITS];
+		/// Distance to the previous position with the same hash, 0 if none, by position
+		/// modulo 65536
+		uint16_t chain[65536];
+	} lz4_workspace_t;
+
+	/// @brief Compress to an LZ4 block
+	/// @param output Receives the block, 'LZ4_COMPRESSED_SIZE(length)' bytes always suffice
+	/// @param capacity Size of 'output'
+	/// @param effort Number of earlier positions tried per match, 'LZ4_EFFORT_FAST' to
+	/// 'LZ4_EFFORT_MAX'
+	/// @param workspace Match finder memory, its contents need not be initialized
+	/// @return Size of the block, 0 if it does not fit in 'capacity'
+	size_t lz4_compress(const uint8_t* input, size_t length, uint8_t* output, size_t capacity, unsigned effort,
+						lz4_workspace_t* workspace);
+
+	/// @brief Decompress an LZ4 block
+	/// @param capacity Size of 'output'
+	/// @return Number of bytes written, 'LZ4_ERROR' if the block is malformed or does not fit
+	size_t lz4_decompress(const uint8_t* input, size_t length, uint8_t* output, size_t capacity);
+
+#ifdef __cplusplus
+}
+#endif
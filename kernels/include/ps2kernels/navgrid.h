@@ -0,0 +1,71 @@
+#pragma once
+
+/*
+*	Distance maps and flow fields over int16 grids, 8 cells per quadword.
+*
+*	Distances propagate along rows with a min-plus prefix scan of 3 funnel shifts (QFSRV) and a
+*	step from the quadword before, so a whole row is relaxed in one sweep, and between rows from
+*	the row above or below.
+*	A distance of 'NAV_INFINITY' marks cells that are not reached, additions saturate at it.
+*
+*	Grids are stored row by row. The width must be a multiple of 8 and every grid aligned on a
+*	16-byte boundary.
+*/
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+	/// Distance of cells not reached, and cost of blocked cells
+	#define NAV_INFINITY INT16_MAX
+
+	/// Chamfer costs of orthogonal and diagonal steps, 5-7 is within 2% of the euclidean distance
+	#define NAV_CHAMFER_ORTHOGONAL 5
+	#define NAV_CHAMFER_DIAGONAL 7
+
+	/// Direction of a flow field cell without a neighbor closer to the goals
+	#define NAV_FLOW_NONE 8
+
+	/// @brief Chamfer distance transform
+	///
+	/// Runs pairs of forward and backward raster passes, 8-connected, until the distances are
+	/// stable or 'max_passes' pairs ran. Two pairs are enough without walls; paths winding around
+	/// walls need more.
+	/// @param distance 0 for the goals, 'NAV_INFINITY' for the other cells. Receives the distance
+	/// to the closest goal in multiples of 'NAV_CHAMFER_ORTHOGONAL' per cell.
+	/// @param walls 'NAV_INFINITY' for blocked cells, 0 for free ones
+	/// @param width Width of the grid, a multiple of 8
+	/// @param height Height of the grid
+	/// @param max_passes Largest number of pass pairs
+	/// @return Number of pass pairs that ran
+	size_t nav_chamfer(int16_t* distance, const int16_t* walls, size_t width, size_t height, size_t max_passes);
+
+	/// @brief Relax a distance map once with per-cell costs, 4-connected
+	///
+	/// One top to bottom and one bottom to top sweep of 'distance = min(distance, neighbor + cost)'.
+	/// Repeating until nothing changes gives the cheapest paths to the goals.
+	/// @param distance Distances, see 'nav_chamfer'
+	/// @param costs Cost of entering each cell, 'NAV_INFINITY' for blocked cells
+	/// @param width Width of the grid, a multiple of 8
+	/// @param height Height of the grid
+	/// @return Whether any distance changed
+	bool nav_relax(int16_t* distance, const int16_t* costs, size_t width, size_t height);
+
+	/// @brief Point every cell to its neighbor closest to the goals
+	///
+	/// Directions are numbered counter-clockwise from +x, with rows in +y: 0 is (+1, 0), 1 is
+	/// (+1, -1), 2 is (0, -1), up to 7 being (+1, +1). Ties prefer orthogonal neighbors. Cells
+	/// without a closer neighbor get 'NAV_FLOW_NONE'.
+	/// @param distance Distance map
+	/// @param directions Receives one direction per cell, aligned on an 8-byte boundary
+	/// @param width Width of the grid, a multiple of 8
+	/// @param height Height of the grid
+	void nav_flow_field(const int16_t* distance, uint8_t* directions, size_t width, size_t height);
+
+#ifdef __cplusplus
+}
+#endif
@@ -0,0 +1,83 @@
+#pragma once
+
+/*
+*	Software occlusion culling with a 256x128 depth buffer: occluder triangles are rasterized with
+*	edge functions evaluated for 4 pixels per quadword, occludees are tested by reducing the depth
+*	buffer over their screen rectangle.
+*
+*	Depth values are 24-bit like Z24 on the GS, with larger values closer to the camera (e.g. a
+*	scaled '1 / w'), so the buffer is cleared to 0 and updated with the maximum. The buffer is
+*	stored as rows of 'OCCLUSION_WIDTH' 32-bit values. Occluders can be rasterized into bands of
+*	rows, so bands of 'OCCLUSION_SCRATCHPAD_ROWS' rows can be double-buffered in scratchpad.
+*/
+
+#include <stddef.h>
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+	#define OCCLUSION_WIDTH 256
+	#define OCCLUSION_HEIGHT 128
+
+	/// Largest depth value, closest to the camera
+	#define OCCLUSION_DEPTH_MAX 0xFFFFFF
+
+	/// Rows per band so that two bands fit in 16 KiB of scratchpad
+	#define OCCLUSION_SCRATCHPAD_ROWS 8
+
+	/// @brief Vertex of an occluder triangle
+	///
+	/// Coordinates are screen pixels in 12.4 fixed point, the pixel (x, y) covering [16 * x,
+	/// 16 * x + 16). Triangles must be clipped to the near plane and have coordinates in [-512,
+	/// 512) pixels.
+	typedef struct
+	{
+		int32_t x;
+		int32_t y;
+		/// Depth, [0, 'OCCLUSION_DEPTH_MAX']
+		int32_t z;
+	} occlusion_vertex_t;
+
+	/// @brief Screen rectangle of an occludee
+	typedef struct
+	{
+		/// Pixels covered, minimum included and maximum excluded
+		int16_t x0;
+		int16_t y0;
+		int16_t x1;
+		int16_t y1;
+		/// Depth of the closest point of the occludee
+		int32_t depth;
+	} occlusion_rect_t;
+
+	/// @brief Rasterize occluder triangles into a band of rows of the depth buffer
+	///
+	/// Pixels are covered if their center is inside a triangle or on an edge, both windings are
+	/// rasterized. The depth is interpolated at the pixel centers and clamped to the depth range
+	/// of the triangle.
+	/// @param band Rows 'first_row' to 'first_row + rows - 1' of the depth buffer, aligned on a
+	/// 16-byte boundary
+	/// @param first_row First row of the band
+	/// @param rows Number of rows in the band
+	/// @param vertices 3 vertices per triangle
+	/// @param triangle_count Number of triangles
+	void occlusion_rasterize(int32_t* band, unsigned first_row, unsigned rows, const occlusion_vertex_t* vertices,
+							 size_t triangle_count);
+
+	/// @brief Test occludees against the depth buffer
+	///
+	/// An occludee is visible if the buffer is not closer than its depth at any pixel of its
+	/// rectangle. Rectangles are clipped to the buffer, those outside of it are not visible.
+	/// @param depth Depth buffer, aligned on a 16-byte boundary
+	/// @param rects Rectangles to test
+	/// @param count Number of rectangles
+	/// @param visible Receives bit 'i % 32' of word 'i / 32' set if occludee 'i' is visible,
+	/// '(count + 31) / 32' words
+	/// @return Number of visible occludees
+	size_t occlusion_test(const int32_t* depth, const occlusion_rect_t* rects, size_t count, uint32_t* visible);
+
+#ifdef __cplusplus
+}
+#endif
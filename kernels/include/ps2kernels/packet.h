@@ -0,0 +1,173 @@
+#pragma once
+
+/*
+*	GIF packet and DMA chain builder.
+*
+*	Quadwords are assembled in registers and written with SQ directly into one of two packet
+*	buffers: while the DMA controller sends one buffer, the next packet is built in the other.
+*	The buffers may be written through the uncached accelerated segment, which merges writes in
+*	the uncached write-back buffer and keeps packet data out of the data cache.
+*
+*	With the host backend, every finished packet is checked by 'packet_validate'.
+*/
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+	/// GIF tag data formats
+	#define GIF_FLG_PACKED 0
+	#define GIF_FLG_REGLIST 1
+	#define GIF_FLG_IMAGE 2
+
+	/// GIF tag register descriptors
+	#define GIF_REG_PRIM 0x0
+	#define GIF_REG_RGBAQ 0x1
+	#define GIF_REG_ST 0x2
+	#define GIF_REG_UV 0x3
+	#define GIF_REG_XYZF2 0x4
+	#define GIF_REG_XYZ2 0x5
+	#define GIF_REG_TEX0_1 0x6
+	#define GIF_REG_TEX0_2 0x7
+	#define GIF_REG_CLAMP_1 0x8
+	#define GIF_REG_CLAMP_2 0x9
+	#define GIF_REG_FOG 0xA
+	#define GIF_REG_XYZF3 0xC
+	#define GIF_REG_XYZ3 0xD
+	#define GIF_REG_AD 0xE
+	#define GIF_REG_NOP 0xF
+
+	/// DMA source chain tag IDs
+	#define DMA_TAG_REFE 0
+	#define DMA_TAG_CNT 1
+	#define DMA_TAG_NEXT 2
+	#define DMA_TAG_REF 3
+	#define DMA_TAG_REFS 4
+	#define DMA_TAG_CALL 5
+	#define DMA_TAG_RET 6
+	#define DMA_TAG_END 7
+
+	/// Builder flag: Write through the uncached accelerated segment
+	#define PACKET_BUILDER_UNCACHED_ACCELERATED 1
+
+	/// What 'packet_validate' expects
+	typedef enum
+	{
+		/// GIF packets, the last one with EOP set
+		PACKET_GIF,
+		/// DMA source chain of CNT/REF/REFE/END tags carrying GIF packets
+		PACKET_DMA_CHAIN,
+	} packet_kind_t;
+
+	typedef struct
+	{
+		/// Start of both buffers, as written to
+		uint64_t* buffers[2];
+		/// Added to the address of the memory to write through the uncached accelerated segment
+		uintptr_t segment;
+		/// Size of each buffer in quadwords
+		size_t capacity;
+		/// Buffer currently built
+		unsigned current;
+		/// Next quadword to write, 2 'uint64_t' per quadword
+		uint64_t* cursor;
+		uint64_t* end;
+		/// Set when a packet did not fit. Everything emitted after that is dropped.
+		bool overflow;
+		/// Description of the first problem found when finishing a packet, empty if none
+		char error[96];
+	} packet_builder_t;
+
+	/// @brief Prepare a double-buffered builder
+	///
+	/// With 'PACKET_BUILDER_UNCACHED_ACCELERATED', 'memory' must not have dirty lines in the data
+	/// cache, i.e. it must be written back before, as cached writes would overwrite packet data
+	/// when evicted later. The flag is ignored by the host backend.
+	/// @param builder Builder to initialize
+	/// @param memory Memory for both buffers. Aligned to a cache line (64 bytes) and in
+	/// main memory.
+	/// @param size Size of 'memory' in bytes
+	/// @param flags 0 or 'PACKET_BUILDER_UNCACHED_ACCELERATED'
+	void packet_builder_construct(packet_builder_t* builder, void* memory, size_t size, unsigned flags);
+
+	/// @brief Start a packet in the buffer not used by the previous packet
+	///
+	/// The DMA transfer of the packet before the previous one must have finished.
+	void packet_builder_begin(packet_builder_t* builder);
+
+	/// @brief Finish the packet
+	/// @param builder Builder
+	/// @param kind Expected structure, checked with the host backend
+	/// @param qwc Receives the size in quadwords
+	/// @return Start of the packet in the memory passed to 'packet_builder_construct', or NULL if
+	/// the packet overflowed or, with the host backend, is malformed ('error' tells why)
+	void* packet_builder_finish(packet_builder_t* builder, packet_kind_t kind, size_t* qwc);
+
+	/// @brief Reserve quadwords to be filled by the caller
+	/// @return The first reserved quadword, 16-byte aligned, or NULL on overflow
+	uint64_t* packet_reserve(packet_builder_t* builder, size_t qwc);
+
+	/// @brief Emit one quadword
+	void packet_qword(packet_builder_t* builder, uint64_t lo, uint64_t hi);
+
+	/// @brief Copy quadwords into the packet
+	/// @param src 16-byte aligned data
+	/// @param qwc Number of quadwords
+	void packet_data(packet_builder_t* builder, const void* src, size_t qwc);
+
+	/// @brief Emit a GIF tag
+	/// @param nloop Loop count, [0, 32767]
+	/// @param eop End of packet
+	/// @param flg 'GIF_FLG_*'
+	/// @param nreg Number of register descriptors, [1, 16]
+	/// @param regs Register descriptors, 4 bits each, first in the lowest bits
+	void packet_gif_tag(packet_builder_t* builder, unsigned nloop, bool eop, unsigned flg, unsigned nreg, uint64_t regs);
+
+	/// @brief Emit a GIF tag writing PRIM before the data
+	/// @param prim Value for the PRIM register, [0, 2047]
+	void packet_gif_tag_prim(packet_builder_t* builder, unsigned nloop, bool eop, unsigned flg, unsigned nreg,
+							 uint64_t regs, unsigned prim);
+
+	/// @brief Emit an A+D entry writing 'value' to the GS register at 'address'
+	void packet_ad(packet_builder_t* builder, unsigned address, uint64_t value);
+
+	/// @brief Open a PACKED A+D GIF tag whose NLOOP is filled in by 'packet_gif_ad_close'
+	/// @return Handle for 'packet_gif_ad_close'
+	size_t packet_gif_ad_open(packet_builder_t* builder, bool eop);
+
+	/// @brief Set NLOOP of an open A+D GIF tag to the number of entries emitted since
+	void packet_gif_ad_close(packet_builder_t* builder, size_t handle);
+
+	/// @brief Emit a DMA tag
+	/// @param id 'DMA_TAG_*'
+	/// @param qwc Quadwords transferred by the tag
+	/// @param address Address for REF/REFE/REFS/NEXT/CALL, 16-byte aligned
+	void packet_dma_tag(packet_builder_t* builder, unsigned id, unsigned qwc, const void* address);
+
+	/// @brief Open a CNT or END DMA tag whose QWC is filled in by 'packet_dma_close'
+	/// @return Handle for 'packet_dma_close'
+	size_t packet_dma_open(packet_builder_t* builder, unsigned id);
+
+	/// @brief Set QWC of an open DMA tag to the number of quadwords emitted since
+	void packet_dma_close(packet_builder_t* builder, size_t handle);
+
+	/// @brief Check the structure of a packet
+	///
+	/// Checks that every GIF tag is followed by as much data as it announces, that the last
+	/// GIF packet has EOP set and that A+D entries address existing GS registers. In a DMA
+	/// chain, data referenced by REF/REFE tags is not inspected.
+	/// @param data Start of the packet
+	/// @param qwc Size in quadwords
+	/// @param kind Expected structure
+	/// @param message Receives a description of the first problem, may be NULL
+	/// @param message_size Size of 'message'
+	/// @return true if no problem was found
+	bool packet_validate(const void* data, size_t qwc, packet_kind_t kind, char* message, size_t message_size);
+
+#ifdef __cplusplus
+}
+#endif
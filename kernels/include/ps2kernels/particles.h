@@ -0,0 +1,61 @@
+#pragma once
+
+/*
+*	Particle update: integration, aging and removal of dead particles, 4 particles at a time.
+*
+*	Particles are stored as SoA streams of 32-bit fixed-point values. Dead particles are removed
+*	by compacting the streams in place without branches: every particle is written to the next
+*	output slot and the slot only advances if the particle is alive.
+*
+*	The update only touches each particle once, front to back, so a large system can be updated
+*	in blocks of 'PARTICLE_SCRATCHPAD_BLOCK' particles transferred to and from scratchpad.
+*/
+
+#include <stddef.h>
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+	/// Particles per block so that all streams of a block fit in 16 KiB of scratchpad
+	#define PARTICLE_SCRATCHPAD_BLOCK 512
+
+	/// Largest time step, 0.5 s in Q16.16
+	#define PARTICLE_MAX_DT 0x7FFF
+
+	/// @brief Particle streams
+	///
+	/// Every array must be aligned on a 16-byte boundary and have room for 'count' rounded up to
+	/// a multiple of 4.
+	typedef struct
+	{
+		/// Position, Q16.16
+		int32_t* x;
+		int32_t* y;
+		int32_t* z;
+		/// Velocity in units per second, Q16.16
+		int32_t* vx;
+		int32_t* vy;
+		int32_t* vz;
+		/// Remaining lifetime in seconds, Q16.16. Particles die when it reaches 0.
+		int32_t* life;
+		/// Number of particles
+		size_t count;
+	} particle_streams_t;
+
+	/// @brief Advance all particles by one time step
+	///
+	/// The velocity is updated first (semi-implicit Euler): 'v += a * dt', then 'p += v * dt'
+	/// and 'life -= dt', with products rounded towards negative infinity. Dead particles are
+	/// removed, the order of the others is kept.
+	/// @param particles Particles, 'count' is updated
+	/// @param acceleration Acceleration applied to every particle in x, y and z, Q16.16 units
+	/// per second squared
+	/// @param dt Time step in seconds, Q16.16, [0, 'PARTICLE_MAX_DT']
+	/// @return The number of particles left
+	size_t particle_update(particle_streams_t* particles, const int32_t acceleration[3], int32_t dt);
+
+#ifdef __cplusplus
+}
+#endif
@@ -0,0 +1,72 @@
+#pragma once
+
+/*
+*	Segment casts against batches of triangles or AABBs in Q16.16, 4 primitives at a time.
+*
+*	A segment goes from 'origin' to 'origin + delta'. Hits are reported as a bit set and
+*	optionally with the parameter 't' of the first intersection, a fraction of the segment in
+*	Q16.16: 0 at 'origin', 0x10000 at the end. Groups of 4 primitives that cannot be hit skip the
+*	remaining work, in particular the divisions computing 't'.
+*/
+
+#include <ps2kernels/collision.h>
+
+#include <stddef.h>
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+	/// Parameter reported for primitives that are not hit
+	#define RAY_MISS INT32_MAX
+
+	/// Segment from 'origin' to 'origin + delta', Q16.16
+	typedef struct
+	{
+		int32_t origin[3];
+		int32_t delta[3];
+	} ray_segment_t;
+
+	/// @brief Triangles as one stream per coordinate of the first vertex and of the two edges
+	///
+	/// The triangle 'i' has the vertices 'v0', 'v0 + e1' and 'v0 + e2', Q16.16. Every array must
+	/// be aligned on a 16-byte boundary and have room for the number of triangles rounded up to a
+	/// multiple of 4. The padding is read but ignored.
+	typedef struct
+	{
+		const int32_t* v0[3];
+		const int32_t* e1[3];
+		const int32_t* e2[3];
+	} triangle_streams_t;
+
+	/// @brief Cast a segment against a batch of triangles
+	///
+	/// Both sides of the triangles are hit, edges included for triangles whose vertices are
+	/// counter-clockwise as seen from the origin. Cross products of the edges and 'delta' are
+	/// rounded to Q16.16, so the lengths of 'delta' and of the edges must be such that
+	/// '|delta| * |edge|' and '|edge|^2' stay below 32768, and '|origin - v0|' must be below 32768.
+	/// 't' is accurate to about 2^-14, less for segments grazing the plane of the triangle, which
+	/// scale up the rounding of the cross products.
+	/// @param ray Segment
+	/// @param triangles Batch
+	/// @param count Number of triangles in the batch
+	/// @param hits Receives bit 'i % 32' of word 'i / 32' set if the segment hits triangle 'i',
+	/// '(count + 31) / 32' words
+	/// @param t Receives the parameter of the hit for each triangle, 'RAY_MISS' for the others.
+	/// Room for 'count' rounded up to a multiple of 4. May be NULL.
+	/// @return Number of triangles hit
+	size_t ray_triangles(const ray_segment_t* ray, const triangle_streams_t* triangles, size_t count, uint32_t* hits,
+						 int32_t* t);
+
+	/// @brief Cast a segment against a batch of boxes, see 'ray_triangles'
+	///
+	/// Uses the slab test: the segment hits a box if the ranges of 't' inside the bounds of the
+	/// three axes overlap within [0, 0x10000]. Boxes containing the origin are hit at 't' 0. The
+	/// segment end and the differences between the bounds and the origin must fit in 32 bits. 't'
+	/// is accurate to about 2^-13.
+	size_t ray_aabbs(const ray_segment_t* ray, const aabb32_streams_t* boxes, size_t count, uint32_t* hits, int32_t* t);
+
+#ifdef __cplusplus
+}
+#endif
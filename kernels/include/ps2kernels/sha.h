@@ -0,0 +1,51 @@
+#pragma once
+
+/*
+*	Multi-buffer SHA-256 and SHA-1: 4 independent messages are hashed at the same time, one per
+*	32-bit lane. Jobs are queued and a lane takes the next message as soon as its current one is
+*	done, so messages of different lengths keep all lanes busy. The last message left runs on
+*	scalar registers.
+*/
+
+#include <stddef.h>
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+	#define SHA256_DIGEST_SIZE 32
+	#define SHA1_DIGEST_SIZE 20
+
+	/// @brief Message to hash
+	typedef struct
+	{
+		const uint8_t* data;
+		size_t length;
+		/// Receives the digest
+		uint8_t* digest;
+	} sha_job_t;
+
+	/// @brief Hash messages with SHA-256, 4 at a time
+	/// @param jobs Messages and their digests
+	/// @param count Number of messages
+	void sha256_multi(const sha_job_t* jobs, size_t count);
+
+	/// @brief Hash messages with SHA-1, 4 at a time
+	/// @param jobs Messages and their digests
+	/// @param count Number of messages
+	void sha1_multi(const sha_job_t* jobs, size_t count);
+
+	/// @brief Hash one message with SHA-256
+	///
+	/// Runs on scalar registers, prefer queuing several messages with 'sha256_multi'.
+	void sha256(const uint8_t* data, size_t length, uint8_t digest[SHA256_DIGEST_SIZE]);
+
+	/// @brief Hash one message with SHA-1
+	///
+	/// Runs on scalar registers, prefer queuing several messages with 'sha1_multi'.
+	void sha1(const uint8_t* data, size_t length, uint8_t digest[SHA1_DIGEST_SIZE]);
+
+#ifdef __cplusplus
+}
+#endif
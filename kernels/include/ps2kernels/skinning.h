@@ -0,0 +1,88 @@
+#pragma once
+
+/*
+*	Skinning of 16-bit fixed-point vertices on the EE Core, for when VU1 is busy.
+*
+*	Every vertex is influenced by up to 4 bones. The bone matrices are blended per vertex with
+*	PMULTH/PMADDH, weighted in Q1.15, and the blended matrix is applied to the position and the
+*	normal with PHMADH. Vertices are processed 8 at a time from SoA streams.
+*
+*	The palette is accessed in random order, so it should be staged in scratchpad with
+*	'skin_stage_palette' first. With the host backend, results are bit-exact to the EE, which
+*	allows checking them against a floating-point reference on the build machine.
+*/
+
+#include <stddef.h>
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+	/// Number of fractional bits of the rotation/scale elements of bone matrices
+	#define SKIN_MATRIX_SHIFT 12
+
+	/// @brief Bone matrix, 16-byte aligned
+	///
+	/// Rows 0 to 2 of a 4x4 matrix transforming column vectors. Elements 0 to 2 of each row are
+	/// Q3.12, element 3 (the translation) is in the units of the positions. Row 3 is ignored.
+	typedef struct
+	{
+		int16_t rows[4][4];
+	} skin_matrix_t;
+
+	/// SoA vertex streams. Every array must be aligned on a 16-byte boundary.
+	typedef struct
+	{
+		const int16_t* x;
+		const int16_t* y;
+		const int16_t* z;
+		/// Normals, all NULL to skip them
+		const int16_t* nx;
+		const int16_t* ny;
+		const int16_t* nz;
+		/// 4 palette indices per vertex
+		const uint8_t* bones;
+		/// 4 Q1.15 weights per vertex, summing up to at most 32767
+		const int16_t* weights;
+		/// Number of bones used per vertex, [1, 4]. The other slots are not read.
+		unsigned influences;
+	} skin_input_t;
+
+	/// SoA output streams. Every array must be aligned on a 16-byte boundary.
+	typedef struct
+	{
+		int16_t* x;
+		int16_t* y;
+		int16_t* z;
+		/// Ignored if the input has no normals
+		int16_t* nx;
+		int16_t* ny;
+		int16_t* nz;
+	} skin_output_t;
+
+	/// @brief Copy the palette to fast memory
+	/// @param scratch Destination, e.g. scratchpad (0x70000000 on the EE). Must be aligned on a
+	/// 16-byte boundary and hold 'count' matrices; 16 KiB of scratchpad holds 512.
+	/// @param palette Bone matrices
+	/// @param count Number of matrices
+	/// @return The copy, to be passed to 'skin_vertices'
+	skin_matrix_t* skin_stage_palette(void* scratch, const skin_matrix_t* palette, size_t count);
+
+	/// @brief Skin vertices
+	///
+	/// Each vertex is transformed by the sum of its bone matrices scaled by their weights. The
+	/// blended matrix elements are rounded to Q3.12 and the transformed components to integers.
+	/// Blended elements can be half a Q3.12 unit off, so a component differs from a
+	/// floating-point reference by at most '1 + (|x| + |y| + |z|) / 8192', e.g. 2.5 units for
+	/// inputs within +-4096 and 7 within +-16384. Results must fit in 16 bits. Normals are
+	/// transformed without translation and not renormalized.
+	/// @param palette Bone matrices
+	/// @param input Vertex streams
+	/// @param output Output streams, may be the same arrays as the input streams
+	/// @param count Number of vertices
+	void skin_vertices(const skin_matrix_t* palette, const skin_input_t* input, const skin_output_t* output, size_t count);
+
+#ifdef __cplusplus
+}
+#endif
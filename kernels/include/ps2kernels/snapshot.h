@@ -0,0 +1,45 @@
+#pragma once
+
+/*
+*	Delta compression of snapshots against a baseline, a quadword at a time. The delta lists the
+*	runs of unchanged and changed quadwords, then the XOR of each changed quadword with the
+*	baseline. Runs of unchanged quadwords are skipped 4 quadwords per compare.
+*
+*	Format: LEB128 run lengths alternating between unchanged and changed quadwords, starting with
+*	unchanged quadwords (possibly 0) and adding up to the snapshot size, then 16 bytes per
+*	changed quadword.
+*/
+
+#include <stddef.h>
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+	/// @brief Largest delta of a snapshot of 'quadwords' quadwords
+	#define SNAPSHOT_DELTA_SIZE(quadwords) (16 * (quadwords) + 5 * ((quadwords) + 1))
+
+	/// Returned by 'snapshot_delta_decode' for a malformed delta
+	#define SNAPSHOT_DELTA_ERROR SIZE_MAX
+
+	/// @brief Encode the differences between two snapshots
+	/// @param current Snapshot to send, 16-byte aligned
+	/// @param baseline Snapshot the receiver has, 16-byte aligned
+	/// @param quadwords Size of both snapshots in quadwords
+	/// @param output Receives the delta, 'SNAPSHOT_DELTA_SIZE(quadwords)' bytes at most
+	/// @return Size of the delta
+	size_t snapshot_delta_encode(const void* current, const void* baseline, size_t quadwords, uint8_t* output);
+
+	/// @brief Rebuild a snapshot from a baseline and a delta
+	/// @param baseline Snapshot the delta was encoded against, 16-byte aligned
+	/// @param current Receives the snapshot, 16-byte aligned. Can be 'baseline'.
+	/// @param quadwords Size of both snapshots in quadwords
+	/// @return Number of bytes of 'input' used, 'SNAPSHOT_DELTA_ERROR' if the delta is malformed,
+	/// in which case 'current' is left unchanged
+	size_t snapshot_delta_decode(const uint8_t* input, size_t length, const void* baseline, void* current,
+								 size_t quadwords);
+
+#ifdef __cplusplus
+}
+#endif
@@ -0,0 +1,46 @@
+#pragma once
+
+/*
+*	Texture conversion kernels: swizzling of 8-bit indexed textures into the PSMCT32 layout and
+*	conversion of 32-bit RGBA pixels to 16-bit RGBA5551.
+*
+*	These are the same routines at runtime and in the asset pipeline ('ps2intrin-bake'), which
+*	builds them with the host backend.
+*/
+
+#include <stddef.h>
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+	/// @brief Swizzle a PSMT8 texture into the PSMCT32 layout
+	///
+	/// Rearrange 8-bit indices so that uploading them as a PSMCT32 texture of half the width and
+	/// half the height places every index where the GS expects it for a PSMT8 texture. This allows
+	/// uploading indexed textures with the faster 32-bit transfers.
+	///
+	/// Every 16x16 block of indices becomes an 8x8 block of 32-bit pixels. Blocks of 16 rows are
+	/// independent of each other, so a texture can be processed in strips by offsetting both
+	/// pointers by 'row * width' bytes.
+	/// @param dst Output, 'width * height' bytes. Must be aligned on a 16-byte boundary and may
+	/// not overlap 'src'.
+	/// @param src PSMT8 indices, one row of 'width' bytes after another. Must be aligned on a
+	/// 16-byte boundary.
+	/// @param width Width in pixels. Must be a multiple of 16.
+	/// @param height Height in pixels. Must be a multiple of 16.
+	void texture_swizzle8(void* dst, const void* src, size_t width, size_t height);
+
+	/// @brief Convert RGBA8888 pixels to RGBA5551
+	///
+	/// Keep the upper 5 bits of every color channel and the most significant bit of alpha, which
+	/// is set for alpha values of 0x80 (opaque on the GS) and above.
+	/// @param dst Output pixels. Must be aligned on a 16-byte boundary.
+	/// @param src Input pixels, red in the lowest byte. Must be aligned on a 16-byte boundary.
+	/// @param count Number of pixels
+	void texture_rgba32_to_5551(uint16_t* dst, const uint32_t* src, size_t count);
+
+#ifdef __cplusplus
+}
+#endif
@@ -0,0 +1,44 @@
+#pragma once
+
+/*
+*	UTF-8 validation and UTF-8 to UTF-16 transcoding and back. Runs of ASCII are checked and
+*	widened or narrowed 16 characters at a time. Other UTF-8 is validated 16 bytes at a time by
+*	classifying every byte and the 3 bytes before it with byte compares. Overlong forms,
+*	surrogates and code points past U+10FFFF are invalid.
+*/
+
+#include <stddef.h>
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+	/// @brief Largest number of code units 'utf8_to_utf16' writes for 'length' bytes
+	#define UTF8_TO_UTF16_SIZE(length) (length)
+
+	/// @brief Largest number of bytes 'utf16_to_utf8' writes for 'length' code units
+	#define UTF16_TO_UTF8_SIZE(length) (3 * (length))
+
+	/// @brief Validate UTF-8
+	/// @return Position of the first byte of the first invalid or truncated sequence, 'length'
+	/// if the whole input is valid
+	size_t utf8_validate(const char* input, size_t length);
+
+	/// @brief Convert UTF-8 to native endian UTF-16
+	/// @param output Receives 'UTF8_TO_UTF16_SIZE(length)' code units at most
+	/// @param invalid Receives the position of the first invalid sequence, 'length' if there is
+	/// none
+	/// @return Number of code units written, those of the sequences before the invalid one
+	size_t utf8_to_utf16(const char* input, size_t length, uint16_t* output, size_t* invalid);
+
+	/// @brief Convert native endian UTF-16 to UTF-8
+	/// @param output Receives 'UTF16_TO_UTF8_SIZE(length)' bytes at most
+	/// @param invalid Receives the position of the first unpaired surrogate, 'length' if there is
+	/// none
+	/// @return Number of bytes written, those of the code points before the unpaired surrogate
+	size_t utf16_to_utf8(const uint16_t* input, size_t length, char* output, size_t* invalid);
+
+#ifdef __cplusplus
+}
+#endif
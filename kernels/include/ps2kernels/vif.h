@@ -0,0 +1,79 @@
+#pragma once
+
+/*
+*	Encoders for the VIF UNPACK formats V4-32, V4-16, V3-8 and V4-5, for vertex data generated
+*	on the EE Core, and reference decoders doing what the VIF does with the encoded data.
+*
+*	Elements come as four 32-bit fixed-point components, either interleaved (AoS: x y z w x y
+*	z w ...) or in one array per component (SoA). Each format keeps the low bits of every
+*	component: 32, 16 or 8 bits, and for V4-5 the upper 5 bits of x, y and z and the most
+*	significant bit of w taken as 8-bit values, like RGBA8888 colors.
+*
+*	Encoded data is written in whole quadwords, with unused bytes of the last quadword zeroed,
+*	so it can be placed directly after an UNPACK code in a DMA packet.
+*/
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+	/// UNPACK formats, the values are the 'vn' and 'vl' bits of the UNPACK command
+	typedef enum
+	{
+		VIF_V3_8 = 0x0A,
+		VIF_V4_32 = 0x0C,
+		VIF_V4_16 = 0x0D,
+		VIF_V4_5 = 0x0F,
+	} vif_format_t;
+
+	/// @brief Build a VIF UNPACK code
+	/// @param format Format of the data following the code
+	/// @param count Number of elements, [1, 256]
+	/// @param address Address in VU memory in quadwords, [0, 1023]
+	/// @param is_unsigned Zero-extend instead of sign-extend V4-16 and V3-8 components
+	/// @return The 32-bit VIF code
+	static inline uint32_t vif_unpack_code(vif_format_t format, size_t count, unsigned address, bool is_unsigned)
+	{
+		return (0x60u | (uint32_t)format) << 24 | (uint32_t)(count & 0xFF) << 16 | (uint32_t)is_unsigned << 14
+			| (address & 0x3FF);
+	}
+
+	/// @brief Size of 'count' elements encoded in 'format', in quadwords
+	size_t vif_encoded_qwc(vif_format_t format, size_t count);
+
+	/// @brief Encode interleaved elements
+	/// @param format Format to encode to
+	/// @param dst Output, 'vif_encoded_qwc' quadwords. Must be aligned on a 16-byte boundary.
+	/// @param src 4 components per element, 'w' ignored for V3-8. Must be aligned on a 16-byte
+	/// boundary.
+	/// @param count Number of elements
+	/// @return Number of quadwords written
+	size_t vif_encode_aos(vif_format_t format, void* dst, const int32_t* src, size_t count);
+
+	/// @brief Encode elements stored as one array per component
+	/// @param format Format to encode to
+	/// @param dst Output, 'vif_encoded_qwc' quadwords. Must be aligned on a 16-byte boundary.
+	/// @param components Arrays of x, y, z and w, each aligned on a 16-byte boundary. 'w' is
+	/// ignored for V3-8 and may be NULL.
+	/// @param count Number of elements
+	/// @return Number of quadwords written
+	size_t vif_encode_soa(vif_format_t format, void* dst, const int32_t* const components[4], size_t count);
+
+	/// @brief Expand encoded elements the way the VIF does
+	///
+	/// V3-8 elements get a 'w' of 0. V4-5 components are expanded to 8 bits with the low bits
+	/// cleared, whatever 'is_unsigned' is.
+	/// @param format Format of 'src'
+	/// @param dst Output, 4 components per element
+	/// @param src Encoded elements
+	/// @param count Number of elements
+	/// @param is_unsigned Zero-extend instead of sign-extend V4-16 and V3-8 components
+	void vif_decode(vif_format_t format, int32_t* dst, const void* src, size_t count, bool is_unsigned);
+
+#ifdef __cplusplus
+}
+#endif
@@ -0,0 +1,204 @@
+/*
+*	SPU2 ADPCM encoding and decoding, see 'adpcm.h'.
+*
+*	The filter of a block is chosen by predicting all of its samples from the input with every
+*	filter in parallel: 8 residuals per PMULTH/PMSUBH sequence, with the previous samples lined
+*	up by QFSRV. Quantization depends on the previous decoded sample and stays scalar.
+*/
+
+#include <ps2kernels/adpcm.h>
+
+#include <ps2intrin.h>
+
+#include <string.h>
+
+#define FILTER_COUNT 5
+
+/// Prediction coefficients of the SPU2 filters in Q6, for the last and second to last sample.
+static const int16_t filter_coefficients[FILTER_COUNT][2] = {
+	{ 0, 0 },
+	{ 60, 0 },
+	{ 115, -52 },
+	{ 98, -55 },
+	{ 122, -60 },
+};
+
+typedef union
+{
+	uint128_t q;
+	m128i16 v;
+} quadword_t;
+
+static inline int16_t clamp16(int32_t v)
+{
+	return (int16_t)(v < INT16_MIN ? INT16_MIN : v > INT16_MAX ? INT16_MAX : v);
+}
+
+static inline int32_t predict(const int16_t history[2], int filter)
+{
+	return (history[0] * filter_coefficients[filter][0] + history[1] * filter_coefficients[filter][1] + 32) >> 6;
+}
+
+/// @brief Largest absolute value of 4 lanes
+static inline int32_t horizontal_max(m128i32 v)
+{
+	m128i64 v64 = mm_castepi64_epi32(v);
+	v = mm_max_epi32(v, mm_castepi32_epi64(mm_unpackhi_epi64(v64, v64)));
+	v = mm_max_epi32(v, mm_rot3_epi32(v));
+
+	int32_t lanes[4];
+	memcpy(lanes, &v, sizeof(lanes));
+	return lanes[0];
+}
+
+/// @brief Largest residual of every filter when predicting a block from its input, times 64
+/// @param window Quadword 0 holds the previous two samples in lanes 6 and 7, quadwords 1-4 the
+/// block padded with zeros
+/// @param peaks Receives one value per filter
+static void residual_peaks(const quadword_t window[5], int32_t peaks[FILTER_COUNT])
+{
+	sa_state_t sa;
+	lohi_state_t lohi;
+	sa_state_construct(&sa);
+	lohi_state_construct(&lohi);
+
+	// Line the previous and second to previous samples up with every sample.
+	quadword_t previous1[4];
+	quadword_t previous2[4];
+	set_sa_16(&sa, 7);
+	for (int j = 0; j < 4; ++j)
+	{
+		previous1[j].q = byte_shift_logical_right(&sa, window[j + 1].q, window[j].q);
+	}
+	set_sa_16(&sa, 6);
+	for (int j = 0; j < 4; ++j)
+	{
+		previous2[j].q = byte_shift_logical_right(&sa, window[j + 1].q, window[j].q);
+	}
+
+	// Samples 28-31 are padding.
+	m128i32 last_mask = mm_set_epi32(0, 0, -1, -1);
+	m128i16 scale = mm_broadcast_epi16(64);
+
+	for (int f = 0; f < FILTER_COUNT; ++f)
+	{
+		m128i16 k0 = mm_broadcast_epi16(filter_coefficients[f][0]);
+		m128i16 k1 = mm_broadcast_epi16(filter_coefficients[f][1]);
+		m128i32 peak = mm_setzero_epi32();
+
+		for (int j = 0; j < 4; ++j)
+		{
+			// sample * 64 - previous1 * k0 - previous2 * k1, even lanes returned, odd lanes in LO/HI
+			mm_mul_epi16(&lohi, window[j + 1].v, scale);
+			mm_fms_epi16(&lohi, previous1[j].v, k0);
+			m128i32 even = mm_fms_epi16(&lohi, previous2[j].v, k1);
+			m128i32 odd = mm_loadlohi_upper_epi32(&lohi);
+
+			m128i32 residual = mm_max_epi32(mm_abs_epi32(even), mm_abs_epi32(odd));
+			if (j == 3)
+			{
+				residual = mm_and_epi32(residual, last_mask);
+			}
+			peak = mm_max_epi32(peak, residual);
+		}
+
+		peaks[f] = horizontal_max(peak);
+	}
+
+	lohi_state_destruct(&lohi);
+	sa_state_destruct(&sa);
+}
+
+void adpcm_state_construct(adpcm_state_t* state)
+{
+	memset(state, 0, sizeof(*state));
+}
+
+void adpcm_encode(adpcm_state_t* state, uint8_t* dst, const int16_t* src, size_t block_count)
+{
+	for (size_t b = 0; b < block_count; ++b, src += ADPCM_BLOCK_SAMPLES, dst += ADPCM_BLOCK_BYTES)
+	{
+		quadword_t window[5];
+		int16_t samples[40] = { 0 };
+		samples[6] = state->input[1];
+		samples[7] = state->input[0];
+		memcpy(samples + 8, src, ADPCM_BLOCK_SAMPLES * sizeof(int16_t));
+		memcpy(window, samples, sizeof(window));
+
+		int32_t peaks[FILTER_COUNT];
+		residual_peaks(window, peaks);
+
+		int filter = 0;
+		for (int f = 1; f < FILTER_COUNT; ++f)
+		{
+			if (peaks[f] < peaks[filter])
+			{
+				filter = f;
+			}
+		}
+
+		// Smallest scale the residuals fit into 4 bits with.
+		int32_t peak = (peaks[filter] + 63) >> 6;
+		int scale = 0;
+		while (scale < 12 && peak > 7 << scale)
+		{
+			++scale;
+		}
+
+		dst[0] = (uint8_t)(filter << 4 | (12 - scale));
+		dst[1] = 0;
+
+		int32_t rounding = scale ? 1 << (scale - 1) : 0;
+		for (int i = 0; i < ADPCM_BLOCK_SAMPLES; ++i)
+		{
+			int32_t prediction = predict(state->decoded, filter);
+			int32_t residual = (src[i] - prediction + rounding) >> scale;
+			residual = residual < -8 ? -8 : residual > 7 ? 7 : residual;
+
+			state->decoded[1] = state->decoded[0];
+			state->decoded[0] = clamp16(residual * (1 << scale) + prediction);
+
+			if (i & 1)
+			{
+				dst[2 + i / 2] |= (uint8_t)((residual & 0xF) << 4);
+			}
+			else
+			{
+				dst[2 + i / 2] = (uint8_t)(residual & 0xF);
+			}
+		}
+
+		state->input[0] = src[ADPCM_BLOCK_SAMPLES - 1];
+		state->input[1] = src[ADPCM_BLOCK_SAMPLES - 2];
+	}
+}
+
+void adpcm_decode(adpcm_state_t* state, int16_t* dst, const uint8_t* src, size_t block_count)
+{
+	for (size_t b = 0; b < block_count; ++b, src += ADPCM_BLOCK_BYTES, dst += ADPCM_BLOCK_SAMPLES)
+	{
+		int shift = src[0] & 0xF;
+		int filter = (src[0] >> 4) & 0x7;
+		// Like the hardware, which treats shifts 13-15 like shift 9.
+		if (shift > 12)
+		{
+			shift = 9;
+		}
+		if (filter >= FILTER_COUNT)
+		{
+			filter = 0;
+		}
+
+		for (int i = 0; i < ADPCM_BLOCK_SAMPLES; ++i)
+		{
+			int nibble = (src[2 + i / 2] >> ((i & 1) * 4)) & 0xF;
+			int32_t residual = (int16_t)(nibble << 12) >> shift;
+
+			int16_t sample = clamp16(residual + predict(state->decoded, filter));
+
+			state->decoded[1] = state->decoded[0];
+			state->decoded[0] = sample;
+			dst[i] = sample;
+		}
+	}
+}
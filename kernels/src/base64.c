@@ -0,0 +1,336 @@
+/*
+*	Base64 and hexadecimal, see 'base64.h'.
+*
+*	Base64 holds 3 bytes in each 32-bit lane, split into one 6-bit group per byte with PSRLW/PSLLW
+*	and PAND. The EE has no byte shuffle, so bytes are moved in and out of the lanes with scalar
+*	code. Runs with an invalid character and the final group go through the scalar decoder, which
+*	finds the exact position.
+*/
+
+#include <ps2kernels/base64.h>
+
+#include <ps2intrin.h>
+
+#include <string.h>
+
+typedef union
+{
+	m128i8 v;
+	uint8_t b[16];
+	uint32_t w[4];
+	uint64_t d[2];
+} bytes_t;
+
+static const char alphabet[] = "ABCDEFGHIJKLMNOPQRSTUVWXYZabcdefghijklmnopqrstuvwxyz0123456789+/";
+
+/// @brief 0xFF in the bytes between 'low' and 'high', both included
+static inline m128i8 in_range(m128i8 v, int8_t low, int8_t high)
+{
+	return mm_and_epi8(mm_cmpgt_epi8(v, mm_broadcast_epi8((int8_t)(low - 1))),
+					   mm_cmpgt_epi8(mm_broadcast_epi8((int8_t)(high + 1)), v));
+}
+
+static inline m128i8 equal_to(m128i8 v, char c)
+{
+	return mm_cmpeq_epi8(v, mm_broadcast_epi8((int8_t)c));
+}
+
+/// @brief 'v' plus 'offset' where 'mask' is set
+static inline m128i8 add_where(m128i8 v, m128i8 mask, int8_t offset)
+{
+	return mm_add_epi8(v, mm_and_epi8(mask, mm_broadcast_epi8(offset)));
+}
+
+static inline int all_set(const bytes_t* mask)
+{
+	return (mask->d[0] & mask->d[1]) == UINT64_MAX;
+}
+
+/// @brief Value of a base64 character, -1 if invalid
+static inline int base64_value(char c)
+{
+	if (c >= 'A' && c <= 'Z')
+	{
+		return c - 'A';
+	}
+	if (c >= 'a' && c <= 'z')
+	{
+		return c - 'a' + 26;
+	}
+	if (c >= '0' && c <= '9')
+	{
+		return c - '0' + 52;
+	}
+	return c == '+' ? 62 : c == '/' ? 63 : -1;
+}
+
+/// @brief Value of a hexadecimal digit, -1 if invalid
+static inline int hex_value(char c)
+{
+	if (c >= '0' && c <= '9')
+	{
+		return c - '0';
+	}
+	if (c >= 'a' && c <= 'f')
+	{
+		return c - 'a' + 10;
+	}
+	return c >= 'A' && c <= 'F' ? c - 'A' + 10 : -1;
+}
+
+static inline uint32_t load24(const uint8_t* p)
+{
+	return (uint32_t)p[0] << 16 | (uint32_t)p[1] << 8 | p[2];
+}
+
+size_t base64_encode(const uint8_t* input, size_t length, char* output)
+{
+	char* start = output;
+	size_t i = 0;
+	for (; i + 12 <= length; i += 12)
+	{
+		const uint8_t* p = input + i;
+		m128u32 v = mm_set_epu32(load24(p + 9), load24(p + 6), load24(p + 3), load24(p));
+
+		// Groups of 6 bits in bytes 0 to 3 of each lane, most significant first
+		m128u32 g0;
+		m128u32 g1;
+		m128u32 g2;
+		m128u32 g3;
+		PSRLW(g0, v, 18);
+		PSRLW(g1, v, 4);
+		PSLLW(g2, v, 10);
+		PSLLW(g3, v, 24);
+		g0 = mm_and_epu32(g0, mm_broadcast_epu32(0x3F));
+		g1 = mm_and_epu32(g1, mm_broadcast_epu32(0x3F00));
+		g2 = mm_and_epu32(g2, mm_broadcast_epu32(0x3F0000));
+		g3 = mm_and_epu32(g3, mm_broadcast_epu32(0x3F000000));
+		m128i8 groups = mm_castepi8_epu32(mm_or_epu32(mm_or_epu32(g0, g1), mm_or_epu32(g2, g3)));
+
+		// 'A' + v, then 'a' - 26, '0' - 52, '+' - 62 and '/' - 63 past each range
+		m128i8 chars = mm_add_epi8(groups, mm_broadcast_epi8('A'));
+		chars = add_where(chars, mm_cmpgt_epi8(groups, mm_broadcast_epi8(25)), 'a' - 26 - 'A');
+		chars = add_where(chars, mm_cmpgt_epi8(groups, mm_broadcast_epi8(51)), '0' - 52 - ('a' - 26));
+		chars = add_where(chars, mm_cmpgt_epi8(groups, mm_broadcast_epi8(61)), '+' - 62 - ('0' - 52));
+		chars = add_where(chars, mm_cmpgt_epi8(groups, mm_broadcast_epi8(62)), '/' - 63 - ('+' - 62));
+
+		bytes_t result;
+		result.v = chars;
+		memcpy(output, result.b, 16);
+		output += 16;
+	}
+
+	for (; i < length; i += 3)
+	{
+		size_t rest = length - i;
+		uint32_t v = (uint32_t)input[i] << 16;
+		v |= rest > 1 ? (uint32_t)input[i + 1] << 8 : 0;
+		v |= rest > 2 ? input[i + 2] : 0;
+		output[0] = alphabet[v >> 18];
+		output[1] = alphabet[(v >> 12) & 0x3F];
+		output[2] = rest > 1 ? alphabet[(v >> 6) & 0x3F] : '=';
+		output[3] = rest > 2 ? alphabet[v & 0x3F] : '=';
+		output += 4;
+	}
+	return (size_t)(output - start);
+}
+
+/// @brief Decode groups of 4 characters from 'i' on, the last one may be shorter or padded
+static size_t base64_decode_groups(const char* input, size_t i, size_t length, uint8_t* output, size_t* invalid)
+{
+	uint8_t* start = output;
+	for (; i < length; i += 4)
+	{
+		size_t n = length - i < 4 ? length - i : 4;
+		uint32_t v = 0;
+		size_t chars = 0;
+		for (; chars < n; ++chars)
+		{
+			char c = input[i + chars];
+			if (c == '=')
+			{
+				// Only the last 1 or 2 characters of the last full group
+				if (i + 4 != length || chars < 2 || (chars == 2 && input[i + 3] != '='))
+				{
+					*invalid = i + chars;
+					return (size_t)(output - start);
+				}
+				break;
+			}
+			int value = base64_value(c);
+			if (value < 0)
+			{
+				*invalid = i + chars;
+				return (size_t)(output - start);
+			}
+			v = v << 6 | (uint32_t)value;
+		}
+		// A single character holds less than a byte.
+		if (chars < 2)
+		{
+			*invalid = i;
+			return (size_t)(output - start);
+		}
+
+		v <<= 6 * (4 - chars);
+		for (size_t k = 0; k + 1 < chars; ++k)
+		{
+			*output++ = (uint8_t)(v >> (16 - 8 * k));
+		}
+	}
+	*invalid = length;
+	return (size_t)(output - start);
+}
+
+size_t base64_decode(const char* input, size_t length, uint8_t* output, size_t* invalid)
+{
+	uint8_t* start = output;
+	size_t i = 0;
+
+	// The last group can be padded, it is left to the scalar decoder.
+	for (; i + 20 <= length; i += 16)
+	{
+		bytes_t chars;
+		memcpy(chars.b, input + i, 16);
+		m128i8 c = chars.v;
+		m128i8 upper = in_range(c, 'A', 'Z');
+		m128i8 lower = in_range(c, 'a', 'z');
+		m128i8 digit = in_range(c, '0', '9');
+		m128i8 plus = equal_to(c, '+');
+		m128i8 slash = equal_to(c, '/');
+
+		bytes_t valid;
+		valid.v = mm_or_epi8(mm_or_epi8(mm_or_epi8(upper, lower), mm_or_epi8(digit, plus)), slash);
+		if (!all_set(&valid))
+		{
+			break;
+		}
+
+		c = add_where(c, upper, -'A');
+		c = add_where(c, lower, 26 - 'a');
+		c = add_where(c, digit, 52 - '0');
+		c = add_where(c, plus, 62 - '+');
+		c = add_where(c, slash, 63 - '/');
+
+		// Byte 0 of each lane holds the most significant group.
+		m128u32 w = mm_castepu32_epi8(c);
+		m128u32 g0;
+		m128u32 g1;
+		m128u32 g2;
+		m128u32 g3;
+		PSLLW(g0, w, 18);
+		PSLLW(g1, w, 4);
+		PSRLW(g2, w, 10);
+		PSRLW(g3, w, 24);
+		g0 = mm_and_epu32(g0, mm_broadcast_epu32(0x3F << 18));
+		g1 = mm_and_epu32(g1, mm_broadcast_epu32(0x3F << 12));
+		g2 = mm_and_epu32(g2, mm_broadcast_epu32(0x3F << 6));
+
+		bytes_t values;
+		values.v = mm_castepi8_epu32(mm_or_epu32(mm_or_epu32(g0, g1), mm_or_epu32(g2, g3)));
+		for (int l = 0; l < 4; ++l)
+		{
+			output[0] = (uint8_t)(values.w[l] >> 16);
+			output[1] = (uint8_t)(values.w[l] >> 8);
+			output[2] = (uint8_t)values.w[l];
+			output += 3;
+		}
+	}
+
+	output += base64_decode_groups(input, i, length, output, invalid);
+	return (size_t)(output - start);
+}
+
+size_t hex_encode(const uint8_t* input, size_t length, char* output)
+{
+	size_t i = 0;
+	for (; i + 16 <= length; i += 16)
+	{
+		bytes_t bytes;
+		memcpy(bytes.b, input + i, 16);
+		m128u32 v = mm_castepu32_epi8(bytes.v);
+		m128u32 high;
+		PSRLW(high, v, 4);
+		m128u32 nibble_mask = mm_broadcast_epu32(0x0F0F0F0F);
+		m128u8 high_nibbles = mm_castepu8_epu32(mm_and_epu32(high, nibble_mask));
+		m128u8 low_nibbles = mm_castepu8_epu32(mm_and_epu32(v, nibble_mask));
+
+		// The high nibble of every byte comes first.
+		m128i8 nibbles[2] = {
+			mm_castepi8_epu8(mm_extlo_epu8(high_nibbles, low_nibbles)),
+			mm_castepi8_epu8(mm_exthi_epu8(high_nibbles, low_nibbles)),
+		};
+		for (int h = 0; h < 2; ++h)
+		{
+			m128i8 chars = mm_add_epi8(nibbles[h], mm_broadcast_epi8('0'));
+			bytes_t result;
+			result.v = add_where(chars, mm_cmpgt_epi8(nibbles[h], mm_broadcast_epi8(9)), 'a' - '0' - 10);
+			memcpy(output + 2 * i + 16 * h, result.b, 16);
+		}
+	}
+
+	for (; i < length; ++i)
+	{
+		output[2 * i] = "0123456789abcdef"[input[i] >> 4];
+		output[2 * i + 1] = "0123456789abcdef"[input[i] & 0xF];
+	}
+	return 2 * length;
+}
+
+size_t hex_decode(const char* input, size_t length, uint8_t* output, size_t* invalid)
+{
+	size_t i = 0;
+	for (; i + 32 <= length; i += 32)
+	{
+		m128u16 halves[2];
+		int ok = 1;
+		for (int h = 0; h < 2 && ok; ++h)
+		{
+			bytes_t chars;
+			memcpy(chars.b, input + i + 16 * h, 16);
+			m128i8 c = chars.v;
+			m128i8 digit = in_range(c, '0', '9');
+			m128i8 lower = in_range(c, 'a', 'f');
+			m128i8 upper = in_range(c, 'A', 'F');
+
+			bytes_t valid;
+			valid.v = mm_or_epi8(mm_or_epi8(digit, lower), upper);
+			ok = all_set(&valid);
+
+			c = add_where(c, digit, -'0');
+			c = add_where(c, lower, 10 - 'a');
+			c = add_where(c, upper, 10 - 'A');
+
+			// Halfword 'high | low << 8' becomes 'high << 4 | low'
+			m128u16 pairs = mm_castepu16_epi8(c);
+			m128u16 high;
+			m128u16 low;
+			PSLLH(high, pairs, 4);
+			PSRLH(low, pairs, 8);
+			halves[h] = mm_or_epu16(mm_and_epu16(high, mm_broadcast_epu16(0xF0)), low);
+		}
+		if (!ok)
+		{
+			break;
+		}
+
+		// PPACB keeps the low byte of each halfword.
+		bytes_t bytes;
+		bytes.v = mm_castepi8_epu8(mm_pack_epu8(mm_castepu8_epu16(halves[0]), mm_castepu8_epu16(halves[1])));
+		memcpy(output + i / 2, bytes.b, 16);
+	}
+
+	for (; i + 2 <= length; i += 2)
+	{
+		int high = hex_value(input[i]);
+		int low = hex_value(input[i + 1]);
+		if (high < 0 || low < 0)
+		{
+			*invalid = high < 0 ? i : i + 1;
+			return i / 2;
+		}
+		output[i / 2] = (uint8_t)(high << 4 | low);
+	}
+	*invalid = i < length ? i : length;
+	return i / 2;
+}
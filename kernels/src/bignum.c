@@ -0,0 +1,232 @@
+/*
+*	Multi-precision integers, see 'bignum.h'.
+*
+*	A word step '(carry, word) = t + a * b + carry' is one MULTU and two MADDU by 1 on the same
+*	pipeline, leaving the word in LO and the carry in HI. Two chains are interleaved on the two
+*	pipelines, with the second one a column behind: the rows of 'a[i]' and 'a[i + 1]' in a
+*	product, the rows of 'a[i]' and of the reduction multiple 'm' in a Montgomery product.
+*/
+
+#include <ps2kernels/bignum.h>
+
+#include <ps2intrin.h>
+
+#include <string.h>
+
+/// @brief '(carry, word) = t + a * b + carry' on pipeline 0
+static inline uint32_t step0(lohi_state_t* state, uint32_t t, uint32_t a, uint32_t b, uint32_t* carry)
+{
+	mulhi0_u32_start(state, a, b);
+	fma0_u32(state, t, 1);
+	mul_u32_result_t sum = fma0_u32_finish(state, *carry, 1);
+	*carry = sum.hi;
+	return sum.lo;
+}
+
+/// @brief '(carry, word) = t + a * b + carry' on pipeline 1
+static inline uint32_t step1(lohi_state_t* state, uint32_t t, uint32_t a, uint32_t b, uint32_t* carry)
+{
+	mulhi1_u32_start(state, a, b);
+	fma1_u32(state, t, 1);
+	mul_u32_result_t sum = fma1_u32_finish(state, *carry, 1);
+	*carry = sum.hi;
+	return sum.lo;
+}
+
+uint32_t bignum_add(uint32_t* result, const uint32_t* a, const uint32_t* b, size_t words)
+{
+	uint64_t carry = 0;
+	for (size_t i = 0; i < words; ++i)
+	{
+		carry += (uint64_t)a[i] + b[i];
+		result[i] = (uint32_t)carry;
+		carry >>= 32;
+	}
+	return (uint32_t)carry;
+}
+
+uint32_t bignum_sub(uint32_t* result, const uint32_t* a, const uint32_t* b, size_t words)
+{
+	uint32_t borrow = 0;
+	for (size_t i = 0; i < words; ++i)
+	{
+		uint64_t difference = (uint64_t)a[i] - b[i] - borrow;
+		result[i] = (uint32_t)difference;
+		borrow = (uint32_t)(difference >> 63);
+	}
+	return borrow;
+}
+
+int bignum_compare(const uint32_t* a, const uint32_t* b, size_t words)
+{
+	for (size_t i = words; i-- > 0;)
+	{
+		if (a[i] != b[i])
+		{
+			return a[i] < b[i] ? -1 : 1;
+		}
+	}
+	return 0;
+}
+
+void bignum_mul(uint32_t* result, const uint32_t* a, const uint32_t* b, size_t words)
+{
+	lohi_state_t state;
+	lohi_state_construct(&state);
+
+	memset(result, 0, 2 * words * sizeof(uint32_t));
+	size_t i = 0;
+	for (; i + 2 <= words; i += 2)
+	{
+		// Column 'j' gets 'a[i] * b[j]' on pipeline 0, then 'a[i + 1] * b[j - 1]' on pipeline 1.
+		// Columns 'words' and 'words + 1' are still 0 from the rows before.
+		uint32_t* t = result + i;
+		uint32_t carry0 = 0;
+		uint32_t carry1 = 0;
+		t[0] = step0(&state, t[0], a[i], b[0], &carry0);
+		for (size_t j = 1; j < words; ++j)
+		{
+			uint32_t w = step0(&state, t[j], a[i], b[j], &carry0);
+			t[j] = step1(&state, w, a[i + 1], b[j - 1], &carry1);
+		}
+		t[words] = step1(&state, carry0, a[i + 1], b[words - 1], &carry1);
+		t[words + 1] = carry1;
+	}
+	if (i < words)
+	{
+		uint32_t* t = result + i;
+		uint32_t carry = 0;
+		for (size_t j = 0; j < words; ++j)
+		{
+			t[j] = step0(&state, t[j], a[i], b[j], &carry);
+		}
+		t[words] = carry;
+	}
+
+	lohi_state_destruct(&state);
+}
+
+void bignum_from_bytes(uint32_t* result, size_t words, const uint8_t* bytes, size_t length)
+{
+	memset(result, 0, words * sizeof(uint32_t));
+	for (size_t k = 0; k < length && k < words * 4; ++k)
+	{
+		result[k / 4] |= (uint32_t)bytes[length - 1 - k] << (k % 4 * 8);
+	}
+}
+
+void bignum_to_bytes(uint8_t* bytes, size_t length, const uint32_t* a, size_t words)
+{
+	for (size_t k = 0; k < length; ++k)
+	{
+		bytes[length - 1 - k] = k < words * 4 ? (uint8_t)(a[k / 4] >> (k % 4 * 8)) : 0;
+	}
+}
+
+bool bignum_montgomery_init(bignum_montgomery_t* context, const uint32_t* modulus, size_t words)
+{
+	if (words == 0 || words > BIGNUM_MAX_WORDS || (modulus[0] & 1) == 0 || modulus[words - 1] == 0)
+	{
+		return false;
+	}
+	memcpy(context->modulus, modulus, words * sizeof(uint32_t));
+	context->words = words;
+
+	// Each Newton iteration doubles the correct low bits, starting from 3.
+	uint32_t x = modulus[0];
+	for (int k = 0; k < 4; ++k)
+	{
+		x *= 2 - modulus[0] * x;
+	}
+	context->inverse = -x;
+
+	// R^2 mod n by doubling 1 modulo n
+	uint32_t* r = context->r_squared;
+	memset(r, 0, words * sizeof(uint32_t));
+	r[0] = 1;
+	for (size_t k = 0; k < 64 * words; ++k)
+	{
+		uint32_t carry = bignum_add(r, r, r, words);
+		if (carry || bignum_compare(r, modulus, words) >= 0)
+		{
+			bignum_sub(r, r, modulus, words);
+		}
+	}
+	return true;
+}
+
+void bignum_montgomery_mul(const bignum_montgomery_t* context, uint32_t* result, const uint32_t* a,
+						   const uint32_t* b)
+{
+	lohi_state_t state;
+	lohi_state_construct(&state);
+
+	size_t n = context->words;
+	const uint32_t* modulus = context->modulus;
+
+	// Words are written back one position down, 'buffer[0]' takes the word that 'm' clears, so
+	// the shift by one word needs no branch.
+	uint32_t buffer[BIGNUM_MAX_WORDS + 2] = {};
+	uint32_t* t = buffer + 1;
+	for (size_t i = 0; i < n; ++i)
+	{
+		uint32_t m = (t[0] + a[i] * b[0]) * context->inverse;
+		uint32_t carry0 = 0;
+		uint32_t carry1 = 0;
+
+		// 't = (t + a[i] * b + m * n) / 2^32', pipeline 1 adding 'm * n' a column behind
+		uint32_t w = step0(&state, t[0], a[i], b[0], &carry0);
+		for (size_t j = 0; j + 1 < n; ++j)
+		{
+			uint32_t next = step0(&state, t[j + 1], a[i], b[j + 1], &carry0);
+			buffer[j] = step1(&state, w, m, modulus[j], &carry1);
+			w = next;
+		}
+		buffer[n - 1] = step1(&state, w, m, modulus[n - 1], &carry1);
+
+		uint64_t top = (uint64_t)t[n] + carry0 + carry1;
+		t[n - 1] = (uint32_t)top;
+		t[n] = (uint32_t)(top >> 32);
+	}
+
+	// 't < 2n', one subtraction brings it below 'n'.
+	if (t[n] != 0 || bignum_compare(t, modulus, n) >= 0)
+	{
+		bignum_sub(t, t, modulus, n);
+	}
+	memcpy(result, t, n * sizeof(uint32_t));
+
+	lohi_state_destruct(&state);
+}
+
+void bignum_mod_exp(const bignum_montgomery_t* context, uint32_t* result, const uint32_t* base,
+					const uint32_t* exponent, size_t exponent_words)
+{
+	uint32_t one[BIGNUM_MAX_WORDS] = { 1 };
+	uint32_t x[BIGNUM_MAX_WORDS];
+	uint32_t power[BIGNUM_MAX_WORDS];
+
+	// Into the Montgomery domain: 'x = base * R', 'power = R'
+	bignum_montgomery_mul(context, x, base, context->r_squared);
+	bignum_montgomery_mul(context, power, one, context->r_squared);
+
+	// Left to right, squaring from the top set bit
+	bool started = false;
+	for (size_t i = exponent_words; i-- > 0;)
+	{
+		for (int bit = 31; bit >= 0; --bit)
+		{
+			if (started)
+			{
+				bignum_montgomery_mul(context, power, power, power);
+			}
+			if ((exponent[i] >> bit) & 1)
+			{
+				bignum_montgomery_mul(context, power, power, x);
+				started = true;
+			}
+		}
+	}
+
+	bignum_montgomery_mul(context, result, power, one);
+}
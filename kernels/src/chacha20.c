@@ -0,0 +1,183 @@
+/*
+*	ChaCha20, see 'chacha20.h'.
+*
+*	Lane 'k' of every state vector belongs to block 'counter + k', so a quarter round is the same
+*	4 PADDW/PXOR/shift sequences as the scalar one. Rotations are PSLLW, PSRLW and POR. The final
+*	4x4 word transposes use PEXTLW/PEXTUW and PCPYLD/PCPYUD.
+*/
+
+#include <ps2kernels/chacha20.h>
+
+#include <ps2intrin.h>
+
+#include <string.h>
+
+#define ROUNDS 20
+
+static inline uint32_t load32(const uint8_t* p)
+{
+	return (uint32_t)p[0] | (uint32_t)p[1] << 8 | (uint32_t)p[2] << 16 | (uint32_t)p[3] << 24;
+}
+
+static inline m128u32 rotate16(m128u32 v)
+{
+	m128u32 left;
+	m128u32 right;
+	PSLLW(left, v, 16);
+	PSRLW(right, v, 16);
+	return mm_or_epu32(left, right);
+}
+
+static inline m128u32 rotate12(m128u32 v)
+{
+	m128u32 left;
+	m128u32 right;
+	PSLLW(left, v, 12);
+	PSRLW(right, v, 20);
+	return mm_or_epu32(left, right);
+}
+
+static inline m128u32 rotate8(m128u32 v)
+{
+	m128u32 left;
+	m128u32 right;
+	PSLLW(left, v, 8);
+	PSRLW(right, v, 24);
+	return mm_or_epu32(left, right);
+}
+
+static inline m128u32 rotate7(m128u32 v)
+{
+	m128u32 left;
+	m128u32 right;
+	PSLLW(left, v, 7);
+	PSRLW(right, v, 25);
+	return mm_or_epu32(left, right);
+}
+
+static inline void quarter_round(m128u32 x[16], int a, int b, int c, int d)
+{
+	x[a] = mm_add_epu32(x[a], x[b]);
+	x[d] = rotate16(mm_xor_epu32(x[d], x[a]));
+	x[c] = mm_add_epu32(x[c], x[d]);
+	x[b] = rotate12(mm_xor_epu32(x[b], x[c]));
+	x[a] = mm_add_epu32(x[a], x[b]);
+	x[d] = rotate8(mm_xor_epu32(x[d], x[a]));
+	x[c] = mm_add_epu32(x[c], x[d]);
+	x[b] = rotate7(mm_xor_epu32(x[b], x[c]));
+}
+
+/// @brief Keystream of 4 blocks, 'blocks[4 * b + q]' being quadword 'q' of block 'b'
+static void keystream4(const uint32_t input[16], m128u32 blocks[16])
+{
+	m128u32 start[16];
+	m128u32 x[16];
+	for (int k = 0; k < 16; ++k)
+	{
+		start[k] = mm_broadcast_epu32(input[k]);
+	}
+	start[12] = mm_add_epu32(start[12], mm_set_epu32(3, 2, 1, 0));
+	memcpy(x, start, sizeof(x));
+
+	for (int round = 0; round < ROUNDS; round += 2)
+	{
+		quarter_round(x, 0, 4, 8, 12);
+		quarter_round(x, 1, 5, 9, 13);
+		quarter_round(x, 2, 6, 10, 14);
+		quarter_round(x, 3, 7, 11, 15);
+		quarter_round(x, 0, 5, 10, 15);
+		quarter_round(x, 1, 6, 11, 12);
+		quarter_round(x, 2, 7, 8, 13);
+		quarter_round(x, 3, 4, 9, 14);
+	}
+
+	for (int q = 0; q < 4; ++q)
+	{
+		m128u32 w0 = mm_add_epu32(x[4 * q], start[4 * q]);
+		m128u32 w1 = mm_add_epu32(x[4 * q + 1], start[4 * q + 1]);
+		m128u32 w2 = mm_add_epu32(x[4 * q + 2], start[4 * q + 2]);
+		m128u32 w3 = mm_add_epu32(x[4 * q + 3], start[4 * q + 3]);
+
+		// 'w0 w1' of blocks 0, 1 and 2, 3, then 'w2 w3' of the same blocks
+		m128u64 lower01 = mm_castepu64_epu32(mm_extlo_epu32(w0, w1));
+		m128u64 lower23 = mm_castepu64_epu32(mm_exthi_epu32(w0, w1));
+		m128u64 upper01 = mm_castepu64_epu32(mm_extlo_epu32(w2, w3));
+		m128u64 upper23 = mm_castepu64_epu32(mm_exthi_epu32(w2, w3));
+		blocks[q] = mm_castepu32_epu64(mm_unpacklo_epu64(lower01, upper01));
+		blocks[4 + q] = mm_castepu32_epu64(mm_unpackhi_epu64(lower01, upper01));
+		blocks[8 + q] = mm_castepu32_epu64(mm_unpacklo_epu64(lower23, upper23));
+		blocks[12 + q] = mm_castepu32_epu64(mm_unpackhi_epu64(lower23, upper23));
+	}
+}
+
+void chacha20_init(chacha20_t* context, const uint8_t key[CHACHA20_KEY_SIZE],
+				   const uint8_t nonce[CHACHA20_NONCE_SIZE], uint32_t counter)
+{
+	// "expand 32-byte k"
+	context->input[0] = 0x61707865;
+	context->input[1] = 0x3320646E;
+	context->input[2] = 0x79622D32;
+	context->input[3] = 0x6B206574;
+	for (int k = 0; k < 8; ++k)
+	{
+		context->input[4 + k] = load32(key + 4 * k);
+	}
+	context->input[12] = counter;
+	for (int k = 0; k < 3; ++k)
+	{
+		context->input[13 + k] = load32(nonce + 4 * k);
+	}
+	context->used = sizeof(context->keystream);
+}
+
+void chacha20_xor(chacha20_t* context, uint8_t* output, const uint8_t* input, size_t length)
+{
+	size_t stream_size = sizeof(context->keystream);
+	uint8_t* keystream = (uint8_t*)context->keystream;
+	m128u32* keystream_quadwords = (m128u32*)context->keystream;
+
+	// Rest of the last keystream
+	while (length > 0 && context->used < stream_size)
+	{
+		*output++ = *input++ ^ keystream[context->used++];
+		--length;
+	}
+
+	if ((((uintptr_t)output | (uintptr_t)input) & 15) == 0)
+	{
+		for (; length >= stream_size; length -= stream_size)
+		{
+			m128u32 blocks[16];
+			keystream4(context->input, blocks);
+			context->input[12] += 4;
+			for (int q = 0; q < 16; ++q)
+			{
+				m128u32 data = mm_load_epu32((const m128u32*)input + q);
+				mm_store_epu32((m128u32*)output + q, mm_xor_epu32(data, blocks[q]));
+			}
+			input += stream_size;
+			output += stream_size;
+		}
+	}
+
+	while (length > 0)
+	{
+		m128u32 blocks[16];
+		keystream4(context->input, blocks);
+		context->input[12] += 4;
+		for (int q = 0; q < 16; ++q)
+		{
+			mm_store_epu32(keystream_quadwords + q, blocks[q]);
+		}
+
+		size_t count = length < stream_size ? length : stream_size;
+		for (size_t i = 0; i < count; ++i)
+		{
+			output[i] = input[i] ^ keystream[i];
+		}
+		context->used = count;
+		input += count;
+		output += count;
+		length -= count;
+	}
+}
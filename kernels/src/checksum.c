@@ -0,0 +1,113 @@
+/*
+*	Internet checksum, see 'checksum.h'.
+*
+*	The ones' complement sum does not depend on byte order, so quadwords are summed as little-
+*	endian halfwords and the folded result is byte swapped once (RFC 1071, 2.B). PEXTLH and PEXTUH
+*	with zero widen the halfwords to 32-bit lanes. A lane takes one word per quadword, so it
+*	cannot overflow within 'BLOCK_QUADWORDS' quadwords.
+*/
+
+#include <ps2kernels/checksum.h>
+
+#include <ps2intrin.h>
+
+#include <stdbool.h>
+#include <string.h>
+
+#define BLOCK_QUADWORDS 0xFFFF
+
+typedef union
+{
+	m128u32 v;
+	uint32_t w[4];
+} lanes_t;
+
+static inline uint32_t fold(uint64_t sum)
+{
+	while (sum > 0xFFFF)
+	{
+		sum = (sum & 0xFFFF) + (sum >> 16);
+	}
+	return (uint32_t)sum;
+}
+
+static inline uint32_t swap_bytes(uint32_t word)
+{
+	return (word & 0xFF) << 8 | word >> 8;
+}
+
+static inline uint64_t lane_total(m128u32 sum)
+{
+	lanes_t lanes = { .v = sum };
+	return (uint64_t)lanes.w[0] + lanes.w[1] + lanes.w[2] + lanes.w[3];
+}
+
+/// @brief Sum of 'count' quadwords as little-endian halfwords
+static uint64_t sum_quadwords(const uint8_t* data, size_t count)
+{
+	bool aligned = ((uintptr_t)data & 15) == 0;
+	m128u16 zero = mm_setzero_epu16();
+	uint64_t total = 0;
+	while (count > 0)
+	{
+		size_t block = count < BLOCK_QUADWORDS ? count : BLOCK_QUADWORDS;
+		m128u32 lower = mm_setzero_epu32();
+		m128u32 upper = mm_setzero_epu32();
+		for (size_t q = 0; q < block; ++q)
+		{
+			m128u16 words;
+			if (aligned)
+			{
+				words = mm_load_epu16((const m128u16*)data + q);
+			}
+			else
+			{
+				memcpy(&words, data + 16 * q, 16);
+			}
+			lower = mm_add_epu32(lower, mm_castepu32_epu16(mm_extlo_epu16(words, zero)));
+			upper = mm_add_epu32(upper, mm_castepu32_epu16(mm_exthi_epu16(words, zero)));
+		}
+		total += lane_total(lower) + lane_total(upper);
+		data += 16 * block;
+		count -= block;
+	}
+	return total;
+}
+
+uint32_t inet_checksum_add(uint32_t sum, const uint8_t* data, size_t length)
+{
+	size_t count = length / 16;
+	uint64_t total = sum + (uint64_t)swap_bytes(fold(sum_quadwords(data, count)));
+	for (size_t i = 16 * count; i + 2 <= length; i += 2)
+	{
+		total += (uint32_t)data[i] << 8 | data[i + 1];
+	}
+	if (length & 1)
+	{
+		total += (uint32_t)data[length - 1] << 8;
+	}
+	return fold(total);
+}
+
+uint32_t inet_checksum_pseudo_header(uint32_t source, uint32_t destination, uint8_t protocol, uint16_t length)
+{
+	uint64_t total = (uint64_t)(source >> 16) + (source & 0xFFFF) + (destination >> 16) + (destination & 0xFFFF);
+	return fold(total + protocol + length);
+}
+
+uint16_t inet_checksum_finish(uint32_t sum)
+{
+	return (uint16_t)~fold(sum);
+}
+
+uint16_t inet_checksum(const uint8_t* data, size_t length)
+{
+	return inet_checksum_finish(inet_checksum_add(0, data, length));
+}
+
+uint16_t inet_checksum_update(uint16_t checksum, uint16_t old_word, uint16_t new_word)
+{
+	// HC' = ~(~HC + ~m + m')
+	uint32_t sum = (uint32_t)(uint16_t)~checksum + (uint16_t)~old_word + new_word;
+	return (uint16_t)~fold(sum);
+}
@@ -0,0 +1,228 @@
+/*
+*	Broadphase collision tests, see 'collision.h'.
+*/
+
+#include <ps2kernels/collision.h>
+
+#include "hits.h"
+
+#include <ps2intrin.h>
+
+#include <string.h>
+
+/// @brief Boxes 'i' to 'i + 3' separated from 'box' on any axis, one bit per box
+static inline unsigned separated4(const m128i32 box_min[3], const m128i32 box_max[3], const aabb32_streams_t* boxes,
+								  size_t i)
+{
+	m128i32 separated = mm_setzero_epi32();
+	for (size_t axis = 0; axis < 3; ++axis)
+	{
+		m128i32 min = mm_load_epi32((const m128i32*)(boxes->min[axis] + i));
+		m128i32 max = mm_load_epi32((const m128i32*)(boxes->max[axis] + i));
+		separated = mm_or_epi32(separated, mm_cmpgt_epi32(box_min[axis], max));
+		separated = mm_or_epi32(separated, mm_cmpgt_epi32(min, box_max[axis]));
+	}
+	return mask4(separated);
+}
+
+size_t aabb32_overlap(const aabb32_t* box, const aabb32_streams_t* boxes, size_t count, uint32_t* hits)
+{
+	m128i32 box_min[3];
+	m128i32 box_max[3];
+	for (size_t axis = 0; axis < 3; ++axis)
+	{
+		box_min[axis] = mm_broadcast_epi32(box->min[axis]);
+		box_max[axis] = mm_broadcast_epi32(box->max[axis]);
+	}
+
+	bit_writer_t writer = { hits, 0, 0 };
+	for (size_t i = 0; i < count; i += 4)
+	{
+		bit_writer_put(&writer, i, ~separated4(box_min, box_max, boxes, i), count, 4);
+	}
+	return writer.total;
+}
+
+size_t aabb16_overlap(const aabb16_t* box, const aabb16_streams_t* boxes, size_t count, uint32_t* hits)
+{
+	m128i16 box_min[3];
+	m128i16 box_max[3];
+	for (size_t axis = 0; axis < 3; ++axis)
+	{
+		box_min[axis] = mm_broadcast_epi16(box->min[axis]);
+		box_max[axis] = mm_broadcast_epi16(box->max[axis]);
+	}
+
+	bit_writer_t writer = { hits, 0, 0 };
+	for (size_t i = 0; i < count; i += 8)
+	{
+		m128i16 separated = mm_setzero_epi16();
+		for (size_t axis = 0; axis < 3; ++axis)
+		{
+			m128i16 min = mm_load_epi16((const m128i16*)(boxes->min[axis] + i));
+			m128i16 max = mm_load_epi16((const m128i16*)(boxes->max[axis] + i));
+			separated = mm_or_epi16(separated, mm_cmpgt_epi16(box_min[axis], max));
+			separated = mm_or_epi16(separated, mm_cmpgt_epi16(min, box_max[axis]));
+		}
+		bit_writer_put(&writer, i, ~mask8(separated), count, 8);
+	}
+	return writer.total;
+}
+
+size_t sphere16_overlap(const sphere16_t* sphere, const sphere16_streams_t* spheres, size_t count, uint32_t* hits)
+{
+	m128i16 x = mm_broadcast_epi16(sphere->x);
+	m128i16 y = mm_broadcast_epi16(sphere->y);
+	m128i16 z = mm_broadcast_epi16(sphere->z);
+	m128i16 radius = mm_broadcast_epi16(sphere->radius);
+	m128i32 sign = mm_broadcast_epi32(INT32_MIN);
+
+	lohi_state_t state;
+	lohi_state_construct(&state);
+
+	bit_writer_t writer = { hits, 0, 0 };
+	for (size_t i = 0; i < count; i += 8)
+	{
+		m128i16 dx = mm_sub_epi16(mm_load_epi16((const m128i16*)(spheres->x + i)), x);
+		m128i16 dy = mm_sub_epi16(mm_load_epi16((const m128i16*)(spheres->y + i)), y);
+		m128i16 dz = mm_sub_epi16(mm_load_epi16((const m128i16*)(spheres->z + i)), z);
+		m128i16 reach = mm_add_epi16(mm_load_epi16((const m128i16*)(spheres->radius + i)), radius);
+
+		// PMULTH/PMADDH leave the even lanes in the result and the odd lanes in LO/HI.
+		mm_mul_epi16(&state, dx, dx);
+		mm_fma_epi16(&state, dy, dy);
+		m128i32 distance_even = mm_fma_epi16(&state, dz, dz);
+		m128i32 distance_odd = mm_loadlohi_upper_epi32(&state);
+		m128i32 reach_even = mm_mul_epi16(&state, reach, reach);
+		m128i32 reach_odd = mm_loadlohi_upper_epi32(&state);
+
+		// The sum of three squares reaches 3 * 32767^2, past INT32_MAX but within 32 bits: compare
+		// it unsigned by flipping the sign bits.
+		m128i32 even = mm_cmpgt_epi32(mm_xor_epi32(distance_even, sign), mm_xor_epi32(reach_even, sign));
+		m128i32 odd = mm_cmpgt_epi32(mm_xor_epi32(distance_odd, sign), mm_xor_epi32(reach_odd, sign));
+		m128i16 separated = mm_pack_epi16(mm_castepi16_epi32(mm_extlo_epi32(even, odd)),
+										  mm_castepi16_epi32(mm_exthi_epi32(even, odd)));
+		bit_writer_put(&writer, i, ~mask8(separated), count, 8);
+	}
+
+	lohi_state_destruct(&state);
+	return writer.total;
+}
+
+/// @brief Round up to a multiple of 4 boxes, plus 4 boxes read past the end by the sweep
+static inline size_t padded(size_t count)
+{
+	return ((count + 3) & ~(size_t)3) + 4;
+}
+
+size_t aabb32_sweep_and_prune_work_size(size_t count)
+{
+	// 6 sorted streams, then keys and indices twice for the radix sort
+	return (6 * padded(count) + 4 * count) * sizeof(int32_t);
+}
+
+/// @brief Sort 'indices' by 'keys' with an LSD radix sort, 8 bits per pass
+static void radix_sort(uint32_t* keys, uint32_t* indices, uint32_t* keys_tmp, uint32_t* indices_tmp, size_t count)
+{
+	for (unsigned shift = 0; shift < 32; shift += 8)
+	{
+		size_t offsets[256] = {};
+		for (size_t i = 0; i < count; ++i)
+		{
+			++offsets[(keys[i] >> shift) & 0xFF];
+		}
+		size_t sum = 0;
+		for (size_t b = 0; b < 256; ++b)
+		{
+			size_t n = offsets[b];
+			offsets[b] = sum;
+			sum += n;
+		}
+		for (size_t i = 0; i < count; ++i)
+		{
+			size_t to = offsets[(keys[i] >> shift) & 0xFF]++;
+			keys_tmp[to] = keys[i];
+			indices_tmp[to] = indices[i];
+		}
+
+		uint32_t* swap = keys;
+		keys = keys_tmp;
+		keys_tmp = swap;
+		swap = indices;
+		indices = indices_tmp;
+		indices_tmp = swap;
+	}
+	// An even number of passes leaves the result in the original arrays.
+}
+
+size_t aabb32_sweep_and_prune(const aabb32_streams_t* boxes, size_t count, void* work, collision_pair_t* pairs,
+							  size_t max_pairs)
+{
+	size_t stride = padded(count);
+	int32_t* sorted = (int32_t*)work;
+	uint32_t* keys = (uint32_t*)(sorted + 6 * stride);
+	uint32_t* indices = keys + count;
+	uint32_t* keys_tmp = indices + count;
+	uint32_t* indices_tmp = keys_tmp + count;
+
+	for (size_t i = 0; i < count; ++i)
+	{
+		// Flipping the sign bit orders signed values as unsigned.
+		keys[i] = (uint32_t)boxes->min[0][i] ^ 0x80000000u;
+		indices[i] = (uint32_t)i;
+	}
+	radix_sort(keys, indices, keys_tmp, indices_tmp, count);
+
+	aabb32_streams_t view;
+	for (size_t axis = 0; axis < 3; ++axis)
+	{
+		int32_t* min = sorted + axis * stride;
+		int32_t* max = sorted + (axis + 3) * stride;
+		for (size_t i = 0; i < count; ++i)
+		{
+			min[i] = boxes->min[axis][indices[i]];
+			max[i] = boxes->max[axis][indices[i]];
+		}
+		memset(min + count, 0, (stride - count) * sizeof(int32_t));
+		memset(max + count, 0, (stride - count) * sizeof(int32_t));
+		view.min[axis] = min;
+		view.max[axis] = max;
+	}
+
+	size_t found = 0;
+	for (size_t i = 0; i < count; ++i)
+	{
+		m128i32 box_min[3];
+		m128i32 box_max[3];
+		for (size_t axis = 0; axis < 3; ++axis)
+		{
+			box_min[axis] = mm_broadcast_epi32(view.min[axis][i]);
+			box_max[axis] = mm_broadcast_epi32(view.max[axis][i]);
+		}
+
+		// Start at the aligned group containing 'i + 1' and drop the lanes up to 'i'. The x
+		// test in 'separated4' rejects the boxes of the last group starting after 'max_x'.
+		int32_t max_x = view.max[0][i];
+		for (size_t j = (i + 1) & ~(size_t)3; j < count && view.min[0][j] <= max_x; j += 4)
+		{
+			unsigned bits = ~separated4(box_min, box_max, &view, j) & valid_lanes(j, count, 4);
+			if (j <= i)
+			{
+				bits &= ~0u << (i + 1 - j);
+			}
+
+			for (; bits; bits &= bits - 1)
+			{
+				size_t k = j + (size_t)__builtin_ctz(bits);
+				if (found < max_pairs)
+				{
+					pairs[found].a = indices[i];
+					pairs[found].b = indices[k];
+				}
+				++found;
+			}
+		}
+	}
+
+	return found;
+}
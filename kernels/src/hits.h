@@ -0,0 +1,65 @@
+#pragma once
+
+/*
+*	Comparison masks turned into bit sets, shared by the batch tests of 'collision.c',
+*	'raycast.c' and 'occlusion.c'.
+*/
+
+#include <ps2intrin.h>
+
+#include <stddef.h>
+#include <stdint.h>
+
+typedef union
+{
+	m128i8 v;
+	uint32_t w[4];
+	uint64_t q[2];
+} mask_bytes_t;
+
+/// @brief One bit per lane of a 32-bit comparison mask
+static inline unsigned mask4(m128i32 mask)
+{
+	m128i16 halfwords = mm_pack_epi16(mm_castepi16_epi32(mask), mm_castepi16_epi32(mask));
+	mask_bytes_t bytes;
+	bytes.v = mm_pack_epi8(mm_castepi8_epi16(halfwords), mm_castepi8_epi16(halfwords));
+	// The multiplication moves bit 0 of byte 'k' to bit '28 + k' without carries.
+	return ((bytes.w[0] & 0x01010101u) * 0x10204080u) >> 28;
+}
+
+/// @brief One bit per lane of a 16-bit comparison mask
+static inline unsigned mask8(m128i16 mask)
+{
+	mask_bytes_t bytes;
+	bytes.v = mm_pack_epi8(mm_castepi8_epi16(mask), mm_castepi8_epi16(mask));
+	// The multiplication moves bit 0 of byte 'k' to bit '56 + k' without carries.
+	return (unsigned)(((bytes.q[0] & 0x0101010101010101u) * 0x0102040810204080u) >> 56);
+}
+
+/// @brief Lanes 'i' to 'i + lanes - 1' that are within 'count', one bit per lane
+static inline unsigned valid_lanes(size_t i, size_t count, unsigned lanes)
+{
+	return count - i >= lanes ? (1u << lanes) - 1 : (1u << (count - i)) - 1;
+}
+
+/// @brief Collect bit sets of 'lanes' lanes into 32-bit words
+typedef struct
+{
+	uint32_t* hits;
+	uint32_t word;
+	size_t total;
+} bit_writer_t;
+
+/// @brief Add the bits of lanes 'i' to 'i + lanes - 1', the lanes past 'count' dropped, and
+/// store the word once it is complete
+static inline void bit_writer_put(bit_writer_t* writer, size_t i, unsigned bits, size_t count, unsigned lanes)
+{
+	bits &= valid_lanes(i, count, lanes);
+	writer->word |= (uint32_t)bits << (i & 31);
+	writer->total += (size_t)__builtin_popcount(bits);
+	if (((i + lanes) & 31) == 0 || i + lanes >= count)
+	{
+		writer->hits[i / 32] = writer->word;
+		writer->word = 0;
+	}
+}
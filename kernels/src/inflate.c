@@ -0,0 +1,636 @@
+/*
+*	Inflate, see 'inflate.h'.
+*
+*	Codes up to 'INFLATE_FAST_BITS' bits are found with one table lookup. Longer codes are
+*	bit-reversed and compared against the end of each length. PLZCW counts their leading ones,
+*	which gives the shortest length to start the search at. Each literal, match or header is
+*	read as a whole or not at all, so running out of input only leaves a partial byte behind.
+*
+*	A match a quadword or more behind is copied with LQ/SQ. The output quadwords are aligned,
+*	and the 2 source quadwords around each one are shifted into place with QFSRV.
+*/
+
+#include <ps2kernels/inflate.h>
+
+#include <ps2intrin.h>
+
+#include <string.h>
+
+enum
+{
+	STATE_ZLIB_HEADER,
+	STATE_BLOCK_HEADER,
+	STATE_STORED,
+	STATE_HUFFMAN,
+	STATE_ZLIB_TRAILER,
+	STATE_DONE,
+};
+
+/// Internal result of a step that finished, the next step can start
+#define CONTINUE ((inflate_status_t)(INFLATE_ERROR + 1))
+
+#define ADLER_MODULUS 65521
+/// Number of bytes summed before the Adler-32 sums could overflow
+#define ADLER_BLOCK 5552
+
+typedef union
+{
+	uint128_t q;
+	m128u8 v;
+} quadword_t;
+
+/// @brief Input and the position of the next bit
+typedef struct
+{
+	const uint8_t* data;
+	size_t length;
+	size_t bit;
+	/// Set when 'read_bits' ran out of input
+	bool short_input;
+} reader_t;
+
+static const uint16_t length_base[29] = {
+	3, 4, 5, 6, 7, 8, 9, 10, 11, 13, 15, 17, 19, 23, 27, 31, 35, 43, 51, 59, 67, 83, 99, 115, 131, 163, 195, 227, 258,
+};
+static const uint8_t length_extra[29] = {
+	0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 1, 1, 2, 2, 2, 2, 3, 3, 3, 3, 4, 4, 4, 4, 5, 5, 5, 5, 0,
+};
+static const uint16_t distance_base[30] = {
+	1, 2, 3, 4, 5, 7, 9, 13, 17, 25, 33, 49, 65, 97, 129, 193, 257, 385, 513, 769, 1025, 1537, 2049, 3073, 4097,
+	6145, 8193, 12289, 16385, 24577,
+};
+static const uint8_t distance_extra[30] = {
+	0, 0, 0, 0, 1, 1, 2, 2, 3, 3, 4, 4, 5, 5, 6, 6, 7, 7, 8, 8, 9, 9, 10, 10, 11, 11, 12, 12, 13, 13,
+};
+/// Order of the code length code lengths
+static const uint8_t code_length_order[19] = {
+	16, 17, 18, 0, 8, 7, 9, 6, 10, 5, 11, 4, 12, 3, 13, 2, 14, 1, 15,
+};
+
+static inline size_t available(const reader_t* reader)
+{
+	size_t bits = 8 * reader->length;
+	return bits > reader->bit ? bits - reader->bit : 0;
+}
+
+/// @brief Next 57 bits at least, zeros past the input
+static inline uint64_t peek(const reader_t* reader)
+{
+	size_t byte = reader->bit >> 3;
+	uint64_t bits = 0;
+	if (byte + 8 <= reader->length)
+	{
+		memcpy(&bits, reader->data + byte, 8);
+	}
+	else
+	{
+		for (size_t k = 0; byte + k < reader->length; ++k)
+		{
+			bits |= (uint64_t)reader->data[byte + k] << (8 * k);
+		}
+	}
+	return bits >> (reader->bit & 7);
+}
+
+static inline uint32_t read_bits(reader_t* reader, unsigned count)
+{
+	if (count > available(reader))
+	{
+		reader->short_input = true;
+		return 0;
+	}
+	uint32_t value = (uint32_t)peek(reader) & ((1u << count) - 1);
+	reader->bit += count;
+	return value;
+}
+
+static inline uint32_t reverse16(uint32_t bits)
+{
+	bits = (bits & 0x5555) << 1 | (bits >> 1 & 0x5555);
+	bits = (bits & 0x3333) << 2 | (bits >> 2 & 0x3333);
+	bits = (bits & 0x0F0F) << 4 | (bits >> 4 & 0x0F0F);
+	return (bits & 0x00FF) << 8 | (bits >> 8 & 0x00FF);
+}
+
+/// @brief Build a code from the length of each symbol's code, 0 for unused symbols
+/// @return False if the lengths describe more codes than there are
+static bool build_code(inflate_code_t* code, const uint8_t* lengths, size_t count)
+{
+	uint16_t counts[16] = {};
+	for (size_t s = 0; s < count; ++s)
+	{
+		counts[lengths[s]]++;
+	}
+	counts[0] = 0;
+
+	int left = 1;
+	for (int length = 1; length < 16; ++length)
+	{
+		left = 2 * left - counts[length];
+		if (left < 0)
+		{
+			return false;
+		}
+	}
+
+	uint32_t next_code[16];
+	uint16_t next_index[16];
+	uint32_t first = 0;
+	uint16_t index = 0;
+	code->limit[0] = 0;
+	for (int length = 1; length < 16; ++length)
+	{
+		first = (first + counts[length - 1]) << 1;
+		next_code[length] = first;
+		next_index[length] = index;
+		code->offset[length] = (int32_t)index - (int32_t)first;
+		code->limit[length] = (first + counts[length]) << (16 - length);
+		index += counts[length];
+	}
+
+	memset(code->fast, 0, sizeof(code->fast));
+	for (size_t s = 0; s < count; ++s)
+	{
+		unsigned length = lengths[s];
+		if (length == 0)
+		{
+			continue;
+		}
+		code->symbols[next_index[length]++] = (uint16_t)s;
+
+		uint32_t value = next_code[length]++;
+		if (length <= INFLATE_FAST_BITS)
+		{
+			// The stream holds codes from their most significant bit.
+			uint32_t reversed = reverse16(value) >> (16 - length);
+			for (uint32_t k = reversed; k < (1u << INFLATE_FAST_BITS); k += 1u << length)
+			{
+				code->fast[k] = (uint16_t)(s << 4 | length);
+			}
+		}
+	}
+
+	// Codes grow with their length, the smallest one starting with 'n + 1' ones has the
+	// shortest length among them.
+	for (unsigned n = 0; n < 16; ++n)
+	{
+		uint32_t smallest = (0xFFFFu << (15 - n)) & 0xFFFF;
+		unsigned length = 1;
+		while (length < 15 && smallest >= code->limit[length])
+		{
+			++length;
+		}
+		code->start_length[n] = (uint8_t)length;
+	}
+	return true;
+}
+
+/// @brief Decode the symbol at the start of 'bits'
+/// @param length Receives the length of its code
+/// @return Symbol, -1 if the bits are not a code
+static inline int decode_symbol(const inflate_code_t* code, uint64_t bits, unsigned* length)
+{
+	uint16_t entry = code->fast[bits & ((1u << INFLATE_FAST_BITS) - 1)];
+	if (entry != 0)
+	{
+		*length = entry & 15;
+		return entry >> 4;
+	}
+
+	uint32_t value = reverse16((uint32_t)bits & 0xFFFF);
+	unsigned size = 1;
+	if (value & 0x8000)
+	{
+		// Leading ones minus one, in the low word
+		size = code->start_length[(uint32_t)mm_clb_u64((uint64_t)(value << 16)) & 15];
+	}
+	while (value >= code->limit[size])
+	{
+		if (++size > 15)
+		{
+			return -1;
+		}
+	}
+	*length = size;
+	return code->symbols[code->offset[size] + (int32_t)(value >> (16 - size))];
+}
+
+/// @brief Copy 'length' bytes from 'distance' bytes back
+///
+/// Can write up to 15 bytes more, but not past 'end'.
+static void copy_match(sa_state_t* sa, uint8_t* destination, const uint8_t* end, size_t distance, size_t length)
+{
+	const uint8_t* source = destination - distance;
+	if (distance < 16 || (length <= 16 && destination + 16 > end))
+	{
+		for (size_t i = 0; i < length; ++i)
+		{
+			destination[i] = source[i];
+		}
+		return;
+	}
+	if (length <= 16)
+	{
+		memcpy(destination, source, 16);
+		return;
+	}
+
+	size_t head = (16 - ((uintptr_t)destination & 15)) & 15;
+	memcpy(destination, source, 16);
+	destination += head;
+	source += head;
+	length -= head;
+
+	const m128u8* from = (const m128u8*)((uintptr_t)source & ~(uintptr_t)15);
+	m128u8* to = (m128u8*)destination;
+	set_sa_8(sa, (uintptr_t)source & 15);
+	for (size_t q = 0; 16 * q < length; ++q)
+	{
+		// Both are reloaded, the upper one can hold bytes of the previous output quadword.
+		quadword_t lower = { .v = mm_load_epu8(from + q) };
+		quadword_t upper = { .v = mm_load_epu8(from + q + 1) };
+		quadword_t result;
+		result.q = byte_shift_logical_right(sa, upper.q, lower.q);
+		mm_store_epu8(to + q, result.v);
+	}
+}
+
+static uint32_t adler32(uint32_t adler, const uint8_t* data, size_t length)
+{
+	uint32_t a = adler & 0xFFFF;
+	uint32_t b = adler >> 16;
+	while (length > 0)
+	{
+		size_t count = length < ADLER_BLOCK ? length : ADLER_BLOCK;
+		length -= count;
+		for (size_t i = 0; i < count; ++i)
+		{
+			a += data[i];
+			b += a;
+		}
+		data += count;
+		a %= ADLER_MODULUS;
+		b %= ADLER_MODULUS;
+	}
+	return b << 16 | a;
+}
+
+static void update_adler(inflate_t* context)
+{
+	if (context->zlib)
+	{
+		context->adler = adler32(context->adler, context->window + context->checked, context->position - context->checked);
+		context->checked = context->position;
+	}
+}
+
+static inflate_status_t read_zlib_header(inflate_t* context, reader_t* reader)
+{
+	if (available(reader) < 16)
+	{
+		return INFLATE_NEED_INPUT;
+	}
+	uint32_t method = read_bits(reader, 8);
+	uint32_t flags = read_bits(reader, 8);
+	// Deflate with a window of 32 KiB at most, no preset dictionary
+	if ((method & 15) != 8 || method >> 4 > 7 || (method << 8 | flags) % 31 != 0 || (flags & 0x20))
+	{
+		return INFLATE_ERROR;
+	}
+	context->state = STATE_BLOCK_HEADER;
+	return CONTINUE;
+}
+
+static bool fixed_codes(inflate_t* context)
+{
+	uint8_t lengths[288];
+	memset(lengths, 8, 144);
+	memset(lengths + 144, 9, 112);
+	memset(lengths + 256, 7, 24);
+	memset(lengths + 280, 8, 8);
+	build_code(&context->literals, lengths, 288);
+	memset(lengths, 5, 30);
+	return build_code(&context->distances, lengths, 30);
+}
+
+/// @brief Read the code lengths of a dynamic block, the literal code is used for the code
+/// length code
+static inflate_status_t dynamic_codes(inflate_t* context, reader_t* reader)
+{
+	size_t literals = read_bits(reader, 5) + 257;
+	size_t distances = read_bits(reader, 5) + 1;
+	size_t code_lengths = read_bits(reader, 4) + 4;
+	uint8_t lengths[288 + 32] = {};
+	for (size_t i = 0; i < code_lengths; ++i)
+	{
+		lengths[code_length_order[i]] = (uint8_t)read_bits(reader, 3);
+	}
+	if (reader->short_input)
+	{
+		return INFLATE_NEED_INPUT;
+	}
+	if (literals > 286 || distances > 30 || !build_code(&context->literals, lengths, 19))
+	{
+		return INFLATE_ERROR;
+	}
+
+	memset(lengths, 0, 19);
+	size_t total = literals + distances;
+	for (size_t i = 0; i < total;)
+	{
+		unsigned size;
+		int symbol = decode_symbol(&context->literals, peek(reader), &size);
+		if (symbol < 0 || size > available(reader))
+		{
+			return available(reader) < 7 ? INFLATE_NEED_INPUT : INFLATE_ERROR;
+		}
+		reader->bit += size;
+
+		if (symbol < 16)
+		{
+			lengths[i++] = (uint8_t)symbol;
+			continue;
+		}
+		uint8_t repeated = 0;
+		size_t count;
+		if (symbol == 16)
+		{
+			if (i == 0)
+			{
+				return INFLATE_ERROR;
+			}
+			repeated = lengths[i - 1];
+			count = 3 + read_bits(reader, 2);
+		}
+		else if (symbol == 17)
+		{
+			count = 3 + read_bits(reader, 3);
+		}
+		else
+		{
+			count = 11 + read_bits(reader, 7);
+		}
+		if (reader->short_input)
+		{
+			return INFLATE_NEED_INPUT;
+		}
+		if (i + count > total)
+		{
+			return INFLATE_ERROR;
+		}
+		memset(lengths + i, repeated, count);
+		i += count;
+	}
+
+	if (lengths[256] == 0 || !build_code(&context->literals, lengths, literals) ||
+		!build_code(&context->distances, lengths + literals, distances))
+	{
+		return INFLATE_ERROR;
+	}
+	return CONTINUE;
+}
+
+static inflate_status_t read_block_header(inflate_t* context, reader_t* reader)
+{
+	size_t start = reader->bit;
+	context->last_block = read_bits(reader, 1) != 0;
+	uint32_t type = read_bits(reader, 2);
+	inflate_status_t status = CONTINUE;
+	if (reader->short_input)
+	{
+		status = INFLATE_NEED_INPUT;
+	}
+	else if (type == 0)
+	{
+		reader->bit = (reader->bit + 7) & ~(size_t)7;
+		uint32_t length = read_bits(reader, 16);
+		uint32_t complement = read_bits(reader, 16);
+		if (reader->short_input)
+		{
+			status = INFLATE_NEED_INPUT;
+		}
+		else if ((length ^ complement) != 0xFFFF)
+		{
+			status = INFLATE_ERROR;
+		}
+		context->stored_left = length;
+		context->state = STATE_STORED;
+	}
+	else if (type == 1)
+	{
+		fixed_codes(context);
+		context->state = STATE_HUFFMAN;
+	}
+	else if (type == 2)
+	{
+		status = dynamic_codes(context, reader);
+		context->state = STATE_HUFFMAN;
+	}
+	else
+	{
+		status = INFLATE_ERROR;
+	}
+
+	if (status != CONTINUE)
+	{
+		// Read again once there is more input
+		reader->bit = start;
+		reader->short_input = false;
+		context->state = STATE_BLOCK_HEADER;
+	}
+	return status;
+}
+
+static inflate_status_t copy_stored(inflate_t* context, reader_t* reader)
+{
+	while (context->stored_left > 0)
+	{
+		size_t space = context->window_size - context->position;
+		size_t input = available(reader) / 8;
+		size_t count = context->stored_left;
+		count = count < space ? count : space;
+		count = count < input ? count : input;
+		memcpy(context->window + context->position, reader->data + reader->bit / 8, count);
+		context->position += count;
+		context->stored_left -= count;
+		reader->bit += 8 * count;
+		if (context->stored_left > 0)
+		{
+			return space == count ? INFLATE_WINDOW_FULL : INFLATE_NEED_INPUT;
+		}
+	}
+	context->state = context->last_block ? (context->zlib ? STATE_ZLIB_TRAILER : STATE_DONE) : STATE_BLOCK_HEADER;
+	return CONTINUE;
+}
+
+static inflate_status_t inflate_huffman(inflate_t* context, reader_t* reader, sa_state_t* sa)
+{
+	uint8_t* window = context->window;
+	size_t window_size = context->window_size;
+	size_t position = context->position;
+	inflate_status_t status;
+	for (;;)
+	{
+		if (context->match_left > 0)
+		{
+			size_t space = window_size - position;
+			size_t count = context->match_left < space ? context->match_left : space;
+			copy_match(sa, window + position, window + window_size, context->match_distance, count);
+			position += count;
+			context->match_left -= count;
+			if (context->match_left > 0)
+			{
+				status = INFLATE_WINDOW_FULL;
+				break;
+			}
+		}
+
+		uint64_t bits = peek(reader);
+		size_t bits_left = available(reader);
+		unsigned size;
+		int symbol = decode_symbol(&context->literals, bits, &size);
+		if (symbol < 0 || size > bits_left)
+		{
+			status = bits_left < 15 ? INFLATE_NEED_INPUT : INFLATE_ERROR;
+			break;
+		}
+
+		if (symbol < 256)
+		{
+			if (position == window_size)
+			{
+				status = INFLATE_WINDOW_FULL;
+				break;
+			}
+			window[position++] = (uint8_t)symbol;
+			reader->bit += size;
+			continue;
+		}
+		if (symbol == 256)
+		{
+			reader->bit += size;
+			context->state = context->last_block ? (context->zlib ? STATE_ZLIB_TRAILER : STATE_DONE) : STATE_BLOCK_HEADER;
+			status = CONTINUE;
+			break;
+		}
+
+		symbol -= 257;
+		if (symbol >= 29)
+		{
+			status = INFLATE_ERROR;
+			break;
+		}
+		unsigned used = size + length_extra[symbol];
+		size_t length = length_base[symbol] + ((bits >> size) & ((1u << length_extra[symbol]) - 1));
+
+		unsigned distance_size;
+		int distance_symbol = decode_symbol(&context->distances, bits >> used, &distance_size);
+		if (distance_symbol < 0 || distance_symbol >= 30)
+		{
+			status = bits_left < used + 15 ? INFLATE_NEED_INPUT : INFLATE_ERROR;
+			break;
+		}
+		used += distance_size;
+		size_t distance = distance_base[distance_symbol] + ((bits >> used) & ((1u << distance_extra[distance_symbol]) - 1));
+		used += distance_extra[distance_symbol];
+		if (used > bits_left)
+		{
+			status = INFLATE_NEED_INPUT;
+			break;
+		}
+		if (distance > position)
+		{
+			status = INFLATE_ERROR;
+			break;
+		}
+		reader->bit += used;
+		context->match_left = length;
+		context->match_distance = distance;
+	}
+	context->position = position;
+	return status;
+}
+
+static inflate_status_t check_zlib_trailer(inflate_t* context, reader_t* reader)
+{
+	reader->bit = (reader->bit + 7) & ~(size_t)7;
+	if (available(reader) < 32)
+	{
+		return INFLATE_NEED_INPUT;
+	}
+	uint32_t expected = 0;
+	for (int k = 0; k < 4; ++k)
+	{
+		expected = expected << 8 | read_bits(reader, 8);
+	}
+	update_adler(context);
+	if (expected != context->adler)
+	{
+		return INFLATE_ERROR;
+	}
+	context->state = STATE_DONE;
+	return CONTINUE;
+}
+
+void inflate_init(inflate_t* context, uint8_t* window, size_t window_size, bool zlib)
+{
+	memset(context, 0, sizeof(*context));
+	context->window = window;
+	context->window_size = window_size;
+	context->zlib = zlib;
+	context->state = zlib ? STATE_ZLIB_HEADER : STATE_BLOCK_HEADER;
+	context->adler = 1;
+}
+
+inflate_status_t inflate_run(inflate_t* context, const uint8_t* input, size_t length, size_t* consumed)
+{
+	reader_t reader = { input, length, context->bit_offset, false };
+	sa_state_t sa;
+	sa_state_construct(&sa);
+
+	inflate_status_t status = CONTINUE;
+	while (status == CONTINUE)
+	{
+		switch (context->state)
+		{
+		case STATE_ZLIB_HEADER:
+			status = read_zlib_header(context, &reader);
+			break;
+		case STATE_BLOCK_HEADER:
+			status = read_block_header(context, &reader);
+			break;
+		case STATE_STORED:
+			status = copy_stored(context, &reader);
+			break;
+		case STATE_HUFFMAN:
+			status = inflate_huffman(context, &reader, &sa);
+			break;
+		case STATE_ZLIB_TRAILER:
+			status = check_zlib_trailer(context, &reader);
+			break;
+		default:
+			status = INFLATE_DONE;
+			break;
+		}
+	}
+	sa_state_destruct(&sa);
+
+	// The rest of the last byte is padding.
+	if (status == INFLATE_DONE)
+	{
+		reader.bit = (reader.bit + 7) & ~(size_t)7;
+	}
+	*consumed = reader.bit >> 3;
+	context->bit_offset = reader.bit & 7;
+	update_adler(context);
+	return status;
+}
+
+void inflate_slide(inflate_t* context)
+{
+	size_t keep = context->position < INFLATE_HISTORY ? context->position : INFLATE_HISTORY;
+	size_t dropped = context->position - keep;
+	memmove(context->window, context->window + dropped, keep);
+	context->position = keep;
+	context->checked -= dropped;
+}
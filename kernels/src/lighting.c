@@ -0,0 +1,235 @@
+/*
+*	Vertex lighting, see 'lighting.h'.
+*/
+
+#include <ps2kernels/lighting.h>
+
+#include <ps2intrin.h>
+
+#include <stdbool.h>
+#include <string.h>
+
+/// Fraction bits of the accumulated colors
+#define COLOR_SHIFT 4
+
+/// Light constants, vectors laid out as 'x y z 0 x y z 0'
+typedef struct
+{
+	m128i16 direction;
+	m128i16 color;
+	m128i16 position;
+	m128i16 radius;
+	m128i16 negative_radius;
+	m128i32 radius_squared;
+	/// Right shift of 'd^2' bringing 'radius^2' to [2^14, 2^15), negative to shift left
+	int shift;
+	/// '(2^29 - 1) / (radius^2 >> shift)'
+	m128i16 scale;
+	bool point;
+} light_setup_t;
+
+static inline m128i16 pair_of(int16_t x, int16_t y, int16_t z)
+{
+	return mm_set_epi16(0, z, y, x, 0, z, y, x);
+}
+
+static light_setup_t setup(const light_t* light)
+{
+	light_setup_t result = {};
+	result.direction = pair_of(light->direction[0], light->direction[1], light->direction[2]);
+	result.color = pair_of(light->color[0], light->color[1], light->color[2]);
+	result.point = light->radius > 0;
+	if (result.point)
+	{
+		int32_t radius_squared = (int32_t)light->radius * light->radius;
+		int shift = 0;
+		while ((radius_squared >> shift) >= 1 << 15)
+		{
+			++shift;
+		}
+		while (shift <= 0 && (radius_squared << -shift) < 1 << 14)
+		{
+			--shift;
+		}
+		int32_t scaled = shift >= 0 ? radius_squared >> shift : radius_squared << -shift;
+
+		result.position = pair_of(light->position[0], light->position[1], light->position[2]);
+		result.radius = mm_broadcast_epi16(light->radius);
+		result.negative_radius = mm_broadcast_epi16((int16_t)-light->radius);
+		result.radius_squared = mm_broadcast_epi32(radius_squared);
+		result.shift = shift;
+		result.scale = mm_broadcast_epi16((int16_t)(((1 << 29) - 1) / scaled));
+	}
+	return result;
+}
+
+/// @brief Dot products of the vectors of 4 vertices, 2 per quadword, with 'w[0]' and 'w[1]'
+static inline m128i32 dot4(lohi_state_t* state, const m128i16 v[2], const m128i16 w[2])
+{
+	// PHMADH gives 'xy0 z0 xy1 z1', PEXCW turns it into 'xy0 xy1 z0 z1'.
+	m128i64 a = mm_castepi64_epi32(mm_xchgcenter_epi32(mm_hmuladd_epi16(state, v[0], w[0])));
+	m128i64 b = mm_castepi64_epi32(mm_xchgcenter_epi32(mm_hmuladd_epi16(state, v[1], w[1])));
+	return mm_add_epi32(mm_castepi32_epi64(mm_unpacklo_epi64(a, b)), mm_castepi32_epi64(mm_unpackhi_epi64(a, b)));
+}
+
+/// @brief Shift right by 'amount' bits, left for negative amounts
+static inline m128i32 shift_by(m128i32 v, int amount)
+{
+	if (amount == 0)
+	{
+		return v;
+	}
+
+	// PSRAVW/PSLLVW only shift positions 0 and 2.
+	m128i64 lower = mm_castepi64_epi32(mm_extlo_epi32(v, v));
+	m128i64 upper = mm_castepi64_epi32(mm_exthi_epi32(v, v));
+	if (amount > 0)
+	{
+		m128u64 n = mm_set_epu64((uint64_t)amount, (uint64_t)amount);
+		lower = mm_srav_epi64(lower, n);
+		upper = mm_srav_epi64(upper, n);
+	}
+	else
+	{
+		m128u64 n = mm_set_epu64((uint64_t)-amount, (uint64_t)-amount);
+		lower = mm_sllv_epi64(lower, n);
+		upper = mm_sllv_epi64(upper, n);
+	}
+	return mm_pack_epi32(mm_castepi32_epi64(lower), mm_castepi32_epi64(upper));
+}
+
+/// @brief '1 - d^2 / radius^2' in Q1.15, clamped to 0
+static inline m128i32 attenuation(lohi_state_t* state, const light_setup_t* light, const m128i16 positions[2])
+{
+	// A component clamped to the radius puts the vertex outside of it, so the clamped distance
+	// still gives 0.
+	m128i16 offsets[2];
+	for (size_t h = 0; h < 2; ++h)
+	{
+		m128i16 offset = mm_subs_epi16(light->position, positions[h]);
+		offsets[h] = mm_min_epi16(mm_max_epi16(offset, light->negative_radius), light->radius);
+	}
+	m128i32 distance = shift_by(mm_min_epi32(dot4(state, offsets, offsets), light->radius_squared), light->shift);
+
+	// Values below 2^15 in the 32-bit lanes are in the even halfwords, which PMULTH multiplies.
+	m128i32 falloff = mm_mul_epi16(state, mm_castepi16_epi32(distance), light->scale);
+	PSRAW(falloff, falloff, 14);
+	return mm_max_epi32(mm_sub_epi32(mm_broadcast_epi32(0x7FFF), falloff), mm_setzero_epi32());
+}
+
+/// @brief Add 'color * intensity' to the colors of 4 vertices
+/// @param colors Colors of vertices 0, 1 and 2, 3 as 'r g b a r g b a', 'COLOR_SHIFT' fraction bits
+/// @param intensity Intensities of the 4 vertices, Q1.15
+static inline void accumulate(lohi_state_t* state, m128i16 colors[2], m128i32 intensity, m128i16 color)
+{
+	m128i32 shifted;
+	PSLLW(shifted, intensity, 16);
+	m128i32 pairs = mm_or_epi32(intensity, shifted);		// i0 i0 i1 i1 i2 i2 i3 i3
+	m128i32 spread[2] = { mm_extlo_epi32(pairs, pairs), mm_exthi_epi32(pairs, pairs) };
+
+	for (size_t h = 0; h < 2; ++h)
+	{
+		// PMULTH leaves the products of even positions in the result and those of odd positions
+		// in LO/HI. Both are below 2^16 after the shift, so they interleave with a shift and OR.
+		m128i32 even = mm_mul_epi16(state, mm_castepi16_epi32(spread[h]), color);
+		m128i32 odd = mm_loadlohi_upper_epi32(state);
+		PSRAW(even, even, 15 - COLOR_SHIFT);
+		PSRAW(odd, odd, 15 - COLOR_SHIFT);
+		PSLLW(odd, odd, 16);
+		colors[h] = mm_adds_epi16(colors[h], mm_castepi16_epi32(mm_or_epi32(even, odd)));
+	}
+}
+
+/// @brief Light 4 vertices, 'normals' and 'positions' are 2 quadwords each
+static inline m128u8 light4(lohi_state_t* state, const light_setup_t* lights, size_t light_count,
+							const m128i16 normals[2], const m128i16 positions[2], m128u8 base)
+{
+	m128i8 zero = mm_setzero_epi8();
+	m128i16 colors[2] = {
+		mm_castepi16_epi8(mm_extlo_epi8(mm_castepi8_epu8(base), zero)),
+		mm_castepi16_epi8(mm_exthi_epi8(mm_castepi8_epu8(base), zero)),
+	};
+	PSLLH(colors[0], colors[0], COLOR_SHIFT);
+	PSLLH(colors[1], colors[1], COLOR_SHIFT);
+
+	for (size_t l = 0; l < light_count; ++l)
+	{
+		const light_setup_t* light = &lights[l];
+		m128i16 direction[2] = { light->direction, light->direction };
+
+		// N.L is Q2.28, clamped to [0, 1) in Q1.15.
+		m128i32 intensity = mm_max_epi32(dot4(state, normals, direction), mm_setzero_epi32());
+		PSRAW(intensity, intensity, 13);
+		intensity = mm_min_epi32(intensity, mm_broadcast_epi32(0x7FFF));
+		if (light->point)
+		{
+			intensity = mm_mul_epi16(state, mm_castepi16_epi32(intensity),
+									 mm_castepi16_epi32(attenuation(state, light, positions)));
+			PSRAW(intensity, intensity, 15);
+		}
+		accumulate(state, colors, intensity, light->color);
+	}
+
+	m128i16 limit = mm_broadcast_epi16(0xFF);
+	for (size_t h = 0; h < 2; ++h)
+	{
+		PSRAH(colors[h], colors[h], COLOR_SHIFT);
+		colors[h] = mm_min_epi16(colors[h], limit);
+	}
+	// PPACB keeps the low byte of each halfword.
+	return mm_pack_epu8(mm_castepu8_epi16(colors[0]), mm_castepu8_epi16(colors[1]));
+}
+
+void light_vertices(const lighting_input_t* input, const light_t* lights, size_t light_count, uint32_t ambient,
+					uint32_t* output, size_t count)
+{
+	light_setup_t setups[LIGHT_MAX_COUNT];
+	bool points = false;
+	if (light_count > LIGHT_MAX_COUNT)
+	{
+		light_count = LIGHT_MAX_COUNT;
+	}
+	for (size_t l = 0; l < light_count; ++l)
+	{
+		setups[l] = setup(&lights[l]);
+		points |= setups[l].point;
+	}
+	m128u8 ambient4 = mm_castepu8_epu32(mm_castepu32_epi32(mm_broadcast_epi32((int32_t)ambient)));
+
+	lohi_state_t state;
+	lohi_state_construct(&state);
+
+	size_t i = 0;
+	for (; i + 4 <= count; i += 4)
+	{
+		const m128i16* normals = (const m128i16*)(input->normals + i * 4);
+		const m128i16* positions = points ? (const m128i16*)(input->positions + i * 4) : normals;
+		m128i16 n[2] = { mm_load_epi16(normals), mm_load_epi16(normals + 1) };
+		m128i16 p[2] = { mm_load_epi16(positions), mm_load_epi16(positions + 1) };
+		m128u8 base = input->colors ? mm_load_epu8((const m128u8*)(input->colors + i)) : ambient4;
+		mm_store_epu8((m128u8*)(output + i), light4(&state, setups, light_count, n, p, base));
+	}
+
+	if (i < count)
+	{
+		// Light the remaining vertices from zero-padded copies.
+		size_t rest = count - i;
+		m128i16 n[2] = {};
+		m128i16 p[2] = {};
+		m128u8 base = ambient4;
+		m128u8 result;
+		memcpy(n, input->normals + i * 4, rest * 4 * sizeof(int16_t));
+		if (points)
+		{
+			memcpy(p, input->positions + i * 4, rest * 4 * sizeof(int16_t));
+		}
+		if (input->colors)
+		{
+			memcpy(&base, input->colors + i, rest * sizeof(uint32_t));
+		}
+		result = light4(&state, setups, light_count, n, p, base);
+		memcpy(output + i, &result, rest * sizeof(uint32_t));
+	}
+
+	lohi_state_destruct(&state);
+}
@@ -0,0 +1,323 @@
+/*
+*	LZ4 blocks, see 'lz4.h'.
+*
+*	Every position is hashed from its next 4 bytes, 'head' holds the last position of each hash
+*	and 'chain' links each position to the previous one with the same hash. A candidate match is
+*	extended with PCEQB on 16 bytes at a time. On a mismatch, the lowest differing byte is
+*	isolated and PLZCW turns it into a byte index.
+*/
+
+#include <ps2kernels/lz4.h>
+
+#include <ps2intrin.h>
+
+#include <stdbool.h>
+#include <string.h>
+
+#define MIN_MATCH 4
+/// The last bytes of a block are always literals.
+#define LAST_LITERALS 5
+/// The last match starts at least this many bytes before the end.
+#define MATCH_START_LIMIT 12
+#define MAX_DISTANCE 65535
+/// Misses in a row for each extra position the fast effort skips
+#define SKIP_MISSES 64
+
+typedef union
+{
+	m128u8 v;
+	uint8_t b[16];
+	uint64_t d[2];
+} bytes_t;
+
+static inline uint32_t load32(const uint8_t* p)
+{
+	uint32_t value;
+	memcpy(&value, p, sizeof(value));
+	return value;
+}
+
+static inline uint32_t hash4(const uint8_t* p)
+{
+	return (load32(p) * 2654435761u) >> (32 - LZ4_HASH_BITS);
+}
+
+/// @brief Index of the lowest nonzero byte of a nonzero mask of whole bytes
+static inline size_t first_set_byte(uint64_t mask)
+{
+	// PLZCW of a single bit '1 << 8k' is '30 - 8k' in its word and 31 for a zero word.
+	uint64_t counts = mm_clb_u64(mask & (0 - mask));
+	uint32_t low = (uint32_t)counts;
+	return low != 31 ? (30 - low) >> 3 : 4 + ((30 - (uint32_t)(counts >> 32)) >> 3);
+}
+
+/// @brief Number of equal bytes at 'a' and 'b', stopping at 'limit' for 'b'
+static inline size_t common_length(const uint8_t* a, const uint8_t* b, const uint8_t* limit)
+{
+	const uint8_t* start = b;
+	while (b + 16 <= limit)
+	{
+		bytes_t x;
+		bytes_t y;
+		memcpy(x.b, a, 16);
+		memcpy(y.b, b, 16);
+		bytes_t equal = { .v = mm_cmpeq_epu8(x.v, y.v) };
+		uint64_t low = ~equal.d[0];
+		uint64_t high = ~equal.d[1];
+		if (low != 0)
+		{
+			return (size_t)(b - start) + first_set_byte(low);
+		}
+		if (high != 0)
+		{
+			return (size_t)(b - start) + 8 + first_set_byte(high);
+		}
+		a += 16;
+		b += 16;
+	}
+	while (b < limit && *a == *b)
+	{
+		++a;
+		++b;
+	}
+	return (size_t)(b - start);
+}
+
+static inline void insert(lz4_workspace_t* workspace, const uint8_t* input, size_t position)
+{
+	uint32_t hash = hash4(input + position);
+	uint32_t previous = workspace->head[hash];
+	size_t distance = previous != 0 ? position + 1 - previous : 0;
+	workspace->chain[position & 0xFFFF] = (uint16_t)(distance <= MAX_DISTANCE ? distance : 0);
+	workspace->head[hash] = (uint32_t)position + 1;
+}
+
+/// @brief Longest match of 'position' with the positions inserted before it
+/// @param limit End of the bytes a match can cover
+/// @param distance Receives the distance of the match
+/// @return Length of the match, 0 if there is none
+static size_t find_match(const lz4_workspace_t* workspace, const uint8_t* input, size_t position, size_t limit,
+						 unsigned effort, size_t* distance)
+{
+	uint32_t head = workspace->head[hash4(input + position)];
+	if (head == 0)
+	{
+		return 0;
+	}
+
+	size_t best = 0;
+	size_t candidate = head - 1;
+	uint32_t next4 = load32(input + position);
+	for (unsigned tries = 0; tries < effort && position - candidate <= MAX_DISTANCE; ++tries)
+	{
+		// A longer match has to match at the current best length too.
+		if (load32(input + candidate) == next4 && (best == 0 || input[candidate + best] == input[position + best]))
+		{
+			size_t length = MIN_MATCH + common_length(input + candidate + MIN_MATCH, input + position + MIN_MATCH, input + limit);
+			if (length > best)
+			{
+				best = length;
+				*distance = position - candidate;
+				if (position + length == limit)
+				{
+					break;
+				}
+			}
+		}
+
+		uint16_t step = workspace->chain[candidate & 0xFFFF];
+		if (step == 0)
+		{
+			break;
+		}
+		candidate -= step;
+	}
+	return best;
+}
+
+/// @brief Write the rest of a length past the 15 held by the token
+static inline uint8_t* write_length(uint8_t* output, size_t length)
+{
+	for (length -= 15; length >= 255; length -= 255)
+	{
+		*output++ = 255;
+	}
+	*output++ = (uint8_t)length;
+	return output;
+}
+
+/// @brief Write a sequence of literals followed by a match
+/// @param match Length of the match, 0 for the last literals of the block
+/// @return End of the sequence, NULL if it does not fit before 'end'
+static uint8_t* write_sequence(uint8_t* output, const uint8_t* end, const uint8_t* literals, size_t literal_count,
+							   size_t distance, size_t match)
+{
+	size_t needed = 2 + literal_count + literal_count / 255 + (match != 0 ? 3 + match / 255 : 0);
+	if (needed > (size_t)(end - output))
+	{
+		return NULL;
+	}
+
+	uint8_t* token = output++;
+	*token = (uint8_t)((literal_count < 15 ? literal_count : 15) << 4);
+	if (literal_count >= 15)
+	{
+		output = write_length(output, literal_count);
+	}
+	// 'literals' can be NULL for an empty block.
+	if (literal_count != 0)
+	{
+		memcpy(output, literals, literal_count);
+		output += literal_count;
+	}
+
+	if (match != 0)
+	{
+		output[0] = (uint8_t)distance;
+		output[1] = (uint8_t)(distance >> 8);
+		output += 2;
+		size_t rest = match - MIN_MATCH;
+		*token |= (uint8_t)(rest < 15 ? rest : 15);
+		if (rest >= 15)
+		{
+			output = write_length(output, rest);
+		}
+	}
+	return output;
+}
+
+size_t lz4_compress(const uint8_t* input, size_t length, uint8_t* output, size_t capacity, unsigned effort,
+					lz4_workspace_t* workspace)
+{
+	uint8_t* cursor = output;
+	uint8_t* end = output + capacity;
+	effort = effort < LZ4_EFFORT_FAST ? LZ4_EFFORT_FAST : effort > LZ4_EFFORT_MAX ? LZ4_EFFORT_MAX : effort;
+	memset(workspace->head, 0, sizeof(workspace->head));
+
+	size_t anchor = 0;
+	size_t position = 0;
+	size_t inserted = 0;
+	size_t misses = 0;
+	size_t limit = length > LAST_LITERALS ? length - LAST_LITERALS : 0;
+	while (length >= MATCH_START_LIMIT && position <= length - MATCH_START_LIMIT)
+	{
+		while (inserted < position)
+		{
+			insert(workspace, input, inserted++);
+		}
+
+		size_t distance = 0;
+		size_t match = find_match(workspace, input, position, limit, effort, &distance);
+		if (match == 0)
+		{
+			size_t step = 1;
+			if (effort == LZ4_EFFORT_FAST)
+			{
+				// Incompressible data is crossed faster and faster, only searched positions are
+				// inserted.
+				step += misses++ / SKIP_MISSES;
+				insert(workspace, input, position);
+				inserted = position + step;
+			}
+			position += step;
+			continue;
+		}
+
+		cursor = write_sequence(cursor, end, input + anchor, position - anchor, distance, match);
+		if (cursor == NULL)
+		{
+			return 0;
+		}
+		if (effort == LZ4_EFFORT_FAST)
+		{
+			insert(workspace, input, position);
+			inserted = position + match;
+		}
+		position += match;
+		anchor = position;
+		misses = 0;
+	}
+
+	cursor = write_sequence(cursor, end, input + anchor, length - anchor, 0, 0);
+	return cursor != NULL ? (size_t)(cursor - output) : 0;
+}
+
+/// @brief Read the rest of a length past the 15 held by the token
+/// @return False if the input ends first
+static inline bool read_length(const uint8_t* input, size_t length, size_t* i, size_t* value)
+{
+	uint8_t byte;
+	do
+	{
+		if (*i >= length)
+		{
+			return false;
+		}
+		byte = input[(*i)++];
+		*value += byte;
+	} while (byte == 255);
+	return true;
+}
+
+size_t lz4_decompress(const uint8_t* input, size_t length, uint8_t* output, size_t capacity)
+{
+	size_t i = 0;
+	size_t written = 0;
+	while (i < length)
+	{
+		uint8_t token = input[i++];
+		size_t literals = token >> 4;
+		if (literals == 15 && !read_length(input, length, &i, &literals))
+		{
+			return LZ4_ERROR;
+		}
+		if (literals > length - i || literals > capacity - written)
+		{
+			return LZ4_ERROR;
+		}
+		if (literals != 0)
+		{
+			memcpy(output + written, input + i, literals);
+		}
+		i += literals;
+		written += literals;
+		if (i == length)
+		{
+			return written;
+		}
+
+		if (length - i < 2)
+		{
+			return LZ4_ERROR;
+		}
+		size_t distance = input[i] | (size_t)input[i + 1] << 8;
+		i += 2;
+		size_t match = token & 15;
+		if (match == 15 && !read_length(input, length, &i, &match))
+		{
+			return LZ4_ERROR;
+		}
+		match += MIN_MATCH;
+		if (distance == 0 || distance > written || match > capacity - written)
+		{
+			return LZ4_ERROR;
+		}
+
+		uint8_t* destination = output + written;
+		const uint8_t* source = destination - distance;
+		if (distance >= match)
+		{
+			memcpy(destination, source, match);
+		}
+		else
+		{
+			for (size_t k = 0; k < match; ++k)
+			{
+				destination[k] = source[k];
+			}
+		}
+		written += match;
+	}
+	// A block ends with literals.
+	return length == 0 ? 0 : LZ4_ERROR;
+}
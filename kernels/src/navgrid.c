@@ -0,0 +1,334 @@
+/*
+*	Distance maps and flow fields, see 'navgrid.h'.
+*
+*	Along a row, 'd[x] = min(d[x], d[x - 1] + c[x])' is a prefix scan over pairs of a distance
+*	and the cost of the cells it crosses. Lanes combine with the lanes 1, 2 and 4 positions
+*	before them, lined up by QFSRV with the quadword before, whose pairs are already complete.
+*	That reaches 7 lanes back, so a last step combines every lane with the lane 8 positions
+*	before it, in the quadword before. Blocked cells cost 'NAV_INFINITY', so the saturated sums
+*	never cross them.
+*/
+
+#include <ps2kernels/navgrid.h>
+
+#include <ps2intrin.h>
+
+#include <string.h>
+
+typedef union
+{
+	uint128_t q;
+	m128i16 v;
+} quadword_t;
+
+/// @brief State of a row scan after a quadword
+typedef struct
+{
+	/// Final distances
+	m128i16 distance;
+	/// Costs of 1, 2 and 4 cells ending at every lane
+	m128i16 cost1;
+	m128i16 cost2;
+	m128i16 cost4;
+} scan_t;
+
+static inline m128i16 infinity(void)
+{
+	return mm_broadcast_epi16(NAV_INFINITY);
+}
+
+static inline scan_t scan_start(void)
+{
+	scan_t result = { infinity(), infinity(), infinity(), infinity() };
+	return result;
+}
+
+/// @brief 'cells' moved up by 'n' lanes, with the top 'n' lanes of 'before' in the bottom ones
+static inline m128i16 from_left(sa_state_t* sa, m128i16 before, m128i16 cells, unsigned n)
+{
+	quadword_t upper = { .v = cells };
+	quadword_t lower = { .v = before };
+	quadword_t result;
+	set_sa_16(sa, 8 - n);
+	result.q = byte_shift_logical_right(sa, upper.q, lower.q);
+	return result.v;
+}
+
+/// @brief 'cells' moved down by 'n' lanes, with the bottom 'n' lanes of 'after' in the top ones
+static inline m128i16 from_right(sa_state_t* sa, m128i16 cells, m128i16 after, unsigned n)
+{
+	quadword_t upper = { .v = after };
+	quadword_t lower = { .v = cells };
+	quadword_t result;
+	set_sa_16(sa, n);
+	result.q = byte_shift_logical_right(sa, upper.q, lower.q);
+	return result.v;
+}
+
+/// @brief Scan a quadword of a row from left to right
+/// @param cost Cost of entering each cell from its left
+static inline m128i16 scan_forward(sa_state_t* sa, scan_t* scan, m128i16 distance, m128i16 cost)
+{
+	m128i16 cost2 = mm_adds_epi16(cost, from_left(sa, scan->cost1, cost, 1));
+	m128i16 cost4 = mm_adds_epi16(cost2, from_left(sa, scan->cost2, cost2, 2));
+	m128i16 cost8 = mm_adds_epi16(cost4, from_left(sa, scan->cost4, cost4, 4));
+	distance = mm_min_epi16(distance, mm_adds_epi16(from_left(sa, scan->distance, distance, 1), cost));
+	distance = mm_min_epi16(distance, mm_adds_epi16(from_left(sa, scan->distance, distance, 2), cost2));
+	distance = mm_min_epi16(distance, mm_adds_epi16(from_left(sa, scan->distance, distance, 4), cost4));
+	distance = mm_min_epi16(distance, mm_adds_epi16(scan->distance, cost8));
+
+	scan->distance = distance;
+	scan->cost1 = cost;
+	scan->cost2 = cost2;
+	scan->cost4 = cost4;
+	return distance;
+}
+
+/// @brief Scan a quadword of a row from right to left
+/// @param cost Cost of entering each cell from its right
+static inline m128i16 scan_backward(sa_state_t* sa, scan_t* scan, m128i16 distance, m128i16 cost)
+{
+	m128i16 cost2 = mm_adds_epi16(cost, from_right(sa, cost, scan->cost1, 1));
+	m128i16 cost4 = mm_adds_epi16(cost2, from_right(sa, cost2, scan->cost2, 2));
+	m128i16 cost8 = mm_adds_epi16(cost4, from_right(sa, cost4, scan->cost4, 4));
+	distance = mm_min_epi16(distance, mm_adds_epi16(from_right(sa, distance, scan->distance, 1), cost));
+	distance = mm_min_epi16(distance, mm_adds_epi16(from_right(sa, distance, scan->distance, 2), cost2));
+	distance = mm_min_epi16(distance, mm_adds_epi16(from_right(sa, distance, scan->distance, 4), cost4));
+	distance = mm_min_epi16(distance, mm_adds_epi16(scan->distance, cost8));
+
+	scan->distance = distance;
+	scan->cost1 = cost;
+	scan->cost2 = cost2;
+	scan->cost4 = cost4;
+	return distance;
+}
+
+/// @brief Whether any bit of 'v' is set
+static inline bool any(m128i16 v)
+{
+	m128i32 v32 = mm_castepi32_epi16(v);
+	m128i64 v64 = mm_castepi64_epi32(v32);
+	v32 = mm_or_epi32(v32, mm_castepi32_epi64(mm_unpackhi_epi64(v64, v64)));
+	v32 = mm_or_epi32(v32, mm_rot3_epi32(v32));
+
+	int32_t lanes[4];
+	memcpy(lanes, &v32, sizeof(lanes));
+	return lanes[0] != 0;
+}
+
+/// @brief Quadword 'q' of a row of 'count' quadwords, cells outside of the grid read as not reached
+static inline m128i16 cells_at(const m128i16* row, size_t q, size_t count)
+{
+	return row != NULL && q < count ? mm_load_epi16(row + q) : infinity();
+}
+
+/// @brief Smallest distance of the cells above or below every cell of quadword 'q'
+/// @param diagonal Receives the smallest distance of the cells diagonal to them
+static inline m128i16 neighbors_of(sa_state_t* sa, const m128i16* row, size_t q, size_t count, m128i16* diagonal)
+{
+	m128i16 cells = mm_load_epi16(row + q);
+	m128i16 left = from_left(sa, q > 0 ? mm_load_epi16(row + q - 1) : infinity(), cells, 1);
+	m128i16 right = from_right(sa, cells, cells_at(row, q + 1, count), 1);
+	*diagonal = mm_min_epi16(left, right);
+	return cells;
+}
+
+/// @brief Forward chamfer pass, top to bottom and left to right
+static m128i16 chamfer_forward(sa_state_t* sa, m128i16* distance, const m128i16* walls, size_t count, size_t height)
+{
+	m128i16 orthogonal = mm_broadcast_epi16(NAV_CHAMFER_ORTHOGONAL);
+	m128i16 diagonal = mm_broadcast_epi16(NAV_CHAMFER_DIAGONAL);
+	m128i16 changed = mm_setzero_epi16();
+
+	for (size_t y = 0; y < height; ++y)
+	{
+		m128i16* row = distance + y * count;
+		const m128i16* wall_row = walls + y * count;
+		scan_t scan = scan_start();
+		for (size_t q = 0; q < count; ++q)
+		{
+			m128i16 wall = mm_load_epi16(wall_row + q);
+			m128i16 cost_orthogonal = mm_max_epi16(orthogonal, wall);
+			m128i16 cells = mm_load_epi16(row + q);
+			m128i16 d = cells;
+			if (y > 0)
+			{
+				m128i16 corners;
+				m128i16 above = neighbors_of(sa, row - count, q, count, &corners);
+				d = mm_min_epi16(d, mm_adds_epi16(above, cost_orthogonal));
+				d = mm_min_epi16(d, mm_adds_epi16(corners, mm_max_epi16(diagonal, wall)));
+			}
+			d = scan_forward(sa, &scan, d, cost_orthogonal);
+
+			changed = mm_or_epi16(changed, mm_xor_epi16(d, cells));
+			mm_store_epi16(row + q, d);
+		}
+	}
+	return changed;
+}
+
+/// @brief Backward chamfer pass, bottom to top and right to left
+static m128i16 chamfer_backward(sa_state_t* sa, m128i16* distance, const m128i16* walls, size_t count, size_t height)
+{
+	m128i16 orthogonal = mm_broadcast_epi16(NAV_CHAMFER_ORTHOGONAL);
+	m128i16 diagonal = mm_broadcast_epi16(NAV_CHAMFER_DIAGONAL);
+	m128i16 changed = mm_setzero_epi16();
+
+	for (size_t y = height; y-- > 0;)
+	{
+		m128i16* row = distance + y * count;
+		const m128i16* wall_row = walls + y * count;
+		scan_t scan = scan_start();
+		for (size_t q = count; q-- > 0;)
+		{
+			m128i16 wall = mm_load_epi16(wall_row + q);
+			m128i16 cost_orthogonal = mm_max_epi16(orthogonal, wall);
+			m128i16 cells = mm_load_epi16(row + q);
+			m128i16 d = cells;
+			if (y + 1 < height)
+			{
+				m128i16 corners;
+				m128i16 below = neighbors_of(sa, row + count, q, count, &corners);
+				d = mm_min_epi16(d, mm_adds_epi16(below, cost_orthogonal));
+				d = mm_min_epi16(d, mm_adds_epi16(corners, mm_max_epi16(diagonal, wall)));
+			}
+			d = scan_backward(sa, &scan, d, cost_orthogonal);
+
+			changed = mm_or_epi16(changed, mm_xor_epi16(d, cells));
+			mm_store_epi16(row + q, d);
+		}
+	}
+	return changed;
+}
+
+size_t nav_chamfer(int16_t* distance, const int16_t* walls, size_t width, size_t height, size_t max_passes)
+{
+	sa_state_t sa;
+	sa_state_construct(&sa);
+
+	size_t count = width / 8;
+	size_t passes = 0;
+	while (passes < max_passes)
+	{
+		++passes;
+		m128i16 changed = chamfer_forward(&sa, (m128i16*)distance, (const m128i16*)walls, count, height);
+		changed = mm_or_epi16(changed, chamfer_backward(&sa, (m128i16*)distance, (const m128i16*)walls, count, height));
+		if (!any(changed))
+		{
+			break;
+		}
+	}
+
+	sa_state_destruct(&sa);
+	return passes;
+}
+
+/// @brief Relax one row from the rows above and below, then along the row both ways
+static m128i16 relax_row(sa_state_t* sa, m128i16* row, const m128i16* cost_row, const m128i16* above,
+						 const m128i16* below, size_t count)
+{
+	m128i16 changed = mm_setzero_epi16();
+	scan_t scan = scan_start();
+	for (size_t q = 0; q < count; ++q)
+	{
+		m128i16 cost = mm_load_epi16(cost_row + q);
+		m128i16 cells = mm_load_epi16(row + q);
+		m128i16 vertical = mm_min_epi16(cells_at(above, q, count), cells_at(below, q, count));
+		m128i16 d = mm_min_epi16(cells, mm_adds_epi16(vertical, cost));
+		d = scan_forward(sa, &scan, d, cost);
+
+		changed = mm_or_epi16(changed, mm_xor_epi16(d, cells));
+		mm_store_epi16(row + q, d);
+	}
+
+	scan = scan_start();
+	for (size_t q = count; q-- > 0;)
+	{
+		m128i16 cells = mm_load_epi16(row + q);
+		m128i16 d = scan_backward(sa, &scan, cells, mm_load_epi16(cost_row + q));
+
+		changed = mm_or_epi16(changed, mm_xor_epi16(d, cells));
+		mm_store_epi16(row + q, d);
+	}
+	return changed;
+}
+
+bool nav_relax(int16_t* distance, const int16_t* costs, size_t width, size_t height)
+{
+	sa_state_t sa;
+	sa_state_construct(&sa);
+
+	size_t count = width / 8;
+	m128i16* rows = (m128i16*)distance;
+	const m128i16* cost_rows = (const m128i16*)costs;
+	m128i16 changed = mm_setzero_epi16();
+	for (size_t y = 0; y < height; ++y)
+	{
+		changed = mm_or_epi16(changed, relax_row(&sa, rows + y * count, cost_rows + y * count,
+												 y > 0 ? rows + (y - 1) * count : NULL,
+												 y + 1 < height ? rows + (y + 1) * count : NULL, count));
+	}
+	for (size_t y = height; y-- > 0;)
+	{
+		changed = mm_or_epi16(changed, relax_row(&sa, rows + y * count, cost_rows + y * count,
+												 y > 0 ? rows + (y - 1) * count : NULL,
+												 y + 1 < height ? rows + (y + 1) * count : NULL, count));
+	}
+
+	sa_state_destruct(&sa);
+	return any(changed);
+}
+
+/// @brief Keep 'direction' where 'candidate' is closer than 'best'
+static inline void consider(m128i16* best, m128i16* directions, m128i16 candidate, int16_t direction)
+{
+	m128i16 closer = mm_cmpgt_epi16(*best, candidate);
+	*best = mm_min_epi16(*best, candidate);
+	m128i16 flip = mm_xor_epi16(*directions, mm_broadcast_epi16(direction));
+	*directions = mm_xor_epi16(*directions, mm_and_epi16(flip, closer));
+}
+
+void nav_flow_field(const int16_t* distance, uint8_t* directions, size_t width, size_t height)
+{
+	sa_state_t sa;
+	sa_state_construct(&sa);
+
+	size_t count = width / 8;
+	const m128i16* rows = (const m128i16*)distance;
+	for (size_t y = 0; y < height; ++y)
+	{
+		const m128i16* row = rows + y * count;
+		const m128i16* above = y > 0 ? row - count : NULL;
+		const m128i16* below = y + 1 < height ? row + count : NULL;
+		for (size_t q = 0; q < count; ++q)
+		{
+			m128i16 cells = mm_load_epi16(row + q);
+			m128i16 left = from_left(&sa, q > 0 ? mm_load_epi16(row + q - 1) : infinity(), cells, 1);
+			m128i16 right = from_right(&sa, cells, cells_at(row, q + 1, count), 1);
+			m128i16 up = cells_at(above, q, count);
+			m128i16 down = cells_at(below, q, count);
+			m128i16 up_left = above ? from_left(&sa, q > 0 ? mm_load_epi16(above + q - 1) : infinity(), up, 1) : up;
+			m128i16 up_right = above ? from_right(&sa, up, cells_at(above, q + 1, count), 1) : up;
+			m128i16 down_left = below ? from_left(&sa, q > 0 ? mm_load_epi16(below + q - 1) : infinity(), down, 1) : down;
+			m128i16 down_right = below ? from_right(&sa, down, cells_at(below, q + 1, count), 1) : down;
+
+			// Orthogonal neighbors first, so they win ties.
+			m128i16 best = cells;
+			m128i16 result = mm_broadcast_epi16(NAV_FLOW_NONE);
+			consider(&best, &result, right, 0);
+			consider(&best, &result, up, 2);
+			consider(&best, &result, left, 4);
+			consider(&best, &result, down, 6);
+			consider(&best, &result, up_right, 1);
+			consider(&best, &result, up_left, 3);
+			consider(&best, &result, down_left, 5);
+			consider(&best, &result, down_right, 7);
+
+			// PPACB keeps the low byte of each halfword.
+			m128u8 bytes = mm_pack_epu8(mm_castepu8_epi16(result), mm_castepu8_epi16(result));
+			memcpy(directions + y * width + q * 8, &bytes, 8);
+		}
+	}
+
+	sa_state_destruct(&sa);
+}
@@ -0,0 +1,216 @@
+/*
+*	Occlusion culling, see 'occlusion.h'.
+*/
+
+#include <ps2kernels/occlusion.h>
+
+#include "hits.h"
+
+#include <ps2intrin.h>
+
+#include <stdbool.h>
+
+/// Fraction bits of the interpolated depth
+#define DEPTH_SHIFT 7
+
+static inline int32_t min32(int32_t a, int32_t b)
+{
+	return a < b ? a : b;
+}
+
+static inline int32_t max32(int32_t a, int32_t b)
+{
+	return a > b ? a : b;
+}
+
+/// @brief Low 32 bits of 'v'
+///
+/// Plane equations are stepped modulo 2^32: values inside the triangle are in range, so they
+/// come out exact even if the values outside of it wrap around.
+static inline int32_t wrap32(int64_t v)
+{
+	return (int32_t)(uint32_t)(uint64_t)v;
+}
+
+/// @brief 'v', 'v + step', 'v + 2 * step' and 'v + 3 * step' for the 4 pixels of a quadword
+static inline m128i32 lanes_of(int64_t v, int64_t step)
+{
+	return mm_set_epi32(wrap32(v + 3 * step), wrap32(v + 2 * step), wrap32(v + step), wrap32(v));
+}
+
+/// @brief Rasterize one triangle with the vertices in counter-clockwise order, 'area' is twice
+/// its area
+static void rasterize(int32_t* band, int32_t first_row, int32_t last_row, const occlusion_vertex_t* v[3],
+					  int64_t area)
+{
+	int32_t min_x = min32(v[0]->x, min32(v[1]->x, v[2]->x));
+	int32_t max_x = max32(v[0]->x, max32(v[1]->x, v[2]->x));
+	int32_t min_y = min32(v[0]->y, min32(v[1]->y, v[2]->y));
+	int32_t max_y = max32(v[0]->y, max32(v[1]->y, v[2]->y));
+
+	// Pixels with their centers within the bounds, starting at a quadword
+	int32_t top = (min_y + 7) >> 4;
+	int32_t x0 = max32(0, (min_x + 7) >> 4) & ~3;
+	int32_t x1 = min32(OCCLUSION_WIDTH - 1, (max_x - 8) >> 4);
+	int32_t y0 = max32(first_row, top);
+	int32_t y1 = min32(last_row, (max_y - 8) >> 4);
+	if (x0 > x1 || y0 > y1)
+	{
+		return;
+	}
+	int32_t cx = x0 * 16 + 8;
+	int32_t cy = y0 * 16 + 8;
+
+	// Edge functions, non-negative inside, at the first pixel of each row
+	int32_t edge_row[3];
+	int32_t edge_step_y[3];
+	m128i32 edge_lanes[3];
+	m128i32 edge_step[3];
+	for (size_t k = 0; k < 3; ++k)
+	{
+		const occlusion_vertex_t* a = v[k];
+		const occlusion_vertex_t* b = v[(k + 1) % 3];
+		int32_t dx = b->x - a->x;
+		int32_t dy = b->y - a->y;
+		edge_row[k] = dx * (cy - a->y) - dy * (cx - a->x);
+		edge_step_y[k] = dx * 16;
+		edge_lanes[k] = lanes_of(0, -dy * 16);
+		edge_step[k] = mm_broadcast_epi32(-dy * 64);
+	}
+
+	// Depth plane 'z0 + (nx * (x - x0) + ny * (y - y0)) / area' with 'DEPTH_SHIFT' fraction bits.
+	// It is evaluated at the top row of the triangle and stepped from there, so every band of
+	// rows gets the same values.
+	int64_t dz1 = v[1]->z - v[0]->z;
+	int64_t dz2 = v[2]->z - v[0]->z;
+	int64_t nx = dz1 * (v[2]->y - v[0]->y) - dz2 * (v[1]->y - v[0]->y);
+	int64_t ny = dz2 * (v[1]->x - v[0]->x) - dz1 * (v[2]->x - v[0]->x);
+	int64_t depth_step_x = nx * (16 << DEPTH_SHIFT) / area;
+	int64_t depth_step_y = ny * (16 << DEPTH_SHIFT) / area;
+	int64_t depth_row = (int64_t)v[0]->z * (1 << DEPTH_SHIFT)
+						+ (nx * (cx - v[0]->x) + ny * (top * 16 + 8 - v[0]->y)) * (1 << DEPTH_SHIFT) / area
+						+ depth_step_y * (y0 - top);
+	m128i32 depth_lanes = lanes_of(0, depth_step_x);
+	m128i32 depth_step = mm_broadcast_epi32(wrap32(4 * depth_step_x));
+	m128i32 depth_min = mm_broadcast_epi32(min32(v[0]->z, min32(v[1]->z, v[2]->z)));
+	m128i32 depth_max = mm_broadcast_epi32(max32(v[0]->z, max32(v[1]->z, v[2]->z)));
+	m128i32 minus_one = mm_broadcast_epi32(-1);
+
+	for (int32_t y = y0; y <= y1; ++y)
+	{
+		m128i32 e0 = mm_add_epi32(mm_broadcast_epi32(edge_row[0]), edge_lanes[0]);
+		m128i32 e1 = mm_add_epi32(mm_broadcast_epi32(edge_row[1]), edge_lanes[1]);
+		m128i32 e2 = mm_add_epi32(mm_broadcast_epi32(edge_row[2]), edge_lanes[2]);
+		m128i32 z = mm_add_epi32(mm_broadcast_epi32(wrap32(depth_row)), depth_lanes);
+
+		m128i32* row = (m128i32*)(band + (y - first_row) * OCCLUSION_WIDTH);
+		for (int32_t x = x0; x <= x1; x += 4)
+		{
+			// Inside if no edge function is negative
+			m128i32 inside = mm_cmpgt_epi32(mm_or_epi32(mm_or_epi32(e0, e1), e2), minus_one);
+			m128i32 depth;
+			PSRAW(depth, z, DEPTH_SHIFT);
+			depth = mm_min_epi32(mm_max_epi32(depth, depth_min), depth_max);
+
+			m128i32* pixels = row + x / 4;
+			mm_store_epi32(pixels, mm_max_epi32(mm_load_epi32(pixels), mm_and_epi32(depth, inside)));
+
+			e0 = mm_add_epi32(e0, edge_step[0]);
+			e1 = mm_add_epi32(e1, edge_step[1]);
+			e2 = mm_add_epi32(e2, edge_step[2]);
+			z = mm_add_epi32(z, depth_step);
+		}
+
+		for (size_t k = 0; k < 3; ++k)
+		{
+			edge_row[k] += edge_step_y[k];
+		}
+		depth_row += depth_step_y;
+	}
+}
+
+void occlusion_rasterize(int32_t* band, unsigned first_row, unsigned rows, const occlusion_vertex_t* vertices,
+						 size_t triangle_count)
+{
+	if (rows == 0)
+	{
+		return;
+	}
+
+	for (size_t i = 0; i < triangle_count; ++i)
+	{
+		const occlusion_vertex_t* v[3] = { &vertices[i * 3], &vertices[i * 3 + 1], &vertices[i * 3 + 2] };
+		int64_t area = (int64_t)(v[1]->x - v[0]->x) * (v[2]->y - v[0]->y)
+					   - (int64_t)(v[2]->x - v[0]->x) * (v[1]->y - v[0]->y);
+		if (area == 0)
+		{
+			continue;
+		}
+		if (area < 0)
+		{
+			const occlusion_vertex_t* swap = v[1];
+			v[1] = v[2];
+			v[2] = swap;
+			area = -area;
+		}
+		rasterize(band, (int32_t)first_row, (int32_t)(first_row + rows - 1), v, area);
+	}
+}
+
+/// @brief Whether the buffer is not closer than 'depth' anywhere in the clipped rectangle
+static bool rect_visible(const int32_t* buffer, int32_t x0, int32_t y0, int32_t x1, int32_t y1, int32_t depth)
+{
+	int32_t first = x0 & ~3;
+	int32_t last = (x1 - 1) & ~3;
+
+	// Lanes outside of the rectangle read as the largest depth, so they never make it visible.
+	m128i32 lanes = mm_set_epi32(3, 2, 1, 0);
+	m128u32 head = mm_castepu32_epi32(mm_cmpgt_epi32(mm_broadcast_epi32(x0 - first), lanes));
+	m128u32 tail = mm_castepu32_epi32(mm_cmpgt_epi32(lanes, mm_broadcast_epi32(x1 - 1 - last)));
+	PSRLW(head, head, 1);
+	PSRLW(tail, tail, 1);
+	m128i32 head_fill = mm_castepi32_epu32(head);
+	m128i32 tail_fill = mm_castepi32_epu32(tail);
+	m128i32 limit = mm_broadcast_epi32(depth);
+
+	for (int32_t y = y0; y < y1; ++y)
+	{
+		const m128i32* row = (const m128i32*)(buffer + y * OCCLUSION_WIDTH);
+		m128i32 closest = mm_broadcast_epi32(INT32_MAX);
+		for (int32_t x = first; x <= last; x += 4)
+		{
+			m128i32 pixels = mm_load_epi32(row + x / 4);
+			if (x == first)
+			{
+				pixels = mm_or_epi32(pixels, head_fill);
+			}
+			if (x == last)
+			{
+				pixels = mm_or_epi32(pixels, tail_fill);
+			}
+			closest = mm_min_epi32(closest, pixels);
+		}
+
+		if (mask4(mm_cmpgt_epi32(closest, limit)) != 0xF)
+		{
+			return true;
+		}
+	}
+	return false;
+}
+
+size_t occlusion_test(const int32_t* depth, const occlusion_rect_t* rects, size_t count, uint32_t* visible)
+{
+	bit_writer_t writer = { visible, 0, 0 };
+	for (size_t i = 0; i < count; ++i)
+	{
+		const occlusion_rect_t* r = &rects[i];
+		int32_t x0 = max32(r->x0, 0);
+		int32_t y0 = max32(r->y0, 0);
+		int32_t x1 = min32(r->x1, OCCLUSION_WIDTH);
+		int32_t y1 = min32(r->y1, OCCLUSION_HEIGHT);
+		bool seen = x0 < x1 && y0 < y1 && rect_visible(depth, x0, y0, x1, y1, r->depth);
+		bit_writer_put(&writer, i, seen, count, 1);
+	}
+	return writer.total;
+}
@@ -0,0 +1,400 @@
+/*
+*	GIF packet and DMA chain builder, see 'packet.h'.
+*/
+
+#include <ps2kernels/packet.h>
+
+#include <ps2intrin.h>
+
+#include <stdarg.h>
+#include <stdio.h>
+#include <string.h>
+
+/// Base of the uncached accelerated segment, which maps main memory like KUSEG does
+#define UNCACHED_ACCELERATED_SEGMENT 0x30000000u
+
+/// @brief Store one quadword, unless the packet is full
+static inline void emit(packet_builder_t* builder, m128u64 value)
+{
+	if (builder->overflow || builder->cursor == builder->end)
+	{
+		builder->overflow = true;
+		return;
+	}
+
+	mm_store_epu64((m128u64*)builder->cursor, value);
+	builder->cursor += 2;
+}
+
+/// @brief Lower 64 bits of a GIF tag
+static inline uint64_t gif_tag(unsigned nloop, bool eop, unsigned flg, unsigned nreg)
+{
+	return (uint64_t)(nloop & 0x7FFF)
+		| ((uint64_t)eop << 15)
+		| ((uint64_t)(flg & 3) << 58)
+		| ((uint64_t)(nreg & 15) << 60);
+}
+
+/// @brief Lower 64 bits of a DMA tag
+static inline uint64_t dma_tag(unsigned id, unsigned qwc, uint32_t address)
+{
+	return (uint64_t)(qwc & 0xFFFF) | ((uint64_t)(id & 7) << 28) | ((uint64_t)address << 32);
+}
+
+/// @brief Quadword offset of the cursor in the current buffer
+static inline size_t offset(const packet_builder_t* builder)
+{
+	return (size_t)(builder->cursor - builder->buffers[builder->current]) / 2;
+}
+
+void packet_builder_construct(packet_builder_t* builder, void* memory, size_t size, unsigned flags)
+{
+	memset(builder, 0, sizeof(*builder));
+
+	// Both buffers start on a cache line, so a packet never shares a line with the other one.
+	builder->capacity = (size / 2) & ~(size_t)63;
+	builder->capacity /= 16;
+
+#ifndef PS2INTRIN_HOST
+	if (flags & PACKET_BUILDER_UNCACHED_ACCELERATED)
+	{
+		builder->segment = UNCACHED_ACCELERATED_SEGMENT - ((uintptr_t)memory & 0xF0000000u);
+	}
+#else
+	(void)flags;
+#endif
+
+	uint8_t* base = (uint8_t*)memory + builder->segment;
+	builder->buffers[0] = (uint64_t*)base;
+	builder->buffers[1] = (uint64_t*)(base + builder->capacity * 16);
+	builder->current = 1;
+	builder->cursor = builder->end = builder->buffers[1];
+}
+
+void packet_builder_begin(packet_builder_t* builder)
+{
+	builder->current ^= 1;
+	builder->cursor = builder->buffers[builder->current];
+	builder->end = builder->cursor + builder->capacity * 2;
+	builder->overflow = false;
+	builder->error[0] = '\0';
+}
+
+void* packet_builder_finish(packet_builder_t* builder, packet_kind_t kind, size_t* qwc)
+{
+	*qwc = offset(builder);
+	void* start = (uint8_t*)builder->buffers[builder->current] - builder->segment;
+
+	if (builder->overflow)
+	{
+		snprintf(builder->error, sizeof(builder->error), "packet exceeds %zu quadwords", builder->capacity);
+		return NULL;
+	}
+
+#ifdef PS2INTRIN_HOST
+	if (!packet_validate(start, *qwc, kind, builder->error, sizeof(builder->error)))
+	{
+		return NULL;
+	}
+#else
+	(void)kind;
+#endif
+
+	return start;
+}
+
+uint64_t* packet_reserve(packet_builder_t* builder, size_t qwc)
+{
+	if (builder->overflow || qwc > (size_t)(builder->end - builder->cursor) / 2)
+	{
+		builder->overflow = true;
+		return NULL;
+	}
+
+	uint64_t* result = builder->cursor;
+	builder->cursor += qwc * 2;
+	return result;
+}
+
+void packet_qword(packet_builder_t* builder, uint64_t lo, uint64_t hi)
+{
+	emit(builder, mm_set_epu64(hi, lo));
+}
+
+void packet_data(packet_builder_t* builder, const void* src, size_t qwc)
+{
+	uint64_t* dst = packet_reserve(builder, qwc);
+	if (!dst)
+	{
+		return;
+	}
+
+	const m128u64* in = (const m128u64*)src;
+	m128u64* out = (m128u64*)dst;
+	for (size_t i = 0; i < qwc; ++i)
+	{
+		mm_store_epu64(out + i, mm_load_epu64(in + i));
+	}
+}
+
+void packet_gif_tag(packet_builder_t* builder, unsigned nloop, bool eop, unsigned flg, unsigned nreg, uint64_t regs)
+{
+	emit(builder, mm_set_epu64(regs, gif_tag(nloop, eop, flg, nreg)));
+}
+
+void packet_gif_tag_prim(packet_builder_t* builder, unsigned nloop, bool eop, unsigned flg, unsigned nreg,
+						 uint64_t regs, unsigned prim)
+{
+	uint64_t tag = gif_tag(nloop, eop, flg, nreg) | ((uint64_t)1 << 46) | ((uint64_t)(prim & 0x7FF) << 47);
+	emit(builder, mm_set_epu64(regs, tag));
+}
+
+void packet_ad(packet_builder_t* builder, unsigned address, uint64_t value)
+{
+	emit(builder, mm_set_epu64(address, value));
+}
+
+size_t packet_gif_ad_open(packet_builder_t* builder, bool eop)
+{
+	// The handle keeps EOP, so closing rewrites the whole tag instead of reading it back, which
+	// would be slow through the uncached accelerated segment.
+	size_t handle = offset(builder) * 2 + eop;
+	packet_gif_tag(builder, 0, eop, GIF_FLG_PACKED, 1, GIF_REG_AD);
+	return handle;
+}
+
+void packet_gif_ad_close(packet_builder_t* builder, size_t handle)
+{
+	size_t tag = handle / 2;
+	if (builder->overflow || tag >= offset(builder))
+	{
+		return;
+	}
+
+	unsigned nloop = (unsigned)(offset(builder) - tag - 1);
+	builder->buffers[builder->current][tag * 2] = gif_tag(nloop, handle & 1, GIF_FLG_PACKED, 1);
+}
+
+void packet_dma_tag(packet_builder_t* builder, unsigned id, unsigned qwc, const void* address)
+{
+	// Physical address, whichever segment the caller's pointer is in
+	uint32_t physical = (uint32_t)((uintptr_t)address & 0x0FFFFFFF);
+	emit(builder, mm_set_epu64(0, dma_tag(id, qwc, physical)));
+}
+
+size_t packet_dma_open(packet_builder_t* builder, unsigned id)
+{
+	size_t handle = offset(builder) * 8 + (id & 7);
+	packet_dma_tag(builder, id, 0, NULL);
+	return handle;
+}
+
+void packet_dma_close(packet_builder_t* builder, size_t handle)
+{
+	size_t tag = handle / 8;
+	if (builder->overflow || tag >= offset(builder))
+	{
+		return;
+	}
+
+	unsigned qwc = (unsigned)(offset(builder) - tag - 1);
+	builder->buffers[builder->current][tag * 2] = dma_tag(handle & 7, qwc, 0);
+}
+
+/// @brief Whether 'address' is a GS register that can be written by A+D, or the A+D NOP (0x7F)
+static bool valid_gs_register(unsigned address)
+{
+	static const uint8_t ranges[][2] = {
+		{ 0x00, 0x0A }, { 0x0C, 0x0D }, { 0x14, 0x1C }, { 0x22, 0x22 }, { 0x34, 0x37 }, { 0x3B, 0x3B },
+		{ 0x3D, 0x3D }, { 0x3F, 0x54 }, { 0x60, 0x62 }, { 0x7F, 0x7F },
+	};
+
+	for (size_t i = 0; i < sizeof(ranges) / sizeof(ranges[0]); ++i)
+	{
+		if (address >= ranges[i][0] && address <= ranges[i][1])
+		{
+			return true;
+		}
+	}
+	return false;
+}
+
+/// State of the GIF walking a stream of quadwords, which may be split over several DMA tags
+typedef struct
+{
+	/// Data quadwords left for the current tag
+	size_t remaining;
+	uint64_t regs;
+	unsigned flg;
+	unsigned nreg;
+	unsigned reg;
+	/// EOP of the last tag
+	bool eop;
+	/// Whether a tag was seen at all
+	bool tagged;
+	char* message;
+	size_t message_size;
+} gif_walker_t;
+
+/// @brief Describe a problem in the walker's message
+/// @return false
+static bool gif_fail(gif_walker_t* walker, const char* format, ...)
+{
+	if (walker->message && walker->message_size)
+	{
+		va_list args;
+		va_start(args, format);
+		vsnprintf(walker->message, walker->message_size, format, args);
+		va_end(args);
+	}
+	return false;
+}
+
+/// @brief Feed one quadword at 'index' in the packet to the walker
+static bool gif_feed(gif_walker_t* walker, const uint64_t* qword, size_t index)
+{
+	if (walker->remaining == 0)
+	{
+		uint64_t tag = qword[0];
+		size_t nloop = tag & 0x7FFF;
+		walker->eop = (tag >> 15) & 1;
+		walker->flg = (tag >> 58) & 3;
+		walker->nreg = (unsigned)(tag >> 60);
+		if (walker->nreg == 0)
+		{
+			walker->nreg = 16;
+		}
+		walker->regs = qword[1];
+		walker->reg = 0;
+		walker->tagged = true;
+
+		switch (walker->flg)
+		{
+		case GIF_FLG_PACKED:
+			walker->remaining = nloop * walker->nreg;
+			break;
+		case GIF_FLG_REGLIST:
+			walker->remaining = (nloop * walker->nreg + 1) / 2;
+			break;
+		default:
+			walker->remaining = nloop;
+			break;
+		}
+		return true;
+	}
+
+	if (walker->flg == GIF_FLG_PACKED)
+	{
+		unsigned descriptor = (unsigned)(walker->regs >> (walker->reg * 4)) & 15;
+		if (descriptor == GIF_REG_AD && !valid_gs_register((unsigned)qword[1] & 0xFF))
+		{
+			return gif_fail(walker, "A+D entry at qword %zu writes unknown GS register 0x%02x", index, (unsigned)qword[1] & 0xFF);
+		}
+		walker->reg = walker->reg + 1 == walker->nreg ? 0 : walker->reg + 1;
+	}
+	--walker->remaining;
+	return true;
+}
+
+/// @brief Check that the walker stopped at the end of a packet with EOP
+static bool gif_finish(gif_walker_t* walker, size_t qwc)
+{
+	if (!walker->tagged)
+	{
+		return gif_fail(walker, "no GIF tag in %zu quadwords", qwc);
+	}
+	if (walker->remaining)
+	{
+		return gif_fail(walker, "last GIF tag is missing %zu of its quadwords", walker->remaining);
+	}
+	if (!walker->eop)
+	{
+		return gif_fail(walker, "last GIF tag does not set EOP");
+	}
+	return true;
+}
+
+bool packet_validate(const void* data, size_t qwc, packet_kind_t kind, char* message, size_t message_size)
+{
+	const uint64_t* q = (const uint64_t*)data;
+	gif_walker_t walker = {};
+	walker.message = message;
+	walker.message_size = message_size;
+	if (message && message_size)
+	{
+		message[0] = '\0';
+	}
+
+	if (kind == PACKET_GIF)
+	{
+		for (size_t i = 0; i < qwc; ++i)
+		{
+			if (!gif_feed(&walker, q + i * 2, i))
+			{
+				return false;
+			}
+		}
+		return gif_finish(&walker, qwc);
+	}
+
+	size_t i = 0;
+	for (;;)
+	{
+		if (i >= qwc)
+		{
+			return gif_fail(&walker, "DMA chain runs past its %zu quadwords without END or REFE", qwc);
+		}
+
+		uint64_t tag = q[i * 2];
+		size_t count = tag & 0xFFFF;
+		unsigned id = (tag >> 28) & 7;
+		size_t at = i++;
+
+		switch (id)
+		{
+		case DMA_TAG_CNT:
+		case DMA_TAG_END:
+			if (count > qwc - i)
+			{
+				return gif_fail(&walker, "DMA tag at qword %zu transfers %zu quadwords past the end", at, count - (qwc - i));
+			}
+			for (size_t k = 0; k < count; ++k, ++i)
+			{
+				if (!gif_feed(&walker, q + i * 2, i))
+				{
+					return false;
+				}
+			}
+			break;
+		case DMA_TAG_REF:
+		case DMA_TAG_REFE:
+			// Referenced data is either the rest of the current GIF tag's data (e.g. an IMAGE
+			// transfer) or whole GIF packets, which are assumed to be well-formed.
+			if (walker.remaining)
+			{
+				if (count > walker.remaining)
+				{
+					return gif_fail(&walker, "DMA tag at qword %zu references %zu quadwords more than the GIF tag takes", at, count - walker.remaining);
+				}
+				walker.remaining -= count;
+			}
+			else if (count)
+			{
+				walker.tagged = true;
+				walker.eop = true;
+			}
+			break;
+		default:
+			return gif_fail(&walker, "DMA tag at qword %zu has ID %u, only CNT, END, REF and REFE are supported", at, id);
+		}
+
+		if (id == DMA_TAG_END || id == DMA_TAG_REFE)
+		{
+			if (i != qwc)
+			{
+				return gif_fail(&walker, "%zu quadwords follow the end of the DMA chain at qword %zu", qwc - i, at);
+			}
+			return gif_finish(&walker, qwc);
+		}
+	}
+}
@@ -0,0 +1,108 @@
+/*
+*	Particle update, see 'particles.h'.
+*/
+
+#include <ps2kernels/particles.h>
+
+#include <ps2intrin.h>
+
+/// Number of streams in 'particle_streams_t'
+#define STREAMS 7
+
+typedef union
+{
+	m128i32 v[STREAMS];
+	int32_t s[STREAMS][4];
+} block_t;
+
+/// @brief 'p + v * dt' for 2 particles in positions 0 and 2 of 'p' and 'v'
+///
+/// PMADDW accumulates onto 'p' in the upper halves of the 64-bit accumulators, so the upper 32
+/// bits of the sum are 'p + (v * dt) >> 16'.
+static inline m128i32 integrate2(lohi_state_t* state, m128i32 p, m128i32 v, m128i64 dt)
+{
+	mm_storelo_epi32(state, mm_setzero_epi32());
+	mm_storehi_epi32(state, p);
+	mm_fma_epi64(state, mm_castepi64_epi32(v), dt);
+	return mm_loadhi_epi32(state);
+}
+
+/// @brief 'p + v * dt' for 4 particles
+static inline m128i32 integrate(lohi_state_t* state, m128i32 p, m128i32 v, m128i64 dt)
+{
+	// PEXTLW/PEXTUW bring particles 0, 1 and 2, 3 to positions 0 and 2.
+	m128i32 lower = integrate2(state, mm_extlo_epi32(p, p), mm_extlo_epi32(v, v), dt);
+	m128i32 upper = integrate2(state, mm_exthi_epi32(p, p), mm_exthi_epi32(v, v), dt);
+	return mm_pack_epi32(lower, upper);
+}
+
+size_t particle_update(particle_streams_t* particles, const int32_t acceleration[3], int32_t dt)
+{
+	int32_t* streams[STREAMS] = {
+		particles->x, particles->y, particles->z,
+		particles->vx, particles->vy, particles->vz,
+		particles->life,
+	};
+	size_t count = particles->count;
+
+	if (dt < 0)
+	{
+		dt = 0;
+	}
+	else if (dt > PARTICLE_MAX_DT)
+	{
+		dt = PARTICLE_MAX_DT;
+	}
+	m128i64 dt_scaled = mm_castepi64_epi32(mm_broadcast_epi32(dt << 16));
+	m128i32 dt_life = mm_broadcast_epi32(dt);
+	m128i32 dv[3];
+	for (size_t c = 0; c < 3; ++c)
+	{
+		dv[c] = mm_broadcast_epi32((int32_t)(((int64_t)acceleration[c] * dt) >> 16));
+	}
+	m128i32 lanes = mm_set_epi32(3, 2, 1, 0);
+	m128i32 zero = mm_setzero_epi32();
+
+	lohi_state_t state;
+	lohi_state_construct(&state);
+
+	size_t live = 0;
+	for (size_t i = 0; i < count; i += 4)
+	{
+		block_t block;
+		for (size_t c = 0; c < 3; ++c)
+		{
+			m128i32 v = mm_add_epi32(mm_load_epi32((const m128i32*)(streams[c + 3] + i)), dv[c]);
+			m128i32 p = mm_load_epi32((const m128i32*)(streams[c] + i));
+			block.v[c] = integrate(&state, p, v, dt_scaled);
+			block.v[c + 3] = v;
+		}
+
+		// Saturating, so no lane can wrap around to a positive life.
+		m128i32 life = mm_subs_epi32(mm_load_epi32((const m128i32*)(streams[6] + i)), dt_life);
+		block.v[6] = life;
+
+		// Alive if life is left and the lane is within 'count'.
+		m128i32 in_range = mm_cmpgt_epi32(mm_broadcast_epi32((int32_t)(count - i)), lanes);
+		union
+		{
+			m128i32 v;
+			int32_t s[4];
+		} alive;
+		alive.v = mm_and_epi32(mm_cmpgt_epi32(life, zero), in_range);
+
+		// Compaction: 'live' never passes 'i + k', so writing in place is safe.
+		for (size_t k = 0; k < 4; ++k)
+		{
+			for (size_t s = 0; s < STREAMS; ++s)
+			{
+				streams[s][live] = block.s[s][k];
+			}
+			live += (size_t)alive.s[k] & 1;
+		}
+	}
+
+	lohi_state_destruct(&state);
+	particles->count = live;
+	return live;
+}
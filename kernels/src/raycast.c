@@ -0,0 +1,327 @@
+/*
+*	Segment casts, see 'raycast.h'.
+*/
+
+#include <ps2kernels/raycast.h>
+
+#include "hits.h"
+
+#include <ps2intrin.h>
+
+typedef union
+{
+	m128i32 v;
+	int32_t s[4];
+} lanes_t;
+
+/// 4 lanes as 2 halves with lanes 0, 1 and 2, 3 in positions 0 and 2, the operands of PMULTW
+typedef struct
+{
+	m128i64 half[2];
+} split_t;
+
+static inline split_t split(m128i32 v)
+{
+	split_t result = { { mm_castepi64_epi32(mm_extlo_epi32(v, v)), mm_castepi64_epi32(mm_exthi_epi32(v, v)) } };
+	return result;
+}
+
+/// 64-bit values of 4 lanes as the low and the high words
+typedef struct
+{
+	m128i32 lo;
+	m128i32 hi;
+} wide_t;
+
+static inline wide_t combine(m128i64 lower, m128i64 upper)
+{
+	// PEXCW turns 'lo0 hi0 lo1 hi1' into 'lo0 lo1 hi0 hi1'.
+	m128i64 a = mm_castepi64_epi32(mm_xchgcenter_epi32(mm_castepi32_epi64(lower)));
+	m128i64 b = mm_castepi64_epi32(mm_xchgcenter_epi32(mm_castepi32_epi64(upper)));
+	wide_t result = { mm_castepi32_epi64(mm_unpacklo_epi64(a, b)), mm_castepi32_epi64(mm_unpackhi_epi64(a, b)) };
+	return result;
+}
+
+static inline int64_t wide_lane(wide_t v, size_t k)
+{
+	lanes_t lo = { v.lo };
+	lanes_t hi = { v.hi };
+	return (int64_t)(((uint64_t)(uint32_t)hi.s[k] << 32) | (uint32_t)lo.s[k]);
+}
+
+/// @brief 'a . b', exact
+static inline wide_t dot(lohi_state_t* state, const split_t a[3], const split_t b[3])
+{
+	m128i64 halves[2];
+	for (size_t h = 0; h < 2; ++h)
+	{
+		mm_mul_epi64(state, a[0].half[h], b[0].half[h]);
+		mm_fma_epi64(state, a[1].half[h], b[1].half[h]);
+		halves[h] = mm_fma_epi64(state, a[2].half[h], b[2].half[h]);
+	}
+	return combine(halves[0], halves[1]);
+}
+
+/// @brief 'a . b - c . d', exact
+static inline wide_t dot_difference(lohi_state_t* state, const split_t a[3], const split_t b[3], const split_t c[3],
+									const split_t d[3])
+{
+	m128i64 halves[2];
+	for (size_t h = 0; h < 2; ++h)
+	{
+		mm_mul_epi64(state, a[0].half[h], b[0].half[h]);
+		mm_fma_epi64(state, a[1].half[h], b[1].half[h]);
+		mm_fma_epi64(state, a[2].half[h], b[2].half[h]);
+		mm_fms_epi64(state, c[0].half[h], d[0].half[h]);
+		mm_fms_epi64(state, c[1].half[h], d[1].half[h]);
+		halves[h] = mm_fms_epi64(state, c[2].half[h], d[2].half[h]);
+	}
+	return combine(halves[0], halves[1]);
+}
+
+/// @brief 'a x b' rounded to Q16.16
+static inline void cross(lohi_state_t* state, split_t result[3], const split_t a[3], const split_t b[3])
+{
+	for (size_t c = 0; c < 3; ++c)
+	{
+		size_t j = (c + 1) % 3;
+		size_t k = (c + 2) % 3;
+		m128i64 halves[2];
+		for (size_t h = 0; h < 2; ++h)
+		{
+			mm_mul_epi64(state, a[j].half[h], b[k].half[h]);
+			halves[h] = mm_fms_epi64(state, a[k].half[h], b[j].half[h]);
+		}
+		wide_t product = combine(halves[0], halves[1]);
+
+		// Bits 16 to 47 of the Q32.32 products
+		m128i32 lo;
+		m128i32 hi;
+		PSRLW(lo, product.lo, 16);
+		PSLLW(hi, product.hi, 16);
+		result[c] = split(mm_or_epi32(lo, hi));
+	}
+}
+
+/// @brief All ones in the lanes where 'v' does not have the sign in 'sign', 0 counting as positive
+static inline m128i32 wrong_sign(wide_t v, m128i32 sign)
+{
+	m128i32 result = mm_xor_epi32(v.hi, sign);
+	PSRAW(result, result, 31);
+	return result;
+}
+
+/// @brief 't / det' in Q16.16 for '0 <= t / det <= 1'
+static inline int32_t parameter(int64_t t, int64_t det)
+{
+	if (det < 0)
+	{
+		t = -t;
+		det = -det;
+	}
+	// Scaled to 15 bits so that 't << 16' fits in 32 bits.
+	int shift = 64 - __builtin_clzll((uint64_t)det) - 15;
+	if (shift > 0)
+	{
+		t >>= shift;
+		det >>= shift;
+	}
+	return (int32_t)(((uint32_t)t << 16) / (uint32_t)det);
+}
+
+size_t ray_triangles(const ray_segment_t* ray, const triangle_streams_t* triangles, size_t count, uint32_t* hits,
+					 int32_t* t)
+{
+	m128i32 origin[3];
+	split_t delta[3];
+	for (size_t c = 0; c < 3; ++c)
+	{
+		origin[c] = mm_broadcast_epi32(ray->origin[c]);
+		delta[c] = split(mm_broadcast_epi32(ray->delta[c]));
+	}
+	m128i32 zero = mm_setzero_epi32();
+
+	lohi_state_t state;
+	lohi_state_construct(&state);
+
+	bit_writer_t writer = { hits, 0, 0 };
+	for (size_t i = 0; i < count; i += 4)
+	{
+		// Moeller-Trumbore with 's = origin - v0': 'origin + t * delta = v0 + u * e1 + v * e2' with
+		// 'u = s . p', 'v = s . r' and 't = s . n', all over 'det = e1 . p', where 'p = delta x e2',
+		// 'r = e1 x delta' and 'n = e1 x e2'. Only the signs are needed to find the hits.
+		split_t e1[3];
+		split_t e2[3];
+		split_t s[3];
+		split_t e1_minus_s[3];
+		for (size_t c = 0; c < 3; ++c)
+		{
+			m128i32 edge = mm_load_epi32((const m128i32*)(triangles->e1[c] + i));
+			m128i32 offset = mm_sub_epi32(origin[c], mm_load_epi32((const m128i32*)(triangles->v0[c] + i)));
+			e1[c] = split(edge);
+			e2[c] = split(mm_load_epi32((const m128i32*)(triangles->e2[c] + i)));
+			s[c] = split(offset);
+			e1_minus_s[c] = split(mm_sub_epi32(edge, offset));
+		}
+
+		split_t p[3];
+		split_t r[3];
+		cross(&state, p, delta, e2);
+		cross(&state, r, e1, delta);
+		wide_t det = dot(&state, e1, p);
+		m128i32 sign;
+		PSRAW(sign, det.hi, 31);
+
+		// 'u >= 0', 'v >= 0' and 'u + v <= 1', scaled by 'det'
+		m128i32 miss = mm_cmpeq_epi32(mm_or_epi32(det.lo, det.hi), zero);
+		miss = mm_or_epi32(miss, wrong_sign(dot(&state, s, p), sign));
+		miss = mm_or_epi32(miss, wrong_sign(dot(&state, s, r), sign));
+		miss = mm_or_epi32(miss, wrong_sign(dot_difference(&state, e1_minus_s, p, s, r), sign));
+		unsigned bits = ~mask4(miss) & valid_lanes(i, count, 4);
+
+		// '0 <= t <= 1' only for groups with a hit left
+		wide_t numerator = { zero, zero };
+		if (bits)
+		{
+			split_t n[3];
+			cross(&state, n, e1, e2);
+			numerator = dot(&state, s, n);
+			miss = mm_or_epi32(wrong_sign(numerator, sign),
+							   wrong_sign(dot_difference(&state, e1, p, s, n), sign));
+			bits &= ~mask4(miss);
+		}
+
+		bit_writer_put(&writer, i, bits, count, 4);
+		if (t)
+		{
+			for (size_t k = 0; k < 4; ++k)
+			{
+				t[i + k] = (bits >> k) & 1 ? parameter(wide_lane(numerator, k), wide_lane(det, k)) : RAY_MISS;
+			}
+		}
+	}
+
+	lohi_state_destruct(&state);
+	return writer.total;
+}
+
+/// @brief Slab test setup for one axis of the segment
+typedef struct
+{
+	/// Bounds of the segment
+	m128i32 lower;
+	m128i32 upper;
+	/// Range the numerators are clamped to
+	m128i32 limit;
+	m128i32 negative_limit;
+	/// Right shift of the numerators and of 'delta'
+	m128u64 shift;
+	/// 'delta' scaled to 14 bits for PDIVBW
+	int16_t divisor;
+} slab_t;
+
+static inline slab_t slab(int32_t origin, int32_t delta)
+{
+	int32_t end = (int32_t)((uint32_t)origin + (uint32_t)delta);
+	uint32_t magnitude = delta < 0 ? 0u - (uint32_t)delta : (uint32_t)delta;
+	int bits = magnitude ? 32 - __builtin_clz(magnitude) : 0;
+	int shift = bits > 14 ? bits - 14 : 0;
+
+	// The numerators are clamped to '2 * |delta| - 1', so the quotients stay in [-2, 2] and the
+	// scaled numerators shifted left by 16 bits fit in 32 bits.
+	uint64_t limit = 2 * (uint64_t)magnitude - 1;
+	if (limit > INT32_MAX)
+	{
+		limit = INT32_MAX;
+	}
+
+	slab_t result = {
+		mm_broadcast_epi32(origin < end ? origin : end),
+		mm_broadcast_epi32(origin < end ? end : origin),
+		mm_broadcast_epi32((int32_t)limit),
+		mm_broadcast_epi32(-(int32_t)limit),
+		mm_set_epu64((uint64_t)shift, (uint64_t)shift),
+		(int16_t)(delta >> shift),
+	};
+	return result;
+}
+
+/// @brief 'bound - origin' prepared as the dividend of PDIVBW, so the quotient is Q16.16
+static inline m128i32 slab_dividend(const slab_t* slab, m128i32 bound, m128i32 origin)
+{
+	m128i32 n = mm_min_epi32(mm_max_epi32(mm_subs_epi32(bound, origin), slab->negative_limit), slab->limit);
+
+	// PSRAVW only shifts positions 0 and 2.
+	split_t halves = split(n);
+	m128i32 result = mm_pack_epi32(mm_castepi32_epi64(mm_srav_epi64(halves.half[0], slab->shift)),
+								   mm_castepi32_epi64(mm_srav_epi64(halves.half[1], slab->shift)));
+	PSLLW(result, result, 16);
+	return result;
+}
+
+size_t ray_aabbs(const ray_segment_t* ray, const aabb32_streams_t* boxes, size_t count, uint32_t* hits, int32_t* t)
+{
+	m128i32 origin[3];
+	slab_t slabs[3];
+	for (size_t axis = 0; axis < 3; ++axis)
+	{
+		origin[axis] = mm_broadcast_epi32(ray->origin[axis]);
+		slabs[axis] = slab(ray->origin[axis], ray->delta[axis]);
+	}
+	m128i32 zero = mm_setzero_epi32();
+	m128i32 one = mm_broadcast_epi32(0x10000);
+
+	lohi_state_t state;
+	lohi_state_construct(&state);
+
+	bit_writer_t writer = { hits, 0, 0 };
+	for (size_t i = 0; i < count; i += 4)
+	{
+		m128i32 min[3];
+		m128i32 max[3];
+		m128i32 miss = zero;
+		for (size_t axis = 0; axis < 3; ++axis)
+		{
+			min[axis] = mm_load_epi32((const m128i32*)(boxes->min[axis] + i));
+			max[axis] = mm_load_epi32((const m128i32*)(boxes->max[axis] + i));
+			miss = mm_or_epi32(miss, mm_cmpgt_epi32(slabs[axis].lower, max[axis]));
+			miss = mm_or_epi32(miss, mm_cmpgt_epi32(min[axis], slabs[axis].upper));
+		}
+		unsigned bits = ~mask4(miss) & valid_lanes(i, count, 4);
+
+		// Boxes missing the bounds of the segment skip the divisions. Axes the segment does not
+		// move along are decided by the bounds alone.
+		lanes_t entry = { zero };
+		m128i32 exit = one;
+		for (size_t axis = 0; bits && axis < 3; ++axis)
+		{
+			const slab_t* s = &slabs[axis];
+			if (s->divisor == 0)
+			{
+				continue;
+			}
+
+			mm_divremb_epi32(&state, slab_dividend(s, min[axis], origin[axis]), s->divisor);
+			m128i32 t0 = mm_loadlo_epi32(&state);
+			mm_divremb_epi32(&state, slab_dividend(s, max[axis], origin[axis]), s->divisor);
+			m128i32 t1 = mm_loadlo_epi32(&state);
+
+			entry.v = mm_max_epi32(entry.v, mm_min_epi32(t0, t1));
+			exit = mm_min_epi32(exit, mm_max_epi32(t0, t1));
+			miss = mm_or_epi32(miss, mm_cmpgt_epi32(entry.v, exit));
+			bits &= ~mask4(miss);
+		}
+
+		bit_writer_put(&writer, i, bits, count, 4);
+		if (t)
+		{
+			for (size_t k = 0; k < 4; ++k)
+			{
+				t[i + k] = (bits >> k) & 1 ? entry.s[k] : RAY_MISS;
+			}
+		}
+	}
+
+	lohi_state_destruct(&state);
+	return writer.total;
+}
@@ -0,0 +1,483 @@
+/*
+*	Multi-buffer SHA-256 and SHA-1, see 'sha.h'.
+*
+*	Message words are gathered from the 4 messages into one quadword per word index, so every
+*	round step is a handful of PADDW, PAND/PXOR/POR and PSLLW/PSRLW rotations on 4 lanes. The
+*	choice and majority functions use 'g ^ (e & (f ^ g))' and '(a & b) ^ (c & (a ^ b))', which
+*	need no complement.
+*
+*	MMI instructions only issue on pipeline 1, while scalar ones pair up on both pipelines, so a
+*	message left alone in the queue finishes with a scalar compression of the same rounds.
+*/
+
+#include <ps2kernels/sha.h>
+
+#include <ps2intrin.h>
+
+#include <string.h>
+
+#define BLOCK_SIZE 64
+#define LANES 4
+
+/// @brief 'result = value' rotated right by 'amount' bits
+#define ROTATE_RIGHT(result, value, amount)															\
+	{																								\
+		m128u32 right_;																				\
+		m128u32 left_;																				\
+		PSRLW(right_, value, amount);																\
+		PSLLW(left_, value, 32 - (amount));															\
+		result = mm_or_epu32(right_, left_);														\
+	}
+
+typedef union
+{
+	m128u32 v[16];
+	uint32_t w[16][LANES];
+} block_t;
+
+typedef union
+{
+	m128u32 v[8];
+	uint32_t w[8][LANES];
+} state_t;
+
+typedef struct
+{
+	const uint32_t* initial;
+	/// Number of state words
+	size_t words;
+	void (*compress)(state_t* state, const block_t* block);
+	/// The same for the 16 words of one block
+	void (*compress_one)(uint32_t* state, const uint32_t* block);
+} algorithm_t;
+
+typedef struct
+{
+	const sha_job_t* job;
+	size_t block;
+	size_t blocks;
+} lane_t;
+
+static const uint32_t sha256_initial[8] = {
+	0x6A09E667, 0xBB67AE85, 0x3C6EF372, 0xA54FF53A, 0x510E527F, 0x9B05688C, 0x1F83D9AB, 0x5BE0CD19,
+};
+
+static const uint32_t sha256_constants[64] = {
+	0x428A2F98, 0x71374491, 0xB5C0FBCF, 0xE9B5DBA5, 0x3956C25B, 0x59F111F1, 0x923F82A4, 0xAB1C5ED5,
+	0xD807AA98, 0x12835B01, 0x243185BE, 0x550C7DC3, 0x72BE5D74, 0x80DEB1FE, 0x9BDC06A7, 0xC19BF174,
+	0xE49B69C1, 0xEFBE4786, 0x0FC19DC6, 0x240CA1CC, 0x2DE92C6F, 0x4A7484AA, 0x5CB0A9DC, 0x76F988DA,
+	0x983E5152, 0xA831C66D, 0xB00327C8, 0xBF597FC7, 0xC6E00BF3, 0xD5A79147, 0x06CA6351, 0x14292967,
+	0x27B70A85, 0x2E1B2138, 0x4D2C6DFC, 0x53380D13, 0x650A7354, 0x766A0ABB, 0x81C2C92E, 0x92722C85,
+	0xA2BFE8A1, 0xA81A664B, 0xC24B8B70, 0xC76C51A3, 0xD192E819, 0xD6990624, 0xF40E3585, 0x106AA070,
+	0x19A4C116, 0x1E376C08, 0x2748774C, 0x34B0BCB5, 0x391C0CB3, 0x4ED8AA4A, 0x5B9CCA4F, 0x682E6FF3,
+	0x748F82EE, 0x78A5636F, 0x84C87814, 0x8CC70208, 0x90BEFFFA, 0xA4506CEB, 0xBEF9A3F7, 0xC67178F2,
+};
+
+static const uint32_t sha1_initial[5] = {
+	0x67452301, 0xEFCDAB89, 0x98BADCFE, 0x10325476, 0xC3D2E1F0,
+};
+
+static inline m128u32 choice(m128u32 e, m128u32 f, m128u32 g)
+{
+	return mm_xor_epu32(g, mm_and_epu32(e, mm_xor_epu32(f, g)));
+}
+
+static inline m128u32 majority(m128u32 a, m128u32 b, m128u32 c)
+{
+	return mm_xor_epu32(mm_and_epu32(a, b), mm_and_epu32(c, mm_xor_epu32(a, b)));
+}
+
+static inline uint32_t rotate_right(uint32_t value, unsigned amount)
+{
+	return value >> amount | value << (32 - amount);
+}
+
+static void sha256_compress(state_t* state, const block_t* block)
+{
+	m128u32 w[16];
+	m128u32 s[8];
+	memcpy(w, block->v, sizeof(w));
+	memcpy(s, state->v, sizeof(s));
+
+	for (int t = 0; t < 64; ++t)
+	{
+		if (t >= 16)
+		{
+			// w[t] = sigma1(w[t - 2]) + w[t - 7] + sigma0(w[t - 15]) + w[t - 16]
+			m128u32 w2 = w[(t - 2) & 15];
+			m128u32 w15 = w[(t - 15) & 15];
+			m128u32 a;
+			m128u32 b;
+			m128u32 c;
+			ROTATE_RIGHT(a, w2, 17);
+			ROTATE_RIGHT(b, w2, 19);
+			PSRLW(c, w2, 10);
+			m128u32 sigma1 = mm_xor_epu32(mm_xor_epu32(a, b), c);
+			ROTATE_RIGHT(a, w15, 7);
+			ROTATE_RIGHT(b, w15, 18);
+			PSRLW(c, w15, 3);
+			m128u32 sigma0 = mm_xor_epu32(mm_xor_epu32(a, b), c);
+			w[t & 15] = mm_add_epu32(mm_add_epu32(w[t & 15], sigma0), mm_add_epu32(w[(t - 7) & 15], sigma1));
+		}
+
+		m128u32 a;
+		m128u32 b;
+		m128u32 c;
+		ROTATE_RIGHT(a, s[4], 6);
+		ROTATE_RIGHT(b, s[4], 11);
+		ROTATE_RIGHT(c, s[4], 25);
+		m128u32 sum1 = mm_xor_epu32(mm_xor_epu32(a, b), c);
+		m128u32 t1 = mm_add_epu32(mm_add_epu32(s[7], sum1), choice(s[4], s[5], s[6]));
+		t1 = mm_add_epu32(t1, mm_add_epu32(mm_broadcast_epu32(sha256_constants[t]), w[t & 15]));
+
+		ROTATE_RIGHT(a, s[0], 2);
+		ROTATE_RIGHT(b, s[0], 13);
+		ROTATE_RIGHT(c, s[0], 22);
+		m128u32 sum0 = mm_xor_epu32(mm_xor_epu32(a, b), c);
+		m128u32 t2 = mm_add_epu32(sum0, majority(s[0], s[1], s[2]));
+
+		s[7] = s[6];
+		s[6] = s[5];
+		s[5] = s[4];
+		s[4] = mm_add_epu32(s[3], t1);
+		s[3] = s[2];
+		s[2] = s[1];
+		s[1] = s[0];
+		s[0] = mm_add_epu32(t1, t2);
+	}
+
+	for (int k = 0; k < 8; ++k)
+	{
+		state->v[k] = mm_add_epu32(state->v[k], s[k]);
+	}
+}
+
+static void sha256_compress_one(uint32_t* state, const uint32_t* block)
+{
+	uint32_t w[16];
+	uint32_t s[8];
+	memcpy(w, block, sizeof(w));
+	memcpy(s, state, sizeof(s));
+
+	for (int t = 0; t < 64; ++t)
+	{
+		if (t >= 16)
+		{
+			uint32_t w2 = w[(t - 2) & 15];
+			uint32_t w15 = w[(t - 15) & 15];
+			uint32_t sigma1 = rotate_right(w2, 17) ^ rotate_right(w2, 19) ^ (w2 >> 10);
+			uint32_t sigma0 = rotate_right(w15, 7) ^ rotate_right(w15, 18) ^ (w15 >> 3);
+			w[t & 15] += sigma0 + w[(t - 7) & 15] + sigma1;
+		}
+
+		uint32_t sum1 = rotate_right(s[4], 6) ^ rotate_right(s[4], 11) ^ rotate_right(s[4], 25);
+		uint32_t t1 = s[7] + sum1 + (s[6] ^ (s[4] & (s[5] ^ s[6]))) + sha256_constants[t] + w[t & 15];
+		uint32_t sum0 = rotate_right(s[0], 2) ^ rotate_right(s[0], 13) ^ rotate_right(s[0], 22);
+		uint32_t t2 = sum0 + ((s[0] & s[1]) ^ (s[2] & (s[0] ^ s[1])));
+
+		s[7] = s[6];
+		s[6] = s[5];
+		s[5] = s[4];
+		s[4] = s[3] + t1;
+		s[3] = s[2];
+		s[2] = s[1];
+		s[1] = s[0];
+		s[0] = t1 + t2;
+	}
+
+	for (int k = 0; k < 8; ++k)
+	{
+		state[k] += s[k];
+	}
+}
+
+static void sha1_compress(state_t* state, const block_t* block)
+{
+	m128u32 w[16];
+	m128u32 s[5];
+	memcpy(w, block->v, sizeof(w));
+	memcpy(s, state->v, sizeof(s));
+
+	for (int t = 0; t < 80; ++t)
+	{
+		if (t >= 16)
+		{
+			m128u32 x = mm_xor_epu32(mm_xor_epu32(w[(t - 3) & 15], w[(t - 8) & 15]),
+									 mm_xor_epu32(w[(t - 14) & 15], w[t & 15]));
+			ROTATE_RIGHT(w[t & 15], x, 31);
+		}
+
+		m128u32 f;
+		uint32_t k;
+		if (t < 20)
+		{
+			f = choice(s[1], s[2], s[3]);
+			k = 0x5A827999;
+		}
+		else if (t < 40)
+		{
+			f = mm_xor_epu32(mm_xor_epu32(s[1], s[2]), s[3]);
+			k = 0x6ED9EBA1;
+		}
+		else if (t < 60)
+		{
+			f = majority(s[1], s[2], s[3]);
+			k = 0x8F1BBCDC;
+		}
+		else
+		{
+			f = mm_xor_epu32(mm_xor_epu32(s[1], s[2]), s[3]);
+			k = 0xCA62C1D6;
+		}
+
+		m128u32 a5;
+		ROTATE_RIGHT(a5, s[0], 27);
+		m128u32 temp = mm_add_epu32(mm_add_epu32(a5, f), mm_add_epu32(s[4], w[t & 15]));
+		temp = mm_add_epu32(temp, mm_broadcast_epu32(k));
+
+		s[4] = s[3];
+		s[3] = s[2];
+		ROTATE_RIGHT(s[2], s[1], 2);
+		s[1] = s[0];
+		s[0] = temp;
+	}
+
+	for (int k = 0; k < 5; ++k)
+	{
+		state->v[k] = mm_add_epu32(state->v[k], s[k]);
+	}
+}
+
+static void sha1_compress_one(uint32_t* state, const uint32_t* block)
+{
+	uint32_t w[16];
+	uint32_t s[5];
+	memcpy(w, block, sizeof(w));
+	memcpy(s, state, sizeof(s));
+
+	for (int t = 0; t < 80; ++t)
+	{
+		if (t >= 16)
+		{
+			w[t & 15] = rotate_right(w[(t - 3) & 15] ^ w[(t - 8) & 15] ^ w[(t - 14) & 15] ^ w[t & 15], 31);
+		}
+
+		uint32_t f;
+		uint32_t k;
+		if (t < 20)
+		{
+			f = s[3] ^ (s[1] & (s[2] ^ s[3]));
+			k = 0x5A827999;
+		}
+		else if (t < 40)
+		{
+			f = s[1] ^ s[2] ^ s[3];
+			k = 0x6ED9EBA1;
+		}
+		else if (t < 60)
+		{
+			f = (s[1] & s[2]) ^ (s[3] & (s[1] ^ s[2]));
+			k = 0x8F1BBCDC;
+		}
+		else
+		{
+			f = s[1] ^ s[2] ^ s[3];
+			k = 0xCA62C1D6;
+		}
+
+		uint32_t temp = rotate_right(s[0], 27) + f + s[4] + w[t & 15] + k;
+		s[4] = s[3];
+		s[3] = s[2];
+		s[2] = rotate_right(s[1], 2);
+		s[1] = s[0];
+		s[0] = temp;
+	}
+
+	for (int k = 0; k < 5; ++k)
+	{
+		state[k] += s[k];
+	}
+}
+
+static const algorithm_t sha256_algorithm = { sha256_initial, 8, sha256_compress, sha256_compress_one };
+static const algorithm_t sha1_algorithm = { sha1_initial, 5, sha1_compress, sha1_compress_one };
+
+static inline uint32_t load_big_endian(const uint8_t* p)
+{
+	return (uint32_t)p[0] << 24 | (uint32_t)p[1] << 16 | (uint32_t)p[2] << 8 | (uint32_t)p[3];
+}
+
+/// @brief Read the next block of the message of a lane into 'words', with the padding at the end
+static void load_block(const lane_t* lane, uint32_t words[16])
+{
+	const sha_job_t* job = lane->job;
+	size_t offset = lane->block * BLOCK_SIZE;
+	uint8_t padded_block[BLOCK_SIZE];
+	const uint8_t* bytes = padded_block;
+
+	if (offset + BLOCK_SIZE <= job->length)
+	{
+		bytes = job->data + offset;
+	}
+	else
+	{
+		// 0x80 after the message, then zeros and the length in bits at the end of the last block
+		memset(padded_block, 0, sizeof(padded_block));
+		if (offset <= job->length)
+		{
+			size_t rest = job->length - offset;
+			if (rest > 0)
+			{
+				memcpy(padded_block, job->data + offset, rest);
+			}
+			padded_block[rest] = 0x80;
+		}
+		if (lane->block + 1 == lane->blocks)
+		{
+			uint64_t bits = (uint64_t)job->length * 8;
+			for (int k = 0; k < 8; ++k)
+			{
+				padded_block[BLOCK_SIZE - 1 - k] = (uint8_t)(bits >> (8 * k));
+			}
+		}
+	}
+
+	for (int t = 0; t < 16; ++t)
+	{
+		words[t] = load_big_endian(bytes + 4 * t);
+	}
+}
+
+/// @brief Put the next block of the message of a lane into its column of 'block'
+static void gather(const lane_t* lane, block_t* block, size_t l)
+{
+	uint32_t words[16];
+	load_block(lane, words);
+	for (int t = 0; t < 16; ++t)
+	{
+		block->w[t][l] = words[t];
+	}
+}
+
+static void store_digest(const algorithm_t* algorithm, uint8_t* digest, const uint32_t* state)
+{
+	for (size_t k = 0; k < algorithm->words; ++k)
+	{
+		digest[4 * k] = (uint8_t)(state[k] >> 24);
+		digest[4 * k + 1] = (uint8_t)(state[k] >> 16);
+		digest[4 * k + 2] = (uint8_t)(state[k] >> 8);
+		digest[4 * k + 3] = (uint8_t)state[k];
+	}
+}
+
+/// @brief Hash the rest of the message of a lane on scalar registers
+static void finish_one(const algorithm_t* algorithm, lane_t* lane, uint32_t* state)
+{
+	for (; lane->block < lane->blocks; ++lane->block)
+	{
+		uint32_t words[16];
+		load_block(lane, words);
+		algorithm->compress_one(state, words);
+	}
+	store_digest(algorithm, lane->job->digest, state);
+}
+
+/// @brief Give a lane the next job, or leave it idle
+static void start(const algorithm_t* algorithm, lane_t* lane, state_t* state, size_t l, const sha_job_t* job)
+{
+	lane->job = job;
+	lane->block = 0;
+	// 1 byte of padding and 8 bytes of length
+	lane->blocks = job != NULL ? (job->length + 9 + BLOCK_SIZE - 1) / BLOCK_SIZE : 0;
+	for (size_t k = 0; k < algorithm->words; ++k)
+	{
+		state->w[k][l] = algorithm->initial[k];
+	}
+}
+
+static void run(const algorithm_t* algorithm, const sha_job_t* jobs, size_t count)
+{
+	state_t state;
+	// Idle lanes hash whatever their column was left with, their state is never read.
+	block_t block = {};
+	lane_t lanes[LANES];
+	size_t next = 0;
+	size_t active = 0;
+
+	for (size_t l = 0; l < LANES; ++l)
+	{
+		start(algorithm, &lanes[l], &state, l, next < count ? &jobs[next++] : NULL);
+		active += lanes[l].job != NULL;
+	}
+
+	while (active > 0)
+	{
+		// Lanes only go idle once the queue is empty, the last message finishes alone.
+		if (active == 1)
+		{
+			for (size_t l = 0; l < LANES; ++l)
+			{
+				if (lanes[l].job != NULL)
+				{
+					uint32_t words[8];
+					for (size_t k = 0; k < algorithm->words; ++k)
+					{
+						words[k] = state.w[k][l];
+					}
+					finish_one(algorithm, &lanes[l], words);
+				}
+			}
+			break;
+		}
+
+		for (size_t l = 0; l < LANES; ++l)
+		{
+			if (lanes[l].job != NULL)
+			{
+				gather(&lanes[l], &block, l);
+			}
+		}
+
+		algorithm->compress(&state, &block);
+
+		for (size_t l = 0; l < LANES; ++l)
+		{
+			lane_t* lane = &lanes[l];
+			if (lane->job == NULL || ++lane->block < lane->blocks)
+			{
+				continue;
+			}
+
+			uint32_t words[8];
+			for (size_t k = 0; k < algorithm->words; ++k)
+			{
+				words[k] = state.w[k][l];
+			}
+			store_digest(algorithm, lane->job->digest, words);
+			start(algorithm, lane, &state, l, next < count ? &jobs[next++] : NULL);
+			active -= lane->job == NULL;
+		}
+	}
+}
+
+void sha256_multi(const sha_job_t* jobs, size_t count)
+{
+	run(&sha256_algorithm, jobs, count);
+}
+
+void sha1_multi(const sha_job_t* jobs, size_t count)
+{
+	run(&sha1_algorithm, jobs, count);
+}
+
+void sha256(const uint8_t* data, size_t length, uint8_t digest[SHA256_DIGEST_SIZE])
+{
+	sha_job_t job = { data, length, digest };
+	sha256_multi(&job, 1);
+}
+
+void sha1(const uint8_t* data, size_t length, uint8_t digest[SHA1_DIGEST_SIZE])
+{
+	sha_job_t job = { data, length, digest };
+	sha1_multi(&job, 1);
+}
@@ -0,0 +1,202 @@
+/*
+*	Skinning kernel, see 'skinning.h'.
+*/
+
+#include <ps2kernels/skinning.h>
+
+#include <ps2intrin.h>
+
+#include <stdbool.h>
+#include <string.h>
+
+/// @brief Blend one quadword of the bone matrices of a vertex
+///
+/// PMADDH leaves the products of even positions in the result and those of odd positions in
+/// LO/HI, so the blended elements come out in the order 0 2 4 6 1 3 5 7. The sums are rounded
+/// to nearest before the Q1.15 weights are shifted out.
+static inline m128i16 blend(lohi_state_t* state, const skin_matrix_t* palette, const uint8_t* bones,
+							const m128i16* weights, unsigned influences, size_t row)
+{
+	const m128i16* rows = (const m128i16*)palette[bones[0]].rows[row];
+	m128i32 even = mm_mul_epi16(state, mm_load_epi16(rows), weights[0]);
+	for (unsigned k = 1; k < influences; ++k)
+	{
+		rows = (const m128i16*)palette[bones[k]].rows[row];
+		even = mm_fma_epi16(state, mm_load_epi16(rows), weights[k]);
+	}
+	m128i32 odd = mm_loadlohi_upper_epi32(state);
+
+	m128i32 half = mm_broadcast_epi32(1 << 14);
+	even = mm_add_epi32(even, half);
+	odd = mm_add_epi32(odd, half);
+	PSRAW(even, even, 15);
+	PSRAW(odd, odd, 15);
+	return mm_pack_epi16(mm_castepi16_epi32(even), mm_castepi16_epi32(odd));
+}
+
+/// @brief Apply the blended matrix to 'v', laid out as 'x z x z y w y w'
+/// @return The transformed x, y and z in positions 0 to 2
+static inline m128i32 transform(lohi_state_t* state, m128i16 rows01, m128i16 row2, m128i16 v)
+{
+	// rows01 is 'm00 m02 m10 m12 m01 m03 m11 m13', row2 is 'm20 m22 - - m21 m23 - -'.
+	m128i64 sums01 = mm_castepi64_epi32(mm_hmuladd_epi16(state, rows01, v));
+	m128i64 sums2 = mm_castepi64_epi32(mm_hmuladd_epi16(state, row2, v));
+	m128i32 result = mm_add_epi32(mm_castepi32_epi64(mm_unpacklo_epi64(sums01, sums2)),
+								  mm_castepi32_epi64(mm_unpackhi_epi64(sums01, sums2)));
+	result = mm_add_epi32(result, mm_broadcast_epi32(1 << (SKIN_MATRIX_SHIFT - 1)));
+	PSRAW(result, result, SKIN_MATRIX_SHIFT);
+	return result;
+}
+
+/// @brief Lay out 8 vectors as 'x z x z y w y w' each
+static inline void spread(m128i16 out[8], m128i16 x, m128i16 y, m128i16 z, m128i16 w)
+{
+	m128i32 xz[2] = { mm_castepi32_epi16(mm_extlo_epi16(x, z)), mm_castepi32_epi16(mm_exthi_epi16(x, z)) };
+	m128i32 yw[2] = { mm_castepi32_epi16(mm_extlo_epi16(y, w)), mm_castepi32_epi16(mm_exthi_epi16(y, w)) };
+
+	for (size_t k = 0; k < 2; ++k)
+	{
+		m128i32 pair0 = mm_extlo_epi32(xz[k], yw[k]);		// xz0 yw0 xz1 yw1
+		m128i32 pair1 = mm_exthi_epi32(xz[k], yw[k]);		// xz2 yw2 xz3 yw3
+		out[k * 4 + 0] = mm_castepi16_epi32(mm_extlo_epi32(pair0, pair0));
+		out[k * 4 + 1] = mm_castepi16_epi32(mm_exthi_epi32(pair0, pair0));
+		out[k * 4 + 2] = mm_castepi16_epi32(mm_extlo_epi32(pair1, pair1));
+		out[k * 4 + 3] = mm_castepi16_epi32(mm_exthi_epi32(pair1, pair1));
+	}
+}
+
+/// @brief Store 8 transformed vectors to SoA streams
+static inline void gather(const m128i32 v[8], int16_t* x, int16_t* y, int16_t* z)
+{
+	// Pairs of vectors as 'x0 y0 z0 - x1 y1 z1 -', then a transpose.
+	m128i16 v01 = mm_pack_epi16(mm_castepi16_epi32(v[0]), mm_castepi16_epi32(v[1]));
+	m128i16 v23 = mm_pack_epi16(mm_castepi16_epi32(v[2]), mm_castepi16_epi32(v[3]));
+	m128i16 v45 = mm_pack_epi16(mm_castepi16_epi32(v[4]), mm_castepi16_epi32(v[5]));
+	m128i16 v67 = mm_pack_epi16(mm_castepi16_epi32(v[6]), mm_castepi16_epi32(v[7]));
+
+	m128i16 a = mm_extlo_epi16(v01, v23);		// x0 x2 y0 y2 z0 z2 - -
+	m128i16 b = mm_exthi_epi16(v01, v23);		// x1 x3 y1 y3 z1 z3 - -
+	m128i16 c = mm_extlo_epi16(v45, v67);
+	m128i16 d = mm_exthi_epi16(v45, v67);
+
+	m128i64 xy_lo = mm_castepi64_epi16(mm_extlo_epi16(a, b));		// x0-x3 y0-y3
+	m128i64 z_lo = mm_castepi64_epi16(mm_exthi_epi16(a, b));		// z0-z3
+	m128i64 xy_hi = mm_castepi64_epi16(mm_extlo_epi16(c, d));
+	m128i64 z_hi = mm_castepi64_epi16(mm_exthi_epi16(c, d));
+
+	mm_store_epi64((m128i64*)x, mm_unpacklo_epi64(xy_lo, xy_hi));
+	mm_store_epi64((m128i64*)y, mm_unpackhi_epi64(xy_lo, xy_hi));
+	mm_store_epi64((m128i64*)z, mm_unpacklo_epi64(z_lo, z_hi));
+}
+
+/// @brief Skin vertices 'i' to 'i + 7'
+static void skin8(lohi_state_t* state, const skin_matrix_t* palette, const skin_input_t* in,
+				  const skin_output_t* out, size_t i)
+{
+	bool normals = in->nx != NULL;
+	m128i16 positions[8];
+	m128i16 directions[8];
+	spread(positions,
+		   mm_load_epi16((const m128i16*)(in->x + i)),
+		   mm_load_epi16((const m128i16*)(in->y + i)),
+		   mm_load_epi16((const m128i16*)(in->z + i)),
+		   mm_broadcast_epi16(1 << SKIN_MATRIX_SHIFT));
+	if (normals)
+	{
+		spread(directions,
+			   mm_load_epi16((const m128i16*)(in->nx + i)),
+			   mm_load_epi16((const m128i16*)(in->ny + i)),
+			   mm_load_epi16((const m128i16*)(in->nz + i)),
+			   mm_setzero_epi16());
+	}
+
+	m128i32 transformed[8];
+	m128i32 rotated[8];
+	for (size_t k = 0; k < 8; ++k)
+	{
+		const uint8_t* bones = in->bones + (i + k) * 4;
+		const int16_t* w = in->weights + (i + k) * 4;
+		m128i16 weights[4];
+		for (unsigned b = 0; b < in->influences; ++b)
+		{
+			weights[b] = mm_broadcast_epi16(w[b]);
+		}
+
+		m128i16 rows01 = blend(state, palette, bones, weights, in->influences, 0);
+		m128i16 row2 = blend(state, palette, bones, weights, in->influences, 2);
+		transformed[k] = transform(state, rows01, row2, positions[k]);
+		if (normals)
+		{
+			rotated[k] = transform(state, rows01, row2, directions[k]);
+		}
+	}
+
+	gather(transformed, out->x + i, out->y + i, out->z + i);
+	if (normals)
+	{
+		gather(rotated, out->nx + i, out->ny + i, out->nz + i);
+	}
+}
+
+skin_matrix_t* skin_stage_palette(void* scratch, const skin_matrix_t* palette, size_t count)
+{
+	const m128i16* in = (const m128i16*)palette;
+	m128i16* out = (m128i16*)scratch;
+	for (size_t i = 0; i < count * 2; ++i)
+	{
+		mm_store_epi16(out + i, mm_load_epi16(in + i));
+	}
+	return (skin_matrix_t*)scratch;
+}
+
+void skin_vertices(const skin_matrix_t* palette, const skin_input_t* input, const skin_output_t* output, size_t count)
+{
+	lohi_state_t state;
+	lohi_state_construct(&state);
+
+	size_t i = 0;
+	for (; i + 8 <= count; i += 8)
+	{
+		skin8(&state, palette, input, output, i);
+	}
+
+	if (i < count)
+	{
+		// Skin the remaining vertices from zero-padded copies. Padding uses bone 0 with weight 0.
+		size_t rest = count - i;
+		m128i16 streams[6] = {};
+		m128i16 results[6];
+		uint8_t bones[32] = {};
+		int16_t weights[32] = {};
+		const int16_t* sources[6] = { input->x, input->y, input->z, input->nx, input->ny, input->nz };
+		for (size_t s = 0; s < 6; ++s)
+		{
+			if (sources[s])
+			{
+				memcpy(&streams[s], sources[s] + i, rest * sizeof(int16_t));
+			}
+		}
+		memcpy(bones, input->bones + i * 4, rest * 4);
+		memcpy(weights, input->weights + i * 4, rest * 4 * sizeof(int16_t));
+
+		bool normals = input->nx != NULL;
+		skin_input_t padded = {
+			(const int16_t*)&streams[0], (const int16_t*)&streams[1], (const int16_t*)&streams[2],
+			normals ? (const int16_t*)&streams[3] : NULL, (const int16_t*)&streams[4], (const int16_t*)&streams[5],
+			bones, weights, input->influences,
+		};
+		skin_output_t padded_output = {
+			(int16_t*)&results[0], (int16_t*)&results[1], (int16_t*)&results[2],
+			(int16_t*)&results[3], (int16_t*)&results[4], (int16_t*)&results[5],
+		};
+		skin8(&state, palette, &padded, &padded_output, 0);
+
+		int16_t* targets[6] = { output->x, output->y, output->z, output->nx, output->ny, output->nz };
+		for (size_t s = 0; s < (normals ? 6u : 3u); ++s)
+		{
+			memcpy(targets[s] + i, &results[s], rest * sizeof(int16_t));
+		}
+	}
+
+	lohi_state_destruct(&state);
+}
@@ -0,0 +1,174 @@
+/*
+*	Snapshot deltas, see 'snapshot.h'.
+*
+*	A quadword is unchanged when PCEQW of its XOR with zero sets all 4 words. The encoder first
+*	writes the runs, ORing the XORs of 4 quadwords to test them with one compare, then reads its
+*	runs back to append the changed quadwords.
+*/
+
+#include <ps2kernels/snapshot.h>
+
+#include <ps2intrin.h>
+
+#include <stdbool.h>
+#include <string.h>
+
+/// Quadwords tested with one compare while in an unchanged run
+#define GROUP 4
+
+typedef union
+{
+	m128u128 v;
+	uint8_t b[16];
+	uint64_t d[2];
+} quadword_t;
+
+static inline bool is_zero(m128u128 v)
+{
+	m128i32 equal = mm_cmpeq_epi32(mm_castepi32_epu128(v), mm_setzero_epi32());
+	quadword_t mask = { .v = mm_castepu128_epi32(equal) };
+	return (mask.d[0] & mask.d[1]) == UINT64_MAX;
+}
+
+static inline m128u128 difference(const m128u128* current, const m128u128* baseline, size_t q)
+{
+	return mm_xor_epu128(mm_load_epu128(current + q), mm_load_epu128(baseline + q));
+}
+
+static inline uint8_t* write_varint(uint8_t* output, size_t value)
+{
+	while (value >= 0x80)
+	{
+		*output++ = (uint8_t)(value | 0x80);
+		value >>= 7;
+	}
+	*output++ = (uint8_t)value;
+	return output;
+}
+
+/// @brief Read a run length of at most 5 bytes
+/// @return False if the input ends first or the value is too long
+static inline bool read_varint(const uint8_t* input, size_t length, size_t* i, size_t* value)
+{
+	*value = 0;
+	for (unsigned shift = 0; shift < 35; shift += 7)
+	{
+		if (*i >= length)
+		{
+			return false;
+		}
+		uint8_t byte = input[(*i)++];
+		*value |= (size_t)(byte & 0x7F) << shift;
+		if (byte < 0x80)
+		{
+			return true;
+		}
+	}
+	return false;
+}
+
+size_t snapshot_delta_encode(const void* current, const void* baseline, size_t quadwords, uint8_t* output)
+{
+	const m128u128* now = (const m128u128*)current;
+	const m128u128* base = (const m128u128*)baseline;
+	if (quadwords == 0)
+	{
+		return 0;
+	}
+
+	uint8_t* cursor = output;
+	bool changed_run = false;
+	size_t run = 0;
+	for (size_t q = 0; q < quadwords;)
+	{
+		if (!changed_run && q + GROUP <= quadwords)
+		{
+			m128u128 any = mm_or_epu128(mm_or_epu128(difference(now, base, q), difference(now, base, q + 1)),
+										mm_or_epu128(difference(now, base, q + 2), difference(now, base, q + 3)));
+			if (is_zero(any))
+			{
+				run += GROUP;
+				q += GROUP;
+				continue;
+			}
+		}
+
+		bool changed = !is_zero(difference(now, base, q));
+		if (changed != changed_run)
+		{
+			cursor = write_varint(cursor, run);
+			run = 0;
+			changed_run = changed;
+		}
+		++run;
+		++q;
+	}
+	cursor = write_varint(cursor, run);
+
+	// The runs end where the quadwords start.
+	size_t i = 0;
+	size_t runs_length = (size_t)(cursor - output);
+	changed_run = false;
+	for (size_t q = 0; q < quadwords; changed_run = !changed_run)
+	{
+		read_varint(output, runs_length, &i, &run);
+		for (size_t k = q; changed_run && k < q + run; ++k)
+		{
+			quadword_t value = { .v = difference(now, base, k) };
+			memcpy(cursor, value.b, 16);
+			cursor += 16;
+		}
+		q += run;
+	}
+	return (size_t)(cursor - output);
+}
+
+size_t snapshot_delta_decode(const uint8_t* input, size_t length, const void* baseline, void* current,
+							 size_t quadwords)
+{
+	const m128u128* base = (const m128u128*)baseline;
+	m128u128* now = (m128u128*)current;
+
+	// Check the runs before writing anything.
+	size_t i = 0;
+	size_t changed = 0;
+	size_t run;
+	bool changed_run = false;
+	for (size_t q = 0; q < quadwords; q += run, changed_run = !changed_run)
+	{
+		if (!read_varint(input, length, &i, &run) || run > quadwords - q)
+		{
+			return SNAPSHOT_DELTA_ERROR;
+		}
+		changed += changed_run ? run : 0;
+	}
+	if (changed > (length - i) / 16)
+	{
+		return SNAPSHOT_DELTA_ERROR;
+	}
+
+	const uint8_t* payload = input + i;
+	size_t runs_length = i;
+	i = 0;
+	changed_run = false;
+	for (size_t q = 0; q < quadwords; changed_run = !changed_run)
+	{
+		read_varint(input, runs_length, &i, &run);
+		for (size_t k = q; k < q + run; ++k)
+		{
+			if (changed_run)
+			{
+				quadword_t delta;
+				memcpy(delta.b, payload, 16);
+				payload += 16;
+				mm_store_epu128(now + k, mm_xor_epu128(mm_load_epu128(base + k), delta.v));
+			}
+			else if (now != base)
+			{
+				mm_store_epu128(now + k, mm_load_epu128(base + k));
+			}
+		}
+		q += run;
+	}
+	return runs_length + 16 * changed;
+}
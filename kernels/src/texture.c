@@ -0,0 +1,99 @@
+/*
+*	Texture conversion kernels, see 'texture.h'.
+*/
+
+#include <ps2kernels/texture.h>
+
+#include <ps2intrin.h>
+
+#include <string.h>
+
+/// @brief Swap the 32-bit halves of both 64-bit values
+static inline m128u8 swap_words(m128u8 v)
+{
+	m128u32 center = mm_xchgcenter_epu32(mm_castepu32_epu8(v));		// w0 w2 w1 w3
+	m128u64 odd = mm_unpackhi_epu64(mm_castepu64_epu32(center), mm_castepu64_epu32(center));
+	return mm_castepu8_epu32(mm_extlo_epu32(mm_castepu32_epu64(odd), center));
+}
+
+/// @brief Write one PSMCT32 row of a block from two PSMT8 rows
+///
+/// Byte 'k' of 'first' and 'second' end up in bytes 0 and 1 of the 32-bit pixel 'k % 8', bytes
+/// 8-15 in bytes 2 and 3.
+static inline void swizzle_row(uint8_t* dst, m128u8 first, m128u8 second)
+{
+	m128u16 low = mm_castepu16_epu8(mm_extlo_epu8(first, second));
+	m128u16 high = mm_castepu16_epu8(mm_exthi_epu8(first, second));
+	mm_store_epu16((m128u16*)dst, mm_extlo_epu16(low, high));
+	mm_store_epu16((m128u16*)(dst + 16), mm_exthi_epu16(low, high));
+}
+
+void texture_swizzle8(void* dst, const void* src, size_t width, size_t height)
+{
+	const uint8_t* in = (const uint8_t*)src;
+	uint8_t* out = (uint8_t*)dst;
+	size_t dst_stride = width * 2;
+
+	for (size_t y = 0; y < height; y += 16)
+	{
+		for (size_t x = 0; x < width; x += 16)
+		{
+			const uint8_t* block_in = in + y * width + x;
+			uint8_t* block_out = out + y * width + x * 2;
+
+			// A column of 16x4 indices becomes two rows of 8 pixels. Rows 0/1 and 2/3 of the column
+			// are paired up, with the 32-bit halves of one row of each pair swapped, alternating
+			// between columns.
+			for (size_t column = 0; column < 4; ++column)
+			{
+				const uint8_t* rows = block_in + column * 4 * width;
+				m128u8 row0 = mm_load_epu8((const m128u8*)rows);
+				m128u8 row1 = mm_load_epu8((const m128u8*)(rows + width));
+				m128u8 row2 = mm_load_epu8((const m128u8*)(rows + width * 2));
+				m128u8 row3 = mm_load_epu8((const m128u8*)(rows + width * 3));
+
+				if (column & 1)
+				{
+					row0 = swap_words(row0);
+					row1 = swap_words(row1);
+				}
+				else
+				{
+					row2 = swap_words(row2);
+					row3 = swap_words(row3);
+				}
+
+				uint8_t* rows_out = block_out + column * 2 * dst_stride;
+				swizzle_row(rows_out, row0, row2);
+				swizzle_row(rows_out + dst_stride, row1, row3);
+			}
+		}
+	}
+}
+
+/// @brief Convert 8 pixels
+static inline m128u16 convert_5551(const uint32_t* src)
+{
+	m128u16 lower = mm_pack5_epu32(mm_load_epu32((const m128u32*)src));
+	m128u16 upper = mm_pack5_epu32(mm_load_epu32((const m128u32*)(src + 4)));
+	return mm_pack_epu16(lower, upper);
+}
+
+void texture_rgba32_to_5551(uint16_t* dst, const uint32_t* src, size_t count)
+{
+	size_t i = 0;
+	for (; i + 8 <= count; i += 8)
+	{
+		mm_store_epu16((m128u16*)(dst + i), convert_5551(src + i));
+	}
+
+	if (i < count)
+	{
+		// Convert the remaining pixels in aligned temporaries.
+		m128u32 tail[2] = {};
+		m128u16 converted;
+		memcpy(tail, src + i, (count - i) * sizeof(uint32_t));
+		converted = convert_5551((const uint32_t*)tail);
+		memcpy(dst + i, &converted, (count - i) * sizeof(uint16_t));
+	}
+}
@@ -0,0 +1,382 @@
+/*
+*	UTF-8 and UTF-16, see 'utf8.h'.
+*
+*	A byte must be a continuation byte exactly when the byte 1 position back starts a sequence
+*	of 2 or more bytes, the one 2 positions back a sequence of 3 or more, or the one 3 positions
+*	back a sequence of 4. The bytes 1 to 3 positions back come from the quadword before through
+*	QFSRV. Once a quadword is known to be valid, its sequences are decoded without checks. The
+*	scalar decoder handles the tail and finds the exact position of an error.
+*/
+
+#include <ps2kernels/utf8.h>
+
+#include <ps2intrin.h>
+
+#include <stdbool.h>
+#include <string.h>
+
+typedef union
+{
+	uint128_t q;
+	m128i8 v;
+	uint8_t b[16];
+	uint64_t d[2];
+} quadword_t;
+
+/// @brief 0xFF in the bytes between 'low' and 'high', both included
+static inline m128i8 in_range(m128i8 v, int8_t low, int8_t high)
+{
+	return mm_and_epi8(mm_cmpgt_epi8(v, mm_broadcast_epi8((int8_t)(low - 1))),
+					   mm_cmpgt_epi8(mm_broadcast_epi8((int8_t)(high + 1)), v));
+}
+
+static inline m128i8 equal_to(m128i8 v, uint8_t byte)
+{
+	return mm_cmpeq_epi8(v, mm_broadcast_epi8((int8_t)byte));
+}
+
+static inline bool any_set(m128i8 mask)
+{
+	quadword_t bits = { .v = mask };
+	return (bits.d[0] | bits.d[1]) != 0;
+}
+
+/// @brief Bytes of 'before' followed by 'bytes', 'n' positions back from 'bytes'
+static inline m128i8 bytes_back(sa_state_t* sa, m128i8 before, m128i8 bytes, unsigned n)
+{
+	quadword_t upper = { .v = bytes };
+	quadword_t lower = { .v = before };
+	quadword_t result;
+	set_sa_8(sa, 16 - n);
+	result.q = byte_shift_logical_right(sa, upper.q, lower.q);
+	return result.v;
+}
+
+static inline bool is_ascii(m128i8 bytes)
+{
+	return !any_set(mm_cmplt_epi8(bytes, mm_setzero_epi8()));
+}
+
+/// @brief Whether 'bytes' hold no error, sequences continuing past them are checked with the
+/// next quadword
+static inline bool quadword_valid(sa_state_t* sa, m128i8 before, m128i8 bytes)
+{
+	m128i8 back1 = bytes_back(sa, before, bytes, 1);
+	m128i8 back2 = bytes_back(sa, before, bytes, 2);
+	m128i8 back3 = bytes_back(sa, before, bytes, 3);
+
+	// Signed, continuation bytes are below -64, lead bytes of 2, 3 and 4 byte sequences start
+	// at -64, -32 and -16.
+	m128i8 continuation = mm_cmpgt_epi8(mm_broadcast_epi8(-64), bytes);
+	m128i8 required = mm_or_epi8(in_range(back1, -64, -1),
+								 mm_or_epi8(in_range(back2, -32, -1), in_range(back3, -16, -1)));
+	m128i8 error = mm_xor_epi8(continuation, required);
+
+	// 0xC0, 0xC1 and 0xF5 to 0xFF never appear.
+	error = mm_or_epi8(error, mm_or_epi8(in_range(bytes, -64, -63), in_range(bytes, -11, -1)));
+
+	// Overlong forms after 0xE0 and 0xF0, surrogates after 0xED, past U+10FFFF after 0xF4
+	m128i8 second = mm_and_epi8(equal_to(back1, 0xE0), mm_cmpgt_epi8(mm_broadcast_epi8((int8_t)0xA0), bytes));
+	second = mm_or_epi8(second, mm_and_epi8(equal_to(back1, 0xED), mm_cmpgt_epi8(bytes, mm_broadcast_epi8((int8_t)0x9F))));
+	second = mm_or_epi8(second, mm_and_epi8(equal_to(back1, 0xF0), mm_cmpgt_epi8(mm_broadcast_epi8((int8_t)0x90), bytes)));
+	second = mm_or_epi8(second, mm_and_epi8(equal_to(back1, 0xF4), mm_cmpgt_epi8(bytes, mm_broadcast_epi8((int8_t)0x8F))));
+	return !any_set(mm_or_epi8(error, second));
+}
+
+/// @brief Size of the sequence starting with 'lead', assumed valid
+static inline size_t sequence_size(uint8_t lead)
+{
+	return lead >= 0xF0 ? 4 : lead >= 0xE0 ? 3 : lead >= 0xC0 ? 2 : 1;
+}
+
+/// @brief Start of the sequence that 'position' is part of, 'position' if it starts one
+static inline size_t sequence_start(const uint8_t* bytes, size_t position)
+{
+	for (size_t back = 1; back <= 3 && back <= position; ++back)
+	{
+		uint8_t lead = bytes[position - back];
+		if (lead >= 0xC0)
+		{
+			return sequence_size(lead) > back ? position - back : position;
+		}
+	}
+	return position;
+}
+
+/// @brief Decode the sequence at 'p'
+/// @param rest Number of bytes from 'p' on
+/// @return Size of the sequence, 0 if it is invalid or truncated
+static inline size_t decode_sequence(const uint8_t* p, size_t rest, uint32_t* code_point)
+{
+	uint8_t lead = p[0];
+	if (lead < 0x80)
+	{
+		*code_point = lead;
+		return 1;
+	}
+
+	size_t size;
+	uint32_t value;
+	uint8_t low = 0x80;
+	uint8_t high = 0xBF;
+	if (lead < 0xC2)
+	{
+		return 0;
+	}
+	else if (lead < 0xE0)
+	{
+		size = 2;
+		value = lead & 0x1F;
+	}
+	else if (lead < 0xF0)
+	{
+		size = 3;
+		value = lead & 0x0F;
+		low = lead == 0xE0 ? 0xA0 : 0x80;
+		high = lead == 0xED ? 0x9F : 0xBF;
+	}
+	else if (lead < 0xF5)
+	{
+		size = 4;
+		value = lead & 0x07;
+		low = lead == 0xF0 ? 0x90 : 0x80;
+		high = lead == 0xF4 ? 0x8F : 0xBF;
+	}
+	else
+	{
+		return 0;
+	}
+
+	if (rest < size)
+	{
+		return 0;
+	}
+	for (size_t k = 1; k < size; ++k)
+	{
+		if (p[k] < low || p[k] > high)
+		{
+			return 0;
+		}
+		value = value << 6 | (p[k] & 0x3F);
+		low = 0x80;
+		high = 0xBF;
+	}
+	*code_point = value;
+	return size;
+}
+
+/// @brief Decode the sequence at 'p', known to be valid
+static inline size_t decode_valid_sequence(const uint8_t* p, uint32_t* code_point)
+{
+	uint8_t lead = p[0];
+	if (lead < 0x80)
+	{
+		*code_point = lead;
+		return 1;
+	}
+	if (lead < 0xE0)
+	{
+		*code_point = (uint32_t)(lead & 0x1F) << 6 | (p[1] & 0x3F);
+		return 2;
+	}
+	if (lead < 0xF0)
+	{
+		*code_point = (uint32_t)(lead & 0x0F) << 12 | (uint32_t)(p[1] & 0x3F) << 6 | (p[2] & 0x3F);
+		return 3;
+	}
+	*code_point = (uint32_t)(lead & 0x07) << 18 | (uint32_t)(p[1] & 0x3F) << 12 | (uint32_t)(p[2] & 0x3F) << 6 | (p[3] & 0x3F);
+	return 4;
+}
+
+static inline size_t write_utf16(uint16_t* output, uint32_t code_point)
+{
+	if (code_point < 0x10000)
+	{
+		output[0] = (uint16_t)code_point;
+		return 1;
+	}
+	code_point -= 0x10000;
+	output[0] = (uint16_t)(0xD800 | code_point >> 10);
+	output[1] = (uint16_t)(0xDC00 | (code_point & 0x3FF));
+	return 2;
+}
+
+static inline size_t write_utf8(uint8_t* output, uint32_t code_point)
+{
+	if (code_point < 0x80)
+	{
+		output[0] = (uint8_t)code_point;
+		return 1;
+	}
+	if (code_point < 0x800)
+	{
+		output[0] = (uint8_t)(0xC0 | code_point >> 6);
+		output[1] = (uint8_t)(0x80 | (code_point & 0x3F));
+		return 2;
+	}
+	if (code_point < 0x10000)
+	{
+		output[0] = (uint8_t)(0xE0 | code_point >> 12);
+		output[1] = (uint8_t)(0x80 | ((code_point >> 6) & 0x3F));
+		output[2] = (uint8_t)(0x80 | (code_point & 0x3F));
+		return 3;
+	}
+	output[0] = (uint8_t)(0xF0 | code_point >> 18);
+	output[1] = (uint8_t)(0x80 | ((code_point >> 12) & 0x3F));
+	output[2] = (uint8_t)(0x80 | ((code_point >> 6) & 0x3F));
+	output[3] = (uint8_t)(0x80 | (code_point & 0x3F));
+	return 4;
+}
+
+size_t utf8_validate(const char* input, size_t length)
+{
+	const uint8_t* bytes = (const uint8_t*)input;
+	sa_state_t sa;
+	sa_state_construct(&sa);
+
+	m128i8 before = mm_setzero_epi8();
+	size_t i = 0;
+	for (; i + 16 <= length; i += 16)
+	{
+		quadword_t chunk;
+		memcpy(chunk.b, bytes + i, 16);
+		bool complete = sequence_start(bytes, i) == i;
+		if (!(complete && is_ascii(chunk.v)) && !quadword_valid(&sa, before, chunk.v))
+		{
+			break;
+		}
+		before = chunk.v;
+	}
+	sa_state_destruct(&sa);
+
+	uint32_t code_point;
+	for (i = sequence_start(bytes, i); i < length;)
+	{
+		size_t size = decode_sequence(bytes + i, length - i, &code_point);
+		if (size == 0)
+		{
+			return i;
+		}
+		i += size;
+	}
+	return length;
+}
+
+size_t utf8_to_utf16(const char* input, size_t length, uint16_t* output, size_t* invalid)
+{
+	const uint8_t* bytes = (const uint8_t*)input;
+	uint16_t* start = output;
+	sa_state_t sa;
+	sa_state_construct(&sa);
+
+	// Sequences before 'i' are written, quadwords before 'checked' are valid.
+	m128i8 before = mm_setzero_epi8();
+	size_t i = 0;
+	uint32_t code_point;
+	for (size_t checked = 0; checked + 16 <= length; checked += 16)
+	{
+		quadword_t chunk;
+		memcpy(chunk.b, bytes + checked, 16);
+		if (i == checked && is_ascii(chunk.v))
+		{
+			m128u8 ascii = mm_castepu8_epi8(chunk.v);
+			m128u8 units[2] = {
+				mm_extlo_epu8(ascii, mm_setzero_epu8()),
+				mm_exthi_epu8(ascii, mm_setzero_epu8()),
+			};
+			memcpy(output, units, sizeof(units));
+			output += 16;
+			i += 16;
+			before = chunk.v;
+			continue;
+		}
+		if (!quadword_valid(&sa, before, chunk.v))
+		{
+			break;
+		}
+		before = chunk.v;
+
+		// A sequence continuing past the quadword waits for the next one to be checked.
+		size_t end = checked + 16;
+		while (i < end && i + sequence_size(bytes[i]) <= end)
+		{
+			i += decode_valid_sequence(bytes + i, &code_point);
+			output += write_utf16(output, code_point);
+		}
+	}
+	sa_state_destruct(&sa);
+
+	*invalid = length;
+	while (i < length)
+	{
+		size_t size = decode_sequence(bytes + i, length - i, &code_point);
+		if (size == 0)
+		{
+			*invalid = i;
+			break;
+		}
+		i += size;
+		output += write_utf16(output, code_point);
+	}
+	return (size_t)(output - start);
+}
+
+/// @brief Decode the code point at 'p'
+/// @param rest Number of code units from 'p' on
+/// @return Number of code units, 0 for an unpaired surrogate
+static inline size_t decode_utf16(const uint16_t* p, size_t rest, uint32_t* code_point)
+{
+	uint16_t unit = p[0];
+	if (unit < 0xD800 || unit > 0xDFFF)
+	{
+		*code_point = unit;
+		return 1;
+	}
+	if (unit > 0xDBFF || rest < 2 || p[1] < 0xDC00 || p[1] > 0xDFFF)
+	{
+		return 0;
+	}
+	*code_point = 0x10000 + ((uint32_t)(unit & 0x3FF) << 10 | (p[1] & 0x3FF));
+	return 2;
+}
+
+size_t utf16_to_utf8(const uint16_t* input, size_t length, char* output, size_t* invalid)
+{
+	uint8_t* bytes = (uint8_t*)output;
+	uint32_t code_point;
+	size_t i = 0;
+	*invalid = length;
+	while (i < length)
+	{
+		size_t end = i + 16 <= length ? i + 16 : length;
+		if (end - i == 16)
+		{
+			m128u16 units[2];
+			memcpy(units, input + i, sizeof(units));
+			m128u16 high_bits = mm_and_epu16(mm_or_epu16(units[0], units[1]), mm_broadcast_epu16(0xFF80));
+			if (!any_set(mm_castepi8_epu16(high_bits)))
+			{
+				// PPACB keeps the low byte of each halfword.
+				m128u8 ascii = mm_pack_epu8(mm_castepu8_epu16(units[0]), mm_castepu8_epu16(units[1]));
+				memcpy(bytes, &ascii, 16);
+				bytes += 16;
+				i += 16;
+				continue;
+			}
+		}
+
+		// A surrogate pair can end past 'end'.
+		while (i < end)
+		{
+			size_t size = decode_utf16(input + i, length - i, &code_point);
+			if (size == 0)
+			{
+				*invalid = i;
+				return (size_t)(bytes - (uint8_t*)output);
+			}
+			i += size;
+			bytes += write_utf8(bytes, code_point);
+		}
+	}
+	return (size_t)(bytes - (uint8_t*)output);
+}
@@ -0,0 +1,269 @@
+/*
+*	VIF UNPACK encoders and decoders, see 'vif.h'.
+*/
+
+#include <ps2kernels/vif.h>
+
+#include <ps2intrin.h>
+
+#include <string.h>
+
+/// Elements read from the caller or from the padded tail
+typedef struct
+{
+	/// Interleaved components, or NULL
+	const int32_t* aos;
+	/// One array per component, used if 'aos' is NULL
+	const int32_t* const* soa;
+} source_t;
+
+typedef union
+{
+	m128u8 v[4];
+	uint64_t q[8];
+} block_t;
+
+/// @brief Number of elements encoded at a time, filling whole quadwords
+static inline size_t unit_elements(vif_format_t format)
+{
+	switch (format)
+	{
+	case VIF_V3_8:
+		return 16;
+	case VIF_V4_5:
+		return 8;
+	default:
+		return 4;
+	}
+}
+
+/// @brief Load elements 'i' to 'i + 3' with one element per vector
+static inline void fetch(const source_t* source, size_t i, m128i32 v[4])
+{
+	if (source->aos)
+	{
+		const m128i32* p = (const m128i32*)(source->aos + i * 4);
+		v[0] = mm_load_epi32(p);
+		v[1] = mm_load_epi32(p + 1);
+		v[2] = mm_load_epi32(p + 2);
+		v[3] = mm_load_epi32(p + 3);
+		return;
+	}
+
+	m128i32 x = mm_load_epi32((const m128i32*)(source->soa[0] + i));
+	m128i32 y = mm_load_epi32((const m128i32*)(source->soa[1] + i));
+	m128i32 z = mm_load_epi32((const m128i32*)(source->soa[2] + i));
+	m128i32 w = source->soa[3] ? mm_load_epi32((const m128i32*)(source->soa[3] + i)) : mm_setzero_epi32();
+
+	// 4x4 transpose: interleave pairs of components, then combine the halves.
+	m128i64 xy_lo = mm_castepi64_epi32(mm_extlo_epi32(x, y));		// x0 y0 x1 y1
+	m128i64 zw_lo = mm_castepi64_epi32(mm_extlo_epi32(z, w));		// z0 w0 z1 w1
+	m128i64 xy_hi = mm_castepi64_epi32(mm_exthi_epi32(x, y));		// x2 y2 x3 y3
+	m128i64 zw_hi = mm_castepi64_epi32(mm_exthi_epi32(z, w));		// z2 w2 z3 w3
+	v[0] = mm_castepi32_epi64(mm_unpacklo_epi64(xy_lo, zw_lo));
+	v[1] = mm_castepi32_epi64(mm_unpackhi_epi64(xy_lo, zw_lo));
+	v[2] = mm_castepi32_epi64(mm_unpacklo_epi64(xy_hi, zw_hi));
+	v[3] = mm_castepi32_epi64(mm_unpackhi_epi64(xy_hi, zw_hi));
+}
+
+/// @brief Low halfword of every component of 2 elements
+static inline m128i16 to_halfwords(m128i32 a, m128i32 b)
+{
+	return mm_pack_epi16(mm_castepi16_epi32(a), mm_castepi16_epi32(b));
+}
+
+/// @brief Low byte of every component of 4 elements
+static inline m128u8 to_bytes(const m128i32 v[4])
+{
+	m128i16 lower = to_halfwords(v[0], v[1]);
+	m128i16 upper = to_halfwords(v[2], v[3]);
+	return mm_castepu8_epi8(mm_pack_epi8(mm_castepi8_epi16(lower), mm_castepi8_epi16(upper)));
+}
+
+/// @brief Drop the 'w' byte of the 2 elements in 'q'
+static inline uint64_t drop_w(uint64_t q)
+{
+	return (q & 0xFFFFFF) | ((q >> 8) & 0xFFFFFF000000);
+}
+
+/// @brief Encode 'unit_elements(format)' elements starting at 'i'
+/// @return Number of quadwords written
+static inline size_t encode_unit(vif_format_t format, const source_t* source, size_t i, m128u8* out)
+{
+	m128i32 v[4];
+	fetch(source, i, v);
+
+	switch (format)
+	{
+	case VIF_V4_32:
+		mm_store_epi32((m128i32*)out, v[0]);
+		mm_store_epi32((m128i32*)out + 1, v[1]);
+		mm_store_epi32((m128i32*)out + 2, v[2]);
+		mm_store_epi32((m128i32*)out + 3, v[3]);
+		return 4;
+
+	case VIF_V4_16:
+		mm_store_epi16((m128i16*)out, to_halfwords(v[0], v[1]));
+		mm_store_epi16((m128i16*)out + 1, to_halfwords(v[2], v[3]));
+		return 2;
+
+	case VIF_V4_5:
+	{
+		// The components as bytes form RGBA8888 colors, which PPAC5 converts.
+		m128u16 lower = mm_pack5_epu32(mm_castepu32_epu8(to_bytes(v)));
+		fetch(source, i + 4, v);
+		m128u16 upper = mm_pack5_epu32(mm_castepu32_epu8(to_bytes(v)));
+		mm_store_epu16((m128u16*)out, mm_pack_epu16(lower, upper));
+		return 1;
+	}
+
+	case VIF_V3_8:
+	{
+		// 16 elements of 4 bytes become 48 bytes: 6 bytes per 64-bit value after dropping 'w'.
+		block_t block;
+		block.v[0] = to_bytes(v);
+		for (size_t k = 1; k < 4; ++k)
+		{
+			fetch(source, i + k * 4, v);
+			block.v[k] = to_bytes(v);
+		}
+
+		uint64_t c[8];
+		for (size_t k = 0; k < 8; ++k)
+		{
+			c[k] = drop_w(block.q[k]);
+		}
+		m128u64* q = (m128u64*)out;
+		mm_store_epu64(q, mm_set_epu64(c[1] >> 16 | c[2] << 32, c[0] | c[1] << 48));
+		mm_store_epu64(q + 1, mm_set_epu64(c[4] | c[5] << 48, c[2] >> 32 | c[3] << 16));
+		mm_store_epu64(q + 2, mm_set_epu64(c[6] >> 32 | c[7] << 16, c[5] >> 16 | c[6] << 32));
+		return 3;
+	}
+	}
+
+	return 0;
+}
+
+size_t vif_encoded_qwc(vif_format_t format, size_t count)
+{
+	size_t bytes;
+	switch (format)
+	{
+	case VIF_V4_32:
+		bytes = count * 16;
+		break;
+	case VIF_V4_16:
+		bytes = count * 8;
+		break;
+	case VIF_V3_8:
+		bytes = count * 3;
+		break;
+	default:
+		bytes = count * 2;
+		break;
+	}
+	return (bytes + 15) / 16;
+}
+
+/// @brief Encode whole units from 'source', then the rest from a zero-padded copy
+static size_t encode(vif_format_t format, void* dst, const source_t* source, size_t count)
+{
+	m128u8* out = (m128u8*)dst;
+	size_t unit = unit_elements(format);
+	size_t i = 0;
+	for (; i + unit <= count; i += unit)
+	{
+		out += encode_unit(format, source, i, out);
+	}
+
+	size_t written = (size_t)(out - (m128u8*)dst);
+	if (i < count)
+	{
+		m128i32 padded[16] = {};
+		int32_t* components = (int32_t*)padded;
+		for (size_t k = 0; k < count - i; ++k)
+		{
+			for (size_t c = 0; c < 4; ++c)
+			{
+				if (source->aos)
+				{
+					components[k * 4 + c] = source->aos[(i + k) * 4 + c];
+				}
+				else if (source->soa[c])
+				{
+					components[k * 4 + c] = source->soa[c][i + k];
+				}
+			}
+		}
+
+		// The padding encodes to zeros, so whole quadwords can be copied.
+		m128u8 tail[4];
+		source_t padded_source = { components, NULL };
+		encode_unit(format, &padded_source, 0, tail);
+
+		size_t remaining = vif_encoded_qwc(format, count) - written;
+		memcpy(out, tail, remaining * 16);
+		written += remaining;
+	}
+
+	return written;
+}
+
+size_t vif_encode_aos(vif_format_t format, void* dst, const int32_t* src, size_t count)
+{
+	source_t source = { src, NULL };
+	return encode(format, dst, &source, count);
+}
+
+size_t vif_encode_soa(vif_format_t format, void* dst, const int32_t* const components[4], size_t count)
+{
+	const int32_t* arrays[4] = { components[0], components[1], components[2],
+								 format == VIF_V3_8 ? NULL : components[3] };
+	source_t source = { NULL, arrays };
+	return encode(format, dst, &source, count);
+}
+
+void vif_decode(vif_format_t format, int32_t* dst, const void* src, size_t count, bool is_unsigned)
+{
+	const uint8_t* in = (const uint8_t*)src;
+
+	for (size_t i = 0; i < count; ++i)
+	{
+		int32_t* element = dst + i * 4;
+		switch (format)
+		{
+		case VIF_V4_32:
+			memcpy(element, in + i * 16, 16);
+			break;
+
+		case VIF_V4_16:
+			for (size_t c = 0; c < 4; ++c)
+			{
+				uint16_t value;
+				memcpy(&value, in + i * 8 + c * 2, 2);
+				element[c] = is_unsigned ? (int32_t)value : (int32_t)(int16_t)value;
+			}
+			break;
+
+		case VIF_V3_8:
+			for (size_t c = 0; c < 3; ++c)
+			{
+				uint8_t value = in[i * 3 + c];
+				element[c] = is_unsigned ? (int32_t)value : (int32_t)(int8_t)value;
+			}
+			element[3] = 0;
+			break;
+
+		case VIF_V4_5:
+		{
+			uint16_t value;
+			memcpy(&value, in + i * 2, 2);
+			element[0] = (value & 0x1F) << 3;
+			element[1] = ((value >> 5) & 0x1F) << 3;
+			element[2] = ((value >> 10) & 0x1F) << 3;
+			element[3] = (value >> 15) << 7;
+			break;
+		}
+		}
+	}
+}
@@ -0,0 +1,43 @@
+/*
+*	C++20 module interface unit for ps2intrin. Exports every type and function of the C headers
+*	and the C++ templates. Macros cannot be exported: code relying on the macro versions of the
+*	functions taking an immediate value (e.g. 'PSLLH') has to include the headers instead.
+*
+*	The mode is fixed when the module is built. Define 'PS2INTRIN_UNSAFE' or 'PS2INTRIN_HOST'
+*	for the module unit and every importer alike.
+*/
+
+module;
+
+// The standard headers have to stay attached to the global module.
+#include <stddef.h>
+#include <stdint.h>
+#include <string.h>
+#include <utility>
+#if defined(__cpp_impl_coroutine)
+#include <coroutine>
+#endif
+
+export module ps2intrin;
+
+#define PS2INTRIN_MODULE
+
+export
+{
+#include <ps2intrin/common.h>
+#include <ps2intrin/lohi.h>
+#include <ps2intrin/sa.h>
+#include <ps2intrin/muldiv.h>
+#include <ps2intrin/loadstore.h>
+#include <ps2intrin/logic.h>
+#include <ps2intrin/compare.h>
+#include <ps2intrin/shift.h>
+#include <ps2intrin/arithmetic.h>
+#include <ps2intrin/int128.h>
+#include <ps2intrin/shuffle.h>
+#include <ps2intrin/pack.h>
+}
+
+#include <ps2intrin/cpp.h>
+#include <ps2intrin/pipeline.h>
+#include <ps2intrin/executor.h>
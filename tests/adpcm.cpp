@@ -0,0 +1,145 @@
+/*
+*	SPU2 ADPCM: the decoder against an independent scalar model of the hardware on every header,
+*	and encoded streams checked for valid headers, continuity across calls and quality.
+*/
+
+#include "check.h"
+
+#include <ps2kernels/adpcm.h>
+
+#include <algorithm>
+#include <cmath>
+#include <cstring>
+
+namespace
+{
+	/// @brief Decode like the SPU2, one sample at a time
+	std::vector<int16_t> decode(const std::vector<uint8_t>& blocks)
+	{
+		static const int coefficients[8][2] = { { 0, 0 }, { 60, 0 }, { 115, -52 }, { 98, -55 }, { 122, -60 } };
+		std::vector<int16_t> samples;
+		int32_t history[2] = {};
+		for (size_t b = 0; b + ADPCM_BLOCK_BYTES <= blocks.size(); b += ADPCM_BLOCK_BYTES)
+		{
+			int shift = blocks[b] & 0xF;
+			int filter = blocks[b] >> 4 & 0x7;
+			shift = shift > 12 ? 9 : shift;
+			filter = filter > 4 ? 0 : filter;
+			for (int i = 0; i < ADPCM_BLOCK_SAMPLES; ++i)
+			{
+				int nibble = blocks[b + 2 + i / 2] >> (i % 2 * 4) & 0xF;
+				int32_t residual = (nibble >= 8 ? nibble - 16 : nibble) * 4096 / (1 << shift);
+				int32_t prediction = history[0] * coefficients[filter][0] + history[1] * coefficients[filter][1];
+				// Arithmetic right shift with rounding to nearest, as the hardware does
+				prediction = static_cast<int32_t>(std::floor((prediction + 32) / 64.0));
+				int32_t sample = std::clamp(residual + prediction, -32768, 32767);
+				history[1] = history[0];
+				history[0] = sample;
+				samples.push_back(static_cast<int16_t>(sample));
+			}
+		}
+		return samples;
+	}
+
+	std::vector<int16_t> kernel_decode(const std::vector<uint8_t>& blocks)
+	{
+		size_t count = blocks.size() / ADPCM_BLOCK_BYTES;
+		std::vector<int16_t> samples(count * ADPCM_BLOCK_SAMPLES);
+		adpcm_state_t state;
+		adpcm_state_construct(&state);
+		adpcm_decode(&state, samples.data(), blocks.data(), count);
+		return samples;
+	}
+
+	void test_decode()
+	{
+		// Every header byte, random residuals
+		tests::random random(79);
+		std::vector<uint8_t> blocks(256 * ADPCM_BLOCK_BYTES);
+		for (size_t b = 0; b < 256; ++b)
+		{
+			blocks[b * ADPCM_BLOCK_BYTES] = static_cast<uint8_t>(b);
+			for (size_t i = 1; i < ADPCM_BLOCK_BYTES; ++i)
+			{
+				blocks[b * ADPCM_BLOCK_BYTES + i] = static_cast<uint8_t>(random.next());
+			}
+		}
+		CHECK(kernel_decode(blocks) == decode(blocks));
+
+		// Shift 12 and filter 0 give the residuals themselves.
+		std::vector<uint8_t> block = tests::from_hex("0c00" "10325476f8bad9fe" "00000000000000");
+		std::vector<int16_t> samples = kernel_decode(block);
+		const int16_t expected[] = { 0, 1, 2, 3, 4, 5, 6, 7, -8, -1, -6, -5, -7, -3, -2, -1 };
+		CHECK(std::equal(std::begin(expected), std::end(expected), samples.begin()));
+	}
+
+	std::vector<uint8_t> encode(const std::vector<int16_t>& samples, size_t split)
+	{
+		size_t count = samples.size() / ADPCM_BLOCK_SAMPLES;
+		std::vector<uint8_t> blocks(count * ADPCM_BLOCK_BYTES);
+		adpcm_state_t state;
+		adpcm_state_construct(&state);
+		adpcm_encode(&state, blocks.data(), samples.data(), split);
+		adpcm_encode(&state, blocks.data() + split * ADPCM_BLOCK_BYTES, samples.data() + split * ADPCM_BLOCK_SAMPLES,
+					 count - split);
+		return blocks;
+	}
+
+	void test_encode()
+	{
+		tests::random random(28);
+		const size_t count = 200;
+		std::vector<std::vector<int16_t>> signals;
+		signals.push_back(std::vector<int16_t>(count * ADPCM_BLOCK_SAMPLES, 0));
+		for (double frequency : { 110.0, 1000.0, 7000.0 })
+		{
+			std::vector<int16_t> tone(count * ADPCM_BLOCK_SAMPLES);
+			for (size_t i = 0; i < tone.size(); ++i)
+			{
+				tone[i] = static_cast<int16_t>(std::lrint(30000 * std::sin(6.283185307179586 * frequency * i / 48000)));
+			}
+			signals.push_back(tone);
+		}
+
+		for (const std::vector<int16_t>& signal : signals)
+		{
+			std::vector<uint8_t> blocks = encode(signal, 0);
+			CHECK(encode(signal, count / 3) == blocks);
+			for (size_t b = 0; b < blocks.size(); b += ADPCM_BLOCK_BYTES)
+			{
+				CHECK((blocks[b] & 0xF) <= 12 && blocks[b] >> 4 <= 4 && blocks[b + 1] == 0);
+			}
+
+			// The decoded stream has a signal to noise ratio of 30 dB or more.
+			std::vector<int16_t> decoded = decode(blocks);
+			CHECK(kernel_decode(blocks) == decoded);
+			double signal_energy = 1;
+			double noise = 0;
+			for (size_t i = 0; i < signal.size(); ++i)
+			{
+				signal_energy += double(signal[i]) * signal[i];
+				noise += double(signal[i] - decoded[i]) * (signal[i] - decoded[i]);
+			}
+			if (!CHECK(noise * 1000 <= signal_energy))
+			{
+				std::fprintf(stderr, "  SNR %.1f dB\n", 10 * std::log10(signal_energy / std::max(noise, 1.0)));
+			}
+		}
+
+		// Noise at full scale still decodes to valid blocks close to the input.
+		std::vector<int16_t> noise(count * ADPCM_BLOCK_SAMPLES);
+		for (int16_t& s : noise)
+		{
+			s = static_cast<int16_t>(random.next());
+		}
+		std::vector<uint8_t> blocks = encode(noise, 1);
+		CHECK(kernel_decode(blocks) == decode(blocks));
+	}
+}
+
+int main()
+{
+	test_decode();
+	test_encode();
+	return tests::finish();
+}
@@ -0,0 +1,134 @@
+/*
+*	Base64 and hexadecimal against the RFC 4648 test vectors, round trips long enough for the
+*	quadword paths and the positions reported for invalid input.
+*/
+
+#include "check.h"
+
+#include <ps2kernels/base64.h>
+
+#include <cstring>
+
+namespace
+{
+	std::string encode(const std::string& data)
+	{
+		std::string text(BASE64_ENCODED_SIZE(data.size()), '\0');
+		size_t length = base64_encode(reinterpret_cast<const uint8_t*>(data.data()), data.size(), &text[0]);
+		text.resize(length);
+		return text;
+	}
+
+	std::string decode(const std::string& text, size_t* invalid)
+	{
+		std::string data(BASE64_DECODED_SIZE(text.size()), '\0');
+		size_t length = base64_decode(text.data(), text.size(), reinterpret_cast<uint8_t*>(&data[0]), invalid);
+		data.resize(length);
+		return data;
+	}
+
+	std::string encode_hex(const std::string& data)
+	{
+		std::string text(2 * data.size(), '\0');
+		text.resize(hex_encode(reinterpret_cast<const uint8_t*>(data.data()), data.size(), &text[0]));
+		return text;
+	}
+
+	std::string decode_hex(const std::string& text, size_t* invalid)
+	{
+		std::string data(text.size() / 2, '\0');
+		data.resize(hex_decode(text.data(), text.size(), reinterpret_cast<uint8_t*>(&data[0]), invalid));
+		return data;
+	}
+
+	void test_vectors()
+	{
+		// RFC 4648, section 10
+		const char* vectors[][3] = {
+			{ "", "", "" },
+			{ "f", "Zg==", "66" },
+			{ "fo", "Zm8=", "666f" },
+			{ "foo", "Zm9v", "666f6f" },
+			{ "foob", "Zm9vYg==", "666f6f62" },
+			{ "fooba", "Zm9vYmE=", "666f6f6261" },
+			{ "foobar", "Zm9vYmFy", "666f6f626172" },
+		};
+		for (const auto& v : vectors)
+		{
+			size_t invalid = 0;
+			CHECK(encode(v[0]) == v[1]);
+			CHECK(decode(v[1], &invalid) == v[0] && invalid == std::strlen(v[1]));
+			CHECK(encode_hex(v[0]) == v[2]);
+			CHECK(decode_hex(v[2], &invalid) == v[0] && invalid == std::strlen(v[2]));
+		}
+
+		size_t invalid = 0;
+		CHECK(decode("Zm9vYg", &invalid) == "foob" && invalid == 6);
+		CHECK(decode("Zm9vYmE", &invalid) == "fooba" && invalid == 7);
+		CHECK(decode_hex("666F6F626172", &invalid) == "foobar" && invalid == 12);
+	}
+
+	void test_round_trips()
+	{
+		tests::random random(95);
+		for (size_t length = 0; length < 300; length += 1 + length / 16)
+		{
+			std::string data(length, '\0');
+			for (char& c : data)
+			{
+				c = static_cast<char>(random.next());
+			}
+
+			size_t invalid = 0;
+			std::string text = encode(data);
+			CHECK(text.size() == BASE64_ENCODED_SIZE(length));
+			CHECK(decode(text, &invalid) == data && invalid == text.size());
+
+			std::string hex = encode_hex(data);
+			CHECK(decode_hex(hex, &invalid) == data && invalid == hex.size());
+		}
+	}
+
+	void test_invalid()
+	{
+		// The invalid character lands in the vector path, the tail and the last group.
+		std::string text = encode(std::string(60, 'x'));
+		for (size_t position : { size_t(0), size_t(17), size_t(40), size_t(79) })
+		{
+			for (char bad : { '!', '-', '_', ' ', '\x80' })
+			{
+				std::string corrupted = text;
+				corrupted[position] = bad;
+				size_t invalid = 0;
+				std::string data = decode(corrupted, &invalid);
+				CHECK(invalid == position);
+				CHECK(data == std::string(position / 4 * 3, 'x'));
+			}
+		}
+
+		size_t invalid = 0;
+		CHECK(decode("Z", &invalid).empty() && invalid == 0);
+		CHECK(decode("Zm9vY", &invalid) == "foo" && invalid == 4);
+		CHECK(decode("Zg==Zg==", &invalid).empty() && invalid == 2);
+		CHECK(decode("Zm=v", &invalid).empty() && invalid == 2);
+
+		std::string hex = encode_hex(std::string(40, 'x'));
+		for (size_t position : { size_t(0), size_t(21), size_t(79) })
+		{
+			std::string corrupted = hex;
+			corrupted[position] = 'g';
+			std::string data = decode_hex(corrupted, &invalid);
+			CHECK(invalid == position);
+			CHECK(data == std::string(position / 2, 'x'));
+		}
+		CHECK(decode_hex("666", &invalid) == "f" && invalid == 2);
+	}
+}
+
+int main()
+{
+	test_vectors();
+	test_round_trips();
+	test_invalid();
+	return tests::finish();
+}
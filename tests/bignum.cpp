@@ -0,0 +1,267 @@
+/*
+*	Multi-precision arithmetic against a plain word-by-word reference, and modular exponentiation
+*	against a bit-by-bit reduction and values computed with Python's 'pow'.
+*/
+
+#include "check.h"
+
+#include <ps2kernels/bignum.h>
+
+#include <algorithm>
+
+namespace
+{
+	using number_t = std::vector<uint32_t>;
+
+	number_t random_number(tests::random& random, size_t words)
+	{
+		number_t a(words);
+		for (uint32_t& w : a)
+		{
+			// Runs of all-ones and zero words stress the carries.
+			uint32_t kind = random.next() % 8;
+			w = kind == 0 ? 0xFFFFFFFF : kind == 1 ? 0 : random.next();
+		}
+		return a;
+	}
+
+	number_t from_hex(const std::string& hex, size_t words)
+	{
+		std::vector<uint8_t> bytes = tests::from_hex(hex);
+		number_t a(words);
+		bignum_from_bytes(a.data(), words, bytes.data(), bytes.size());
+		return a;
+	}
+
+	/// @brief 'a * b', one word at a time
+	number_t multiply(const number_t& a, const number_t& b)
+	{
+		number_t result(a.size() + b.size());
+		for (size_t i = 0; i < a.size(); ++i)
+		{
+			uint64_t carry = 0;
+			for (size_t j = 0; j < b.size(); ++j)
+			{
+				carry += static_cast<uint64_t>(a[i]) * b[j] + result[i + j];
+				result[i + j] = static_cast<uint32_t>(carry);
+				carry >>= 32;
+			}
+			result[i + b.size()] = static_cast<uint32_t>(carry);
+		}
+		return result;
+	}
+
+	/// @brief 'a mod n', shifting in one bit of 'a' at a time
+	number_t reduce(const number_t& a, const number_t& n)
+	{
+		size_t words = n.size();
+		number_t r(words + 1);
+		number_t wide_n(n);
+		wide_n.push_back(0);
+		for (size_t bit = 32 * a.size(); bit-- > 0;)
+		{
+			uint32_t in = (a[bit / 32] >> (bit % 32)) & 1;
+			for (size_t k = words + 1; k-- > 0;)
+			{
+				r[k] = r[k] << 1 | (k > 0 ? r[k - 1] >> 31 : in);
+			}
+			if (!std::lexicographical_compare(r.rbegin(), r.rend(), wide_n.rbegin(), wide_n.rend()))
+			{
+				uint64_t borrow = 0;
+				for (size_t k = 0; k <= words; ++k)
+				{
+					uint64_t difference = static_cast<uint64_t>(r[k]) - wide_n[k] - borrow;
+					r[k] = static_cast<uint32_t>(difference);
+					borrow = difference >> 63;
+				}
+			}
+		}
+		r.pop_back();
+		return r;
+	}
+
+	number_t mod_exp(const number_t& base, const number_t& exponent, const number_t& n)
+	{
+		number_t one(n.size());
+		one[0] = 1;
+		number_t power = reduce(one, n);
+		for (size_t bit = 32 * exponent.size(); bit-- > 0;)
+		{
+			power = reduce(multiply(power, power), n);
+			if ((exponent[bit / 32] >> (bit % 32)) & 1)
+			{
+				power = reduce(multiply(power, base), n);
+			}
+		}
+		return power;
+	}
+
+	number_t random_modulus(tests::random& random, size_t words)
+	{
+		number_t n = random_number(random, words);
+		n[0] |= 1;
+		n[words - 1] |= words == 1 ? 2 : 1;
+		return n;
+	}
+
+	void test_arithmetic()
+	{
+		tests::random random(91);
+		for (size_t words = 1; words <= BIGNUM_MAX_WORDS; words += 1 + words / 4)
+		{
+			for (int round = 0; round < 4; ++round)
+			{
+				number_t a = random_number(random, words);
+				number_t b = round == 0 ? a : random_number(random, words);
+
+				number_t sum(words);
+				number_t difference(words);
+				uint32_t carry = bignum_add(sum.data(), a.data(), b.data(), words);
+				uint32_t borrow = bignum_sub(difference.data(), a.data(), b.data(), words);
+				number_t back(words);
+				CHECK(bignum_sub(back.data(), sum.data(), b.data(), words) == carry && back == a);
+				CHECK(bignum_add(back.data(), difference.data(), b.data(), words) == borrow && back == a);
+				int order = bignum_compare(a.data(), b.data(), words);
+				CHECK(order == (borrow ? -1 : a == b ? 0 : 1));
+
+				number_t product(2 * words);
+				bignum_mul(product.data(), a.data(), b.data(), words);
+				if (!CHECK(product == multiply(a, b)))
+				{
+					std::fprintf(stderr, "  %zu words\n", words);
+				}
+			}
+		}
+
+		// Every carry chain runs through all the words.
+		number_t ones(7, 0xFFFFFFFF);
+		number_t one(7);
+		one[0] = 1;
+		number_t result(14);
+		CHECK(bignum_add(result.data(), ones.data(), one.data(), 7) == 1 && result[0] == 0 && result[6] == 0);
+		CHECK(bignum_sub(result.data(), one.data(), ones.data(), 7) == 1 && result[0] == 2 && result[6] == 0);
+		bignum_mul(result.data(), ones.data(), ones.data(), 7);
+		CHECK(result == multiply(ones, ones) && result[0] == 1 && result[7] == 0xFFFFFFFE);
+	}
+
+	void test_bytes()
+	{
+		number_t a = from_hex("0102030405060708090a", 4);
+		CHECK(a[0] == 0x0708090A && a[1] == 0x03040506 && a[2] == 0x0102 && a[3] == 0);
+		number_t truncated = from_hex("0102030405060708090a", 2);
+		CHECK(truncated[0] == 0x0708090A && truncated[1] == 0x03040506);
+
+		uint8_t bytes[12];
+		bignum_to_bytes(bytes, sizeof(bytes), a.data(), 2);
+		CHECK(tests::from_hex("00000000030405060708090a") == std::vector<uint8_t>(bytes, bytes + sizeof(bytes)));
+		bignum_to_bytes(bytes, 3, a.data(), 4);
+		CHECK(bytes[0] == 0x08 && bytes[1] == 0x09 && bytes[2] == 0x0A);
+	}
+
+	void test_montgomery()
+	{
+		tests::random random(910);
+		bignum_montgomery_t context;
+		for (size_t words = 1; words <= BIGNUM_MAX_WORDS; words += 1 + words / 3)
+		{
+			number_t n = random_modulus(random, words);
+			if (!CHECK(bignum_montgomery_init(&context, n.data(), words)))
+			{
+				continue;
+			}
+			CHECK(static_cast<uint32_t>(context.inverse * n[0]) == 0xFFFFFFFF);
+
+			// R^2 mod n, R being one past the top word
+			number_t r_squared(2 * words + 1);
+			r_squared.back() = 1;
+			if (!CHECK(number_t(context.r_squared, context.r_squared + words) == reduce(r_squared, n)))
+			{
+				std::fprintf(stderr, "  %zu words\n", words);
+			}
+
+			// Back from the Montgomery domain by multiplying with R^2
+			for (int round = 0; round < 3; ++round)
+			{
+				number_t a = reduce(random_number(random, words), n);
+				number_t b = round == 0 ? a : reduce(random_number(random, words), n);
+				number_t result(words);
+				bignum_montgomery_mul(&context, result.data(), a.data(), b.data());
+				bignum_montgomery_mul(&context, result.data(), result.data(), context.r_squared);
+				if (!CHECK(result == reduce(multiply(a, b), n)))
+				{
+					std::fprintf(stderr, "  %zu words, round %d\n", words, round);
+				}
+			}
+
+			// Full exponents on the small moduli, RSA's and a short random one on the others
+			number_t base = reduce(random_number(random, words), n);
+			number_t exponents[] = { number_t{ 65537 }, words <= 8 ? random_number(random, words) : random_number(random, 1),
+									 number_t{ 0 }, number_t{ 1, 0 } };
+			for (const number_t& exponent : exponents)
+			{
+				number_t result(words);
+				bignum_mod_exp(&context, result.data(), base.data(), exponent.data(), exponent.size());
+				if (!CHECK(result == mod_exp(base, exponent, n)))
+				{
+					std::fprintf(stderr, "  %zu words, exponent of %zu words\n", words, exponent.size());
+				}
+			}
+			number_t aliased = base;
+			bignum_mod_exp(&context, aliased.data(), aliased.data(), exponents[0].data(), 1);
+			CHECK(aliased == mod_exp(base, exponents[0], n));
+		}
+
+		number_t even(4, 0x12345678);
+		number_t short_top(4, 0x12345679);
+		short_top[3] = 0;
+		CHECK(!bignum_montgomery_init(&context, even.data(), 4));
+		CHECK(!bignum_montgomery_init(&context, short_top.data(), 4));
+		CHECK(!bignum_montgomery_init(&context, short_top.data(), 0));
+		number_t large(BIGNUM_MAX_WORDS + 1, 1);
+		CHECK(!bignum_montgomery_init(&context, large.data(), large.size()));
+	}
+
+	void test_vectors()
+	{
+		// A 1024-bit modulus, pow(base, 65537, n) and pow(base, exponent, n) from Python
+		const size_t words = 32;
+		number_t n = from_hex("9739751bc137955662f0c11d3775a775ca9fcc15f6c53ad637bea5637d8d0a8a"
+							  "ccd6e8625eddb821d71f950f9a7192b03019f95c3e615900416c0f13d3b6afae"
+							  "754452af7727722570ab92efbe0bbbcdc83ef048d825e197757fc9f0f2ff5cd5"
+							  "66f9ddcf294ede10adb3f6a0af0e4600f7ae94662c20b8f797323b35156199d1", words);
+		number_t base = from_hex("1463e138a12c6af5caf33d891f5628bb61c52ba977cf73d25455749133532219"
+								 "f7c4b2f07f78d558d000fe342e532b3cca5e15f37d458a091eca99f985a4d83c"
+								 "5da84f927ea06e6a58200332d09c0c5c9a999e17752ab92e2f4bea64982129bc"
+								 "4bc3c62b49863d66010633314f1368c2d54c3a03ea40f61e3d28b25baecfd026", words);
+		number_t verified = from_hex("95f8fc70e59f71a5211fe09c1cb37401f48b9c01f282c0bf817cdaf25d78716d"
+									 "9aa4fa351517c6c41bed74a2cae67590911b010533210a263751adeb5b60e832"
+									 "3dc0846acc63232669e7c4f01de7f149cf6725807ad319a8183161c742d8bdf2"
+									 "0bfb7df270c87d7b9a0380fef82db6e2db83c80317e5d275e5ab9cf7461fad29", words);
+		number_t exponent = from_hex("d28a05198605925748808715d48bcb0fb8dfd143a23b74956a58a58d6f95047c"
+									 "8a55ab9af0f634bd11e7b0a4326a18db898513cf2f04b9996d505dbb6414562c"
+									 "e61252120f2d8099e418a326ee72774385b8c4690b4f0fb6c84ef71943de7a35"
+									 "e83f813f36e1b082d0ad9884d403b8288ff6260be2d2ee90bd2ec7695faeea35", words);
+		number_t signed_ = from_hex("395690b40d08fa818694e7eecd1f0a9ffd06f7aed9be46f87ae39891ccee33f3"
+									"83e4bf0915c5954633678d0e8714a6951461156a8248c0b828d1fe01d11474b4"
+									"45f4eb517f69512fb896b87ee3566b2998a87cb4764733561cc17507f158f3dd"
+									"ba79d1b0324e7cc62ea02a5795e68a0b302b90d87215de60b096d7ee8aaf839c", words);
+
+		bignum_montgomery_t context;
+		CHECK(bignum_montgomery_init(&context, n.data(), words));
+		number_t result(words);
+		const uint32_t e = 65537;
+		bignum_mod_exp(&context, result.data(), base.data(), &e, 1);
+		CHECK(result == verified);
+		bignum_mod_exp(&context, result.data(), base.data(), exponent.data(), words);
+		CHECK(result == signed_);
+	}
+}
+
+int main()
+{
+	test_arithmetic();
+	test_bytes();
+	test_montgomery();
+	test_vectors();
+	return tests::finish();
+}
@@ -0,0 +1,161 @@
+/*
+*	ChaCha20 against the RFC 8439 test vectors and a scalar reference, with the stream split
+*	into calls of various sizes and alignments.
+*/
+
+#include "check.h"
+
+#include <ps2kernels/chacha20.h>
+
+#include <cstring>
+
+namespace
+{
+	uint32_t rotate(uint32_t v, int count)
+	{
+		return v << count | v >> (32 - count);
+	}
+
+	void quarter_round(uint32_t* s, int a, int b, int c, int d)
+	{
+		s[a] += s[b]; s[d] = rotate(s[d] ^ s[a], 16);
+		s[c] += s[d]; s[b] = rotate(s[b] ^ s[c], 12);
+		s[a] += s[b]; s[d] = rotate(s[d] ^ s[a], 8);
+		s[c] += s[d]; s[b] = rotate(s[b] ^ s[c], 7);
+	}
+
+	/// @brief Scalar keystream of RFC 8439, section 2.3
+	std::vector<uint8_t> reference_keystream(const uint8_t* key, const uint8_t* nonce, uint32_t counter, size_t length)
+	{
+		std::vector<uint8_t> stream;
+		for (; stream.size() < length; ++counter)
+		{
+			uint32_t input[16] = { 0x61707865, 0x3320646E, 0x79622D32, 0x6B206574 };
+			std::memcpy(input + 4, key, 32);
+			input[12] = counter;
+			std::memcpy(input + 13, nonce, 12);
+
+			uint32_t s[16];
+			std::memcpy(s, input, sizeof(s));
+			for (int round = 0; round < 10; ++round)
+			{
+				quarter_round(s, 0, 4, 8, 12);
+				quarter_round(s, 1, 5, 9, 13);
+				quarter_round(s, 2, 6, 10, 14);
+				quarter_round(s, 3, 7, 11, 15);
+				quarter_round(s, 0, 5, 10, 15);
+				quarter_round(s, 1, 6, 11, 12);
+				quarter_round(s, 2, 7, 8, 13);
+				quarter_round(s, 3, 4, 9, 14);
+			}
+			for (int k = 0; k < 16; ++k)
+			{
+				uint32_t word = s[k] + input[k];
+				for (int b = 0; b < 4; ++b)
+				{
+					stream.push_back(static_cast<uint8_t>(word >> (8 * b)));
+				}
+			}
+		}
+		stream.resize(length);
+		return stream;
+	}
+
+	void test_block_vector()
+	{
+		// RFC 8439, section 2.3.2
+		uint8_t key[CHACHA20_KEY_SIZE];
+		for (int i = 0; i < CHACHA20_KEY_SIZE; ++i)
+		{
+			key[i] = static_cast<uint8_t>(i);
+		}
+		std::vector<uint8_t> nonce = tests::from_hex("000000090000004a00000000");
+		std::vector<uint8_t> expected = tests::from_hex(
+			"10f1e7e4d13b5915500fdd1fa32071c4c7d1f4c733c068030422aa9ac3d46c4e"
+			"d2826446079faa0914c2d705d98b02a2b5129cd1de164eb9cbd083e8a2503c4e");
+
+		alignas(16) chacha20_t context;
+		alignas(16) uint8_t block[CHACHA20_BLOCK_SIZE] = {};
+		chacha20_init(&context, key, nonce.data(), 1);
+		chacha20_xor(&context, block, block, sizeof(block));
+		CHECK(std::memcmp(block, expected.data(), sizeof(block)) == 0);
+	}
+
+	void test_encryption_vector()
+	{
+		// RFC 8439, section 2.4.2
+		uint8_t key[CHACHA20_KEY_SIZE];
+		for (int i = 0; i < CHACHA20_KEY_SIZE; ++i)
+		{
+			key[i] = static_cast<uint8_t>(i);
+		}
+		std::vector<uint8_t> nonce = tests::from_hex("000000000000004a00000000");
+		const char* text = "Ladies and Gentlemen of the class of '99: If I could offer you only one tip for the future, "
+						   "sunscreen would be it.";
+		std::vector<uint8_t> expected = tests::from_hex(
+			"6e2e359a2568f98041ba0728dd0d6981e97e7aec1d4360c20a27afccfd9fae0b"
+			"f91b65c5524733ab8f593dabcd62b3571639d624e65152ab8f530c359f0861d8"
+			"07ca0dbf500d6a6156a38e088a22b65e52bc514d16ccf806818ce91ab7793736"
+			"5af90bbf74a35be6b40b8eedf2785e42874d");
+
+		size_t length = std::strlen(text);
+		std::vector<uint8_t> data(text, text + length);
+		alignas(16) chacha20_t context;
+		chacha20_init(&context, key, nonce.data(), 1);
+		chacha20_xor(&context, data.data(), data.data(), length);
+		CHECK(data == expected);
+
+		chacha20_init(&context, key, nonce.data(), 1);
+		chacha20_xor(&context, data.data(), data.data(), length);
+		CHECK(std::memcmp(data.data(), text, length) == 0);
+	}
+
+	void test_split_streams()
+	{
+		tests::random random(93);
+		uint8_t key[CHACHA20_KEY_SIZE];
+		uint8_t nonce[CHACHA20_NONCE_SIZE];
+		for (uint8_t& b : key)
+		{
+			b = static_cast<uint8_t>(random.next());
+		}
+		for (uint8_t& b : nonce)
+		{
+			b = static_cast<uint8_t>(random.next());
+		}
+
+		const size_t length = 3000;
+		std::vector<uint8_t> expected = reference_keystream(key, nonce, 7, length);
+
+		// Aligned runs of 256 bytes skip the keystream buffer, the other calls go through it.
+		alignas(16) static uint8_t input[length + 16];
+		alignas(16) static uint8_t output[length + 16];
+		const size_t chunks[] = { 1, 3, 16, 64, 100, 256, 512, 1000, length };
+		for (size_t offset : { 0, 5 })
+		{
+			for (size_t chunk : chunks)
+			{
+				std::memset(input, 0, sizeof(input));
+				alignas(16) chacha20_t context;
+				chacha20_init(&context, key, nonce, 7);
+				for (size_t done = 0; done < length; done += chunk)
+				{
+					size_t count = length - done < chunk ? length - done : chunk;
+					chacha20_xor(&context, output + offset + done, input + offset + done, count);
+				}
+				if (!CHECK(std::memcmp(output + offset, expected.data(), length) == 0))
+				{
+					std::fprintf(stderr, "  offset %zu, chunks of %zu bytes\n", offset, chunk);
+				}
+			}
+		}
+	}
+}
+
+int main()
+{
+	test_block_vector();
+	test_encryption_vector();
+	test_split_streams();
+	return tests::finish();
+}
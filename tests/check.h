@@ -0,0 +1,79 @@
+#pragma once
+
+/*
+*	Minimal checks for the kernel tests. A failed check is reported with its location and the
+*	test goes on, 'finish' turns the number of failures into the exit status.
+*/
+
+#include <cstddef>
+#include <cstdint>
+#include <cstdio>
+#include <string>
+#include <vector>
+
+#define CHECK(condition) tests::check((condition), #condition, __FILE__, __LINE__)
+
+namespace tests
+{
+	inline int& failures()
+	{
+		static int count = 0;
+		return count;
+	}
+
+	inline bool check(bool passed, const char* condition, const char* file, int line)
+	{
+		if (!passed)
+		{
+			std::fprintf(stderr, "%s:%d: check failed: %s\n", file, line, condition);
+			++failures();
+		}
+		return passed;
+	}
+
+	/// @return Exit status of the test
+	inline int finish()
+	{
+		if (failures() != 0)
+		{
+			std::fprintf(stderr, "%d check(s) failed\n", failures());
+			return 1;
+		}
+		return 0;
+	}
+
+	/// @brief Bytes of a hexadecimal string, for test vectors
+	inline std::vector<uint8_t> from_hex(const std::string& hex)
+	{
+		std::vector<uint8_t> bytes;
+		for (size_t i = 0; i + 1 < hex.size(); i += 2)
+		{
+			bytes.push_back(static_cast<uint8_t>(std::stoul(hex.substr(i, 2), nullptr, 16)));
+		}
+		return bytes;
+	}
+
+	/// @brief Deterministic pseudo-random numbers (xorshift64*), the same on every host
+	class random
+	{
+	public:
+		explicit random(uint64_t seed) : state(seed | 1) {}
+
+		uint32_t next()
+		{
+			state ^= state >> 12;
+			state ^= state << 25;
+			state ^= state >> 27;
+			return static_cast<uint32_t>((state * 0x2545F4914F6CDD1Dull) >> 32);
+		}
+
+		/// @return A value in [low, high]
+		int32_t range(int32_t low, int32_t high)
+		{
+			return low + static_cast<int32_t>(next() % static_cast<uint32_t>(high - low + 1));
+		}
+
+	private:
+		uint64_t state;
+	};
+}
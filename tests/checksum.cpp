@@ -0,0 +1,165 @@
+/*
+*	Internet checksums against the word-by-word loop of RFC 1071, on every length and alignment,
+*	in parts, over more than one block of lanes and with incremental updates (RFC 1624).
+*/
+
+#include "check.h"
+
+#include <ps2kernels/checksum.h>
+
+#include <algorithm>
+
+namespace
+{
+	struct alignas(16) quadword_t
+	{
+		uint8_t bytes[16];
+	};
+
+	/// @brief The sum of RFC 1071, 4.1, with the carries folded back at the end
+	uint32_t reference_sum(const uint8_t* data, size_t length)
+	{
+		uint32_t sum = 0;
+		for (size_t i = 0; i + 1 < length; i += 2)
+		{
+			sum += static_cast<uint32_t>(data[i]) << 8 | data[i + 1];
+			sum = (sum & 0xFFFF) + (sum >> 16);
+		}
+		if (length & 1)
+		{
+			sum += static_cast<uint32_t>(data[length - 1]) << 8;
+		}
+		while (sum >> 16)
+		{
+			sum = (sum & 0xFFFF) + (sum >> 16);
+		}
+		return sum;
+	}
+
+	uint16_t reference_checksum(const uint8_t* data, size_t length)
+	{
+		return static_cast<uint16_t>(~reference_sum(data, length));
+	}
+
+	void test_vectors()
+	{
+		// RFC 1071, 3, numerical example
+		std::vector<uint8_t> example = tests::from_hex("0001f203f4f5f6f7");
+		CHECK(inet_checksum_add(0, example.data(), example.size()) == 0xDDF2);
+		CHECK(inet_checksum(example.data(), example.size()) == 0x220D);
+
+		// An IPv4 header with its checksum field cleared, then with the checksum stored
+		std::vector<uint8_t> header = tests::from_hex("450000730000400040110000c0a80001c0a800c7");
+		CHECK(inet_checksum(header.data(), header.size()) == 0xB861);
+		header[10] = 0xB8;
+		header[11] = 0x61;
+		CHECK(inet_checksum(header.data(), header.size()) == 0);
+
+		CHECK(inet_checksum(nullptr, 0) == 0xFFFF);
+		const uint8_t odd[] = { 0x12 };
+		CHECK(inet_checksum(odd, 1) == static_cast<uint16_t>(~0x1200));
+	}
+
+	void test_lengths()
+	{
+		tests::random random(97);
+		std::vector<quadword_t> storage(24);
+		uint8_t* base = storage[0].bytes;
+		for (size_t i = 0; i < 16 * storage.size(); ++i)
+		{
+			uint32_t kind = random.next() % 4;
+			base[i] = static_cast<uint8_t>(kind == 0 ? 0xFF : kind == 1 ? 0 : random.next());
+		}
+
+		for (size_t offset = 0; offset < 16; ++offset)
+		{
+			for (size_t length = 0; length + offset <= 16 * storage.size(); length += 1 + length / 32)
+			{
+				const uint8_t* data = base + offset;
+				if (!CHECK(inet_checksum(data, length) == reference_checksum(data, length)))
+				{
+					std::fprintf(stderr, "  %zu bytes at offset %zu\n", length, offset);
+				}
+
+				// In parts of even lengths, the last one odd or even
+				uint32_t sum = 0;
+				size_t split = length / 3 & ~size_t(1);
+				sum = inet_checksum_add(sum, data, split);
+				sum = inet_checksum_add(sum, data + split, split);
+				sum = inet_checksum_add(sum, data + 2 * split, length - 2 * split);
+				CHECK(sum <= 0xFFFF && inet_checksum_finish(sum) == reference_checksum(data, length));
+			}
+		}
+	}
+
+	void test_long()
+	{
+		// More quadwords than one block of lanes sums, all ones to fill the lanes the most.
+		std::vector<quadword_t> storage(0x10000 + 7);
+		uint8_t* data = storage[0].bytes;
+		size_t length = 16 * storage.size();
+		std::fill(data, data + length, 0xFF);
+		data[length / 2] = 0x12;
+		CHECK(inet_checksum(data, length) == reference_checksum(data, length));
+		CHECK(inet_checksum(data + 1, length - 3) == reference_checksum(data + 1, length - 3));
+	}
+
+	void test_pseudo_header()
+	{
+		tests::random random(970);
+		for (int round = 0; round < 100; ++round)
+		{
+			uint32_t source = random.next();
+			uint32_t destination = round == 0 ? 0xFFFFFFFF : random.next();
+			uint8_t protocol = round % 2 == 0 ? 17 : 6;
+			uint16_t length = static_cast<uint16_t>(round == 0 ? 0xFFFF : random.next());
+			const uint8_t pseudo_header[12] = {
+				static_cast<uint8_t>(source >> 24), static_cast<uint8_t>(source >> 16),
+				static_cast<uint8_t>(source >> 8), static_cast<uint8_t>(source),
+				static_cast<uint8_t>(destination >> 24), static_cast<uint8_t>(destination >> 16),
+				static_cast<uint8_t>(destination >> 8), static_cast<uint8_t>(destination),
+				0, protocol, static_cast<uint8_t>(length >> 8), static_cast<uint8_t>(length),
+			};
+			uint32_t sum = inet_checksum_pseudo_header(source, destination, protocol, length);
+			CHECK(sum <= 0xFFFF && inet_checksum_finish(sum) == reference_checksum(pseudo_header, 12));
+		}
+	}
+
+	void test_update()
+	{
+		tests::random random(971);
+		std::vector<uint8_t> data(40);
+		for (uint8_t& b : data)
+		{
+			b = static_cast<uint8_t>(random.next());
+		}
+
+		uint16_t checksum = inet_checksum(data.data(), data.size());
+		for (int round = 0; round < 1000; ++round)
+		{
+			size_t i = 2 * (random.next() % (data.size() / 2));
+			uint16_t old_word = static_cast<uint16_t>(data[i] << 8 | data[i + 1]);
+			// Now and then the word that brings the sum to zero, the edge case of RFC 1624, 3
+			uint16_t new_word = static_cast<uint16_t>(round % 8 == 0 ? old_word + checksum : random.next());
+			data[i] = static_cast<uint8_t>(new_word >> 8);
+			data[i + 1] = static_cast<uint8_t>(new_word);
+
+			checksum = inet_checksum_update(checksum, old_word, new_word);
+			if (!CHECK(checksum == reference_checksum(data.data(), data.size())))
+			{
+				std::fprintf(stderr, "  round %d, %04x to %04x\n", round, old_word, new_word);
+				break;
+			}
+		}
+	}
+}
+
+int main()
+{
+	test_vectors();
+	test_lengths();
+	test_long();
+	test_pseudo_header();
+	test_update();
+	return tests::finish();
+}
@@ -0,0 +1,286 @@
+/*
+*	Batch overlap tests and sweep and prune against brute force, on random scenes and at the
+*	edges of the documented coordinate ranges.
+*/
+
+#include "check.h"
+
+#include <ps2kernels/collision.h>
+
+#include <algorithm>
+#include <cstdint>
+#include <utility>
+
+namespace
+{
+	struct alignas(16) quadword_t
+	{
+		int32_t lanes[4];
+	};
+
+	/// @brief An aligned stream with room for 'count' values of 'T', plus one quadword
+	template <typename T>
+	struct stream_t
+	{
+		explicit stream_t(size_t count) : storage(count * sizeof(T) / 16 + 2) {}
+
+		T* data() { return reinterpret_cast<T*>(storage.data()); }
+		T& operator[](size_t i) { return data()[i]; }
+
+		std::vector<quadword_t> storage;
+	};
+
+	template <typename T>
+	struct boxes_t
+	{
+		explicit boxes_t(size_t count)
+			: min{ stream_t<T>(count), stream_t<T>(count), stream_t<T>(count) },
+			  max{ stream_t<T>(count), stream_t<T>(count), stream_t<T>(count) }
+		{
+		}
+
+		stream_t<T> min[3];
+		stream_t<T> max[3];
+	};
+
+	template <typename T, typename Box>
+	bool overlap(const Box& box, boxes_t<T>& boxes, size_t i)
+	{
+		for (int axis = 0; axis < 3; ++axis)
+		{
+			if (box.min[axis] > boxes.max[axis][i] || boxes.min[axis][i] > box.max[axis])
+			{
+				return false;
+			}
+		}
+		return true;
+	}
+
+	/// @brief Compare the bit set and count from a batch test with the expected hits
+	bool check_hits(const std::vector<uint32_t>& hits, size_t total, const std::vector<bool>& expected)
+	{
+		size_t count = 0;
+		for (size_t i = 0; i < expected.size(); ++i)
+		{
+			if (((hits[i / 32] >> (i % 32)) & 1) != expected[i])
+			{
+				std::fprintf(stderr, "  %zu of %zu: %d instead of %d\n", i, expected.size(), !expected[i], int(expected[i]));
+				return false;
+			}
+			count += expected[i];
+		}
+		return total == count;
+	}
+
+	template <typename T, typename Box>
+	void random_boxes(tests::random& random, boxes_t<T>& boxes, Box& box, size_t count, int32_t range, int32_t size)
+	{
+		for (size_t i = 0; i <= count; ++i)
+		{
+			for (int axis = 0; axis < 3; ++axis)
+			{
+				int32_t min = random.range(-range, range - size);
+				int32_t max = min + random.range(0, size);
+				if (i == count)
+				{
+					box.min[axis] = static_cast<T>(min);
+					box.max[axis] = static_cast<T>(max);
+				}
+				else
+				{
+					boxes.min[axis][i] = static_cast<T>(min);
+					boxes.max[axis][i] = static_cast<T>(max);
+				}
+			}
+		}
+	}
+
+	void test_aabb()
+	{
+		tests::random random(86);
+		for (size_t count : { 0, 1, 3, 4, 7, 8, 9, 31, 32, 33, 100, 257 })
+		{
+			boxes_t<int32_t> boxes32(count);
+			aabb32_t box32;
+			// Ranges beyond 16 bits, sizes giving some hits and some misses
+			random_boxes(random, boxes32, box32, count, 1 << 20, 1 << 19);
+			aabb32_streams_t streams32 = {
+				{ boxes32.min[0].data(), boxes32.min[1].data(), boxes32.min[2].data() },
+				{ boxes32.max[0].data(), boxes32.max[1].data(), boxes32.max[2].data() },
+			};
+			std::vector<bool> expected(count);
+			for (size_t i = 0; i < count; ++i)
+			{
+				expected[i] = overlap(box32, boxes32, i);
+			}
+			std::vector<uint32_t> hits((count + 31) / 32);
+			CHECK(check_hits(hits, aabb32_overlap(&box32, &streams32, count, hits.data()), expected));
+
+			boxes_t<int16_t> boxes16(count);
+			aabb16_t box16;
+			random_boxes(random, boxes16, box16, count, 32768, 16384);
+			aabb16_streams_t streams16 = {
+				{ boxes16.min[0].data(), boxes16.min[1].data(), boxes16.min[2].data() },
+				{ boxes16.max[0].data(), boxes16.max[1].data(), boxes16.max[2].data() },
+			};
+			for (size_t i = 0; i < count; ++i)
+			{
+				expected[i] = overlap(box16, boxes16, i);
+			}
+			CHECK(check_hits(hits, aabb16_overlap(&box16, &streams16, count, hits.data()), expected));
+		}
+
+		// Touching boxes overlap, bounds at the edges of the types.
+		boxes_t<int32_t> edges(2);
+		for (int axis = 0; axis < 3; ++axis)
+		{
+			edges.min[axis][0] = INT32_MIN;
+			edges.max[axis][0] = 0;
+			edges.min[axis][1] = 1;
+			edges.max[axis][1] = INT32_MAX;
+		}
+		aabb32_streams_t streams = {
+			{ edges.min[0].data(), edges.min[1].data(), edges.min[2].data() },
+			{ edges.max[0].data(), edges.max[1].data(), edges.max[2].data() },
+		};
+		aabb32_t point = { { 0, 0, 0 }, { 0, 0, 0 } };
+		uint32_t hits = 0;
+		CHECK(aabb32_overlap(&point, &streams, 2, &hits) == 1 && hits == 1);
+		aabb32_t all = { { INT32_MIN, INT32_MIN, INT32_MIN }, { INT32_MAX, INT32_MAX, INT32_MAX } };
+		CHECK(aabb32_overlap(&all, &streams, 2, &hits) == 2 && hits == 3);
+	}
+
+	struct spheres_t
+	{
+		explicit spheres_t(size_t count) : x(count), y(count), z(count), radius(count) {}
+
+		sphere16_streams_t streams() { return { x.data(), y.data(), z.data(), radius.data() }; }
+
+		stream_t<int16_t> x, y, z, radius;
+	};
+
+	bool touches(const sphere16_t& a, spheres_t& b, size_t i)
+	{
+		int64_t dx = b.x[i] - a.x;
+		int64_t dy = b.y[i] - a.y;
+		int64_t dz = b.z[i] - a.z;
+		int64_t reach = b.radius[i] + a.radius;
+		return dx * dx + dy * dy + dz * dz <= reach * reach;
+	}
+
+	void test_spheres()
+	{
+		tests::random random(16);
+		for (size_t count : { 0, 1, 7, 8, 9, 40, 333 })
+		{
+			for (int32_t range : { 100, 16384 })
+			{
+				spheres_t spheres(count);
+				sphere16_t sphere = { static_cast<int16_t>(random.range(-range, range - 1)),
+									  static_cast<int16_t>(random.range(-range, range - 1)),
+									  static_cast<int16_t>(random.range(-range, range - 1)),
+									  static_cast<int16_t>(random.range(0, range - 1)) };
+				std::vector<bool> expected(count);
+				for (size_t i = 0; i < count; ++i)
+				{
+					spheres.x[i] = static_cast<int16_t>(random.range(-range, range - 1));
+					spheres.y[i] = static_cast<int16_t>(random.range(-range, range - 1));
+					spheres.z[i] = static_cast<int16_t>(random.range(-range, range - 1));
+					spheres.radius[i] = static_cast<int16_t>(random.range(0, range / 2));
+					expected[i] = touches(sphere, spheres, i);
+				}
+				sphere16_streams_t streams = spheres.streams();
+				std::vector<uint32_t> hits((count + 31) / 32);
+				CHECK(check_hits(hits, sphere16_overlap(&sphere, &streams, count, hits.data()), expected));
+			}
+		}
+
+		// Opposite corners of the documented range, where the squared distance exceeds
+		// INT32_MAX, and spheres exactly touching
+		spheres_t corners(3);
+		const int16_t lanes[3][4] = { { 16383, 16383, 16383, 0 }, { 3, 4, 0, 2 }, { 16383, 16383, 16383, 16383 } };
+		for (size_t i = 0; i < 3; ++i)
+		{
+			corners.x[i] = lanes[i][0];
+			corners.y[i] = lanes[i][1];
+			corners.z[i] = lanes[i][2];
+			corners.radius[i] = lanes[i][3];
+		}
+		sphere16_streams_t streams = corners.streams();
+		sphere16_t far = { -16384, -16384, -16384, 0 };
+		uint32_t hits = 0;
+		CHECK(sphere16_overlap(&far, &streams, 1, &hits) == 0 && hits == 0);
+		sphere16_t origin = { 0, 0, 0, 3 };
+		CHECK(sphere16_overlap(&origin, &streams, 2, &hits) == 1 && hits == 2);
+		far.radius = 16383;
+		std::vector<bool> expected = { touches(far, corners, 0), touches(far, corners, 1), touches(far, corners, 2) };
+		std::vector<uint32_t> words(1);
+		CHECK(check_hits(words, sphere16_overlap(&far, &streams, 3, words.data()), expected));
+	}
+
+	void test_sweep_and_prune()
+	{
+		tests::random random(1986);
+		for (size_t count : { 0, 1, 2, 5, 17, 64, 500 })
+		{
+			boxes_t<int32_t> boxes(count);
+			aabb32_t unused;
+			random_boxes(random, boxes, unused, count, 10000, 1500);
+			// Shared minima, so that sorting ties are covered
+			for (size_t i = 1; i < count; i += 7)
+			{
+				boxes.min[0][i] = boxes.min[0][i - 1];
+			}
+			aabb32_streams_t streams = {
+				{ boxes.min[0].data(), boxes.min[1].data(), boxes.min[2].data() },
+				{ boxes.max[0].data(), boxes.max[1].data(), boxes.max[2].data() },
+			};
+
+			std::vector<std::pair<uint32_t, uint32_t>> expected;
+			for (size_t a = 0; a < count; ++a)
+			{
+				aabb32_t box = { { boxes.min[0][a], boxes.min[1][a], boxes.min[2][a] },
+								 { boxes.max[0][a], boxes.max[1][a], boxes.max[2][a] } };
+				for (size_t b = a + 1; b < count; ++b)
+				{
+					if (overlap(box, boxes, b))
+					{
+						expected.emplace_back(uint32_t(a), uint32_t(b));
+					}
+				}
+			}
+
+			std::vector<quadword_t> work(aabb32_sweep_and_prune_work_size(count) / 16 + 1);
+			std::vector<collision_pair_t> pairs(expected.size() + 1);
+			size_t found = aabb32_sweep_and_prune(&streams, count, work.data(), pairs.data(), pairs.size());
+			std::vector<std::pair<uint32_t, uint32_t>> result;
+			bool ordered = true;
+			for (size_t i = 0; i < std::min(found, pairs.size()); ++i)
+			{
+				uint32_t a = pairs[i].a;
+				uint32_t b = pairs[i].b;
+				ordered &= boxes.min[0][a] <= boxes.min[0][b];
+				result.emplace_back(std::min(a, b), std::max(a, b));
+			}
+			std::sort(result.begin(), result.end());
+			if (!CHECK(found == expected.size() && result == expected && ordered))
+			{
+				std::fprintf(stderr, "  %zu boxes: %zu pairs instead of %zu\n", count, found, expected.size());
+			}
+
+			// The count goes on past the capacity.
+			if (!expected.empty())
+			{
+				CHECK(aabb32_sweep_and_prune(&streams, count, work.data(), pairs.data(), 1) == expected.size());
+			}
+		}
+	}
+}
+
+int main()
+{
+	test_aabb();
+	test_spheres();
+	test_sweep_and_prune();
+	return tests::finish();
+}
@@ -0,0 +1,275 @@
+/*
+*	Inflate against zlib streams: stored, fixed and dynamic Huffman blocks, zlib and raw, with the
+*	input split into small pieces and windows small enough to slide. Corrupted and truncated
+*	streams must be reported. When built with zlib, streams compressed at every level are
+*	checked too.
+*/
+
+#include "check.h"
+
+#include <ps2kernels/inflate.h>
+
+#include <cstring>
+
+#ifdef PS2INTRIN_TEST_ZLIB
+#include <zlib.h>
+#endif
+
+namespace
+{
+	struct alignas(16) quadword_t
+	{
+		uint8_t bytes[16];
+	};
+
+	struct result_t
+	{
+		inflate_status_t status;
+		std::vector<uint8_t> output;
+	};
+
+	/// @brief Inflate a whole stream, handing it over 'piece' more bytes at a time
+	result_t inflate_stream(const std::vector<uint8_t>& stream, bool zlib, size_t window_size, size_t piece)
+	{
+		std::vector<quadword_t> window(window_size / 16);
+		alignas(16) inflate_t context;
+		inflate_init(&context, window[0].bytes, window_size, zlib);
+
+		result_t result;
+		size_t offset = 0;
+		size_t end = 0;
+		for (;;)
+		{
+			end = end + piece < stream.size() ? end + piece : stream.size();
+			size_t start = context.position;
+			size_t consumed = 0;
+			result.status = inflate_run(&context, stream.data() + offset, end - offset, &consumed);
+			offset += consumed;
+			result.output.insert(result.output.end(), window[0].bytes + start, window[0].bytes + context.position);
+
+			if (result.status == INFLATE_WINDOW_FULL)
+			{
+				inflate_slide(&context);
+			}
+			else if (result.status != INFLATE_NEED_INPUT || end == stream.size())
+			{
+				return result;
+			}
+		}
+	}
+
+	/// @brief Words of the dynamic Huffman stream, segments of 300 words from 5 seeds
+	std::vector<uint8_t> words_text()
+	{
+		const char* words[] = { "alpha", "beta", "gamma", "delta", "epsilon", "zeta", "eta", "theta" };
+		std::string text;
+		for (uint32_t segment = 0; segment < 60; ++segment)
+		{
+			uint32_t x = segment % 5 + 1;
+			for (int i = 0; i < 300; ++i)
+			{
+				x = (x * 1103515245u + 12345u) & 0x7FFFFFFF;
+				text += text.empty() ? "" : " ";
+				text += words[(x >> 16) % 8];
+			}
+		}
+		return std::vector<uint8_t>(text.begin(), text.end());
+	}
+
+	/// zlib, level 9, of 'words_text()'
+	const char* words_stream =
+		"78daedda4d8e1c370c06d0abe46a23a41107b01303c94aa74f9cb63d14f9a907d9bf85c7f3d35d5592288a52bfc7df6f"
+		"bf3cfefdb7be7df9f5f1b97dfdededcb971fdf3fbefef5fbe73ffff8efe5fbdb97bf3f3deaafbfffbfdeffd4bffdf1ef"
+		"79d5e71fead7f6f2e7cbde3e7ffdf4765efdf987477cd6fdf3ede71b7ffcbfd34df7a35de5f9355ca6be283cf2ea577f"
+		"bfc7fb2d9e57dc3f6f7c5eedfb4fa5b36b2faf9fef3aaf5e1ef5f9f579abf268e5aee5db552ffe7c4f79a6fabcabffba"
+		"f4f7fbb3945ff6511a9759bd7175c0d7fcc3cfa6aff39ead17f6d993e7f8ed39a46718978990ee551eaef46dedecfede"
+		"3edabb055c79fd1cd610c767f7d56bac5bdbea78d51819cf5eae5087b33c627963e984dd86be5ee23133ccf974231a7b"
+		"de69913d06bee7a534ee3504478bcf30bbf5568bf47d7b8e74e3b3dd7d6684f9d77a624ec712416b74f3d9c1ab757f9b"
+		"4d29c7d73978be3964fe128e7d42d65edce70cad8bc04c287331297f1d53b13d5eead5f4bb36df6a8a8819733cc2f8c5"
+		"cca6e929ea98f609758e401de0b980ed1efef9d675502e332066f13008213eea5c2f8fb5da10d51b978e1d39b3f6f4c8"
+		"3e3be6dd94ec56bf568a827d4e9a63d84b845cbbf1483467463cfa2e5d615448694ee5714acbc31cd791bac630a49a66"
+		"cf9068ed3b6aa6a3272fcbd2088d9efede87362cfd63b6d516ecbe80cd9a66dd1a54e2641d8ddb63c13913fbf1c4bdbc"
+		"2c2de88be2b554abc17e464179c631176ab4c78c9457c85640eff322b7fc3416bb9d66caea1364cce890e2dab0d46ea8"
+		"df8f36b7b52f4da27dae0d2169be4fa51c14338e7b9cce3dd33e274d08e49a32f71176abdda287d72c6362889e75c6dc"
+		"3a1caddfb9cc68b93464ce9de7d97a84747dbcac4f92d4bad847bd3b3e48c5a3cabe5587730c7a9f84bdded9236d5e7d"
+		"bc2acf3273ccf3d0e7b7bc9156c2e38d63e50d0fdeb726bb4dea1471af12f108f9347e25c6e69ee3bd43ebfc9ef3ec55"
+		"f887fc98aa9cd9c41a82eb0c8f1e1a2b1d7784ceee3b98b9e4f7168fd939334bd8e1d6de4b0bdbac46e734eaebfe18b3"
+		"b4d54c65e2add24f9ba291db430e9ba5d9b1bec66cfede9899b0f3a94be8d5f5a2be7cb9758ed56068539d41f3ce7db1"
+		"7a7594b6af8731972818d965a5c57356bf3b16272bee907b7ee97b9fb9cb9d65f0d83bf6226456c2335e5ab5da83e3ba"
+		"0ac4926f3c57ebbf7eb6591f3e84f8a5c99715f73284a1da4ac54bac16db715a9aa5b74389753952c95d962ade749f95"
+		"b60ae305e1cc63a69451c3d597b4e472d9ed97d786c386b44c846a7ec6f8abcaed520daf5707b82feba699a7e2114d5a"
+		"e9e6e6721cff7c30316a94cdf4753df718bd372670dadba626c45c782be95e2cb273e15c2f0e8a67c0a6cdd2257ac3d6"
+		"e5d675e7e8f713c03c84732ea4be5cb1b7528c7f74e8355ab97383fbd978687aecb4f8a7dba71ea9a9a174db69dee574"
+		"3702bfdf7f444bff54646e246ec15dcac10fb61ab7b8a8b3727e9f1a7bffa460a5d3ff79d13ac61f455dd8047d1c7297"
+		"f23b9ce0afdba9676ffe8e8702e9e797e71bb303c649600fd4eb19e22842d3fe2a1e9e8472a665c5b9df4ac5e9283fe6"
+		"fe2955ae630d9cfd319e33ed2c2e1fd97eb4319e717bbdcf8efb9fdb29cae888f5eaa381f8316428c5f66533dfb35c5e"
+		"46e6de20ad84f715f4d50ebbef43ae1bf317c78cf7cfd7671f0c43303702b9ccdf8ffc19eb396d7261998f2e56fcc8b3"
+		"4fbc170db915a773123c180d4683d16034180d4683d16034180d4683d16034180d4683d16034180d4683d16034180d46"
+		"83d16034180d4683d16034180d4683d16034180d4683d16034180d4683d16034180d4683d16034180d4683d16034180d"
+		"4683d16034180d4683d16034180d4683d16034180d4683d16034180d4683d16034180d4683d16034180d4683d1603418"
+		"0d4683d16034180d4683d16034180d4683d16034180d4683d16034180d4683d16034180d4683d16034180d4683d16034"
+		"180d4683d16034180d4683d16034180d4683d16034180d4683d16034180d4683d16034180d4683d16034180d4683d160"
+		"34180d4683d16034180d4683d16034180d4683d16034180d4683d16034180d4683d16034180d4683d16034180d4683d1"
+		"6034180d4683d16034180d4683d16034180d4683d16034180d4683d16034180d4683d16034180d4683d16034180d4683"
+		"d16034180d4683d16034180d4683d16034180d4683d16034180d4683d16034180d4683d16034180d4683d16034180d46"
+		"83d16034180d4683d16034180d4683d16034180d4683d16034180d4683d16034180d4683d16034180d4683d16034180d"
+		"4683d16034180d4683d16034180d4683d16034180d4683d16034180d4683d16034180d4683d16034180d4683d1603418"
+		"0d4683d16034180d4683d16034180d4683d16034180d4683d16034180d4683d16034180d4683d16034180d4683d16034"
+		"180d4683d16034180d4683d16034180d4683d16034180d4683d16034180d4683d16034180d4683d16034180d4683d160"
+		"34180d4683d16034180d4683d16034180d4683d16034180d4683d16034180d4683d16034180d4683d16034180d4683d1"
+		"6034180d4683d16034180d4683d16034180d4683d16034180d4683d1f83f46e31f0c4e4cb3";
+
+	const std::string quick = "The quick brown fox jumps over the lazy dog. ";
+
+	void test_vectors()
+	{
+		std::vector<uint8_t> text(quick.begin(), quick.end());
+		std::vector<uint8_t> triple;
+		for (int i = 0; i < 3; ++i)
+		{
+			triple.insert(triple.end(), text.begin(), text.end());
+		}
+
+		// zlib levels 0 and 9 (stored and fixed Huffman blocks), raw deflate of 3 copies and a raw
+		// stored block
+		std::vector<uint8_t> stored = tests::from_hex(
+			"7801012d00d2ff54686520717569636b2062726f776e20666f78206a756d7073206f7665722074686520"
+			"6c617a7920646f672e207c0c1028");
+		std::vector<uint8_t> fixed = tests::from_hex(
+			"78da0bc94855282ccd4cce56482aca2fcf5348cbaf50c82acd2d2856c82f4b2d5228014ae72456552aa4"
+			"e4a7eb2900007c0c1028");
+		std::vector<uint8_t> raw = tests::from_hex(
+			"0bc94855282ccd4cce56482aca2fcf5348cbaf50c82acd2d2856c82f4b2d5228014ae72456552aa4e4a7"
+			"eb2984d04c3100");
+
+		for (size_t piece : { size_t(1), size_t(3), size_t(1000) })
+		{
+			result_t result = inflate_stream(stored, true, 256, piece);
+			CHECK(result.status == INFLATE_DONE && result.output == text);
+			result = inflate_stream(fixed, true, 256, piece);
+			CHECK(result.status == INFLATE_DONE && result.output == text);
+			result = inflate_stream(raw, false, 256, piece);
+			CHECK(result.status == INFLATE_DONE && result.output == triple);
+			result = inflate_stream(tests::from_hex("010500faff68656c6c6f"), false, 256, piece);
+			CHECK(result.status == INFLATE_DONE && result.output == tests::from_hex("68656c6c6f"));
+		}
+	}
+
+	void test_dynamic()
+	{
+		std::vector<uint8_t> text = words_text();
+		std::vector<uint8_t> stream = tests::from_hex(words_stream);
+
+		// The whole output in the window, then windows that slide many times.
+		const size_t windows[] = { (text.size() + 15) & ~size_t(15), INFLATE_HISTORY + 16, 2 * INFLATE_HISTORY };
+		for (size_t window : windows)
+		{
+			for (size_t piece : { size_t(1), size_t(61), stream.size() })
+			{
+				result_t result = inflate_stream(stream, true, window, piece);
+				if (!CHECK(result.status == INFLATE_DONE && result.output == text))
+				{
+					std::fprintf(stderr, "  window of %zu bytes, pieces of %zu bytes\n", window, piece);
+				}
+			}
+		}
+	}
+
+	void test_errors()
+	{
+		std::vector<uint8_t> stream = tests::from_hex(words_stream);
+		size_t window = 2 * INFLATE_HISTORY;
+
+		// Adler-32 trailer
+		std::vector<uint8_t> corrupted = stream;
+		corrupted.back() ^= 1;
+		CHECK(inflate_stream(corrupted, true, window, corrupted.size()).status == INFLATE_ERROR);
+
+		// Header check bits, then a preset dictionary, which is not supported
+		corrupted = stream;
+		corrupted[1] ^= 1;
+		CHECK(inflate_stream(corrupted, true, window, corrupted.size()).status == INFLATE_ERROR);
+		CHECK(inflate_stream(tests::from_hex("78bb"), true, window, 2).status == INFLATE_ERROR);
+
+		// Reserved block type, stored block length not matching its complement
+		CHECK(inflate_stream(tests::from_hex("07"), false, window, 1).status == INFLATE_ERROR);
+		CHECK(inflate_stream(tests::from_hex("010500fbff68656c6c6f"), false, window, 10).status == INFLATE_ERROR);
+
+		// Distance past the start of the output: fixed block, match of length 3 at distance 1
+		CHECK(inflate_stream(tests::from_hex("030200"), false, window, 3).status == INFLATE_ERROR);
+
+		for (size_t cut : { size_t(0), size_t(1), size_t(2), size_t(100), stream.size() - 1 })
+		{
+			std::vector<uint8_t> truncated(stream.begin(), stream.begin() + cut);
+			CHECK(inflate_stream(truncated, true, window, 7).status == INFLATE_NEED_INPUT);
+		}
+	}
+
+#ifdef PS2INTRIN_TEST_ZLIB
+	std::vector<uint8_t> compress(const std::vector<uint8_t>& data, int level, bool zlib)
+	{
+		z_stream z = {};
+		deflateInit2(&z, level, Z_DEFLATED, zlib ? 15 : -15, 9, Z_DEFAULT_STRATEGY);
+		std::vector<uint8_t> stream(deflateBound(&z, static_cast<uLong>(data.size())));
+		z.next_in = const_cast<Bytef*>(data.data());
+		z.avail_in = static_cast<uInt>(data.size());
+		z.next_out = stream.data();
+		z.avail_out = static_cast<uInt>(stream.size());
+		deflate(&z, Z_FINISH);
+		stream.resize(z.total_out);
+		deflateEnd(&z);
+		return stream;
+	}
+
+	void test_zlib()
+	{
+		// Skewed byte frequencies give codes longer than the lookup table, runs give long matches.
+		tests::random random(98);
+		std::vector<uint8_t> data;
+		while (data.size() < 200000)
+		{
+			uint32_t r = random.next();
+			if (r % 8 == 0 && data.size() > 300)
+			{
+				size_t distance = 1 + random.next() % (data.size() < 40000 ? data.size() : 40000);
+				size_t length = 3 + random.next() % 300;
+				for (size_t k = 0; k < length; ++k)
+				{
+					data.push_back(data[data.size() - distance]);
+				}
+			}
+			else
+			{
+				data.push_back(static_cast<uint8_t>(__builtin_ctz(r | 0x8000) * 16 + (r >> 28)));
+			}
+		}
+
+		for (int level = 0; level <= 9; ++level)
+		{
+			for (bool zlib : { true, false })
+			{
+				std::vector<uint8_t> stream = compress(data, level, zlib);
+				for (size_t window : { size_t(INFLATE_HISTORY + 48), (data.size() + 15) & ~size_t(15) })
+				{
+					result_t result = inflate_stream(stream, zlib, window, 4093);
+					if (!CHECK(result.status == INFLATE_DONE && result.output == data))
+					{
+						std::fprintf(stderr, "  level %d, %s, window of %zu bytes\n", level, zlib ? "zlib" : "raw", window);
+					}
+				}
+			}
+		}
+	}
+#endif
+}
+
+int main()
+{
+	test_vectors();
+	test_dynamic();
+	test_errors();
+#ifdef PS2INTRIN_TEST_ZLIB
+	test_zlib();
+#endif
+	return tests::finish();
+}
@@ -0,0 +1,191 @@
+/*
+*	The 128-bit register pair arithmetic of 'int128.h' against the compiler's '__int128', on
+*	random values and the edges of every carry, shift and sign.
+*/
+
+#include "check.h"
+
+#include <ps2intrin.h>
+
+namespace
+{
+	using u128 = unsigned __int128;
+	using i128 = __int128;
+
+	u128 value(pair_u128_t v)
+	{
+		return static_cast<u128>(v.hi) << 64 | v.lo;
+	}
+
+	i128 value(pair_i128_t v)
+	{
+		return static_cast<i128>(value(pair_castu128_i128(v)));
+	}
+
+	pair_u128_t pair(u128 v)
+	{
+		return pair_set_u128(static_cast<uint64_t>(v >> 64), static_cast<uint64_t>(v));
+	}
+
+	pair_i128_t pair(i128 v)
+	{
+		return pair_casti128_u128(pair(static_cast<u128>(v)));
+	}
+
+	/// @brief Random values and the ones next to every carry and sign edge
+	std::vector<u128> operands()
+	{
+		const uint64_t edges[] = { 0, 1, 2, 0x7FFFFFFF, 0x80000000, 0xFFFFFFFF, 0x100000000,
+								   0x7FFFFFFFFFFFFFFF, 0x8000000000000000, 0xFFFFFFFFFFFFFFFE, 0xFFFFFFFFFFFFFFFF };
+		std::vector<u128> all;
+		for (uint64_t hi : edges)
+		{
+			for (uint64_t lo : edges)
+			{
+				all.push_back(static_cast<u128>(hi) << 64 | lo);
+			}
+		}
+		tests::random random(92);
+		for (int k = 0; k < 200; ++k)
+		{
+			uint64_t hi = static_cast<uint64_t>(random.next()) << 32 | random.next();
+			uint64_t lo = static_cast<uint64_t>(random.next()) << 32 | random.next();
+			// Short values too, for the division paths
+			all.push_back((static_cast<u128>(hi) << 64 | lo) >> (random.next() % 128));
+		}
+		return all;
+	}
+
+	void test_conversions()
+	{
+		u128 v = static_cast<u128>(0x0123456789ABCDEF) << 64 | 0xFEDCBA9876543210;
+		pair_u128_t p = pair_from_u128(v);
+		CHECK(p.hi == 0x0123456789ABCDEF && p.lo == 0xFEDCBA9876543210);
+		CHECK(pair_to_u128(p) == v);
+		CHECK(value(pair_casti128_u128(pair_set_u128(~0ull, 5))) == -(static_cast<i128>(1) << 64) + 5);
+
+		alignas(16) uint128_t memory[2] = {};
+		mm_store_pair_u128(&memory[1], p);
+		CHECK(memory[1] == v && memory[0] == 0);
+		CHECK(value(mm_load_pair_u128(&memory[1])) == v);
+	}
+
+	void test_add_sub()
+	{
+		std::vector<u128> all = operands();
+		for (u128 a : all)
+		{
+			for (u128 b : all)
+			{
+				bool passed = CHECK(value(add_u128(pair(a), pair(b))) == a + b);
+				passed &= CHECK(value(sub_u128(pair(a), pair(b))) == a - b);
+				for (uint64_t in : { 0, 1 })
+				{
+					uint64_t carry = in;
+					u128 sum = a + b + in;
+					passed &= CHECK(value(addc_u128(pair(a), pair(b), &carry)) == sum);
+					passed &= CHECK(carry == (sum < a || (sum == a && (b != 0 || in != 0))));
+
+					uint64_t borrow = in;
+					passed &= CHECK(value(subb_u128(pair(a), pair(b), &borrow)) == a - b - in);
+					passed &= CHECK(borrow == (a < b || (a == b && in != 0)));
+				}
+				passed &= CHECK(cmpeq_u128(pair(a), pair(b)) == (a == b));
+				passed &= CHECK(cmplt_u128(pair(a), pair(b)) == (a < b));
+				passed &= CHECK(cmplt_i128(pair(static_cast<i128>(a)), pair(static_cast<i128>(b))) ==
+								(static_cast<i128>(a) < static_cast<i128>(b)));
+				if (!passed)
+				{
+					std::fprintf(stderr, "  %016llx%016llx, %016llx%016llx\n", static_cast<unsigned long long>(a >> 64),
+								 static_cast<unsigned long long>(a), static_cast<unsigned long long>(b >> 64),
+								 static_cast<unsigned long long>(b));
+					return;
+				}
+			}
+		}
+	}
+
+	void test_shifts()
+	{
+		for (u128 v : operands())
+		{
+			for (unsigned amount = 0; amount < 128; ++amount)
+			{
+				bool passed = CHECK(value(sll_u128(pair(v), amount)) == v << amount);
+				passed &= CHECK(value(srl_u128(pair(v), amount)) == v >> amount);
+				passed &= CHECK(value(sra_i128(pair(static_cast<i128>(v)), amount)) == static_cast<i128>(v) >> amount);
+				if (!passed)
+				{
+					std::fprintf(stderr, "  shift by %u\n", amount);
+					return;
+				}
+			}
+		}
+	}
+
+	void test_multiply()
+	{
+		lohi_state_t state;
+		lohi_state_construct(&state);
+
+		std::vector<u128> all = operands();
+		for (u128 a : all)
+		{
+			for (u128 b : all)
+			{
+				uint64_t x = static_cast<uint64_t>(a);
+				uint64_t y = static_cast<uint64_t>(b >> 64);
+				bool passed = CHECK(value(mul_u64(&state, x, y)) == static_cast<u128>(x) * y);
+				passed &= CHECK(value(mul_i64(&state, static_cast<int64_t>(x), static_cast<int64_t>(y))) ==
+								static_cast<i128>(static_cast<int64_t>(x)) * static_cast<int64_t>(y));
+				if (!passed)
+				{
+					std::fprintf(stderr, "  %016llx * %016llx\n", static_cast<unsigned long long>(x),
+								 static_cast<unsigned long long>(y));
+					lohi_state_destruct(&state);
+					return;
+				}
+			}
+		}
+
+		lohi_state_destruct(&state);
+	}
+
+	void test_divide()
+	{
+		for (unsigned bit = 0; bit < 64; ++bit)
+		{
+			CHECK(clz_u64(1ull << bit) == 63 - bit);
+			CHECK(clz_u64(~0ull >> bit) == bit);
+		}
+		CHECK(clz_u64(0) == 64);
+
+		std::vector<u128> all = operands();
+		for (u128 a : all)
+		{
+			for (u128 b : all)
+			{
+				// Divisors of every length, including ones above the high half of the dividend
+				uint64_t divisor = static_cast<uint64_t>(b);
+				divisor |= divisor == 0;
+				divrem_u128_result_t result = divrem_u128(pair(a), divisor);
+				if (!CHECK(value(result.quotient) == a / divisor && result.remainder == a % divisor))
+				{
+					std::fprintf(stderr, "  %016llx%016llx / %016llx\n", static_cast<unsigned long long>(a >> 64),
+								 static_cast<unsigned long long>(a), static_cast<unsigned long long>(divisor));
+					return;
+				}
+			}
+		}
+	}
+}
+
+int main()
+{
+	test_conversions();
+	test_add_sub();
+	test_shifts();
+	test_multiply();
+	test_divide();
+	return tests::finish();
+}
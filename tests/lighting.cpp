@@ -0,0 +1,171 @@
+/*
+*	Vertex lighting against a floating-point reference of the documented formula, with
+*	directional and point lights, prelit and ambient colors and saturation.
+*/
+
+#include "check.h"
+
+#include <ps2kernels/lighting.h>
+
+#include <algorithm>
+#include <cmath>
+#include <cstdlib>
+
+namespace
+{
+	struct alignas(16) quadword_t
+	{
+		int16_t lanes[8];
+	};
+
+	/// @brief Random unit vector in Q1.14
+	void unit(tests::random& random, int16_t* v)
+	{
+		double x, y, z, length;
+		do
+		{
+			x = random.range(-1000, 1000);
+			y = random.range(-1000, 1000);
+			z = random.range(-1000, 1000);
+			length = std::sqrt(x * x + y * y + z * z);
+		} while (length < 100 || length > 1000);
+		v[0] = static_cast<int16_t>(std::lrint(x / length * 16384));
+		v[1] = static_cast<int16_t>(std::lrint(y / length * 16384));
+		v[2] = static_cast<int16_t>(std::lrint(z / length * 16384));
+	}
+
+	/// @brief Light one vertex in 'double', colors unclamped
+	void reference(const int16_t* normal, const int16_t* position, uint32_t base, const std::vector<light_t>& lights,
+				   double color[4])
+	{
+		for (int c = 0; c < 4; ++c)
+		{
+			color[c] = base >> (8 * c) & 0xFF;
+		}
+		for (const light_t& light : lights)
+		{
+			double intensity = 0;
+			for (int c = 0; c < 3; ++c)
+			{
+				intensity += normal[c] / 16384.0 * light.direction[c] / 16384.0;
+			}
+			intensity = std::clamp(intensity, 0.0, 32767 / 32768.0);
+			if (light.radius > 0)
+			{
+				double d2 = 0;
+				for (int c = 0; c < 3; ++c)
+				{
+					double d = light.position[c] - position[c];
+					d2 += d * d;
+				}
+				intensity *= std::max(0.0, 1 - d2 / (double(light.radius) * light.radius));
+			}
+			for (int c = 0; c < 3; ++c)
+			{
+				color[c] += light.color[c] * intensity;
+			}
+		}
+	}
+
+	void check_lighting(tests::random& random, size_t count, size_t light_count, bool prelit, bool points)
+	{
+		std::vector<quadword_t> normals(count / 2 + 1);
+		std::vector<quadword_t> positions(count / 2 + 1);
+		std::vector<quadword_t> colors(count / 4 + 1);
+		std::vector<quadword_t> output(count / 4 + 2);
+		int16_t* n = normals[0].lanes;
+		int16_t* p = positions[0].lanes;
+		uint32_t* base = reinterpret_cast<uint32_t*>(colors[0].lanes);
+		uint32_t* out = reinterpret_cast<uint32_t*>(output[0].lanes);
+		for (size_t i = 0; i < count; ++i)
+		{
+			unit(random, n + 4 * i);
+			for (int c = 0; c < 3; ++c)
+			{
+				p[4 * i + c] = static_cast<int16_t>(random.range(-2000, 2000));
+			}
+			base[i] = random.next() & 0xFF3F3F3F;
+		}
+		uint32_t ambient = 0x80201008;
+
+		std::vector<light_t> lights(light_count);
+		for (light_t& light : lights)
+		{
+			unit(random, light.direction);
+			bool point = points && random.next() % 2;
+			for (int c = 0; c < 3; ++c)
+			{
+				light.position[c] = static_cast<int16_t>(random.range(-2000, 2000));
+				light.color[c] = static_cast<uint8_t>(random.next());
+			}
+			light.radius = static_cast<int16_t>(point ? random.range(1, LIGHT_MAX_RADIUS) : 0);
+		}
+
+		lighting_input_t input = { n, points ? p : nullptr, prelit ? base : nullptr };
+		std::fill(output.begin(), output.end(), quadword_t{ { -1, -1, -1, -1, -1, -1, -1, -1 } });
+		light_vertices(&input, lights.data(), light_count, ambient, out, count);
+
+		for (size_t i = 0; i < count; ++i)
+		{
+			double expected[4];
+			reference(n + 4 * i, p + 4 * i, prelit ? base[i] : ambient, lights, expected);
+			for (int c = 0; c < 4; ++c)
+			{
+				// Every light truncates to 4 fraction bits, the sum to an integer.
+				double actual = out[i] >> (8 * c) & 0xFF;
+				double clamped = std::min(expected[c], 255.0);
+				bool passed = actual <= clamped + 1e-9 && actual >= std::floor(clamped) - 1 - light_count / 8.0;
+				if (!CHECK(passed))
+				{
+					std::fprintf(stderr, "  %zu vertices, %zu lights, vertex %zu, channel %d: %g instead of %.3f\n", count,
+								 light_count, i, c, actual, expected[c]);
+					return;
+				}
+			}
+		}
+		// Nothing is written past the last vertex.
+		CHECK(out[count] == 0xFFFFFFFF);
+	}
+
+	void test_lighting()
+	{
+		tests::random random(89);
+		for (size_t count : { 1, 3, 4, 5, 64, 101 })
+		{
+			for (size_t light_count : { 0, 1, 2, 5, LIGHT_MAX_COUNT })
+			{
+				check_lighting(random, count, light_count, false, false);
+				check_lighting(random, count, light_count, true, false);
+				check_lighting(random, count, light_count, true, true);
+			}
+		}
+	}
+
+	void test_exact()
+	{
+		// A directional light straight on the first normal and 45 degrees off the second. Full
+		// intensity is just below 1, so 255 gives 254.
+		alignas(16) int16_t normals[8] = { 0, 0, 16384, 0, 11585, 0, 11585, 0 };
+		alignas(16) int16_t positions[8] = { 0, 0, 0, 0, 500, 0, 0, 0 };
+		alignas(16) uint32_t colors[4] = { 0xFF000000, 0x00000010, 0, 0 };
+		alignas(16) uint32_t out[4];
+		light_t directional = { { 0, 0, 16384 }, { 0, 0, 0 }, 0, { 255, 128, 64 } };
+		lighting_input_t input = { normals, positions, colors };
+		light_vertices(&input, &directional, 1, 0, out, 2);
+		CHECK(out[0] == 0xFF3F7FFE);
+		CHECK(out[1] == 0x002D5AC4);
+
+		// A point light at half its radius from the second vertex, 3/4 of 200 * cos(45)
+		light_t point = { { 16384, 0, 0 }, { 0, 0, 0 }, 1000, { 200, 0, 0 } };
+		light_vertices(&input, &point, 1, 0, out, 2);
+		CHECK(out[0] == 0xFF000000);
+		CHECK(out[1] >= 0x00000010 + 104 && out[1] <= 0x00000010 + 106);
+	}
+}
+
+int main()
+{
+	test_lighting();
+	test_exact();
+	return tests::finish();
+}
@@ -0,0 +1,198 @@
+/*
+*	LZ4 round trips at every effort. Compressed blocks are also walked by an independent decoder
+*	that checks the end of block rules of the format, so other LZ4 decoders accept them.
+*	Hand-made blocks check the decompressor, including malformed ones.
+*/
+
+#include "check.h"
+
+#include <ps2kernels/lz4.h>
+
+#include <cstring>
+#include <stdexcept>
+
+namespace
+{
+	lz4_workspace_t workspace;
+
+	/// @brief Decode a block the plain way, checking the format rules of the reference decoder
+	/// @return False if the block breaks a rule or does not decode to 'expected'
+	bool check_block(const std::vector<uint8_t>& block, const std::vector<uint8_t>& expected)
+	{
+		std::vector<uint8_t> output;
+		size_t i = 0;
+		auto length = [&](size_t value) {
+			if (value == 15)
+			{
+				uint8_t byte;
+				do
+				{
+					byte = block.at(i++);
+					value += byte;
+				} while (byte == 255);
+			}
+			return value;
+		};
+
+		try
+		{
+			for (;;)
+			{
+				uint8_t token = block.at(i++);
+				size_t literals = length(token >> 4);
+				if (i + literals > block.size())
+				{
+					return false;
+				}
+				output.insert(output.end(), block.begin() + i, block.begin() + i + literals);
+				i += literals;
+				if (i == block.size())
+				{
+					break;
+				}
+
+				size_t distance = block.at(i) | static_cast<size_t>(block.at(i + 1)) << 8;
+				i += 2;
+				size_t match = length(token & 15) + 4;
+				// The last match starts 12 bytes or more before the end, the last 5 bytes are
+				// literals.
+				if (distance == 0 || distance > output.size() || output.size() + 12 > expected.size() ||
+					output.size() + match + 5 > expected.size())
+				{
+					return false;
+				}
+				for (size_t k = 0; k < match; ++k)
+				{
+					output.push_back(output[output.size() - distance]);
+				}
+			}
+		}
+		catch (const std::out_of_range&)
+		{
+			return false;
+		}
+		return output == expected;
+	}
+
+	std::vector<uint8_t> compress(const std::vector<uint8_t>& data, unsigned effort)
+	{
+		std::vector<uint8_t> block(LZ4_COMPRESSED_SIZE(data.size()));
+		block.resize(lz4_compress(data.data(), data.size(), block.data(), block.size(), effort, &workspace));
+		return block;
+	}
+
+	std::vector<std::vector<uint8_t>> inputs()
+	{
+		std::vector<std::vector<uint8_t>> all;
+		tests::random random(99);
+
+		for (size_t length = 0; length < 40; ++length)
+		{
+			std::vector<uint8_t> data(length);
+			for (uint8_t& b : data)
+			{
+				b = static_cast<uint8_t>('a' + random.next() % 3);
+			}
+			all.push_back(data);
+		}
+
+		// Incompressible, a single long run, text-like words and matches up to the maximum
+		// distance
+		std::vector<uint8_t> noise(100000);
+		for (uint8_t& b : noise)
+		{
+			b = static_cast<uint8_t>(random.next());
+		}
+		all.push_back(noise);
+		all.push_back(std::vector<uint8_t>(70000, 0));
+
+		const char* words[] = { "alpha ", "beta ", "gamma ", "delta ", "epsilon ", "zeta ", "eta ", "theta " };
+		std::vector<uint8_t> text;
+		while (text.size() < 100000)
+		{
+			const char* word = words[random.next() % 8];
+			text.insert(text.end(), word, word + std::strlen(word));
+		}
+		all.push_back(text);
+
+		std::vector<uint8_t> far(noise.begin(), noise.begin() + 65535);
+		far.insert(far.end(), noise.begin(), noise.begin() + 1000);
+		all.push_back(far);
+		return all;
+	}
+
+	void test_round_trips()
+	{
+		for (const std::vector<uint8_t>& data : inputs())
+		{
+			for (unsigned effort : { 0u, unsigned(LZ4_EFFORT_FAST), unsigned(LZ4_EFFORT_DEFAULT), unsigned(LZ4_EFFORT_MAX), 1000u })
+			{
+				std::vector<uint8_t> block = compress(data, effort);
+				std::vector<uint8_t> output(data.size());
+				bool passed = CHECK(block.size() <= LZ4_COMPRESSED_SIZE(data.size()) && check_block(block, data));
+				passed &= CHECK(lz4_decompress(block.data(), block.size(), output.data(), output.size()) == data.size());
+				passed &= CHECK(output == data);
+				if (!passed)
+				{
+					std::fprintf(stderr, "  %zu bytes, effort %u\n", data.size(), effort);
+				}
+			}
+		}
+
+		// The match at the maximum distance is found.
+		std::vector<uint8_t> far = inputs().back();
+		CHECK(compress(far, LZ4_EFFORT_MAX).size() < 65535 + 1000);
+	}
+
+	void test_capacity()
+	{
+		std::vector<uint8_t> data = inputs()[40];
+		std::vector<uint8_t> block = compress(data, LZ4_EFFORT_DEFAULT);
+		std::vector<uint8_t> small(block.size() - 1);
+		CHECK(lz4_compress(data.data(), data.size(), small.data(), small.size(), LZ4_EFFORT_DEFAULT, &workspace) == 0);
+
+		std::vector<uint8_t> output(data.size() - 1);
+		CHECK(lz4_decompress(block.data(), block.size(), output.data(), output.size()) == LZ4_ERROR);
+	}
+
+	void test_blocks()
+	{
+		// 4 literals, a match of 8 at distance 4, 5 final literals
+		std::vector<uint8_t> block = tests::from_hex("44616263640400" "506162636465");
+		std::vector<uint8_t> output(32);
+		size_t length = lz4_decompress(block.data(), block.size(), output.data(), output.size());
+		CHECK(length == 17 && std::memcmp(output.data(), "abcdabcdabcdabcde", 17) == 0);
+
+		// A literal repeated by a match at distance 1 with a length of 4 + 15 + 255 + 6
+		block = tests::from_hex("1f780100ff06" "1079");
+		length = lz4_decompress(block.data(), block.size(), output.data(), output.size());
+		CHECK(length == LZ4_ERROR);
+		output.resize(400);
+		length = lz4_decompress(block.data(), block.size(), output.data(), output.size());
+		CHECK(length == 282 && output[0] == 'x' && output[280] == 'x' && output[281] == 'y');
+
+		const char* malformed[] = {
+			"44616263640000506162636465",	// distance 0
+			"44616263640500506162636465",	// distance past the start
+			"446162636404",					// truncated distance
+			"4f616263640400",				// truncated match length
+			"f0",							// truncated literal length
+			"306162",						// truncated literals
+		};
+		for (const char* hex : malformed)
+		{
+			block = tests::from_hex(hex);
+			length = lz4_decompress(block.data(), block.size(), output.data(), output.size());
+			CHECK(length == LZ4_ERROR);
+		}
+		CHECK(lz4_decompress(nullptr, 0, output.data(), output.size()) == 0);
+	}
+}
+
+int main()
+{
+	test_round_trips();
+	test_capacity();
+	test_blocks();
+	return tests::finish();
+}
@@ -0,0 +1,264 @@
+/*
+*	Distance maps against Dijkstra's algorithm on the same graphs, 8-connected with chamfer
+*	costs and 4-connected with per-cell costs, and flow fields against a scan of the neighbors.
+*/
+
+#include "check.h"
+
+#include <ps2kernels/navgrid.h>
+
+#include <algorithm>
+#include <functional>
+#include <queue>
+#include <utility>
+
+namespace
+{
+	struct alignas(16) quadword_t
+	{
+		int16_t lanes[8];
+	};
+
+	/// @brief An aligned int16 grid
+	struct grid_t
+	{
+		grid_t(size_t width, size_t height, int16_t value) : width(width), height(height), storage(width * height / 8)
+		{
+			std::fill(data(), data() + width * height, value);
+		}
+
+		int16_t* data() { return storage[0].lanes; }
+		int16_t& at(size_t x, size_t y) { return data()[y * width + x]; }
+
+		size_t width;
+		size_t height;
+		std::vector<quadword_t> storage;
+	};
+
+	const int dx[8] = { 1, 1, 0, -1, -1, -1, 0, 1 };
+	const int dy[8] = { 0, -1, -1, -1, 0, 1, 1, 1 };
+
+	/// @brief Shortest distances to the goals, where entering a cell costs 'cost(cell, step)'
+	/// and 'NAV_INFINITY' blocks it
+	std::vector<int32_t> dijkstra(grid_t& goals, bool diagonals, const std::function<int32_t(size_t, size_t, bool)>& cost)
+	{
+		size_t width = goals.width;
+		size_t height = goals.height;
+		std::vector<int32_t> distance(width * height, NAV_INFINITY);
+		using entry_t = std::pair<int32_t, size_t>;
+		std::priority_queue<entry_t, std::vector<entry_t>, std::greater<entry_t>> queue;
+		for (size_t i = 0; i < width * height; ++i)
+		{
+			if (goals.data()[i] == 0)
+			{
+				distance[i] = 0;
+				queue.push({ 0, i });
+			}
+		}
+
+		while (!queue.empty())
+		{
+			auto [d, i] = queue.top();
+			queue.pop();
+			if (d != distance[i])
+			{
+				continue;
+			}
+			for (int k = 0; k < 8; ++k)
+			{
+				bool diagonal = k % 2 == 1;
+				if (diagonal && !diagonals)
+				{
+					continue;
+				}
+				int64_t x = int64_t(i % width) + dx[k];
+				int64_t y = int64_t(i / width) + dy[k];
+				if (x < 0 || y < 0 || x >= int64_t(width) || y >= int64_t(height))
+				{
+					continue;
+				}
+				int32_t step = cost(size_t(x), size_t(y), diagonal);
+				if (step >= NAV_INFINITY)
+				{
+					continue;
+				}
+				size_t j = size_t(y) * width + size_t(x);
+				if (d + step < distance[j])
+				{
+					distance[j] = std::min<int32_t>(d + step, NAV_INFINITY);
+					queue.push({ distance[j], j });
+				}
+			}
+		}
+		return distance;
+	}
+
+	bool equals(grid_t& grid, const std::vector<int32_t>& expected)
+	{
+		for (size_t i = 0; i < expected.size(); ++i)
+		{
+			if (grid.data()[i] != expected[i])
+			{
+				std::fprintf(stderr, "  cell %zu %zu: %d instead of %d\n", i % grid.width, i / grid.width, grid.data()[i],
+							 expected[i]);
+				return false;
+			}
+		}
+		return true;
+	}
+
+	grid_t random_goals(tests::random& random, size_t width, size_t height, size_t count)
+	{
+		grid_t goals(width, height, NAV_INFINITY);
+		for (size_t i = 0; i < count; ++i)
+		{
+			goals.at(random.next() % width, random.next() % height) = 0;
+		}
+		return goals;
+	}
+
+	void test_chamfer()
+	{
+		tests::random random(90);
+		const size_t sizes[][2] = { { 8, 1 }, { 8, 8 }, { 24, 5 }, { 64, 40 } };
+		for (const auto& size : sizes)
+		{
+			size_t width = size[0];
+			size_t height = size[1];
+			for (int round = 0; round < 6; ++round)
+			{
+				// Without walls, two pass pairs give the exact distances.
+				grid_t distance = random_goals(random, width, height, 1 + round);
+				grid_t walls(width, height, 0);
+				std::vector<int32_t> expected = dijkstra(distance, true, [&](size_t x, size_t y, bool diagonal) {
+					return std::max<int32_t>(diagonal ? NAV_CHAMFER_DIAGONAL : NAV_CHAMFER_ORTHOGONAL, walls.at(x, y));
+				});
+				CHECK(nav_chamfer(distance.data(), walls.data(), width, height, 2) <= 2);
+				CHECK(equals(distance, expected));
+
+				// With walls and slow cells, until the distances are stable
+				distance = random_goals(random, width, height, 1 + round / 2);
+				for (size_t i = 0; i < width * height; ++i)
+				{
+					uint32_t r = random.next() % 10;
+					walls.data()[i] = r < 3 ? NAV_INFINITY : r < 4 ? int16_t(random.range(6, 40)) : 0;
+				}
+				expected = dijkstra(distance, true, [&](size_t x, size_t y, bool diagonal) {
+					return std::max<int32_t>(diagonal ? NAV_CHAMFER_DIAGONAL : NAV_CHAMFER_ORTHOGONAL, walls.at(x, y));
+				});
+				size_t passes = nav_chamfer(distance.data(), walls.data(), width, height, 1000);
+				if (!CHECK(passes < 1000 && equals(distance, expected)))
+				{
+					std::fprintf(stderr, "  %zux%zu, %zu passes\n", width, height, passes);
+				}
+			}
+		}
+
+		// A stop after one pass pair is reported, a winding corridor needs more.
+		grid_t distance(8, 8, NAV_INFINITY);
+		grid_t walls(8, 8, 0);
+		for (size_t y = 1; y < 8; y += 2)
+		{
+			for (size_t x = 0; x < 7; ++x)
+			{
+				walls.at(y % 4 == 1 ? x + 1 : x, y) = NAV_INFINITY;
+			}
+		}
+		distance.at(0, 0) = 0;
+		CHECK(nav_chamfer(distance.data(), walls.data(), 8, 8, 1) == 1);
+		CHECK(distance.at(0, 6) == NAV_INFINITY);
+		CHECK(nav_chamfer(distance.data(), walls.data(), 8, 8, 100) > 1);
+		CHECK(equals(distance, dijkstra(distance, true, [&](size_t x, size_t y, bool diagonal) {
+			return std::max<int32_t>(diagonal ? NAV_CHAMFER_DIAGONAL : NAV_CHAMFER_ORTHOGONAL, walls.at(x, y));
+		})));
+	}
+
+	void test_relax()
+	{
+		tests::random random(91);
+		const size_t sizes[][2] = { { 8, 1 }, { 16, 16 }, { 40, 24 } };
+		for (const auto& size : sizes)
+		{
+			size_t width = size[0];
+			size_t height = size[1];
+			for (int round = 0; round < 6; ++round)
+			{
+				grid_t distance = random_goals(random, width, height, 1 + round);
+				grid_t costs(width, height, 0);
+				for (size_t i = 0; i < width * height; ++i)
+				{
+					costs.data()[i] = random.next() % 5 == 0 ? NAV_INFINITY : int16_t(random.range(1, 30));
+				}
+				std::vector<int32_t> expected = dijkstra(distance, false, [&](size_t x, size_t y, bool) {
+					return costs.at(x, y);
+				});
+
+				size_t sweeps = 0;
+				while (nav_relax(distance.data(), costs.data(), width, height) && sweeps < 1000)
+				{
+					++sweeps;
+				}
+				CHECK(sweeps < 1000 && equals(distance, expected));
+				CHECK(!nav_relax(distance.data(), costs.data(), width, height));
+			}
+		}
+	}
+
+	void test_flow_field()
+	{
+		tests::random random(92);
+		const size_t width = 32;
+		const size_t height = 12;
+		for (int round = 0; round < 4; ++round)
+		{
+			grid_t distance(width, height, 0);
+			for (size_t i = 0; i < width * height; ++i)
+			{
+				// Few distinct values, so that ties are common
+				distance.data()[i] = round == 0 ? NAV_INFINITY : random.next() % 7 == 0 ? NAV_INFINITY : int16_t(random.range(0, 6));
+			}
+
+			std::vector<uint64_t> storage(width * height / 8);
+			uint8_t* directions = reinterpret_cast<uint8_t*>(storage.data());
+			nav_flow_field(distance.data(), directions, width, height);
+
+			bool passed = true;
+			for (size_t y = 0; y < height && passed; ++y)
+			{
+				for (size_t x = 0; x < width && passed; ++x)
+				{
+					// Orthogonal neighbors first, the first strictly closer one wins.
+					int32_t best = distance.at(x, y);
+					int expected = NAV_FLOW_NONE;
+					for (int k : { 0, 2, 4, 6, 1, 3, 5, 7 })
+					{
+						int64_t nx = int64_t(x) + dx[k];
+						int64_t ny = int64_t(y) + dy[k];
+						if (nx < 0 || ny < 0 || nx >= int64_t(width) || ny >= int64_t(height))
+						{
+							continue;
+						}
+						if (distance.at(size_t(nx), size_t(ny)) < best)
+						{
+							best = distance.at(size_t(nx), size_t(ny));
+							expected = k;
+						}
+					}
+					passed = CHECK(directions[y * width + x] == expected);
+					if (!passed)
+					{
+						std::fprintf(stderr, "  cell %zu %zu: %d instead of %d\n", x, y, directions[y * width + x], expected);
+					}
+				}
+			}
+		}
+	}
+}
+
+int main()
+{
+	test_chamfer();
+	test_relax();
+	test_flow_field();
+	return tests::finish();
+}
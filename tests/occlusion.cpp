@@ -0,0 +1,236 @@
+/*
+*	Occlusion culling against a per-pixel reference: coverage from exact edge functions at the
+*	pixel centers, depth from the plane of the triangle, and occludee tests by brute force.
+*/
+
+#include "check.h"
+
+#include <ps2kernels/occlusion.h>
+
+#include <algorithm>
+#include <cmath>
+#include <cstdlib>
+
+namespace
+{
+	struct alignas(16) quadword_t
+	{
+		int32_t lanes[4];
+	};
+
+	/// @brief A depth buffer or band, cleared to 0
+	struct buffer_t
+	{
+		explicit buffer_t(size_t rows) : storage(rows * OCCLUSION_WIDTH / 4) {}
+
+		int32_t* data() { return storage[0].lanes; }
+		int32_t& at(size_t x, size_t y) { return data()[y * OCCLUSION_WIDTH + x]; }
+
+		std::vector<quadword_t> storage;
+	};
+
+	/// @brief Rasterize one pixel at a time, the depth in 'double'
+	void rasterize(std::vector<double>& depth, std::vector<bool>& covered, const occlusion_vertex_t* v)
+	{
+		int64_t area = int64_t(v[1].x - v[0].x) * (v[2].y - v[0].y) - int64_t(v[2].x - v[0].x) * (v[1].y - v[0].y);
+		if (area == 0)
+		{
+			return;
+		}
+		for (int y = 0; y < OCCLUSION_HEIGHT; ++y)
+		{
+			for (int x = 0; x < OCCLUSION_WIDTH; ++x)
+			{
+				int64_t px = x * 16 + 8;
+				int64_t py = y * 16 + 8;
+				// Barycentric weights times 'area', all of the sign of 'area' inside
+				int64_t w[3];
+				for (int k = 0; k < 3; ++k)
+				{
+					const occlusion_vertex_t& a = v[(k + 1) % 3];
+					const occlusion_vertex_t& b = v[(k + 2) % 3];
+					w[k] = (b.x - a.x) * (py - a.y) - (b.y - a.y) * (px - a.x);
+				}
+				bool inside = area > 0 ? w[0] >= 0 && w[1] >= 0 && w[2] >= 0 : w[0] <= 0 && w[1] <= 0 && w[2] <= 0;
+				if (!inside)
+				{
+					continue;
+				}
+				double z = (double(w[0]) * v[0].z + double(w[1]) * v[1].z + double(w[2]) * v[2].z) / double(area);
+				z = std::clamp<double>(z, std::min({ v[0].z, v[1].z, v[2].z }), std::max({ v[0].z, v[1].z, v[2].z }));
+				size_t i = y * OCCLUSION_WIDTH + x;
+				depth[i] = covered[i] ? std::max(depth[i], z) : z;
+				covered[i] = true;
+			}
+		}
+	}
+
+	std::vector<occlusion_vertex_t> random_triangles(tests::random& random, size_t count)
+	{
+		std::vector<occlusion_vertex_t> vertices(3 * count);
+		for (size_t i = 0; i < count; ++i)
+		{
+			// Triangles of every size, some of them partly off screen
+			int32_t size = 16 << random.range(2, 9);
+			int32_t cx = random.range(-600, OCCLUSION_WIDTH * 16 + 600);
+			int32_t cy = random.range(-600, OCCLUSION_HEIGHT * 16 + 600);
+			for (int k = 0; k < 3; ++k)
+			{
+				occlusion_vertex_t& v = vertices[3 * i + k];
+				v.x = std::clamp(cx + random.range(-size, size), -8192, 8191);
+				v.y = std::clamp(cy + random.range(-size, size), -8192, 8191);
+				v.z = random.range(0, OCCLUSION_DEPTH_MAX);
+			}
+		}
+		return vertices;
+	}
+
+	void test_rasterize()
+	{
+		tests::random random(88);
+		for (size_t count : { 1, 2, 10, 60 })
+		{
+			for (int round = 0; round < 4; ++round)
+			{
+				std::vector<occlusion_vertex_t> vertices = random_triangles(random, count);
+				std::vector<double> depth(OCCLUSION_WIDTH * OCCLUSION_HEIGHT, 0);
+				std::vector<bool> covered(depth.size(), false);
+				for (size_t i = 0; i < count; ++i)
+				{
+					rasterize(depth, covered, &vertices[3 * i]);
+				}
+
+				buffer_t buffer(OCCLUSION_HEIGHT);
+				occlusion_rasterize(buffer.data(), 0, OCCLUSION_HEIGHT, vertices.data(), count);
+				bool passed = true;
+				for (int y = 0; y < OCCLUSION_HEIGHT && passed; ++y)
+				{
+					for (int x = 0; x < OCCLUSION_WIDTH && passed; ++x)
+					{
+						// The depth steps have 7 fraction bits, so errors add up over the rows
+						// stepped from the top of the triangle, up to 512 + 128, and over up to
+						// 256 pixels.
+						double expected = depth[y * OCCLUSION_WIDTH + x];
+						int32_t actual = buffer.at(x, y);
+						passed = CHECK(covered[y * OCCLUSION_WIDTH + x] ? std::fabs(actual - expected) <= 1 + (512 + 128 + 256) / 128.0 : actual == 0);
+						if (!passed)
+						{
+							std::fprintf(stderr, "  %zu triangles, pixel %d %d: %d instead of %.1f\n", count, x, y, actual,
+										 expected);
+						}
+					}
+				}
+
+				// Bands of rows get the same values as the whole buffer.
+				buffer_t band(OCCLUSION_SCRATCHPAD_ROWS);
+				for (unsigned row = 0; row < OCCLUSION_HEIGHT; row += OCCLUSION_SCRATCHPAD_ROWS)
+				{
+					std::fill(band.storage.begin(), band.storage.end(), quadword_t{});
+					occlusion_rasterize(band.data(), row, OCCLUSION_SCRATCHPAD_ROWS, vertices.data(), count);
+					passed = CHECK(std::equal(band.data(), band.data() + OCCLUSION_SCRATCHPAD_ROWS * OCCLUSION_WIDTH,
+											  &buffer.at(0, row)));
+					if (!passed)
+					{
+						std::fprintf(stderr, "  %zu triangles, band at row %u\n", count, row);
+						break;
+					}
+				}
+			}
+		}
+
+		// A quad covering exactly the pixels whose centers it contains, edges included
+		const occlusion_vertex_t quad[6] = {
+			{ 8, 8, 1000 }, { 72, 8, 1000 }, { 72, 40, 1000 },
+			{ 8, 8, 1000 }, { 72, 40, 1000 }, { 8, 40, 1000 },
+		};
+		buffer_t buffer(OCCLUSION_HEIGHT);
+		occlusion_rasterize(buffer.data(), 0, OCCLUSION_HEIGHT, quad, 2);
+		size_t pixels = 0;
+		for (int y = 0; y < OCCLUSION_HEIGHT; ++y)
+		{
+			for (int x = 0; x < OCCLUSION_WIDTH; ++x)
+			{
+				bool inside = x <= 4 && y <= 2;
+				pixels += buffer.at(x, y) != 0;
+				CHECK(buffer.at(x, y) == (inside ? 1000 : 0));
+			}
+		}
+		CHECK(pixels == 15);
+	}
+
+	void test_occludees()
+	{
+		tests::random random(188);
+		buffer_t buffer(OCCLUSION_HEIGHT);
+		std::vector<occlusion_vertex_t> vertices = random_triangles(random, 30);
+		occlusion_rasterize(buffer.data(), 0, OCCLUSION_HEIGHT, vertices.data(), 30);
+
+		for (size_t count : { 0, 1, 5, 31, 32, 33, 200 })
+		{
+			std::vector<occlusion_rect_t> rects(count);
+			std::vector<bool> expected(count);
+			for (size_t i = 0; i < count; ++i)
+			{
+				occlusion_rect_t& r = rects[i];
+				r.x0 = static_cast<int16_t>(random.range(-20, OCCLUSION_WIDTH + 10));
+				r.y0 = static_cast<int16_t>(random.range(-20, OCCLUSION_HEIGHT + 10));
+				r.x1 = static_cast<int16_t>(r.x0 + random.range(0, 40));
+				r.y1 = static_cast<int16_t>(r.y0 + random.range(0, 20));
+				r.depth = random.range(0, OCCLUSION_DEPTH_MAX);
+
+				bool visible = false;
+				for (int y = std::max<int>(r.y0, 0); y < std::min<int>(r.y1, OCCLUSION_HEIGHT); ++y)
+				{
+					for (int x = std::max<int>(r.x0, 0); x < std::min<int>(r.x1, OCCLUSION_WIDTH); ++x)
+					{
+						visible |= buffer.at(x, y) <= r.depth;
+					}
+				}
+				expected[i] = visible;
+			}
+
+			std::vector<uint32_t> bits((count + 31) / 32, 0xDEADBEEF);
+			size_t found = occlusion_test(buffer.data(), rects.data(), count, bits.data());
+			size_t total = 0;
+			for (size_t i = 0; i < count; ++i)
+			{
+				total += expected[i];
+				if (!CHECK(((bits[i / 32] >> (i % 32)) & 1) == expected[i]))
+				{
+					std::fprintf(stderr, "  occludee %zu of %zu\n", i, count);
+				}
+			}
+			CHECK(found == total);
+			// Unused bits of the last word are cleared.
+			if (count % 32)
+			{
+				CHECK(bits.back() >> (count % 32) == 0);
+			}
+		}
+
+		// Pixels right next to the rectangle, in the same quadwords, do not count.
+		std::fill(buffer.data(), buffer.data() + OCCLUSION_WIDTH * OCCLUSION_HEIGHT, 1000);
+		for (int y = 0; y < OCCLUSION_HEIGHT; ++y)
+		{
+			buffer.at(10, y) = 0;
+			buffer.at(21, y) = 0;
+		}
+		const occlusion_rect_t rects[] = {
+			{ 11, 5, 21, 9, 500 },
+			{ 10, 5, 21, 9, 500 },
+			{ 11, 5, 22, 9, 500 },
+			{ 11, 5, 21, 9, 1000 },
+			{ 0, 0, 0, 10, 2000 },
+			{ -5, 0, 0, 10, 2000 },
+		};
+		uint32_t bits = 0;
+		CHECK(occlusion_test(buffer.data(), rects, 6, &bits) == 3 && bits == 0xE);
+	}
+}
+
+int main()
+{
+	test_rasterize();
+	test_occludees();
+	return tests::finish();
+}
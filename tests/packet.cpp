@@ -0,0 +1,215 @@
+/*
+*	Packet builder output against GIF and DMA tags assembled field by field from their
+*	documented layouts, double buffering, overflow, and the structure checks of
+*	'packet_validate' on well-formed and broken packets.
+*/
+
+#include "check.h"
+
+#include <ps2kernels/packet.h>
+
+#include <algorithm>
+#include <cstring>
+
+namespace
+{
+	struct alignas(64) line_t
+	{
+		uint64_t words[8];
+	};
+
+	/// @brief GIF tag fields: NLOOP 0-14, EOP 15, PRE 46, PRIM 47-57, FLG 58-59, NREG 60-63
+	uint64_t gif_tag(uint64_t nloop, uint64_t eop, uint64_t flg, uint64_t nreg, bool pre = false, uint64_t prim = 0)
+	{
+		return nloop | eop << 15 | uint64_t(pre) << 46 | prim << 47 | flg << 58 | nreg << 60;
+	}
+
+	/// @brief DMA tag fields: QWC 0-15, ID 28-30, ADDR 32-62
+	uint64_t dma_tag(uint64_t id, uint64_t qwc, uint64_t address)
+	{
+		return qwc | id << 28 | address << 32;
+	}
+
+	bool equals(const void* packet, size_t qwc, const std::vector<uint64_t>& expected)
+	{
+		return packet && qwc * 2 == expected.size() && std::memcmp(packet, expected.data(), qwc * 16) == 0;
+	}
+
+	void test_gif()
+	{
+		std::vector<line_t> memory(32);
+		packet_builder_t builder;
+		packet_builder_construct(&builder, memory.data(), memory.size() * sizeof(line_t), 0);
+		CHECK(builder.capacity == 64);
+
+		// A sprite: PRIM through the tag, then RGBAQ, XYZ2 and XYZ2, plus an A+D block
+		packet_builder_begin(&builder);
+		packet_gif_tag_prim(&builder, 1, false, GIF_FLG_PACKED, 3, 0x551, 6);
+		packet_qword(&builder, 0x80FF0000, 0x3F800000);
+		packet_qword(&builder, 0x1000'80008000ull, 0);
+		packet_qword(&builder, 0x1000'90009000ull, 0);
+		size_t handle = packet_gif_ad_open(&builder, true);
+		packet_ad(&builder, 0x4C, 0x1234);
+		packet_ad(&builder, 0x47, 0x30000);
+		packet_gif_ad_close(&builder, handle);
+
+		size_t qwc = 0;
+		void* packet = packet_builder_finish(&builder, PACKET_GIF, &qwc);
+		std::vector<uint64_t> expected = {
+			gif_tag(1, 0, GIF_FLG_PACKED, 3, true, 6), 0x551,
+			0x80FF0000, 0x3F800000,
+			0x1000'80008000ull, 0,
+			0x1000'90009000ull, 0,
+			gif_tag(2, 1, GIF_FLG_PACKED, 1), GIF_REG_AD,
+			0x1234, 0x4C,
+			0x30000, 0x47,
+		};
+		if (!CHECK(equals(packet, qwc, expected)))
+		{
+			std::fprintf(stderr, "  %s\n", builder.error);
+		}
+		CHECK(packet == memory.data());
+
+		// The next packet goes to the other buffer, the one after that back to the first.
+		packet_builder_begin(&builder);
+		packet_gif_tag(&builder, 0, true, GIF_FLG_IMAGE, 1, 0);
+		packet = packet_builder_finish(&builder, PACKET_GIF, &qwc);
+		CHECK(packet == memory.data() + 16 && qwc == 1);
+		packet_builder_begin(&builder);
+		packet_gif_tag(&builder, 0, true, GIF_FLG_IMAGE, 1, 0);
+		CHECK(packet_builder_finish(&builder, PACKET_GIF, &qwc) == memory.data());
+	}
+
+	void test_dma_chain()
+	{
+		std::vector<line_t> memory(32);
+		alignas(16) static uint64_t image[8] = {};
+		packet_builder_t builder;
+		packet_builder_construct(&builder, memory.data(), memory.size() * sizeof(line_t), 0);
+
+		// An image upload: a CNT with the GIF tags, a REF to the pixels, then an END closing it
+		packet_builder_begin(&builder);
+		size_t cnt = packet_dma_open(&builder, DMA_TAG_CNT);
+		packet_gif_tag(&builder, 4, true, GIF_FLG_IMAGE, 1, 0);
+		packet_dma_close(&builder, cnt);
+		packet_dma_tag(&builder, DMA_TAG_REF, 4, image);
+		size_t end = packet_dma_open(&builder, DMA_TAG_END);
+		packet_dma_close(&builder, end);
+
+		size_t qwc = 0;
+		void* packet = packet_builder_finish(&builder, PACKET_DMA_CHAIN, &qwc);
+		uint64_t address = reinterpret_cast<uintptr_t>(image) & 0x0FFFFFFF;
+		std::vector<uint64_t> expected = {
+			dma_tag(DMA_TAG_CNT, 1, 0), 0,
+			gif_tag(4, 1, GIF_FLG_IMAGE, 1), 0,
+			dma_tag(DMA_TAG_REF, 4, address), 0,
+			dma_tag(DMA_TAG_END, 0, 0), 0,
+		};
+		if (!CHECK(equals(packet, qwc, expected)))
+		{
+			std::fprintf(stderr, "  %s\n", builder.error);
+		}
+
+		// Reserved and copied data lands in place.
+		alignas(16) const uint64_t data[4] = { 1, 2, 3, 4 };
+		packet_builder_begin(&builder);
+		packet_gif_tag(&builder, 3, true, GIF_FLG_REGLIST, 2, 0xFF);
+		packet_data(&builder, data, 2);
+		uint64_t* reserved = packet_reserve(&builder, 1);
+		CHECK(reserved && reinterpret_cast<uintptr_t>(reserved) % 16 == 0);
+		reserved[0] = 5;
+		reserved[1] = 6;
+		packet = packet_builder_finish(&builder, PACKET_GIF, &qwc);
+		expected = { gif_tag(3, 1, GIF_FLG_REGLIST, 2), 0xFF, 1, 2, 3, 4, 5, 6 };
+		CHECK(equals(packet, qwc, expected));
+	}
+
+	void test_overflow()
+	{
+		std::vector<line_t> memory(2);
+		packet_builder_t builder;
+		packet_builder_construct(&builder, memory.data(), memory.size() * sizeof(line_t), 0);
+		CHECK(builder.capacity == 4);
+
+		packet_builder_begin(&builder);
+		packet_gif_tag(&builder, 4, true, GIF_FLG_IMAGE, 1, 0);
+		for (int i = 0; i < 4; ++i)
+		{
+			packet_qword(&builder, i, i);
+		}
+		size_t qwc = 0;
+		CHECK(packet_builder_finish(&builder, PACKET_GIF, &qwc) == nullptr && builder.overflow);
+		CHECK(std::strstr(builder.error, "exceeds") != nullptr);
+		// Nothing was written past the buffer.
+		CHECK(memory[1].words[0] == 0 && memory[1].words[7] == 0);
+
+		packet_builder_begin(&builder);
+		CHECK(packet_reserve(&builder, 5) == nullptr);
+		packet_builder_begin(&builder);
+		CHECK(packet_reserve(&builder, 4) != nullptr && !builder.overflow);
+	}
+
+	bool valid(const std::vector<uint64_t>& packet, packet_kind_t kind)
+	{
+		alignas(16) uint64_t data[64];
+		std::copy(packet.begin(), packet.end(), data);
+		char message[96];
+		return packet_validate(data, packet.size() / 2, kind, message, sizeof(message));
+	}
+
+	void test_validate()
+	{
+		// PACKED data counts NLOOP * NREG quadwords, REGLIST half that rounded up, NREG 0 is 16.
+		CHECK(valid({ gif_tag(1, 1, GIF_FLG_PACKED, 3), 0x541, 0, 0, 0, 0, 0, 0 }, PACKET_GIF));
+		CHECK(!valid({ gif_tag(2, 1, GIF_FLG_PACKED, 3), 0x541, 0, 0, 0, 0, 0, 0 }, PACKET_GIF));
+		CHECK(valid({ gif_tag(3, 1, GIF_FLG_REGLIST, 1), 0x5, 0, 0, 0, 0 }, PACKET_GIF));
+		CHECK(!valid({ gif_tag(3, 1, GIF_FLG_REGLIST, 1), 0x5, 0, 0 }, PACKET_GIF));
+		std::vector<uint64_t> sixteen = { gif_tag(1, 1, GIF_FLG_PACKED, 0), 0 };
+		sixteen.resize(2 + 32, 0);
+		CHECK(valid(sixteen, PACKET_GIF));
+		sixteen.resize(2 + 30);
+		CHECK(!valid(sixteen, PACKET_GIF));
+
+		// EOP on the last tag, known registers for A+D
+		CHECK(!valid({ gif_tag(0, 0, GIF_FLG_IMAGE, 1), 0 }, PACKET_GIF));
+		CHECK(!valid({}, PACKET_GIF));
+		CHECK(valid({ gif_tag(1, 1, GIF_FLG_PACKED, 1), GIF_REG_AD, 0, 0x7F }, PACKET_GIF));
+		CHECK(!valid({ gif_tag(1, 1, GIF_FLG_PACKED, 1), GIF_REG_AD, 0, 0x0B }, PACKET_GIF));
+		CHECK(!valid({ gif_tag(1, 1, GIF_FLG_PACKED, 1), GIF_REG_AD, 0, 0x63 }, PACKET_GIF));
+		// Only A+D entries address GS registers.
+		CHECK(valid({ gif_tag(1, 1, GIF_FLG_PACKED, 1), GIF_REG_RGBAQ, 0, 0x63 }, PACKET_GIF));
+
+		// DMA chains: GIF data split over tags, REF data taken by the open GIF tag
+		CHECK(valid({ dma_tag(DMA_TAG_CNT, 1, 0), 0, gif_tag(2, 1, GIF_FLG_IMAGE, 1), 0,
+					  dma_tag(DMA_TAG_CNT, 1, 0), 0, 0, 0, dma_tag(DMA_TAG_END, 1, 0), 0, 0, 0 }, PACKET_DMA_CHAIN));
+		CHECK(valid({ dma_tag(DMA_TAG_CNT, 1, 0), 0, gif_tag(2, 1, GIF_FLG_IMAGE, 1), 0,
+					  dma_tag(DMA_TAG_REFE, 2, 0x1000), 0 }, PACKET_DMA_CHAIN));
+		CHECK(!valid({ dma_tag(DMA_TAG_CNT, 1, 0), 0, gif_tag(2, 1, GIF_FLG_IMAGE, 1), 0,
+					   dma_tag(DMA_TAG_REFE, 3, 0x1000), 0 }, PACKET_DMA_CHAIN));
+		CHECK(!valid({ dma_tag(DMA_TAG_CNT, 2, 0), 0, gif_tag(0, 1, GIF_FLG_IMAGE, 1), 0 }, PACKET_DMA_CHAIN));
+		CHECK(!valid({ dma_tag(DMA_TAG_CNT, 1, 0), 0, gif_tag(0, 1, GIF_FLG_IMAGE, 1), 0 }, PACKET_DMA_CHAIN));
+		CHECK(!valid({ dma_tag(DMA_TAG_END, 0, 0), 0, 0, 0 }, PACKET_DMA_CHAIN));
+		CHECK(!valid({ dma_tag(DMA_TAG_NEXT, 0, 0x1000), 0 }, PACKET_DMA_CHAIN));
+		CHECK(valid({ dma_tag(DMA_TAG_REFE, 8, 0x1000), 0 }, PACKET_DMA_CHAIN));
+
+		// The builder refuses a packet failing the checks and tells why.
+		std::vector<line_t> memory(4);
+		packet_builder_t builder;
+		packet_builder_construct(&builder, memory.data(), memory.size() * sizeof(line_t), 0);
+		packet_builder_begin(&builder);
+		packet_gif_tag(&builder, 2, false, GIF_FLG_IMAGE, 1, 0);
+		packet_qword(&builder, 0, 0);
+		size_t qwc = 0;
+		CHECK(packet_builder_finish(&builder, PACKET_GIF, &qwc) == nullptr && qwc == 2);
+		CHECK(std::strstr(builder.error, "missing 1") != nullptr);
+	}
+}
+
+int main()
+{
+	test_gif();
+	test_dma_chain();
+	test_overflow();
+	test_validate();
+	return tests::finish();
+}
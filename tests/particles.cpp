@@ -0,0 +1,173 @@
+/*
+*	Particle update against a scalar model of the documented arithmetic, over several steps so
+*	that particles die and the survivors are compacted.
+*/
+
+#include "check.h"
+
+#include <ps2kernels/particles.h>
+
+#include <algorithm>
+#include <climits>
+
+namespace
+{
+	struct particle_t
+	{
+		int32_t x, y, z, vx, vy, vz, life;
+
+		bool operator==(const particle_t& other) const
+		{
+			return x == other.x && y == other.y && z == other.z && vx == other.vx && vy == other.vy &&
+				   vz == other.vz && life == other.life;
+		}
+	};
+
+	struct alignas(16) quadword_t
+	{
+		int32_t lanes[4];
+	};
+
+	/// @brief Particles in streams as the kernel takes them
+	class system_t
+	{
+	public:
+		explicit system_t(const std::vector<particle_t>& particles)
+		{
+			for (std::vector<quadword_t>& stream : storage)
+			{
+				stream.resize((particles.size() + 3) / 4 + 1);
+			}
+			streams = { data(0), data(1), data(2), data(3), data(4), data(5), data(6), particles.size() };
+			for (size_t i = 0; i < particles.size(); ++i)
+			{
+				const particle_t& p = particles[i];
+				streams.x[i] = p.x;
+				streams.y[i] = p.y;
+				streams.z[i] = p.z;
+				streams.vx[i] = p.vx;
+				streams.vy[i] = p.vy;
+				streams.vz[i] = p.vz;
+				streams.life[i] = p.life;
+			}
+		}
+
+		std::vector<particle_t> particles() const
+		{
+			std::vector<particle_t> result;
+			for (size_t i = 0; i < streams.count; ++i)
+			{
+				result.push_back({ streams.x[i], streams.y[i], streams.z[i], streams.vx[i], streams.vy[i],
+								   streams.vz[i], streams.life[i] });
+			}
+			return result;
+		}
+
+		particle_streams_t streams;
+
+	private:
+		int32_t* data(size_t s)
+		{
+			return storage[s][0].lanes;
+		}
+
+		std::vector<quadword_t> storage[7];
+	};
+
+	int32_t wrap(int64_t value)
+	{
+		return static_cast<int32_t>(static_cast<uint32_t>(value));
+	}
+
+	/// @brief The update as documented in 'particles.h', one particle at a time
+	std::vector<particle_t> model(const std::vector<particle_t>& particles, const int32_t acceleration[3], int32_t dt)
+	{
+		dt = std::clamp(dt, 0, PARTICLE_MAX_DT);
+		int32_t dv[3];
+		for (int c = 0; c < 3; ++c)
+		{
+			dv[c] = static_cast<int32_t>((static_cast<int64_t>(acceleration[c]) * dt) >> 16);
+		}
+
+		std::vector<particle_t> result;
+		for (particle_t p : particles)
+		{
+			int32_t* position[3] = { &p.x, &p.y, &p.z };
+			int32_t* velocity[3] = { &p.vx, &p.vy, &p.vz };
+			for (int c = 0; c < 3; ++c)
+			{
+				*velocity[c] = wrap(static_cast<int64_t>(*velocity[c]) + dv[c]);
+				*position[c] = wrap(*position[c] + ((static_cast<int64_t>(*velocity[c]) * dt) >> 16));
+			}
+			p.life = static_cast<int32_t>(std::max<int64_t>(static_cast<int64_t>(p.life) - dt, INT32_MIN));
+			if (p.life > 0)
+			{
+				result.push_back(p);
+			}
+		}
+		return result;
+	}
+
+	std::vector<particle_t> spawn(tests::random& random, size_t count)
+	{
+		std::vector<particle_t> particles(count);
+		for (particle_t& p : particles)
+		{
+			p = { random.range(-(1000 << 16), 1000 << 16), random.range(-(1000 << 16), 1000 << 16),
+				  random.range(-(1000 << 16), 1000 << 16), random.range(-(50 << 16), 50 << 16),
+				  random.range(-(50 << 16), 50 << 16), random.range(-(50 << 16), 50 << 16),
+				  random.range(-(1 << 16), 5 << 16) };
+		}
+		// Lives at the edges: dead already, the most negative one, exactly one step left
+		if (count >= 3)
+		{
+			particles[0].life = 0;
+			particles[1].life = INT32_MIN;
+			particles[2].life = 0x4000;
+		}
+		return particles;
+	}
+
+	void test_steps()
+	{
+		tests::random random(85);
+		const int32_t gravity[3] = { 0, -(10 << 16), 3 };
+		const int32_t steps[] = { 0x4000, 0x0444, 0, -5, PARTICLE_MAX_DT, 0x10000, 0x2000, 0x2000, 0x2000 };
+
+		for (size_t count : { 0, 1, 3, 4, 5, 17, PARTICLE_SCRATCHPAD_BLOCK, 1001 })
+		{
+			std::vector<particle_t> expected = spawn(random, count);
+			system_t system(expected);
+			for (int32_t dt : steps)
+			{
+				expected = model(expected, gravity, dt);
+				size_t left = particle_update(&system.streams, gravity, dt);
+				if (!CHECK(left == expected.size() && system.particles() == expected))
+				{
+					std::fprintf(stderr, "  %zu particles, step of %d\n", count, dt);
+					break;
+				}
+			}
+		}
+	}
+
+	void test_wrap_around()
+	{
+		// Positions wrap around like the EE registers, velocities at the extremes.
+		std::vector<particle_t> particles = {
+			{ INT32_MAX, INT32_MIN, 0, INT32_MAX, INT32_MIN, -1, 1 << 16 },
+			{ INT32_MIN, INT32_MAX, -1, INT32_MIN, INT32_MAX, 1, INT32_MAX },
+		};
+		const int32_t acceleration[3] = { INT32_MAX, INT32_MIN, 12345 };
+		system_t system(particles);
+		particle_update(&system.streams, acceleration, PARTICLE_MAX_DT);
+		CHECK(system.particles() == model(particles, acceleration, PARTICLE_MAX_DT));
+	}
+}
+
+int main()
+{
+	test_steps();
+	test_wrap_around();
+	return tests::finish();
+}
@@ -0,0 +1,283 @@
+/*
+*	Segment casts against a double-precision reference: Moeller-Trumbore for triangles and the
+*	slab test for boxes. Random cases close to an edge of the hit region are skipped, as the
+*	kernels round there within their documented accuracy.
+*/
+
+#include "check.h"
+
+#include <ps2kernels/raycast.h>
+
+#include <algorithm>
+#include <cmath>
+
+namespace
+{
+	struct alignas(16) quadword_t
+	{
+		int32_t lanes[4];
+	};
+
+	struct stream_t
+	{
+		explicit stream_t(size_t count) : storage(count / 4 + 1) {}
+
+		int32_t* data() { return storage[0].lanes; }
+		int32_t& operator[](size_t i) { return storage[i / 4].lanes[i % 4]; }
+
+		std::vector<quadword_t> storage;
+	};
+
+	const double one = 65536;
+
+	/// @brief Hit or miss, with the parameter of the hit in [0, 1]
+	struct expected_t
+	{
+		bool hit;
+		double t;
+		/// Close to the edge of the hit region, either result is fine.
+		bool ambiguous;
+		/// Error allowed for 't'
+		double tolerance;
+	};
+
+	double random_units(tests::random& random, double range)
+	{
+		return random.range(-int32_t(range * one), int32_t(range * one)) / one;
+	}
+
+	expected_t moeller_trumbore(const double origin[3], const double delta[3], const double v0[3], const double e1[3],
+								const double e2[3])
+	{
+		auto cross = [](const double a[3], const double b[3], double r[3]) {
+			r[0] = a[1] * b[2] - a[2] * b[1];
+			r[1] = a[2] * b[0] - a[0] * b[2];
+			r[2] = a[0] * b[1] - a[1] * b[0];
+		};
+		auto dot = [](const double a[3], const double b[3]) { return a[0] * b[0] + a[1] * b[1] + a[2] * b[2]; };
+
+		double p[3];
+		double q[3];
+		double s[3] = { origin[0] - v0[0], origin[1] - v0[1], origin[2] - v0[2] };
+		cross(delta, e2, p);
+		double det = dot(e1, p);
+		if (std::fabs(det) < 1)
+		{
+			return { false, 0, true, 0 };
+		}
+		cross(s, e1, q);
+		double u = dot(s, p) / det;
+		double v = dot(delta, q) / det;
+		double t = dot(e2, q) / det;
+
+		// The kernel truncates the cross products to Q16.16, an error of up to 2^-16 per
+		// component, which the dot products scale by the other operand and divide by 'det'.
+		double rounding = std::sqrt(3.0) / one * (std::sqrt(dot(s, s)) + std::sqrt(dot(e1, e1))) / std::fabs(det);
+		double margin = 4 * rounding + 1e-4;
+		bool ambiguous = false;
+		for (double distance : { u, v, 1 - u - v, t, 1 - t })
+		{
+			ambiguous |= std::fabs(distance) < margin;
+		}
+		return { u >= 0 && v >= 0 && u + v <= 1 && t >= 0 && t <= 1, t, ambiguous, (rounding + 1.0 / 16384) * one };
+	}
+
+	void test_triangles()
+	{
+		tests::random random(87);
+		size_t checked = 0;
+		for (size_t count : { 1, 3, 4, 5, 32, 33, 150 })
+		{
+			for (int round = 0; round < 20; ++round)
+			{
+				stream_t streams[9] = { stream_t(count), stream_t(count), stream_t(count), stream_t(count), stream_t(count),
+										stream_t(count), stream_t(count), stream_t(count), stream_t(count) };
+				double origin[3];
+				double target[3];
+				for (int c = 0; c < 3; ++c)
+				{
+					origin[c] = random_units(random, 60);
+					target[c] = random_units(random, 20);
+				}
+
+				std::vector<expected_t> expected(count);
+				double delta[3];
+				ray_segment_t ray;
+				// Segments ending before or after the target
+				double scale = 0.5 + random.next() % 3 * 0.5;
+				for (int c = 0; c < 3; ++c)
+				{
+					ray.origin[c] = int32_t(std::lrint(origin[c] * one));
+					ray.delta[c] = int32_t(std::lrint((target[c] - origin[c]) * scale * one));
+					origin[c] = ray.origin[c] / one;
+					delta[c] = ray.delta[c] / one;
+				}
+
+				for (size_t i = 0; i < count; ++i)
+				{
+					// Triangles around the target, which is inside some of them and outside of the
+					// others across every edge
+					double v0[3];
+					double e1[3];
+					double e2[3];
+					for (int c = 0; c < 3; ++c)
+					{
+						e1[c] = random_units(random, 6);
+						e2[c] = random_units(random, 6);
+					}
+					double a = random.next() / 4294967296.0 * 1.6 - 0.4;
+					double b = random.next() / 4294967296.0 * 1.6 - 0.4;
+					for (int c = 0; c < 3; ++c)
+					{
+						v0[c] = target[c] - a * e1[c] - b * e2[c];
+						streams[c][i] = int32_t(std::lrint(v0[c] * one));
+						streams[3 + c][i] = int32_t(std::lrint(e1[c] * one));
+						streams[6 + c][i] = int32_t(std::lrint(e2[c] * one));
+						v0[c] = streams[c][i] / one;
+						e1[c] = streams[3 + c][i] / one;
+						e2[c] = streams[6 + c][i] / one;
+					}
+					expected[i] = moeller_trumbore(origin, delta, v0, e1, e2);
+				}
+
+				triangle_streams_t triangles = {
+					{ streams[0].data(), streams[1].data(), streams[2].data() },
+					{ streams[3].data(), streams[4].data(), streams[5].data() },
+					{ streams[6].data(), streams[7].data(), streams[8].data() },
+				};
+				std::vector<uint32_t> hits((count + 31) / 32);
+				stream_t t(count);
+				size_t found = ray_triangles(&ray, &triangles, count, hits.data(), t.data());
+				std::vector<uint32_t> hits_only((count + 31) / 32);
+				CHECK(ray_triangles(&ray, &triangles, count, hits_only.data(), nullptr) == found && hits_only == hits);
+
+				size_t total = 0;
+				for (size_t i = 0; i < count; ++i)
+				{
+					bool hit = (hits[i / 32] >> (i % 32)) & 1;
+					total += hit;
+					if (expected[i].ambiguous)
+					{
+						continue;
+					}
+					++checked;
+					bool passed = CHECK(hit == expected[i].hit);
+					passed &= CHECK(hit ? std::fabs(t[i] - expected[i].t * one) <= expected[i].tolerance : t[i] == RAY_MISS);
+					if (!passed)
+					{
+						std::fprintf(stderr, "  triangle %zu of %zu: t %d instead of %.1f\n", i, count, t[i],
+									 expected[i].hit ? expected[i].t * one : double(RAY_MISS));
+					}
+				}
+				CHECK(found == total);
+			}
+		}
+		// Most cases are clear.
+		CHECK(checked > 3000);
+	}
+
+	/// @brief Slab test with the parameters clamped to the segment
+	expected_t slabs(const double origin[3], const double delta[3], const double min[3], const double max[3])
+	{
+		double entry = 0;
+		double exit = 1;
+		bool ambiguous = false;
+		for (int axis = 0; axis < 3; ++axis)
+		{
+			if (delta[axis] == 0)
+			{
+				if (origin[axis] < min[axis] || origin[axis] > max[axis])
+				{
+					return { false, 0, false, 0 };
+				}
+				continue;
+			}
+			double t0 = (min[axis] - origin[axis]) / delta[axis];
+			double t1 = (max[axis] - origin[axis]) / delta[axis];
+			entry = std::max(entry, std::min(t0, t1));
+			exit = std::min(exit, std::max(t0, t1));
+		}
+		ambiguous = std::fabs(entry - exit) < 1e-3 || std::fabs(entry - 1) < 1e-3;
+		return { entry <= exit, entry, ambiguous, 16 };
+	}
+
+	void test_boxes()
+	{
+		tests::random random(1987);
+		size_t checked = 0;
+		for (size_t count : { 1, 2, 4, 7, 32, 40, 200 })
+		{
+			for (int round = 0; round < 20; ++round)
+			{
+				stream_t streams[6] = { stream_t(count), stream_t(count), stream_t(count),
+										stream_t(count), stream_t(count), stream_t(count) };
+				ray_segment_t ray;
+				double origin[3];
+				double delta[3];
+				for (int c = 0; c < 3; ++c)
+				{
+					ray.origin[c] = int32_t(std::lrint(random_units(random, 100) * one));
+					// Now and then a segment parallel to an axis plane
+					ray.delta[c] = round % 5 == c ? 0 : int32_t(std::lrint(random_units(random, 150) * one));
+					origin[c] = ray.origin[c] / one;
+					delta[c] = ray.delta[c] / one;
+				}
+
+				std::vector<expected_t> expected(count);
+				for (size_t i = 0; i < count; ++i)
+				{
+					double min[3];
+					double max[3];
+					double along = random.next() / 4294967296.0 * 1.4 - 0.2;
+					for (int c = 0; c < 3; ++c)
+					{
+						// Boxes along the segment, some containing the origin
+						double center = origin[c] + along * delta[c] + random_units(random, 20);
+						double size = random.range(1, 30 << 16) / one;
+						streams[c][i] = int32_t(std::lrint((center - size) * one));
+						streams[3 + c][i] = int32_t(std::lrint((center + size) * one));
+						min[c] = streams[c][i] / one;
+						max[c] = streams[3 + c][i] / one;
+					}
+					expected[i] = slabs(origin, delta, min, max);
+				}
+
+				aabb32_streams_t boxes = {
+					{ streams[0].data(), streams[1].data(), streams[2].data() },
+					{ streams[3].data(), streams[4].data(), streams[5].data() },
+				};
+				std::vector<uint32_t> hits((count + 31) / 32);
+				stream_t t(count);
+				size_t found = ray_aabbs(&ray, &boxes, count, hits.data(), t.data());
+
+				size_t total = 0;
+				for (size_t i = 0; i < count; ++i)
+				{
+					bool hit = (hits[i / 32] >> (i % 32)) & 1;
+					total += hit;
+					if (expected[i].ambiguous)
+					{
+						continue;
+					}
+					++checked;
+					bool passed = CHECK(hit == expected[i].hit);
+					passed &= CHECK(hit ? std::fabs(t[i] - expected[i].t * one) <= expected[i].tolerance : t[i] == RAY_MISS);
+					if (!passed)
+					{
+						std::fprintf(stderr, "  box %zu of %zu: t %d instead of %.1f\n", i, count, t[i],
+									 expected[i].hit ? expected[i].t * one : double(RAY_MISS));
+					}
+				}
+				CHECK(found == total);
+			}
+		}
+		CHECK(checked > 5000);
+	}
+}
+
+int main()
+{
+	test_triangles();
+	test_boxes();
+	return tests::finish();
+}
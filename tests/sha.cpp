@@ -0,0 +1,151 @@
+/*
+*	SHA-256 and SHA-1 against the FIPS 180 example messages and the padding boundaries, and the
+*	multi-buffer queue against single messages.
+*/
+
+#include "check.h"
+
+#include <ps2kernels/sha.h>
+
+#include <cstring>
+
+namespace
+{
+	struct vector_t
+	{
+		std::string message;
+		const char* sha256;
+		const char* sha1;
+	};
+
+	std::vector<vector_t> vectors()
+	{
+		return {
+			{ "abc",
+			  "ba7816bf8f01cfea414140de5dae2223b00361a396177a9cb410ff61f20015ad",
+			  "a9993e364706816aba3e25717850c26c9cd0d89d" },
+			{ "",
+			  "e3b0c44298fc1c149afbf4c8996fb92427ae41e4649b934ca495991b7852b855",
+			  "da39a3ee5e6b4b0d3255bfef95601890afd80709" },
+			{ "abcdbcdecdefdefgefghfghighijhijkijkljklmklmnlmnomnopnopq",
+			  "248d6a61d20638b8e5c026930c3e6039a33ce45964ff2167f6ecedd419db06c1",
+			  "84983e441c3bd26ebaae4aa1f95129e5e54670f1" },
+			{ "abcdefghbcdefghicdefghijdefghijkefghijklfghijklmghijklmnhijklmnoijklmnopjklmnopqklmnopqrlmnopqrsmnopqrst"
+			  "nopqrstu",
+			  "cf5b16a778af8380036ce59e7b0492370b249b11e8f07a51afac45037afee9d1",
+			  "a49b2446a02c645bf419f995b67091253a04a259" },
+			{ std::string(1000000, 'a'),
+			  "cdc76e5c9914fb9281a1c7e284d73e67f1809a48a497200e046d39ccc7112cd0",
+			  "34aa973cd4c4daa4f61eeb2bdbad27316534016f" },
+			// The length fits in the last block or needs one more
+			{ std::string(55, 'a'),
+			  "9f4390f8d30c2dd92ec9f095b65e2b9ae9b0a925a5258e241c9f1e910f734318",
+			  "c1c8bbdc22796e28c0e15163d20899b65621d65a" },
+			{ std::string(56, 'a'),
+			  "b35439a4ac6f0948b6d6f9e3c6af0f5f590ce20f1bde7090ef7970686ec6738a",
+			  "c2db330f6083854c99d4b5bfb6e8f29f201be699" },
+			{ std::string(63, 'a'),
+			  "7d3e74a05d7db15bce4ad9ec0658ea98e3f06eeecf16b4c6fff2da457ddc2f34",
+			  "03f09f5b158a7a8cdad920bddc29b81c18a551f5" },
+			{ std::string(64, 'a'),
+			  "ffe054fe7ae0cb6dc65c3af9b61d5209f439851db43d0ba5997337df154668eb",
+			  "0098ba824b5c16427bd7a1122a5a442a25ec644d" },
+			{ std::string(119, 'a'),
+			  "31eba51c313a5c08226adf18d4a359cfdfd8d2e816b13f4af952f7ea6584dcfb",
+			  "ee971065aaa017e0632a8ca6c77bb3bf8b1dfc56" },
+			{ std::string(120, 'a'),
+			  "2f3d335432c70b580af0e8e1b3674a7c020d683aa5f73aaaedfdc55af904c21c",
+			  "f34c1488385346a55709ba056ddd08280dd4c6d6" },
+		};
+	}
+
+	const uint8_t* bytes(const std::string& s)
+	{
+		return reinterpret_cast<const uint8_t*>(s.data());
+	}
+
+	void test_vectors()
+	{
+		for (const vector_t& v : vectors())
+		{
+			uint8_t digest[SHA256_DIGEST_SIZE];
+			sha256(bytes(v.message), v.message.size(), digest);
+			if (!CHECK(tests::from_hex(v.sha256) == std::vector<uint8_t>(digest, digest + SHA256_DIGEST_SIZE)))
+			{
+				std::fprintf(stderr, "  SHA-256 of %zu bytes\n", v.message.size());
+			}
+			sha1(bytes(v.message), v.message.size(), digest);
+			if (!CHECK(tests::from_hex(v.sha1) == std::vector<uint8_t>(digest, digest + SHA1_DIGEST_SIZE)))
+			{
+				std::fprintf(stderr, "  SHA-1 of %zu bytes\n", v.message.size());
+			}
+		}
+	}
+
+	void test_queue()
+	{
+		// More messages than lanes, with lengths far apart so lanes pick up jobs at different times.
+		std::vector<vector_t> all = vectors();
+		std::vector<sha_job_t> jobs;
+		std::vector<std::vector<uint8_t>> digests(all.size(), std::vector<uint8_t>(SHA256_DIGEST_SIZE));
+		for (size_t i = 0; i < all.size(); ++i)
+		{
+			jobs.push_back({ bytes(all[i].message), all[i].message.size(), digests[i].data() });
+		}
+
+		sha256_multi(jobs.data(), jobs.size());
+		for (size_t i = 0; i < all.size(); ++i)
+		{
+			CHECK(digests[i] == tests::from_hex(all[i].sha256));
+		}
+
+		sha1_multi(jobs.data(), jobs.size());
+		for (size_t i = 0; i < all.size(); ++i)
+		{
+			CHECK(std::vector<uint8_t>(digests[i].begin(), digests[i].begin() + SHA1_DIGEST_SIZE) ==
+				  tests::from_hex(all[i].sha1));
+		}
+	}
+
+	void test_queue_lengths()
+	{
+		// Every length up to 3 blocks, queued together against one message at a time.
+		std::vector<uint8_t> data(200);
+		tests::random random(94);
+		for (uint8_t& b : data)
+		{
+			b = static_cast<uint8_t>(random.next());
+		}
+
+		std::vector<sha_job_t> jobs;
+		std::vector<std::vector<uint8_t>> digests(data.size(), std::vector<uint8_t>(SHA256_DIGEST_SIZE));
+		for (size_t length = 0; length < data.size(); ++length)
+		{
+			jobs.push_back({ data.data(), length, digests[length].data() });
+		}
+
+		sha256_multi(jobs.data(), jobs.size());
+		for (size_t length = 0; length < data.size(); ++length)
+		{
+			uint8_t digest[SHA256_DIGEST_SIZE];
+			sha256(data.data(), length, digest);
+			CHECK(std::memcmp(digest, digests[length].data(), SHA256_DIGEST_SIZE) == 0);
+		}
+
+		sha1_multi(jobs.data(), jobs.size());
+		for (size_t length = 0; length < data.size(); ++length)
+		{
+			uint8_t digest[SHA1_DIGEST_SIZE];
+			sha1(data.data(), length, digest);
+			CHECK(std::memcmp(digest, digests[length].data(), SHA1_DIGEST_SIZE) == 0);
+		}
+	}
+}
+
+int main()
+{
+	test_vectors();
+	test_queue();
+	test_queue_lengths();
+	return tests::finish();
+}
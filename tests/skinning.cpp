@@ -0,0 +1,177 @@
+/*
+*	Skinning against a floating-point reference, within the error bound documented in
+*	'skinning.h', for every number of influences, with and without normals and in place.
+*/
+
+#include "check.h"
+
+#include <ps2kernels/skinning.h>
+
+#include <cmath>
+#include <cstring>
+
+namespace
+{
+	const size_t bone_count = 64;
+
+	struct alignas(16) quadword_t
+	{
+		int16_t lanes[8];
+	};
+
+	/// @brief An aligned int16 stream with room for 'count' values
+	struct stream_t
+	{
+		explicit stream_t(size_t count) : storage((count + 7) / 8) {}
+
+		int16_t* data() { return storage[0].lanes; }
+		int16_t& operator[](size_t i) { return storage[i / 8].lanes[i % 8]; }
+
+		std::vector<quadword_t> storage;
+	};
+
+	/// @brief Rotations around z with a scale of up to 1.1, translations within +-1000
+	std::vector<skin_matrix_t> make_palette(tests::random& random)
+	{
+		std::vector<skin_matrix_t> palette(bone_count);
+		for (skin_matrix_t& m : palette)
+		{
+			double angle = random.next() / 4294967296.0 * 6.283185307179586;
+			double scale = 0.9 + 0.1 * (random.next() % 3);
+			double rotation[3][3] = {
+				{ std::cos(angle), -std::sin(angle), 0 },
+				{ std::sin(angle), std::cos(angle), 0 },
+				{ 0, 0, 1 },
+			};
+			std::memset(&m, 0, sizeof(m));
+			for (int r = 0; r < 3; ++r)
+			{
+				for (int c = 0; c < 3; ++c)
+				{
+					m.rows[r][c] = static_cast<int16_t>(std::lrint(rotation[r][c] * scale * (1 << SKIN_MATRIX_SHIFT)));
+				}
+				m.rows[r][3] = static_cast<int16_t>(random.range(-1000, 1000));
+			}
+		}
+		return palette;
+	}
+
+	/// @brief Skin 'count' vertices with coordinates within +-'magnitude' and check each
+	/// component against the reference
+	void check_skinning(const std::vector<skin_matrix_t>& palette, unsigned influences, bool normals, bool in_place,
+						size_t count, int magnitude)
+	{
+		tests::random random(84 + count + influences);
+		stream_t streams[6] = { stream_t(count), stream_t(count), stream_t(count),
+								stream_t(count), stream_t(count), stream_t(count) };
+		stream_t results[6] = { stream_t(count), stream_t(count), stream_t(count),
+								stream_t(count), stream_t(count), stream_t(count) };
+		std::vector<uint8_t> bones(4 * count);
+		stream_t weights(4 * count);
+		for (size_t i = 0; i < count; ++i)
+		{
+			for (int s = 0; s < 6; ++s)
+			{
+				int limit = s < 3 ? magnitude : 4096;
+				streams[s][i] = static_cast<int16_t>(random.range(-limit, limit));
+			}
+			// Weights summing up to 32767 over the influences used, the others are garbage.
+			int32_t left = 32767;
+			for (unsigned k = 0; k < 4; ++k)
+			{
+				bones[4 * i + k] = static_cast<uint8_t>(random.next() % bone_count);
+				int32_t weight = k + 1 == influences ? left : k < influences ? random.range(0, left) : random.range(-32768, 32767);
+				weights[4 * i + k] = static_cast<int16_t>(weight);
+				left -= k < influences ? weight : 0;
+			}
+		}
+		stream_t original[6] = { streams[0], streams[1], streams[2], streams[3], streams[4], streams[5] };
+
+		alignas(16) skin_matrix_t scratch[bone_count];
+		skin_matrix_t* staged = skin_stage_palette(scratch, palette.data(), palette.size());
+		skin_input_t input = {
+			streams[0].data(), streams[1].data(), streams[2].data(),
+			normals ? streams[3].data() : nullptr, normals ? streams[4].data() : nullptr, normals ? streams[5].data() : nullptr,
+			bones.data(), weights.data(), influences,
+		};
+		stream_t* out = in_place ? streams : results;
+		skin_output_t output = {
+			out[0].data(), out[1].data(), out[2].data(), out[3].data(), out[4].data(), out[5].data(),
+		};
+		skin_vertices(staged, &input, &output, count);
+
+		for (size_t i = 0; i < count; ++i)
+		{
+			double blended[3][4] = {};
+			for (unsigned k = 0; k < influences; ++k)
+			{
+				const skin_matrix_t& m = palette[bones[4 * i + k]];
+				double weight = weights[4 * i + k] / 32768.0;
+				for (int r = 0; r < 3; ++r)
+				{
+					for (int c = 0; c < 4; ++c)
+					{
+						blended[r][c] += weight * m.rows[r][c] / (c < 3 ? 1 << SKIN_MATRIX_SHIFT : 1);
+					}
+				}
+			}
+
+			for (int vector = 0; vector < (normals ? 2 : 1); ++vector)
+			{
+				double v[3];
+				double bound = 1;
+				for (int c = 0; c < 3; ++c)
+				{
+					v[c] = original[3 * vector + c][i];
+					bound += std::fabs(v[c]) / 8192;
+				}
+				for (int r = 0; r < 3; ++r)
+				{
+					double expected = vector == 0 ? blended[r][3] : 0;
+					for (int c = 0; c < 3; ++c)
+					{
+						expected += blended[r][c] * v[c];
+					}
+					double error = std::fabs(out[3 * vector + r][i] - expected);
+					if (!CHECK(error <= bound))
+					{
+						std::fprintf(stderr, "  vertex %zu, %s %d: %d instead of %.3f\n", i, vector == 0 ? "position" : "normal", r,
+									 out[3 * vector + r][i], expected);
+						return;
+					}
+				}
+			}
+		}
+
+		// Nothing else is written when there are no normals.
+		if (!normals && !in_place)
+		{
+			for (size_t i = 0; i < count; ++i)
+			{
+				CHECK(results[3][i] == 0 && results[4][i] == 0 && results[5][i] == 0);
+			}
+		}
+	}
+
+	void test_skinning()
+	{
+		tests::random random(84);
+		std::vector<skin_matrix_t> palette = make_palette(random);
+		for (unsigned influences = 1; influences <= 4; ++influences)
+		{
+			for (int magnitude : { 1000, 4096, 16384 })
+			{
+				check_skinning(palette, influences, true, false, 1000, magnitude);
+			}
+			check_skinning(palette, influences, false, false, 13, 4096);
+			check_skinning(palette, influences, true, true, 21, 4096);
+			check_skinning(palette, influences, true, false, 5, 4096);
+		}
+	}
+}
+
+int main()
+{
+	test_skinning();
+	return tests::finish();
+}
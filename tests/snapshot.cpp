@@ -0,0 +1,229 @@
+/*
+*	Snapshot deltas against an encoder of the documented format written a quadword at a time,
+*	round trips into a separate snapshot and in place, and truncated or malformed deltas.
+*/
+
+#include "check.h"
+
+#include <ps2kernels/snapshot.h>
+
+#include <algorithm>
+#include <cstring>
+
+namespace
+{
+	struct alignas(16) quadword_t
+	{
+		uint8_t bytes[16];
+
+		bool operator==(const quadword_t& other) const
+		{
+			return std::memcmp(bytes, other.bytes, 16) == 0;
+		}
+	};
+
+	using snapshot_t = std::vector<quadword_t>;
+
+	void put_varint(std::vector<uint8_t>& delta, size_t value)
+	{
+		for (; value >= 0x80; value >>= 7)
+		{
+			delta.push_back(static_cast<uint8_t>(value | 0x80));
+		}
+		delta.push_back(static_cast<uint8_t>(value));
+	}
+
+	/// @brief The format of 'snapshot.h', one quadword at a time
+	std::vector<uint8_t> reference_encode(const snapshot_t& current, const snapshot_t& baseline)
+	{
+		std::vector<uint8_t> delta;
+		std::vector<uint8_t> payload;
+		bool changed_run = false;
+		size_t run = 0;
+		for (size_t q = 0; q < current.size(); ++q)
+		{
+			bool changed = !(current[q] == baseline[q]);
+			if (changed != changed_run)
+			{
+				put_varint(delta, run);
+				run = 0;
+				changed_run = changed;
+			}
+			++run;
+			for (int k = 0; changed && k < 16; ++k)
+			{
+				payload.push_back(current[q].bytes[k] ^ baseline[q].bytes[k]);
+			}
+		}
+		if (!current.empty())
+		{
+			put_varint(delta, run);
+		}
+		delta.insert(delta.end(), payload.begin(), payload.end());
+		return delta;
+	}
+
+	std::vector<uint8_t> encode(const snapshot_t& current, const snapshot_t& baseline)
+	{
+		std::vector<uint8_t> delta(SNAPSHOT_DELTA_SIZE(current.size()));
+		delta.resize(snapshot_delta_encode(current.data(), baseline.data(), current.size(), delta.data()));
+		return delta;
+	}
+
+	snapshot_t random_snapshot(tests::random& random, size_t quadwords)
+	{
+		snapshot_t snapshot(quadwords);
+		for (quadword_t& q : snapshot)
+		{
+			for (uint8_t& b : q.bytes)
+			{
+				b = static_cast<uint8_t>(random.next());
+			}
+		}
+		return snapshot;
+	}
+
+	/// @brief 'baseline' with quadwords changed in runs, or a single byte in one word
+	snapshot_t change(tests::random& random, const snapshot_t& baseline, unsigned percent)
+	{
+		snapshot_t current = baseline;
+		bool changing = false;
+		for (quadword_t& q : current)
+		{
+			if (random.next() % 100 < 20)
+			{
+				changing = random.next() % 100 < percent;
+			}
+			if (changing)
+			{
+				q.bytes[random.next() % 16] ^= static_cast<uint8_t>(1 + random.next() % 255);
+			}
+		}
+		return current;
+	}
+
+	void check_round_trip(const snapshot_t& current, const snapshot_t& baseline)
+	{
+		std::vector<uint8_t> delta = encode(current, baseline);
+		bool passed = CHECK(delta.size() <= SNAPSHOT_DELTA_SIZE(current.size()));
+		passed &= CHECK(delta == reference_encode(current, baseline));
+
+		// Trailing bytes are not part of the delta.
+		std::vector<uint8_t> input = delta;
+		input.push_back(0x55);
+		snapshot_t decoded(current.size());
+		passed &= CHECK(snapshot_delta_decode(input.data(), input.size(), baseline.data(), decoded.data(), current.size()) ==
+						delta.size());
+		passed &= CHECK(decoded == current);
+
+		snapshot_t in_place = baseline;
+		passed &= CHECK(snapshot_delta_decode(delta.data(), delta.size(), in_place.data(), in_place.data(), current.size()) ==
+						delta.size());
+		passed &= CHECK(in_place == current);
+		if (!passed)
+		{
+			std::fprintf(stderr, "  %zu quadwords, delta of %zu bytes\n", current.size(), delta.size());
+		}
+	}
+
+	void test_round_trips()
+	{
+		tests::random random(100);
+		for (size_t quadwords : { 0, 1, 3, 4, 5, 8, 17, 64, 300 })
+		{
+			snapshot_t baseline = random_snapshot(random, quadwords);
+			for (unsigned percent : { 0, 10, 50, 90, 100 })
+			{
+				check_round_trip(change(random, baseline, percent), baseline);
+			}
+			check_round_trip(random_snapshot(random, quadwords), baseline);
+		}
+
+		// Runs longer than one LEB128 byte, on both sides of a group of 4
+		snapshot_t baseline = random_snapshot(random, 1000);
+		snapshot_t current = baseline;
+		for (size_t q : { 1, 2, 3, 130, 131, 999 })
+		{
+			current[q].bytes[15] ^= 0x80;
+		}
+		for (size_t q = 500; q < 700; ++q)
+		{
+			current[q].bytes[0] ^= 1;
+		}
+		check_round_trip(current, baseline);
+		CHECK(encode(current, baseline)[0] == 1 && encode(current, baseline)[1] == 3);
+	}
+
+	/// @brief Decode a malformed delta, which must be rejected without writing the snapshot
+	bool rejected(const std::vector<uint8_t>& delta, const snapshot_t& baseline)
+	{
+		snapshot_t decoded(baseline.size());
+		std::fill(decoded.begin(), decoded.end(), quadword_t{ { 0xA5 } });
+		snapshot_t untouched = decoded;
+		return snapshot_delta_decode(delta.data(), delta.size(), baseline.data(), decoded.data(), baseline.size()) ==
+				   SNAPSHOT_DELTA_ERROR &&
+			   decoded == untouched;
+	}
+
+	void test_truncated()
+	{
+		tests::random random(1000);
+		for (size_t quadwords : { 1, 5, 200 })
+		{
+			snapshot_t baseline = random_snapshot(random, quadwords);
+			for (unsigned percent : { 0, 50, 100 })
+			{
+				std::vector<uint8_t> delta = encode(change(random, baseline, percent), baseline);
+				for (size_t length = 0; length < delta.size(); ++length)
+				{
+					if (!CHECK(rejected(std::vector<uint8_t>(delta.begin(), delta.begin() + length), baseline)))
+					{
+						std::fprintf(stderr, "  %zu quadwords, %zu of %zu bytes\n", quadwords, length, delta.size());
+						break;
+					}
+				}
+			}
+		}
+	}
+
+	void test_malformed()
+	{
+		tests::random random(1001);
+		snapshot_t baseline = random_snapshot(random, 10);
+		std::vector<uint8_t> payload(16 * 10, 0x11);
+
+		// Runs past the snapshot, one at a time or adding up
+		std::vector<uint8_t> delta = { 11 };
+		CHECK(rejected(delta, baseline));
+		delta = { 4, 7 };
+		delta.insert(delta.end(), payload.begin(), payload.end());
+		CHECK(rejected(delta, baseline));
+
+		// A run length of more than 5 bytes, and one of 5 bytes far too long
+		delta = { 0x80, 0x80, 0x80, 0x80, 0x80, 0x00 };
+		CHECK(rejected(delta, baseline));
+		delta = { 0x8A, 0x80, 0x80, 0x80, 0x01 };
+		CHECK(rejected(delta, baseline));
+
+		// Changed quadwords missing their bytes
+		delta = { 8, 2 };
+		delta.insert(delta.end(), payload.begin(), payload.begin() + 31);
+		CHECK(rejected(delta, baseline));
+		delta.push_back(0x11);
+		snapshot_t decoded(10);
+		CHECK(snapshot_delta_decode(delta.data(), delta.size(), baseline.data(), decoded.data(), 10) == 34);
+		CHECK(std::equal(decoded.begin(), decoded.begin() + 8, baseline.begin()) && decoded[8].bytes[0] == (baseline[8].bytes[0] ^ 0x11));
+
+		// An overlong run length, which the encoder never writes, still decodes.
+		delta = { 0x8A, 0x00 };
+		CHECK(snapshot_delta_decode(delta.data(), delta.size(), baseline.data(), decoded.data(), 10) == 2 && decoded == baseline);
+	}
+}
+
+int main()
+{
+	test_round_trips();
+	test_truncated();
+	test_malformed();
+	return tests::finish();
+}
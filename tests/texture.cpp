@@ -0,0 +1,121 @@
+/*
+*	Texture conversions against scalar references: the PSMT8 swizzle as the address formula of
+*	the GS memory layout, and RGBA5551 one channel at a time.
+*/
+
+#include "check.h"
+
+#include <ps2kernels/texture.h>
+
+#include <cstring>
+
+namespace
+{
+	struct alignas(16) quadword_t
+	{
+		uint8_t bytes[16];
+	};
+
+	/// @brief Swizzle one index at a time, from the PSMT8 and PSMCT32 block layouts
+	std::vector<uint8_t> swizzle8(const std::vector<uint8_t>& src, size_t width, size_t height)
+	{
+		std::vector<uint8_t> dst(src.size());
+		for (size_t y = 0; y < height; ++y)
+		{
+			for (size_t x = 0; x < width; ++x)
+			{
+				size_t block = (y & ~size_t(15)) * width + (x & ~size_t(15)) * 2;
+				size_t swap = ((y + 2) >> 2 & 1) * 4;
+				size_t row = (((y & ~size_t(3)) >> 1) + (y & 1)) & 7;
+				size_t column = row * width * 2 + ((x + swap) & 7) * 4;
+				size_t byte = ((y >> 1) & 1) + ((x >> 2) & 2);
+				dst[block + column + byte] = src[y * width + x];
+			}
+		}
+		return dst;
+	}
+
+	uint16_t to_5551(uint32_t pixel)
+	{
+		uint32_t r = pixel & 0xFF;
+		uint32_t g = pixel >> 8 & 0xFF;
+		uint32_t b = pixel >> 16 & 0xFF;
+		uint32_t a = pixel >> 24;
+		return static_cast<uint16_t>(r >> 3 | (g >> 3) << 5 | (b >> 3) << 10 | (a >= 0x80 ? 0x8000 : 0));
+	}
+
+	void test_swizzle8()
+	{
+		tests::random random(79);
+		const size_t sizes[][2] = { { 16, 16 }, { 32, 16 }, { 16, 48 }, { 128, 64 }, { 80, 32 } };
+		for (const auto& size : sizes)
+		{
+			size_t width = size[0];
+			size_t height = size[1];
+			std::vector<quadword_t> src(width * height / 16);
+			std::vector<quadword_t> dst(width * height / 16);
+			uint8_t* in = src[0].bytes;
+			for (size_t i = 0; i < width * height; ++i)
+			{
+				in[i] = static_cast<uint8_t>(random.next());
+			}
+
+			texture_swizzle8(dst[0].bytes, in, width, height);
+			std::vector<uint8_t> expected = swizzle8(std::vector<uint8_t>(in, in + width * height), width, height);
+			if (!CHECK(std::memcmp(dst[0].bytes, expected.data(), expected.size()) == 0))
+			{
+				std::fprintf(stderr, "  %zux%zu\n", width, height);
+			}
+
+			// Strips of 16 rows give the same result.
+			std::vector<quadword_t> strips(width * height / 16);
+			for (size_t y = 0; y < height; y += 16)
+			{
+				texture_swizzle8(strips[0].bytes + y * width, in + y * width, width, 16);
+			}
+			CHECK(std::memcmp(strips[0].bytes, expected.data(), expected.size()) == 0);
+		}
+	}
+
+	void test_5551()
+	{
+		tests::random random(5551);
+		for (size_t count : { 0, 1, 7, 8, 9, 16, 31, 1000 })
+		{
+			std::vector<quadword_t> src(count / 4 + 1);
+			std::vector<quadword_t> dst(count / 8 + 2);
+			uint32_t* pixels = reinterpret_cast<uint32_t*>(src[0].bytes);
+			uint16_t* out = reinterpret_cast<uint16_t*>(dst[0].bytes);
+			for (size_t i = 0; i < count; ++i)
+			{
+				pixels[i] = random.next();
+			}
+			// Alpha on both sides of the threshold, channels at the edges of a step
+			const uint32_t edges[] = { 0x00000000, 0xFFFFFFFF, 0x7F070707, 0x80080808, 0x7FF8F8F8, 0x81000000 };
+			for (size_t i = 0; i < count && i < 6; ++i)
+			{
+				pixels[i] = edges[i];
+			}
+			std::memset(out, 0xCD, dst.size() * sizeof(quadword_t));
+
+			texture_rgba32_to_5551(out, pixels, count);
+			for (size_t i = 0; i < count; ++i)
+			{
+				if (!CHECK(out[i] == to_5551(pixels[i])))
+				{
+					std::fprintf(stderr, "  pixel %zu of %zu: %08x gives %04x\n", i, count, pixels[i], out[i]);
+					break;
+				}
+			}
+			// Nothing is written past the last pixel.
+			CHECK(out[count] == 0xCDCD);
+		}
+	}
+}
+
+int main()
+{
+	test_swizzle8();
+	test_5551();
+	return tests::finish();
+}
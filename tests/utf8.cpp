@@ -0,0 +1,252 @@
+/*
+*	UTF-8 validation and transcoding against a byte-at-a-time decoder written from the table of
+*	well-formed sequences in the Unicode standard, on random text with errors at every position.
+*/
+
+#include "check.h"
+
+#include <ps2kernels/utf8.h>
+
+namespace
+{
+	/// @brief Code points of the sequences before the first ill-formed one, and its position
+	struct decoded_t
+	{
+		std::vector<uint32_t> code_points;
+		size_t invalid;
+	};
+
+	/// @brief Decode with the ranges of the second byte of every lead byte, Unicode table 3-7
+	decoded_t reference_decode(const std::string& text)
+	{
+		decoded_t result = { {}, text.size() };
+		for (size_t i = 0; i < text.size();)
+		{
+			uint8_t lead = static_cast<uint8_t>(text[i]);
+			size_t size = lead < 0x80 ? 1 : lead < 0xC2 ? 0 : lead < 0xE0 ? 2 : lead < 0xF0 ? 3 : lead < 0xF5 ? 4 : 0;
+			uint8_t low = lead == 0xE0 ? 0xA0 : lead == 0xF0 ? 0x90 : 0x80;
+			uint8_t high = lead == 0xED ? 0x9F : lead == 0xF4 ? 0x8F : 0xBF;
+			bool valid = size != 0 && i + size <= text.size();
+			uint32_t code_point = size == 1 ? lead : size == 2 ? lead & 0x1F : size == 3 ? lead & 0x0F : lead & 0x07;
+			for (size_t k = 1; valid && k < size; ++k)
+			{
+				uint8_t byte = static_cast<uint8_t>(text[i + k]);
+				valid = byte >= (k == 1 ? low : 0x80) && byte <= (k == 1 ? high : 0xBF);
+				code_point = code_point << 6 | (byte & 0x3F);
+			}
+			if (!valid)
+			{
+				result.invalid = i;
+				break;
+			}
+			result.code_points.push_back(code_point);
+			i += size;
+		}
+		return result;
+	}
+
+	std::vector<uint16_t> to_utf16(const std::vector<uint32_t>& code_points)
+	{
+		std::vector<uint16_t> units;
+		for (uint32_t c : code_points)
+		{
+			if (c < 0x10000)
+			{
+				units.push_back(static_cast<uint16_t>(c));
+			}
+			else
+			{
+				units.push_back(static_cast<uint16_t>(0xD800 + ((c - 0x10000) >> 10)));
+				units.push_back(static_cast<uint16_t>(0xDC00 + ((c - 0x10000) & 0x3FF)));
+			}
+		}
+		return units;
+	}
+
+	std::string to_utf8(const std::vector<uint32_t>& code_points)
+	{
+		std::string text;
+		for (uint32_t c : code_points)
+		{
+			if (c < 0x80)
+			{
+				text += static_cast<char>(c);
+			}
+			else if (c < 0x800)
+			{
+				text += static_cast<char>(0xC0 | c >> 6);
+				text += static_cast<char>(0x80 | (c & 0x3F));
+			}
+			else if (c < 0x10000)
+			{
+				text += static_cast<char>(0xE0 | c >> 12);
+				text += static_cast<char>(0x80 | ((c >> 6) & 0x3F));
+				text += static_cast<char>(0x80 | (c & 0x3F));
+			}
+			else
+			{
+				text += static_cast<char>(0xF0 | c >> 18);
+				text += static_cast<char>(0x80 | ((c >> 12) & 0x3F));
+				text += static_cast<char>(0x80 | ((c >> 6) & 0x3F));
+				text += static_cast<char>(0x80 | (c & 0x3F));
+			}
+		}
+		return text;
+	}
+
+	/// @brief Check validation and conversion to UTF-16 of 'text' against the reference
+	bool check_utf8(const std::string& text)
+	{
+		decoded_t expected = reference_decode(text);
+		std::vector<uint16_t> units(UTF8_TO_UTF16_SIZE(text.size()) + 1);
+		size_t invalid = 0;
+		units.resize(utf8_to_utf16(text.data(), text.size(), units.data(), &invalid));
+
+		bool passed = CHECK(utf8_validate(text.data(), text.size()) == expected.invalid);
+		passed &= CHECK(invalid == expected.invalid && units == to_utf16(expected.code_points));
+		if (!passed)
+		{
+			std::fprintf(stderr, "  %zu bytes, invalid at %zu\n", text.size(), expected.invalid);
+		}
+		return passed;
+	}
+
+	/// @brief Random code points, mostly in runs of one length class so ASCII runs span quadwords
+	std::vector<uint32_t> random_code_points(tests::random& random, size_t count)
+	{
+		std::vector<uint32_t> code_points;
+		uint32_t kind = 0;
+		for (size_t i = 0; i < count; ++i)
+		{
+			if (random.next() % 8 == 0)
+			{
+				kind = random.next() % 5;
+			}
+			uint32_t c = kind <= 1 ? random.next() % 0x80 : kind == 2 ? 0x80 + random.next() % 0x780 :
+						 kind == 3 ? 0x800 + random.next() % 0xF800 : 0x10000 + random.next() % 0x100000;
+			// Surrogates are not code points of any encoding.
+			code_points.push_back(c >= 0xD800 && c <= 0xDFFF ? c - 0x800 : c);
+		}
+		return code_points;
+	}
+
+	void test_vectors()
+	{
+		const char* valid[] = {
+			"", "a", "\xC2\x80", "\xDF\xBF", "\xE0\xA0\x80", "\xED\x9F\xBF", "\xEE\x80\x80", "\xEF\xBF\xBF",
+			"\xF0\x90\x80\x80", "\xF4\x8F\xBF\xBF", "\x7F\xC3\xA9\xE2\x82\xAC\xF0\x9F\x98\x80",
+		};
+		for (const char* text : valid)
+		{
+			if (CHECK(check_utf8(text)))
+			{
+				CHECK(reference_decode(text).invalid == std::string(text).size());
+			}
+		}
+
+		// Overlong, surrogate, past U+10FFFF, never used, stray continuation and truncated
+		const char* invalid[] = {
+			"\xC0\x80", "\xC1\xBF", "\xE0\x9F\xBF", "\xED\xA0\x80", "\xED\xBF\xBF", "\xF0\x8F\xBF\xBF",
+			"\xF4\x90\x80\x80", "\xF5\x80\x80\x80", "\xF8\x88\x80\x80\x80", "\xFE", "\xFF", "\x80", "\xBF",
+			"\xC2", "\xE2\x82", "\xF0\x9F\x98", "\xC2\x41", "\xE2\x28\xA1",
+		};
+		for (const char* sequence : invalid)
+		{
+			// At the start, in the middle of an ASCII run and at the end of long input
+			for (size_t before : { 0, 5, 15, 16, 31, 40 })
+			{
+				std::string text = std::string(before, 'x') + sequence;
+				if (CHECK(check_utf8(text)))
+				{
+					CHECK(reference_decode(text).invalid == before);
+				}
+				check_utf8(text + std::string(40, 'y'));
+			}
+		}
+	}
+
+	void test_random()
+	{
+		tests::random random(96);
+		const uint8_t bad[] = { 0x00, 0x41, 0x80, 0xBF, 0xC0, 0xC1, 0xC2, 0xDF, 0xE0, 0xED, 0xEF, 0xF0, 0xF4, 0xF5, 0xFF };
+		for (int round = 0; round < 40; ++round)
+		{
+			std::string text = to_utf8(random_code_points(random, 1 + random.next() % 120));
+			if (!check_utf8(text))
+			{
+				continue;
+			}
+
+			// One corrupted byte at every position, and every truncation
+			for (size_t position = 0; position < text.size(); ++position)
+			{
+				std::string corrupted = text;
+				corrupted[position] = static_cast<char>(bad[random.next() % sizeof(bad)]);
+				if (!check_utf8(corrupted) || !check_utf8(text.substr(0, position)))
+				{
+					break;
+				}
+			}
+		}
+	}
+
+	/// @brief Decode UTF-16 up to the first unpaired surrogate
+	decoded_t reference_decode(const std::vector<uint16_t>& units)
+	{
+		decoded_t result = { {}, units.size() };
+		for (size_t i = 0; i < units.size(); ++i)
+		{
+			uint32_t unit = units[i];
+			bool high = unit >= 0xD800 && unit <= 0xDBFF;
+			bool paired = high && i + 1 < units.size() && units[i + 1] >= 0xDC00 && units[i + 1] <= 0xDFFF;
+			if ((unit >= 0xD800 && unit <= 0xDFFF) && !paired)
+			{
+				result.invalid = i;
+				break;
+			}
+			result.code_points.push_back(paired ? 0x10000 + ((unit - 0xD800) << 10) + (units[++i] - 0xDC00) : unit);
+		}
+		return result;
+	}
+
+	void test_utf16()
+	{
+		tests::random random(960);
+		for (int round = 0; round < 400; ++round)
+		{
+			std::vector<uint16_t> units = to_utf16(random_code_points(random, random.next() % 100));
+
+			// Surrogates written over random units break pairs, or make new ones.
+			for (int k = round % 4; k-- > 0 && !units.empty();)
+			{
+				units[random.next() % units.size()] = static_cast<uint16_t>(0xD800 + random.next() % 0x800);
+			}
+
+			decoded_t expected = reference_decode(units);
+			std::string text(UTF16_TO_UTF8_SIZE(units.size()) + 1, '\0');
+			size_t invalid = 0;
+			text.resize(utf16_to_utf8(units.data(), units.size(), &text[0], &invalid));
+			if (!CHECK(invalid == expected.invalid && text == to_utf8(expected.code_points)))
+			{
+				std::fprintf(stderr, "  %zu code units, invalid at %zu\n", units.size(), expected.invalid);
+			}
+		}
+
+		// A pair split across the quadword boundary, after 15 ASCII units
+		std::vector<uint16_t> units(15, 'a');
+		units.push_back(0xD83D);
+		units.push_back(0xDE00);
+		char text[UTF16_TO_UTF8_SIZE(17)];
+		size_t invalid = 0;
+		CHECK(utf16_to_utf8(units.data(), units.size(), text, &invalid) == 19 && invalid == 17);
+		CHECK(std::string(text + 15, 4) == "\xF0\x9F\x98\x80");
+	}
+}
+
+int main()
+{
+	test_vectors();
+	test_random();
+	test_utf16();
+	return tests::finish();
+}
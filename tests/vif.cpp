@@ -0,0 +1,165 @@
+/*
+*	VIF UNPACK encoders against a byte by byte reference of every format, from interleaved and
+*	separate components, and the decoder expanding the data like the VIF.
+*/
+
+#include "check.h"
+
+#include <ps2kernels/vif.h>
+
+#include <algorithm>
+#include <cstring>
+
+namespace
+{
+	struct alignas(16) quadword_t
+	{
+		int32_t lanes[4];
+	};
+
+	/// @brief Encode one element at a time, padded with zeros to a whole quadword
+	std::vector<uint8_t> encode(vif_format_t format, const std::vector<int32_t>& elements)
+	{
+		std::vector<uint8_t> bytes;
+		for (size_t i = 0; i < elements.size(); i += 4)
+		{
+			const int32_t* e = &elements[i];
+			switch (format)
+			{
+			case VIF_V4_32:
+				for (size_t c = 0; c < 4; ++c)
+				{
+					for (int b = 0; b < 4; ++b)
+					{
+						bytes.push_back(static_cast<uint8_t>(e[c] >> (b * 8)));
+					}
+				}
+				break;
+			case VIF_V4_16:
+				for (size_t c = 0; c < 4; ++c)
+				{
+					bytes.push_back(static_cast<uint8_t>(e[c]));
+					bytes.push_back(static_cast<uint8_t>(e[c] >> 8));
+				}
+				break;
+			case VIF_V3_8:
+				for (size_t c = 0; c < 3; ++c)
+				{
+					bytes.push_back(static_cast<uint8_t>(e[c]));
+				}
+				break;
+			case VIF_V4_5:
+			{
+				unsigned value = (e[0] >> 3 & 31) | (e[1] >> 3 & 31) << 5 | (e[2] >> 3 & 31) << 10 | (e[3] >> 7 & 1) << 15;
+				bytes.push_back(static_cast<uint8_t>(value));
+				bytes.push_back(static_cast<uint8_t>(value >> 8));
+				break;
+			}
+			}
+		}
+		bytes.resize((bytes.size() + 15) / 16 * 16, 0);
+		return bytes;
+	}
+
+	bool starts_with(const std::vector<quadword_t>& out, const std::vector<uint8_t>& expected)
+	{
+		return std::equal(expected.begin(), expected.end(), reinterpret_cast<const uint8_t*>(out.data()));
+	}
+
+	/// @brief What the VIF writes to VU memory for an element
+	void expand(vif_format_t format, const int32_t* e, bool is_unsigned, int32_t* out)
+	{
+		for (size_t c = 0; c < 4; ++c)
+		{
+			switch (format)
+			{
+			case VIF_V4_32:
+				out[c] = e[c];
+				break;
+			case VIF_V4_16:
+				out[c] = is_unsigned ? e[c] & 0xFFFF : static_cast<int16_t>(e[c]);
+				break;
+			case VIF_V3_8:
+				out[c] = c == 3 ? 0 : is_unsigned ? e[c] & 0xFF : static_cast<int8_t>(e[c]);
+				break;
+			case VIF_V4_5:
+				out[c] = c == 3 ? (e[c] & 0x80) : (e[c] & 0xF8);
+				break;
+			}
+		}
+	}
+
+	void test_formats()
+	{
+		tests::random random(83);
+		const vif_format_t formats[] = { VIF_V4_32, VIF_V4_16, VIF_V3_8, VIF_V4_5 };
+		for (vif_format_t format : formats)
+		{
+			for (size_t count = 0; count <= 70; count += count < 20 ? 1 : 17)
+			{
+				std::vector<quadword_t> aos(count + 1);
+				std::vector<quadword_t> soa[4];
+				for (std::vector<quadword_t>& s : soa)
+				{
+					s.resize(count / 4 + 1);
+				}
+				std::vector<int32_t> elements(4 * count);
+				for (size_t i = 0; i < count; ++i)
+				{
+					for (size_t c = 0; c < 4; ++c)
+					{
+						int32_t value = static_cast<int32_t>(random.next());
+						elements[4 * i + c] = aos[i].lanes[c] = soa[c][i / 4].lanes[i % 4] = value;
+					}
+				}
+
+				size_t qwc = vif_encoded_qwc(format, count);
+				std::vector<uint8_t> expected = encode(format, elements);
+				std::vector<quadword_t> out(qwc + 1);
+				std::memset(out.data(), 0xCD, out.size() * sizeof(quadword_t));
+				bool passed = CHECK(qwc * 16 == expected.size());
+				passed &= CHECK(vif_encode_aos(format, out.data(), aos[0].lanes, count) == qwc);
+				passed &= CHECK(starts_with(out, expected));
+				passed &= CHECK(out[qwc].lanes[0] == int32_t(0xCDCDCDCD));
+
+				std::memset(out.data(), 0xCD, out.size() * sizeof(quadword_t));
+				const int32_t* components[4] = { soa[0][0].lanes, soa[1][0].lanes, soa[2][0].lanes,
+												 format == VIF_V3_8 ? nullptr : soa[3][0].lanes };
+				passed &= CHECK(vif_encode_soa(format, out.data(), components, count) == qwc);
+				passed &= CHECK(starts_with(out, expected));
+
+				for (bool is_unsigned : { false, true })
+				{
+					std::vector<int32_t> decoded(4 * count + 1);
+					vif_decode(format, decoded.data(), out.data(), count, is_unsigned);
+					for (size_t i = 0; i < count && passed; ++i)
+					{
+						int32_t element[4];
+						expand(format, &elements[4 * i], is_unsigned, element);
+						passed &= CHECK(std::memcmp(element, &decoded[4 * i], sizeof(element)) == 0);
+					}
+				}
+				if (!passed)
+				{
+					std::fprintf(stderr, "  format 0x%02x, %zu elements\n", format, count);
+				}
+			}
+		}
+	}
+
+	void test_unpack_code()
+	{
+		// CMD 0x60 | vn/vl in bits 24-31, NUM 16-23 with 256 as 0, USN 14, ADDR 0-9
+		CHECK(vif_unpack_code(VIF_V4_32, 256, 0, false) == 0x6C000000u);
+		CHECK(vif_unpack_code(VIF_V4_16, 3, 1023, true) == 0x6D0343FFu);
+		CHECK(vif_unpack_code(VIF_V3_8, 16, 0x20, false) == 0x6A100020u);
+		CHECK(vif_unpack_code(VIF_V4_5, 1, 1, false) == 0x6F010001u);
+	}
+}
+
+int main()
+{
+	test_formats();
+	test_unpack_code();
+	return tests::finish();
+}
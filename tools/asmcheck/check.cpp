@@ -0,0 +1,992 @@
+#include "check.h"
+
+#include "machine.h"
+
+#include <algorithm>
+#include <cctype>
+#include <map>
+#include <regex>
+#include <set>
+
+namespace asmcheck
+{
+	const char* const state_field_names[5] = { "LO0", "LO1", "HI0", "HI1", "SA" };
+
+	namespace
+	{
+		enum field { lo0, lo1, hi0, hi1, sa, field_count };
+
+		/// C expression of the safe-mode state member corresponding to each field.
+		const char* const state_expressions[field_count] = { "state->lo[0]", "state->lo[1]", "state->hi[0]",
+															 "state->hi[1]", "state->sa" };
+
+		std::vector<term> field_bytes(const machine_state& state, int f)
+		{
+			switch (f)
+			{
+			case lo0: return slice(state.lo, 0, 8);
+			case lo1: return slice(state.lo, 8, 8);
+			case hi0: return slice(state.hi, 0, 8);
+			case hi1: return slice(state.hi, 8, 8);
+			default: return std::vector<term>(state.sa.begin(), state.sa.end());
+			}
+		}
+
+		int state_field(const std::string& expression)
+		{
+			for (int f = 0; f < field_count; ++f)
+			{
+				if (expression == state_expressions[f])
+				{
+					return f;
+				}
+			}
+			return -1;
+		}
+
+		bool ends_with(const std::string& s, const std::string& suffix)
+		{
+			return s.size() >= suffix.size() && s.compare(s.size() - suffix.size(), suffix.size(), suffix) == 0;
+		}
+
+		bool has_flag(const std::vector<term>& bytes, const term_table& terms, unsigned flag)
+		{
+			return std::any_of(bytes.begin(), bytes.end(), [&](term t) { return (terms.flags(t) & flag) != 0; });
+		}
+
+		// Operand model
+
+		struct operand_info
+		{
+			enum kind_t { reg, memory, immediate };
+
+			const asm_operand* source = nullptr;
+			bool is_output = false;
+			bool is_inout = false;
+			bool early_clobber = false;
+			/// Output used as a scratch register, by convention named 'Tmp...'. Its value is not
+			/// a result of the statement.
+			bool is_scratch = false;
+			kind_t kind = reg;
+			/// Output index an input is tied to by a matching constraint, otherwise -1.
+			int tie = -1;
+		};
+
+		struct instruction_token
+		{
+			enum kind_t { operand, zero, literal };
+
+			kind_t kind = operand;
+			int index = -1;
+			/// Operand modifier, e.g. 'c' in '%c[Name]'.
+			char modifier = 0;
+			std::string text;
+		};
+
+		struct instruction
+		{
+			std::string mnemonic;
+			std::vector<instruction_token> tokens;
+		};
+
+		struct statement_model
+		{
+			const asm_statement* statement = nullptr;
+			std::vector<operand_info> operands;
+			size_t output_count = 0;
+			std::vector<instruction> instructions;
+			bool is_volatile = false;
+			bool clobbers_lo = false;
+			bool clobbers_hi = false;
+		};
+
+		std::string strip_modifiers(const std::string& constraint)
+		{
+			std::string result;
+			for (char c : constraint)
+			{
+				if (c != '=' && c != '+' && c != '&' && c != '%')
+				{
+					result += c;
+				}
+			}
+			return result;
+		}
+
+		bool build_model(const asm_statement& statement, statement_model& model, std::string& error)
+		{
+			model.statement = &statement;
+			model.output_count = statement.outputs.size();
+			model.is_volatile = statement.is_volatile || statement.outputs.empty();
+			for (const std::string& clobber : statement.clobbers)
+			{
+				model.clobbers_lo = model.clobbers_lo || clobber == "lo";
+				model.clobbers_hi = model.clobbers_hi || clobber == "hi";
+			}
+
+			for (size_t i = 0; i < statement.outputs.size() + statement.inputs.size(); ++i)
+			{
+				bool is_output = i < statement.outputs.size();
+				const asm_operand& source = is_output ? statement.outputs[i] : statement.inputs[i - statement.outputs.size()];
+
+				operand_info info;
+				info.source = &source;
+				info.is_output = is_output;
+				info.is_inout = source.constraint.find('+') != std::string::npos;
+				info.early_clobber = source.constraint.find('&') != std::string::npos;
+				info.is_scratch = is_output && source.name.compare(0, 3, "Tmp") == 0;
+
+				std::string letters = strip_modifiers(source.constraint);
+				if (!letters.empty() && std::all_of(letters.begin(), letters.end(), ::isdigit))
+				{
+					info.tie = std::stoi(letters);
+					if (is_output || info.tie >= static_cast<int>(statement.outputs.size()))
+					{
+						error = "invalid matching constraint '" + source.constraint + "'";
+						return false;
+					}
+				}
+				else if (letters.find('r') != std::string::npos)
+				{
+					// Mixed alternatives like "r0" may or may not be tied, treat them as untied.
+					info.kind = operand_info::reg;
+				}
+				else if (letters == "o" || letters == "m" || letters == "ZD")
+				{
+					info.kind = operand_info::memory;
+				}
+				else if (letters == "n" || letters == "i")
+				{
+					info.kind = operand_info::immediate;
+				}
+				else
+				{
+					error = "unsupported constraint '" + source.constraint + "'";
+					return false;
+				}
+				model.operands.push_back(info);
+			}
+
+			for (const std::string& text : statement.instructions)
+			{
+				instruction insn;
+				size_t space = text.find_first_of(" \t");
+				insn.mnemonic = text.substr(0, space);
+				std::string rest = space == std::string::npos ? std::string() : text.substr(space);
+
+				size_t begin = 0;
+				while (begin <= rest.size() && rest.find_first_not_of(" \t") != std::string::npos)
+				{
+					size_t comma = rest.find(',', begin);
+					std::string token = rest.substr(begin, comma == std::string::npos ? std::string::npos : comma - begin);
+					token.erase(0, token.find_first_not_of(" \t"));
+					token.erase(token.find_last_not_of(" \t") + 1);
+
+					instruction_token parsed;
+					if (token == "$0" || token == "$zero")
+					{
+						parsed.kind = instruction_token::zero;
+					}
+					else if (!token.empty() && token[0] == '%')
+					{
+						size_t i = 1;
+						if (i < token.size() && std::isalpha(static_cast<unsigned char>(token[i])))
+						{
+							parsed.modifier = token[i++];
+						}
+						if (i < token.size() && token[i] == '[')
+						{
+							std::string name = token.substr(i + 1, token.find(']') - i - 1);
+							for (size_t j = 0; j < model.operands.size(); ++j)
+							{
+								if (model.operands[j].source->name == name)
+								{
+									parsed.index = static_cast<int>(j);
+								}
+							}
+						}
+						else if (i < token.size() && std::isdigit(static_cast<unsigned char>(token[i])))
+						{
+							parsed.index = std::stoi(token.substr(i));
+						}
+						if (parsed.index < 0 || parsed.index >= static_cast<int>(model.operands.size()))
+						{
+							error = "unknown operand '" + token + "' in '" + text + "'";
+							return false;
+						}
+					}
+					else if (!token.empty() && (std::isdigit(static_cast<unsigned char>(token[0])) || token[0] == '-'))
+					{
+						parsed.kind = instruction_token::literal;
+						parsed.text = token;
+					}
+					else
+					{
+						error = "unsupported operand '" + token + "' in '" + text + "'";
+						return false;
+					}
+					insn.tokens.push_back(parsed);
+
+					if (comma == std::string::npos)
+					{
+						break;
+					}
+					begin = comma + 1;
+				}
+				model.instructions.push_back(insn);
+			}
+			return true;
+		}
+
+		// Symbolic execution
+
+		/// @brief Initial bytes of a value bound to an operand. A 64-bit value in a register has
+		/// unspecified upper bytes. In unsafe mode '.v' holds the 'lo' and 'hi' members of the
+		/// safe mode vector.
+		reg128 value_bytes(term_table& terms, const operand_info& info)
+		{
+			const std::string& expression = info.source->expression;
+			reg128 value;
+			if (info.kind == operand_info::memory)
+			{
+				for (int i = 0; i < 16; ++i)
+				{
+					value[i] = terms.variable(expression, i);
+				}
+			}
+			else if (ends_with(expression, ".v"))
+			{
+				std::string base = expression.substr(0, expression.size() - 2);
+				for (int i = 0; i < 8; ++i)
+				{
+					value[i] = terms.variable(base + ".lo", i);
+					value[8 + i] = terms.variable(base + ".hi", i);
+				}
+			}
+			else
+			{
+				for (int i = 0; i < 8; ++i)
+				{
+					value[i] = terms.variable(expression, i);
+					value[8 + i] = terms.junk("upper(" + expression + ")", i);
+				}
+			}
+			return value;
+		}
+
+		/// @brief Number of bytes of a register operand that belong to the bound C value.
+		int relevant_bytes(const operand_info& info)
+		{
+			return info.kind == operand_info::memory || ends_with(info.source->expression, ".v") ? 16 : 8;
+		}
+
+		struct run_config
+		{
+			/// Fields of LO/HI/SA initialized from the safe-mode state variables instead of caller values.
+			bool variable_field[field_count] = {};
+			/// Output operand placed in the register of 'alias_input', or -1.
+			int alias_output = -1;
+			int alias_input = -1;
+		};
+
+		struct run_result
+		{
+			machine_state initial;
+			machine_state final;
+			/// Register slot of every operand, -1 for non-register operands.
+			std::vector<int> slots;
+			/// Output values keyed by expression, see 'output_values'.
+			std::map<std::string, std::vector<term>> outputs;
+		};
+
+		void initialize_hardware(term_table& terms, const run_config& config, machine_state& state)
+		{
+			for (int f = 0; f < field_count; ++f)
+			{
+				for (int i = 0; i < 8; ++i)
+				{
+					term t = config.variable_field[f] ? terms.variable(state_expressions[f], i) :
+								terms.caller(state_field_names[f], i);
+					switch (f)
+					{
+					case lo0: state.lo[i] = t; break;
+					case lo1: state.lo[8 + i] = t; break;
+					case hi0: state.hi[i] = t; break;
+					case hi1: state.hi[8 + i] = t; break;
+					default: state.sa[i] = t; break;
+					}
+				}
+			}
+		}
+
+		/// @brief Collect output operand values, keyed by the safe-mode expression they correspond to.
+		std::map<std::string, std::vector<term>> output_values(const statement_model& model, const run_result& run)
+		{
+			std::map<std::string, std::vector<term>> outputs;
+			for (size_t i = 0; i < model.output_count; ++i)
+			{
+				const operand_info& info = model.operands[i];
+				const std::string& expression = info.source->expression;
+				if (info.is_scratch)
+				{
+					continue;
+				}
+				if (info.kind == operand_info::memory)
+				{
+					auto it = run.final.memory.find(expression);
+					if (it != run.final.memory.end())
+					{
+						outputs[expression] = slice(it->second, 0, 16);
+					}
+				}
+				else if (info.kind == operand_info::reg)
+				{
+					const reg128& value = run.final.registers[run.slots[i]];
+					if (ends_with(expression, ".v"))
+					{
+						std::string base = expression.substr(0, expression.size() - 2);
+						outputs[base + ".lo"] = slice(value, 0, 8);
+						outputs[base + ".hi"] = slice(value, 8, 8);
+					}
+					else
+					{
+						outputs[expression] = slice(value, 0, 8);
+					}
+				}
+			}
+			return outputs;
+		}
+
+		bool run(term_table& terms, const statement_model& model, const run_config& config, run_result& result,
+				 std::string& error)
+		{
+			machine_state& state = result.initial;
+			initialize_hardware(terms, config, state);
+
+			// Assign register slots. Tied inputs use the register of their output.
+			result.slots.assign(model.operands.size(), -1);
+			int slot_count = 0;
+			for (size_t i = 0; i < model.operands.size(); ++i)
+			{
+				const operand_info& info = model.operands[i];
+				if (info.tie >= 0 || info.kind != operand_info::reg || static_cast<int>(i) == config.alias_output)
+				{
+					continue;
+				}
+				result.slots[i] = slot_count++;
+			}
+			for (size_t i = 0; i < model.operands.size(); ++i)
+			{
+				if (model.operands[i].tie >= 0)
+				{
+					result.slots[i] = result.slots[model.operands[i].tie];
+				}
+			}
+			if (config.alias_output >= 0)
+			{
+				result.slots[config.alias_output] = result.slots[config.alias_input];
+			}
+			state.registers.assign(slot_count, reg128());
+
+			for (size_t i = 0; i < model.operands.size(); ++i)
+			{
+				const operand_info& info = model.operands[i];
+				if (!info.is_output || info.kind == operand_info::immediate)
+				{
+					continue;
+				}
+
+				reg128 value;
+				if (info.is_inout)
+				{
+					value = value_bytes(terms, info);
+				}
+				else
+				{
+					for (int b = 0; b < 16; ++b)
+					{
+						value[b] = terms.junk(info.source->expression, b);
+					}
+				}
+
+				if (info.kind == operand_info::memory)
+				{
+					state.memory[info.source->expression] = value;
+				}
+				else
+				{
+					state.registers[result.slots[i]] = value;
+				}
+			}
+
+			// Inputs after outputs, an input sharing a register with an output provides its value.
+			for (size_t i = model.output_count; i < model.operands.size(); ++i)
+			{
+				const operand_info& info = model.operands[i];
+				if (info.kind == operand_info::memory)
+				{
+					state.memory[info.source->expression] = value_bytes(terms, info);
+				}
+				else if (info.kind == operand_info::reg)
+				{
+					state.registers[result.slots[i]] = value_bytes(terms, info);
+				}
+			}
+
+			result.final = state;
+			r5900 cpu(terms);
+			for (const instruction& insn : model.instructions)
+			{
+				std::vector<machine_operand> operands;
+				for (const instruction_token& token : insn.tokens)
+				{
+					machine_operand operand;
+					if (token.kind == instruction_token::zero)
+					{
+						operand.kind = machine_operand::reg;
+					}
+					else if (token.kind == instruction_token::literal)
+					{
+						operand.kind = machine_operand::immediate;
+						operand.text = token.text;
+					}
+					else
+					{
+						const operand_info& info = model.operands[token.index];
+						if (token.modifier == 'c' || info.kind == operand_info::immediate)
+						{
+							operand.kind = machine_operand::immediate;
+							operand.text = info.source->expression;
+						}
+						else if (token.modifier == 'a' || info.kind == operand_info::memory)
+						{
+							operand.kind = machine_operand::memory;
+							operand.address = info.source->expression;
+						}
+						else
+						{
+							operand.slot = result.slots[token.index];
+						}
+					}
+					operands.push_back(operand);
+				}
+
+				if (!cpu.execute(result.final, insn.mnemonic, operands, error))
+				{
+					return false;
+				}
+			}
+
+			result.outputs = output_values(model, result);
+			return true;
+		}
+
+		// Checks
+
+		struct unit_usage
+		{
+			bool reads[field_count] = {};
+			bool writes[field_count] = {};
+			bool updates[field_count] = {};
+		};
+
+		/// @brief Parse 'This function reads/writes global state (X/Y)' lines.
+		void documented_usage(const std::string& documentation, bool reads[field_count], bool writes[field_count])
+		{
+			static const std::regex pattern("(reads|writes)( to)? global state \\(([^)]*)\\)");
+			for (std::sregex_iterator it(documentation.begin(), documentation.end(), pattern), end; it != end; ++it)
+			{
+				bool* target = (*it)[1] == "reads" ? reads : writes;
+				std::string list = (*it)[3];
+				size_t begin = 0;
+				for (;;)
+				{
+					size_t slash = list.find('/', begin);
+					std::string name = list.substr(begin, slash == std::string::npos ? std::string::npos : slash - begin);
+					if (name == "LO" || name == "LO0")
+					{
+						target[lo0] = true;
+					}
+					if (name == "LO" || name == "LO1")
+					{
+						target[lo1] = true;
+					}
+					if (name == "HI" || name == "HI0")
+					{
+						target[hi0] = true;
+					}
+					if (name == "HI" || name == "HI1")
+					{
+						target[hi1] = true;
+					}
+					if (name == "SA")
+					{
+						target[sa] = true;
+					}
+					if (slash == std::string::npos)
+					{
+						break;
+					}
+					begin = slash + 1;
+				}
+			}
+		}
+
+		class statement_checker
+		{
+		public:
+			statement_checker(const asm_unit& unit, const std::string& mode, std::vector<diagnostic>& diagnostics)
+				: unit(unit), mode(mode), safe(mode == "safe"), diagnostics(diagnostics)
+			{
+			}
+
+			void check(const asm_statement& statement, unit_usage& usage)
+			{
+				this->statement = &statement;
+
+				statement_model model;
+				std::string error;
+				if (!build_model(statement, model, error))
+				{
+					report(diagnostic::error, "cannot interpret asm statement: " + error);
+					return;
+				}
+
+				run_config config;
+				run_result base;
+				if (!run(terms, model, config, base, error))
+				{
+					report(diagnostic::error, "cannot interpret asm statement: " + error);
+					return;
+				}
+
+				bool clean = check_initialized(model, base);
+				check_inputs(model, base);
+				bool changed[field_count];
+				bool read[field_count];
+				hardware_usage(model, base, changed, read);
+				check_hardware(model, base, changed, read);
+				check_sa_timing(model);
+				if (clean)
+				{
+					check_aliasing(model, base);
+				}
+				accumulate(model, base, changed, read, usage);
+			}
+
+		private:
+			void report(diagnostic::severity_t severity, const std::string& message)
+			{
+				diagnostic d;
+				d.severity = severity;
+				d.file = statement ? statement->file : unit.file;
+				d.line = statement ? statement->line : unit.line;
+				d.unit = unit.name;
+				d.mode = mode;
+				d.message = message;
+				diagnostics.push_back(d);
+			}
+
+			/// @brief No output or hardware state may depend on uninitialized values.
+			bool check_initialized(const statement_model& model, const run_result& base)
+			{
+				bool clean = true;
+				for (const auto& output : base.outputs)
+				{
+					if (has_flag(output.second, terms, flag_junk))
+					{
+						auto it = std::find_if(output.second.begin(), output.second.end(),
+											   [&](term t) { return (terms.flags(t) & flag_junk) != 0; });
+						report(diagnostic::error, "output '" + output.first + "' depends on an uninitialized value: " +
+													  terms.to_string(*it));
+						clean = false;
+					}
+				}
+				for (int f = 0; f < field_count; ++f)
+				{
+					if (has_flag(field_bytes(base.final, f), terms, flag_junk))
+					{
+						report(diagnostic::error, std::string("leaves an uninitialized value in ") + state_field_names[f]);
+						clean = false;
+					}
+				}
+				(void)model;
+				return clean;
+			}
+
+			/// @brief Input-only operands may not be modified.
+			void check_inputs(const statement_model& model, const run_result& base)
+			{
+				std::set<int> output_slots;
+				for (size_t i = 0; i < model.output_count; ++i)
+				{
+					output_slots.insert(base.slots[i]);
+				}
+
+				for (size_t i = model.output_count; i < model.operands.size(); ++i)
+				{
+					const operand_info& info = model.operands[i];
+					int count = relevant_bytes(info);
+					if (info.kind == operand_info::reg && !output_slots.count(base.slots[i]))
+					{
+						const reg128& before = base.initial.registers[base.slots[i]];
+						const reg128& after = base.final.registers[base.slots[i]];
+						if (!std::equal(before.begin(), before.begin() + count, after.begin()))
+						{
+							report(diagnostic::error, "modifies input-only operand '" + info.source->expression + "'");
+						}
+					}
+					else if (info.kind == operand_info::memory && info.source->constraint != "ZD")
+					{
+						if (base.initial.memory.at(info.source->expression) != base.final.memory.at(info.source->expression))
+						{
+							report(diagnostic::error, "modifies input-only memory '" + info.source->expression + "'");
+						}
+					}
+				}
+			}
+
+			/// @brief Determine which fields the statement changes and which it reads, by re-running
+			/// it with the initial value of one field replaced.
+			void hardware_usage(const statement_model& model, const run_result& base, bool changed[field_count],
+								bool read[field_count])
+			{
+				for (int f = 0; f < field_count; ++f)
+				{
+					changed[f] = field_bytes(base.initial, f) != field_bytes(base.final, f);
+					read[f] = false;
+
+					run_config config;
+					config.variable_field[f] = true;
+					run_result perturbed;
+					std::string error;
+					if (!run(terms, model, config, perturbed, error))
+					{
+						continue;
+					}
+
+					read[f] = perturbed.outputs != base.outputs || perturbed.final.memory != base.final.memory;
+					for (int g = 0; g < field_count; ++g)
+					{
+						if (g != f && field_bytes(perturbed.final, g) != field_bytes(base.final, g))
+						{
+							read[f] = true;
+						}
+					}
+					if (changed[f] && field_bytes(perturbed.final, f) != field_bytes(base.final, f))
+					{
+						read[f] = true;
+					}
+				}
+			}
+
+			void check_hardware(const statement_model& model, const run_result& base, const bool changed[field_count],
+								const bool read[field_count])
+			{
+				for (int f = 0; f < field_count; ++f)
+				{
+					std::string name = state_field_names[f];
+					bool clobbered = f == sa || (f <= lo1 ? model.clobbers_lo : model.clobbers_hi);
+
+					if (changed[f] && safe && !(model.is_volatile && clobbered))
+					{
+						report(diagnostic::error, "does not restore the caller's " + name + ": " +
+													  terms.to_string(field_bytes(base.final, f)[0]));
+					}
+					else if (changed[f] && !clobbered)
+					{
+						report(diagnostic::error, "writes " + name + " without a '" + (f <= lo1 ? "lo" : "hi") + "' clobber");
+					}
+					else if (changed[f] && !model.is_volatile)
+					{
+						report(diagnostic::error, "writes " + name + " but is not volatile");
+					}
+
+					if (read[f] && !model.is_volatile)
+					{
+						report(diagnostic::error, "reads the caller's " + name + " but is not volatile");
+					}
+				}
+			}
+
+			/// @brief MTSA may not follow MFSA/MTSAB/MTSAH/QFSRV and MTSAB/MTSAH may not follow
+			/// MFSA/QFSRV within 3 instructions.
+			void check_sa_timing(const statement_model& model)
+			{
+				const std::vector<instruction>& instructions = model.instructions;
+				for (size_t i = 0; i < instructions.size(); ++i)
+				{
+					const std::string& mnemonic = instructions[i].mnemonic;
+					if (mnemonic != "mtsa" && mnemonic != "mtsab" && mnemonic != "mtsah")
+					{
+						continue;
+					}
+
+					for (size_t j = i >= 3 ? i - 3 : 0; j < i; ++j)
+					{
+						const std::string& previous = instructions[j].mnemonic;
+						bool hazard = previous == "mfsa" || previous == "qfsrv" ||
+									  (mnemonic == "mtsa" && (previous == "mtsab" || previous == "mtsah"));
+						if (hazard)
+						{
+							report(diagnostic::error, "'" + mnemonic + "' follows '" + previous + "' by " +
+														  std::to_string(i - j) + " instruction(s), needs more than 3");
+						}
+					}
+				}
+			}
+
+			/// @brief Outputs without early-clobber may share a register with any input.
+			void check_aliasing(const statement_model& model, const run_result& base)
+			{
+				for (size_t o = 0; o < model.output_count; ++o)
+				{
+					const operand_info& output = model.operands[o];
+					if (output.kind != operand_info::reg || output.early_clobber || output.is_inout)
+					{
+						continue;
+					}
+
+					for (size_t i = model.output_count; i < model.operands.size(); ++i)
+					{
+						const operand_info& input = model.operands[i];
+						if (input.kind != operand_info::reg || input.tie >= 0)
+						{
+							continue;
+						}
+
+						run_config config;
+						config.alias_output = static_cast<int>(o);
+						config.alias_input = static_cast<int>(i);
+						run_result aliased;
+						std::string error;
+						if (!run(terms, model, config, aliased, error))
+						{
+							continue;
+						}
+
+						bool same = aliased.outputs == base.outputs && aliased.final.memory == base.final.memory &&
+									aliased.final.lo == base.final.lo && aliased.final.hi == base.final.hi &&
+									aliased.final.sa == base.final.sa;
+						if (!same)
+						{
+							report(diagnostic::error, "output '" + output.source->expression +
+														  "' is written before input '" + input.source->expression +
+														  "' is last read; it needs an early-clobber ('&')");
+						}
+					}
+				}
+			}
+
+			void accumulate(const statement_model& model, const run_result& base, const bool changed[field_count],
+							const bool read[field_count], unit_usage& usage)
+			{
+				for (int f = 0; f < field_count; ++f)
+				{
+					usage.reads[f] = usage.reads[f] || read[f];
+					usage.writes[f] = usage.writes[f] || changed[f];
+					usage.updates[f] = usage.updates[f] || changed[f];
+				}
+				if (!safe)
+				{
+					return;
+				}
+
+				// In safe mode the state variables stand in for LO/HI/SA.
+				for (size_t i = 0; i < model.operands.size(); ++i)
+				{
+					const operand_info& info = model.operands[i];
+					int f = state_field(info.source->expression);
+					if (f < 0)
+					{
+						continue;
+					}
+					if (!info.is_output || info.is_inout)
+					{
+						usage.reads[f] = true;
+					}
+					if (info.is_output)
+					{
+						auto it = base.outputs.find(info.source->expression);
+						std::vector<term> initial = slice(value_bytes(terms, info), 0, 8);
+						// Copying the caller's registers into the state is a read, see 'lohi_state_construct'.
+						if (it != base.outputs.end() && it->second != initial)
+						{
+							usage.updates[f] = true;
+							if (!has_flag(it->second, terms, flag_caller))
+							{
+								usage.writes[f] = true;
+							}
+						}
+					}
+				}
+			}
+
+			const asm_unit& unit;
+			std::string mode;
+			bool safe;
+			std::vector<diagnostic>& diagnostics;
+			const asm_statement* statement = nullptr;
+			term_table terms;
+		};
+	}
+
+	void check_units(const std::vector<asm_unit>& units, const std::string& mode, std::vector<diagnostic>& diagnostics,
+					 std::vector<state_report>& reports)
+	{
+		for (const asm_unit& unit : units)
+		{
+			unit_usage usage;
+			statement_checker checker(unit, mode, diagnostics);
+			for (const asm_statement& statement : unit.statements)
+			{
+				checker.check(statement, usage);
+			}
+
+			bool documented_reads[field_count] = {};
+			bool documented_writes[field_count] = {};
+			documented_usage(unit.documentation, documented_reads, documented_writes);
+
+			state_report report;
+			report.unit = unit.name;
+			report.mode = mode;
+			report.file = unit.file;
+			report.line = unit.line;
+
+			for (int f = 0; f < field_count; ++f)
+			{
+				std::string name = state_field_names[f];
+				diagnostic d;
+				d.file = unit.file;
+				d.line = unit.line;
+				d.unit = unit.name;
+				d.mode = mode;
+
+				if (usage.writes[f] && !documented_writes[f])
+				{
+					d.severity = diagnostic::error;
+					d.message = "writes " + name + " but is not documented to write global state (" + name + ")";
+					diagnostics.push_back(d);
+				}
+				else if (usage.reads[f] && !documented_reads[f] && !documented_writes[f])
+				{
+					d.severity = diagnostic::warning;
+					d.message = "reads " + name + " but is not documented to read global state (" + name + ")";
+					diagnostics.push_back(d);
+				}
+
+				std::string status = usage.reads[f] ? "read" : "";
+				if (usage.updates[f])
+				{
+					status += status.empty() ? "updated" : ", updated";
+				}
+				report.fields.push_back(status.empty() ? "preserved" : status);
+			}
+			reports.push_back(report);
+		}
+	}
+
+	void check_equivalence(const std::vector<asm_unit>& safe_units, const std::vector<asm_unit>& unsafe_units,
+						   std::vector<diagnostic>& diagnostics)
+	{
+		std::map<std::string, const asm_unit*> unsafe_by_name;
+		for (const asm_unit& unit : unsafe_units)
+		{
+			unsafe_by_name[unit.name] = &unit;
+		}
+
+		for (const asm_unit& safe_unit : safe_units)
+		{
+			auto it = unsafe_by_name.find(safe_unit.name);
+			if (it == unsafe_by_name.end() || safe_unit.statements.size() != 1 || it->second->statements.size() != 1)
+			{
+				continue;
+			}
+			const asm_unit& unsafe_unit = *it->second;
+
+			term_table terms;
+			statement_model safe_model;
+			statement_model unsafe_model;
+			std::string error;
+			if (!build_model(safe_unit.statements[0], safe_model, error) ||
+				!build_model(unsafe_unit.statements[0], unsafe_model, error))
+			{
+				continue;
+			}
+
+			run_config safe_config;
+			run_config unsafe_config;
+			for (int f = 0; f < field_count; ++f)
+			{
+				unsafe_config.variable_field[f] = true;
+			}
+
+			run_result safe_run;
+			run_result unsafe_run;
+			if (!run(terms, safe_model, safe_config, safe_run, error) ||
+				!run(terms, unsafe_model, unsafe_config, unsafe_run, error))
+			{
+				continue;
+			}
+
+			// In unsafe mode the state variables live in the hardware registers.
+			std::map<std::string, std::vector<term>> unsafe_values = unsafe_run.outputs;
+			for (int f = 0; f < field_count; ++f)
+			{
+				unsafe_values[state_expressions[f]] = field_bytes(unsafe_run.final, f);
+			}
+
+			// Only statements naming the state variables are responsible for keeping them current,
+			// macros like 'MTSAB_BOTH' update them in C afterwards.
+			bool uses_state = std::any_of(safe_model.operands.begin(), safe_model.operands.end(),
+										  [](const operand_info& info) { return state_field(info.source->expression) >= 0; });
+
+			std::map<std::string, std::vector<term>> safe_values = safe_run.outputs;
+			for (int f = 0; f < field_count && uses_state; ++f)
+			{
+				if (!safe_values.count(state_expressions[f]))
+				{
+					std::vector<term> unchanged;
+					for (int i = 0; i < 8; ++i)
+					{
+						unchanged.push_back(terms.variable(state_expressions[f], i));
+					}
+					safe_values[state_expressions[f]] = unchanged;
+				}
+			}
+
+			for (const auto& value : safe_values)
+			{
+				auto other = unsafe_values.find(value.first);
+				if (other == unsafe_values.end() || other->second.size() != value.second.size() ||
+					(!uses_state && state_field(value.first) >= 0))
+				{
+					continue;
+				}
+				// Uninitialized values are already reported for each mode.
+				if (has_flag(value.second, terms, flag_junk) || has_flag(other->second, terms, flag_junk))
+				{
+					continue;
+				}
+
+				for (size_t b = 0; b < value.second.size(); ++b)
+				{
+					if (value.second[b] != other->second[b])
+					{
+						diagnostic d;
+						d.severity = diagnostic::error;
+						d.file = safe_unit.statements[0].file;
+						d.line = safe_unit.statements[0].line;
+						d.unit = safe_unit.name;
+						d.mode = "safe";
+						d.message = "computes a different '" + value.first + "' than unsafe mode (byte " +
+									std::to_string(b) + ": " + terms.to_string(value.second[b]) + " vs " +
+									terms.to_string(other->second[b]) + ")";
+						diagnostics.push_back(d);
+						break;
+					}
+				}
+			}
+		}
+	}
+}
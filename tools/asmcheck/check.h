@@ -0,0 +1,66 @@
+#pragma once
+
+/*
+*	Checks run on every asm unit, in safe and unsafe mode:
+*
+*	- No output, memory operand or LO/HI/SA byte may depend on an uninitialized value, e.g. an
+*	  output operand read before it is written.
+*	- Input-only operands may not be modified (only the bytes the bound C value occupies count).
+*	- An output operand without early-clobber ('&') may share a register with any input. The
+*	  statement must compute the same results when it does.
+*	- Safe mode: the caller's LO/HI/SA must be restored unless the statement is volatile and
+*	  meant to write them. Unsafe mode: LO/HI writes need a clobber and the statement must be
+*	  volatile when it reads or writes LO/HI/SA.
+*	- MTSA, MTSAB and MTSAH may not follow MFSA, MTSAB, MTSAH or QFSRV too closely.
+*	- Which of LO0/LO1/HI0/HI1/SA are read and written must match the 'This function reads/writes
+*	  global state (...)' line of the documentation comment.
+*	- Where a unit consists of a single asm statement in both modes, the safe version must
+*	  compute exactly what the unsafe version computes, including the LO/HI/SA updates.
+*/
+
+#include "source.h"
+
+#include <string>
+#include <vector>
+
+namespace asmcheck
+{
+	struct diagnostic
+	{
+		enum severity_t { note, warning, error };
+
+		severity_t severity = error;
+		std::string file;
+		int line = 0;
+		std::string unit;
+		/// "safe" or "unsafe"
+		std::string mode;
+		std::string message;
+	};
+
+	/// @brief Per-unit summary of the LO0/LO1/HI0/HI1/SA handling, for verbose output.
+	struct state_report
+	{
+		std::string unit;
+		std::string mode;
+		std::string file;
+		int line = 0;
+		/// One entry per field: "preserved", "read", "updated" or "read, updated".
+		std::vector<std::string> fields;
+	};
+
+	/// @brief Names of the fields reported in 'state_report::fields'.
+	extern const char* const state_field_names[5];
+
+	/// @brief Run all checks on the units of one mode.
+	/// @param units Units extracted in 'mode'
+	/// @param mode "safe" or "unsafe"
+	/// @param diagnostics Receives findings
+	/// @param reports Receives one report per unit
+	void check_units(const std::vector<asm_unit>& units, const std::string& mode, std::vector<diagnostic>& diagnostics,
+					 std::vector<state_report>& reports);
+
+	/// @brief Compare single-statement units present in both modes.
+	void check_equivalence(const std::vector<asm_unit>& safe_units, const std::vector<asm_unit>& unsafe_units,
+						   std::vector<diagnostic>& diagnostics);
+}
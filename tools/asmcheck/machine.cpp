@@ -0,0 +1,818 @@
+#include "machine.h"
+
+#include <set>
+
+namespace asmcheck
+{
+	namespace
+	{
+		/// @brief Copy 'count' bytes of 'source' at 'from' into 'target' at 'to'.
+		void move(reg128& target, int to, const reg128& source, int from, int count)
+		{
+			for (int i = 0; i < count; ++i)
+			{
+				target[to + i] = source[from + i];
+			}
+		}
+
+		bool ends_with(const std::string& s, const std::string& suffix)
+		{
+			return s.size() >= suffix.size() && s.compare(s.size() - suffix.size(), suffix.size(), suffix) == 0;
+		}
+
+		bool starts_with(const std::string& s, const std::string& prefix)
+		{
+			return s.compare(0, prefix.size(), prefix) == 0;
+		}
+
+		/// @brief Width in bytes of the lanes of a parallel instruction, judged by its suffix.
+		int lane_width(const std::string& mnemonic)
+		{
+			if (ends_with(mnemonic, "b"))
+			{
+				return 1;
+			}
+			if (ends_with(mnemonic, "h"))
+			{
+				return 2;
+			}
+			return 4;
+		}
+
+		// Lanewise parallel instructions in the 'rd, rs, rt' form.
+		const std::set<std::string> parallel_binary = {
+			"paddb", "paddh", "paddw", "paddsb", "paddsh", "paddsw", "paddub", "padduh", "padduw",
+			"psubb", "psubh", "psubw", "psubsb", "psubsh", "psubsw", "psubub", "psubuh", "psubuw",
+			"padsbh", "pcgtb", "pcgth", "pcgtw", "pceqb", "pceqh", "pceqw",
+			"pmaxh", "pmaxw", "pminh", "pminw",
+		};
+
+		// Lanewise parallel instructions in the 'rd, rt' form.
+		const std::set<std::string> parallel_unary = { "pabsh", "pabsw", "pext5", "ppac5" };
+
+		// Parallel shifts in the 'rd, rt, sa' form.
+		const std::set<std::string> parallel_shift = { "psllh", "psllw", "psrah", "psraw", "psrlh", "psrlw" };
+
+		// Parallel variable shifts in the 'rd, rt, rs' form, operating on doublewords.
+		const std::set<std::string> parallel_variable_shift = { "psllvw", "psravw", "psrlvw" };
+	}
+
+	std::vector<term> slice(const reg128& source, int offset, int count)
+	{
+		return std::vector<term>(source.begin() + offset, source.begin() + offset + count);
+	}
+
+	// term_table
+
+	term_table::term_table()
+	{
+		intern("0", {}, 0);
+	}
+
+	term term_table::intern(const std::string& op, const std::vector<term>& args, unsigned flags)
+	{
+		auto key = std::make_pair(op, args);
+		auto it = index.find(key);
+		if (it != index.end())
+		{
+			return it->second;
+		}
+
+		term t = static_cast<term>(nodes.size());
+		nodes.push_back({ op, args, flags });
+		index.emplace(std::move(key), t);
+		return t;
+	}
+
+	term term_table::variable(const std::string& name, int byte)
+	{
+		return intern(name + "#" + std::to_string(byte), {}, 0);
+	}
+
+	term term_table::junk(const std::string& name, int byte)
+	{
+		return intern("junk(" + name + ")#" + std::to_string(byte), {}, flag_junk);
+	}
+
+	term term_table::caller(const std::string& name, int byte)
+	{
+		return intern("caller(" + name + ")#" + std::to_string(byte), {}, flag_caller);
+	}
+
+	term term_table::undefined(const std::string& name, int byte)
+	{
+		return intern("undefined(" + name + ")#" + std::to_string(byte), {}, 0);
+	}
+
+	term term_table::apply(const std::string& op, const std::vector<term>& args)
+	{
+		unsigned flags = 0;
+		for (term arg : args)
+		{
+			flags |= nodes[arg].flags;
+		}
+		return intern(op, args, flags);
+	}
+
+	std::string term_table::to_string(term t, int depth) const
+	{
+		const node& n = nodes[t];
+		if (n.args.empty())
+		{
+			return n.op;
+		}
+		if (depth <= 0)
+		{
+			return n.op + "(...)";
+		}
+
+		std::string result = n.op + "(";
+		for (size_t i = 0; i < n.args.size(); ++i)
+		{
+			if (i == 4 && n.args.size() > 5)
+			{
+				result += ", ...";
+				break;
+			}
+			result += (i ? ", " : "") + to_string(n.args[i], depth - 1);
+		}
+		return result + ")";
+	}
+
+	// r5900
+
+	bool r5900::uses_sa(const std::string& mnemonic)
+	{
+		return mnemonic == "mfsa" || mnemonic == "mtsa" || mnemonic == "mtsab" || mnemonic == "mtsah" ||
+			   mnemonic == "qfsrv";
+	}
+
+	reg128 r5900::read(const machine_state& state, const machine_operand& operand) const
+	{
+		if (operand.kind == machine_operand::memory)
+		{
+			auto it = state.memory.find(operand.address);
+			if (it != state.memory.end())
+			{
+				return it->second;
+			}
+			reg128 value;
+			for (int i = 0; i < 16; ++i)
+			{
+				value[i] = terms.variable(operand.address, i);
+			}
+			return value;
+		}
+
+		if (operand.slot < 0)
+		{
+			reg128 zero;
+			zero.fill(terms.zero());
+			return zero;
+		}
+		return state.registers[operand.slot];
+	}
+
+	void r5900::write(machine_state& state, const machine_operand& operand, const reg128& value) const
+	{
+		if (operand.kind == machine_operand::memory)
+		{
+			state.memory[operand.address] = value;
+		}
+		else if (operand.slot >= 0)
+		{
+			state.registers[operand.slot] = value;
+		}
+	}
+
+	void r5900::write64(machine_state& state, const machine_operand& operand, const reg128& value) const
+	{
+		// 64-bit instructions leave the upper doubleword of the destination alone.
+		reg128 merged = read(state, operand);
+		move(merged, 0, value, 0, 8);
+		write(state, operand, merged);
+	}
+
+	std::vector<term> r5900::bytes_of(term value, int count)
+	{
+		std::vector<term> bytes;
+		for (int i = 0; i < count; ++i)
+		{
+			bytes.push_back(terms.apply("byte" + std::to_string(i), { value }));
+		}
+		return bytes;
+	}
+
+	reg128 r5900::lanewise(const std::string& op, int width, const std::vector<reg128>& sources)
+	{
+		reg128 result;
+		for (int lane = 0; lane < 16 / width; ++lane)
+		{
+			std::vector<term> args;
+			for (const reg128& source : sources)
+			{
+				std::vector<term> part = slice(source, lane * width, width);
+				args.insert(args.end(), part.begin(), part.end());
+			}
+
+			term value = terms.apply(op + "[" + std::to_string(lane) + "]", args);
+			std::vector<term> bytes = bytes_of(value, width);
+			for (int i = 0; i < width; ++i)
+			{
+				result[lane * width + i] = bytes[i];
+			}
+		}
+		return result;
+	}
+
+	bool r5900::execute(machine_state& state, const std::string& mnemonic, const std::vector<machine_operand>& operands,
+						std::string& error)
+	{
+		auto expect = [&](size_t count) {
+			if (operands.size() != count)
+			{
+				error = "'" + mnemonic + "' expects " + std::to_string(count) + " operands, got " +
+						std::to_string(operands.size());
+				return false;
+			}
+			for (size_t i = 0; i < count; ++i)
+			{
+				if (operands[i].kind == machine_operand::immediate)
+				{
+					error = "'" + mnemonic + "' operand " + std::to_string(i + 1) + " must be a register";
+					return false;
+				}
+			}
+			return true;
+		};
+		auto reg = [&](size_t i) { return read(state, operands[i]); };
+		auto put = [&](reg128& target, int offset, const std::vector<term>& bytes) {
+			for (size_t i = 0; i < bytes.size(); ++i)
+			{
+				target[offset + i] = bytes[i];
+			}
+		};
+		auto concat = [](std::vector<term> a, const std::vector<term>& b) {
+			a.insert(a.end(), b.begin(), b.end());
+			return a;
+		};
+
+		// No architectural effect on the modelled state.
+
+		if (mnemonic == "nop" || mnemonic == "break" || mnemonic == "pref")
+		{
+			return true;
+		}
+
+		// Loads and stores
+
+		if (mnemonic == "lq" || mnemonic == "sq")
+		{
+			if (operands.size() != 2 || operands[0].kind != machine_operand::reg ||
+				operands[1].kind != machine_operand::memory)
+			{
+				error = "'" + mnemonic + "' expects a register and a memory operand";
+				return false;
+			}
+			if (mnemonic == "lq")
+			{
+				write(state, operands[0], read(state, operands[1]));
+			}
+			else
+			{
+				write(state, operands[1], reg(0));
+			}
+			return true;
+		}
+
+		// Exact copies and permutations
+
+		if (mnemonic == "pcpyld" || mnemonic == "pcpyud" || mnemonic == "pextlb" || mnemonic == "pextub" ||
+			mnemonic == "pextlh" || mnemonic == "pextuh" || mnemonic == "pextlw" || mnemonic == "pextuw" ||
+			mnemonic == "ppacb" || mnemonic == "ppach" || mnemonic == "ppacw" || mnemonic == "pinth" ||
+			mnemonic == "pinteh" || mnemonic == "por" || mnemonic == "pand" || mnemonic == "pxor" ||
+			mnemonic == "pnor")
+		{
+			if (!expect(3))
+			{
+				return false;
+			}
+			reg128 rs = reg(1);
+			reg128 rt = reg(2);
+			reg128 rd;
+
+			if (mnemonic == "pcpyld")
+			{
+				move(rd, 0, rt, 0, 8);
+				move(rd, 8, rs, 0, 8);
+			}
+			else if (mnemonic == "pcpyud")
+			{
+				move(rd, 0, rs, 8, 8);
+				move(rd, 8, rt, 8, 8);
+			}
+			else if (starts_with(mnemonic, "pext"))
+			{
+				int width = lane_width(mnemonic);
+				int count = 8 / width;
+				int base = mnemonic[4] == 'u' ? count : 0;
+				for (int i = 0; i < count; ++i)
+				{
+					move(rd, 2 * i * width, rt, (base + i) * width, width);
+					move(rd, (2 * i + 1) * width, rs, (base + i) * width, width);
+				}
+			}
+			else if (starts_with(mnemonic, "ppac"))
+			{
+				int width = lane_width(mnemonic);
+				int count = 8 / width;
+				for (int i = 0; i < count; ++i)
+				{
+					move(rd, i * width, rt, 2 * i * width, width);
+					move(rd, (count + i) * width, rs, 2 * i * width, width);
+				}
+			}
+			else if (mnemonic == "pinth")
+			{
+				for (int i = 0; i < 4; ++i)
+				{
+					move(rd, 4 * i, rt, 2 * i, 2);
+					move(rd, 4 * i + 2, rs, 8 + 2 * i, 2);
+				}
+			}
+			else if (mnemonic == "pinteh")
+			{
+				for (int i = 0; i < 4; ++i)
+				{
+					move(rd, 4 * i, rt, 4 * i, 2);
+					move(rd, 4 * i + 2, rs, 4 * i, 2);
+				}
+			}
+			else
+			{
+				// Bitwise logic, with the identities the headers rely on for moves and zeroing.
+				for (int i = 0; i < 16; ++i)
+				{
+					term a = rs[i];
+					term b = rt[i];
+					term z = terms.zero();
+					if (mnemonic == "por")
+					{
+						rd[i] = a == z ? b : b == z || a == b ? a : terms.apply("or", { a, b });
+					}
+					else if (mnemonic == "pand")
+					{
+						rd[i] = a == z || b == z ? z : a == b ? a : terms.apply("and", { a, b });
+					}
+					else if (mnemonic == "pxor")
+					{
+						rd[i] = a == b ? z : a == z ? b : b == z ? a : terms.apply("xor", { a, b });
+					}
+					else
+					{
+						rd[i] = terms.apply("nor", { a, b });
+					}
+				}
+			}
+
+			write(state, operands[0], rd);
+			return true;
+		}
+
+		if (mnemonic == "pcpyh" || mnemonic == "pexeh" || mnemonic == "pexew" || mnemonic == "pexch" ||
+			mnemonic == "pexcw" || mnemonic == "prevh" || mnemonic == "prot3w")
+		{
+			if (!expect(2))
+			{
+				return false;
+			}
+			reg128 rt = reg(1);
+			reg128 rd;
+
+			// Source halfword (or word) index for every destination halfword (or word).
+			std::vector<int> order;
+			int width = 2;
+			if (mnemonic == "pcpyh")
+			{
+				order = { 0, 0, 0, 0, 4, 4, 4, 4 };
+			}
+			else if (mnemonic == "pexeh")
+			{
+				order = { 2, 1, 0, 3, 6, 5, 4, 7 };
+			}
+			else if (mnemonic == "pexch")
+			{
+				order = { 0, 2, 1, 3, 4, 6, 5, 7 };
+			}
+			else if (mnemonic == "prevh")
+			{
+				order = { 3, 2, 1, 0, 7, 6, 5, 4 };
+			}
+			else if (mnemonic == "pexew")
+			{
+				order = { 2, 1, 0, 3 };
+				width = 4;
+			}
+			else if (mnemonic == "pexcw")
+			{
+				order = { 0, 2, 1, 3 };
+				width = 4;
+			}
+			else
+			{
+				order = { 1, 2, 0, 3 };
+				width = 4;
+			}
+
+			for (size_t i = 0; i < order.size(); ++i)
+			{
+				move(rd, static_cast<int>(i) * width, rt, order[i] * width, width);
+			}
+			write(state, operands[0], rd);
+			return true;
+		}
+
+		// Lanewise arithmetic
+
+		if (parallel_binary.count(mnemonic))
+		{
+			if (!expect(3))
+			{
+				return false;
+			}
+			write(state, operands[0], lanewise(mnemonic, lane_width(mnemonic), { reg(1), reg(2) }));
+			return true;
+		}
+
+		if (parallel_unary.count(mnemonic))
+		{
+			if (!expect(2))
+			{
+				return false;
+			}
+			write(state, operands[0], lanewise(mnemonic, lane_width(mnemonic), { reg(1) }));
+			return true;
+		}
+
+		if (parallel_shift.count(mnemonic))
+		{
+			if (operands.size() != 3 || operands[2].kind != machine_operand::immediate)
+			{
+				error = "'" + mnemonic + "' expects two registers and an immediate";
+				return false;
+			}
+			write(state, operands[0], lanewise(mnemonic + "<" + operands[2].text + ">", lane_width(mnemonic), { reg(1) }));
+			return true;
+		}
+
+		if (parallel_variable_shift.count(mnemonic))
+		{
+			if (!expect(3))
+			{
+				return false;
+			}
+			write(state, operands[0], lanewise(mnemonic, 8, { reg(1), reg(2) }));
+			return true;
+		}
+
+		if (mnemonic == "plzcw")
+		{
+			if (!expect(2))
+			{
+				return false;
+			}
+			write64(state, operands[0], lanewise(mnemonic, 4, { reg(1) }));
+			return true;
+		}
+
+		if (mnemonic == "qfsrv")
+		{
+			if (!expect(3))
+			{
+				return false;
+			}
+			term value = terms.apply("qfsrv", concat(concat(slice(reg(1), 0, 16), slice(reg(2), 0, 16)),
+													  std::vector<term>(state.sa.begin(), state.sa.end())));
+			reg128 rd;
+			put(rd, 0, bytes_of(value, 16));
+			write(state, operands[0], rd);
+			return true;
+		}
+
+		// LO/HI transfers
+
+		if (mnemonic == "pmflo" || mnemonic == "pmfhi")
+		{
+			if (!expect(1))
+			{
+				return false;
+			}
+			write(state, operands[0], mnemonic == "pmflo" ? state.lo : state.hi);
+			return true;
+		}
+
+		if (mnemonic == "pmtlo" || mnemonic == "pmthi")
+		{
+			if (!expect(1))
+			{
+				return false;
+			}
+			(mnemonic == "pmtlo" ? state.lo : state.hi) = reg(0);
+			return true;
+		}
+
+		if (mnemonic == "mflo" || mnemonic == "mfhi" || mnemonic == "mflo1" || mnemonic == "mfhi1")
+		{
+			if (!expect(1))
+			{
+				return false;
+			}
+			const reg128& source = mnemonic[2] == 'l' ? state.lo : state.hi;
+			reg128 value;
+			move(value, 0, source, ends_with(mnemonic, "1") ? 8 : 0, 8);
+			write64(state, operands[0], value);
+			return true;
+		}
+
+		if (mnemonic == "mtlo" || mnemonic == "mthi" || mnemonic == "mtlo1" || mnemonic == "mthi1")
+		{
+			if (!expect(1))
+			{
+				return false;
+			}
+			reg128& target = mnemonic[2] == 'l' ? state.lo : state.hi;
+			move(target, ends_with(mnemonic, "1") ? 8 : 0, reg(0), 0, 8);
+			return true;
+		}
+
+		if (mnemonic == "pmthl.lw")
+		{
+			if (!expect(1))
+			{
+				return false;
+			}
+			reg128 rs = reg(0);
+			move(state.lo, 0, rs, 0, 4);
+			move(state.hi, 0, rs, 4, 4);
+			move(state.lo, 8, rs, 8, 4);
+			move(state.hi, 8, rs, 12, 4);
+			return true;
+		}
+
+		if (starts_with(mnemonic, "pmfhl."))
+		{
+			if (!expect(1))
+			{
+				return false;
+			}
+			reg128 rd;
+			if (mnemonic == "pmfhl.lw" || mnemonic == "pmfhl.uw")
+			{
+				int word = mnemonic == "pmfhl.lw" ? 0 : 4;
+				move(rd, 0, state.lo, word, 4);
+				move(rd, 4, state.hi, word, 4);
+				move(rd, 8, state.lo, 8 + word, 4);
+				move(rd, 12, state.hi, 8 + word, 4);
+			}
+			else if (mnemonic == "pmfhl.lh")
+			{
+				for (int dw = 0; dw < 2; ++dw)
+				{
+					move(rd, dw * 8 + 0, state.lo, dw * 8 + 0, 2);
+					move(rd, dw * 8 + 2, state.lo, dw * 8 + 4, 2);
+					move(rd, dw * 8 + 4, state.hi, dw * 8 + 0, 2);
+					move(rd, dw * 8 + 6, state.hi, dw * 8 + 4, 2);
+				}
+			}
+			else if (mnemonic == "pmfhl.sh" || mnemonic == "pmfhl.slw")
+			{
+				term value = terms.apply(mnemonic, concat(slice(state.lo, 0, 16), slice(state.hi, 0, 16)));
+				put(rd, 0, bytes_of(value, 16));
+			}
+			else
+			{
+				error = "unsupported instruction '" + mnemonic + "'";
+				return false;
+			}
+			write(state, operands[0], rd);
+			return true;
+		}
+
+		// Scalar multiply, multiply-add and divide on pipeline 0 ('mult') or 1 ('mult1')
+
+		if (starts_with(mnemonic, "mult") || starts_with(mnemonic, "madd") || starts_with(mnemonic, "div"))
+		{
+			bool pipeline1 = ends_with(mnemonic, "1");
+			std::string base = pipeline1 ? mnemonic.substr(0, mnemonic.size() - 1) : mnemonic;
+			if (base != "mult" && base != "multu" && base != "madd" && base != "maddu" && base != "div" &&
+				base != "divu")
+			{
+				error = "unsupported instruction '" + mnemonic + "'";
+				return false;
+			}
+			if (operands.size() != 2 && !expect(3))
+			{
+				return false;
+			}
+			if (!expect(operands.size()))
+			{
+				return false;
+			}
+
+			size_t first = operands.size() == 3 ? 1 : 0;
+			int offset = pipeline1 ? 8 : 0;
+			std::vector<term> args = concat(slice(reg(first), 0, 4), slice(reg(first + 1), 0, 4));
+			if (starts_with(base, "madd"))
+			{
+				args = concat(concat(args, slice(state.lo, offset, 4)), slice(state.hi, offset, 4));
+			}
+
+			term lo = terms.apply(mnemonic + ".lo", args);
+			term hi = terms.apply(mnemonic + ".hi", args);
+			std::vector<term> lo_bytes = bytes_of(lo, 8);
+			put(state.lo, offset, lo_bytes);
+			put(state.hi, offset, bytes_of(hi, 8));
+
+			// The 3-operand form of 'div' only exists as assembler syntax with '$0' as target.
+			if (operands.size() == 3 && !starts_with(base, "div"))
+			{
+				reg128 rd;
+				put(rd, 0, lo_bytes);
+				write64(state, operands[0], rd);
+			}
+			return true;
+		}
+
+		// Parallel multiply, multiply-add and divide
+
+		if (mnemonic == "pmulth" || mnemonic == "pmaddh" || mnemonic == "pmsubh")
+		{
+			if (!expect(3))
+			{
+				return false;
+			}
+			reg128 rs = reg(1);
+			reg128 rt = reg(2);
+
+			// LO/HI word receiving product i, as (register, byte offset).
+			static const int placement[8][2] = { { 0, 0 }, { 0, 4 }, { 1, 0 }, { 1, 4 },
+												 { 0, 8 }, { 0, 12 }, { 1, 8 }, { 1, 12 } };
+			std::vector<term> products[8];
+			for (int i = 0; i < 8; ++i)
+			{
+				std::vector<term> args = concat(slice(rs, 2 * i, 2), slice(rt, 2 * i, 2));
+				if (mnemonic != "pmulth")
+				{
+					const reg128& acc = placement[i][0] ? state.hi : state.lo;
+					args = concat(args, slice(acc, placement[i][1], 4));
+				}
+				products[i] = bytes_of(terms.apply(mnemonic + "[" + std::to_string(i) + "]", args), 4);
+			}
+
+			reg128 rd;
+			for (int i = 0; i < 8; ++i)
+			{
+				put(placement[i][0] ? state.hi : state.lo, placement[i][1], products[i]);
+			}
+			put(rd, 0, products[0]);
+			put(rd, 4, products[2]);
+			put(rd, 8, products[4]);
+			put(rd, 12, products[6]);
+			write(state, operands[0], rd);
+			return true;
+		}
+
+		if (mnemonic == "phmadh" || mnemonic == "phmsbh")
+		{
+			if (!expect(3))
+			{
+				return false;
+			}
+			reg128 rs = reg(1);
+			reg128 rt = reg(2);
+			reg128 rd;
+			for (int j = 0; j < 4; ++j)
+			{
+				std::vector<term> args = concat(concat(slice(rs, 4 * j, 2), slice(rt, 4 * j, 2)),
+												concat(slice(rs, 4 * j + 2, 2), slice(rt, 4 * j + 2, 2)));
+				std::vector<term> value = bytes_of(terms.apply(mnemonic + "[" + std::to_string(j) + "]", args), 4);
+				put(rd, 4 * j, value);
+				put(j % 2 ? state.hi : state.lo, (j / 2) * 8, value);
+			}
+			for (int byte = 4; byte < 8; ++byte)
+			{
+				state.lo[byte] = terms.undefined(mnemonic + ".lo", byte);
+				state.lo[byte + 8] = terms.undefined(mnemonic + ".lo", byte + 8);
+				state.hi[byte] = terms.undefined(mnemonic + ".hi", byte);
+				state.hi[byte + 8] = terms.undefined(mnemonic + ".hi", byte + 8);
+			}
+			write(state, operands[0], rd);
+			return true;
+		}
+
+		if (mnemonic == "pmultw" || mnemonic == "pmultuw" || mnemonic == "pmaddw" || mnemonic == "pmadduw" ||
+			mnemonic == "pmsubw")
+		{
+			if (!expect(3))
+			{
+				return false;
+			}
+			reg128 rs = reg(1);
+			reg128 rt = reg(2);
+			reg128 rd;
+			for (int i = 0; i < 2; ++i)
+			{
+				std::vector<term> args = concat(slice(rs, 8 * i, 4), slice(rt, 8 * i, 4));
+				if (mnemonic != "pmultw" && mnemonic != "pmultuw")
+				{
+					args = concat(concat(args, slice(state.lo, 8 * i, 4)), slice(state.hi, 8 * i, 4));
+				}
+				term product = terms.apply(mnemonic + "[" + std::to_string(i) + "]", args);
+				put(rd, 8 * i, bytes_of(product, 8));
+				put(state.lo, 8 * i, bytes_of(terms.apply("lo", { product }), 8));
+				put(state.hi, 8 * i, bytes_of(terms.apply("hi", { product }), 8));
+			}
+			write(state, operands[0], rd);
+			return true;
+		}
+
+		if (mnemonic == "pdivw" || mnemonic == "pdivuw" || mnemonic == "pdivbw")
+		{
+			if (!expect(2))
+			{
+				return false;
+			}
+			reg128 rs = reg(0);
+			reg128 rt = reg(1);
+			if (mnemonic == "pdivbw")
+			{
+				for (int j = 0; j < 4; ++j)
+				{
+					std::vector<term> args = concat(slice(rs, 4 * j, 4), slice(rt, 0, 2));
+					put(state.lo, 4 * j, bytes_of(terms.apply("pdivbw.q[" + std::to_string(j) + "]", args), 4));
+					put(state.hi, 4 * j, bytes_of(terms.apply("pdivbw.r[" + std::to_string(j) + "]", args), 4));
+				}
+			}
+			else
+			{
+				for (int i = 0; i < 2; ++i)
+				{
+					std::vector<term> args = concat(slice(rs, 8 * i, 4), slice(rt, 8 * i, 4));
+					put(state.lo, 8 * i, bytes_of(terms.apply(mnemonic + ".q[" + std::to_string(i) + "]", args), 8));
+					put(state.hi, 8 * i, bytes_of(terms.apply(mnemonic + ".r[" + std::to_string(i) + "]", args), 8));
+				}
+			}
+			return true;
+		}
+
+		// SA transfers
+
+		if (mnemonic == "mfsa")
+		{
+			if (!expect(1))
+			{
+				return false;
+			}
+			reg128 rd = {};
+			for (int i = 0; i < 8; ++i)
+			{
+				rd[i] = state.sa[i];
+			}
+			write64(state, operands[0], rd);
+			return true;
+		}
+
+		if (mnemonic == "mtsa")
+		{
+			if (!expect(1))
+			{
+				return false;
+			}
+			reg128 rs = reg(0);
+			for (int i = 0; i < 8; ++i)
+			{
+				state.sa[i] = rs[i];
+			}
+			return true;
+		}
+
+		if (mnemonic == "mtsab" || mnemonic == "mtsah")
+		{
+			if (operands.size() != 2 || operands[0].kind != machine_operand::reg ||
+				operands[1].kind != machine_operand::immediate)
+			{
+				error = "'" + mnemonic + "' expects a register and an immediate";
+				return false;
+			}
+			std::vector<term> bytes = bytes_of(terms.apply(mnemonic + "<" + operands[1].text + ">", slice(reg(0), 0, 8)), 8);
+			for (int i = 0; i < 8; ++i)
+			{
+				state.sa[i] = bytes[i];
+			}
+			return true;
+		}
+
+		error = "unsupported instruction '" + mnemonic + "'";
+		return false;
+	}
+}
@@ -0,0 +1,123 @@
+#pragma once
+
+/*
+*	Symbolic model of the parts of the EE Core (R5900) touched by the ps2intrin headers.
+*
+*	Every byte of every register holds a 'term'. Terms are hash-consed, so two bytes computed
+*	the same way from the same inputs compare equal as integers. Instructions whose exact
+*	semantics matter for state handling (moves, copies, permutations, LO/HI/SA transfers) are
+*	modelled exactly. Arithmetic is modelled as an uninterpreted function of its source bytes,
+*	which is sufficient to prove where a value ends up without caring what it is.
+*/
+
+#include <array>
+#include <map>
+#include <string>
+#include <vector>
+
+namespace asmcheck
+{
+	/// @brief Index into a 'term_table'.
+	typedef int term;
+
+	typedef std::array<term, 16> reg128;
+	typedef std::array<term, 8> reg64;
+
+	/// @brief Value has not been initialized (e.g. an output operand read before it is written).
+	constexpr unsigned flag_junk = 1;
+	/// @brief Value originates from the hardware state of the surrounding code.
+	constexpr unsigned flag_caller = 2;
+
+	/// @brief Hash-consed storage for symbolic byte values.
+	class term_table
+	{
+	public:
+		term_table();
+
+		/// @brief The constant zero byte.
+		term zero() const { return 0; }
+		/// @brief Byte 'byte' of a named input value.
+		term variable(const std::string& name, int byte);
+		/// @brief Byte 'byte' of an uninitialized value.
+		term junk(const std::string& name, int byte);
+		/// @brief Byte 'byte' of a register value belonging to the surrounding code.
+		term caller(const std::string& name, int byte);
+		/// @brief Byte 'byte' of a value the architecture leaves undefined.
+		term undefined(const std::string& name, int byte);
+		/// @brief Uninterpreted function 'op' applied to 'args'. Flags propagate from the arguments.
+		term apply(const std::string& op, const std::vector<term>& args);
+
+		unsigned flags(term t) const { return nodes[t].flags; }
+		/// @brief Human readable form, truncated below 'depth' levels of nesting.
+		std::string to_string(term t, int depth = 2) const;
+
+	private:
+		struct node
+		{
+			std::string op;
+			std::vector<term> args;
+			unsigned flags;
+		};
+
+		term intern(const std::string& op, const std::vector<term>& args, unsigned flags);
+
+		std::vector<node> nodes;
+		std::map<std::pair<std::string, std::vector<term>>, term> index;
+	};
+
+	/// @brief Architectural state visible to an asm statement.
+	struct machine_state
+	{
+		/// One entry per register slot. Operands sharing a slot share a physical register.
+		std::vector<reg128> registers;
+		reg128 lo;
+		reg128 hi;
+		reg64 sa;
+		/// 16-byte memory operands, keyed by their C expression.
+		std::map<std::string, reg128> memory;
+	};
+
+	/// @brief An instruction operand after substitution of the asm operands.
+	struct machine_operand
+	{
+		enum kind_t { reg, immediate, memory };
+
+		kind_t kind = reg;
+		/// Register slot, -1 for '$0'.
+		int slot = -1;
+		/// Text of an immediate.
+		std::string text;
+		/// Key of a memory operand.
+		std::string address;
+	};
+
+	/// @brief Executes R5900 instructions on a 'machine_state'.
+	class r5900
+	{
+	public:
+		explicit r5900(term_table& terms) : terms(terms) {}
+
+		/// @brief Apply one instruction.
+		/// @return false with 'error' set if the instruction or its operands are not supported
+		bool execute(machine_state& state, const std::string& mnemonic, const std::vector<machine_operand>& operands,
+					 std::string& error);
+
+		/// @brief true if 'mnemonic' reads or writes the SA register.
+		static bool uses_sa(const std::string& mnemonic);
+
+	private:
+		reg128 read(const machine_state& state, const machine_operand& operand) const;
+		void write(machine_state& state, const machine_operand& operand, const reg128& value) const;
+		void write64(machine_state& state, const machine_operand& operand, const reg128& value) const;
+
+		/// @brief Apply 'op' independently to each 'width'-byte lane of the sources.
+		reg128 lanewise(const std::string& op, int width, const std::vector<reg128>& sources);
+		/// @brief Split 'value' into 'count' bytes.
+		std::vector<term> bytes_of(term value, int count);
+
+		term_table& terms;
+	};
+
+	/// @brief Copy 'count' bytes starting at 'offset' of 'source' into a vector.
+	std::vector<term> slice(const reg128& source, int offset, int count);
+}
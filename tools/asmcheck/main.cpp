@@ -0,0 +1,163 @@
+/*
+*	ps2intrin-asmcheck: symbolically executes the asm statements of the ps2intrin headers and
+*	checks their handling of the LO/HI/SA registers. See 'check.h' for the list of checks.
+*
+*	Usage: ps2intrin-asmcheck [options] <header>
+*		-I <dir>		Add an include directory
+*		--mode=<mode>	'safe', 'unsafe' or 'both' (default)
+*		--verbose		Print which of LO0/LO1/HI0/HI1/SA every unit reads and updates
+*		--werror		Treat warnings as errors
+*
+*	Exits with status 1 if any error was found.
+*/
+
+#include "check.h"
+#include "source.h"
+
+#include <cstdio>
+#include <cstring>
+#include <string>
+#include <vector>
+
+namespace
+{
+	void usage()
+	{
+		std::fprintf(stderr, "usage: ps2intrin-asmcheck [-I <dir>] [--mode=safe|unsafe|both] [--verbose] [--werror] <header>\n");
+	}
+
+	const char* severity_name(asmcheck::diagnostic::severity_t severity)
+	{
+		switch (severity)
+		{
+		case asmcheck::diagnostic::note: return "note";
+		case asmcheck::diagnostic::warning: return "warning";
+		default: return "error";
+		}
+	}
+}
+
+int main(int argc, char** argv)
+{
+	std::vector<std::string> include_dirs;
+	std::string header;
+	bool check_safe = true;
+	bool check_unsafe = true;
+	bool verbose = false;
+	bool werror = false;
+
+	for (int i = 1; i < argc; ++i)
+	{
+		std::string arg = argv[i];
+		if (arg == "-I" && i + 1 < argc)
+		{
+			include_dirs.push_back(argv[++i]);
+		}
+		else if (arg.compare(0, 2, "-I") == 0 && arg.size() > 2)
+		{
+			include_dirs.push_back(arg.substr(2));
+		}
+		else if (arg == "--mode=safe" || arg == "--mode=unsafe" || arg == "--mode=both")
+		{
+			check_safe = arg != "--mode=unsafe";
+			check_unsafe = arg != "--mode=safe";
+		}
+		else if (arg == "--verbose")
+		{
+			verbose = true;
+		}
+		else if (arg == "--werror")
+		{
+			werror = true;
+		}
+		else if (arg[0] != '-' && header.empty())
+		{
+			header = arg;
+		}
+		else
+		{
+			usage();
+			return 2;
+		}
+	}
+
+	if (header.empty())
+	{
+		usage();
+		return 2;
+	}
+
+	std::vector<asmcheck::diagnostic> diagnostics;
+	std::vector<asmcheck::state_report> reports;
+	std::vector<asmcheck::asm_unit> units[2];
+	const char* const modes[2] = { "safe", "unsafe" };
+	const bool enabled[2] = { check_safe, check_unsafe };
+	size_t statement_count = 0;
+
+	for (int m = 0; m < 2; ++m)
+	{
+		if (!enabled[m])
+		{
+			continue;
+		}
+
+		// Pretend to be gcc compiling C++ for the EE, so that the templates are visible as well.
+		std::set<std::string> defines = { "__GNUC__=12", "__cplusplus=201703L", "_EE" };
+		if (m == 1)
+		{
+			defines.insert("PS2INTRIN_UNSAFE");
+			defines.insert("PS2INTRIN_SILENCE_UNSAFE");
+		}
+
+		std::string error;
+		if (!asmcheck::extract_units(header, defines, include_dirs, units[m], error))
+		{
+			std::fprintf(stderr, "ps2intrin-asmcheck: %s\n", error.c_str());
+			return 2;
+		}
+		for (const asmcheck::asm_unit& unit : units[m])
+		{
+			statement_count += unit.statements.size();
+		}
+		asmcheck::check_units(units[m], modes[m], diagnostics, reports);
+	}
+
+	if (check_safe && check_unsafe)
+	{
+		asmcheck::check_equivalence(units[0], units[1], diagnostics);
+	}
+
+	size_t errors = 0;
+	size_t warnings = 0;
+	for (const asmcheck::diagnostic& d : diagnostics)
+	{
+		asmcheck::diagnostic::severity_t severity = d.severity;
+		if (werror && severity == asmcheck::diagnostic::warning)
+		{
+			severity = asmcheck::diagnostic::error;
+		}
+		errors += severity == asmcheck::diagnostic::error;
+		warnings += severity == asmcheck::diagnostic::warning;
+
+		std::printf("%s:%d: %s: %s [%s]: %s\n", d.file.c_str(), d.line, severity_name(severity), d.unit.c_str(),
+					d.mode.c_str(), d.message.c_str());
+	}
+
+	if (verbose)
+	{
+		for (const asmcheck::state_report& report : reports)
+		{
+			std::printf("%s:%d: %s [%s]:", report.file.c_str(), report.line, report.unit.c_str(), report.mode.c_str());
+			for (size_t f = 0; f < report.fields.size(); ++f)
+			{
+				std::printf(" %s %s%s", asmcheck::state_field_names[f], report.fields[f].c_str(),
+							f + 1 < report.fields.size() ? ";" : "");
+			}
+			std::printf("\n");
+		}
+	}
+
+	std::printf("%zu units, %zu asm statements checked: %zu error(s), %zu warning(s)\n", units[0].size() + units[1].size(),
+				statement_count, errors, warnings);
+	return errors ? 1 : 0;
+}
@@ -0,0 +1,1042 @@
+#include "source.h"
+
+#include <cctype>
+#include <cstdlib>
+#include <fstream>
+#include <map>
+
+namespace asmcheck
+{
+	namespace
+	{
+		/// @brief A line of active source after conditional compilation. Directives spanning
+		/// multiple physical lines keep one line number per segment.
+		struct logical_line
+		{
+			std::string file;
+			std::vector<int> lines;
+			std::string text;
+			bool is_define = false;
+		};
+
+		struct preprocessor
+		{
+			std::map<std::string, std::string> macros;
+			std::vector<std::string> include_dirs;
+			std::set<std::string> once;
+			std::vector<logical_line> output;
+			std::string error;
+		};
+
+		/// @brief State of one '#if' nesting level.
+		struct conditional
+		{
+			bool parent_active;
+			bool active;
+			bool taken;
+		};
+
+		bool is_identifier_char(char c)
+		{
+			return std::isalnum(static_cast<unsigned char>(c)) || c == '_';
+		}
+
+		std::string trim(const std::string& s)
+		{
+			size_t begin = s.find_first_not_of(" \t\r\n");
+			if (begin == std::string::npos)
+			{
+				return std::string();
+			}
+			size_t end = s.find_last_not_of(" \t\r\n");
+			return s.substr(begin, end - begin + 1);
+		}
+
+		bool read_file(const std::string& path, std::vector<std::string>& lines)
+		{
+			std::ifstream in(path);
+			if (!in)
+			{
+				return false;
+			}
+
+			std::string line;
+			while (std::getline(in, line))
+			{
+				if (!line.empty() && line.back() == '\r')
+				{
+					line.pop_back();
+				}
+				lines.push_back(line);
+			}
+			return true;
+		}
+
+		std::string directory_of(const std::string& path)
+		{
+			size_t slash = path.find_last_of("/\\");
+			return slash == std::string::npos ? std::string(".") : path.substr(0, slash);
+		}
+
+		bool file_exists(const std::string& path)
+		{
+			std::ifstream in(path);
+			return static_cast<bool>(in);
+		}
+
+		/// @brief Replace comments with whitespace, keeping newlines, string and character
+		/// literals intact.
+		std::string strip_comments(const std::string& s)
+		{
+			std::string result = s;
+			size_t i = 0;
+			while (i < result.size())
+			{
+				char c = result[i];
+				if (c == '"' || c == '\'')
+				{
+					char quote = c;
+					++i;
+					while (i < result.size() && result[i] != quote)
+					{
+						i += result[i] == '\\' ? 2 : 1;
+					}
+					++i;
+				}
+				else if (c == '/' && i + 1 < result.size() && result[i + 1] == '/')
+				{
+					while (i < result.size() && result[i] != '\n')
+					{
+						result[i++] = ' ';
+					}
+				}
+				else if (c == '/' && i + 1 < result.size() && result[i + 1] == '*')
+				{
+					result[i++] = ' ';
+					result[i++] = ' ';
+					while (i < result.size() && !(result[i] == '*' && i + 1 < result.size() && result[i + 1] == '/'))
+					{
+						if (result[i] != '\n')
+						{
+							result[i] = ' ';
+						}
+						++i;
+					}
+					if (i < result.size())
+					{
+						result[i++] = ' ';
+						result[i++] = ' ';
+					}
+				}
+				else
+				{
+					++i;
+				}
+			}
+			return result;
+		}
+
+		// '#if' expression evaluation
+
+		struct expression_parser
+		{
+			const std::map<std::string, std::string>& macros;
+			std::vector<std::string> tokens;
+			size_t position = 0;
+			bool failed = false;
+
+			const std::string& peek() const
+			{
+				static const std::string end;
+				return position < tokens.size() ? tokens[position] : end;
+			}
+
+			std::string next()
+			{
+				return position < tokens.size() ? tokens[position++] : std::string();
+			}
+
+			long long value_of(const std::string& token)
+			{
+				if (token.empty())
+				{
+					failed = true;
+					return 0;
+				}
+				if (std::isdigit(static_cast<unsigned char>(token[0])))
+				{
+					return std::strtoll(token.c_str(), nullptr, 0);
+				}
+
+				// Identifiers that are not macros evaluate to 0, like in the real preprocessor.
+				auto it = macros.find(token);
+				if (it == macros.end() || it->second.empty())
+				{
+					return 0;
+				}
+				const std::string& value = it->second;
+				return std::isdigit(static_cast<unsigned char>(value[0])) ? std::strtoll(value.c_str(), nullptr, 0) : 0;
+			}
+
+			long long primary()
+			{
+				std::string token = next();
+				if (token == "(")
+				{
+					long long value = logical_or();
+					if (next() != ")")
+					{
+						failed = true;
+					}
+					return value;
+				}
+				if (token == "!")
+				{
+					return !primary();
+				}
+				if (token == "-")
+				{
+					return -primary();
+				}
+				if (token == "defined")
+				{
+					bool parenthesized = peek() == "(";
+					if (parenthesized)
+					{
+						next();
+					}
+					std::string name = next();
+					if (parenthesized && next() != ")")
+					{
+						failed = true;
+					}
+					return macros.count(name) != 0;
+				}
+				if (token == "__has_attribute")
+				{
+					// Only used to pick optimization attributes, which do not affect the asm statements.
+					if (next() != "(" || next().empty() || next() != ")")
+					{
+						failed = true;
+					}
+					return 0;
+				}
+				return value_of(token);
+			}
+
+			long long relational()
+			{
+				long long value = primary();
+				for (;;)
+				{
+					const std::string& op = peek();
+					if (op == "<" || op == ">" || op == "<=" || op == ">=")
+					{
+						std::string o = next();
+						long long rhs = primary();
+						value = o == "<" ? value < rhs : o == ">" ? value > rhs : o == "<=" ? value <= rhs : value >= rhs;
+					}
+					else
+					{
+						return value;
+					}
+				}
+			}
+
+			long long equality()
+			{
+				long long value = relational();
+				while (peek() == "==" || peek() == "!=")
+				{
+					bool equal = next() == "==";
+					long long rhs = relational();
+					value = equal ? value == rhs : value != rhs;
+				}
+				return value;
+			}
+
+			long long logical_and()
+			{
+				long long value = equality();
+				while (peek() == "&&")
+				{
+					next();
+					long long rhs = equality();
+					value = value && rhs;
+				}
+				return value;
+			}
+
+			long long logical_or()
+			{
+				long long value = logical_and();
+				while (peek() == "||")
+				{
+					next();
+					long long rhs = logical_and();
+					value = value || rhs;
+				}
+				return value;
+			}
+		};
+
+		std::vector<std::string> tokenize_expression(const std::string& s)
+		{
+			std::vector<std::string> tokens;
+			size_t i = 0;
+			while (i < s.size())
+			{
+				char c = s[i];
+				if (std::isspace(static_cast<unsigned char>(c)))
+				{
+					++i;
+				}
+				else if (is_identifier_char(c))
+				{
+					size_t begin = i;
+					while (i < s.size() && is_identifier_char(s[i]))
+					{
+						++i;
+					}
+					tokens.push_back(s.substr(begin, i - begin));
+				}
+				else if (i + 1 < s.size() && (s.compare(i, 2, "&&") == 0 || s.compare(i, 2, "||") == 0 ||
+											  s.compare(i, 2, "==") == 0 || s.compare(i, 2, "!=") == 0 ||
+											  s.compare(i, 2, "<=") == 0 || s.compare(i, 2, ">=") == 0))
+				{
+					tokens.push_back(s.substr(i, 2));
+					i += 2;
+				}
+				else
+				{
+					tokens.push_back(std::string(1, c));
+					++i;
+				}
+			}
+			return tokens;
+		}
+
+		bool evaluate(const std::string& expression, const std::map<std::string, std::string>& macros, bool& result)
+		{
+			expression_parser parser{ macros, tokenize_expression(strip_comments(expression)) };
+			long long value = parser.logical_or();
+			result = value != 0;
+			return !parser.failed && parser.position == parser.tokens.size();
+		}
+
+		// Conditional compilation and includes
+
+		bool preprocess(preprocessor& pp, const std::string& path);
+
+		bool resolve_include(preprocessor& pp, const std::string& current, const std::string& spec, std::string& resolved)
+		{
+			std::string name = trim(spec);
+			if (name.size() < 2 || (name[0] != '"' && name[0] != '<'))
+			{
+				return false;
+			}
+			name = name.substr(1, name.find_first_of("\">", 1) - 1);
+
+			std::vector<std::string> candidates;
+			if (spec[0] == '"')
+			{
+				candidates.push_back(directory_of(current) + "/" + name);
+			}
+			for (const std::string& dir : pp.include_dirs)
+			{
+				candidates.push_back(dir + "/" + name);
+			}
+
+			for (const std::string& candidate : candidates)
+			{
+				if (file_exists(candidate))
+				{
+					resolved = candidate;
+					return true;
+				}
+			}
+			return false;
+		}
+
+		bool preprocess(preprocessor& pp, const std::string& path)
+		{
+			if (pp.once.count(path))
+			{
+				return true;
+			}
+
+			std::vector<std::string> lines;
+			if (!read_file(path, lines))
+			{
+				pp.error = "cannot read '" + path + "'";
+				return false;
+			}
+
+			std::vector<conditional> stack;
+			bool in_block_comment = false;
+
+			for (size_t i = 0; i < lines.size(); ++i)
+			{
+				int first_line = static_cast<int>(i) + 1;
+				bool active = stack.empty() || stack.back().active;
+
+				std::string stripped = trim(lines[i]);
+				if (in_block_comment || stripped.empty() || stripped[0] != '#')
+				{
+					// Track block comments so that '#' inside them is not taken as a directive.
+					size_t open = lines[i].rfind("/*");
+					size_t close = lines[i].rfind("*/");
+					if (open != std::string::npos && (close == std::string::npos || close < open))
+					{
+						in_block_comment = true;
+					}
+					else if (close != std::string::npos && in_block_comment)
+					{
+						in_block_comment = false;
+					}
+
+					if (active)
+					{
+						pp.output.push_back({ path, { first_line }, lines[i], false });
+					}
+					continue;
+				}
+
+				// Join continuation lines of the directive.
+				std::string directive = lines[i];
+				std::vector<int> line_numbers = { first_line };
+				while (!directive.empty() && directive.back() == '\\' && i + 1 < lines.size())
+				{
+					directive.back() = '\n';
+					directive += lines[++i];
+					line_numbers.push_back(static_cast<int>(i) + 1);
+				}
+
+				std::string body = trim(trim(directive).substr(1));
+				size_t name_end = 0;
+				while (name_end < body.size() && is_identifier_char(body[name_end]))
+				{
+					++name_end;
+				}
+				std::string name = body.substr(0, name_end);
+				std::string argument = trim(body.substr(name_end));
+
+				if (name == "if" || name == "ifdef" || name == "ifndef")
+				{
+					bool value = false;
+					if (name == "if")
+					{
+						if (active && !evaluate(argument, pp.macros, value))
+						{
+							pp.error = path + ":" + std::to_string(first_line) + ": cannot evaluate '#if " + argument + "'";
+							return false;
+						}
+					}
+					else
+					{
+						std::string macro = trim(strip_comments(argument));
+						value = pp.macros.count(macro) != 0;
+						if (name == "ifndef")
+						{
+							value = !value;
+						}
+					}
+					stack.push_back({ active, active && value, active && value });
+				}
+				else if (name == "elif")
+				{
+					if (stack.empty())
+					{
+						pp.error = path + ":" + std::to_string(first_line) + ": '#elif' without '#if'";
+						return false;
+					}
+					conditional& top = stack.back();
+					bool value = false;
+					if (top.parent_active && !top.taken && !evaluate(argument, pp.macros, value))
+					{
+						pp.error = path + ":" + std::to_string(first_line) + ": cannot evaluate '#elif " + argument + "'";
+						return false;
+					}
+					top.active = top.parent_active && !top.taken && value;
+					top.taken = top.taken || top.active;
+				}
+				else if (name == "else")
+				{
+					if (stack.empty())
+					{
+						pp.error = path + ":" + std::to_string(first_line) + ": '#else' without '#if'";
+						return false;
+					}
+					conditional& top = stack.back();
+					top.active = top.parent_active && !top.taken;
+					top.taken = true;
+				}
+				else if (name == "endif")
+				{
+					if (stack.empty())
+					{
+						pp.error = path + ":" + std::to_string(first_line) + ": '#endif' without '#if'";
+						return false;
+					}
+					stack.pop_back();
+				}
+				else if (!active)
+				{
+					continue;
+				}
+				else if (name == "define")
+				{
+					size_t macro_end = 0;
+					while (macro_end < argument.size() && is_identifier_char(argument[macro_end]))
+					{
+						++macro_end;
+					}
+					std::string macro = argument.substr(0, macro_end);
+					std::string value = macro_end < argument.size() && argument[macro_end] == '(' ? std::string() :
+										trim(strip_comments(argument.substr(macro_end)));
+					pp.macros[macro] = value;
+					pp.output.push_back({ path, line_numbers, directive, true });
+				}
+				else if (name == "undef")
+				{
+					pp.macros.erase(trim(strip_comments(argument)));
+				}
+				else if (name == "include")
+				{
+					std::string resolved;
+					if (resolve_include(pp, path, argument, resolved) && !preprocess(pp, resolved))
+					{
+						return false;
+					}
+				}
+				else if (name == "pragma" && trim(strip_comments(argument)) == "once")
+				{
+					pp.once.insert(path);
+				}
+				else if (name == "error")
+				{
+					pp.error = path + ":" + std::to_string(first_line) + ": #error " + argument;
+					return false;
+				}
+			}
+
+			if (!stack.empty())
+			{
+				pp.error = path + ": unterminated '#if'";
+				return false;
+			}
+			return true;
+		}
+
+		// asm statement parsing
+
+		/// @brief Source text assembled from logical lines, remembering the line of each
+		/// newline-separated segment.
+		struct chunk
+		{
+			std::string file;
+			std::string text;
+			std::vector<int> lines;
+
+			int line_at(size_t offset) const
+			{
+				size_t segment = 0;
+				for (size_t i = 0; i < offset && i < text.size(); ++i)
+				{
+					if (text[i] == '\n')
+					{
+						++segment;
+					}
+				}
+				return lines.empty() ? 0 : lines[segment < lines.size() ? segment : lines.size() - 1];
+			}
+		};
+
+		size_t skip_literal(const std::string& s, size_t i)
+		{
+			char quote = s[i++];
+			while (i < s.size() && s[i] != quote)
+			{
+				i += s[i] == '\\' ? 2 : 1;
+			}
+			return i + 1;
+		}
+
+		/// @brief Find the bracket closing the one at 'open'. Returns npos if unbalanced.
+		size_t find_closing(const std::string& s, size_t open)
+		{
+			int depth = 0;
+			for (size_t i = open; i < s.size();)
+			{
+				char c = s[i];
+				if (c == '"' || c == '\'')
+				{
+					i = skip_literal(s, i);
+					continue;
+				}
+				if (c == '(' || c == '[' || c == '{')
+				{
+					++depth;
+				}
+				else if (c == ')' || c == ']' || c == '}')
+				{
+					if (--depth == 0)
+					{
+						return i;
+					}
+				}
+				++i;
+			}
+			return std::string::npos;
+		}
+
+		/// @brief Split at top-level occurrences of 'separator', outside brackets and literals.
+		std::vector<std::string> split_top_level(const std::string& s, char separator)
+		{
+			std::vector<std::string> parts;
+			int depth = 0;
+			size_t begin = 0;
+			for (size_t i = 0; i < s.size();)
+			{
+				char c = s[i];
+				if (c == '"' || c == '\'')
+				{
+					i = skip_literal(s, i);
+					continue;
+				}
+				if (c == '(' || c == '[' || c == '{')
+				{
+					++depth;
+				}
+				else if (c == ')' || c == ']' || c == '}')
+				{
+					--depth;
+				}
+				else if (c == separator && depth == 0)
+				{
+					parts.push_back(s.substr(begin, i - begin));
+					begin = i + 1;
+				}
+				++i;
+			}
+			parts.push_back(s.substr(begin));
+			return parts;
+		}
+
+		/// @brief Concatenate and unescape all string literals in 's'.
+		std::string string_literals(const std::string& s)
+		{
+			std::string result;
+			for (size_t i = 0; i < s.size(); ++i)
+			{
+				if (s[i] != '"')
+				{
+					continue;
+				}
+				for (++i; i < s.size() && s[i] != '"'; ++i)
+				{
+					if (s[i] == '\\' && i + 1 < s.size())
+					{
+						char e = s[++i];
+						result += e == 'n' ? '\n' : e == 't' ? '\t' : e;
+					}
+					else
+					{
+						result += s[i];
+					}
+				}
+			}
+			return result;
+		}
+
+		std::string normalize_expression(const std::string& s)
+		{
+			std::string collapsed;
+			for (char c : trim(s))
+			{
+				if (std::isspace(static_cast<unsigned char>(c)))
+				{
+					if (!collapsed.empty() && collapsed.back() != ' ')
+					{
+						collapsed += ' ';
+					}
+				}
+				else
+				{
+					collapsed += c;
+				}
+			}
+
+			std::string spaced;
+			for (size_t i = 0; i < collapsed.size(); ++i)
+			{
+				if (collapsed[i] == ' ' && (i == 0 || i + 1 == collapsed.size() ||
+											!is_identifier_char(collapsed[i - 1]) || !is_identifier_char(collapsed[i + 1])))
+				{
+					continue;
+				}
+				spaced += collapsed[i];
+			}
+
+			// '(result).v' and '(state)->sa' come from macro parameters; drop the parentheses.
+			std::string result;
+			for (size_t i = 0; i < spaced.size(); ++i)
+			{
+				if (spaced[i] == '(' && (i == 0 || !is_identifier_char(spaced[i - 1])))
+				{
+					size_t j = i + 1;
+					while (j < spaced.size() && is_identifier_char(spaced[j]))
+					{
+						++j;
+					}
+					if (j > i + 1 && j < spaced.size() && spaced[j] == ')' && j + 1 < spaced.size() &&
+						(spaced[j + 1] == '.' || spaced.compare(j + 1, 2, "->") == 0))
+					{
+						result += spaced.substr(i + 1, j - i - 1);
+						i = j;
+						continue;
+					}
+				}
+				result += spaced[i];
+			}
+			return result;
+		}
+
+		bool parse_operands(const std::string& s, std::vector<asm_operand>& operands)
+		{
+			if (trim(s).empty())
+			{
+				return true;
+			}
+
+			for (const std::string& part : split_top_level(s, ','))
+			{
+				std::string text = trim(part);
+				asm_operand operand;
+				size_t i = 0;
+				if (!text.empty() && text[0] == '[')
+				{
+					size_t close = text.find(']');
+					if (close == std::string::npos)
+					{
+						return false;
+					}
+					operand.name = trim(text.substr(1, close - 1));
+					i = close + 1;
+				}
+
+				size_t quote = text.find('"', i);
+				if (quote == std::string::npos)
+				{
+					return false;
+				}
+				size_t quote_end = skip_literal(text, quote);
+				operand.constraint = string_literals(text.substr(quote, quote_end - quote));
+
+				size_t open = text.find('(', quote_end);
+				size_t close = open == std::string::npos ? open : find_closing(text, open);
+				if (close == std::string::npos)
+				{
+					return false;
+				}
+				operand.expression = normalize_expression(text.substr(open + 1, close - open - 1));
+				operands.push_back(operand);
+			}
+			return true;
+		}
+
+		bool parse_statements(const chunk& body, std::vector<asm_statement>& statements, std::string& error)
+		{
+			const std::string& s = body.text;
+			for (size_t i = 0; i < s.size();)
+			{
+				char c = s[i];
+				if (c == '"' || c == '\'')
+				{
+					i = skip_literal(s, i);
+					continue;
+				}
+				if (!is_identifier_char(c) || (i > 0 && is_identifier_char(s[i - 1])))
+				{
+					++i;
+					continue;
+				}
+
+				size_t end = i;
+				while (end < s.size() && is_identifier_char(s[end]))
+				{
+					++end;
+				}
+				std::string word = s.substr(i, end - i);
+				if (word != "asm" && word != "__asm__")
+				{
+					i = end;
+					continue;
+				}
+
+				asm_statement statement;
+				statement.file = body.file;
+				statement.line = body.line_at(i);
+
+				size_t j = end;
+				for (;;)
+				{
+					while (j < s.size() && std::isspace(static_cast<unsigned char>(s[j])))
+					{
+						++j;
+					}
+					size_t k = j;
+					while (k < s.size() && is_identifier_char(s[k]))
+					{
+						++k;
+					}
+					std::string qualifier = s.substr(j, k - j);
+					if (qualifier == "volatile" || qualifier == "__volatile__")
+					{
+						statement.is_volatile = true;
+						j = k;
+					}
+					else if (qualifier == "inline" || qualifier == "__inline__")
+					{
+						j = k;
+					}
+					else
+					{
+						break;
+					}
+				}
+
+				if (j >= s.size() || s[j] != '(')
+				{
+					i = end;
+					continue;
+				}
+				size_t close = find_closing(s, j);
+				if (close == std::string::npos)
+				{
+					error = body.file + ":" + std::to_string(statement.line) + ": unbalanced asm statement";
+					return false;
+				}
+
+				std::vector<std::string> sections = split_top_level(s.substr(j + 1, close - j - 1), ':');
+				std::string instructions = string_literals(sections[0]);
+				std::string current;
+				for (char ch : instructions + "\n")
+				{
+					if (ch == '\n' || ch == ';')
+					{
+						std::string instruction = trim(current);
+						if (!instruction.empty())
+						{
+							statement.instructions.push_back(instruction);
+						}
+						current.clear();
+					}
+					else
+					{
+						current += ch == '\t' ? ' ' : ch;
+					}
+				}
+
+				if ((sections.size() > 1 && !parse_operands(sections[1], statement.outputs)) ||
+					(sections.size() > 2 && !parse_operands(sections[2], statement.inputs)))
+				{
+					error = body.file + ":" + std::to_string(statement.line) + ": cannot parse asm operands";
+					return false;
+				}
+				if (sections.size() > 3)
+				{
+					for (const std::string& clobber : split_top_level(sections[3], ','))
+					{
+						std::string name = string_literals(clobber);
+						if (!name.empty())
+						{
+							statement.clobbers.push_back(name);
+						}
+					}
+				}
+
+				statements.push_back(statement);
+				i = close + 1;
+			}
+			return true;
+		}
+
+		bool contains_word(const std::string& s, const std::string& word)
+		{
+			for (size_t i = s.find(word); i != std::string::npos; i = s.find(word, i + 1))
+			{
+				bool begins = i == 0 || !is_identifier_char(s[i - 1]);
+				bool ends = i + word.size() >= s.size() || !is_identifier_char(s[i + word.size()]);
+				if (begins && ends)
+				{
+					return true;
+				}
+			}
+			return false;
+		}
+
+		std::string doc_text(const std::string& line)
+		{
+			std::string text = trim(line).substr(3);
+			if (!text.empty() && text[0] == ' ')
+			{
+				text.erase(0, 1);
+			}
+			return text;
+		}
+	}
+
+	bool extract_units(const std::string& path, const std::set<std::string>& defines,
+					   const std::vector<std::string>& include_dirs, std::vector<asm_unit>& units,
+					   std::string& error)
+	{
+		preprocessor pp;
+		for (const std::string& define : defines)
+		{
+			size_t equals = define.find('=');
+			if (equals == std::string::npos)
+			{
+				pp.macros[define] = "1";
+			}
+			else
+			{
+				pp.macros[define.substr(0, equals)] = define.substr(equals + 1);
+			}
+		}
+		pp.include_dirs = include_dirs;
+
+		if (!preprocess(pp, path))
+		{
+			error = pp.error;
+			return false;
+		}
+
+		const std::vector<logical_line>& lines = pp.output;
+		std::string documentation;
+
+		for (size_t i = 0; i < lines.size(); ++i)
+		{
+			const logical_line& line = lines[i];
+			std::string text = trim(line.text);
+
+			if (line.is_define)
+			{
+				// '#define NAME(' introduces a function-like macro.
+				std::string body = trim(text.substr(1));
+				body = trim(body.substr(6));
+				size_t name_end = 0;
+				while (name_end < body.size() && is_identifier_char(body[name_end]))
+				{
+					++name_end;
+				}
+				if (name_end < body.size() && body[name_end] == '(')
+				{
+					chunk code{ line.file, strip_comments(line.text), line.lines };
+					if (contains_word(code.text, "asm"))
+					{
+						asm_unit unit;
+						unit.name = body.substr(0, name_end);
+						unit.is_macro = true;
+						unit.file = line.file;
+						unit.line = line.lines.front();
+						unit.documentation = documentation;
+						if (!parse_statements(code, unit.statements, error))
+						{
+							return false;
+						}
+						units.push_back(unit);
+					}
+				}
+				documentation.clear();
+				continue;
+			}
+
+			if (text.compare(0, 3, "///") == 0)
+			{
+				documentation += doc_text(text) + "\n";
+				continue;
+			}
+
+			std::string code_line = strip_comments(line.text);
+			if (!contains_word(code_line, "FORCEINLINE"))
+			{
+				if (!trim(code_line).empty() && trim(code_line).compare(0, 8, "template") != 0)
+				{
+					documentation.clear();
+				}
+				continue;
+			}
+
+			// Accumulate lines until the function body is complete.
+			chunk code{ line.file, std::string(), {} };
+			size_t open = std::string::npos;
+			size_t close = std::string::npos;
+			size_t j = i;
+			bool is_declaration = false;
+			for (; j < lines.size() && !lines[j].is_define; ++j)
+			{
+				if (!code.text.empty())
+				{
+					code.text += "\n";
+				}
+				code.text += strip_comments(lines[j].text);
+				code.lines.push_back(lines[j].lines.front());
+
+				if (open == std::string::npos)
+				{
+					size_t brace = code.text.find('{');
+					size_t semicolon = code.text.find(';');
+					if (semicolon != std::string::npos && (brace == std::string::npos || semicolon < brace))
+					{
+						is_declaration = true;
+						break;
+					}
+					open = brace;
+				}
+				if (open != std::string::npos)
+				{
+					close = find_closing(code.text, open);
+					if (close != std::string::npos)
+					{
+						break;
+					}
+				}
+			}
+
+			if (!is_declaration && close != std::string::npos)
+			{
+				size_t paren = code.text.find('(', code.text.find("FORCEINLINE"));
+				size_t name_end = paren;
+				while (name_end > 0 && std::isspace(static_cast<unsigned char>(code.text[name_end - 1])))
+				{
+					--name_end;
+				}
+				size_t name_begin = name_end;
+				while (name_begin > 0 && is_identifier_char(code.text[name_begin - 1]))
+				{
+					--name_begin;
+				}
+
+				asm_unit unit;
+				unit.name = code.text.substr(name_begin, name_end - name_begin);
+				unit.file = line.file;
+				unit.line = line.lines.front();
+				unit.documentation = documentation;
+
+				chunk body{ code.file, code.text.substr(0, close + 1), code.lines };
+				if (!parse_statements(body, unit.statements, error))
+				{
+					return false;
+				}
+				if (!unit.statements.empty())
+				{
+					units.push_back(unit);
+				}
+				i = j;
+			}
+			documentation.clear();
+		}
+		return true;
+	}
+}
@@ -0,0 +1,65 @@
+#pragma once
+
+/*
+*	Extraction of extended asm statements from the ps2intrin headers.
+*
+*	The headers are not run through a real preprocessor. Only conditional compilation is
+*	evaluated (against a caller-provided set of defined macros) and quoted or angled includes
+*	that resolve to files in the include directories are followed. Every function marked
+*	'FORCEINLINE' and every function-like macro containing an 'asm' statement is turned into an
+*	'asm_unit' together with its documentation comment.
+*/
+
+#include <set>
+#include <string>
+#include <vector>
+
+namespace asmcheck
+{
+	/// @brief A single operand of an extended asm statement.
+	struct asm_operand
+	{
+		/// Symbolic name used as '%[Name]' in the template. May be empty.
+		std::string name;
+		/// Constraint string including modifiers like '=', '+', '&' and '%'.
+		std::string constraint;
+		/// Bound C expression with whitespace and redundant parentheses removed.
+		std::string expression;
+	};
+
+	/// @brief An extended asm statement.
+	struct asm_statement
+	{
+		std::string file;
+		int line = 0;
+		bool is_volatile = false;
+		/// Template split into one entry per instruction, operands not yet substituted.
+		std::vector<std::string> instructions;
+		std::vector<asm_operand> outputs;
+		std::vector<asm_operand> inputs;
+		std::vector<std::string> clobbers;
+	};
+
+	/// @brief A function or function-like macro containing at least one asm statement.
+	struct asm_unit
+	{
+		std::string name;
+		bool is_macro = false;
+		std::string file;
+		int line = 0;
+		/// Concatenated '///' comment lines directly preceding the definition.
+		std::string documentation;
+		std::vector<asm_statement> statements;
+	};
+
+	/// @brief Collect all asm units reachable from 'path'.
+	/// @param path Header to start from
+	/// @param defines Macros considered defined when evaluating '#if' directives
+	/// @param include_dirs Directories searched for '#include' directives
+	/// @param units Receives the extracted units in order of appearance
+	/// @param error Receives a description of the first error encountered
+	/// @return false if a file could not be read or a directive could not be parsed
+	bool extract_units(const std::string& path, const std::set<std::string>& defines,
+					   const std::vector<std::string>& include_dirs, std::vector<asm_unit>& units,
+					   std::string& error);
+}
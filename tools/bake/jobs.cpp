@@ -0,0 +1,194 @@
+/*
+*	Bake operations, see 'jobs.h'.
+*/
+
+#include "jobs.h"
+
+#include "mapped_file.h"
+
+#include <ps2kernels/adpcm.h>
+#include <ps2kernels/texture.h>
+
+#include <algorithm>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <memory>
+
+namespace bake
+{
+	namespace
+	{
+		/// Input bytes per chunk. Large enough to amortize scheduling, small enough to balance cores.
+		constexpr size_t chunk_bytes = 256 * 1024;
+
+		struct files
+		{
+			mapped_file input;
+			mapped_file output;
+		};
+
+		void start_rgba5551(thread_pool& pool, const std::shared_ptr<files>& f)
+		{
+			size_t count = f->input.size() / 4;
+			const size_t chunk_pixels = chunk_bytes / 4;
+			for (size_t first = 0; first < count; first += chunk_pixels)
+			{
+				size_t n = std::min(chunk_pixels, count - first);
+				pool.submit([f, first, n] {
+					const uint32_t* src = reinterpret_cast<const uint32_t*>(f->input.data()) + first;
+					uint16_t* dst = reinterpret_cast<uint16_t*>(f->output.data()) + first;
+					texture_rgba32_to_5551(dst, src, n);
+				});
+			}
+		}
+
+		void start_swizzle8(thread_pool& pool, const std::shared_ptr<files>& f, size_t width)
+		{
+			size_t height = f->input.size() / width;
+			size_t chunk_rows = std::max<size_t>(16, chunk_bytes / width / 16 * 16);
+			for (size_t first = 0; first < height; first += chunk_rows)
+			{
+				size_t rows = std::min(chunk_rows, height - first);
+				pool.submit([f, first, rows, width] {
+					// Strips of 16 rows start at the same offset in the input and the output.
+					size_t offset = first * width;
+					texture_swizzle8(f->output.data() + offset, f->input.data() + offset, width, rows);
+				});
+			}
+		}
+
+		void start_adpcm(thread_pool& pool, const std::shared_ptr<files>& f)
+		{
+			pool.submit([f] {
+				const int16_t* src = reinterpret_cast<const int16_t*>(f->input.data());
+				uint8_t* dst = f->output.data();
+				size_t samples = f->input.size() / 2;
+				size_t blocks = samples / ADPCM_BLOCK_SAMPLES;
+
+				adpcm_state_t state;
+				adpcm_state_construct(&state);
+				adpcm_encode(&state, dst, src, blocks);
+
+				// Pad the last block with silence.
+				size_t rest = samples - blocks * ADPCM_BLOCK_SAMPLES;
+				if (rest != 0)
+				{
+					int16_t tail[ADPCM_BLOCK_SAMPLES] = {};
+					std::memcpy(tail, src + blocks * ADPCM_BLOCK_SAMPLES, rest * sizeof(int16_t));
+					adpcm_encode(&state, dst + blocks * ADPCM_BLOCK_BYTES, tail, 1);
+					++blocks;
+				}
+
+				// End of the sample, release the voice.
+				dst[(blocks - 1) * ADPCM_BLOCK_BYTES + 1] = ADPCM_FLAG_LOOP_END;
+			});
+		}
+	}
+
+	void error_log::report(const std::string& message)
+	{
+		std::lock_guard<std::mutex> lock(mutex);
+		std::fprintf(stderr, "ps2intrin-bake: %s\n", message.c_str());
+		++errors;
+	}
+
+	size_t error_log::count() const
+	{
+		std::lock_guard<std::mutex> lock(mutex);
+		return errors;
+	}
+
+	bool parse_operation(const std::string& text, operation& op, std::string& error)
+	{
+		if (text == "5551")
+		{
+			op.kind = operation::rgba5551;
+			return true;
+		}
+		if (text == "adpcm")
+		{
+			op.kind = operation::adpcm;
+			return true;
+		}
+		if (text.compare(0, 9, "swizzle8=") == 0)
+		{
+			char* end = nullptr;
+			unsigned long width = std::strtoul(text.c_str() + 9, &end, 10);
+			if (end == text.c_str() + 9 || *end != '\0' || width == 0 || width % 16 != 0)
+			{
+				error = "swizzle8 width must be a positive multiple of 16: '" + text + "'";
+				return false;
+			}
+			op.kind = operation::swizzle8;
+			op.width = width;
+			return true;
+		}
+
+		error = "unknown operation '" + text + "'";
+		return false;
+	}
+
+	void start_job(thread_pool& pool, const job& j, error_log& errors)
+	{
+		auto f = std::make_shared<files>();
+		std::string error;
+		if (!f->input.open_read(j.input, error))
+		{
+			errors.report(error);
+			return;
+		}
+		// Truncating the output would destroy the input while it is still mapped.
+		if (f->input.same_file(j.output))
+		{
+			errors.report("'" + j.output + "': output is the input file");
+			return;
+		}
+
+		size_t input_size = f->input.size();
+		size_t output_size = 0;
+		switch (j.op.kind)
+		{
+		case operation::rgba5551:
+			if (input_size % 4 != 0)
+			{
+				errors.report("'" + j.input + "': size is not a multiple of 4 bytes (RGBA8888)");
+				return;
+			}
+			output_size = input_size / 2;
+			break;
+
+		case operation::swizzle8:
+			if (input_size % (j.op.width * 16) != 0)
+			{
+				errors.report("'" + j.input + "': size is not a multiple of 16 rows of " + std::to_string(j.op.width) +
+							  " pixels");
+				return;
+			}
+			output_size = input_size;
+			break;
+
+		case operation::adpcm:
+			if (input_size % 2 != 0 || input_size == 0)
+			{
+				errors.report("'" + j.input + "': not 16-bit PCM or empty");
+				return;
+			}
+			output_size = (input_size / 2 + ADPCM_BLOCK_SAMPLES - 1) / ADPCM_BLOCK_SAMPLES * ADPCM_BLOCK_BYTES;
+			break;
+		}
+
+		if (!f->output.open_write(j.output, output_size, error))
+		{
+			errors.report(error);
+			return;
+		}
+
+		switch (j.op.kind)
+		{
+		case operation::rgba5551: start_rgba5551(pool, f); break;
+		case operation::swizzle8: start_swizzle8(pool, f, j.op.width); break;
+		case operation::adpcm: start_adpcm(pool, f); break;
+		}
+	}
+}
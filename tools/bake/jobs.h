@@ -0,0 +1,57 @@
+#pragma once
+
+/*
+*	Bake operations and their split into independent chunks.
+*
+*	A job converts one input file into one output file. Starting a job maps both files and
+*	submits one task per chunk; the mappings are released when the last chunk has finished.
+*	Chunks of 5551 conversion and swizzling are independent. ADPCM encoding carries state from
+*	block to block, so every ADPCM file is a single chunk and only whole files run in parallel.
+*/
+
+#include "thread_pool.h"
+
+#include <cstddef>
+#include <mutex>
+#include <string>
+
+namespace bake
+{
+	struct operation
+	{
+		enum kind_t { swizzle8, rgba5551, adpcm };
+
+		kind_t kind = rgba5551;
+		/// Texture width in pixels for 'swizzle8'
+		size_t width = 0;
+	};
+
+	struct job
+	{
+		operation op;
+		std::string input;
+		std::string output;
+	};
+
+	/// @brief Collects failures of tasks running on any thread.
+	class error_log
+	{
+	public:
+		void report(const std::string& message);
+		size_t count() const;
+
+	private:
+		mutable std::mutex mutex;
+		size_t errors = 0;
+	};
+
+	/// @brief Parse 'swizzle8=<width>', '5551' or 'adpcm'.
+	/// @return false on failure, with a description in 'error'
+	bool parse_operation(const std::string& text, operation& op, std::string& error);
+
+	/// @brief Map the files of 'j' and submit its chunks to 'pool'.
+	///
+	/// Meant to run as a task itself, so files are opened in parallel as well. Failures are
+	/// reported to 'errors'; 'j' and 'errors' must outlive the tasks.
+	void start_job(thread_pool& pool, const job& j, error_log& errors);
+}
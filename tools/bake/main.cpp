@@ -0,0 +1,147 @@
+/*
+*	ps2intrin-bake: converts assets with the same kernels the runtime uses, built with the host
+*	backend. Input and output files are memory-mapped and processed in chunks spread over a
+*	work-stealing thread pool.
+*
+*	Usage: ps2intrin-bake [options] [<operation> <input> <output>]...
+*		-j <threads>	Number of threads (default: number of cores)
+*		-f <file>		Read further '<operation> <input> <output>' lines from a file, '#' starts
+*						a comment. File names cannot contain whitespace.
+*
+*	Operations:
+*		swizzle8=<width>	PSMT8 indices to the PSMCT32 layout, height taken from the file size
+*		5551				RGBA8888 to RGBA5551
+*		adpcm				16-bit little-endian mono PCM to SPU2 ADPCM
+*
+*	Exits with status 1 if any job failed.
+*/
+
+#include "jobs.h"
+#include "thread_pool.h"
+
+#include <cstdio>
+#include <cstdlib>
+#include <fstream>
+#include <sstream>
+#include <string>
+#include <thread>
+#include <vector>
+
+namespace
+{
+	void usage()
+	{
+		std::fprintf(stderr, "usage: ps2intrin-bake [-j <threads>] [-f <file>] [<swizzle8=<width>|5551|adpcm> <input> <output>]...\n");
+	}
+
+	bool add_job(const std::string& op, const std::string& input, const std::string& output, std::vector<bake::job>& jobs)
+	{
+		bake::job j;
+		std::string error;
+		if (!bake::parse_operation(op, j.op, error))
+		{
+			std::fprintf(stderr, "ps2intrin-bake: %s\n", error.c_str());
+			return false;
+		}
+		j.input = input;
+		j.output = output;
+		jobs.push_back(j);
+		return true;
+	}
+
+	bool read_job_file(const std::string& path, std::vector<bake::job>& jobs)
+	{
+		std::ifstream file(path);
+		if (!file)
+		{
+			std::fprintf(stderr, "ps2intrin-bake: cannot open '%s'\n", path.c_str());
+			return false;
+		}
+
+		std::string line;
+		for (int number = 1; std::getline(file, line); ++number)
+		{
+			line = line.substr(0, line.find('#'));
+			std::istringstream fields(line);
+			std::string op, input, output, extra;
+			if (!(fields >> op))
+			{
+				continue;
+			}
+			if (!(fields >> input >> output) || (fields >> extra))
+			{
+				std::fprintf(stderr, "%s:%d: expected '<operation> <input> <output>'\n", path.c_str(), number);
+				return false;
+			}
+			if (!add_job(op, input, output, jobs))
+			{
+				return false;
+			}
+		}
+		return true;
+	}
+}
+
+int main(int argc, char** argv)
+{
+	unsigned threads = std::thread::hardware_concurrency();
+	std::vector<bake::job> jobs;
+	std::vector<std::string> positional;
+
+	for (int i = 1; i < argc; ++i)
+	{
+		std::string arg = argv[i];
+		if (arg == "-j" && i + 1 < argc)
+		{
+			threads = static_cast<unsigned>(std::strtoul(argv[++i], nullptr, 10));
+		}
+		else if (arg == "-f" && i + 1 < argc)
+		{
+			if (!read_job_file(argv[++i], jobs))
+			{
+				return 2;
+			}
+		}
+		else if (arg[0] != '-')
+		{
+			positional.push_back(arg);
+		}
+		else
+		{
+			usage();
+			return 2;
+		}
+	}
+
+	if (positional.size() % 3 != 0)
+	{
+		usage();
+		return 2;
+	}
+	for (size_t i = 0; i < positional.size(); i += 3)
+	{
+		if (!add_job(positional[i], positional[i + 1], positional[i + 2], jobs))
+		{
+			return 2;
+		}
+	}
+	if (jobs.empty())
+	{
+		usage();
+		return 2;
+	}
+
+	bake::error_log errors;
+	{
+		bake::thread_pool pool(threads);
+		for (const bake::job& j : jobs)
+		{
+			pool.submit([&pool, &j, &errors] { bake::start_job(pool, j, errors); });
+		}
+		pool.wait();
+	}
+
+	size_t failed = errors.count();
+	std::printf("%zu job(s) baked, %zu failed\n", jobs.size() - failed, failed);
+	return failed ? 1 : 0;
+}
@@ -0,0 +1,128 @@
+/*
+*	Memory-mapped files on POSIX systems, see 'mapped_file.h'.
+*/
+
+#include "mapped_file.h"
+
+#include <cerrno>
+#include <cstring>
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+namespace bake
+{
+	namespace
+	{
+		std::string describe(const std::string& what, const std::string& path)
+		{
+			return what + " '" + path + "': " + std::strerror(errno);
+		}
+	}
+
+	mapped_file::~mapped_file()
+	{
+		close();
+	}
+
+	bool mapped_file::open_read(const std::string& path, std::string& error)
+	{
+		close();
+
+		int fd = ::open(path.c_str(), O_RDONLY);
+		if (fd < 0)
+		{
+			error = describe("cannot open", path);
+			return false;
+		}
+
+		struct stat info;
+		if (fstat(fd, &info) != 0)
+		{
+			error = describe("cannot stat", path);
+			::close(fd);
+			return false;
+		}
+
+		device = static_cast<uint64_t>(info.st_dev);
+		inode = static_cast<uint64_t>(info.st_ino);
+		length = static_cast<size_t>(info.st_size);
+		if (length != 0)
+		{
+			void* mapping = mmap(nullptr, length, PROT_READ, MAP_PRIVATE, fd, 0);
+			if (mapping == MAP_FAILED)
+			{
+				error = describe("cannot map", path);
+				length = 0;
+				::close(fd);
+				return false;
+			}
+			address = static_cast<uint8_t*>(mapping);
+			// Chunks are read front to back, some of them by other threads right away.
+			madvise(mapping, length, MADV_WILLNEED);
+		}
+
+		::close(fd);
+		return true;
+	}
+
+	bool mapped_file::open_write(const std::string& path, size_t size, std::string& error)
+	{
+		close();
+
+		int fd = ::open(path.c_str(), O_RDWR | O_CREAT | O_TRUNC, 0666);
+		if (fd < 0)
+		{
+			error = describe("cannot create", path);
+			return false;
+		}
+
+		if (ftruncate(fd, static_cast<off_t>(size)) != 0)
+		{
+			error = describe("cannot resize", path);
+			::close(fd);
+			return false;
+		}
+
+		length = size;
+		if (length != 0)
+		{
+			void* mapping = mmap(nullptr, length, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+			if (mapping == MAP_FAILED)
+			{
+				error = describe("cannot map", path);
+				length = 0;
+				::close(fd);
+				return false;
+			}
+			address = static_cast<uint8_t*>(mapping);
+		}
+
+		::close(fd);
+		return true;
+	}
+
+	bool mapped_file::same_file(const std::string& path) const
+	{
+		struct stat info;
+		if (inode == 0 || stat(path.c_str(), &info) != 0)
+		{
+			return false;
+		}
+		return static_cast<uint64_t>(info.st_dev) == device && static_cast<uint64_t>(info.st_ino) == inode;
+	}
+
+	void mapped_file::close()
+	{
+		if (address)
+		{
+			munmap(address, length);
+		}
+		address = nullptr;
+		length = 0;
+		device = 0;
+		inode = 0;
+	}
+}
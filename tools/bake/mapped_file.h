@@ -0,0 +1,48 @@
+#pragma once
+
+/*
+*	Memory-mapped input and output files. Kernels read straight from the input mapping and write
+*	straight into the output mapping, so file data is never copied by the tool itself.
+*/
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+
+namespace bake
+{
+	class mapped_file
+	{
+	public:
+		mapped_file() = default;
+		~mapped_file();
+
+		mapped_file(const mapped_file&) = delete;
+		mapped_file& operator=(const mapped_file&) = delete;
+
+		/// @brief Map an existing file read-only.
+		/// @return false on failure, with a description in 'error'
+		bool open_read(const std::string& path, std::string& error);
+
+		/// @brief Create or truncate a file of 'size' bytes and map it writable.
+		/// @return false on failure, with a description in 'error'
+		bool open_write(const std::string& path, size_t size, std::string& error);
+
+		/// @brief Whether 'path' names the file opened by 'open_read', through any link.
+		bool same_file(const std::string& path) const;
+
+		/// @brief Unmap the file. Written data reaches the file no later than this.
+		void close();
+
+		/// Page aligned, so at least 16-byte aligned as the kernels require. nullptr for empty files.
+		uint8_t* data() const { return address; }
+		size_t size() const { return length; }
+
+	private:
+		uint8_t* address = nullptr;
+		size_t length = 0;
+		// Identity of the file opened by 'open_read', device 0 and inode 0 otherwise
+		uint64_t device = 0;
+		uint64_t inode = 0;
+	};
+}
@@ -0,0 +1,139 @@
+/*
+*	Work-stealing thread pool, see 'thread_pool.h'.
+*/
+
+#include "thread_pool.h"
+
+namespace bake
+{
+	namespace
+	{
+		/// Pool and queue index of the worker running on this thread, if any.
+		thread_local const void* current_pool = nullptr;
+		thread_local size_t current_index = 0;
+	}
+
+	thread_pool::thread_pool(unsigned thread_count)
+	{
+		if (thread_count == 0)
+		{
+			thread_count = 1;
+		}
+
+		for (unsigned i = 0; i < thread_count; ++i)
+		{
+			queues.push_back(std::make_unique<queue>());
+		}
+		for (unsigned i = 0; i < thread_count; ++i)
+		{
+			workers.emplace_back([this, i] { run(i); });
+		}
+	}
+
+	thread_pool::~thread_pool()
+	{
+		wait();
+		{
+			std::lock_guard<std::mutex> lock(mutex);
+			stopping = true;
+		}
+		work_available.notify_all();
+		for (std::thread& worker : workers)
+		{
+			worker.join();
+		}
+	}
+
+	void thread_pool::submit(task t)
+	{
+		size_t index;
+		if (current_pool == this)
+		{
+			index = current_index;
+		}
+		else
+		{
+			std::lock_guard<std::mutex> lock(mutex);
+			index = next_queue;
+			next_queue = (next_queue + 1) % queues.size();
+		}
+
+		pending.fetch_add(1);
+		{
+			std::lock_guard<std::mutex> lock(queues[index]->mutex);
+			queues[index]->tasks.push_back(std::move(t));
+		}
+		{
+			// Increment under the lock, so a worker cannot check 'queued' and go to sleep in between.
+			std::lock_guard<std::mutex> lock(mutex);
+			queued.fetch_add(1);
+		}
+		work_available.notify_one();
+	}
+
+	void thread_pool::wait()
+	{
+		std::unique_lock<std::mutex> lock(mutex);
+		all_done.wait(lock, [this] { return pending.load() == 0; });
+	}
+
+	void thread_pool::run(size_t index)
+	{
+		current_pool = this;
+		current_index = index;
+
+		for (;;)
+		{
+			task t;
+			if (pop(index, t) || steal(index, t))
+			{
+				queued.fetch_sub(1);
+				t();
+				t = nullptr;
+
+				if (pending.fetch_sub(1) == 1)
+				{
+					std::lock_guard<std::mutex> lock(mutex);
+					all_done.notify_all();
+				}
+				continue;
+			}
+
+			std::unique_lock<std::mutex> lock(mutex);
+			work_available.wait(lock, [this] { return stopping || queued.load() != 0; });
+			if (stopping && queued.load() == 0)
+			{
+				return;
+			}
+		}
+	}
+
+	bool thread_pool::pop(size_t index, task& t)
+	{
+		queue& q = *queues[index];
+		std::lock_guard<std::mutex> lock(q.mutex);
+		if (q.tasks.empty())
+		{
+			return false;
+		}
+		t = std::move(q.tasks.back());
+		q.tasks.pop_back();
+		return true;
+	}
+
+	bool thread_pool::steal(size_t index, task& t)
+	{
+		for (size_t i = 1; i < queues.size(); ++i)
+		{
+			queue& q = *queues[(index + i) % queues.size()];
+			std::lock_guard<std::mutex> lock(q.mutex);
+			if (!q.tasks.empty())
+			{
+				t = std::move(q.tasks.front());
+				q.tasks.pop_front();
+				return true;
+			}
+		}
+		return false;
+	}
+}
@@ -0,0 +1,69 @@
+#pragma once
+
+/*
+*	Work-stealing thread pool.
+*
+*	Every worker owns a queue. Tasks submitted from a worker go to the back of its own queue and
+*	the worker takes from the back, so work split off by a task stays on the same core while
+*	its data is warm. Idle workers steal from the front of the other queues, which holds the
+*	oldest and usually largest pieces of work.
+*/
+
+#include <atomic>
+#include <condition_variable>
+#include <cstddef>
+#include <deque>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace bake
+{
+	class thread_pool
+	{
+	public:
+		typedef std::function<void()> task;
+
+		/// @param thread_count Number of workers, at least 1
+		explicit thread_pool(unsigned thread_count);
+		~thread_pool();
+
+		thread_pool(const thread_pool&) = delete;
+		thread_pool& operator=(const thread_pool&) = delete;
+
+		/// @brief Queue a task. May be called from any thread, including from within a task.
+		void submit(task t);
+
+		/// @brief Block until every submitted task, including tasks they submitted, has finished.
+		void wait();
+
+		unsigned thread_count() const { return static_cast<unsigned>(workers.size()); }
+
+	private:
+		struct queue
+		{
+			std::mutex mutex;
+			std::deque<task> tasks;
+		};
+
+		void run(size_t index);
+		bool pop(size_t index, task& t);
+		bool steal(size_t index, task& t);
+
+		std::vector<std::unique_ptr<queue>> queues;
+		std::vector<std::thread> workers;
+
+		/// Guards sleeping and waking, 'stopping' and the round-robin position of outside submits.
+		std::mutex mutex;
+		std::condition_variable work_available;
+		std::condition_variable all_done;
+		/// Tasks submitted but not finished yet.
+		std::atomic<size_t> pending{ 0 };
+		/// Tasks sitting in a queue, checked before going to sleep.
+		std::atomic<size_t> queued{ 0 };
+		size_t next_queue = 0;
+		bool stopping = false;
+	};
+}